@@ -692,6 +692,39 @@ printPercent(const char* name, double value, const char* description)
     printf("%-20s    %.1f %%      %s\n", name, value, description);
 }
 
+/**
+ * Print the average number of network packets transmitted per kernel
+ * call, across all servers, between two readings of server PerfStats.
+ * This measures how well kernel-based drivers (such as UdpDriver) are
+ * batching their transmissions; it prints nothing if the servers didn't
+ * transmit via the kernel.
+ *
+ * \param name
+ *      Symbolic name for the measurement, in the form test.value.
+ * \param before
+ *      Response from a GET_PERF_STATS call to serverControlAll.
+ * \param after
+ *      Response from a later GET_PERF_STATS call to serverControlAll.
+ */
+void
+printPacketsPerSyscall(const char* name, Buffer* before, Buffer* after)
+{
+    PerfStats::Diff diff;
+    PerfStats::clusterDiff(before, after, &diff);
+    double packets = 0, syscalls = 0;
+    foreach (double value, diff["networkOutputPackets"]) {
+        packets += value;
+    }
+    foreach (double value, diff["networkOutputSyscalls"]) {
+        syscalls += value;
+    }
+    if (packets == 0 || syscalls == 0) {
+        return;
+    }
+    printf("%-20s %6.2f       server packets per transmit syscall\n", name,
+            packets/syscalls);
+}
+
 /**
  * Time how long it takes to do an indexed write/overwrite.
  *
@@ -2535,13 +2568,18 @@ echo_basic()
 
     // Each iteration through the following loop measures the round-trip time
     // of a particular message size.
+    Buffer statsBefore[NUM_SIZES], statsAfter[NUM_SIZES];
     for (int i = 0; i < NUM_SIZES; i++) {
         int size = sizes[i];
         LOG(NOTICE, "Starting echo test for %d-byte reply messages", size);
         cluster->logMessageAll(NOTICE,
                 "Starting echo test for %d-byte reply messages", size);
+        cluster->serverControlAll(WireFormat::GET_PERF_STATS, NULL, 0,
+                &statsBefore[i]);
         echoDists[i] = echoMessages({receiverLocator}, outgoingMessageLength,
                 size, 100000, 2.0);
+        cluster->serverControlAll(WireFormat::GET_PERF_STATS, NULL, 0,
+                &statsAfter[i]);
     }
     Logger::get().sync();
 
@@ -2574,6 +2612,8 @@ echo_basic()
         snprintf(description, sizeof(description),
                 "bandwidth receiving %sB messages", ids[i]);
         printBandwidth(name, dist->bandwidth, description);
+        snprintf(name, sizeof(name), "echoTxBatch%s", ids[i]);
+        printPacketsPerSyscall(name, &statsBefore[i], &statsAfter[i]);
     }
 #undef NUM_SIZES
 }
@@ -5563,6 +5603,9 @@ netBandwidth()
     createTables(tableIds, objectSize, key, keyLength);
 
     // Start all the slaves running, and read our own local object.
+    Buffer statsBefore, statsAfter;
+    cluster->serverControlAll(WireFormat::GET_PERF_STATS, NULL, 0,
+            &statsBefore);
     sendCommand("run", "running", 1, numClients-1);
     RAMCLOUD_LOG(DEBUG, "Master reading from table %lu", tableIds.at(0));
     Buffer value;
@@ -5583,6 +5626,10 @@ netBandwidth()
             "fastest client");
     printBandwidth("netBandwidth.min", min(metrics[0]),
             "slowest client");
+    cluster->serverControlAll(WireFormat::GET_PERF_STATS, NULL, 0,
+            &statsAfter);
+    printPacketsPerSyscall("netBandwidth.txBatch", &statsBefore,
+            &statsAfter);
 }
 
 // Each client reads a single object from each master.  Good for
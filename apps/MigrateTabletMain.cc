@@ -19,6 +19,8 @@
  * specified recipient master.
  */
 
+#include <algorithm>
+
 #include "Common.h"
 
 #include "Context.h"
@@ -44,6 +46,7 @@ try
     uint32_t objectCount = 0;
     uint32_t objectSize = 0;
     uint32_t otherObjectCount = 0;
+    uint32_t pullPartitions = 0;
 
     OptionsDescription migrateOptions("Migrate");
     migrateOptions.add_options()
@@ -76,6 +79,12 @@ try
            default_value(0),
          "Number of objects to pre-populate in the table to be "
          "NOT TO BE migrated")
+        ("pullPartitions",
+         ProgramOptions::value<uint32_t>(&pullPartitions)->
+           default_value(0),
+         "If nonzero, the recipient pulls the tablet from the hash table of "
+         "its current owner using this many partitions; otherwise the "
+         "current owner pushes the tablet by scanning its log")
         ("numClients",
          "Ignored by this program")
         ("clientIndex",
@@ -113,17 +122,42 @@ try
     LOG(ERROR, "  first key %lu", firstKey);
     LOG(ERROR, "  last key  %lu", lastKey);
     LOG(ERROR, "  recipient master id %lu", newOwnerMasterId);
+    LOG(ERROR, "  pull partitions %u", pullPartitions);
 
     {
+        // While the migration runs, read objects from the other table to
+        // measure the impact of the migration on other requests (the other
+        // table is usually served by the tablet's current owner).
+        vector<uint64_t> latencies;
         CycleCounter<> counter{};
-        client.migrateTablet(tableId,
-                             firstKey,
-                             lastKey,
-                             ServerId(newOwnerMasterId));
+        MigrateTabletRpc rpc(&client, tableId, firstKey, lastKey,
+                ServerId(newOwnerMasterId), pullPartitions);
+        while (!rpc.isReady()) {
+            if (otherObjectCount == 0) {
+                client.poll();
+                continue;
+            }
+            string key = format("%u", downCast<uint32_t>(generateRandom() %
+                    otherObjectCount));
+            Buffer value;
+            uint64_t start = Cycles::rdtsc();
+            client.read(otherTableId, key.c_str(),
+                    downCast<uint16_t>(key.length()), &value);
+            latencies.push_back(Cycles::rdtsc() - start);
+        }
+        rpc.wait();
         double seconds = Cycles::toSeconds(counter.stop());
         LOG(ERROR, "Migration took %0.2f seconds", seconds);
         LOG(ERROR, "Migration took %0.2f MB/s",
                 double(totalBytes) / seconds / double(1 << 20));
+        if (!latencies.empty()) {
+            std::sort(latencies.begin(), latencies.end());
+            LOG(ERROR, "Reads of other table during migration: %lu reads, "
+                    "median %lu us, 99%% %lu us", latencies.size(),
+                    Cycles::toMicroseconds(latencies[latencies.size() / 2]),
+                    Cycles::toMicroseconds(
+                            latencies[latencies.size() * 99 / 100]));
+        }
     }
 
 #if 0
@@ -0,0 +1,94 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <iostream>
+#include <boost/program_options.hpp>
+namespace po = boost::program_options;
+
+#include <string>
+
+#include "RamCloud.h"
+#include "TimeTrace.h"
+
+using namespace RAMCloud;
+
+/**
+ * This program collects the sampled time traces from every server in a
+ * cluster and prints them as one timeline per traced RPC, showing how
+ * long the RPC spent at each step on each server it touched (see
+ * TimeTrace::sampleRpc). It can also turn sampling on or off on all of
+ * the servers first.
+ */
+int
+main(int argc, char *argv[])
+try
+{
+    std::string logLevel{"NOTICE"};
+    int sampleInterval = -1;
+    CommandLineOptions options{};
+
+    po::options_description desc{
+        "Usage: TraceTimelines [options]\n\n"
+        "Prints the timelines of the RPCs sampled by the time traces of\n"
+        "all the servers in a RAMCloud cluster.\n\n"
+        "Allowed options:"};
+
+    desc.add_options()
+        ("coordinator,C", po::value<string>(&options.coordinatorLocator),
+                "Service locator for the cluster coordinator (required)")
+        ("logLevel,l", po::value<string>(&logLevel)->default_value("NOTICE"),
+                "Print log messages only at this severity level or higher "
+                "(ERROR, WARNING, NOTICE, DEBUG)")
+        ("sampleInterval", po::value<int>(&sampleInterval),
+                "Before collecting the traces, tell every server to sample "
+                "about one in this many RPCs (0 turns sampling off)")
+        ("help,h", "Print this help message");
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(argc, argv).
+            options(desc).run(), vm);
+    po::notify(vm);
+
+    Logger::get().setLogLevels(logLevel);
+
+    if (vm.count("help")) {
+        std::cout << desc << std::endl;
+        exit(0);
+    }
+
+    if (options.coordinatorLocator.empty()) {
+        RAMCLOUD_LOG(ERROR, "missing required option --coordinator");
+        exit(1);
+    }
+
+    RamCloud ramcloud(&options);
+    if (sampleInterval >= 0) {
+        uint32_t interval = downCast<uint32_t>(sampleInterval);
+        Buffer output;
+        ramcloud.serverControlAll(
+            WireFormat::ControlOp::SET_TIME_TRACE_SAMPLING, &interval,
+            sizeof32(interval), &output);
+    }
+
+    Buffer traces;
+    ramcloud.serverControlAll(
+        WireFormat::ControlOp::GET_SAMPLED_TIME_TRACE, NULL, 0, &traces);
+    printf("%s", TimeTrace::printRpcTimelines(&traces).c_str());
+
+    return 0;
+} catch (std::exception& e) {
+    RAMCLOUD_LOG(ERROR, "%s", e.what());
+    exit(1);
+}
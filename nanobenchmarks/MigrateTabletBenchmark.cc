@@ -13,6 +13,10 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "ClientException.h"
 #include "Cycles.h"
 #include "Logger.h"
@@ -210,6 +214,136 @@ if (metrics->temp.count##i.load()) { \
         }
     }
 
+    /**
+     * Entry point for the threads in runPull: each copies the objects
+     * from one range of hash table buckets, the way the source of a
+     * pull-based migration does in response to PULL_TABLET_DATA requests.
+     */
+    static void
+    pullThreadEntry(ObjectManager* objectManager, uint64_t startBucket,
+                    uint64_t endBucket, std::atomic<uint64_t>* totalBytes,
+                    std::atomic<uint32_t>* stopCount)
+    {
+        while (startBucket < endBucket) {
+            Segment segment;
+            startBucket = objectManager->copyTabletObjects(0, 0, ~0UL,
+                    startBucket, endBucket, 1024 * 1024, &segment);
+            *totalBytes += segment.getAppendedLength();
+        }
+        (*stopCount)++;
+    }
+
+    /**
+     * Read random objects from table 1 and record the latency of each read.
+     *
+     * \param numKeys
+     *      Number of objects in table 1.
+     * \param[out] latencies
+     *      The latency of each read, in cycles, is appended here.
+     * \param stopCount
+     *      If non-NULL, reads continue until this reaches numThreads;
+     *      otherwise 100000 reads are performed.
+     * \param numThreads
+     *      See stopCount.
+     */
+    void
+    timeReads(uint64_t numKeys, std::vector<uint64_t>* latencies,
+              std::atomic<uint32_t>* stopCount, uint32_t numThreads)
+    {
+        for (int i = 0; stopCount != NULL ? *stopCount < numThreads
+                                          : i < 100000; i++) {
+            uint64_t keyInt = generateRandom() % numKeys;
+            Key key(1, &keyInt, sizeof(keyInt));
+            Buffer buffer;
+            uint64_t start = Cycles::rdtsc();
+            service->objectManager.readObject(key, &buffer, NULL, NULL);
+            latencies->push_back(Cycles::rdtsc() - start);
+        }
+    }
+
+    /// Print the median and 99th percentile of a set of latencies.
+    static void
+    printLatencies(const char* label, std::vector<uint64_t>* latencies)
+    {
+        std::sort(latencies->begin(), latencies->end());
+        printf("%s read latency: median %lu ns, 99%% %lu ns (%lu reads)\n",
+                label,
+                Cycles::toNanoseconds((*latencies)[latencies->size() / 2]),
+                Cycles::toNanoseconds(
+                        (*latencies)[latencies->size() * 99 / 100]),
+                latencies->size());
+    }
+
+    /**
+     * Measure the source side of a pull-based migration (see
+     * MasterService::pullTablet): numThreads threads copy a tablet's objects
+     * out of the hash table in parallel, while the main thread measures the
+     * latency of reads to another table.
+     */
+    void
+    runPull(uint32_t numSegments, uint32_t dataLen, uint32_t numThreads)
+    {
+        service->tabletManager.addTablet(0, 0, ~0UL, TabletManager::NORMAL);
+        service->tabletManager.addTablet(1, 0, ~0UL, TabletManager::NORMAL);
+
+        // Fill the log with objects; every tenth object goes in table 1,
+        // which isn't migrated.
+        uint64_t numObjects = 0;
+        uint64_t numOtherObjects = 0;
+        uint64_t nextKeyVal = 0;
+        uint64_t totalObjectBytes = 0;
+        while (totalObjectBytes <
+                uint64_t(numSegments) * Segment::DEFAULT_SEGMENT_SIZE) {
+            bool other = (nextKeyVal % 10) == 9;
+            uint64_t keyVal = other ? numOtherObjects++ : numObjects++;
+            Key key(other ? 1 : 0, &keyVal, sizeof(keyVal));
+            char objectData[dataLen];
+            Buffer dataBuffer;
+            Object object(key, objectData, dataLen, 0, 0, dataBuffer);
+            Status status = service->objectManager.writeObject(object,
+                    NULL, NULL);
+            if (status != STATUS_OK) {
+                fprintf(stderr, "Failed to write object! Out of memory?\n");
+                exit(1);
+            }
+            nextKeyVal++;
+            totalObjectBytes += dataLen + sizeof(keyVal);
+        }
+
+        std::vector<uint64_t> idleLatencies;
+        timeReads(numOtherObjects, &idleLatencies, NULL, 0);
+
+        uint64_t numBuckets =
+                service->objectManager.getObjectMap()->getNumBuckets();
+        uint64_t bucketsPerThread = (numBuckets + numThreads - 1) / numThreads;
+        std::atomic<uint64_t> totalBytes(0);
+        std::atomic<uint32_t> stopCount(0);
+        std::vector<uint64_t> pullLatencies;
+        std::thread* threads[numThreads];
+        uint64_t before = Cycles::rdtsc();
+        for (uint32_t i = 0; i < numThreads; i++) {
+            uint64_t start = std::min(i * bucketsPerThread, numBuckets);
+            threads[i] = new std::thread(pullThreadEntry,
+                    &service->objectManager, start,
+                    std::min(start + bucketsPerThread, numBuckets),
+                    &totalBytes, &stopCount);
+        }
+        timeReads(numOtherObjects, &pullLatencies, &stopCount, numThreads);
+        uint64_t ticks = Cycles::rdtsc() - before;
+        for (uint32_t i = 0; i < numThreads; i++) {
+            threads[i]->join();
+            delete threads[i];
+        }
+
+        double seconds = Cycles::toSeconds(ticks);
+        printf("Pull of %lu %d byte Objects with %u threads took %lu ms "
+                "(%.2f MB/s)\n", numObjects, dataLen, numThreads,
+                Cycles::toNanoseconds(ticks) / 1000 / 1000,
+                static_cast<double>(totalBytes) / seconds / 1024. / 1024.);
+        printLatencies("Idle", &idleLatencies);
+        printLatencies("During pull", &pullLatencies);
+    }
+
     DISALLOW_COPY_AND_ASSIGN(MigrateTabletBenchmark);
 };
 
@@ -225,17 +359,32 @@ main(int argc, char* argv[])
             "totalObjectBytes totalSegmentBytes objectThroughputMBs "
             "logThroughputMBs\n\n");
 
-    if (argc == 2) {
+    // An optional second argument gives the number of threads to use for
+    // measuring pull-based migration.
+    uint32_t pullThreads = 4;
+    if (argc == 3) {
+        pullThreads = atoi(argv[2]);
+    }
+
+    if (argc >= 2) {
         int dataLen = atoi(argv[1]);
-        RAMCloud::MigrateTabletBenchmark rsb("2048", "10%", numSegments);
-        rsb.run(numSegments, dataLen);
+        {
+            RAMCloud::MigrateTabletBenchmark rsb("2048", "10%", numSegments);
+            rsb.run(numSegments, dataLen);
+        }
+        RAMCloud::MigrateTabletBenchmark pull("2048", "10%", numSegments);
+        pull.runPull(numSegments, dataLen, pullThreads);
         return 0;
     }
 
     for (int i = 0; dataLen[i] != 0; i++) {
         printf("==========================\n");
-        RAMCloud::MigrateTabletBenchmark rsb("2048", "10%", numSegments);
-        rsb.run(numSegments, dataLen[i]);
+        {
+            RAMCloud::MigrateTabletBenchmark rsb("2048", "10%", numSegments);
+            rsb.run(numSegments, dataLen[i]);
+        }
+        RAMCloud::MigrateTabletBenchmark pull("2048", "10%", numSegments);
+        pull.runPull(numSegments, dataLen[i], pullThreads);
     }
 
     return 0;
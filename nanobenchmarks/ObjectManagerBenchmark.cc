@@ -42,7 +42,8 @@ class ObjectManagerBenchmark {
     ServerId serverId;
     ObjectManager* objectManager;
 
-    ObjectManagerBenchmark(string logSize, string hashTableSize)
+    ObjectManagerBenchmark(string logSize, string hashTableSize,
+                           uint32_t compactObjectThreshold = 0)
         : context()
         , clusterClock()
         , clientLeaseValidator(&context, &clusterClock)
@@ -68,6 +69,7 @@ class ObjectManagerBenchmark {
         config.master.disableLogCleaner = true;
         config.segmentSize = Segment::DEFAULT_SEGMENT_SIZE;
         config.segletSize = Seglet::DEFAULT_SEGLET_SIZE;
+        config.master.compactObjectThreshold = compactObjectThreshold;
         objectManager = new ObjectManager(&context,
                                           &serverId,
                                           &config,
@@ -105,15 +107,23 @@ class ObjectManagerBenchmark {
         (*stopCount)++;
     }
 
-    double
-    run(uint32_t numSegments, uint32_t dataBytes, uint32_t numThreads)
+    /**
+     * Fill up 'numSegments' worth of segments in the log with objects of
+     * size 'dataBytes', with 8-byte keys 0, 1, 2, ...
+     *
+     * \param[out] writesPerSec
+     *      If non-NULL, filled in with the rate at which objects were
+     *      written.
+     * \return
+     *      The number of objects written.
+     */
+    uint64_t
+    fill(uint32_t numSegments, uint32_t dataBytes,
+         double* writesPerSec = NULL)
     {
         tabletManager.addTablet(0, 0, ~0UL, TabletManager::NORMAL);
 
-        /*
-         * Fill up 'numSegments' worth of segments in the log with objects of
-         * size 'dataBytes'. These will be the objects that we will read.
-         */
+        uint64_t start = Cycles::rdtsc();
         uint64_t nextKeyVal = 0;
         do {
             Key key(0, &nextKeyVal, sizeof(nextKeyVal));
@@ -128,6 +138,20 @@ class ObjectManagerBenchmark {
             }
             nextKeyVal++;
         } while (objectManager->log.head->id <= numSegments);
+        uint64_t stop = Cycles::rdtsc();
+
+        if (writesPerSec != NULL) {
+            *writesPerSec = static_cast<double>(nextKeyVal) /
+                            Cycles::toSeconds(stop - start);
+        }
+        return nextKeyVal;
+    }
+
+    double
+    run(uint32_t numSegments, uint32_t dataBytes, uint32_t numThreads)
+    {
+        // These will be the objects that we will read.
+        uint64_t nextKeyVal = fill(numSegments, dataBytes);
 
         /*
          * Now "read" a bunch of random objects.
@@ -191,5 +215,21 @@ main()
             (readsPerSec / oneThreadRate) / threads[i] * 100);
     }
 
+    printf("========= 30-byte Objects: Log Density =========\n");
+    double segmentsPerGB = 1024.0 * 1024 * 1024 /
+                           RAMCloud::Segment::DEFAULT_SEGMENT_SIZE;
+    uint32_t compactThresholds[] = { 0, 64 };
+    for (uint32_t threshold : compactThresholds) {
+        RAMCloud::ObjectManagerBenchmark omb("2048", "10%", threshold);
+        double writesPerSec;
+        uint64_t objects = omb.fill(numSegments, 30, &writesPerSec);
+        printf(" %s headers: %.2f M objects/GB, %.2f writes/s, "
+            "%.3f us/write\n",
+            threshold == 0 ? "full" : "compact",
+            static_cast<double>(objects) / numSegments * segmentsPerGB / 1e6,
+            writesPerSec,
+            1.0e6 / writesPerSec);
+    }
+
     return 0;
 }
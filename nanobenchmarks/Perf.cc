@@ -35,6 +35,9 @@
 #else
 #include <cstdatomic>
 #endif
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -52,12 +55,18 @@
 #include "Object.h"
 #include "ObjectPool.h"
 #include "QueueEstimator.h"
+#include "Seglet.h"
+#include "SegletAllocator.h"
 #include "Segment.h"
 #include "SegmentIterator.h"
+#include "ServerConfig.h"
+#include "ServiceLocator.h"
+#include "SharedMemoryDriver.h"
 #include "SpinLock.h"
 #include "ClientException.h"
 #include "PerfHelper.h"
 #include "TimeTrace.h"
+#include "UdpDriver.h"
 #include "Util.h"
 
 using namespace RAMCloud;
@@ -791,6 +800,65 @@ double div64()
     return Cycles::toSeconds(stop - start)/count;
 }
 
+// Measure the round-trip time for a 100-byte packet between two drivers
+// of the given type in this process. One thread echoes every packet that
+// arrives at the "server" driver back to its sender; the main thread sends
+// from a client-only driver and polls until the echo arrives.
+template<typename DriverType>
+double driverRoundTrip(const char* serverLocatorString)
+{
+    int count = 100000;
+    Context context;
+    ServiceLocator serverLocator(serverLocatorString);
+    DriverType server(&context, &serverLocator);
+    DriverType client(&context);
+    ServiceLocator locator(server.getServiceLocator());
+    std::unique_ptr<Driver::Address> address(client.newAddress(&locator));
+
+    std::atomic<bool> done(false);
+    std::thread echo([&server, &done] {
+        pinThread(core2);
+        std::vector<Driver::Received> received;
+        while (!done.load()) {
+            server.receivePackets(16, &received);
+            foreach (Driver::Received& packet, received) {
+                server.sendPacket(packet.sender, packet.payload, packet.len,
+                        NULL);
+            }
+            received.clear();
+        }
+    });
+    pinThread(core1);
+
+    char message[100];
+    memset(message, 'x', sizeof(message));
+    std::vector<Driver::Received> received;
+    uint64_t start = Cycles::rdtsc();
+    for (int i = 0; i < count; i++) {
+        client.sendPacket(address.get(), message, sizeof(message), NULL);
+        while (received.empty()) {
+            client.receivePackets(1, &received);
+        }
+        received.clear();
+    }
+    uint64_t stop = Cycles::rdtsc();
+    unpinThread();
+    done.store(true);
+    echo.join();
+    return Cycles::toSeconds(stop - start)/count;
+}
+
+double shmRoundTrip()
+{
+    return driverRoundTrip<SharedMemoryDriver>("shm:");
+}
+
+double udpRoundTrip()
+{
+    return driverRoundTrip<UdpDriver>(
+            "udp:host=localhost,port=12246");
+}
+
 // Measure the cost of calling a non-inlined function.
 double functionCall()
 {
@@ -919,6 +987,133 @@ double hashTableLookup()
     return Cycles::toSeconds((stop - start) / numLookups);
 }
 
+// Shared state for the hashTableRead tests: a few keys in a small hash
+// table, with bucket locks and sequence numbers like ObjectManager's.
+struct HashTableReadState {
+    enum { NUM_BUCKETS = 1024, NUM_KEYS = 16 };
+
+    HashTableReadState()
+        : hashTable(NUM_BUCKETS)
+        , locks()
+        , versions()
+        , keys()
+        , hashes()
+        , finished(false)
+    {
+        for (uint64_t i = 0; i < NUM_KEYS; i++) {
+            keys[i] = i;
+            Key key(0, &keys[i], downCast<uint16_t>(sizeof(keys[i])));
+            hashes[i] = key.getHash();
+            hashTable.insert(hashes[i], reinterpret_cast<uint64_t>(&keys[i]));
+        }
+    }
+
+    HashTable hashTable;
+    UnnamedSpinLock locks[1024];
+    Atomic<uint64_t> versions[1024];
+    uint64_t keys[NUM_KEYS];
+    KeyHash hashes[NUM_KEYS];
+    volatile bool finished;
+};
+
+// Look up one of the keys in a HashTableReadState. If seqlock is false,
+// this takes the bucket lock (as HashTableBucketLock does); otherwise it
+// validates the bucket's sequence number instead (as
+// ObjectManager::lookupWithoutLock does). Returns the key's reference.
+template<bool seqlock>
+uint64_t hashTableRead(HashTableReadState* state, uint64_t i)
+{
+    uint64_t unused;
+    uint64_t bucket = HashTable::findBucketIndex(
+            HashTableReadState::NUM_BUCKETS, state->hashes[i], &unused);
+    uint64_t lockIndex = bucket & (arrayLength(state->locks) - 1);
+    UnnamedSpinLock& lock = state->locks[lockIndex];
+    Atomic<uint64_t>& version = state->versions[lockIndex];
+
+    while (true) {
+        uint64_t startVersion = 0;
+        if (seqlock) {
+            startVersion = version.load();
+            if ((startVersion & 1) != 0)
+                continue;
+            Fence::compilerBarrier();
+        } else {
+            lock.lock();
+            version.store(version.load() + 1);
+            Fence::sfence();
+        }
+
+        uint64_t result = 0;
+        bool retry = false;
+        HashTable::Candidates candidates;
+        state->hashTable.lookup(state->hashes[i], candidates);
+        while (!candidates.isDone()) {
+            uint64_t reference = candidates.getReference();
+            if (seqlock) {
+                Fence::compilerBarrier();
+                if (version.load() != startVersion) {
+                    retry = true;
+                    break;
+                }
+            }
+            if (*reinterpret_cast<uint64_t*>(reference) == i) {
+                result = reference;
+                break;
+            }
+            candidates.next();
+        }
+
+        if (seqlock) {
+            Fence::compilerBarrier();
+            if (retry || version.load() != startVersion)
+                continue;
+        } else {
+            Fence::sfence();
+            version.store(version.load() + 1);
+            lock.unlock();
+        }
+        return result;
+    }
+}
+
+// This function runs the second thread for hashTableRead: it reads the
+// same keys as the main thread until told to stop.
+template<bool seqlock>
+void hashTableReadWorker(HashTableReadState* state)
+{
+    pinThread(core2);
+    uint64_t sum = 0;
+    for (uint64_t i = 0; !state->finished; i++)
+        sum += hashTableRead<seqlock>(state, i % HashTableReadState::NUM_KEYS);
+    discard(&sum);
+}
+
+// Measure the cost of reading a key from the hash table while another core
+// reads the same few keys, either under the bucket lock or validating the
+// bucket's sequence number instead. This shows what readObject saves by
+// not taking the lock when many workers read hot objects.
+template<bool seqlock>
+double hashTableReadConcurrent()
+{
+    int count = 1000000;
+    HashTableReadState state;
+    std::thread thread(hashTableReadWorker<seqlock>, &state);
+    pinThread(core1);
+
+    uint64_t sum = 0;
+    uint64_t start = Cycles::rdtsc();
+    for (int i = 0; i < count; i++) {
+        sum += hashTableRead<seqlock>(&state,
+                downCast<uint64_t>(i) % HashTableReadState::NUM_KEYS);
+    }
+    uint64_t stop = Cycles::rdtsc();
+    state.finished = true;
+    thread.join();
+    unpinThread();
+    discard(&sum);
+    return Cycles::toSeconds(stop - start)/count;
+}
+
 // Measure the cost of an lfence instruction.
 double lfence()
 {
@@ -1401,6 +1596,80 @@ double rdtscTest()
     return Cycles::toSeconds(stop - start)/count;
 }
 
+// Measure the cost of allocating a seglet from a SegletAllocator's default
+// pools and freeing it again, with the log memory divided among numaNodes
+// NUMA nodes (more than one node means each allocation also looks up the
+// calling thread's node).
+template<uint32_t numaNodes>
+double segletAlloc()
+{
+    ServerConfig config = ServerConfig::forTesting();
+    config.master.logBytes = 64 * 1024 * 1024;
+    config.master.numaNodes = numaNodes;
+    SegletAllocator allocator(&config);
+    vector<Seglet*> seglets;
+    int count = 1000000;
+    uint64_t start = Cycles::rdtsc();
+    for (int i = 0; i < count; i++) {
+        allocator.alloc(SegletAllocator::DEFAULT, 1, seglets);
+        seglets.back()->free();
+        seglets.pop_back();
+    }
+    uint64_t stop = Cycles::rdtsc();
+    return Cycles::toSeconds(stop - start)/count;
+}
+
+// Measure the latency of a cache-missing read from log memory, with the log
+// divided between two NUMA nodes and the reading thread on node 0: remote
+// selects seglets backed by node 1 rather than node 0. Each read follows a
+// pointer through a random cycle over 64 MB of seglets, so it has to wait
+// for the previous one and nearly always misses in the cache.
+template<bool remote>
+double segletRead()
+{
+    ServerConfig config = ServerConfig::forTesting();
+    config.master.logBytes = 128 * 1024 * 1024;
+    config.master.numaNodes = 2;
+    SegletAllocator allocator(&config);
+    Util::pinThreadToNumaNode(0);
+
+    // Node 0 backs the first half of the log and node 1 the second.
+    vector<Seglet*> seglets;
+    allocator.alloc(SegletAllocator::DEFAULT,
+            downCast<uint32_t>(
+                allocator.getFreeCount(SegletAllocator::DEFAULT)),
+            seglets);
+    const uint8_t* half = static_cast<const uint8_t*>(
+            allocator.getBaseAddress()) + allocator.getTotalBytes() / 2;
+    vector<uint64_t*> lines;
+    foreach (Seglet* seglet, seglets) {
+        uint8_t* p = static_cast<uint8_t*>(seglet->get());
+        if ((p >= half) != remote)
+            continue;
+        for (uint32_t offset = 0; offset < seglet->getLength(); offset += 64)
+            lines.push_back(reinterpret_cast<uint64_t*>(p + offset));
+    }
+    for (size_t i = lines.size() - 1; i > 0; i--)
+        std::swap(lines[i], lines[generateRandom() % (i + 1)]);
+    for (size_t i = 0; i < lines.size(); i++) {
+        *lines[i] = reinterpret_cast<uint64_t>(
+                lines[(i + 1) % lines.size()]);
+    }
+
+    int count = 1000000;
+    uint64_t* p = lines[0];
+    uint64_t start = Cycles::rdtsc();
+    for (int i = 0; i < count; i++) {
+        p = reinterpret_cast<uint64_t*>(*p);
+    }
+    uint64_t stop = Cycles::rdtsc();
+    discard(p);
+    foreach (Seglet* seglet, seglets)
+        seglet->free();
+    unpinThread();
+    return Cycles::toSeconds(stop - start)/count;
+}
+
 // Sorting functor for #segmentEntrySort.
 struct SegmentEntryLessThan {
   public:
@@ -1596,6 +1865,131 @@ double startStopTimer()
     return Cycles::toSeconds(stop - start)/count;
 }
 
+// Connect two TCP sockets over the loopback interface. Used by the tcpRecv
+// and tcpSend tests, which compare TcpTransport's batched I/O ("rxBuffer"
+// and coalesced sends) with transferring one message at a time.
+static void tcpConnectLoopback(int* client, int* server)
+{
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    if ((bind(listener, reinterpret_cast<sockaddr*>(&address),
+            length) != 0) || (listen(listener, 1) != 0) ||
+            (getsockname(listener, reinterpret_cast<sockaddr*>(&address),
+            &length) != 0)) {
+        RAMCLOUD_DIE("couldn't create loopback listener: %s",
+                strerror(errno));
+    }
+    *client = socket(AF_INET, SOCK_STREAM, 0);
+    if (connect(*client, reinterpret_cast<sockaddr*>(&address),
+            length) != 0) {
+        RAMCLOUD_DIE("couldn't connect over loopback: %s",
+                strerror(errno));
+    }
+    *server = accept(listener, NULL, NULL);
+    close(listener);
+    int flag = 1;
+    setsockopt(*client, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+    setsockopt(*server, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+}
+
+// Measure the cost of receiving a small message (12-byte header plus
+// 100-byte body, as in TcpTransport) over loopback TCP. If buffered is
+// false, each message takes two recv calls (header, then body), as in
+// TcpTransport's default mode; otherwise messages are parsed out of 64KB
+// recvs, as with the "rxBuffer" option.
+template<bool buffered>
+double tcpRecv()
+{
+    const int count = 100000;
+    const int messageSize = 112;
+    int client, server;
+    tcpConnectLoopback(&client, &server);
+    std::thread sender([client] {
+        char data[messageSize * 500];
+        memset(data, 'x', sizeof(data));
+        for (int i = 0; i < count; i += 500) {
+            if (send(client, data, sizeof(data), 0) < 0) {
+                break;
+            }
+        }
+    });
+
+    char header[12], body[100];
+    char buffer[65536];
+    uint64_t start = Cycles::rdtsc();
+    if (buffered) {
+        size_t bytes = 0;
+        while (bytes < static_cast<size_t>(count) * messageSize) {
+            ssize_t r = recv(server, buffer, sizeof(buffer), 0);
+            if (r <= 0) {
+                break;
+            }
+            bytes += r;
+        }
+    } else {
+        for (int i = 0; i < count; i++) {
+            if ((recv(server, header, sizeof(header), MSG_WAITALL) <= 0) ||
+                    (recv(server, body, sizeof(body), MSG_WAITALL) <= 0)) {
+                break;
+            }
+        }
+    }
+    uint64_t stop = Cycles::rdtsc();
+    sender.join();
+    close(client);
+    close(server);
+    return Cycles::toSeconds(stop - start)/count;
+}
+
+// Measure the cost of sending a small message (12-byte header plus
+// 100-byte body) over loopback TCP when batch messages are passed to each
+// sendmsg call. TcpTransport::sendMessages coalesces up to 16 queued
+// messages this way.
+template<int batch>
+double tcpSend()
+{
+    const int count = 100000;
+    int client, server;
+    tcpConnectLoopback(&client, &server);
+    std::thread receiver([server] {
+        char buffer[65536];
+        while (recv(server, buffer, sizeof(buffer), 0) > 0) {
+            // Discard the data.
+        }
+    });
+
+    char header[12], body[100];
+    memset(header, 'h', sizeof(header));
+    memset(body, 'b', sizeof(body));
+    iovec iov[2 * batch];
+    for (int i = 0; i < batch; i++) {
+        iov[2*i].iov_base = header;
+        iov[2*i].iov_len = sizeof(header);
+        iov[2*i + 1].iov_base = body;
+        iov[2*i + 1].iov_len = sizeof(body);
+    }
+    msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = iov;
+    message.msg_iovlen = 2 * batch;
+    uint64_t start = Cycles::rdtsc();
+    for (int i = 0; i < count; i += batch) {
+        if (sendmsg(client, &message, 0) < 0) {
+            break;
+        }
+    }
+    uint64_t stop = Cycles::rdtsc();
+    shutdown(client, SHUT_WR);
+    receiver.join();
+    close(client);
+    close(server);
+    return Cycles::toSeconds(stop - start)/count;
+}
+
 // Measure the cost of throwing and catching an int. This uses an integer as
 // the value thrown, which is presumably as fast as possible.
 double throwInt()
@@ -1874,6 +2268,10 @@ TestInfo tests[] = {
      "Key lookup in a 1GB HashTable"},
     {"hashTableLookupPf", hashTableLookup<20>,
      "Key lookup in a 1GB HashTable with prefetching"},
+    {"hashTableReadLocked", hashTableReadConcurrent<false>,
+     "HashTable read under bucket lock, 2 threads reading"},
+    {"hashTableReadSeqlock", hashTableReadConcurrent<true>,
+     "HashTable read validating seqlock, 2 threads reading"},
     {"lfence", lfence,
      "Lfence instruction"},
     {"lockInDispThrd", lockInDispThrd,
@@ -1922,6 +2320,14 @@ TestInfo tests[] = {
      "Recompute # bytes outstanding in queue"},
     {"rdtsc", rdtscTest,
      "Read the fine-grain cycle counter"},
+    {"segletAlloc", segletAlloc<1>,
+     "Allocate and free a seglet"},
+    {"segletAllocNuma", segletAlloc<2>,
+     "Allocate and free a seglet, log memory on 2 NUMA nodes"},
+    {"segletReadLocal", segletRead<false>,
+     "Cache-missing read of log memory on the thread's NUMA node"},
+    {"segletReadRemote", segletRead<true>,
+     "Cache-missing read of log memory on another NUMA node"},
     {"segmentEntrySort", segmentEntrySort,
      "Sort a Segment full of avg. 100-byte Objects by age"},
     {"segmentIterator", segmentIterator<50, 150>,
@@ -1932,12 +2338,22 @@ TestInfo tests[] = {
      "cpuid instruction for serialize"},
     {"sfence", sfence,
      "Sfence instruction"},
+    {"shmRoundTrip", shmRoundTrip,
+     "Echo 100-byte packet via SharedMemoryDriver"},
     {"spinLock", spinLock,
      "Acquire/release SpinLock"},
     {"startStopTimer", startStopTimer,
      "Start and stop a Dispatch::Timer"},
     {"spawnThread", spawnThread,
      "Start and stop a thread"},
+    {"tcpRecv", tcpRecv<false>,
+     "Receive 112-byte TCP message: recv header, body"},
+    {"tcpRecvBuffered", tcpRecv<true>,
+     "Receive 112-byte TCP message via 64KB recvs"},
+    {"tcpSend", tcpSend<1>,
+     "Send 112-byte TCP message, 1 per sendmsg"},
+    {"tcpSendBatch16", tcpSend<16>,
+     "Send 112-byte TCP message, 16 per sendmsg"},
     {"throwInt", throwInt,
      "Throw an int"},
     {"throwIntNL", throwIntNL,
@@ -1950,6 +2366,8 @@ TestInfo tests[] = {
      "Throw an Exception using ClientException::throwException"},
     {"timeTrace", timeTrace,
      "Record an event using TimeTrace"},
+    {"udpRoundTrip", udpRoundTrip,
+     "Echo 100-byte packet via UdpDriver"},
     {"unorderedMapCreate", unorderedMapCreate,
      "Create+delete entry in unordered_map"},
     {"unorderedMapLookup", unorderedMapLookup,
@@ -0,0 +1,291 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: CoordinatorClusterClock.proto
+
+#include "CoordinatorClusterClock.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR CoordinatorClusterClock::CoordinatorClusterClock(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.next_safe_time_)*/uint64_t{0u}} {}
+struct CoordinatorClusterClockDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CoordinatorClusterClockDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CoordinatorClusterClockDefaultTypeInternal() {}
+  union {
+    CoordinatorClusterClock _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CoordinatorClusterClockDefaultTypeInternal _CoordinatorClusterClock_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_CoordinatorClusterClock_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_CoordinatorClusterClock_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_CoordinatorClusterClock_2eproto = nullptr;
+
+const uint32_t TableStruct_CoordinatorClusterClock_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::CoordinatorClusterClock, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::CoordinatorClusterClock, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::CoordinatorClusterClock, _impl_.next_safe_time_),
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 7, -1, sizeof(::RAMCloud::ProtoBuf::CoordinatorClusterClock)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_CoordinatorClusterClock_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_CoordinatorClusterClock_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\035CoordinatorClusterClock.proto\022\021RAMClou"
+  "d.ProtoBuf\"1\n\027CoordinatorClusterClock\022\026\n"
+  "\016next_safe_time\030\001 \002(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_CoordinatorClusterClock_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_CoordinatorClusterClock_2eproto = {
+    false, false, 101, descriptor_table_protodef_CoordinatorClusterClock_2eproto,
+    "CoordinatorClusterClock.proto",
+    &descriptor_table_CoordinatorClusterClock_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_CoordinatorClusterClock_2eproto::offsets,
+    file_level_metadata_CoordinatorClusterClock_2eproto, file_level_enum_descriptors_CoordinatorClusterClock_2eproto,
+    file_level_service_descriptors_CoordinatorClusterClock_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_CoordinatorClusterClock_2eproto_getter() {
+  return &descriptor_table_CoordinatorClusterClock_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_CoordinatorClusterClock_2eproto(&descriptor_table_CoordinatorClusterClock_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class CoordinatorClusterClock::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CoordinatorClusterClock>()._impl_._has_bits_);
+  static void set_has_next_safe_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+CoordinatorClusterClock::CoordinatorClusterClock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.CoordinatorClusterClock)
+}
+CoordinatorClusterClock::CoordinatorClusterClock(const CoordinatorClusterClock& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CoordinatorClusterClock* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.next_safe_time_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.next_safe_time_ = from._impl_.next_safe_time_;
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.CoordinatorClusterClock)
+}
+
+inline void CoordinatorClusterClock::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.next_safe_time_){uint64_t{0u}}
+  };
+}
+
+CoordinatorClusterClock::~CoordinatorClusterClock() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.CoordinatorClusterClock)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CoordinatorClusterClock::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CoordinatorClusterClock::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CoordinatorClusterClock::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.CoordinatorClusterClock)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.next_safe_time_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CoordinatorClusterClock::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 next_safe_time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_next_safe_time(&has_bits);
+          _impl_.next_safe_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CoordinatorClusterClock::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.CoordinatorClusterClock)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 next_safe_time = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_next_safe_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.CoordinatorClusterClock)
+  return target;
+}
+
+size_t CoordinatorClusterClock::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.CoordinatorClusterClock)
+  size_t total_size = 0;
+
+  // required uint64 next_safe_time = 1;
+  if (_internal_has_next_safe_time()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_next_safe_time());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CoordinatorClusterClock::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CoordinatorClusterClock::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CoordinatorClusterClock::GetClassData() const { return &_class_data_; }
+
+
+void CoordinatorClusterClock::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CoordinatorClusterClock*>(&to_msg);
+  auto& from = static_cast<const CoordinatorClusterClock&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.CoordinatorClusterClock)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_next_safe_time()) {
+    _this->_internal_set_next_safe_time(from._internal_next_safe_time());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CoordinatorClusterClock::CopyFrom(const CoordinatorClusterClock& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.CoordinatorClusterClock)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CoordinatorClusterClock::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CoordinatorClusterClock::InternalSwap(CoordinatorClusterClock* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.next_safe_time_, other->_impl_.next_safe_time_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CoordinatorClusterClock::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CoordinatorClusterClock_2eproto_getter, &descriptor_table_CoordinatorClusterClock_2eproto_once,
+      file_level_metadata_CoordinatorClusterClock_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::CoordinatorClusterClock*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::CoordinatorClusterClock >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::CoordinatorClusterClock >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
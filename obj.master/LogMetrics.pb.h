@@ -0,0 +1,6034 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: LogMetrics.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_LogMetrics_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_LogMetrics_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "Histogram.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_LogMetrics_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_LogMetrics_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_LogMetrics_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class LogMetrics;
+struct LogMetricsDefaultTypeInternal;
+extern LogMetricsDefaultTypeInternal _LogMetrics_default_instance_;
+class LogMetrics_CleanerMetrics;
+struct LogMetrics_CleanerMetricsDefaultTypeInternal;
+extern LogMetrics_CleanerMetricsDefaultTypeInternal _LogMetrics_CleanerMetrics_default_instance_;
+class LogMetrics_CleanerMetrics_InMemoryMetrics;
+struct LogMetrics_CleanerMetrics_InMemoryMetricsDefaultTypeInternal;
+extern LogMetrics_CleanerMetrics_InMemoryMetricsDefaultTypeInternal _LogMetrics_CleanerMetrics_InMemoryMetrics_default_instance_;
+class LogMetrics_CleanerMetrics_OnDiskMetrics;
+struct LogMetrics_CleanerMetrics_OnDiskMetricsDefaultTypeInternal;
+extern LogMetrics_CleanerMetrics_OnDiskMetricsDefaultTypeInternal _LogMetrics_CleanerMetrics_OnDiskMetrics_default_instance_;
+class LogMetrics_CleanerMetrics_ThreadMetrics;
+struct LogMetrics_CleanerMetrics_ThreadMetricsDefaultTypeInternal;
+extern LogMetrics_CleanerMetrics_ThreadMetricsDefaultTypeInternal _LogMetrics_CleanerMetrics_ThreadMetrics_default_instance_;
+class LogMetrics_SegletMetrics;
+struct LogMetrics_SegletMetricsDefaultTypeInternal;
+extern LogMetrics_SegletMetricsDefaultTypeInternal _LogMetrics_SegletMetrics_default_instance_;
+class LogMetrics_SegmentMetrics;
+struct LogMetrics_SegmentMetricsDefaultTypeInternal;
+extern LogMetrics_SegmentMetricsDefaultTypeInternal _LogMetrics_SegmentMetrics_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::LogMetrics* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics>(Arena*);
+template<> ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics>(Arena*);
+template<> ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics>(Arena*);
+template<> ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics>(Arena*);
+template<> ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics>(Arena*);
+template<> ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics>(Arena*);
+template<> ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class LogMetrics_CleanerMetrics_InMemoryMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics) */ {
+ public:
+  inline LogMetrics_CleanerMetrics_InMemoryMetrics() : LogMetrics_CleanerMetrics_InMemoryMetrics(nullptr) {}
+  ~LogMetrics_CleanerMetrics_InMemoryMetrics() override;
+  explicit PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics_InMemoryMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogMetrics_CleanerMetrics_InMemoryMetrics(const LogMetrics_CleanerMetrics_InMemoryMetrics& from);
+  LogMetrics_CleanerMetrics_InMemoryMetrics(LogMetrics_CleanerMetrics_InMemoryMetrics&& from) noexcept
+    : LogMetrics_CleanerMetrics_InMemoryMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline LogMetrics_CleanerMetrics_InMemoryMetrics& operator=(const LogMetrics_CleanerMetrics_InMemoryMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogMetrics_CleanerMetrics_InMemoryMetrics& operator=(LogMetrics_CleanerMetrics_InMemoryMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogMetrics_CleanerMetrics_InMemoryMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogMetrics_CleanerMetrics_InMemoryMetrics* internal_default_instance() {
+    return reinterpret_cast<const LogMetrics_CleanerMetrics_InMemoryMetrics*>(
+               &_LogMetrics_CleanerMetrics_InMemoryMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(LogMetrics_CleanerMetrics_InMemoryMetrics& a, LogMetrics_CleanerMetrics_InMemoryMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogMetrics_CleanerMetrics_InMemoryMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogMetrics_CleanerMetrics_InMemoryMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogMetrics_CleanerMetrics_InMemoryMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogMetrics_CleanerMetrics_InMemoryMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogMetrics_CleanerMetrics_InMemoryMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogMetrics_CleanerMetrics_InMemoryMetrics& from) {
+    LogMetrics_CleanerMetrics_InMemoryMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogMetrics_CleanerMetrics_InMemoryMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics";
+  }
+  protected:
+  explicit LogMetrics_CleanerMetrics_InMemoryMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTotalEntriesScannedFieldNumber = 8,
+    kTotalLiveEntriesScannedFieldNumber = 9,
+    kTotalScannedEntryLengthsFieldNumber = 10,
+    kTotalLiveScannedEntryLengthsFieldNumber = 11,
+    kTotalRelocationCallbacksFieldNumber = 1,
+    kTotalRelocationAppendsFieldNumber = 2,
+    kTotalBytesFreedFieldNumber = 3,
+    kTotalBytesInCompactedSegmentsFieldNumber = 4,
+    kTotalBytesAppendedToSurvivorsFieldNumber = 5,
+    kTotalSegmentsCompactedFieldNumber = 6,
+    kTotalEmptySegmentsCompactedFieldNumber = 7,
+    kTotalTicksFieldNumber = 12,
+    kGetSegmentToCompactTicksFieldNumber = 13,
+    kWaitForFreeSurvivorTicksFieldNumber = 14,
+    kRelocationCallbackTicksFieldNumber = 15,
+    kRelocationAppendTicksFieldNumber = 16,
+    kCompactionCompleteTicksFieldNumber = 17,
+    kTotalSegmentsDemotedFieldNumber = 18,
+    kTotalBytesDemotedFieldNumber = 19,
+  };
+  // repeated fixed64 total_entries_scanned = 8;
+  int total_entries_scanned_size() const;
+  private:
+  int _internal_total_entries_scanned_size() const;
+  public:
+  void clear_total_entries_scanned();
+  private:
+  uint64_t _internal_total_entries_scanned(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_total_entries_scanned() const;
+  void _internal_add_total_entries_scanned(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_total_entries_scanned();
+  public:
+  uint64_t total_entries_scanned(int index) const;
+  void set_total_entries_scanned(int index, uint64_t value);
+  void add_total_entries_scanned(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      total_entries_scanned() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_total_entries_scanned();
+
+  // repeated fixed64 total_live_entries_scanned = 9;
+  int total_live_entries_scanned_size() const;
+  private:
+  int _internal_total_live_entries_scanned_size() const;
+  public:
+  void clear_total_live_entries_scanned();
+  private:
+  uint64_t _internal_total_live_entries_scanned(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_total_live_entries_scanned() const;
+  void _internal_add_total_live_entries_scanned(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_total_live_entries_scanned();
+  public:
+  uint64_t total_live_entries_scanned(int index) const;
+  void set_total_live_entries_scanned(int index, uint64_t value);
+  void add_total_live_entries_scanned(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      total_live_entries_scanned() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_total_live_entries_scanned();
+
+  // repeated fixed64 total_scanned_entry_lengths = 10;
+  int total_scanned_entry_lengths_size() const;
+  private:
+  int _internal_total_scanned_entry_lengths_size() const;
+  public:
+  void clear_total_scanned_entry_lengths();
+  private:
+  uint64_t _internal_total_scanned_entry_lengths(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_total_scanned_entry_lengths() const;
+  void _internal_add_total_scanned_entry_lengths(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_total_scanned_entry_lengths();
+  public:
+  uint64_t total_scanned_entry_lengths(int index) const;
+  void set_total_scanned_entry_lengths(int index, uint64_t value);
+  void add_total_scanned_entry_lengths(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      total_scanned_entry_lengths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_total_scanned_entry_lengths();
+
+  // repeated fixed64 total_live_scanned_entry_lengths = 11;
+  int total_live_scanned_entry_lengths_size() const;
+  private:
+  int _internal_total_live_scanned_entry_lengths_size() const;
+  public:
+  void clear_total_live_scanned_entry_lengths();
+  private:
+  uint64_t _internal_total_live_scanned_entry_lengths(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_total_live_scanned_entry_lengths() const;
+  void _internal_add_total_live_scanned_entry_lengths(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_total_live_scanned_entry_lengths();
+  public:
+  uint64_t total_live_scanned_entry_lengths(int index) const;
+  void set_total_live_scanned_entry_lengths(int index, uint64_t value);
+  void add_total_live_scanned_entry_lengths(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      total_live_scanned_entry_lengths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_total_live_scanned_entry_lengths();
+
+  // required fixed64 total_relocation_callbacks = 1;
+  bool has_total_relocation_callbacks() const;
+  private:
+  bool _internal_has_total_relocation_callbacks() const;
+  public:
+  void clear_total_relocation_callbacks();
+  uint64_t total_relocation_callbacks() const;
+  void set_total_relocation_callbacks(uint64_t value);
+  private:
+  uint64_t _internal_total_relocation_callbacks() const;
+  void _internal_set_total_relocation_callbacks(uint64_t value);
+  public:
+
+  // required fixed64 total_relocation_appends = 2;
+  bool has_total_relocation_appends() const;
+  private:
+  bool _internal_has_total_relocation_appends() const;
+  public:
+  void clear_total_relocation_appends();
+  uint64_t total_relocation_appends() const;
+  void set_total_relocation_appends(uint64_t value);
+  private:
+  uint64_t _internal_total_relocation_appends() const;
+  void _internal_set_total_relocation_appends(uint64_t value);
+  public:
+
+  // required fixed64 total_bytes_freed = 3;
+  bool has_total_bytes_freed() const;
+  private:
+  bool _internal_has_total_bytes_freed() const;
+  public:
+  void clear_total_bytes_freed();
+  uint64_t total_bytes_freed() const;
+  void set_total_bytes_freed(uint64_t value);
+  private:
+  uint64_t _internal_total_bytes_freed() const;
+  void _internal_set_total_bytes_freed(uint64_t value);
+  public:
+
+  // required fixed64 total_bytes_in_compacted_segments = 4;
+  bool has_total_bytes_in_compacted_segments() const;
+  private:
+  bool _internal_has_total_bytes_in_compacted_segments() const;
+  public:
+  void clear_total_bytes_in_compacted_segments();
+  uint64_t total_bytes_in_compacted_segments() const;
+  void set_total_bytes_in_compacted_segments(uint64_t value);
+  private:
+  uint64_t _internal_total_bytes_in_compacted_segments() const;
+  void _internal_set_total_bytes_in_compacted_segments(uint64_t value);
+  public:
+
+  // required fixed64 total_bytes_appended_to_survivors = 5;
+  bool has_total_bytes_appended_to_survivors() const;
+  private:
+  bool _internal_has_total_bytes_appended_to_survivors() const;
+  public:
+  void clear_total_bytes_appended_to_survivors();
+  uint64_t total_bytes_appended_to_survivors() const;
+  void set_total_bytes_appended_to_survivors(uint64_t value);
+  private:
+  uint64_t _internal_total_bytes_appended_to_survivors() const;
+  void _internal_set_total_bytes_appended_to_survivors(uint64_t value);
+  public:
+
+  // required fixed64 total_segments_compacted = 6;
+  bool has_total_segments_compacted() const;
+  private:
+  bool _internal_has_total_segments_compacted() const;
+  public:
+  void clear_total_segments_compacted();
+  uint64_t total_segments_compacted() const;
+  void set_total_segments_compacted(uint64_t value);
+  private:
+  uint64_t _internal_total_segments_compacted() const;
+  void _internal_set_total_segments_compacted(uint64_t value);
+  public:
+
+  // required fixed64 total_empty_segments_compacted = 7;
+  bool has_total_empty_segments_compacted() const;
+  private:
+  bool _internal_has_total_empty_segments_compacted() const;
+  public:
+  void clear_total_empty_segments_compacted();
+  uint64_t total_empty_segments_compacted() const;
+  void set_total_empty_segments_compacted(uint64_t value);
+  private:
+  uint64_t _internal_total_empty_segments_compacted() const;
+  void _internal_set_total_empty_segments_compacted(uint64_t value);
+  public:
+
+  // required fixed64 total_ticks = 12;
+  bool has_total_ticks() const;
+  private:
+  bool _internal_has_total_ticks() const;
+  public:
+  void clear_total_ticks();
+  uint64_t total_ticks() const;
+  void set_total_ticks(uint64_t value);
+  private:
+  uint64_t _internal_total_ticks() const;
+  void _internal_set_total_ticks(uint64_t value);
+  public:
+
+  // required fixed64 get_segment_to_compact_ticks = 13;
+  bool has_get_segment_to_compact_ticks() const;
+  private:
+  bool _internal_has_get_segment_to_compact_ticks() const;
+  public:
+  void clear_get_segment_to_compact_ticks();
+  uint64_t get_segment_to_compact_ticks() const;
+  void set_get_segment_to_compact_ticks(uint64_t value);
+  private:
+  uint64_t _internal_get_segment_to_compact_ticks() const;
+  void _internal_set_get_segment_to_compact_ticks(uint64_t value);
+  public:
+
+  // required fixed64 wait_for_free_survivor_ticks = 14;
+  bool has_wait_for_free_survivor_ticks() const;
+  private:
+  bool _internal_has_wait_for_free_survivor_ticks() const;
+  public:
+  void clear_wait_for_free_survivor_ticks();
+  uint64_t wait_for_free_survivor_ticks() const;
+  void set_wait_for_free_survivor_ticks(uint64_t value);
+  private:
+  uint64_t _internal_wait_for_free_survivor_ticks() const;
+  void _internal_set_wait_for_free_survivor_ticks(uint64_t value);
+  public:
+
+  // required fixed64 relocation_callback_ticks = 15;
+  bool has_relocation_callback_ticks() const;
+  private:
+  bool _internal_has_relocation_callback_ticks() const;
+  public:
+  void clear_relocation_callback_ticks();
+  uint64_t relocation_callback_ticks() const;
+  void set_relocation_callback_ticks(uint64_t value);
+  private:
+  uint64_t _internal_relocation_callback_ticks() const;
+  void _internal_set_relocation_callback_ticks(uint64_t value);
+  public:
+
+  // required fixed64 relocation_append_ticks = 16;
+  bool has_relocation_append_ticks() const;
+  private:
+  bool _internal_has_relocation_append_ticks() const;
+  public:
+  void clear_relocation_append_ticks();
+  uint64_t relocation_append_ticks() const;
+  void set_relocation_append_ticks(uint64_t value);
+  private:
+  uint64_t _internal_relocation_append_ticks() const;
+  void _internal_set_relocation_append_ticks(uint64_t value);
+  public:
+
+  // required fixed64 compaction_complete_ticks = 17;
+  bool has_compaction_complete_ticks() const;
+  private:
+  bool _internal_has_compaction_complete_ticks() const;
+  public:
+  void clear_compaction_complete_ticks();
+  uint64_t compaction_complete_ticks() const;
+  void set_compaction_complete_ticks(uint64_t value);
+  private:
+  uint64_t _internal_compaction_complete_ticks() const;
+  void _internal_set_compaction_complete_ticks(uint64_t value);
+  public:
+
+  // required fixed64 total_segments_demoted = 18;
+  bool has_total_segments_demoted() const;
+  private:
+  bool _internal_has_total_segments_demoted() const;
+  public:
+  void clear_total_segments_demoted();
+  uint64_t total_segments_demoted() const;
+  void set_total_segments_demoted(uint64_t value);
+  private:
+  uint64_t _internal_total_segments_demoted() const;
+  void _internal_set_total_segments_demoted(uint64_t value);
+  public:
+
+  // required fixed64 total_bytes_demoted = 19;
+  bool has_total_bytes_demoted() const;
+  private:
+  bool _internal_has_total_bytes_demoted() const;
+  public:
+  void clear_total_bytes_demoted();
+  uint64_t total_bytes_demoted() const;
+  void set_total_bytes_demoted(uint64_t value);
+  private:
+  uint64_t _internal_total_bytes_demoted() const;
+  void _internal_set_total_bytes_demoted(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > total_entries_scanned_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > total_live_entries_scanned_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > total_scanned_entry_lengths_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > total_live_scanned_entry_lengths_;
+    uint64_t total_relocation_callbacks_;
+    uint64_t total_relocation_appends_;
+    uint64_t total_bytes_freed_;
+    uint64_t total_bytes_in_compacted_segments_;
+    uint64_t total_bytes_appended_to_survivors_;
+    uint64_t total_segments_compacted_;
+    uint64_t total_empty_segments_compacted_;
+    uint64_t total_ticks_;
+    uint64_t get_segment_to_compact_ticks_;
+    uint64_t wait_for_free_survivor_ticks_;
+    uint64_t relocation_callback_ticks_;
+    uint64_t relocation_append_ticks_;
+    uint64_t compaction_complete_ticks_;
+    uint64_t total_segments_demoted_;
+    uint64_t total_bytes_demoted_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_LogMetrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogMetrics_CleanerMetrics_OnDiskMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics) */ {
+ public:
+  inline LogMetrics_CleanerMetrics_OnDiskMetrics() : LogMetrics_CleanerMetrics_OnDiskMetrics(nullptr) {}
+  ~LogMetrics_CleanerMetrics_OnDiskMetrics() override;
+  explicit PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics_OnDiskMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogMetrics_CleanerMetrics_OnDiskMetrics(const LogMetrics_CleanerMetrics_OnDiskMetrics& from);
+  LogMetrics_CleanerMetrics_OnDiskMetrics(LogMetrics_CleanerMetrics_OnDiskMetrics&& from) noexcept
+    : LogMetrics_CleanerMetrics_OnDiskMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline LogMetrics_CleanerMetrics_OnDiskMetrics& operator=(const LogMetrics_CleanerMetrics_OnDiskMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogMetrics_CleanerMetrics_OnDiskMetrics& operator=(LogMetrics_CleanerMetrics_OnDiskMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogMetrics_CleanerMetrics_OnDiskMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogMetrics_CleanerMetrics_OnDiskMetrics* internal_default_instance() {
+    return reinterpret_cast<const LogMetrics_CleanerMetrics_OnDiskMetrics*>(
+               &_LogMetrics_CleanerMetrics_OnDiskMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(LogMetrics_CleanerMetrics_OnDiskMetrics& a, LogMetrics_CleanerMetrics_OnDiskMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogMetrics_CleanerMetrics_OnDiskMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogMetrics_CleanerMetrics_OnDiskMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogMetrics_CleanerMetrics_OnDiskMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogMetrics_CleanerMetrics_OnDiskMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogMetrics_CleanerMetrics_OnDiskMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogMetrics_CleanerMetrics_OnDiskMetrics& from) {
+    LogMetrics_CleanerMetrics_OnDiskMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogMetrics_CleanerMetrics_OnDiskMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics";
+  }
+  protected:
+  explicit LogMetrics_CleanerMetrics_OnDiskMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTotalEntriesScannedFieldNumber = 14,
+    kTotalLiveEntriesScannedFieldNumber = 15,
+    kTotalScannedEntryLengthsFieldNumber = 16,
+    kTotalLiveScannedEntryLengthsFieldNumber = 17,
+    kCleanedSegmentMemoryHistogramFieldNumber = 30,
+    kCleanedSegmentDiskHistogramFieldNumber = 31,
+    kAllSegmentsDiskHistogramFieldNumber = 32,
+    kTotalBytesAppendedToSurvivorsFieldNumber = 1,
+    kTotalMemoryBytesFreedFieldNumber = 2,
+    kTotalDiskBytesFreedFieldNumber = 3,
+    kTotalMemoryBytesInCleanedSegmentsFieldNumber = 4,
+    kTotalDiskBytesInCleanedSegmentsFieldNumber = 5,
+    kTotalRelocationCallbacksFieldNumber = 6,
+    kTotalRelocationAppendsFieldNumber = 7,
+    kTotalSegmentsCleanedFieldNumber = 8,
+    kTotalEmptySegmentsCleanedFieldNumber = 9,
+    kTotalSurvivorsCreatedFieldNumber = 10,
+    kTotalRunsFieldNumber = 11,
+    kTotalLowDiskSpaceRunsFieldNumber = 12,
+    kMemoryUtilizationAtStartSumFieldNumber = 13,
+    kTotalTicksFieldNumber = 18,
+    kGetSegmentsToCleanTicksFieldNumber = 19,
+    kCostBenefitSortTicksFieldNumber = 20,
+    kGetSortedEntriesTicksFieldNumber = 21,
+    kTimestampSortTicksFieldNumber = 22,
+    kRelocateLiveEntriesTicksFieldNumber = 23,
+    kWaitForFreeSurvivorsTicksFieldNumber = 24,
+    kCleaningCompleteTicksFieldNumber = 25,
+    kRelocationCallbackTicksFieldNumber = 26,
+    kRelocationAppendTicksFieldNumber = 27,
+    kCloseSurvivorTicksFieldNumber = 28,
+    kSurvivorSyncTicksFieldNumber = 29,
+  };
+  // repeated fixed64 total_entries_scanned = 14;
+  int total_entries_scanned_size() const;
+  private:
+  int _internal_total_entries_scanned_size() const;
+  public:
+  void clear_total_entries_scanned();
+  private:
+  uint64_t _internal_total_entries_scanned(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_total_entries_scanned() const;
+  void _internal_add_total_entries_scanned(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_total_entries_scanned();
+  public:
+  uint64_t total_entries_scanned(int index) const;
+  void set_total_entries_scanned(int index, uint64_t value);
+  void add_total_entries_scanned(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      total_entries_scanned() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_total_entries_scanned();
+
+  // repeated fixed64 total_live_entries_scanned = 15;
+  int total_live_entries_scanned_size() const;
+  private:
+  int _internal_total_live_entries_scanned_size() const;
+  public:
+  void clear_total_live_entries_scanned();
+  private:
+  uint64_t _internal_total_live_entries_scanned(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_total_live_entries_scanned() const;
+  void _internal_add_total_live_entries_scanned(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_total_live_entries_scanned();
+  public:
+  uint64_t total_live_entries_scanned(int index) const;
+  void set_total_live_entries_scanned(int index, uint64_t value);
+  void add_total_live_entries_scanned(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      total_live_entries_scanned() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_total_live_entries_scanned();
+
+  // repeated fixed64 total_scanned_entry_lengths = 16;
+  int total_scanned_entry_lengths_size() const;
+  private:
+  int _internal_total_scanned_entry_lengths_size() const;
+  public:
+  void clear_total_scanned_entry_lengths();
+  private:
+  uint64_t _internal_total_scanned_entry_lengths(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_total_scanned_entry_lengths() const;
+  void _internal_add_total_scanned_entry_lengths(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_total_scanned_entry_lengths();
+  public:
+  uint64_t total_scanned_entry_lengths(int index) const;
+  void set_total_scanned_entry_lengths(int index, uint64_t value);
+  void add_total_scanned_entry_lengths(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      total_scanned_entry_lengths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_total_scanned_entry_lengths();
+
+  // repeated fixed64 total_live_scanned_entry_lengths = 17;
+  int total_live_scanned_entry_lengths_size() const;
+  private:
+  int _internal_total_live_scanned_entry_lengths_size() const;
+  public:
+  void clear_total_live_scanned_entry_lengths();
+  private:
+  uint64_t _internal_total_live_scanned_entry_lengths(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_total_live_scanned_entry_lengths() const;
+  void _internal_add_total_live_scanned_entry_lengths(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_total_live_scanned_entry_lengths();
+  public:
+  uint64_t total_live_scanned_entry_lengths(int index) const;
+  void set_total_live_scanned_entry_lengths(int index, uint64_t value);
+  void add_total_live_scanned_entry_lengths(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      total_live_scanned_entry_lengths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_total_live_scanned_entry_lengths();
+
+  // required .RAMCloud.ProtoBuf.Histogram cleaned_segment_memory_histogram = 30;
+  bool has_cleaned_segment_memory_histogram() const;
+  private:
+  bool _internal_has_cleaned_segment_memory_histogram() const;
+  public:
+  void clear_cleaned_segment_memory_histogram();
+  const ::RAMCloud::ProtoBuf::Histogram& cleaned_segment_memory_histogram() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::Histogram* release_cleaned_segment_memory_histogram();
+  ::RAMCloud::ProtoBuf::Histogram* mutable_cleaned_segment_memory_histogram();
+  void set_allocated_cleaned_segment_memory_histogram(::RAMCloud::ProtoBuf::Histogram* cleaned_segment_memory_histogram);
+  private:
+  const ::RAMCloud::ProtoBuf::Histogram& _internal_cleaned_segment_memory_histogram() const;
+  ::RAMCloud::ProtoBuf::Histogram* _internal_mutable_cleaned_segment_memory_histogram();
+  public:
+  void unsafe_arena_set_allocated_cleaned_segment_memory_histogram(
+      ::RAMCloud::ProtoBuf::Histogram* cleaned_segment_memory_histogram);
+  ::RAMCloud::ProtoBuf::Histogram* unsafe_arena_release_cleaned_segment_memory_histogram();
+
+  // required .RAMCloud.ProtoBuf.Histogram cleaned_segment_disk_histogram = 31;
+  bool has_cleaned_segment_disk_histogram() const;
+  private:
+  bool _internal_has_cleaned_segment_disk_histogram() const;
+  public:
+  void clear_cleaned_segment_disk_histogram();
+  const ::RAMCloud::ProtoBuf::Histogram& cleaned_segment_disk_histogram() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::Histogram* release_cleaned_segment_disk_histogram();
+  ::RAMCloud::ProtoBuf::Histogram* mutable_cleaned_segment_disk_histogram();
+  void set_allocated_cleaned_segment_disk_histogram(::RAMCloud::ProtoBuf::Histogram* cleaned_segment_disk_histogram);
+  private:
+  const ::RAMCloud::ProtoBuf::Histogram& _internal_cleaned_segment_disk_histogram() const;
+  ::RAMCloud::ProtoBuf::Histogram* _internal_mutable_cleaned_segment_disk_histogram();
+  public:
+  void unsafe_arena_set_allocated_cleaned_segment_disk_histogram(
+      ::RAMCloud::ProtoBuf::Histogram* cleaned_segment_disk_histogram);
+  ::RAMCloud::ProtoBuf::Histogram* unsafe_arena_release_cleaned_segment_disk_histogram();
+
+  // required .RAMCloud.ProtoBuf.Histogram all_segments_disk_histogram = 32;
+  bool has_all_segments_disk_histogram() const;
+  private:
+  bool _internal_has_all_segments_disk_histogram() const;
+  public:
+  void clear_all_segments_disk_histogram();
+  const ::RAMCloud::ProtoBuf::Histogram& all_segments_disk_histogram() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::Histogram* release_all_segments_disk_histogram();
+  ::RAMCloud::ProtoBuf::Histogram* mutable_all_segments_disk_histogram();
+  void set_allocated_all_segments_disk_histogram(::RAMCloud::ProtoBuf::Histogram* all_segments_disk_histogram);
+  private:
+  const ::RAMCloud::ProtoBuf::Histogram& _internal_all_segments_disk_histogram() const;
+  ::RAMCloud::ProtoBuf::Histogram* _internal_mutable_all_segments_disk_histogram();
+  public:
+  void unsafe_arena_set_allocated_all_segments_disk_histogram(
+      ::RAMCloud::ProtoBuf::Histogram* all_segments_disk_histogram);
+  ::RAMCloud::ProtoBuf::Histogram* unsafe_arena_release_all_segments_disk_histogram();
+
+  // required fixed64 total_bytes_appended_to_survivors = 1;
+  bool has_total_bytes_appended_to_survivors() const;
+  private:
+  bool _internal_has_total_bytes_appended_to_survivors() const;
+  public:
+  void clear_total_bytes_appended_to_survivors();
+  uint64_t total_bytes_appended_to_survivors() const;
+  void set_total_bytes_appended_to_survivors(uint64_t value);
+  private:
+  uint64_t _internal_total_bytes_appended_to_survivors() const;
+  void _internal_set_total_bytes_appended_to_survivors(uint64_t value);
+  public:
+
+  // required fixed64 total_memory_bytes_freed = 2;
+  bool has_total_memory_bytes_freed() const;
+  private:
+  bool _internal_has_total_memory_bytes_freed() const;
+  public:
+  void clear_total_memory_bytes_freed();
+  uint64_t total_memory_bytes_freed() const;
+  void set_total_memory_bytes_freed(uint64_t value);
+  private:
+  uint64_t _internal_total_memory_bytes_freed() const;
+  void _internal_set_total_memory_bytes_freed(uint64_t value);
+  public:
+
+  // required fixed64 total_disk_bytes_freed = 3;
+  bool has_total_disk_bytes_freed() const;
+  private:
+  bool _internal_has_total_disk_bytes_freed() const;
+  public:
+  void clear_total_disk_bytes_freed();
+  uint64_t total_disk_bytes_freed() const;
+  void set_total_disk_bytes_freed(uint64_t value);
+  private:
+  uint64_t _internal_total_disk_bytes_freed() const;
+  void _internal_set_total_disk_bytes_freed(uint64_t value);
+  public:
+
+  // required fixed64 total_memory_bytes_in_cleaned_segments = 4;
+  bool has_total_memory_bytes_in_cleaned_segments() const;
+  private:
+  bool _internal_has_total_memory_bytes_in_cleaned_segments() const;
+  public:
+  void clear_total_memory_bytes_in_cleaned_segments();
+  uint64_t total_memory_bytes_in_cleaned_segments() const;
+  void set_total_memory_bytes_in_cleaned_segments(uint64_t value);
+  private:
+  uint64_t _internal_total_memory_bytes_in_cleaned_segments() const;
+  void _internal_set_total_memory_bytes_in_cleaned_segments(uint64_t value);
+  public:
+
+  // required fixed64 total_disk_bytes_in_cleaned_segments = 5;
+  bool has_total_disk_bytes_in_cleaned_segments() const;
+  private:
+  bool _internal_has_total_disk_bytes_in_cleaned_segments() const;
+  public:
+  void clear_total_disk_bytes_in_cleaned_segments();
+  uint64_t total_disk_bytes_in_cleaned_segments() const;
+  void set_total_disk_bytes_in_cleaned_segments(uint64_t value);
+  private:
+  uint64_t _internal_total_disk_bytes_in_cleaned_segments() const;
+  void _internal_set_total_disk_bytes_in_cleaned_segments(uint64_t value);
+  public:
+
+  // required fixed64 total_relocation_callbacks = 6;
+  bool has_total_relocation_callbacks() const;
+  private:
+  bool _internal_has_total_relocation_callbacks() const;
+  public:
+  void clear_total_relocation_callbacks();
+  uint64_t total_relocation_callbacks() const;
+  void set_total_relocation_callbacks(uint64_t value);
+  private:
+  uint64_t _internal_total_relocation_callbacks() const;
+  void _internal_set_total_relocation_callbacks(uint64_t value);
+  public:
+
+  // required fixed64 total_relocation_appends = 7;
+  bool has_total_relocation_appends() const;
+  private:
+  bool _internal_has_total_relocation_appends() const;
+  public:
+  void clear_total_relocation_appends();
+  uint64_t total_relocation_appends() const;
+  void set_total_relocation_appends(uint64_t value);
+  private:
+  uint64_t _internal_total_relocation_appends() const;
+  void _internal_set_total_relocation_appends(uint64_t value);
+  public:
+
+  // required fixed64 total_segments_cleaned = 8;
+  bool has_total_segments_cleaned() const;
+  private:
+  bool _internal_has_total_segments_cleaned() const;
+  public:
+  void clear_total_segments_cleaned();
+  uint64_t total_segments_cleaned() const;
+  void set_total_segments_cleaned(uint64_t value);
+  private:
+  uint64_t _internal_total_segments_cleaned() const;
+  void _internal_set_total_segments_cleaned(uint64_t value);
+  public:
+
+  // required fixed64 total_empty_segments_cleaned = 9;
+  bool has_total_empty_segments_cleaned() const;
+  private:
+  bool _internal_has_total_empty_segments_cleaned() const;
+  public:
+  void clear_total_empty_segments_cleaned();
+  uint64_t total_empty_segments_cleaned() const;
+  void set_total_empty_segments_cleaned(uint64_t value);
+  private:
+  uint64_t _internal_total_empty_segments_cleaned() const;
+  void _internal_set_total_empty_segments_cleaned(uint64_t value);
+  public:
+
+  // required fixed64 total_survivors_created = 10;
+  bool has_total_survivors_created() const;
+  private:
+  bool _internal_has_total_survivors_created() const;
+  public:
+  void clear_total_survivors_created();
+  uint64_t total_survivors_created() const;
+  void set_total_survivors_created(uint64_t value);
+  private:
+  uint64_t _internal_total_survivors_created() const;
+  void _internal_set_total_survivors_created(uint64_t value);
+  public:
+
+  // required fixed64 total_runs = 11;
+  bool has_total_runs() const;
+  private:
+  bool _internal_has_total_runs() const;
+  public:
+  void clear_total_runs();
+  uint64_t total_runs() const;
+  void set_total_runs(uint64_t value);
+  private:
+  uint64_t _internal_total_runs() const;
+  void _internal_set_total_runs(uint64_t value);
+  public:
+
+  // required fixed64 total_low_disk_space_runs = 12;
+  bool has_total_low_disk_space_runs() const;
+  private:
+  bool _internal_has_total_low_disk_space_runs() const;
+  public:
+  void clear_total_low_disk_space_runs();
+  uint64_t total_low_disk_space_runs() const;
+  void set_total_low_disk_space_runs(uint64_t value);
+  private:
+  uint64_t _internal_total_low_disk_space_runs() const;
+  void _internal_set_total_low_disk_space_runs(uint64_t value);
+  public:
+
+  // required fixed64 memory_utilization_at_start_sum = 13;
+  bool has_memory_utilization_at_start_sum() const;
+  private:
+  bool _internal_has_memory_utilization_at_start_sum() const;
+  public:
+  void clear_memory_utilization_at_start_sum();
+  uint64_t memory_utilization_at_start_sum() const;
+  void set_memory_utilization_at_start_sum(uint64_t value);
+  private:
+  uint64_t _internal_memory_utilization_at_start_sum() const;
+  void _internal_set_memory_utilization_at_start_sum(uint64_t value);
+  public:
+
+  // required fixed64 total_ticks = 18;
+  bool has_total_ticks() const;
+  private:
+  bool _internal_has_total_ticks() const;
+  public:
+  void clear_total_ticks();
+  uint64_t total_ticks() const;
+  void set_total_ticks(uint64_t value);
+  private:
+  uint64_t _internal_total_ticks() const;
+  void _internal_set_total_ticks(uint64_t value);
+  public:
+
+  // required fixed64 get_segments_to_clean_ticks = 19;
+  bool has_get_segments_to_clean_ticks() const;
+  private:
+  bool _internal_has_get_segments_to_clean_ticks() const;
+  public:
+  void clear_get_segments_to_clean_ticks();
+  uint64_t get_segments_to_clean_ticks() const;
+  void set_get_segments_to_clean_ticks(uint64_t value);
+  private:
+  uint64_t _internal_get_segments_to_clean_ticks() const;
+  void _internal_set_get_segments_to_clean_ticks(uint64_t value);
+  public:
+
+  // required fixed64 cost_benefit_sort_ticks = 20;
+  bool has_cost_benefit_sort_ticks() const;
+  private:
+  bool _internal_has_cost_benefit_sort_ticks() const;
+  public:
+  void clear_cost_benefit_sort_ticks();
+  uint64_t cost_benefit_sort_ticks() const;
+  void set_cost_benefit_sort_ticks(uint64_t value);
+  private:
+  uint64_t _internal_cost_benefit_sort_ticks() const;
+  void _internal_set_cost_benefit_sort_ticks(uint64_t value);
+  public:
+
+  // required fixed64 get_sorted_entries_ticks = 21;
+  bool has_get_sorted_entries_ticks() const;
+  private:
+  bool _internal_has_get_sorted_entries_ticks() const;
+  public:
+  void clear_get_sorted_entries_ticks();
+  uint64_t get_sorted_entries_ticks() const;
+  void set_get_sorted_entries_ticks(uint64_t value);
+  private:
+  uint64_t _internal_get_sorted_entries_ticks() const;
+  void _internal_set_get_sorted_entries_ticks(uint64_t value);
+  public:
+
+  // required fixed64 timestamp_sort_ticks = 22;
+  bool has_timestamp_sort_ticks() const;
+  private:
+  bool _internal_has_timestamp_sort_ticks() const;
+  public:
+  void clear_timestamp_sort_ticks();
+  uint64_t timestamp_sort_ticks() const;
+  void set_timestamp_sort_ticks(uint64_t value);
+  private:
+  uint64_t _internal_timestamp_sort_ticks() const;
+  void _internal_set_timestamp_sort_ticks(uint64_t value);
+  public:
+
+  // required fixed64 relocate_live_entries_ticks = 23;
+  bool has_relocate_live_entries_ticks() const;
+  private:
+  bool _internal_has_relocate_live_entries_ticks() const;
+  public:
+  void clear_relocate_live_entries_ticks();
+  uint64_t relocate_live_entries_ticks() const;
+  void set_relocate_live_entries_ticks(uint64_t value);
+  private:
+  uint64_t _internal_relocate_live_entries_ticks() const;
+  void _internal_set_relocate_live_entries_ticks(uint64_t value);
+  public:
+
+  // required fixed64 wait_for_free_survivors_ticks = 24;
+  bool has_wait_for_free_survivors_ticks() const;
+  private:
+  bool _internal_has_wait_for_free_survivors_ticks() const;
+  public:
+  void clear_wait_for_free_survivors_ticks();
+  uint64_t wait_for_free_survivors_ticks() const;
+  void set_wait_for_free_survivors_ticks(uint64_t value);
+  private:
+  uint64_t _internal_wait_for_free_survivors_ticks() const;
+  void _internal_set_wait_for_free_survivors_ticks(uint64_t value);
+  public:
+
+  // required fixed64 cleaning_complete_ticks = 25;
+  bool has_cleaning_complete_ticks() const;
+  private:
+  bool _internal_has_cleaning_complete_ticks() const;
+  public:
+  void clear_cleaning_complete_ticks();
+  uint64_t cleaning_complete_ticks() const;
+  void set_cleaning_complete_ticks(uint64_t value);
+  private:
+  uint64_t _internal_cleaning_complete_ticks() const;
+  void _internal_set_cleaning_complete_ticks(uint64_t value);
+  public:
+
+  // required fixed64 relocation_callback_ticks = 26;
+  bool has_relocation_callback_ticks() const;
+  private:
+  bool _internal_has_relocation_callback_ticks() const;
+  public:
+  void clear_relocation_callback_ticks();
+  uint64_t relocation_callback_ticks() const;
+  void set_relocation_callback_ticks(uint64_t value);
+  private:
+  uint64_t _internal_relocation_callback_ticks() const;
+  void _internal_set_relocation_callback_ticks(uint64_t value);
+  public:
+
+  // required fixed64 relocation_append_ticks = 27;
+  bool has_relocation_append_ticks() const;
+  private:
+  bool _internal_has_relocation_append_ticks() const;
+  public:
+  void clear_relocation_append_ticks();
+  uint64_t relocation_append_ticks() const;
+  void set_relocation_append_ticks(uint64_t value);
+  private:
+  uint64_t _internal_relocation_append_ticks() const;
+  void _internal_set_relocation_append_ticks(uint64_t value);
+  public:
+
+  // required fixed64 close_survivor_ticks = 28;
+  bool has_close_survivor_ticks() const;
+  private:
+  bool _internal_has_close_survivor_ticks() const;
+  public:
+  void clear_close_survivor_ticks();
+  uint64_t close_survivor_ticks() const;
+  void set_close_survivor_ticks(uint64_t value);
+  private:
+  uint64_t _internal_close_survivor_ticks() const;
+  void _internal_set_close_survivor_ticks(uint64_t value);
+  public:
+
+  // required fixed64 survivor_sync_ticks = 29;
+  bool has_survivor_sync_ticks() const;
+  private:
+  bool _internal_has_survivor_sync_ticks() const;
+  public:
+  void clear_survivor_sync_ticks();
+  uint64_t survivor_sync_ticks() const;
+  void set_survivor_sync_ticks(uint64_t value);
+  private:
+  uint64_t _internal_survivor_sync_ticks() const;
+  void _internal_set_survivor_sync_ticks(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > total_entries_scanned_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > total_live_entries_scanned_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > total_scanned_entry_lengths_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > total_live_scanned_entry_lengths_;
+    ::RAMCloud::ProtoBuf::Histogram* cleaned_segment_memory_histogram_;
+    ::RAMCloud::ProtoBuf::Histogram* cleaned_segment_disk_histogram_;
+    ::RAMCloud::ProtoBuf::Histogram* all_segments_disk_histogram_;
+    uint64_t total_bytes_appended_to_survivors_;
+    uint64_t total_memory_bytes_freed_;
+    uint64_t total_disk_bytes_freed_;
+    uint64_t total_memory_bytes_in_cleaned_segments_;
+    uint64_t total_disk_bytes_in_cleaned_segments_;
+    uint64_t total_relocation_callbacks_;
+    uint64_t total_relocation_appends_;
+    uint64_t total_segments_cleaned_;
+    uint64_t total_empty_segments_cleaned_;
+    uint64_t total_survivors_created_;
+    uint64_t total_runs_;
+    uint64_t total_low_disk_space_runs_;
+    uint64_t memory_utilization_at_start_sum_;
+    uint64_t total_ticks_;
+    uint64_t get_segments_to_clean_ticks_;
+    uint64_t cost_benefit_sort_ticks_;
+    uint64_t get_sorted_entries_ticks_;
+    uint64_t timestamp_sort_ticks_;
+    uint64_t relocate_live_entries_ticks_;
+    uint64_t wait_for_free_survivors_ticks_;
+    uint64_t cleaning_complete_ticks_;
+    uint64_t relocation_callback_ticks_;
+    uint64_t relocation_append_ticks_;
+    uint64_t close_survivor_ticks_;
+    uint64_t survivor_sync_ticks_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_LogMetrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogMetrics_CleanerMetrics_ThreadMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics) */ {
+ public:
+  inline LogMetrics_CleanerMetrics_ThreadMetrics() : LogMetrics_CleanerMetrics_ThreadMetrics(nullptr) {}
+  ~LogMetrics_CleanerMetrics_ThreadMetrics() override;
+  explicit PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics_ThreadMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogMetrics_CleanerMetrics_ThreadMetrics(const LogMetrics_CleanerMetrics_ThreadMetrics& from);
+  LogMetrics_CleanerMetrics_ThreadMetrics(LogMetrics_CleanerMetrics_ThreadMetrics&& from) noexcept
+    : LogMetrics_CleanerMetrics_ThreadMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline LogMetrics_CleanerMetrics_ThreadMetrics& operator=(const LogMetrics_CleanerMetrics_ThreadMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogMetrics_CleanerMetrics_ThreadMetrics& operator=(LogMetrics_CleanerMetrics_ThreadMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogMetrics_CleanerMetrics_ThreadMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogMetrics_CleanerMetrics_ThreadMetrics* internal_default_instance() {
+    return reinterpret_cast<const LogMetrics_CleanerMetrics_ThreadMetrics*>(
+               &_LogMetrics_CleanerMetrics_ThreadMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(LogMetrics_CleanerMetrics_ThreadMetrics& a, LogMetrics_CleanerMetrics_ThreadMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogMetrics_CleanerMetrics_ThreadMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogMetrics_CleanerMetrics_ThreadMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogMetrics_CleanerMetrics_ThreadMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogMetrics_CleanerMetrics_ThreadMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogMetrics_CleanerMetrics_ThreadMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogMetrics_CleanerMetrics_ThreadMetrics& from) {
+    LogMetrics_CleanerMetrics_ThreadMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogMetrics_CleanerMetrics_ThreadMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics";
+  }
+  protected:
+  explicit LogMetrics_CleanerMetrics_ThreadMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kActiveTicksFieldNumber = 1,
+  };
+  // repeated fixed64 active_ticks = 1;
+  int active_ticks_size() const;
+  private:
+  int _internal_active_ticks_size() const;
+  public:
+  void clear_active_ticks();
+  private:
+  uint64_t _internal_active_ticks(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_active_ticks() const;
+  void _internal_add_active_ticks(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_active_ticks();
+  public:
+  uint64_t active_ticks(int index) const;
+  void set_active_ticks(int index, uint64_t value);
+  void add_active_ticks(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      active_ticks() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_active_ticks();
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > active_ticks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_LogMetrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogMetrics_CleanerMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics) */ {
+ public:
+  inline LogMetrics_CleanerMetrics() : LogMetrics_CleanerMetrics(nullptr) {}
+  ~LogMetrics_CleanerMetrics() override;
+  explicit PROTOBUF_CONSTEXPR LogMetrics_CleanerMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogMetrics_CleanerMetrics(const LogMetrics_CleanerMetrics& from);
+  LogMetrics_CleanerMetrics(LogMetrics_CleanerMetrics&& from) noexcept
+    : LogMetrics_CleanerMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline LogMetrics_CleanerMetrics& operator=(const LogMetrics_CleanerMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogMetrics_CleanerMetrics& operator=(LogMetrics_CleanerMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogMetrics_CleanerMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogMetrics_CleanerMetrics* internal_default_instance() {
+    return reinterpret_cast<const LogMetrics_CleanerMetrics*>(
+               &_LogMetrics_CleanerMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(LogMetrics_CleanerMetrics& a, LogMetrics_CleanerMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogMetrics_CleanerMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogMetrics_CleanerMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogMetrics_CleanerMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogMetrics_CleanerMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogMetrics_CleanerMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogMetrics_CleanerMetrics& from) {
+    LogMetrics_CleanerMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogMetrics_CleanerMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics";
+  }
+  protected:
+  explicit LogMetrics_CleanerMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef LogMetrics_CleanerMetrics_InMemoryMetrics InMemoryMetrics;
+  typedef LogMetrics_CleanerMetrics_OnDiskMetrics OnDiskMetrics;
+  typedef LogMetrics_CleanerMetrics_ThreadMetrics ThreadMetrics;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInMemoryMetricsFieldNumber = 9,
+    kOnDiskMetricsFieldNumber = 10,
+    kThreadMetricsFieldNumber = 11,
+    kPollUsecFieldNumber = 1,
+    kMaxCleanableMemoryUtilizationFieldNumber = 2,
+    kLiveSegmentsPerDiskPassFieldNumber = 3,
+    kSurvivorSegmentsToReserveFieldNumber = 4,
+    kMinMemoryUtilizationFieldNumber = 5,
+    kMinDiskUtilizationFieldNumber = 6,
+    kDoWorkTicksFieldNumber = 7,
+    kDoWorkSleepTicksFieldNumber = 8,
+  };
+  // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics in_memory_metrics = 9;
+  bool has_in_memory_metrics() const;
+  private:
+  bool _internal_has_in_memory_metrics() const;
+  public:
+  void clear_in_memory_metrics();
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics& in_memory_metrics() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* release_in_memory_metrics();
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* mutable_in_memory_metrics();
+  void set_allocated_in_memory_metrics(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* in_memory_metrics);
+  private:
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics& _internal_in_memory_metrics() const;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* _internal_mutable_in_memory_metrics();
+  public:
+  void unsafe_arena_set_allocated_in_memory_metrics(
+      ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* in_memory_metrics);
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* unsafe_arena_release_in_memory_metrics();
+
+  // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics on_disk_metrics = 10;
+  bool has_on_disk_metrics() const;
+  private:
+  bool _internal_has_on_disk_metrics() const;
+  public:
+  void clear_on_disk_metrics();
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics& on_disk_metrics() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* release_on_disk_metrics();
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* mutable_on_disk_metrics();
+  void set_allocated_on_disk_metrics(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* on_disk_metrics);
+  private:
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics& _internal_on_disk_metrics() const;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* _internal_mutable_on_disk_metrics();
+  public:
+  void unsafe_arena_set_allocated_on_disk_metrics(
+      ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* on_disk_metrics);
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* unsafe_arena_release_on_disk_metrics();
+
+  // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics thread_metrics = 11;
+  bool has_thread_metrics() const;
+  private:
+  bool _internal_has_thread_metrics() const;
+  public:
+  void clear_thread_metrics();
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics& thread_metrics() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* release_thread_metrics();
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* mutable_thread_metrics();
+  void set_allocated_thread_metrics(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* thread_metrics);
+  private:
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics& _internal_thread_metrics() const;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* _internal_mutable_thread_metrics();
+  public:
+  void unsafe_arena_set_allocated_thread_metrics(
+      ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* thread_metrics);
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* unsafe_arena_release_thread_metrics();
+
+  // required fixed32 poll_usec = 1;
+  bool has_poll_usec() const;
+  private:
+  bool _internal_has_poll_usec() const;
+  public:
+  void clear_poll_usec();
+  uint32_t poll_usec() const;
+  void set_poll_usec(uint32_t value);
+  private:
+  uint32_t _internal_poll_usec() const;
+  void _internal_set_poll_usec(uint32_t value);
+  public:
+
+  // required fixed32 max_cleanable_memory_utilization = 2;
+  bool has_max_cleanable_memory_utilization() const;
+  private:
+  bool _internal_has_max_cleanable_memory_utilization() const;
+  public:
+  void clear_max_cleanable_memory_utilization();
+  uint32_t max_cleanable_memory_utilization() const;
+  void set_max_cleanable_memory_utilization(uint32_t value);
+  private:
+  uint32_t _internal_max_cleanable_memory_utilization() const;
+  void _internal_set_max_cleanable_memory_utilization(uint32_t value);
+  public:
+
+  // required fixed32 live_segments_per_disk_pass = 3;
+  bool has_live_segments_per_disk_pass() const;
+  private:
+  bool _internal_has_live_segments_per_disk_pass() const;
+  public:
+  void clear_live_segments_per_disk_pass();
+  uint32_t live_segments_per_disk_pass() const;
+  void set_live_segments_per_disk_pass(uint32_t value);
+  private:
+  uint32_t _internal_live_segments_per_disk_pass() const;
+  void _internal_set_live_segments_per_disk_pass(uint32_t value);
+  public:
+
+  // required fixed32 survivor_segments_to_reserve = 4;
+  bool has_survivor_segments_to_reserve() const;
+  private:
+  bool _internal_has_survivor_segments_to_reserve() const;
+  public:
+  void clear_survivor_segments_to_reserve();
+  uint32_t survivor_segments_to_reserve() const;
+  void set_survivor_segments_to_reserve(uint32_t value);
+  private:
+  uint32_t _internal_survivor_segments_to_reserve() const;
+  void _internal_set_survivor_segments_to_reserve(uint32_t value);
+  public:
+
+  // required fixed32 min_memory_utilization = 5;
+  bool has_min_memory_utilization() const;
+  private:
+  bool _internal_has_min_memory_utilization() const;
+  public:
+  void clear_min_memory_utilization();
+  uint32_t min_memory_utilization() const;
+  void set_min_memory_utilization(uint32_t value);
+  private:
+  uint32_t _internal_min_memory_utilization() const;
+  void _internal_set_min_memory_utilization(uint32_t value);
+  public:
+
+  // required fixed32 min_disk_utilization = 6;
+  bool has_min_disk_utilization() const;
+  private:
+  bool _internal_has_min_disk_utilization() const;
+  public:
+  void clear_min_disk_utilization();
+  uint32_t min_disk_utilization() const;
+  void set_min_disk_utilization(uint32_t value);
+  private:
+  uint32_t _internal_min_disk_utilization() const;
+  void _internal_set_min_disk_utilization(uint32_t value);
+  public:
+
+  // required fixed64 do_work_ticks = 7;
+  bool has_do_work_ticks() const;
+  private:
+  bool _internal_has_do_work_ticks() const;
+  public:
+  void clear_do_work_ticks();
+  uint64_t do_work_ticks() const;
+  void set_do_work_ticks(uint64_t value);
+  private:
+  uint64_t _internal_do_work_ticks() const;
+  void _internal_set_do_work_ticks(uint64_t value);
+  public:
+
+  // required fixed64 do_work_sleep_ticks = 8;
+  bool has_do_work_sleep_ticks() const;
+  private:
+  bool _internal_has_do_work_sleep_ticks() const;
+  public:
+  void clear_do_work_sleep_ticks();
+  uint64_t do_work_sleep_ticks() const;
+  void set_do_work_sleep_ticks(uint64_t value);
+  private:
+  uint64_t _internal_do_work_sleep_ticks() const;
+  void _internal_set_do_work_sleep_ticks(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* in_memory_metrics_;
+    ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* on_disk_metrics_;
+    ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* thread_metrics_;
+    uint32_t poll_usec_;
+    uint32_t max_cleanable_memory_utilization_;
+    uint32_t live_segments_per_disk_pass_;
+    uint32_t survivor_segments_to_reserve_;
+    uint32_t min_memory_utilization_;
+    uint32_t min_disk_utilization_;
+    uint64_t do_work_ticks_;
+    uint64_t do_work_sleep_ticks_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_LogMetrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogMetrics_SegletMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics) */ {
+ public:
+  inline LogMetrics_SegletMetrics() : LogMetrics_SegletMetrics(nullptr) {}
+  ~LogMetrics_SegletMetrics() override;
+  explicit PROTOBUF_CONSTEXPR LogMetrics_SegletMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogMetrics_SegletMetrics(const LogMetrics_SegletMetrics& from);
+  LogMetrics_SegletMetrics(LogMetrics_SegletMetrics&& from) noexcept
+    : LogMetrics_SegletMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline LogMetrics_SegletMetrics& operator=(const LogMetrics_SegletMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogMetrics_SegletMetrics& operator=(LogMetrics_SegletMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogMetrics_SegletMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogMetrics_SegletMetrics* internal_default_instance() {
+    return reinterpret_cast<const LogMetrics_SegletMetrics*>(
+               &_LogMetrics_SegletMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(LogMetrics_SegletMetrics& a, LogMetrics_SegletMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogMetrics_SegletMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogMetrics_SegletMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogMetrics_SegletMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogMetrics_SegletMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogMetrics_SegletMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogMetrics_SegletMetrics& from) {
+    LogMetrics_SegletMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogMetrics_SegletMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.LogMetrics.SegletMetrics";
+  }
+  protected:
+  explicit LogMetrics_SegletMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodeSegletsFieldNumber = 8,
+    kNodeDefaultPoolCountFieldNumber = 9,
+    kTotalSegletsFieldNumber = 1,
+    kTotalUsableSegletsFieldNumber = 2,
+    kEmergencyHeadPoolReserveFieldNumber = 3,
+    kEmergencyHeadPoolCountFieldNumber = 4,
+    kCleanerPoolReserveFieldNumber = 5,
+    kCleanerPoolCountFieldNumber = 6,
+    kDefaultPoolCountFieldNumber = 7,
+    kColdSegletsFieldNumber = 10,
+    kColdPoolCountFieldNumber = 11,
+  };
+  // repeated fixed64 node_seglets = 8;
+  int node_seglets_size() const;
+  private:
+  int _internal_node_seglets_size() const;
+  public:
+  void clear_node_seglets();
+  private:
+  uint64_t _internal_node_seglets(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_node_seglets() const;
+  void _internal_add_node_seglets(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_node_seglets();
+  public:
+  uint64_t node_seglets(int index) const;
+  void set_node_seglets(int index, uint64_t value);
+  void add_node_seglets(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      node_seglets() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_node_seglets();
+
+  // repeated fixed64 node_default_pool_count = 9;
+  int node_default_pool_count_size() const;
+  private:
+  int _internal_node_default_pool_count_size() const;
+  public:
+  void clear_node_default_pool_count();
+  private:
+  uint64_t _internal_node_default_pool_count(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_node_default_pool_count() const;
+  void _internal_add_node_default_pool_count(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_node_default_pool_count();
+  public:
+  uint64_t node_default_pool_count(int index) const;
+  void set_node_default_pool_count(int index, uint64_t value);
+  void add_node_default_pool_count(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      node_default_pool_count() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_node_default_pool_count();
+
+  // required fixed64 total_seglets = 1;
+  bool has_total_seglets() const;
+  private:
+  bool _internal_has_total_seglets() const;
+  public:
+  void clear_total_seglets();
+  uint64_t total_seglets() const;
+  void set_total_seglets(uint64_t value);
+  private:
+  uint64_t _internal_total_seglets() const;
+  void _internal_set_total_seglets(uint64_t value);
+  public:
+
+  // required fixed64 total_usable_seglets = 2;
+  bool has_total_usable_seglets() const;
+  private:
+  bool _internal_has_total_usable_seglets() const;
+  public:
+  void clear_total_usable_seglets();
+  uint64_t total_usable_seglets() const;
+  void set_total_usable_seglets(uint64_t value);
+  private:
+  uint64_t _internal_total_usable_seglets() const;
+  void _internal_set_total_usable_seglets(uint64_t value);
+  public:
+
+  // required fixed64 emergency_head_pool_reserve = 3;
+  bool has_emergency_head_pool_reserve() const;
+  private:
+  bool _internal_has_emergency_head_pool_reserve() const;
+  public:
+  void clear_emergency_head_pool_reserve();
+  uint64_t emergency_head_pool_reserve() const;
+  void set_emergency_head_pool_reserve(uint64_t value);
+  private:
+  uint64_t _internal_emergency_head_pool_reserve() const;
+  void _internal_set_emergency_head_pool_reserve(uint64_t value);
+  public:
+
+  // required fixed64 emergency_head_pool_count = 4;
+  bool has_emergency_head_pool_count() const;
+  private:
+  bool _internal_has_emergency_head_pool_count() const;
+  public:
+  void clear_emergency_head_pool_count();
+  uint64_t emergency_head_pool_count() const;
+  void set_emergency_head_pool_count(uint64_t value);
+  private:
+  uint64_t _internal_emergency_head_pool_count() const;
+  void _internal_set_emergency_head_pool_count(uint64_t value);
+  public:
+
+  // required fixed64 cleaner_pool_reserve = 5;
+  bool has_cleaner_pool_reserve() const;
+  private:
+  bool _internal_has_cleaner_pool_reserve() const;
+  public:
+  void clear_cleaner_pool_reserve();
+  uint64_t cleaner_pool_reserve() const;
+  void set_cleaner_pool_reserve(uint64_t value);
+  private:
+  uint64_t _internal_cleaner_pool_reserve() const;
+  void _internal_set_cleaner_pool_reserve(uint64_t value);
+  public:
+
+  // required fixed64 cleaner_pool_count = 6;
+  bool has_cleaner_pool_count() const;
+  private:
+  bool _internal_has_cleaner_pool_count() const;
+  public:
+  void clear_cleaner_pool_count();
+  uint64_t cleaner_pool_count() const;
+  void set_cleaner_pool_count(uint64_t value);
+  private:
+  uint64_t _internal_cleaner_pool_count() const;
+  void _internal_set_cleaner_pool_count(uint64_t value);
+  public:
+
+  // required fixed64 default_pool_count = 7;
+  bool has_default_pool_count() const;
+  private:
+  bool _internal_has_default_pool_count() const;
+  public:
+  void clear_default_pool_count();
+  uint64_t default_pool_count() const;
+  void set_default_pool_count(uint64_t value);
+  private:
+  uint64_t _internal_default_pool_count() const;
+  void _internal_set_default_pool_count(uint64_t value);
+  public:
+
+  // required fixed64 cold_seglets = 10;
+  bool has_cold_seglets() const;
+  private:
+  bool _internal_has_cold_seglets() const;
+  public:
+  void clear_cold_seglets();
+  uint64_t cold_seglets() const;
+  void set_cold_seglets(uint64_t value);
+  private:
+  uint64_t _internal_cold_seglets() const;
+  void _internal_set_cold_seglets(uint64_t value);
+  public:
+
+  // required fixed64 cold_pool_count = 11;
+  bool has_cold_pool_count() const;
+  private:
+  bool _internal_has_cold_pool_count() const;
+  public:
+  void clear_cold_pool_count();
+  uint64_t cold_pool_count() const;
+  void set_cold_pool_count(uint64_t value);
+  private:
+  uint64_t _internal_cold_pool_count() const;
+  void _internal_set_cold_pool_count(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > node_seglets_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > node_default_pool_count_;
+    uint64_t total_seglets_;
+    uint64_t total_usable_seglets_;
+    uint64_t emergency_head_pool_reserve_;
+    uint64_t emergency_head_pool_count_;
+    uint64_t cleaner_pool_reserve_;
+    uint64_t cleaner_pool_count_;
+    uint64_t default_pool_count_;
+    uint64_t cold_seglets_;
+    uint64_t cold_pool_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_LogMetrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogMetrics_SegmentMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics) */ {
+ public:
+  inline LogMetrics_SegmentMetrics() : LogMetrics_SegmentMetrics(nullptr) {}
+  ~LogMetrics_SegmentMetrics() override;
+  explicit PROTOBUF_CONSTEXPR LogMetrics_SegmentMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogMetrics_SegmentMetrics(const LogMetrics_SegmentMetrics& from);
+  LogMetrics_SegmentMetrics(LogMetrics_SegmentMetrics&& from) noexcept
+    : LogMetrics_SegmentMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline LogMetrics_SegmentMetrics& operator=(const LogMetrics_SegmentMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogMetrics_SegmentMetrics& operator=(LogMetrics_SegmentMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogMetrics_SegmentMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogMetrics_SegmentMetrics* internal_default_instance() {
+    return reinterpret_cast<const LogMetrics_SegmentMetrics*>(
+               &_LogMetrics_SegmentMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(LogMetrics_SegmentMetrics& a, LogMetrics_SegmentMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogMetrics_SegmentMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogMetrics_SegmentMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogMetrics_SegmentMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogMetrics_SegmentMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogMetrics_SegmentMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogMetrics_SegmentMetrics& from) {
+    LogMetrics_SegmentMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogMetrics_SegmentMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics";
+  }
+  protected:
+  explicit LogMetrics_SegmentMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTotalEntryCountsFieldNumber = 3,
+    kTotalEntryLengthsFieldNumber = 4,
+    kSegmentsOnDiskHistogramFieldNumber = 1,
+    kCurrentSegmentsOnDiskFieldNumber = 2,
+  };
+  // repeated fixed64 total_entry_counts = 3;
+  int total_entry_counts_size() const;
+  private:
+  int _internal_total_entry_counts_size() const;
+  public:
+  void clear_total_entry_counts();
+  private:
+  uint64_t _internal_total_entry_counts(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_total_entry_counts() const;
+  void _internal_add_total_entry_counts(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_total_entry_counts();
+  public:
+  uint64_t total_entry_counts(int index) const;
+  void set_total_entry_counts(int index, uint64_t value);
+  void add_total_entry_counts(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      total_entry_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_total_entry_counts();
+
+  // repeated fixed64 total_entry_lengths = 4;
+  int total_entry_lengths_size() const;
+  private:
+  int _internal_total_entry_lengths_size() const;
+  public:
+  void clear_total_entry_lengths();
+  private:
+  uint64_t _internal_total_entry_lengths(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_total_entry_lengths() const;
+  void _internal_add_total_entry_lengths(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_total_entry_lengths();
+  public:
+  uint64_t total_entry_lengths(int index) const;
+  void set_total_entry_lengths(int index, uint64_t value);
+  void add_total_entry_lengths(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      total_entry_lengths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_total_entry_lengths();
+
+  // required .RAMCloud.ProtoBuf.Histogram segments_on_disk_histogram = 1;
+  bool has_segments_on_disk_histogram() const;
+  private:
+  bool _internal_has_segments_on_disk_histogram() const;
+  public:
+  void clear_segments_on_disk_histogram();
+  const ::RAMCloud::ProtoBuf::Histogram& segments_on_disk_histogram() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::Histogram* release_segments_on_disk_histogram();
+  ::RAMCloud::ProtoBuf::Histogram* mutable_segments_on_disk_histogram();
+  void set_allocated_segments_on_disk_histogram(::RAMCloud::ProtoBuf::Histogram* segments_on_disk_histogram);
+  private:
+  const ::RAMCloud::ProtoBuf::Histogram& _internal_segments_on_disk_histogram() const;
+  ::RAMCloud::ProtoBuf::Histogram* _internal_mutable_segments_on_disk_histogram();
+  public:
+  void unsafe_arena_set_allocated_segments_on_disk_histogram(
+      ::RAMCloud::ProtoBuf::Histogram* segments_on_disk_histogram);
+  ::RAMCloud::ProtoBuf::Histogram* unsafe_arena_release_segments_on_disk_histogram();
+
+  // required fixed64 current_segments_on_disk = 2;
+  bool has_current_segments_on_disk() const;
+  private:
+  bool _internal_has_current_segments_on_disk() const;
+  public:
+  void clear_current_segments_on_disk();
+  uint64_t current_segments_on_disk() const;
+  void set_current_segments_on_disk(uint64_t value);
+  private:
+  uint64_t _internal_current_segments_on_disk() const;
+  void _internal_set_current_segments_on_disk(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > total_entry_counts_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > total_entry_lengths_;
+    ::RAMCloud::ProtoBuf::Histogram* segments_on_disk_histogram_;
+    uint64_t current_segments_on_disk_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_LogMetrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.LogMetrics) */ {
+ public:
+  inline LogMetrics() : LogMetrics(nullptr) {}
+  ~LogMetrics() override;
+  explicit PROTOBUF_CONSTEXPR LogMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogMetrics(const LogMetrics& from);
+  LogMetrics(LogMetrics&& from) noexcept
+    : LogMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline LogMetrics& operator=(const LogMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogMetrics& operator=(LogMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogMetrics* internal_default_instance() {
+    return reinterpret_cast<const LogMetrics*>(
+               &_LogMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(LogMetrics& a, LogMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogMetrics& from) {
+    LogMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.LogMetrics";
+  }
+  protected:
+  explicit LogMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef LogMetrics_CleanerMetrics CleanerMetrics;
+  typedef LogMetrics_SegletMetrics SegletMetrics;
+  typedef LogMetrics_SegmentMetrics SegmentMetrics;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCleanerMetricsFieldNumber = 9,
+    kSegletMetricsFieldNumber = 10,
+    kSegmentMetricsFieldNumber = 11,
+    kTicksPerSecondFieldNumber = 1,
+    kTotalSyncCallsFieldNumber = 2,
+    kTotalSyncTicksFieldNumber = 3,
+    kTotalAppendCallsFieldNumber = 4,
+    kTotalAppendTicksFieldNumber = 5,
+    kTotalNoSpaceTicksFieldNumber = 6,
+    kTotalBytesAppendedFieldNumber = 7,
+    kTotalMetadataBytesAppendedFieldNumber = 8,
+  };
+  // required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics cleaner_metrics = 9;
+  bool has_cleaner_metrics() const;
+  private:
+  bool _internal_has_cleaner_metrics() const;
+  public:
+  void clear_cleaner_metrics();
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics& cleaner_metrics() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* release_cleaner_metrics();
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* mutable_cleaner_metrics();
+  void set_allocated_cleaner_metrics(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* cleaner_metrics);
+  private:
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics& _internal_cleaner_metrics() const;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* _internal_mutable_cleaner_metrics();
+  public:
+  void unsafe_arena_set_allocated_cleaner_metrics(
+      ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* cleaner_metrics);
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* unsafe_arena_release_cleaner_metrics();
+
+  // required .RAMCloud.ProtoBuf.LogMetrics.SegletMetrics seglet_metrics = 10;
+  bool has_seglet_metrics() const;
+  private:
+  bool _internal_has_seglet_metrics() const;
+  public:
+  void clear_seglet_metrics();
+  const ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics& seglet_metrics() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* release_seglet_metrics();
+  ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* mutable_seglet_metrics();
+  void set_allocated_seglet_metrics(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* seglet_metrics);
+  private:
+  const ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics& _internal_seglet_metrics() const;
+  ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* _internal_mutable_seglet_metrics();
+  public:
+  void unsafe_arena_set_allocated_seglet_metrics(
+      ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* seglet_metrics);
+  ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* unsafe_arena_release_seglet_metrics();
+
+  // required .RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics segment_metrics = 11;
+  bool has_segment_metrics() const;
+  private:
+  bool _internal_has_segment_metrics() const;
+  public:
+  void clear_segment_metrics();
+  const ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics& segment_metrics() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* release_segment_metrics();
+  ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* mutable_segment_metrics();
+  void set_allocated_segment_metrics(::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* segment_metrics);
+  private:
+  const ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics& _internal_segment_metrics() const;
+  ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* _internal_mutable_segment_metrics();
+  public:
+  void unsafe_arena_set_allocated_segment_metrics(
+      ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* segment_metrics);
+  ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* unsafe_arena_release_segment_metrics();
+
+  // required double ticks_per_second = 1;
+  bool has_ticks_per_second() const;
+  private:
+  bool _internal_has_ticks_per_second() const;
+  public:
+  void clear_ticks_per_second();
+  double ticks_per_second() const;
+  void set_ticks_per_second(double value);
+  private:
+  double _internal_ticks_per_second() const;
+  void _internal_set_ticks_per_second(double value);
+  public:
+
+  // required fixed64 total_sync_calls = 2;
+  bool has_total_sync_calls() const;
+  private:
+  bool _internal_has_total_sync_calls() const;
+  public:
+  void clear_total_sync_calls();
+  uint64_t total_sync_calls() const;
+  void set_total_sync_calls(uint64_t value);
+  private:
+  uint64_t _internal_total_sync_calls() const;
+  void _internal_set_total_sync_calls(uint64_t value);
+  public:
+
+  // required fixed64 total_sync_ticks = 3;
+  bool has_total_sync_ticks() const;
+  private:
+  bool _internal_has_total_sync_ticks() const;
+  public:
+  void clear_total_sync_ticks();
+  uint64_t total_sync_ticks() const;
+  void set_total_sync_ticks(uint64_t value);
+  private:
+  uint64_t _internal_total_sync_ticks() const;
+  void _internal_set_total_sync_ticks(uint64_t value);
+  public:
+
+  // required fixed64 total_append_calls = 4;
+  bool has_total_append_calls() const;
+  private:
+  bool _internal_has_total_append_calls() const;
+  public:
+  void clear_total_append_calls();
+  uint64_t total_append_calls() const;
+  void set_total_append_calls(uint64_t value);
+  private:
+  uint64_t _internal_total_append_calls() const;
+  void _internal_set_total_append_calls(uint64_t value);
+  public:
+
+  // required fixed64 total_append_ticks = 5;
+  bool has_total_append_ticks() const;
+  private:
+  bool _internal_has_total_append_ticks() const;
+  public:
+  void clear_total_append_ticks();
+  uint64_t total_append_ticks() const;
+  void set_total_append_ticks(uint64_t value);
+  private:
+  uint64_t _internal_total_append_ticks() const;
+  void _internal_set_total_append_ticks(uint64_t value);
+  public:
+
+  // required fixed64 total_no_space_ticks = 6;
+  bool has_total_no_space_ticks() const;
+  private:
+  bool _internal_has_total_no_space_ticks() const;
+  public:
+  void clear_total_no_space_ticks();
+  uint64_t total_no_space_ticks() const;
+  void set_total_no_space_ticks(uint64_t value);
+  private:
+  uint64_t _internal_total_no_space_ticks() const;
+  void _internal_set_total_no_space_ticks(uint64_t value);
+  public:
+
+  // required fixed64 total_bytes_appended = 7;
+  bool has_total_bytes_appended() const;
+  private:
+  bool _internal_has_total_bytes_appended() const;
+  public:
+  void clear_total_bytes_appended();
+  uint64_t total_bytes_appended() const;
+  void set_total_bytes_appended(uint64_t value);
+  private:
+  uint64_t _internal_total_bytes_appended() const;
+  void _internal_set_total_bytes_appended(uint64_t value);
+  public:
+
+  // required fixed64 total_metadata_bytes_appended = 8;
+  bool has_total_metadata_bytes_appended() const;
+  private:
+  bool _internal_has_total_metadata_bytes_appended() const;
+  public:
+  void clear_total_metadata_bytes_appended();
+  uint64_t total_metadata_bytes_appended() const;
+  void set_total_metadata_bytes_appended(uint64_t value);
+  private:
+  uint64_t _internal_total_metadata_bytes_appended() const;
+  void _internal_set_total_metadata_bytes_appended(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.LogMetrics)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* cleaner_metrics_;
+    ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* seglet_metrics_;
+    ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* segment_metrics_;
+    double ticks_per_second_;
+    uint64_t total_sync_calls_;
+    uint64_t total_sync_ticks_;
+    uint64_t total_append_calls_;
+    uint64_t total_append_ticks_;
+    uint64_t total_no_space_ticks_;
+    uint64_t total_bytes_appended_;
+    uint64_t total_metadata_bytes_appended_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_LogMetrics_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LogMetrics_CleanerMetrics_InMemoryMetrics
+
+// required fixed64 total_relocation_callbacks = 1;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_total_relocation_callbacks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_total_relocation_callbacks() const {
+  return _internal_has_total_relocation_callbacks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_relocation_callbacks() {
+  _impl_.total_relocation_callbacks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_relocation_callbacks() const {
+  return _impl_.total_relocation_callbacks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_relocation_callbacks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_relocation_callbacks)
+  return _internal_total_relocation_callbacks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_total_relocation_callbacks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.total_relocation_callbacks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_relocation_callbacks(uint64_t value) {
+  _internal_set_total_relocation_callbacks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_relocation_callbacks)
+}
+
+// required fixed64 total_relocation_appends = 2;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_total_relocation_appends() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_total_relocation_appends() const {
+  return _internal_has_total_relocation_appends();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_relocation_appends() {
+  _impl_.total_relocation_appends_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_relocation_appends() const {
+  return _impl_.total_relocation_appends_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_relocation_appends() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_relocation_appends)
+  return _internal_total_relocation_appends();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_total_relocation_appends(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.total_relocation_appends_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_relocation_appends(uint64_t value) {
+  _internal_set_total_relocation_appends(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_relocation_appends)
+}
+
+// required fixed64 total_bytes_freed = 3;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_total_bytes_freed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_total_bytes_freed() const {
+  return _internal_has_total_bytes_freed();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_bytes_freed() {
+  _impl_.total_bytes_freed_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_bytes_freed() const {
+  return _impl_.total_bytes_freed_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_bytes_freed() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_bytes_freed)
+  return _internal_total_bytes_freed();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_total_bytes_freed(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.total_bytes_freed_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_bytes_freed(uint64_t value) {
+  _internal_set_total_bytes_freed(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_bytes_freed)
+}
+
+// required fixed64 total_bytes_in_compacted_segments = 4;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_total_bytes_in_compacted_segments() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_total_bytes_in_compacted_segments() const {
+  return _internal_has_total_bytes_in_compacted_segments();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_bytes_in_compacted_segments() {
+  _impl_.total_bytes_in_compacted_segments_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_bytes_in_compacted_segments() const {
+  return _impl_.total_bytes_in_compacted_segments_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_bytes_in_compacted_segments() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_bytes_in_compacted_segments)
+  return _internal_total_bytes_in_compacted_segments();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_total_bytes_in_compacted_segments(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.total_bytes_in_compacted_segments_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_bytes_in_compacted_segments(uint64_t value) {
+  _internal_set_total_bytes_in_compacted_segments(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_bytes_in_compacted_segments)
+}
+
+// required fixed64 total_bytes_appended_to_survivors = 5;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_total_bytes_appended_to_survivors() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_total_bytes_appended_to_survivors() const {
+  return _internal_has_total_bytes_appended_to_survivors();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_bytes_appended_to_survivors() {
+  _impl_.total_bytes_appended_to_survivors_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_bytes_appended_to_survivors() const {
+  return _impl_.total_bytes_appended_to_survivors_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_bytes_appended_to_survivors() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_bytes_appended_to_survivors)
+  return _internal_total_bytes_appended_to_survivors();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_total_bytes_appended_to_survivors(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.total_bytes_appended_to_survivors_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_bytes_appended_to_survivors(uint64_t value) {
+  _internal_set_total_bytes_appended_to_survivors(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_bytes_appended_to_survivors)
+}
+
+// required fixed64 total_segments_compacted = 6;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_total_segments_compacted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_total_segments_compacted() const {
+  return _internal_has_total_segments_compacted();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_segments_compacted() {
+  _impl_.total_segments_compacted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_segments_compacted() const {
+  return _impl_.total_segments_compacted_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_segments_compacted() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_segments_compacted)
+  return _internal_total_segments_compacted();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_total_segments_compacted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.total_segments_compacted_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_segments_compacted(uint64_t value) {
+  _internal_set_total_segments_compacted(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_segments_compacted)
+}
+
+// required fixed64 total_empty_segments_compacted = 7;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_total_empty_segments_compacted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_total_empty_segments_compacted() const {
+  return _internal_has_total_empty_segments_compacted();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_empty_segments_compacted() {
+  _impl_.total_empty_segments_compacted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_empty_segments_compacted() const {
+  return _impl_.total_empty_segments_compacted_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_empty_segments_compacted() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_empty_segments_compacted)
+  return _internal_total_empty_segments_compacted();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_total_empty_segments_compacted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.total_empty_segments_compacted_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_empty_segments_compacted(uint64_t value) {
+  _internal_set_total_empty_segments_compacted(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_empty_segments_compacted)
+}
+
+// repeated fixed64 total_entries_scanned = 8;
+inline int LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_entries_scanned_size() const {
+  return _impl_.total_entries_scanned_.size();
+}
+inline int LogMetrics_CleanerMetrics_InMemoryMetrics::total_entries_scanned_size() const {
+  return _internal_total_entries_scanned_size();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_entries_scanned() {
+  _impl_.total_entries_scanned_.Clear();
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_entries_scanned(int index) const {
+  return _impl_.total_entries_scanned_.Get(index);
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_entries_scanned(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_entries_scanned)
+  return _internal_total_entries_scanned(index);
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_entries_scanned(int index, uint64_t value) {
+  _impl_.total_entries_scanned_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_entries_scanned)
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_add_total_entries_scanned(uint64_t value) {
+  _impl_.total_entries_scanned_.Add(value);
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::add_total_entries_scanned(uint64_t value) {
+  _internal_add_total_entries_scanned(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_entries_scanned)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_entries_scanned() const {
+  return _impl_.total_entries_scanned_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_InMemoryMetrics::total_entries_scanned() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_entries_scanned)
+  return _internal_total_entries_scanned();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_mutable_total_entries_scanned() {
+  return &_impl_.total_entries_scanned_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_InMemoryMetrics::mutable_total_entries_scanned() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_entries_scanned)
+  return _internal_mutable_total_entries_scanned();
+}
+
+// repeated fixed64 total_live_entries_scanned = 9;
+inline int LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_live_entries_scanned_size() const {
+  return _impl_.total_live_entries_scanned_.size();
+}
+inline int LogMetrics_CleanerMetrics_InMemoryMetrics::total_live_entries_scanned_size() const {
+  return _internal_total_live_entries_scanned_size();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_live_entries_scanned() {
+  _impl_.total_live_entries_scanned_.Clear();
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_live_entries_scanned(int index) const {
+  return _impl_.total_live_entries_scanned_.Get(index);
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_live_entries_scanned(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_live_entries_scanned)
+  return _internal_total_live_entries_scanned(index);
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_live_entries_scanned(int index, uint64_t value) {
+  _impl_.total_live_entries_scanned_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_live_entries_scanned)
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_add_total_live_entries_scanned(uint64_t value) {
+  _impl_.total_live_entries_scanned_.Add(value);
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::add_total_live_entries_scanned(uint64_t value) {
+  _internal_add_total_live_entries_scanned(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_live_entries_scanned)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_live_entries_scanned() const {
+  return _impl_.total_live_entries_scanned_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_InMemoryMetrics::total_live_entries_scanned() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_live_entries_scanned)
+  return _internal_total_live_entries_scanned();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_mutable_total_live_entries_scanned() {
+  return &_impl_.total_live_entries_scanned_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_InMemoryMetrics::mutable_total_live_entries_scanned() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_live_entries_scanned)
+  return _internal_mutable_total_live_entries_scanned();
+}
+
+// repeated fixed64 total_scanned_entry_lengths = 10;
+inline int LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_scanned_entry_lengths_size() const {
+  return _impl_.total_scanned_entry_lengths_.size();
+}
+inline int LogMetrics_CleanerMetrics_InMemoryMetrics::total_scanned_entry_lengths_size() const {
+  return _internal_total_scanned_entry_lengths_size();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_scanned_entry_lengths() {
+  _impl_.total_scanned_entry_lengths_.Clear();
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_scanned_entry_lengths(int index) const {
+  return _impl_.total_scanned_entry_lengths_.Get(index);
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_scanned_entry_lengths(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_scanned_entry_lengths)
+  return _internal_total_scanned_entry_lengths(index);
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_scanned_entry_lengths(int index, uint64_t value) {
+  _impl_.total_scanned_entry_lengths_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_scanned_entry_lengths)
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_add_total_scanned_entry_lengths(uint64_t value) {
+  _impl_.total_scanned_entry_lengths_.Add(value);
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::add_total_scanned_entry_lengths(uint64_t value) {
+  _internal_add_total_scanned_entry_lengths(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_scanned_entry_lengths)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_scanned_entry_lengths() const {
+  return _impl_.total_scanned_entry_lengths_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_InMemoryMetrics::total_scanned_entry_lengths() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_scanned_entry_lengths)
+  return _internal_total_scanned_entry_lengths();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_mutable_total_scanned_entry_lengths() {
+  return &_impl_.total_scanned_entry_lengths_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_InMemoryMetrics::mutable_total_scanned_entry_lengths() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_scanned_entry_lengths)
+  return _internal_mutable_total_scanned_entry_lengths();
+}
+
+// repeated fixed64 total_live_scanned_entry_lengths = 11;
+inline int LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_live_scanned_entry_lengths_size() const {
+  return _impl_.total_live_scanned_entry_lengths_.size();
+}
+inline int LogMetrics_CleanerMetrics_InMemoryMetrics::total_live_scanned_entry_lengths_size() const {
+  return _internal_total_live_scanned_entry_lengths_size();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_live_scanned_entry_lengths() {
+  _impl_.total_live_scanned_entry_lengths_.Clear();
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_live_scanned_entry_lengths(int index) const {
+  return _impl_.total_live_scanned_entry_lengths_.Get(index);
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_live_scanned_entry_lengths(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_live_scanned_entry_lengths)
+  return _internal_total_live_scanned_entry_lengths(index);
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_live_scanned_entry_lengths(int index, uint64_t value) {
+  _impl_.total_live_scanned_entry_lengths_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_live_scanned_entry_lengths)
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_add_total_live_scanned_entry_lengths(uint64_t value) {
+  _impl_.total_live_scanned_entry_lengths_.Add(value);
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::add_total_live_scanned_entry_lengths(uint64_t value) {
+  _internal_add_total_live_scanned_entry_lengths(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_live_scanned_entry_lengths)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_live_scanned_entry_lengths() const {
+  return _impl_.total_live_scanned_entry_lengths_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_InMemoryMetrics::total_live_scanned_entry_lengths() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_live_scanned_entry_lengths)
+  return _internal_total_live_scanned_entry_lengths();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_mutable_total_live_scanned_entry_lengths() {
+  return &_impl_.total_live_scanned_entry_lengths_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_InMemoryMetrics::mutable_total_live_scanned_entry_lengths() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_live_scanned_entry_lengths)
+  return _internal_mutable_total_live_scanned_entry_lengths();
+}
+
+// required fixed64 total_ticks = 12;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_total_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_total_ticks() const {
+  return _internal_has_total_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_ticks() {
+  _impl_.total_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_ticks() const {
+  return _impl_.total_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_ticks)
+  return _internal_total_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_total_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.total_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_ticks(uint64_t value) {
+  _internal_set_total_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_ticks)
+}
+
+// required fixed64 get_segment_to_compact_ticks = 13;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_get_segment_to_compact_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_get_segment_to_compact_ticks() const {
+  return _internal_has_get_segment_to_compact_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_get_segment_to_compact_ticks() {
+  _impl_.get_segment_to_compact_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_get_segment_to_compact_ticks() const {
+  return _impl_.get_segment_to_compact_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::get_segment_to_compact_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.get_segment_to_compact_ticks)
+  return _internal_get_segment_to_compact_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_get_segment_to_compact_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.get_segment_to_compact_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_get_segment_to_compact_ticks(uint64_t value) {
+  _internal_set_get_segment_to_compact_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.get_segment_to_compact_ticks)
+}
+
+// required fixed64 wait_for_free_survivor_ticks = 14;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_wait_for_free_survivor_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_wait_for_free_survivor_ticks() const {
+  return _internal_has_wait_for_free_survivor_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_wait_for_free_survivor_ticks() {
+  _impl_.wait_for_free_survivor_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_wait_for_free_survivor_ticks() const {
+  return _impl_.wait_for_free_survivor_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::wait_for_free_survivor_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.wait_for_free_survivor_ticks)
+  return _internal_wait_for_free_survivor_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_wait_for_free_survivor_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.wait_for_free_survivor_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_wait_for_free_survivor_ticks(uint64_t value) {
+  _internal_set_wait_for_free_survivor_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.wait_for_free_survivor_ticks)
+}
+
+// required fixed64 relocation_callback_ticks = 15;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_relocation_callback_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_relocation_callback_ticks() const {
+  return _internal_has_relocation_callback_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_relocation_callback_ticks() {
+  _impl_.relocation_callback_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_relocation_callback_ticks() const {
+  return _impl_.relocation_callback_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::relocation_callback_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.relocation_callback_ticks)
+  return _internal_relocation_callback_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_relocation_callback_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.relocation_callback_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_relocation_callback_ticks(uint64_t value) {
+  _internal_set_relocation_callback_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.relocation_callback_ticks)
+}
+
+// required fixed64 relocation_append_ticks = 16;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_relocation_append_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_relocation_append_ticks() const {
+  return _internal_has_relocation_append_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_relocation_append_ticks() {
+  _impl_.relocation_append_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_relocation_append_ticks() const {
+  return _impl_.relocation_append_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::relocation_append_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.relocation_append_ticks)
+  return _internal_relocation_append_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_relocation_append_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.relocation_append_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_relocation_append_ticks(uint64_t value) {
+  _internal_set_relocation_append_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.relocation_append_ticks)
+}
+
+// required fixed64 compaction_complete_ticks = 17;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_compaction_complete_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_compaction_complete_ticks() const {
+  return _internal_has_compaction_complete_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_compaction_complete_ticks() {
+  _impl_.compaction_complete_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_compaction_complete_ticks() const {
+  return _impl_.compaction_complete_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::compaction_complete_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.compaction_complete_ticks)
+  return _internal_compaction_complete_ticks();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_compaction_complete_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.compaction_complete_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_compaction_complete_ticks(uint64_t value) {
+  _internal_set_compaction_complete_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.compaction_complete_ticks)
+}
+
+// required fixed64 total_segments_demoted = 18;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_total_segments_demoted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_total_segments_demoted() const {
+  return _internal_has_total_segments_demoted();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_segments_demoted() {
+  _impl_.total_segments_demoted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_segments_demoted() const {
+  return _impl_.total_segments_demoted_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_segments_demoted() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_segments_demoted)
+  return _internal_total_segments_demoted();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_total_segments_demoted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.total_segments_demoted_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_segments_demoted(uint64_t value) {
+  _internal_set_total_segments_demoted(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_segments_demoted)
+}
+
+// required fixed64 total_bytes_demoted = 19;
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_has_total_bytes_demoted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_InMemoryMetrics::has_total_bytes_demoted() const {
+  return _internal_has_total_bytes_demoted();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::clear_total_bytes_demoted() {
+  _impl_.total_bytes_demoted_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_total_bytes_demoted() const {
+  return _impl_.total_bytes_demoted_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_InMemoryMetrics::total_bytes_demoted() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_bytes_demoted)
+  return _internal_total_bytes_demoted();
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::_internal_set_total_bytes_demoted(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.total_bytes_demoted_ = value;
+}
+inline void LogMetrics_CleanerMetrics_InMemoryMetrics::set_total_bytes_demoted(uint64_t value) {
+  _internal_set_total_bytes_demoted(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics.total_bytes_demoted)
+}
+
+// -------------------------------------------------------------------
+
+// LogMetrics_CleanerMetrics_OnDiskMetrics
+
+// required fixed64 total_bytes_appended_to_survivors = 1;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_bytes_appended_to_survivors() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_bytes_appended_to_survivors() const {
+  return _internal_has_total_bytes_appended_to_survivors();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_bytes_appended_to_survivors() {
+  _impl_.total_bytes_appended_to_survivors_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_bytes_appended_to_survivors() const {
+  return _impl_.total_bytes_appended_to_survivors_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_bytes_appended_to_survivors() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_bytes_appended_to_survivors)
+  return _internal_total_bytes_appended_to_survivors();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_bytes_appended_to_survivors(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.total_bytes_appended_to_survivors_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_bytes_appended_to_survivors(uint64_t value) {
+  _internal_set_total_bytes_appended_to_survivors(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_bytes_appended_to_survivors)
+}
+
+// required fixed64 total_memory_bytes_freed = 2;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_memory_bytes_freed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_memory_bytes_freed() const {
+  return _internal_has_total_memory_bytes_freed();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_memory_bytes_freed() {
+  _impl_.total_memory_bytes_freed_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_memory_bytes_freed() const {
+  return _impl_.total_memory_bytes_freed_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_memory_bytes_freed() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_memory_bytes_freed)
+  return _internal_total_memory_bytes_freed();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_memory_bytes_freed(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.total_memory_bytes_freed_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_memory_bytes_freed(uint64_t value) {
+  _internal_set_total_memory_bytes_freed(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_memory_bytes_freed)
+}
+
+// required fixed64 total_disk_bytes_freed = 3;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_disk_bytes_freed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_disk_bytes_freed() const {
+  return _internal_has_total_disk_bytes_freed();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_disk_bytes_freed() {
+  _impl_.total_disk_bytes_freed_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_disk_bytes_freed() const {
+  return _impl_.total_disk_bytes_freed_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_disk_bytes_freed() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_disk_bytes_freed)
+  return _internal_total_disk_bytes_freed();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_disk_bytes_freed(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.total_disk_bytes_freed_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_disk_bytes_freed(uint64_t value) {
+  _internal_set_total_disk_bytes_freed(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_disk_bytes_freed)
+}
+
+// required fixed64 total_memory_bytes_in_cleaned_segments = 4;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_memory_bytes_in_cleaned_segments() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_memory_bytes_in_cleaned_segments() const {
+  return _internal_has_total_memory_bytes_in_cleaned_segments();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_memory_bytes_in_cleaned_segments() {
+  _impl_.total_memory_bytes_in_cleaned_segments_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_memory_bytes_in_cleaned_segments() const {
+  return _impl_.total_memory_bytes_in_cleaned_segments_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_memory_bytes_in_cleaned_segments() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_memory_bytes_in_cleaned_segments)
+  return _internal_total_memory_bytes_in_cleaned_segments();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_memory_bytes_in_cleaned_segments(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.total_memory_bytes_in_cleaned_segments_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_memory_bytes_in_cleaned_segments(uint64_t value) {
+  _internal_set_total_memory_bytes_in_cleaned_segments(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_memory_bytes_in_cleaned_segments)
+}
+
+// required fixed64 total_disk_bytes_in_cleaned_segments = 5;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_disk_bytes_in_cleaned_segments() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_disk_bytes_in_cleaned_segments() const {
+  return _internal_has_total_disk_bytes_in_cleaned_segments();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_disk_bytes_in_cleaned_segments() {
+  _impl_.total_disk_bytes_in_cleaned_segments_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_disk_bytes_in_cleaned_segments() const {
+  return _impl_.total_disk_bytes_in_cleaned_segments_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_disk_bytes_in_cleaned_segments() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_disk_bytes_in_cleaned_segments)
+  return _internal_total_disk_bytes_in_cleaned_segments();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_disk_bytes_in_cleaned_segments(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.total_disk_bytes_in_cleaned_segments_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_disk_bytes_in_cleaned_segments(uint64_t value) {
+  _internal_set_total_disk_bytes_in_cleaned_segments(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_disk_bytes_in_cleaned_segments)
+}
+
+// required fixed64 total_relocation_callbacks = 6;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_relocation_callbacks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_relocation_callbacks() const {
+  return _internal_has_total_relocation_callbacks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_relocation_callbacks() {
+  _impl_.total_relocation_callbacks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_relocation_callbacks() const {
+  return _impl_.total_relocation_callbacks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_relocation_callbacks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_relocation_callbacks)
+  return _internal_total_relocation_callbacks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_relocation_callbacks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.total_relocation_callbacks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_relocation_callbacks(uint64_t value) {
+  _internal_set_total_relocation_callbacks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_relocation_callbacks)
+}
+
+// required fixed64 total_relocation_appends = 7;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_relocation_appends() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_relocation_appends() const {
+  return _internal_has_total_relocation_appends();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_relocation_appends() {
+  _impl_.total_relocation_appends_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_relocation_appends() const {
+  return _impl_.total_relocation_appends_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_relocation_appends() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_relocation_appends)
+  return _internal_total_relocation_appends();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_relocation_appends(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.total_relocation_appends_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_relocation_appends(uint64_t value) {
+  _internal_set_total_relocation_appends(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_relocation_appends)
+}
+
+// required fixed64 total_segments_cleaned = 8;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_segments_cleaned() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_segments_cleaned() const {
+  return _internal_has_total_segments_cleaned();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_segments_cleaned() {
+  _impl_.total_segments_cleaned_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_segments_cleaned() const {
+  return _impl_.total_segments_cleaned_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_segments_cleaned() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_segments_cleaned)
+  return _internal_total_segments_cleaned();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_segments_cleaned(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.total_segments_cleaned_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_segments_cleaned(uint64_t value) {
+  _internal_set_total_segments_cleaned(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_segments_cleaned)
+}
+
+// required fixed64 total_empty_segments_cleaned = 9;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_empty_segments_cleaned() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_empty_segments_cleaned() const {
+  return _internal_has_total_empty_segments_cleaned();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_empty_segments_cleaned() {
+  _impl_.total_empty_segments_cleaned_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_empty_segments_cleaned() const {
+  return _impl_.total_empty_segments_cleaned_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_empty_segments_cleaned() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_empty_segments_cleaned)
+  return _internal_total_empty_segments_cleaned();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_empty_segments_cleaned(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.total_empty_segments_cleaned_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_empty_segments_cleaned(uint64_t value) {
+  _internal_set_total_empty_segments_cleaned(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_empty_segments_cleaned)
+}
+
+// required fixed64 total_survivors_created = 10;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_survivors_created() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_survivors_created() const {
+  return _internal_has_total_survivors_created();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_survivors_created() {
+  _impl_.total_survivors_created_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_survivors_created() const {
+  return _impl_.total_survivors_created_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_survivors_created() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_survivors_created)
+  return _internal_total_survivors_created();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_survivors_created(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.total_survivors_created_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_survivors_created(uint64_t value) {
+  _internal_set_total_survivors_created(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_survivors_created)
+}
+
+// required fixed64 total_runs = 11;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_runs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_runs() const {
+  return _internal_has_total_runs();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_runs() {
+  _impl_.total_runs_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_runs() const {
+  return _impl_.total_runs_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_runs() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_runs)
+  return _internal_total_runs();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_runs(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.total_runs_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_runs(uint64_t value) {
+  _internal_set_total_runs(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_runs)
+}
+
+// required fixed64 total_low_disk_space_runs = 12;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_low_disk_space_runs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_low_disk_space_runs() const {
+  return _internal_has_total_low_disk_space_runs();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_low_disk_space_runs() {
+  _impl_.total_low_disk_space_runs_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_low_disk_space_runs() const {
+  return _impl_.total_low_disk_space_runs_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_low_disk_space_runs() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_low_disk_space_runs)
+  return _internal_total_low_disk_space_runs();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_low_disk_space_runs(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.total_low_disk_space_runs_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_low_disk_space_runs(uint64_t value) {
+  _internal_set_total_low_disk_space_runs(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_low_disk_space_runs)
+}
+
+// required fixed64 memory_utilization_at_start_sum = 13;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_memory_utilization_at_start_sum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_memory_utilization_at_start_sum() const {
+  return _internal_has_memory_utilization_at_start_sum();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_memory_utilization_at_start_sum() {
+  _impl_.memory_utilization_at_start_sum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_memory_utilization_at_start_sum() const {
+  return _impl_.memory_utilization_at_start_sum_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::memory_utilization_at_start_sum() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.memory_utilization_at_start_sum)
+  return _internal_memory_utilization_at_start_sum();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_memory_utilization_at_start_sum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.memory_utilization_at_start_sum_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_memory_utilization_at_start_sum(uint64_t value) {
+  _internal_set_memory_utilization_at_start_sum(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.memory_utilization_at_start_sum)
+}
+
+// repeated fixed64 total_entries_scanned = 14;
+inline int LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_entries_scanned_size() const {
+  return _impl_.total_entries_scanned_.size();
+}
+inline int LogMetrics_CleanerMetrics_OnDiskMetrics::total_entries_scanned_size() const {
+  return _internal_total_entries_scanned_size();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_entries_scanned() {
+  _impl_.total_entries_scanned_.Clear();
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_entries_scanned(int index) const {
+  return _impl_.total_entries_scanned_.Get(index);
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_entries_scanned(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_entries_scanned)
+  return _internal_total_entries_scanned(index);
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_entries_scanned(int index, uint64_t value) {
+  _impl_.total_entries_scanned_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_entries_scanned)
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_add_total_entries_scanned(uint64_t value) {
+  _impl_.total_entries_scanned_.Add(value);
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::add_total_entries_scanned(uint64_t value) {
+  _internal_add_total_entries_scanned(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_entries_scanned)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_entries_scanned() const {
+  return _impl_.total_entries_scanned_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_OnDiskMetrics::total_entries_scanned() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_entries_scanned)
+  return _internal_total_entries_scanned();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_mutable_total_entries_scanned() {
+  return &_impl_.total_entries_scanned_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_OnDiskMetrics::mutable_total_entries_scanned() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_entries_scanned)
+  return _internal_mutable_total_entries_scanned();
+}
+
+// repeated fixed64 total_live_entries_scanned = 15;
+inline int LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_live_entries_scanned_size() const {
+  return _impl_.total_live_entries_scanned_.size();
+}
+inline int LogMetrics_CleanerMetrics_OnDiskMetrics::total_live_entries_scanned_size() const {
+  return _internal_total_live_entries_scanned_size();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_live_entries_scanned() {
+  _impl_.total_live_entries_scanned_.Clear();
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_live_entries_scanned(int index) const {
+  return _impl_.total_live_entries_scanned_.Get(index);
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_live_entries_scanned(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_live_entries_scanned)
+  return _internal_total_live_entries_scanned(index);
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_live_entries_scanned(int index, uint64_t value) {
+  _impl_.total_live_entries_scanned_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_live_entries_scanned)
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_add_total_live_entries_scanned(uint64_t value) {
+  _impl_.total_live_entries_scanned_.Add(value);
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::add_total_live_entries_scanned(uint64_t value) {
+  _internal_add_total_live_entries_scanned(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_live_entries_scanned)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_live_entries_scanned() const {
+  return _impl_.total_live_entries_scanned_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_OnDiskMetrics::total_live_entries_scanned() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_live_entries_scanned)
+  return _internal_total_live_entries_scanned();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_mutable_total_live_entries_scanned() {
+  return &_impl_.total_live_entries_scanned_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_OnDiskMetrics::mutable_total_live_entries_scanned() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_live_entries_scanned)
+  return _internal_mutable_total_live_entries_scanned();
+}
+
+// repeated fixed64 total_scanned_entry_lengths = 16;
+inline int LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_scanned_entry_lengths_size() const {
+  return _impl_.total_scanned_entry_lengths_.size();
+}
+inline int LogMetrics_CleanerMetrics_OnDiskMetrics::total_scanned_entry_lengths_size() const {
+  return _internal_total_scanned_entry_lengths_size();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_scanned_entry_lengths() {
+  _impl_.total_scanned_entry_lengths_.Clear();
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_scanned_entry_lengths(int index) const {
+  return _impl_.total_scanned_entry_lengths_.Get(index);
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_scanned_entry_lengths(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_scanned_entry_lengths)
+  return _internal_total_scanned_entry_lengths(index);
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_scanned_entry_lengths(int index, uint64_t value) {
+  _impl_.total_scanned_entry_lengths_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_scanned_entry_lengths)
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_add_total_scanned_entry_lengths(uint64_t value) {
+  _impl_.total_scanned_entry_lengths_.Add(value);
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::add_total_scanned_entry_lengths(uint64_t value) {
+  _internal_add_total_scanned_entry_lengths(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_scanned_entry_lengths)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_scanned_entry_lengths() const {
+  return _impl_.total_scanned_entry_lengths_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_OnDiskMetrics::total_scanned_entry_lengths() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_scanned_entry_lengths)
+  return _internal_total_scanned_entry_lengths();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_mutable_total_scanned_entry_lengths() {
+  return &_impl_.total_scanned_entry_lengths_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_OnDiskMetrics::mutable_total_scanned_entry_lengths() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_scanned_entry_lengths)
+  return _internal_mutable_total_scanned_entry_lengths();
+}
+
+// repeated fixed64 total_live_scanned_entry_lengths = 17;
+inline int LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_live_scanned_entry_lengths_size() const {
+  return _impl_.total_live_scanned_entry_lengths_.size();
+}
+inline int LogMetrics_CleanerMetrics_OnDiskMetrics::total_live_scanned_entry_lengths_size() const {
+  return _internal_total_live_scanned_entry_lengths_size();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_live_scanned_entry_lengths() {
+  _impl_.total_live_scanned_entry_lengths_.Clear();
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_live_scanned_entry_lengths(int index) const {
+  return _impl_.total_live_scanned_entry_lengths_.Get(index);
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_live_scanned_entry_lengths(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_live_scanned_entry_lengths)
+  return _internal_total_live_scanned_entry_lengths(index);
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_live_scanned_entry_lengths(int index, uint64_t value) {
+  _impl_.total_live_scanned_entry_lengths_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_live_scanned_entry_lengths)
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_add_total_live_scanned_entry_lengths(uint64_t value) {
+  _impl_.total_live_scanned_entry_lengths_.Add(value);
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::add_total_live_scanned_entry_lengths(uint64_t value) {
+  _internal_add_total_live_scanned_entry_lengths(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_live_scanned_entry_lengths)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_live_scanned_entry_lengths() const {
+  return _impl_.total_live_scanned_entry_lengths_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_OnDiskMetrics::total_live_scanned_entry_lengths() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_live_scanned_entry_lengths)
+  return _internal_total_live_scanned_entry_lengths();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_mutable_total_live_scanned_entry_lengths() {
+  return &_impl_.total_live_scanned_entry_lengths_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_OnDiskMetrics::mutable_total_live_scanned_entry_lengths() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_live_scanned_entry_lengths)
+  return _internal_mutable_total_live_scanned_entry_lengths();
+}
+
+// required fixed64 total_ticks = 18;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_total_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_total_ticks() const {
+  return _internal_has_total_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_total_ticks() {
+  _impl_.total_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_total_ticks() const {
+  return _impl_.total_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::total_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_ticks)
+  return _internal_total_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_total_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.total_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_total_ticks(uint64_t value) {
+  _internal_set_total_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.total_ticks)
+}
+
+// required fixed64 get_segments_to_clean_ticks = 19;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_get_segments_to_clean_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_get_segments_to_clean_ticks() const {
+  return _internal_has_get_segments_to_clean_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_get_segments_to_clean_ticks() {
+  _impl_.get_segments_to_clean_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_get_segments_to_clean_ticks() const {
+  return _impl_.get_segments_to_clean_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::get_segments_to_clean_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.get_segments_to_clean_ticks)
+  return _internal_get_segments_to_clean_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_get_segments_to_clean_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.get_segments_to_clean_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_get_segments_to_clean_ticks(uint64_t value) {
+  _internal_set_get_segments_to_clean_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.get_segments_to_clean_ticks)
+}
+
+// required fixed64 cost_benefit_sort_ticks = 20;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_cost_benefit_sort_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_cost_benefit_sort_ticks() const {
+  return _internal_has_cost_benefit_sort_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_cost_benefit_sort_ticks() {
+  _impl_.cost_benefit_sort_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_cost_benefit_sort_ticks() const {
+  return _impl_.cost_benefit_sort_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::cost_benefit_sort_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cost_benefit_sort_ticks)
+  return _internal_cost_benefit_sort_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_cost_benefit_sort_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.cost_benefit_sort_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_cost_benefit_sort_ticks(uint64_t value) {
+  _internal_set_cost_benefit_sort_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cost_benefit_sort_ticks)
+}
+
+// required fixed64 get_sorted_entries_ticks = 21;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_get_sorted_entries_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_get_sorted_entries_ticks() const {
+  return _internal_has_get_sorted_entries_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_get_sorted_entries_ticks() {
+  _impl_.get_sorted_entries_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_get_sorted_entries_ticks() const {
+  return _impl_.get_sorted_entries_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::get_sorted_entries_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.get_sorted_entries_ticks)
+  return _internal_get_sorted_entries_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_get_sorted_entries_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.get_sorted_entries_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_get_sorted_entries_ticks(uint64_t value) {
+  _internal_set_get_sorted_entries_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.get_sorted_entries_ticks)
+}
+
+// required fixed64 timestamp_sort_ticks = 22;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_timestamp_sort_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_timestamp_sort_ticks() const {
+  return _internal_has_timestamp_sort_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_timestamp_sort_ticks() {
+  _impl_.timestamp_sort_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_timestamp_sort_ticks() const {
+  return _impl_.timestamp_sort_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::timestamp_sort_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.timestamp_sort_ticks)
+  return _internal_timestamp_sort_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_timestamp_sort_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.timestamp_sort_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_timestamp_sort_ticks(uint64_t value) {
+  _internal_set_timestamp_sort_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.timestamp_sort_ticks)
+}
+
+// required fixed64 relocate_live_entries_ticks = 23;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_relocate_live_entries_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_relocate_live_entries_ticks() const {
+  return _internal_has_relocate_live_entries_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_relocate_live_entries_ticks() {
+  _impl_.relocate_live_entries_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00200000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_relocate_live_entries_ticks() const {
+  return _impl_.relocate_live_entries_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::relocate_live_entries_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.relocate_live_entries_ticks)
+  return _internal_relocate_live_entries_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_relocate_live_entries_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.relocate_live_entries_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_relocate_live_entries_ticks(uint64_t value) {
+  _internal_set_relocate_live_entries_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.relocate_live_entries_ticks)
+}
+
+// required fixed64 wait_for_free_survivors_ticks = 24;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_wait_for_free_survivors_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_wait_for_free_survivors_ticks() const {
+  return _internal_has_wait_for_free_survivors_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_wait_for_free_survivors_ticks() {
+  _impl_.wait_for_free_survivors_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00400000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_wait_for_free_survivors_ticks() const {
+  return _impl_.wait_for_free_survivors_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::wait_for_free_survivors_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.wait_for_free_survivors_ticks)
+  return _internal_wait_for_free_survivors_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_wait_for_free_survivors_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.wait_for_free_survivors_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_wait_for_free_survivors_ticks(uint64_t value) {
+  _internal_set_wait_for_free_survivors_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.wait_for_free_survivors_ticks)
+}
+
+// required fixed64 cleaning_complete_ticks = 25;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_cleaning_complete_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00800000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_cleaning_complete_ticks() const {
+  return _internal_has_cleaning_complete_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_cleaning_complete_ticks() {
+  _impl_.cleaning_complete_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00800000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_cleaning_complete_ticks() const {
+  return _impl_.cleaning_complete_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::cleaning_complete_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaning_complete_ticks)
+  return _internal_cleaning_complete_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_cleaning_complete_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00800000u;
+  _impl_.cleaning_complete_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_cleaning_complete_ticks(uint64_t value) {
+  _internal_set_cleaning_complete_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaning_complete_ticks)
+}
+
+// required fixed64 relocation_callback_ticks = 26;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_relocation_callback_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x01000000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_relocation_callback_ticks() const {
+  return _internal_has_relocation_callback_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_relocation_callback_ticks() {
+  _impl_.relocation_callback_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x01000000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_relocation_callback_ticks() const {
+  return _impl_.relocation_callback_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::relocation_callback_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.relocation_callback_ticks)
+  return _internal_relocation_callback_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_relocation_callback_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x01000000u;
+  _impl_.relocation_callback_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_relocation_callback_ticks(uint64_t value) {
+  _internal_set_relocation_callback_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.relocation_callback_ticks)
+}
+
+// required fixed64 relocation_append_ticks = 27;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_relocation_append_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x02000000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_relocation_append_ticks() const {
+  return _internal_has_relocation_append_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_relocation_append_ticks() {
+  _impl_.relocation_append_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x02000000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_relocation_append_ticks() const {
+  return _impl_.relocation_append_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::relocation_append_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.relocation_append_ticks)
+  return _internal_relocation_append_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_relocation_append_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x02000000u;
+  _impl_.relocation_append_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_relocation_append_ticks(uint64_t value) {
+  _internal_set_relocation_append_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.relocation_append_ticks)
+}
+
+// required fixed64 close_survivor_ticks = 28;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_close_survivor_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x04000000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_close_survivor_ticks() const {
+  return _internal_has_close_survivor_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_close_survivor_ticks() {
+  _impl_.close_survivor_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x04000000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_close_survivor_ticks() const {
+  return _impl_.close_survivor_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::close_survivor_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.close_survivor_ticks)
+  return _internal_close_survivor_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_close_survivor_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x04000000u;
+  _impl_.close_survivor_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_close_survivor_ticks(uint64_t value) {
+  _internal_set_close_survivor_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.close_survivor_ticks)
+}
+
+// required fixed64 survivor_sync_ticks = 29;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_survivor_sync_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x08000000u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_survivor_sync_ticks() const {
+  return _internal_has_survivor_sync_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::clear_survivor_sync_ticks() {
+  _impl_.survivor_sync_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x08000000u;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_survivor_sync_ticks() const {
+  return _impl_.survivor_sync_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics_OnDiskMetrics::survivor_sync_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.survivor_sync_ticks)
+  return _internal_survivor_sync_ticks();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_set_survivor_sync_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x08000000u;
+  _impl_.survivor_sync_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_survivor_sync_ticks(uint64_t value) {
+  _internal_set_survivor_sync_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.survivor_sync_ticks)
+}
+
+// required .RAMCloud.ProtoBuf.Histogram cleaned_segment_memory_histogram = 30;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_cleaned_segment_memory_histogram() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.cleaned_segment_memory_histogram_ != nullptr);
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_cleaned_segment_memory_histogram() const {
+  return _internal_has_cleaned_segment_memory_histogram();
+}
+inline const ::RAMCloud::ProtoBuf::Histogram& LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_cleaned_segment_memory_histogram() const {
+  const ::RAMCloud::ProtoBuf::Histogram* p = _impl_.cleaned_segment_memory_histogram_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::Histogram&>(
+      ::RAMCloud::ProtoBuf::_Histogram_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::Histogram& LogMetrics_CleanerMetrics_OnDiskMetrics::cleaned_segment_memory_histogram() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaned_segment_memory_histogram)
+  return _internal_cleaned_segment_memory_histogram();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::unsafe_arena_set_allocated_cleaned_segment_memory_histogram(
+    ::RAMCloud::ProtoBuf::Histogram* cleaned_segment_memory_histogram) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cleaned_segment_memory_histogram_);
+  }
+  _impl_.cleaned_segment_memory_histogram_ = cleaned_segment_memory_histogram;
+  if (cleaned_segment_memory_histogram) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaned_segment_memory_histogram)
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::release_cleaned_segment_memory_histogram() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::Histogram* temp = _impl_.cleaned_segment_memory_histogram_;
+  _impl_.cleaned_segment_memory_histogram_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::unsafe_arena_release_cleaned_segment_memory_histogram() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaned_segment_memory_histogram)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::Histogram* temp = _impl_.cleaned_segment_memory_histogram_;
+  _impl_.cleaned_segment_memory_histogram_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_mutable_cleaned_segment_memory_histogram() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.cleaned_segment_memory_histogram_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::Histogram>(GetArenaForAllocation());
+    _impl_.cleaned_segment_memory_histogram_ = p;
+  }
+  return _impl_.cleaned_segment_memory_histogram_;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::mutable_cleaned_segment_memory_histogram() {
+  ::RAMCloud::ProtoBuf::Histogram* _msg = _internal_mutable_cleaned_segment_memory_histogram();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaned_segment_memory_histogram)
+  return _msg;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_allocated_cleaned_segment_memory_histogram(::RAMCloud::ProtoBuf::Histogram* cleaned_segment_memory_histogram) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cleaned_segment_memory_histogram_);
+  }
+  if (cleaned_segment_memory_histogram) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cleaned_segment_memory_histogram));
+    if (message_arena != submessage_arena) {
+      cleaned_segment_memory_histogram = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cleaned_segment_memory_histogram, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.cleaned_segment_memory_histogram_ = cleaned_segment_memory_histogram;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaned_segment_memory_histogram)
+}
+
+// required .RAMCloud.ProtoBuf.Histogram cleaned_segment_disk_histogram = 31;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_cleaned_segment_disk_histogram() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.cleaned_segment_disk_histogram_ != nullptr);
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_cleaned_segment_disk_histogram() const {
+  return _internal_has_cleaned_segment_disk_histogram();
+}
+inline const ::RAMCloud::ProtoBuf::Histogram& LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_cleaned_segment_disk_histogram() const {
+  const ::RAMCloud::ProtoBuf::Histogram* p = _impl_.cleaned_segment_disk_histogram_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::Histogram&>(
+      ::RAMCloud::ProtoBuf::_Histogram_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::Histogram& LogMetrics_CleanerMetrics_OnDiskMetrics::cleaned_segment_disk_histogram() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaned_segment_disk_histogram)
+  return _internal_cleaned_segment_disk_histogram();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::unsafe_arena_set_allocated_cleaned_segment_disk_histogram(
+    ::RAMCloud::ProtoBuf::Histogram* cleaned_segment_disk_histogram) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cleaned_segment_disk_histogram_);
+  }
+  _impl_.cleaned_segment_disk_histogram_ = cleaned_segment_disk_histogram;
+  if (cleaned_segment_disk_histogram) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaned_segment_disk_histogram)
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::release_cleaned_segment_disk_histogram() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::Histogram* temp = _impl_.cleaned_segment_disk_histogram_;
+  _impl_.cleaned_segment_disk_histogram_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::unsafe_arena_release_cleaned_segment_disk_histogram() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaned_segment_disk_histogram)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::Histogram* temp = _impl_.cleaned_segment_disk_histogram_;
+  _impl_.cleaned_segment_disk_histogram_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_mutable_cleaned_segment_disk_histogram() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.cleaned_segment_disk_histogram_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::Histogram>(GetArenaForAllocation());
+    _impl_.cleaned_segment_disk_histogram_ = p;
+  }
+  return _impl_.cleaned_segment_disk_histogram_;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::mutable_cleaned_segment_disk_histogram() {
+  ::RAMCloud::ProtoBuf::Histogram* _msg = _internal_mutable_cleaned_segment_disk_histogram();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaned_segment_disk_histogram)
+  return _msg;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_allocated_cleaned_segment_disk_histogram(::RAMCloud::ProtoBuf::Histogram* cleaned_segment_disk_histogram) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cleaned_segment_disk_histogram_);
+  }
+  if (cleaned_segment_disk_histogram) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cleaned_segment_disk_histogram));
+    if (message_arena != submessage_arena) {
+      cleaned_segment_disk_histogram = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cleaned_segment_disk_histogram, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.cleaned_segment_disk_histogram_ = cleaned_segment_disk_histogram;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.cleaned_segment_disk_histogram)
+}
+
+// required .RAMCloud.ProtoBuf.Histogram all_segments_disk_histogram = 32;
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_has_all_segments_disk_histogram() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.all_segments_disk_histogram_ != nullptr);
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics_OnDiskMetrics::has_all_segments_disk_histogram() const {
+  return _internal_has_all_segments_disk_histogram();
+}
+inline const ::RAMCloud::ProtoBuf::Histogram& LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_all_segments_disk_histogram() const {
+  const ::RAMCloud::ProtoBuf::Histogram* p = _impl_.all_segments_disk_histogram_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::Histogram&>(
+      ::RAMCloud::ProtoBuf::_Histogram_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::Histogram& LogMetrics_CleanerMetrics_OnDiskMetrics::all_segments_disk_histogram() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.all_segments_disk_histogram)
+  return _internal_all_segments_disk_histogram();
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::unsafe_arena_set_allocated_all_segments_disk_histogram(
+    ::RAMCloud::ProtoBuf::Histogram* all_segments_disk_histogram) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.all_segments_disk_histogram_);
+  }
+  _impl_.all_segments_disk_histogram_ = all_segments_disk_histogram;
+  if (all_segments_disk_histogram) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.all_segments_disk_histogram)
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::release_all_segments_disk_histogram() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RAMCloud::ProtoBuf::Histogram* temp = _impl_.all_segments_disk_histogram_;
+  _impl_.all_segments_disk_histogram_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::unsafe_arena_release_all_segments_disk_histogram() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.all_segments_disk_histogram)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RAMCloud::ProtoBuf::Histogram* temp = _impl_.all_segments_disk_histogram_;
+  _impl_.all_segments_disk_histogram_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::_internal_mutable_all_segments_disk_histogram() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.all_segments_disk_histogram_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::Histogram>(GetArenaForAllocation());
+    _impl_.all_segments_disk_histogram_ = p;
+  }
+  return _impl_.all_segments_disk_histogram_;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_CleanerMetrics_OnDiskMetrics::mutable_all_segments_disk_histogram() {
+  ::RAMCloud::ProtoBuf::Histogram* _msg = _internal_mutable_all_segments_disk_histogram();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.all_segments_disk_histogram)
+  return _msg;
+}
+inline void LogMetrics_CleanerMetrics_OnDiskMetrics::set_allocated_all_segments_disk_histogram(::RAMCloud::ProtoBuf::Histogram* all_segments_disk_histogram) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.all_segments_disk_histogram_);
+  }
+  if (all_segments_disk_histogram) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(all_segments_disk_histogram));
+    if (message_arena != submessage_arena) {
+      all_segments_disk_histogram = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, all_segments_disk_histogram, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.all_segments_disk_histogram_ = all_segments_disk_histogram;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics.all_segments_disk_histogram)
+}
+
+// -------------------------------------------------------------------
+
+// LogMetrics_CleanerMetrics_ThreadMetrics
+
+// repeated fixed64 active_ticks = 1;
+inline int LogMetrics_CleanerMetrics_ThreadMetrics::_internal_active_ticks_size() const {
+  return _impl_.active_ticks_.size();
+}
+inline int LogMetrics_CleanerMetrics_ThreadMetrics::active_ticks_size() const {
+  return _internal_active_ticks_size();
+}
+inline void LogMetrics_CleanerMetrics_ThreadMetrics::clear_active_ticks() {
+  _impl_.active_ticks_.Clear();
+}
+inline uint64_t LogMetrics_CleanerMetrics_ThreadMetrics::_internal_active_ticks(int index) const {
+  return _impl_.active_ticks_.Get(index);
+}
+inline uint64_t LogMetrics_CleanerMetrics_ThreadMetrics::active_ticks(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics.active_ticks)
+  return _internal_active_ticks(index);
+}
+inline void LogMetrics_CleanerMetrics_ThreadMetrics::set_active_ticks(int index, uint64_t value) {
+  _impl_.active_ticks_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics.active_ticks)
+}
+inline void LogMetrics_CleanerMetrics_ThreadMetrics::_internal_add_active_ticks(uint64_t value) {
+  _impl_.active_ticks_.Add(value);
+}
+inline void LogMetrics_CleanerMetrics_ThreadMetrics::add_active_ticks(uint64_t value) {
+  _internal_add_active_ticks(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics.active_ticks)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_ThreadMetrics::_internal_active_ticks() const {
+  return _impl_.active_ticks_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_CleanerMetrics_ThreadMetrics::active_ticks() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics.active_ticks)
+  return _internal_active_ticks();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_ThreadMetrics::_internal_mutable_active_ticks() {
+  return &_impl_.active_ticks_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_CleanerMetrics_ThreadMetrics::mutable_active_ticks() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics.active_ticks)
+  return _internal_mutable_active_ticks();
+}
+
+// -------------------------------------------------------------------
+
+// LogMetrics_CleanerMetrics
+
+// required fixed32 poll_usec = 1;
+inline bool LogMetrics_CleanerMetrics::_internal_has_poll_usec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_poll_usec() const {
+  return _internal_has_poll_usec();
+}
+inline void LogMetrics_CleanerMetrics::clear_poll_usec() {
+  _impl_.poll_usec_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t LogMetrics_CleanerMetrics::_internal_poll_usec() const {
+  return _impl_.poll_usec_;
+}
+inline uint32_t LogMetrics_CleanerMetrics::poll_usec() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.poll_usec)
+  return _internal_poll_usec();
+}
+inline void LogMetrics_CleanerMetrics::_internal_set_poll_usec(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.poll_usec_ = value;
+}
+inline void LogMetrics_CleanerMetrics::set_poll_usec(uint32_t value) {
+  _internal_set_poll_usec(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.poll_usec)
+}
+
+// required fixed32 max_cleanable_memory_utilization = 2;
+inline bool LogMetrics_CleanerMetrics::_internal_has_max_cleanable_memory_utilization() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_max_cleanable_memory_utilization() const {
+  return _internal_has_max_cleanable_memory_utilization();
+}
+inline void LogMetrics_CleanerMetrics::clear_max_cleanable_memory_utilization() {
+  _impl_.max_cleanable_memory_utilization_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t LogMetrics_CleanerMetrics::_internal_max_cleanable_memory_utilization() const {
+  return _impl_.max_cleanable_memory_utilization_;
+}
+inline uint32_t LogMetrics_CleanerMetrics::max_cleanable_memory_utilization() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.max_cleanable_memory_utilization)
+  return _internal_max_cleanable_memory_utilization();
+}
+inline void LogMetrics_CleanerMetrics::_internal_set_max_cleanable_memory_utilization(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.max_cleanable_memory_utilization_ = value;
+}
+inline void LogMetrics_CleanerMetrics::set_max_cleanable_memory_utilization(uint32_t value) {
+  _internal_set_max_cleanable_memory_utilization(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.max_cleanable_memory_utilization)
+}
+
+// required fixed32 live_segments_per_disk_pass = 3;
+inline bool LogMetrics_CleanerMetrics::_internal_has_live_segments_per_disk_pass() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_live_segments_per_disk_pass() const {
+  return _internal_has_live_segments_per_disk_pass();
+}
+inline void LogMetrics_CleanerMetrics::clear_live_segments_per_disk_pass() {
+  _impl_.live_segments_per_disk_pass_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t LogMetrics_CleanerMetrics::_internal_live_segments_per_disk_pass() const {
+  return _impl_.live_segments_per_disk_pass_;
+}
+inline uint32_t LogMetrics_CleanerMetrics::live_segments_per_disk_pass() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.live_segments_per_disk_pass)
+  return _internal_live_segments_per_disk_pass();
+}
+inline void LogMetrics_CleanerMetrics::_internal_set_live_segments_per_disk_pass(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.live_segments_per_disk_pass_ = value;
+}
+inline void LogMetrics_CleanerMetrics::set_live_segments_per_disk_pass(uint32_t value) {
+  _internal_set_live_segments_per_disk_pass(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.live_segments_per_disk_pass)
+}
+
+// required fixed32 survivor_segments_to_reserve = 4;
+inline bool LogMetrics_CleanerMetrics::_internal_has_survivor_segments_to_reserve() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_survivor_segments_to_reserve() const {
+  return _internal_has_survivor_segments_to_reserve();
+}
+inline void LogMetrics_CleanerMetrics::clear_survivor_segments_to_reserve() {
+  _impl_.survivor_segments_to_reserve_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t LogMetrics_CleanerMetrics::_internal_survivor_segments_to_reserve() const {
+  return _impl_.survivor_segments_to_reserve_;
+}
+inline uint32_t LogMetrics_CleanerMetrics::survivor_segments_to_reserve() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.survivor_segments_to_reserve)
+  return _internal_survivor_segments_to_reserve();
+}
+inline void LogMetrics_CleanerMetrics::_internal_set_survivor_segments_to_reserve(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.survivor_segments_to_reserve_ = value;
+}
+inline void LogMetrics_CleanerMetrics::set_survivor_segments_to_reserve(uint32_t value) {
+  _internal_set_survivor_segments_to_reserve(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.survivor_segments_to_reserve)
+}
+
+// required fixed32 min_memory_utilization = 5;
+inline bool LogMetrics_CleanerMetrics::_internal_has_min_memory_utilization() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_min_memory_utilization() const {
+  return _internal_has_min_memory_utilization();
+}
+inline void LogMetrics_CleanerMetrics::clear_min_memory_utilization() {
+  _impl_.min_memory_utilization_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t LogMetrics_CleanerMetrics::_internal_min_memory_utilization() const {
+  return _impl_.min_memory_utilization_;
+}
+inline uint32_t LogMetrics_CleanerMetrics::min_memory_utilization() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.min_memory_utilization)
+  return _internal_min_memory_utilization();
+}
+inline void LogMetrics_CleanerMetrics::_internal_set_min_memory_utilization(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.min_memory_utilization_ = value;
+}
+inline void LogMetrics_CleanerMetrics::set_min_memory_utilization(uint32_t value) {
+  _internal_set_min_memory_utilization(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.min_memory_utilization)
+}
+
+// required fixed32 min_disk_utilization = 6;
+inline bool LogMetrics_CleanerMetrics::_internal_has_min_disk_utilization() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_min_disk_utilization() const {
+  return _internal_has_min_disk_utilization();
+}
+inline void LogMetrics_CleanerMetrics::clear_min_disk_utilization() {
+  _impl_.min_disk_utilization_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t LogMetrics_CleanerMetrics::_internal_min_disk_utilization() const {
+  return _impl_.min_disk_utilization_;
+}
+inline uint32_t LogMetrics_CleanerMetrics::min_disk_utilization() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.min_disk_utilization)
+  return _internal_min_disk_utilization();
+}
+inline void LogMetrics_CleanerMetrics::_internal_set_min_disk_utilization(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.min_disk_utilization_ = value;
+}
+inline void LogMetrics_CleanerMetrics::set_min_disk_utilization(uint32_t value) {
+  _internal_set_min_disk_utilization(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.min_disk_utilization)
+}
+
+// required fixed64 do_work_ticks = 7;
+inline bool LogMetrics_CleanerMetrics::_internal_has_do_work_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_do_work_ticks() const {
+  return _internal_has_do_work_ticks();
+}
+inline void LogMetrics_CleanerMetrics::clear_do_work_ticks() {
+  _impl_.do_work_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint64_t LogMetrics_CleanerMetrics::_internal_do_work_ticks() const {
+  return _impl_.do_work_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics::do_work_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.do_work_ticks)
+  return _internal_do_work_ticks();
+}
+inline void LogMetrics_CleanerMetrics::_internal_set_do_work_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.do_work_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics::set_do_work_ticks(uint64_t value) {
+  _internal_set_do_work_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.do_work_ticks)
+}
+
+// required fixed64 do_work_sleep_ticks = 8;
+inline bool LogMetrics_CleanerMetrics::_internal_has_do_work_sleep_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_do_work_sleep_ticks() const {
+  return _internal_has_do_work_sleep_ticks();
+}
+inline void LogMetrics_CleanerMetrics::clear_do_work_sleep_ticks() {
+  _impl_.do_work_sleep_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint64_t LogMetrics_CleanerMetrics::_internal_do_work_sleep_ticks() const {
+  return _impl_.do_work_sleep_ticks_;
+}
+inline uint64_t LogMetrics_CleanerMetrics::do_work_sleep_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.do_work_sleep_ticks)
+  return _internal_do_work_sleep_ticks();
+}
+inline void LogMetrics_CleanerMetrics::_internal_set_do_work_sleep_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.do_work_sleep_ticks_ = value;
+}
+inline void LogMetrics_CleanerMetrics::set_do_work_sleep_ticks(uint64_t value) {
+  _internal_set_do_work_sleep_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.do_work_sleep_ticks)
+}
+
+// required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.InMemoryMetrics in_memory_metrics = 9;
+inline bool LogMetrics_CleanerMetrics::_internal_has_in_memory_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.in_memory_metrics_ != nullptr);
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_in_memory_metrics() const {
+  return _internal_has_in_memory_metrics();
+}
+inline void LogMetrics_CleanerMetrics::clear_in_memory_metrics() {
+  if (_impl_.in_memory_metrics_ != nullptr) _impl_.in_memory_metrics_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics& LogMetrics_CleanerMetrics::_internal_in_memory_metrics() const {
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* p = _impl_.in_memory_metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics&>(
+      ::RAMCloud::ProtoBuf::_LogMetrics_CleanerMetrics_InMemoryMetrics_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics& LogMetrics_CleanerMetrics::in_memory_metrics() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.in_memory_metrics)
+  return _internal_in_memory_metrics();
+}
+inline void LogMetrics_CleanerMetrics::unsafe_arena_set_allocated_in_memory_metrics(
+    ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* in_memory_metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.in_memory_metrics_);
+  }
+  _impl_.in_memory_metrics_ = in_memory_metrics;
+  if (in_memory_metrics) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.in_memory_metrics)
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* LogMetrics_CleanerMetrics::release_in_memory_metrics() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* temp = _impl_.in_memory_metrics_;
+  _impl_.in_memory_metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* LogMetrics_CleanerMetrics::unsafe_arena_release_in_memory_metrics() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.in_memory_metrics)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* temp = _impl_.in_memory_metrics_;
+  _impl_.in_memory_metrics_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* LogMetrics_CleanerMetrics::_internal_mutable_in_memory_metrics() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.in_memory_metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics>(GetArenaForAllocation());
+    _impl_.in_memory_metrics_ = p;
+  }
+  return _impl_.in_memory_metrics_;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* LogMetrics_CleanerMetrics::mutable_in_memory_metrics() {
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* _msg = _internal_mutable_in_memory_metrics();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.in_memory_metrics)
+  return _msg;
+}
+inline void LogMetrics_CleanerMetrics::set_allocated_in_memory_metrics(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_InMemoryMetrics* in_memory_metrics) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.in_memory_metrics_;
+  }
+  if (in_memory_metrics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(in_memory_metrics);
+    if (message_arena != submessage_arena) {
+      in_memory_metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, in_memory_metrics, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.in_memory_metrics_ = in_memory_metrics;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.in_memory_metrics)
+}
+
+// required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.OnDiskMetrics on_disk_metrics = 10;
+inline bool LogMetrics_CleanerMetrics::_internal_has_on_disk_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.on_disk_metrics_ != nullptr);
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_on_disk_metrics() const {
+  return _internal_has_on_disk_metrics();
+}
+inline void LogMetrics_CleanerMetrics::clear_on_disk_metrics() {
+  if (_impl_.on_disk_metrics_ != nullptr) _impl_.on_disk_metrics_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics& LogMetrics_CleanerMetrics::_internal_on_disk_metrics() const {
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* p = _impl_.on_disk_metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics&>(
+      ::RAMCloud::ProtoBuf::_LogMetrics_CleanerMetrics_OnDiskMetrics_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics& LogMetrics_CleanerMetrics::on_disk_metrics() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.on_disk_metrics)
+  return _internal_on_disk_metrics();
+}
+inline void LogMetrics_CleanerMetrics::unsafe_arena_set_allocated_on_disk_metrics(
+    ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* on_disk_metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.on_disk_metrics_);
+  }
+  _impl_.on_disk_metrics_ = on_disk_metrics;
+  if (on_disk_metrics) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.on_disk_metrics)
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* LogMetrics_CleanerMetrics::release_on_disk_metrics() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* temp = _impl_.on_disk_metrics_;
+  _impl_.on_disk_metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* LogMetrics_CleanerMetrics::unsafe_arena_release_on_disk_metrics() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.on_disk_metrics)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* temp = _impl_.on_disk_metrics_;
+  _impl_.on_disk_metrics_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* LogMetrics_CleanerMetrics::_internal_mutable_on_disk_metrics() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.on_disk_metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics>(GetArenaForAllocation());
+    _impl_.on_disk_metrics_ = p;
+  }
+  return _impl_.on_disk_metrics_;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* LogMetrics_CleanerMetrics::mutable_on_disk_metrics() {
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* _msg = _internal_mutable_on_disk_metrics();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.on_disk_metrics)
+  return _msg;
+}
+inline void LogMetrics_CleanerMetrics::set_allocated_on_disk_metrics(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_OnDiskMetrics* on_disk_metrics) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.on_disk_metrics_;
+  }
+  if (on_disk_metrics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(on_disk_metrics);
+    if (message_arena != submessage_arena) {
+      on_disk_metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, on_disk_metrics, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.on_disk_metrics_ = on_disk_metrics;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.on_disk_metrics)
+}
+
+// required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.ThreadMetrics thread_metrics = 11;
+inline bool LogMetrics_CleanerMetrics::_internal_has_thread_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.thread_metrics_ != nullptr);
+  return value;
+}
+inline bool LogMetrics_CleanerMetrics::has_thread_metrics() const {
+  return _internal_has_thread_metrics();
+}
+inline void LogMetrics_CleanerMetrics::clear_thread_metrics() {
+  if (_impl_.thread_metrics_ != nullptr) _impl_.thread_metrics_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics& LogMetrics_CleanerMetrics::_internal_thread_metrics() const {
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* p = _impl_.thread_metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics&>(
+      ::RAMCloud::ProtoBuf::_LogMetrics_CleanerMetrics_ThreadMetrics_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics& LogMetrics_CleanerMetrics::thread_metrics() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.thread_metrics)
+  return _internal_thread_metrics();
+}
+inline void LogMetrics_CleanerMetrics::unsafe_arena_set_allocated_thread_metrics(
+    ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* thread_metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.thread_metrics_);
+  }
+  _impl_.thread_metrics_ = thread_metrics;
+  if (thread_metrics) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.thread_metrics)
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* LogMetrics_CleanerMetrics::release_thread_metrics() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* temp = _impl_.thread_metrics_;
+  _impl_.thread_metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* LogMetrics_CleanerMetrics::unsafe_arena_release_thread_metrics() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.thread_metrics)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* temp = _impl_.thread_metrics_;
+  _impl_.thread_metrics_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* LogMetrics_CleanerMetrics::_internal_mutable_thread_metrics() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.thread_metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics>(GetArenaForAllocation());
+    _impl_.thread_metrics_ = p;
+  }
+  return _impl_.thread_metrics_;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* LogMetrics_CleanerMetrics::mutable_thread_metrics() {
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* _msg = _internal_mutable_thread_metrics();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.thread_metrics)
+  return _msg;
+}
+inline void LogMetrics_CleanerMetrics::set_allocated_thread_metrics(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics_ThreadMetrics* thread_metrics) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.thread_metrics_;
+  }
+  if (thread_metrics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(thread_metrics);
+    if (message_arena != submessage_arena) {
+      thread_metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, thread_metrics, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.thread_metrics_ = thread_metrics;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics.thread_metrics)
+}
+
+// -------------------------------------------------------------------
+
+// LogMetrics_SegletMetrics
+
+// required fixed64 total_seglets = 1;
+inline bool LogMetrics_SegletMetrics::_internal_has_total_seglets() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LogMetrics_SegletMetrics::has_total_seglets() const {
+  return _internal_has_total_seglets();
+}
+inline void LogMetrics_SegletMetrics::clear_total_seglets() {
+  _impl_.total_seglets_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_total_seglets() const {
+  return _impl_.total_seglets_;
+}
+inline uint64_t LogMetrics_SegletMetrics::total_seglets() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.total_seglets)
+  return _internal_total_seglets();
+}
+inline void LogMetrics_SegletMetrics::_internal_set_total_seglets(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.total_seglets_ = value;
+}
+inline void LogMetrics_SegletMetrics::set_total_seglets(uint64_t value) {
+  _internal_set_total_seglets(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.total_seglets)
+}
+
+// required fixed64 total_usable_seglets = 2;
+inline bool LogMetrics_SegletMetrics::_internal_has_total_usable_seglets() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LogMetrics_SegletMetrics::has_total_usable_seglets() const {
+  return _internal_has_total_usable_seglets();
+}
+inline void LogMetrics_SegletMetrics::clear_total_usable_seglets() {
+  _impl_.total_usable_seglets_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_total_usable_seglets() const {
+  return _impl_.total_usable_seglets_;
+}
+inline uint64_t LogMetrics_SegletMetrics::total_usable_seglets() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.total_usable_seglets)
+  return _internal_total_usable_seglets();
+}
+inline void LogMetrics_SegletMetrics::_internal_set_total_usable_seglets(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.total_usable_seglets_ = value;
+}
+inline void LogMetrics_SegletMetrics::set_total_usable_seglets(uint64_t value) {
+  _internal_set_total_usable_seglets(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.total_usable_seglets)
+}
+
+// required fixed64 emergency_head_pool_reserve = 3;
+inline bool LogMetrics_SegletMetrics::_internal_has_emergency_head_pool_reserve() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool LogMetrics_SegletMetrics::has_emergency_head_pool_reserve() const {
+  return _internal_has_emergency_head_pool_reserve();
+}
+inline void LogMetrics_SegletMetrics::clear_emergency_head_pool_reserve() {
+  _impl_.emergency_head_pool_reserve_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_emergency_head_pool_reserve() const {
+  return _impl_.emergency_head_pool_reserve_;
+}
+inline uint64_t LogMetrics_SegletMetrics::emergency_head_pool_reserve() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.emergency_head_pool_reserve)
+  return _internal_emergency_head_pool_reserve();
+}
+inline void LogMetrics_SegletMetrics::_internal_set_emergency_head_pool_reserve(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.emergency_head_pool_reserve_ = value;
+}
+inline void LogMetrics_SegletMetrics::set_emergency_head_pool_reserve(uint64_t value) {
+  _internal_set_emergency_head_pool_reserve(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.emergency_head_pool_reserve)
+}
+
+// required fixed64 emergency_head_pool_count = 4;
+inline bool LogMetrics_SegletMetrics::_internal_has_emergency_head_pool_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool LogMetrics_SegletMetrics::has_emergency_head_pool_count() const {
+  return _internal_has_emergency_head_pool_count();
+}
+inline void LogMetrics_SegletMetrics::clear_emergency_head_pool_count() {
+  _impl_.emergency_head_pool_count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_emergency_head_pool_count() const {
+  return _impl_.emergency_head_pool_count_;
+}
+inline uint64_t LogMetrics_SegletMetrics::emergency_head_pool_count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.emergency_head_pool_count)
+  return _internal_emergency_head_pool_count();
+}
+inline void LogMetrics_SegletMetrics::_internal_set_emergency_head_pool_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.emergency_head_pool_count_ = value;
+}
+inline void LogMetrics_SegletMetrics::set_emergency_head_pool_count(uint64_t value) {
+  _internal_set_emergency_head_pool_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.emergency_head_pool_count)
+}
+
+// required fixed64 cleaner_pool_reserve = 5;
+inline bool LogMetrics_SegletMetrics::_internal_has_cleaner_pool_reserve() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool LogMetrics_SegletMetrics::has_cleaner_pool_reserve() const {
+  return _internal_has_cleaner_pool_reserve();
+}
+inline void LogMetrics_SegletMetrics::clear_cleaner_pool_reserve() {
+  _impl_.cleaner_pool_reserve_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_cleaner_pool_reserve() const {
+  return _impl_.cleaner_pool_reserve_;
+}
+inline uint64_t LogMetrics_SegletMetrics::cleaner_pool_reserve() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.cleaner_pool_reserve)
+  return _internal_cleaner_pool_reserve();
+}
+inline void LogMetrics_SegletMetrics::_internal_set_cleaner_pool_reserve(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.cleaner_pool_reserve_ = value;
+}
+inline void LogMetrics_SegletMetrics::set_cleaner_pool_reserve(uint64_t value) {
+  _internal_set_cleaner_pool_reserve(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.cleaner_pool_reserve)
+}
+
+// required fixed64 cleaner_pool_count = 6;
+inline bool LogMetrics_SegletMetrics::_internal_has_cleaner_pool_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool LogMetrics_SegletMetrics::has_cleaner_pool_count() const {
+  return _internal_has_cleaner_pool_count();
+}
+inline void LogMetrics_SegletMetrics::clear_cleaner_pool_count() {
+  _impl_.cleaner_pool_count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_cleaner_pool_count() const {
+  return _impl_.cleaner_pool_count_;
+}
+inline uint64_t LogMetrics_SegletMetrics::cleaner_pool_count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.cleaner_pool_count)
+  return _internal_cleaner_pool_count();
+}
+inline void LogMetrics_SegletMetrics::_internal_set_cleaner_pool_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.cleaner_pool_count_ = value;
+}
+inline void LogMetrics_SegletMetrics::set_cleaner_pool_count(uint64_t value) {
+  _internal_set_cleaner_pool_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.cleaner_pool_count)
+}
+
+// required fixed64 default_pool_count = 7;
+inline bool LogMetrics_SegletMetrics::_internal_has_default_pool_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool LogMetrics_SegletMetrics::has_default_pool_count() const {
+  return _internal_has_default_pool_count();
+}
+inline void LogMetrics_SegletMetrics::clear_default_pool_count() {
+  _impl_.default_pool_count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_default_pool_count() const {
+  return _impl_.default_pool_count_;
+}
+inline uint64_t LogMetrics_SegletMetrics::default_pool_count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.default_pool_count)
+  return _internal_default_pool_count();
+}
+inline void LogMetrics_SegletMetrics::_internal_set_default_pool_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.default_pool_count_ = value;
+}
+inline void LogMetrics_SegletMetrics::set_default_pool_count(uint64_t value) {
+  _internal_set_default_pool_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.default_pool_count)
+}
+
+// repeated fixed64 node_seglets = 8;
+inline int LogMetrics_SegletMetrics::_internal_node_seglets_size() const {
+  return _impl_.node_seglets_.size();
+}
+inline int LogMetrics_SegletMetrics::node_seglets_size() const {
+  return _internal_node_seglets_size();
+}
+inline void LogMetrics_SegletMetrics::clear_node_seglets() {
+  _impl_.node_seglets_.Clear();
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_node_seglets(int index) const {
+  return _impl_.node_seglets_.Get(index);
+}
+inline uint64_t LogMetrics_SegletMetrics::node_seglets(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.node_seglets)
+  return _internal_node_seglets(index);
+}
+inline void LogMetrics_SegletMetrics::set_node_seglets(int index, uint64_t value) {
+  _impl_.node_seglets_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.node_seglets)
+}
+inline void LogMetrics_SegletMetrics::_internal_add_node_seglets(uint64_t value) {
+  _impl_.node_seglets_.Add(value);
+}
+inline void LogMetrics_SegletMetrics::add_node_seglets(uint64_t value) {
+  _internal_add_node_seglets(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.node_seglets)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_SegletMetrics::_internal_node_seglets() const {
+  return _impl_.node_seglets_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_SegletMetrics::node_seglets() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.node_seglets)
+  return _internal_node_seglets();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_SegletMetrics::_internal_mutable_node_seglets() {
+  return &_impl_.node_seglets_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_SegletMetrics::mutable_node_seglets() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.node_seglets)
+  return _internal_mutable_node_seglets();
+}
+
+// repeated fixed64 node_default_pool_count = 9;
+inline int LogMetrics_SegletMetrics::_internal_node_default_pool_count_size() const {
+  return _impl_.node_default_pool_count_.size();
+}
+inline int LogMetrics_SegletMetrics::node_default_pool_count_size() const {
+  return _internal_node_default_pool_count_size();
+}
+inline void LogMetrics_SegletMetrics::clear_node_default_pool_count() {
+  _impl_.node_default_pool_count_.Clear();
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_node_default_pool_count(int index) const {
+  return _impl_.node_default_pool_count_.Get(index);
+}
+inline uint64_t LogMetrics_SegletMetrics::node_default_pool_count(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.node_default_pool_count)
+  return _internal_node_default_pool_count(index);
+}
+inline void LogMetrics_SegletMetrics::set_node_default_pool_count(int index, uint64_t value) {
+  _impl_.node_default_pool_count_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.node_default_pool_count)
+}
+inline void LogMetrics_SegletMetrics::_internal_add_node_default_pool_count(uint64_t value) {
+  _impl_.node_default_pool_count_.Add(value);
+}
+inline void LogMetrics_SegletMetrics::add_node_default_pool_count(uint64_t value) {
+  _internal_add_node_default_pool_count(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.node_default_pool_count)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_SegletMetrics::_internal_node_default_pool_count() const {
+  return _impl_.node_default_pool_count_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_SegletMetrics::node_default_pool_count() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.node_default_pool_count)
+  return _internal_node_default_pool_count();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_SegletMetrics::_internal_mutable_node_default_pool_count() {
+  return &_impl_.node_default_pool_count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_SegletMetrics::mutable_node_default_pool_count() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.node_default_pool_count)
+  return _internal_mutable_node_default_pool_count();
+}
+
+// required fixed64 cold_seglets = 10;
+inline bool LogMetrics_SegletMetrics::_internal_has_cold_seglets() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool LogMetrics_SegletMetrics::has_cold_seglets() const {
+  return _internal_has_cold_seglets();
+}
+inline void LogMetrics_SegletMetrics::clear_cold_seglets() {
+  _impl_.cold_seglets_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_cold_seglets() const {
+  return _impl_.cold_seglets_;
+}
+inline uint64_t LogMetrics_SegletMetrics::cold_seglets() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.cold_seglets)
+  return _internal_cold_seglets();
+}
+inline void LogMetrics_SegletMetrics::_internal_set_cold_seglets(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.cold_seglets_ = value;
+}
+inline void LogMetrics_SegletMetrics::set_cold_seglets(uint64_t value) {
+  _internal_set_cold_seglets(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.cold_seglets)
+}
+
+// required fixed64 cold_pool_count = 11;
+inline bool LogMetrics_SegletMetrics::_internal_has_cold_pool_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool LogMetrics_SegletMetrics::has_cold_pool_count() const {
+  return _internal_has_cold_pool_count();
+}
+inline void LogMetrics_SegletMetrics::clear_cold_pool_count() {
+  _impl_.cold_pool_count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t LogMetrics_SegletMetrics::_internal_cold_pool_count() const {
+  return _impl_.cold_pool_count_;
+}
+inline uint64_t LogMetrics_SegletMetrics::cold_pool_count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.cold_pool_count)
+  return _internal_cold_pool_count();
+}
+inline void LogMetrics_SegletMetrics::_internal_set_cold_pool_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.cold_pool_count_ = value;
+}
+inline void LogMetrics_SegletMetrics::set_cold_pool_count(uint64_t value) {
+  _internal_set_cold_pool_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegletMetrics.cold_pool_count)
+}
+
+// -------------------------------------------------------------------
+
+// LogMetrics_SegmentMetrics
+
+// required .RAMCloud.ProtoBuf.Histogram segments_on_disk_histogram = 1;
+inline bool LogMetrics_SegmentMetrics::_internal_has_segments_on_disk_histogram() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.segments_on_disk_histogram_ != nullptr);
+  return value;
+}
+inline bool LogMetrics_SegmentMetrics::has_segments_on_disk_histogram() const {
+  return _internal_has_segments_on_disk_histogram();
+}
+inline const ::RAMCloud::ProtoBuf::Histogram& LogMetrics_SegmentMetrics::_internal_segments_on_disk_histogram() const {
+  const ::RAMCloud::ProtoBuf::Histogram* p = _impl_.segments_on_disk_histogram_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::Histogram&>(
+      ::RAMCloud::ProtoBuf::_Histogram_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::Histogram& LogMetrics_SegmentMetrics::segments_on_disk_histogram() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.segments_on_disk_histogram)
+  return _internal_segments_on_disk_histogram();
+}
+inline void LogMetrics_SegmentMetrics::unsafe_arena_set_allocated_segments_on_disk_histogram(
+    ::RAMCloud::ProtoBuf::Histogram* segments_on_disk_histogram) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.segments_on_disk_histogram_);
+  }
+  _impl_.segments_on_disk_histogram_ = segments_on_disk_histogram;
+  if (segments_on_disk_histogram) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.segments_on_disk_histogram)
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_SegmentMetrics::release_segments_on_disk_histogram() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::Histogram* temp = _impl_.segments_on_disk_histogram_;
+  _impl_.segments_on_disk_histogram_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_SegmentMetrics::unsafe_arena_release_segments_on_disk_histogram() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.segments_on_disk_histogram)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::Histogram* temp = _impl_.segments_on_disk_histogram_;
+  _impl_.segments_on_disk_histogram_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_SegmentMetrics::_internal_mutable_segments_on_disk_histogram() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.segments_on_disk_histogram_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::Histogram>(GetArenaForAllocation());
+    _impl_.segments_on_disk_histogram_ = p;
+  }
+  return _impl_.segments_on_disk_histogram_;
+}
+inline ::RAMCloud::ProtoBuf::Histogram* LogMetrics_SegmentMetrics::mutable_segments_on_disk_histogram() {
+  ::RAMCloud::ProtoBuf::Histogram* _msg = _internal_mutable_segments_on_disk_histogram();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.segments_on_disk_histogram)
+  return _msg;
+}
+inline void LogMetrics_SegmentMetrics::set_allocated_segments_on_disk_histogram(::RAMCloud::ProtoBuf::Histogram* segments_on_disk_histogram) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.segments_on_disk_histogram_);
+  }
+  if (segments_on_disk_histogram) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(segments_on_disk_histogram));
+    if (message_arena != submessage_arena) {
+      segments_on_disk_histogram = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, segments_on_disk_histogram, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.segments_on_disk_histogram_ = segments_on_disk_histogram;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.segments_on_disk_histogram)
+}
+
+// required fixed64 current_segments_on_disk = 2;
+inline bool LogMetrics_SegmentMetrics::_internal_has_current_segments_on_disk() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LogMetrics_SegmentMetrics::has_current_segments_on_disk() const {
+  return _internal_has_current_segments_on_disk();
+}
+inline void LogMetrics_SegmentMetrics::clear_current_segments_on_disk() {
+  _impl_.current_segments_on_disk_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t LogMetrics_SegmentMetrics::_internal_current_segments_on_disk() const {
+  return _impl_.current_segments_on_disk_;
+}
+inline uint64_t LogMetrics_SegmentMetrics::current_segments_on_disk() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.current_segments_on_disk)
+  return _internal_current_segments_on_disk();
+}
+inline void LogMetrics_SegmentMetrics::_internal_set_current_segments_on_disk(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.current_segments_on_disk_ = value;
+}
+inline void LogMetrics_SegmentMetrics::set_current_segments_on_disk(uint64_t value) {
+  _internal_set_current_segments_on_disk(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.current_segments_on_disk)
+}
+
+// repeated fixed64 total_entry_counts = 3;
+inline int LogMetrics_SegmentMetrics::_internal_total_entry_counts_size() const {
+  return _impl_.total_entry_counts_.size();
+}
+inline int LogMetrics_SegmentMetrics::total_entry_counts_size() const {
+  return _internal_total_entry_counts_size();
+}
+inline void LogMetrics_SegmentMetrics::clear_total_entry_counts() {
+  _impl_.total_entry_counts_.Clear();
+}
+inline uint64_t LogMetrics_SegmentMetrics::_internal_total_entry_counts(int index) const {
+  return _impl_.total_entry_counts_.Get(index);
+}
+inline uint64_t LogMetrics_SegmentMetrics::total_entry_counts(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.total_entry_counts)
+  return _internal_total_entry_counts(index);
+}
+inline void LogMetrics_SegmentMetrics::set_total_entry_counts(int index, uint64_t value) {
+  _impl_.total_entry_counts_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.total_entry_counts)
+}
+inline void LogMetrics_SegmentMetrics::_internal_add_total_entry_counts(uint64_t value) {
+  _impl_.total_entry_counts_.Add(value);
+}
+inline void LogMetrics_SegmentMetrics::add_total_entry_counts(uint64_t value) {
+  _internal_add_total_entry_counts(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.total_entry_counts)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_SegmentMetrics::_internal_total_entry_counts() const {
+  return _impl_.total_entry_counts_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_SegmentMetrics::total_entry_counts() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.total_entry_counts)
+  return _internal_total_entry_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_SegmentMetrics::_internal_mutable_total_entry_counts() {
+  return &_impl_.total_entry_counts_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_SegmentMetrics::mutable_total_entry_counts() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.total_entry_counts)
+  return _internal_mutable_total_entry_counts();
+}
+
+// repeated fixed64 total_entry_lengths = 4;
+inline int LogMetrics_SegmentMetrics::_internal_total_entry_lengths_size() const {
+  return _impl_.total_entry_lengths_.size();
+}
+inline int LogMetrics_SegmentMetrics::total_entry_lengths_size() const {
+  return _internal_total_entry_lengths_size();
+}
+inline void LogMetrics_SegmentMetrics::clear_total_entry_lengths() {
+  _impl_.total_entry_lengths_.Clear();
+}
+inline uint64_t LogMetrics_SegmentMetrics::_internal_total_entry_lengths(int index) const {
+  return _impl_.total_entry_lengths_.Get(index);
+}
+inline uint64_t LogMetrics_SegmentMetrics::total_entry_lengths(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.total_entry_lengths)
+  return _internal_total_entry_lengths(index);
+}
+inline void LogMetrics_SegmentMetrics::set_total_entry_lengths(int index, uint64_t value) {
+  _impl_.total_entry_lengths_.Set(index, value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.total_entry_lengths)
+}
+inline void LogMetrics_SegmentMetrics::_internal_add_total_entry_lengths(uint64_t value) {
+  _impl_.total_entry_lengths_.Add(value);
+}
+inline void LogMetrics_SegmentMetrics::add_total_entry_lengths(uint64_t value) {
+  _internal_add_total_entry_lengths(value);
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.total_entry_lengths)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_SegmentMetrics::_internal_total_entry_lengths() const {
+  return _impl_.total_entry_lengths_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LogMetrics_SegmentMetrics::total_entry_lengths() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.total_entry_lengths)
+  return _internal_total_entry_lengths();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_SegmentMetrics::_internal_mutable_total_entry_lengths() {
+  return &_impl_.total_entry_lengths_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LogMetrics_SegmentMetrics::mutable_total_entry_lengths() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics.total_entry_lengths)
+  return _internal_mutable_total_entry_lengths();
+}
+
+// -------------------------------------------------------------------
+
+// LogMetrics
+
+// required double ticks_per_second = 1;
+inline bool LogMetrics::_internal_has_ticks_per_second() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool LogMetrics::has_ticks_per_second() const {
+  return _internal_has_ticks_per_second();
+}
+inline void LogMetrics::clear_ticks_per_second() {
+  _impl_.ticks_per_second_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double LogMetrics::_internal_ticks_per_second() const {
+  return _impl_.ticks_per_second_;
+}
+inline double LogMetrics::ticks_per_second() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.ticks_per_second)
+  return _internal_ticks_per_second();
+}
+inline void LogMetrics::_internal_set_ticks_per_second(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.ticks_per_second_ = value;
+}
+inline void LogMetrics::set_ticks_per_second(double value) {
+  _internal_set_ticks_per_second(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.ticks_per_second)
+}
+
+// required fixed64 total_sync_calls = 2;
+inline bool LogMetrics::_internal_has_total_sync_calls() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool LogMetrics::has_total_sync_calls() const {
+  return _internal_has_total_sync_calls();
+}
+inline void LogMetrics::clear_total_sync_calls() {
+  _impl_.total_sync_calls_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t LogMetrics::_internal_total_sync_calls() const {
+  return _impl_.total_sync_calls_;
+}
+inline uint64_t LogMetrics::total_sync_calls() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.total_sync_calls)
+  return _internal_total_sync_calls();
+}
+inline void LogMetrics::_internal_set_total_sync_calls(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.total_sync_calls_ = value;
+}
+inline void LogMetrics::set_total_sync_calls(uint64_t value) {
+  _internal_set_total_sync_calls(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.total_sync_calls)
+}
+
+// required fixed64 total_sync_ticks = 3;
+inline bool LogMetrics::_internal_has_total_sync_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool LogMetrics::has_total_sync_ticks() const {
+  return _internal_has_total_sync_ticks();
+}
+inline void LogMetrics::clear_total_sync_ticks() {
+  _impl_.total_sync_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t LogMetrics::_internal_total_sync_ticks() const {
+  return _impl_.total_sync_ticks_;
+}
+inline uint64_t LogMetrics::total_sync_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.total_sync_ticks)
+  return _internal_total_sync_ticks();
+}
+inline void LogMetrics::_internal_set_total_sync_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.total_sync_ticks_ = value;
+}
+inline void LogMetrics::set_total_sync_ticks(uint64_t value) {
+  _internal_set_total_sync_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.total_sync_ticks)
+}
+
+// required fixed64 total_append_calls = 4;
+inline bool LogMetrics::_internal_has_total_append_calls() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool LogMetrics::has_total_append_calls() const {
+  return _internal_has_total_append_calls();
+}
+inline void LogMetrics::clear_total_append_calls() {
+  _impl_.total_append_calls_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t LogMetrics::_internal_total_append_calls() const {
+  return _impl_.total_append_calls_;
+}
+inline uint64_t LogMetrics::total_append_calls() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.total_append_calls)
+  return _internal_total_append_calls();
+}
+inline void LogMetrics::_internal_set_total_append_calls(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.total_append_calls_ = value;
+}
+inline void LogMetrics::set_total_append_calls(uint64_t value) {
+  _internal_set_total_append_calls(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.total_append_calls)
+}
+
+// required fixed64 total_append_ticks = 5;
+inline bool LogMetrics::_internal_has_total_append_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool LogMetrics::has_total_append_ticks() const {
+  return _internal_has_total_append_ticks();
+}
+inline void LogMetrics::clear_total_append_ticks() {
+  _impl_.total_append_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t LogMetrics::_internal_total_append_ticks() const {
+  return _impl_.total_append_ticks_;
+}
+inline uint64_t LogMetrics::total_append_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.total_append_ticks)
+  return _internal_total_append_ticks();
+}
+inline void LogMetrics::_internal_set_total_append_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.total_append_ticks_ = value;
+}
+inline void LogMetrics::set_total_append_ticks(uint64_t value) {
+  _internal_set_total_append_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.total_append_ticks)
+}
+
+// required fixed64 total_no_space_ticks = 6;
+inline bool LogMetrics::_internal_has_total_no_space_ticks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool LogMetrics::has_total_no_space_ticks() const {
+  return _internal_has_total_no_space_ticks();
+}
+inline void LogMetrics::clear_total_no_space_ticks() {
+  _impl_.total_no_space_ticks_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t LogMetrics::_internal_total_no_space_ticks() const {
+  return _impl_.total_no_space_ticks_;
+}
+inline uint64_t LogMetrics::total_no_space_ticks() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.total_no_space_ticks)
+  return _internal_total_no_space_ticks();
+}
+inline void LogMetrics::_internal_set_total_no_space_ticks(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.total_no_space_ticks_ = value;
+}
+inline void LogMetrics::set_total_no_space_ticks(uint64_t value) {
+  _internal_set_total_no_space_ticks(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.total_no_space_ticks)
+}
+
+// required fixed64 total_bytes_appended = 7;
+inline bool LogMetrics::_internal_has_total_bytes_appended() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool LogMetrics::has_total_bytes_appended() const {
+  return _internal_has_total_bytes_appended();
+}
+inline void LogMetrics::clear_total_bytes_appended() {
+  _impl_.total_bytes_appended_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint64_t LogMetrics::_internal_total_bytes_appended() const {
+  return _impl_.total_bytes_appended_;
+}
+inline uint64_t LogMetrics::total_bytes_appended() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.total_bytes_appended)
+  return _internal_total_bytes_appended();
+}
+inline void LogMetrics::_internal_set_total_bytes_appended(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.total_bytes_appended_ = value;
+}
+inline void LogMetrics::set_total_bytes_appended(uint64_t value) {
+  _internal_set_total_bytes_appended(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.total_bytes_appended)
+}
+
+// required fixed64 total_metadata_bytes_appended = 8;
+inline bool LogMetrics::_internal_has_total_metadata_bytes_appended() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool LogMetrics::has_total_metadata_bytes_appended() const {
+  return _internal_has_total_metadata_bytes_appended();
+}
+inline void LogMetrics::clear_total_metadata_bytes_appended() {
+  _impl_.total_metadata_bytes_appended_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint64_t LogMetrics::_internal_total_metadata_bytes_appended() const {
+  return _impl_.total_metadata_bytes_appended_;
+}
+inline uint64_t LogMetrics::total_metadata_bytes_appended() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.total_metadata_bytes_appended)
+  return _internal_total_metadata_bytes_appended();
+}
+inline void LogMetrics::_internal_set_total_metadata_bytes_appended(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.total_metadata_bytes_appended_ = value;
+}
+inline void LogMetrics::set_total_metadata_bytes_appended(uint64_t value) {
+  _internal_set_total_metadata_bytes_appended(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.LogMetrics.total_metadata_bytes_appended)
+}
+
+// required .RAMCloud.ProtoBuf.LogMetrics.CleanerMetrics cleaner_metrics = 9;
+inline bool LogMetrics::_internal_has_cleaner_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.cleaner_metrics_ != nullptr);
+  return value;
+}
+inline bool LogMetrics::has_cleaner_metrics() const {
+  return _internal_has_cleaner_metrics();
+}
+inline void LogMetrics::clear_cleaner_metrics() {
+  if (_impl_.cleaner_metrics_ != nullptr) _impl_.cleaner_metrics_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics& LogMetrics::_internal_cleaner_metrics() const {
+  const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* p = _impl_.cleaner_metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics&>(
+      ::RAMCloud::ProtoBuf::_LogMetrics_CleanerMetrics_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics& LogMetrics::cleaner_metrics() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.cleaner_metrics)
+  return _internal_cleaner_metrics();
+}
+inline void LogMetrics::unsafe_arena_set_allocated_cleaner_metrics(
+    ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* cleaner_metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cleaner_metrics_);
+  }
+  _impl_.cleaner_metrics_ = cleaner_metrics;
+  if (cleaner_metrics) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.LogMetrics.cleaner_metrics)
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* LogMetrics::release_cleaner_metrics() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* temp = _impl_.cleaner_metrics_;
+  _impl_.cleaner_metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* LogMetrics::unsafe_arena_release_cleaner_metrics() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.LogMetrics.cleaner_metrics)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* temp = _impl_.cleaner_metrics_;
+  _impl_.cleaner_metrics_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* LogMetrics::_internal_mutable_cleaner_metrics() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.cleaner_metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics>(GetArenaForAllocation());
+    _impl_.cleaner_metrics_ = p;
+  }
+  return _impl_.cleaner_metrics_;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* LogMetrics::mutable_cleaner_metrics() {
+  ::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* _msg = _internal_mutable_cleaner_metrics();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.LogMetrics.cleaner_metrics)
+  return _msg;
+}
+inline void LogMetrics::set_allocated_cleaner_metrics(::RAMCloud::ProtoBuf::LogMetrics_CleanerMetrics* cleaner_metrics) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cleaner_metrics_;
+  }
+  if (cleaner_metrics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cleaner_metrics);
+    if (message_arena != submessage_arena) {
+      cleaner_metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cleaner_metrics, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.cleaner_metrics_ = cleaner_metrics;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.LogMetrics.cleaner_metrics)
+}
+
+// required .RAMCloud.ProtoBuf.LogMetrics.SegletMetrics seglet_metrics = 10;
+inline bool LogMetrics::_internal_has_seglet_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.seglet_metrics_ != nullptr);
+  return value;
+}
+inline bool LogMetrics::has_seglet_metrics() const {
+  return _internal_has_seglet_metrics();
+}
+inline void LogMetrics::clear_seglet_metrics() {
+  if (_impl_.seglet_metrics_ != nullptr) _impl_.seglet_metrics_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics& LogMetrics::_internal_seglet_metrics() const {
+  const ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* p = _impl_.seglet_metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics&>(
+      ::RAMCloud::ProtoBuf::_LogMetrics_SegletMetrics_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics& LogMetrics::seglet_metrics() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.seglet_metrics)
+  return _internal_seglet_metrics();
+}
+inline void LogMetrics::unsafe_arena_set_allocated_seglet_metrics(
+    ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* seglet_metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.seglet_metrics_);
+  }
+  _impl_.seglet_metrics_ = seglet_metrics;
+  if (seglet_metrics) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.LogMetrics.seglet_metrics)
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* LogMetrics::release_seglet_metrics() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* temp = _impl_.seglet_metrics_;
+  _impl_.seglet_metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* LogMetrics::unsafe_arena_release_seglet_metrics() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.LogMetrics.seglet_metrics)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* temp = _impl_.seglet_metrics_;
+  _impl_.seglet_metrics_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* LogMetrics::_internal_mutable_seglet_metrics() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.seglet_metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics>(GetArenaForAllocation());
+    _impl_.seglet_metrics_ = p;
+  }
+  return _impl_.seglet_metrics_;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* LogMetrics::mutable_seglet_metrics() {
+  ::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* _msg = _internal_mutable_seglet_metrics();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.LogMetrics.seglet_metrics)
+  return _msg;
+}
+inline void LogMetrics::set_allocated_seglet_metrics(::RAMCloud::ProtoBuf::LogMetrics_SegletMetrics* seglet_metrics) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.seglet_metrics_;
+  }
+  if (seglet_metrics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(seglet_metrics);
+    if (message_arena != submessage_arena) {
+      seglet_metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, seglet_metrics, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.seglet_metrics_ = seglet_metrics;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.LogMetrics.seglet_metrics)
+}
+
+// required .RAMCloud.ProtoBuf.LogMetrics.SegmentMetrics segment_metrics = 11;
+inline bool LogMetrics::_internal_has_segment_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.segment_metrics_ != nullptr);
+  return value;
+}
+inline bool LogMetrics::has_segment_metrics() const {
+  return _internal_has_segment_metrics();
+}
+inline void LogMetrics::clear_segment_metrics() {
+  if (_impl_.segment_metrics_ != nullptr) _impl_.segment_metrics_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics& LogMetrics::_internal_segment_metrics() const {
+  const ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* p = _impl_.segment_metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics&>(
+      ::RAMCloud::ProtoBuf::_LogMetrics_SegmentMetrics_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics& LogMetrics::segment_metrics() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.LogMetrics.segment_metrics)
+  return _internal_segment_metrics();
+}
+inline void LogMetrics::unsafe_arena_set_allocated_segment_metrics(
+    ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* segment_metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.segment_metrics_);
+  }
+  _impl_.segment_metrics_ = segment_metrics;
+  if (segment_metrics) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.LogMetrics.segment_metrics)
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* LogMetrics::release_segment_metrics() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* temp = _impl_.segment_metrics_;
+  _impl_.segment_metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* LogMetrics::unsafe_arena_release_segment_metrics() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.LogMetrics.segment_metrics)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* temp = _impl_.segment_metrics_;
+  _impl_.segment_metrics_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* LogMetrics::_internal_mutable_segment_metrics() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.segment_metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics>(GetArenaForAllocation());
+    _impl_.segment_metrics_ = p;
+  }
+  return _impl_.segment_metrics_;
+}
+inline ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* LogMetrics::mutable_segment_metrics() {
+  ::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* _msg = _internal_mutable_segment_metrics();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.LogMetrics.segment_metrics)
+  return _msg;
+}
+inline void LogMetrics::set_allocated_segment_metrics(::RAMCloud::ProtoBuf::LogMetrics_SegmentMetrics* segment_metrics) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.segment_metrics_;
+  }
+  if (segment_metrics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(segment_metrics);
+    if (message_arena != submessage_arena) {
+      segment_metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, segment_metrics, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.segment_metrics_ = segment_metrics;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.LogMetrics.segment_metrics)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_LogMetrics_2eproto
+// RAMCloud pragma [GCCWARN=0]
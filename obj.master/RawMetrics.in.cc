@@ -0,0 +1,871 @@
+// This file was automatically generated by scripts/rawmetrics.py.
+// Do not edit it.
+namespace RAMCloud {
+RawMetrics::MetricInfo RawMetrics::metricInfo(int i)
+{
+    switch (i) {
+        case 0:
+            return {"coordinator.recoveryCount",
+                    &coordinator.recoveryCount};
+        case 1:
+            return {"coordinator.recoveryTicks",
+                    &coordinator.recoveryTicks};
+        case 2:
+            return {"coordinator.recoveryBuildReplicaMapTicks",
+                    &coordinator.recoveryBuildReplicaMapTicks};
+        case 3:
+            return {"coordinator.recoveryStartTicks",
+                    &coordinator.recoveryStartTicks};
+        case 4:
+            return {"coordinator.recoveryCompleteTicks",
+                    &coordinator.recoveryCompleteTicks};
+        case 5:
+            return {"master.recoveryCount",
+                    &master.recoveryCount};
+        case 6:
+            return {"master.recoveryTicks",
+                    &master.recoveryTicks};
+        case 7:
+            return {"master.replicaManagerTicks",
+                    &master.replicaManagerTicks};
+        case 8:
+            return {"master.segmentAppendTicks",
+                    &master.segmentAppendTicks};
+        case 9:
+            return {"master.segmentAppendCopyTicks",
+                    &master.segmentAppendCopyTicks};
+        case 10:
+            return {"master.segmentReadCount",
+                    &master.segmentReadCount};
+        case 11:
+            return {"master.segmentReadTicks",
+                    &master.segmentReadTicks};
+        case 12:
+            return {"master.segmentReadStallTicks",
+                    &master.segmentReadStallTicks};
+        case 13:
+            return {"master.segmentReadByteCount",
+                    &master.segmentReadByteCount};
+        case 14:
+            return {"master.verifyChecksumTicks",
+                    &master.verifyChecksumTicks};
+        case 15:
+            return {"master.recoverSegmentTicks",
+                    &master.recoverSegmentTicks};
+        case 16:
+            return {"master.backupInRecoverTicks",
+                    &master.backupInRecoverTicks};
+        case 17:
+            return {"master.segmentCloseCount",
+                    &master.segmentCloseCount};
+        case 18:
+            return {"master.recoverySegmentEntryCount",
+                    &master.recoverySegmentEntryCount};
+        case 19:
+            return {"master.recoverySegmentEntryBytes",
+                    &master.recoverySegmentEntryBytes};
+        case 20:
+            return {"master.liveObjectCount",
+                    &master.liveObjectCount};
+        case 21:
+            return {"master.liveObjectBytes",
+                    &master.liveObjectBytes};
+        case 22:
+            return {"master.objectAppendCount",
+                    &master.objectAppendCount};
+        case 23:
+            return {"master.objectDiscardCount",
+                    &master.objectDiscardCount};
+        case 24:
+            return {"master.safeVersionRecoveryCount",
+                    &master.safeVersionRecoveryCount};
+        case 25:
+            return {"master.safeVersionNonRecoveryCount",
+                    &master.safeVersionNonRecoveryCount};
+        case 26:
+            return {"master.tombstoneAppendCount",
+                    &master.tombstoneAppendCount};
+        case 27:
+            return {"master.tombstoneDiscardCount",
+                    &master.tombstoneDiscardCount};
+        case 28:
+            return {"master.logSyncTicks",
+                    &master.logSyncTicks};
+        case 29:
+            return {"master.logSyncBytes",
+                    &master.logSyncBytes};
+        case 30:
+            return {"master.recoveryWillTicks",
+                    &master.recoveryWillTicks};
+        case 31:
+            return {"master.removeTombstoneTicks",
+                    &master.removeTombstoneTicks};
+        case 32:
+            return {"master.replicationTicks",
+                    &master.replicationTicks};
+        case 33:
+            return {"master.replicationBytes",
+                    &master.replicationBytes};
+        case 34:
+            return {"master.replicas",
+                    &master.replicas};
+        case 35:
+            return {"master.backupCloseTicks",
+                    &master.backupCloseTicks};
+        case 36:
+            return {"master.backupCloseCount",
+                    &master.backupCloseCount};
+        case 37:
+            return {"master.logSyncCloseTicks",
+                    &master.logSyncCloseTicks};
+        case 38:
+            return {"master.logSyncCloseCount",
+                    &master.logSyncCloseCount};
+        case 39:
+            return {"master.replicaRecoveries",
+                    &master.replicaRecoveries};
+        case 40:
+            return {"master.openReplicaRecoveries",
+                    &master.openReplicaRecoveries};
+        case 41:
+            return {"master.replicationTasks",
+                    &master.replicationTasks};
+        case 42:
+            return {"master.replicationTransmitCopyTicks",
+                    &master.replicationTransmitCopyTicks};
+        case 43:
+            return {"master.logSyncTransmitCopyTicks",
+                    &master.logSyncTransmitCopyTicks};
+        case 44:
+            return {"master.replayMemoryReadBytes",
+                    &master.replayMemoryReadBytes};
+        case 45:
+            return {"master.replayMemoryWrittenBytes",
+                    &master.replayMemoryWrittenBytes};
+        case 46:
+            return {"master.replicationTransmitActiveTicks",
+                    &master.replicationTransmitActiveTicks};
+        case 47:
+            return {"master.logSyncTransmitActiveTicks",
+                    &master.logSyncTransmitActiveTicks};
+        case 48:
+            return {"master.replicationPostingWriteRpcTicks",
+                    &master.replicationPostingWriteRpcTicks};
+        case 49:
+            return {"master.recoverSegmentPostingWriteRpcTicks",
+                    &master.recoverSegmentPostingWriteRpcTicks};
+        case 50:
+            return {"master.logSyncPostingWriteRpcTicks",
+                    &master.logSyncPostingWriteRpcTicks};
+        case 51:
+            return {"backup.recoveryCount",
+                    &backup.recoveryCount};
+        case 52:
+            return {"backup.recoveryTicks",
+                    &backup.recoveryTicks};
+        case 53:
+            return {"backup.serviceTicks",
+                    &backup.serviceTicks};
+        case 54:
+            return {"backup.readCompletionCount",
+                    &backup.readCompletionCount};
+        case 55:
+            return {"backup.readingDataTicks",
+                    &backup.readingDataTicks};
+        case 56:
+            return {"backup.storageReadCount",
+                    &backup.storageReadCount};
+        case 57:
+            return {"backup.storageReadBytes",
+                    &backup.storageReadBytes};
+        case 58:
+            return {"backup.storageReadTicks",
+                    &backup.storageReadTicks};
+        case 59:
+            return {"backup.writeClearTicks",
+                    &backup.writeClearTicks};
+        case 60:
+            return {"backup.writeCopyBytes",
+                    &backup.writeCopyBytes};
+        case 61:
+            return {"backup.writeCopyTicks",
+                    &backup.writeCopyTicks};
+        case 62:
+            return {"backup.storageWriteCount",
+                    &backup.storageWriteCount};
+        case 63:
+            return {"backup.storageWriteBytes",
+                    &backup.storageWriteBytes};
+        case 64:
+            return {"backup.storageWriteTicks",
+                    &backup.storageWriteTicks};
+        case 65:
+            return {"backup.filterTicks",
+                    &backup.filterTicks};
+        case 66:
+            return {"backup.primaryLoadCount",
+                    &backup.primaryLoadCount};
+        case 67:
+            return {"backup.secondaryLoadCount",
+                    &backup.secondaryLoadCount};
+        case 68:
+            return {"backup.storageType",
+                    &backup.storageType};
+        case 69:
+            return {"backup.uncommittedFramesFreed",
+                    &backup.uncommittedFramesFreed};
+        case 70:
+            return {"rpc.rpc0Count",
+                    &rpc.rpc0Count};
+        case 71:
+            return {"rpc.rpc1Count",
+                    &rpc.rpc1Count};
+        case 72:
+            return {"rpc.rpc2Count",
+                    &rpc.rpc2Count};
+        case 73:
+            return {"rpc.rpc3Count",
+                    &rpc.rpc3Count};
+        case 74:
+            return {"rpc.rpc4Count",
+                    &rpc.rpc4Count};
+        case 75:
+            return {"rpc.rpc5Count",
+                    &rpc.rpc5Count};
+        case 76:
+            return {"rpc.rpc6Count",
+                    &rpc.rpc6Count};
+        case 77:
+            return {"rpc.pingCount",
+                    &rpc.pingCount};
+        case 78:
+            return {"rpc.proxy_pingCount",
+                    &rpc.proxy_pingCount};
+        case 79:
+            return {"rpc.killCount",
+                    &rpc.killCount};
+        case 80:
+            return {"rpc.create_tableCount",
+                    &rpc.create_tableCount};
+        case 81:
+            return {"rpc.get_table_idCount",
+                    &rpc.get_table_idCount};
+        case 82:
+            return {"rpc.drop_tableCount",
+                    &rpc.drop_tableCount};
+        case 83:
+            return {"rpc.readCount",
+                    &rpc.readCount};
+        case 84:
+            return {"rpc.writeCount",
+                    &rpc.writeCount};
+        case 85:
+            return {"rpc.removeCount",
+                    &rpc.removeCount};
+        case 86:
+            return {"rpc.enlist_serverCount",
+                    &rpc.enlist_serverCount};
+        case 87:
+            return {"rpc.get_server_listCount",
+                    &rpc.get_server_listCount};
+        case 88:
+            return {"rpc.get_table_configCount",
+                    &rpc.get_table_configCount};
+        case 89:
+            return {"rpc.recoverCount",
+                    &rpc.recoverCount};
+        case 90:
+            return {"rpc.hint_server_crashedCount",
+                    &rpc.hint_server_crashedCount};
+        case 91:
+            return {"rpc.recovery_master_finishedCount",
+                    &rpc.recovery_master_finishedCount};
+        case 92:
+            return {"rpc.enumerateCount",
+                    &rpc.enumerateCount};
+        case 93:
+            return {"rpc.set_master_recovery_infoCount",
+                    &rpc.set_master_recovery_infoCount};
+        case 94:
+            return {"rpc.fill_with_test_dataCount",
+                    &rpc.fill_with_test_dataCount};
+        case 95:
+            return {"rpc.multi_opCount",
+                    &rpc.multi_opCount};
+        case 96:
+            return {"rpc.get_metricsCount",
+                    &rpc.get_metricsCount};
+        case 97:
+            return {"rpc.rpc27Count",
+                    &rpc.rpc27Count};
+        case 98:
+            return {"rpc.backup_freeCount",
+                    &rpc.backup_freeCount};
+        case 99:
+            return {"rpc.backup_getrecoverydataCount",
+                    &rpc.backup_getrecoverydataCount};
+        case 100:
+            return {"rpc.rpc30Count",
+                    &rpc.rpc30Count};
+        case 101:
+            return {"rpc.backup_startreadingdataCount",
+                    &rpc.backup_startreadingdataCount};
+        case 102:
+            return {"rpc.backup_writeCount",
+                    &rpc.backup_writeCount};
+        case 103:
+            return {"rpc.backup_recoverycompleteCount",
+                    &rpc.backup_recoverycompleteCount};
+        case 104:
+            return {"rpc.rpc34Count",
+                    &rpc.rpc34Count};
+        case 105:
+            return {"rpc.update_server_listCount",
+                    &rpc.update_server_listCount};
+        case 106:
+            return {"rpc.backup_startpartitionCount",
+                    &rpc.backup_startpartitionCount};
+        case 107:
+            return {"rpc.rpc37Count",
+                    &rpc.rpc37Count};
+        case 108:
+            return {"rpc.rpc38Count",
+                    &rpc.rpc38Count};
+        case 109:
+            return {"rpc.drop_tablet_ownershipCount",
+                    &rpc.drop_tablet_ownershipCount};
+        case 110:
+            return {"rpc.take_tablet_ownershipCount",
+                    &rpc.take_tablet_ownershipCount};
+        case 111:
+            return {"rpc.rpc41Count",
+                    &rpc.rpc41Count};
+        case 112:
+            return {"rpc.get_head_of_logCount",
+                    &rpc.get_head_of_logCount};
+        case 113:
+            return {"rpc.incrementCount",
+                    &rpc.incrementCount};
+        case 114:
+            return {"rpc.prep_for_migrationCount",
+                    &rpc.prep_for_migrationCount};
+        case 115:
+            return {"rpc.receive_migration_dataCount",
+                    &rpc.receive_migration_dataCount};
+        case 116:
+            return {"rpc.reassign_tablet_ownershipCount",
+                    &rpc.reassign_tablet_ownershipCount};
+        case 117:
+            return {"rpc.migrate_tabletCount",
+                    &rpc.migrate_tabletCount};
+        case 118:
+            return {"rpc.is_replica_neededCount",
+                    &rpc.is_replica_neededCount};
+        case 119:
+            return {"rpc.split_tabletCount",
+                    &rpc.split_tabletCount};
+        case 120:
+            return {"rpc.get_server_statisticsCount",
+                    &rpc.get_server_statisticsCount};
+        case 121:
+            return {"rpc.set_runtime_optionCount",
+                    &rpc.set_runtime_optionCount};
+        case 122:
+            return {"rpc.get_server_configCount",
+                    &rpc.get_server_configCount};
+        case 123:
+            return {"rpc.get_backup_configCount",
+                    &rpc.get_backup_configCount};
+        case 124:
+            return {"rpc.rpc54Count",
+                    &rpc.rpc54Count};
+        case 125:
+            return {"rpc.get_master_configCount",
+                    &rpc.get_master_configCount};
+        case 126:
+            return {"rpc.get_log_metricsCount",
+                    &rpc.get_log_metricsCount};
+        case 127:
+            return {"rpc.verify_membershipCount",
+                    &rpc.verify_membershipCount};
+        case 128:
+            return {"rpc.get_runtime_optionCount",
+                    &rpc.get_runtime_optionCount};
+        case 129:
+            return {"rpc.get_lease_infoCount",
+                    &rpc.get_lease_infoCount};
+        case 130:
+            return {"rpc.renew_leaseCount",
+                    &rpc.renew_leaseCount};
+        case 131:
+            return {"rpc.server_controlCount",
+                    &rpc.server_controlCount};
+        case 132:
+            return {"rpc.server_control_allCount",
+                    &rpc.server_control_allCount};
+        case 133:
+            return {"rpc.get_server_idCount",
+                    &rpc.get_server_idCount};
+        case 134:
+            return {"rpc.read_keys_and_valueCount",
+                    &rpc.read_keys_and_valueCount};
+        case 135:
+            return {"rpc.lookup_index_keysCount",
+                    &rpc.lookup_index_keysCount};
+        case 136:
+            return {"rpc.read_hashesCount",
+                    &rpc.read_hashesCount};
+        case 137:
+            return {"rpc.insert_index_entryCount",
+                    &rpc.insert_index_entryCount};
+        case 138:
+            return {"rpc.remove_index_entryCount",
+                    &rpc.remove_index_entryCount};
+        case 139:
+            return {"rpc.create_indexCount",
+                    &rpc.create_indexCount};
+        case 140:
+            return {"rpc.drop_indexCount",
+                    &rpc.drop_indexCount};
+        case 141:
+            return {"rpc.drop_indexlet_ownershipCount",
+                    &rpc.drop_indexlet_ownershipCount};
+        case 142:
+            return {"rpc.take_indexlet_ownershipCount",
+                    &rpc.take_indexlet_ownershipCount};
+        case 143:
+            return {"rpc.prep_for_indexlet_migrationCount",
+                    &rpc.prep_for_indexlet_migrationCount};
+        case 144:
+            return {"rpc.split_and_migrate_indexletCount",
+                    &rpc.split_and_migrate_indexletCount};
+        case 145:
+            return {"rpc.coord_split_and_migrate_indexletCount",
+                    &rpc.coord_split_and_migrate_indexletCount};
+        case 146:
+            return {"rpc.tx_decisionCount",
+                    &rpc.tx_decisionCount};
+        case 147:
+            return {"rpc.tx_prepareCount",
+                    &rpc.tx_prepareCount};
+        case 148:
+            return {"rpc.tx_request_abortCount",
+                    &rpc.tx_request_abortCount};
+        case 149:
+            return {"rpc.tx_hint_failedCount",
+                    &rpc.tx_hint_failedCount};
+        case 150:
+            return {"rpc.echoCount",
+                    &rpc.echoCount};
+        case 151:
+            return {"rpc.pull_tabletCount",
+                    &rpc.pull_tabletCount};
+        case 152:
+            return {"rpc.pull_tablet_dataCount",
+                    &rpc.pull_tablet_dataCount};
+        case 153:
+            return {"rpc.backup_write_batchCount",
+                    &rpc.backup_write_batchCount};
+        case 154:
+            return {"rpc.backup_write_forwardCount",
+                    &rpc.backup_write_forwardCount};
+        case 155:
+            return {"rpc.illegal_rpc_typeCount",
+                    &rpc.illegal_rpc_typeCount};
+        case 156:
+            return {"rpc.rpc0Ticks",
+                    &rpc.rpc0Ticks};
+        case 157:
+            return {"rpc.rpc1Ticks",
+                    &rpc.rpc1Ticks};
+        case 158:
+            return {"rpc.rpc2Ticks",
+                    &rpc.rpc2Ticks};
+        case 159:
+            return {"rpc.rpc3Ticks",
+                    &rpc.rpc3Ticks};
+        case 160:
+            return {"rpc.rpc4Ticks",
+                    &rpc.rpc4Ticks};
+        case 161:
+            return {"rpc.rpc5Ticks",
+                    &rpc.rpc5Ticks};
+        case 162:
+            return {"rpc.rpc6Ticks",
+                    &rpc.rpc6Ticks};
+        case 163:
+            return {"rpc.pingTicks",
+                    &rpc.pingTicks};
+        case 164:
+            return {"rpc.proxy_pingTicks",
+                    &rpc.proxy_pingTicks};
+        case 165:
+            return {"rpc.killTicks",
+                    &rpc.killTicks};
+        case 166:
+            return {"rpc.create_tableTicks",
+                    &rpc.create_tableTicks};
+        case 167:
+            return {"rpc.get_table_idTicks",
+                    &rpc.get_table_idTicks};
+        case 168:
+            return {"rpc.drop_tableTicks",
+                    &rpc.drop_tableTicks};
+        case 169:
+            return {"rpc.readTicks",
+                    &rpc.readTicks};
+        case 170:
+            return {"rpc.writeTicks",
+                    &rpc.writeTicks};
+        case 171:
+            return {"rpc.removeTicks",
+                    &rpc.removeTicks};
+        case 172:
+            return {"rpc.enlist_serverTicks",
+                    &rpc.enlist_serverTicks};
+        case 173:
+            return {"rpc.get_server_listTicks",
+                    &rpc.get_server_listTicks};
+        case 174:
+            return {"rpc.get_table_configTicks",
+                    &rpc.get_table_configTicks};
+        case 175:
+            return {"rpc.recoverTicks",
+                    &rpc.recoverTicks};
+        case 176:
+            return {"rpc.hint_server_crashedTicks",
+                    &rpc.hint_server_crashedTicks};
+        case 177:
+            return {"rpc.recovery_master_finishedTicks",
+                    &rpc.recovery_master_finishedTicks};
+        case 178:
+            return {"rpc.enumerateTicks",
+                    &rpc.enumerateTicks};
+        case 179:
+            return {"rpc.set_master_recovery_infoTicks",
+                    &rpc.set_master_recovery_infoTicks};
+        case 180:
+            return {"rpc.fill_with_test_dataTicks",
+                    &rpc.fill_with_test_dataTicks};
+        case 181:
+            return {"rpc.multi_opTicks",
+                    &rpc.multi_opTicks};
+        case 182:
+            return {"rpc.get_metricsTicks",
+                    &rpc.get_metricsTicks};
+        case 183:
+            return {"rpc.rpc27Ticks",
+                    &rpc.rpc27Ticks};
+        case 184:
+            return {"rpc.backup_freeTicks",
+                    &rpc.backup_freeTicks};
+        case 185:
+            return {"rpc.backup_getrecoverydataTicks",
+                    &rpc.backup_getrecoverydataTicks};
+        case 186:
+            return {"rpc.rpc30Ticks",
+                    &rpc.rpc30Ticks};
+        case 187:
+            return {"rpc.backup_startreadingdataTicks",
+                    &rpc.backup_startreadingdataTicks};
+        case 188:
+            return {"rpc.backup_writeTicks",
+                    &rpc.backup_writeTicks};
+        case 189:
+            return {"rpc.backup_recoverycompleteTicks",
+                    &rpc.backup_recoverycompleteTicks};
+        case 190:
+            return {"rpc.rpc34Ticks",
+                    &rpc.rpc34Ticks};
+        case 191:
+            return {"rpc.update_server_listTicks",
+                    &rpc.update_server_listTicks};
+        case 192:
+            return {"rpc.backup_startpartitionTicks",
+                    &rpc.backup_startpartitionTicks};
+        case 193:
+            return {"rpc.rpc37Ticks",
+                    &rpc.rpc37Ticks};
+        case 194:
+            return {"rpc.rpc38Ticks",
+                    &rpc.rpc38Ticks};
+        case 195:
+            return {"rpc.drop_tablet_ownershipTicks",
+                    &rpc.drop_tablet_ownershipTicks};
+        case 196:
+            return {"rpc.take_tablet_ownershipTicks",
+                    &rpc.take_tablet_ownershipTicks};
+        case 197:
+            return {"rpc.rpc41Ticks",
+                    &rpc.rpc41Ticks};
+        case 198:
+            return {"rpc.get_head_of_logTicks",
+                    &rpc.get_head_of_logTicks};
+        case 199:
+            return {"rpc.incrementTicks",
+                    &rpc.incrementTicks};
+        case 200:
+            return {"rpc.prep_for_migrationTicks",
+                    &rpc.prep_for_migrationTicks};
+        case 201:
+            return {"rpc.receive_migration_dataTicks",
+                    &rpc.receive_migration_dataTicks};
+        case 202:
+            return {"rpc.reassign_tablet_ownershipTicks",
+                    &rpc.reassign_tablet_ownershipTicks};
+        case 203:
+            return {"rpc.migrate_tabletTicks",
+                    &rpc.migrate_tabletTicks};
+        case 204:
+            return {"rpc.is_replica_neededTicks",
+                    &rpc.is_replica_neededTicks};
+        case 205:
+            return {"rpc.split_tabletTicks",
+                    &rpc.split_tabletTicks};
+        case 206:
+            return {"rpc.get_server_statisticsTicks",
+                    &rpc.get_server_statisticsTicks};
+        case 207:
+            return {"rpc.set_runtime_optionTicks",
+                    &rpc.set_runtime_optionTicks};
+        case 208:
+            return {"rpc.get_server_configTicks",
+                    &rpc.get_server_configTicks};
+        case 209:
+            return {"rpc.get_backup_configTicks",
+                    &rpc.get_backup_configTicks};
+        case 210:
+            return {"rpc.rpc54Ticks",
+                    &rpc.rpc54Ticks};
+        case 211:
+            return {"rpc.get_master_configTicks",
+                    &rpc.get_master_configTicks};
+        case 212:
+            return {"rpc.get_log_metricsTicks",
+                    &rpc.get_log_metricsTicks};
+        case 213:
+            return {"rpc.verify_membershipTicks",
+                    &rpc.verify_membershipTicks};
+        case 214:
+            return {"rpc.get_runtime_optionTicks",
+                    &rpc.get_runtime_optionTicks};
+        case 215:
+            return {"rpc.get_lease_infoTicks",
+                    &rpc.get_lease_infoTicks};
+        case 216:
+            return {"rpc.renew_leaseTicks",
+                    &rpc.renew_leaseTicks};
+        case 217:
+            return {"rpc.server_controlTicks",
+                    &rpc.server_controlTicks};
+        case 218:
+            return {"rpc.server_control_allTicks",
+                    &rpc.server_control_allTicks};
+        case 219:
+            return {"rpc.get_server_idTicks",
+                    &rpc.get_server_idTicks};
+        case 220:
+            return {"rpc.read_keys_and_valueTicks",
+                    &rpc.read_keys_and_valueTicks};
+        case 221:
+            return {"rpc.lookup_index_keysTicks",
+                    &rpc.lookup_index_keysTicks};
+        case 222:
+            return {"rpc.read_hashesTicks",
+                    &rpc.read_hashesTicks};
+        case 223:
+            return {"rpc.insert_index_entryTicks",
+                    &rpc.insert_index_entryTicks};
+        case 224:
+            return {"rpc.remove_index_entryTicks",
+                    &rpc.remove_index_entryTicks};
+        case 225:
+            return {"rpc.create_indexTicks",
+                    &rpc.create_indexTicks};
+        case 226:
+            return {"rpc.drop_indexTicks",
+                    &rpc.drop_indexTicks};
+        case 227:
+            return {"rpc.drop_indexlet_ownershipTicks",
+                    &rpc.drop_indexlet_ownershipTicks};
+        case 228:
+            return {"rpc.take_indexlet_ownershipTicks",
+                    &rpc.take_indexlet_ownershipTicks};
+        case 229:
+            return {"rpc.prep_for_indexlet_migrationTicks",
+                    &rpc.prep_for_indexlet_migrationTicks};
+        case 230:
+            return {"rpc.split_and_migrate_indexletTicks",
+                    &rpc.split_and_migrate_indexletTicks};
+        case 231:
+            return {"rpc.coord_split_and_migrate_indexletTicks",
+                    &rpc.coord_split_and_migrate_indexletTicks};
+        case 232:
+            return {"rpc.tx_decisionTicks",
+                    &rpc.tx_decisionTicks};
+        case 233:
+            return {"rpc.tx_prepareTicks",
+                    &rpc.tx_prepareTicks};
+        case 234:
+            return {"rpc.tx_request_abortTicks",
+                    &rpc.tx_request_abortTicks};
+        case 235:
+            return {"rpc.tx_hint_failedTicks",
+                    &rpc.tx_hint_failedTicks};
+        case 236:
+            return {"rpc.echoTicks",
+                    &rpc.echoTicks};
+        case 237:
+            return {"rpc.pull_tabletTicks",
+                    &rpc.pull_tabletTicks};
+        case 238:
+            return {"rpc.pull_tablet_dataTicks",
+                    &rpc.pull_tablet_dataTicks};
+        case 239:
+            return {"rpc.backup_write_batchTicks",
+                    &rpc.backup_write_batchTicks};
+        case 240:
+            return {"rpc.backup_write_forwardTicks",
+                    &rpc.backup_write_forwardTicks};
+        case 241:
+            return {"rpc.illegal_rpc_typeTicks",
+                    &rpc.illegal_rpc_typeTicks};
+        case 242:
+            return {"transport.transmit.ticks",
+                    &transport.transmit.ticks};
+        case 243:
+            return {"transport.transmit.messageCount",
+                    &transport.transmit.messageCount};
+        case 244:
+            return {"transport.transmit.packetCount",
+                    &transport.transmit.packetCount};
+        case 245:
+            return {"transport.transmit.iovecCount",
+                    &transport.transmit.iovecCount};
+        case 246:
+            return {"transport.transmit.byteCount",
+                    &transport.transmit.byteCount};
+        case 247:
+            return {"transport.transmit.copyTicks",
+                    &transport.transmit.copyTicks};
+        case 248:
+            return {"transport.transmit.dmaTicks",
+                    &transport.transmit.dmaTicks};
+        case 249:
+            return {"transport.receive.ticks",
+                    &transport.receive.ticks};
+        case 250:
+            return {"transport.receive.messageCount",
+                    &transport.receive.messageCount};
+        case 251:
+            return {"transport.receive.packetCount",
+                    &transport.receive.packetCount};
+        case 252:
+            return {"transport.receive.iovecCount",
+                    &transport.receive.iovecCount};
+        case 253:
+            return {"transport.receive.byteCount",
+                    &transport.receive.byteCount};
+        case 254:
+            return {"transport.infiniband.transmitActiveTicks",
+                    &transport.infiniband.transmitActiveTicks};
+        case 255:
+            return {"transport.sessionOpenTicks",
+                    &transport.sessionOpenTicks};
+        case 256:
+            return {"transport.sessionOpenCount",
+                    &transport.sessionOpenCount};
+        case 257:
+            return {"transport.sessionOpenSquaredTicks",
+                    &transport.sessionOpenSquaredTicks};
+        case 258:
+            return {"transport.retrySessionOpenCount",
+                    &transport.retrySessionOpenCount};
+        case 259:
+            return {"transport.clientRpcsActiveTicks",
+                    &transport.clientRpcsActiveTicks};
+        case 260:
+            return {"temp.ticks0",
+                    &temp.ticks0};
+        case 261:
+            return {"temp.count0",
+                    &temp.count0};
+        case 262:
+            return {"temp.ticks1",
+                    &temp.ticks1};
+        case 263:
+            return {"temp.count1",
+                    &temp.count1};
+        case 264:
+            return {"temp.ticks2",
+                    &temp.ticks2};
+        case 265:
+            return {"temp.count2",
+                    &temp.count2};
+        case 266:
+            return {"temp.ticks3",
+                    &temp.ticks3};
+        case 267:
+            return {"temp.count3",
+                    &temp.count3};
+        case 268:
+            return {"temp.ticks4",
+                    &temp.ticks4};
+        case 269:
+            return {"temp.count4",
+                    &temp.count4};
+        case 270:
+            return {"temp.ticks5",
+                    &temp.ticks5};
+        case 271:
+            return {"temp.count5",
+                    &temp.count5};
+        case 272:
+            return {"temp.ticks6",
+                    &temp.ticks6};
+        case 273:
+            return {"temp.count6",
+                    &temp.count6};
+        case 274:
+            return {"temp.ticks7",
+                    &temp.ticks7};
+        case 275:
+            return {"temp.count7",
+                    &temp.count7};
+        case 276:
+            return {"temp.ticks8",
+                    &temp.ticks8};
+        case 277:
+            return {"temp.count8",
+                    &temp.count8};
+        case 278:
+            return {"temp.ticks9",
+                    &temp.ticks9};
+        case 279:
+            return {"temp.count9",
+                    &temp.count9};
+        case 280:
+            return {"serverId",
+                    &serverId};
+        case 281:
+            return {"pid",
+                    &pid};
+        case 282:
+            return {"clockFrequency",
+                    &clockFrequency};
+        case 283:
+            return {"segmentSize",
+                    &segmentSize};
+        case 284:
+            return {"processSystemTicks",
+                    &processSystemTicks};
+        case 285:
+            return {"processUserTicks",
+                    &processUserTicks};
+        case 286:
+            return {"uptimeTicks",
+                    &uptimeTicks};
+    }
+    return {NULL, NULL};
+}
+} // namespace RAMCloud
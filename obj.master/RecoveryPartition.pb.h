@@ -0,0 +1,344 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: RecoveryPartition.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_RecoveryPartition_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_RecoveryPartition_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "Tablets.pb.h"
+#include "Indexlet.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_RecoveryPartition_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_RecoveryPartition_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_RecoveryPartition_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class RecoveryPartition;
+struct RecoveryPartitionDefaultTypeInternal;
+extern RecoveryPartitionDefaultTypeInternal _RecoveryPartition_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::RecoveryPartition* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::RecoveryPartition>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class RecoveryPartition final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.RecoveryPartition) */ {
+ public:
+  inline RecoveryPartition() : RecoveryPartition(nullptr) {}
+  ~RecoveryPartition() override;
+  explicit PROTOBUF_CONSTEXPR RecoveryPartition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecoveryPartition(const RecoveryPartition& from);
+  RecoveryPartition(RecoveryPartition&& from) noexcept
+    : RecoveryPartition() {
+    *this = ::std::move(from);
+  }
+
+  inline RecoveryPartition& operator=(const RecoveryPartition& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecoveryPartition& operator=(RecoveryPartition&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecoveryPartition& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecoveryPartition* internal_default_instance() {
+    return reinterpret_cast<const RecoveryPartition*>(
+               &_RecoveryPartition_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(RecoveryPartition& a, RecoveryPartition& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecoveryPartition* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecoveryPartition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecoveryPartition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecoveryPartition>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecoveryPartition& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecoveryPartition& from) {
+    RecoveryPartition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecoveryPartition* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.RecoveryPartition";
+  }
+  protected:
+  explicit RecoveryPartition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTabletFieldNumber = 1,
+    kIndexletFieldNumber = 2,
+  };
+  // repeated .RAMCloud.ProtoBuf.Tablets.Tablet tablet = 1;
+  int tablet_size() const;
+  private:
+  int _internal_tablet_size() const;
+  public:
+  void clear_tablet();
+  ::RAMCloud::ProtoBuf::Tablets_Tablet* mutable_tablet(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Tablets_Tablet >*
+      mutable_tablet();
+  private:
+  const ::RAMCloud::ProtoBuf::Tablets_Tablet& _internal_tablet(int index) const;
+  ::RAMCloud::ProtoBuf::Tablets_Tablet* _internal_add_tablet();
+  public:
+  const ::RAMCloud::ProtoBuf::Tablets_Tablet& tablet(int index) const;
+  ::RAMCloud::ProtoBuf::Tablets_Tablet* add_tablet();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Tablets_Tablet >&
+      tablet() const;
+
+  // repeated .RAMCloud.ProtoBuf.Indexlet indexlet = 2;
+  int indexlet_size() const;
+  private:
+  int _internal_indexlet_size() const;
+  public:
+  void clear_indexlet();
+  ::RAMCloud::ProtoBuf::Indexlet* mutable_indexlet(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Indexlet >*
+      mutable_indexlet();
+  private:
+  const ::RAMCloud::ProtoBuf::Indexlet& _internal_indexlet(int index) const;
+  ::RAMCloud::ProtoBuf::Indexlet* _internal_add_indexlet();
+  public:
+  const ::RAMCloud::ProtoBuf::Indexlet& indexlet(int index) const;
+  ::RAMCloud::ProtoBuf::Indexlet* add_indexlet();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Indexlet >&
+      indexlet() const;
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.RecoveryPartition)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Tablets_Tablet > tablet_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Indexlet > indexlet_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_RecoveryPartition_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RecoveryPartition
+
+// repeated .RAMCloud.ProtoBuf.Tablets.Tablet tablet = 1;
+inline int RecoveryPartition::_internal_tablet_size() const {
+  return _impl_.tablet_.size();
+}
+inline int RecoveryPartition::tablet_size() const {
+  return _internal_tablet_size();
+}
+inline ::RAMCloud::ProtoBuf::Tablets_Tablet* RecoveryPartition::mutable_tablet(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.RecoveryPartition.tablet)
+  return _impl_.tablet_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Tablets_Tablet >*
+RecoveryPartition::mutable_tablet() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.RecoveryPartition.tablet)
+  return &_impl_.tablet_;
+}
+inline const ::RAMCloud::ProtoBuf::Tablets_Tablet& RecoveryPartition::_internal_tablet(int index) const {
+  return _impl_.tablet_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::Tablets_Tablet& RecoveryPartition::tablet(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.RecoveryPartition.tablet)
+  return _internal_tablet(index);
+}
+inline ::RAMCloud::ProtoBuf::Tablets_Tablet* RecoveryPartition::_internal_add_tablet() {
+  return _impl_.tablet_.Add();
+}
+inline ::RAMCloud::ProtoBuf::Tablets_Tablet* RecoveryPartition::add_tablet() {
+  ::RAMCloud::ProtoBuf::Tablets_Tablet* _add = _internal_add_tablet();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.RecoveryPartition.tablet)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Tablets_Tablet >&
+RecoveryPartition::tablet() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.RecoveryPartition.tablet)
+  return _impl_.tablet_;
+}
+
+// repeated .RAMCloud.ProtoBuf.Indexlet indexlet = 2;
+inline int RecoveryPartition::_internal_indexlet_size() const {
+  return _impl_.indexlet_.size();
+}
+inline int RecoveryPartition::indexlet_size() const {
+  return _internal_indexlet_size();
+}
+inline ::RAMCloud::ProtoBuf::Indexlet* RecoveryPartition::mutable_indexlet(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.RecoveryPartition.indexlet)
+  return _impl_.indexlet_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Indexlet >*
+RecoveryPartition::mutable_indexlet() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.RecoveryPartition.indexlet)
+  return &_impl_.indexlet_;
+}
+inline const ::RAMCloud::ProtoBuf::Indexlet& RecoveryPartition::_internal_indexlet(int index) const {
+  return _impl_.indexlet_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::Indexlet& RecoveryPartition::indexlet(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.RecoveryPartition.indexlet)
+  return _internal_indexlet(index);
+}
+inline ::RAMCloud::ProtoBuf::Indexlet* RecoveryPartition::_internal_add_indexlet() {
+  return _impl_.indexlet_.Add();
+}
+inline ::RAMCloud::ProtoBuf::Indexlet* RecoveryPartition::add_indexlet() {
+  ::RAMCloud::ProtoBuf::Indexlet* _add = _internal_add_indexlet();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.RecoveryPartition.indexlet)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Indexlet >&
+RecoveryPartition::indexlet() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.RecoveryPartition.indexlet)
+  return _impl_.indexlet_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_RecoveryPartition_2eproto
+// RAMCloud pragma [GCCWARN=0]
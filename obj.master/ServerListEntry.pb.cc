@@ -0,0 +1,951 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerListEntry.proto
+
+#include "ServerListEntry.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR ServerListEntry_Update::ServerListEntry_Update(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.sequence_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_)*/0u} {}
+struct ServerListEntry_UpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerListEntry_UpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerListEntry_UpdateDefaultTypeInternal() {}
+  union {
+    ServerListEntry_Update _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerListEntry_UpdateDefaultTypeInternal _ServerListEntry_Update_default_instance_;
+PROTOBUF_CONSTEXPR ServerListEntry::ServerListEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.update_)*/{}
+  , /*decltype(_impl_.service_locator_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.master_recovery_info_)*/nullptr
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.services_)*/0u
+  , /*decltype(_impl_.expected_read_mbytes_per_sec_)*/0u
+  , /*decltype(_impl_.replication_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_)*/0u} {}
+struct ServerListEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerListEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerListEntryDefaultTypeInternal() {}
+  union {
+    ServerListEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerListEntryDefaultTypeInternal _ServerListEntry_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_ServerListEntry_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ServerListEntry_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ServerListEntry_2eproto = nullptr;
+
+const uint32_t TableStruct_ServerListEntry_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry_Update, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry_Update, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry_Update, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry_Update, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry_Update, _impl_.sequence_number_),
+  2,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry, _impl_.services_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry, _impl_.service_locator_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry, _impl_.expected_read_mbytes_per_sec_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry, _impl_.replication_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry, _impl_.master_recovery_info_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerListEntry, _impl_.update_),
+  3,
+  2,
+  0,
+  4,
+  6,
+  5,
+  1,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::RAMCloud::ProtoBuf::ServerListEntry_Update)},
+  { 12, 26, -1, sizeof(::RAMCloud::ProtoBuf::ServerListEntry)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_ServerListEntry_Update_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_ServerListEntry_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ServerListEntry_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\025ServerListEntry.proto\022\021RAMCloud.ProtoB"
+  "uf\032\030MasterRecoveryInfo.proto\"\341\002\n\017ServerL"
+  "istEntry\022\020\n\010services\030\001 \002(\007\022\021\n\tserver_id\030"
+  "\002 \002(\006\022\027\n\017service_locator\030\003 \002(\t\022$\n\034expect"
+  "ed_read_mbytes_per_sec\030\004 \002(\007\022\016\n\006status\030\005"
+  " \002(\007\022\026\n\016replication_id\030\006 \002(\006\022C\n\024master_r"
+  "ecovery_info\030\007 \002(\0132%.RAMCloud.ProtoBuf.M"
+  "asterRecoveryInfo\0229\n\006update\030\010 \003(\0132).RAMC"
+  "loud.ProtoBuf.ServerListEntry.Update\032B\n\006"
+  "Update\022\016\n\006status\030\001 \002(\007\022\017\n\007version\030\002 \002(\004\022"
+  "\027\n\017sequence_number\030\003 \002(\004"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_ServerListEntry_2eproto_deps[1] = {
+  &::descriptor_table_MasterRecoveryInfo_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_ServerListEntry_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ServerListEntry_2eproto = {
+    false, false, 424, descriptor_table_protodef_ServerListEntry_2eproto,
+    "ServerListEntry.proto",
+    &descriptor_table_ServerListEntry_2eproto_once, descriptor_table_ServerListEntry_2eproto_deps, 1, 2,
+    schemas, file_default_instances, TableStruct_ServerListEntry_2eproto::offsets,
+    file_level_metadata_ServerListEntry_2eproto, file_level_enum_descriptors_ServerListEntry_2eproto,
+    file_level_service_descriptors_ServerListEntry_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ServerListEntry_2eproto_getter() {
+  return &descriptor_table_ServerListEntry_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ServerListEntry_2eproto(&descriptor_table_ServerListEntry_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerListEntry_Update::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerListEntry_Update>()._impl_._has_bits_);
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sequence_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+ServerListEntry_Update::ServerListEntry_Update(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerListEntry.Update)
+}
+ServerListEntry_Update::ServerListEntry_Update(const ServerListEntry_Update& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerListEntry_Update* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.sequence_number_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerListEntry.Update)
+}
+
+inline void ServerListEntry_Update::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.sequence_number_){uint64_t{0u}}
+    , decltype(_impl_.status_){0u}
+  };
+}
+
+ServerListEntry_Update::~ServerListEntry_Update() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerListEntry.Update)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerListEntry_Update::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ServerListEntry_Update::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerListEntry_Update::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerListEntry.Update)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.status_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.status_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerListEntry_Update::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed32 status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_status(&has_bits);
+          _impl_.status_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 sequence_number = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sequence_number(&has_bits);
+          _impl_.sequence_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerListEntry_Update::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerListEntry.Update)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed32 status = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_status(), target);
+  }
+
+  // required uint64 version = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  // required uint64 sequence_number = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sequence_number(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerListEntry.Update)
+  return target;
+}
+
+size_t ServerListEntry_Update::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerListEntry.Update)
+  size_t total_size = 0;
+
+  if (_internal_has_version()) {
+    // required uint64 version = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  if (_internal_has_sequence_number()) {
+    // required uint64 sequence_number = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence_number());
+  }
+
+  if (_internal_has_status()) {
+    // required fixed32 status = 1;
+    total_size += 1 + 4;
+  }
+
+  return total_size;
+}
+size_t ServerListEntry_Update::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerListEntry.Update)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 version = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+
+    // required uint64 sequence_number = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence_number());
+
+    // required fixed32 status = 1;
+    total_size += 1 + 4;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerListEntry_Update::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerListEntry_Update::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerListEntry_Update::GetClassData() const { return &_class_data_; }
+
+
+void ServerListEntry_Update::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerListEntry_Update*>(&to_msg);
+  auto& from = static_cast<const ServerListEntry_Update&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerListEntry.Update)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.sequence_number_ = from._impl_.sequence_number_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerListEntry_Update::CopyFrom(const ServerListEntry_Update& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerListEntry.Update)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerListEntry_Update::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ServerListEntry_Update::InternalSwap(ServerListEntry_Update* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerListEntry_Update, _impl_.status_)
+      + sizeof(ServerListEntry_Update::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(ServerListEntry_Update, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerListEntry_Update::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerListEntry_2eproto_getter, &descriptor_table_ServerListEntry_2eproto_once,
+      file_level_metadata_ServerListEntry_2eproto[0]);
+}
+
+// ===================================================================
+
+class ServerListEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerListEntry>()._impl_._has_bits_);
+  static void set_has_services(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_service_locator(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_expected_read_mbytes_per_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_replication_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::RAMCloud::ProtoBuf::MasterRecoveryInfo& master_recovery_info(const ServerListEntry* msg);
+  static void set_has_master_recovery_info(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000007f) ^ 0x0000007f) != 0;
+  }
+};
+
+const ::RAMCloud::ProtoBuf::MasterRecoveryInfo&
+ServerListEntry::_Internal::master_recovery_info(const ServerListEntry* msg) {
+  return *msg->_impl_.master_recovery_info_;
+}
+void ServerListEntry::clear_master_recovery_info() {
+  if (_impl_.master_recovery_info_ != nullptr) _impl_.master_recovery_info_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+ServerListEntry::ServerListEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerListEntry)
+}
+ServerListEntry::ServerListEntry(const ServerListEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerListEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.update_){from._impl_.update_}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.master_recovery_info_){nullptr}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.services_){}
+    , decltype(_impl_.expected_read_mbytes_per_sec_){}
+    , decltype(_impl_.replication_id_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_service_locator()) {
+    _this->_impl_.service_locator_.Set(from._internal_service_locator(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_master_recovery_info()) {
+    _this->_impl_.master_recovery_info_ = new ::RAMCloud::ProtoBuf::MasterRecoveryInfo(*from._impl_.master_recovery_info_);
+  }
+  ::memcpy(&_impl_.server_id_, &from._impl_.server_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerListEntry)
+}
+
+inline void ServerListEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.update_){arena}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.master_recovery_info_){nullptr}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+    , decltype(_impl_.services_){0u}
+    , decltype(_impl_.expected_read_mbytes_per_sec_){0u}
+    , decltype(_impl_.replication_id_){uint64_t{0u}}
+    , decltype(_impl_.status_){0u}
+  };
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ServerListEntry::~ServerListEntry() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerListEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerListEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.update_.~RepeatedPtrField();
+  _impl_.service_locator_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.master_recovery_info_;
+}
+
+void ServerListEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerListEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerListEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.update_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.service_locator_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.master_recovery_info_ != nullptr);
+      _impl_.master_recovery_info_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000007cu) {
+    ::memset(&_impl_.server_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.status_) -
+        reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.status_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerListEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed32 services = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_services(&has_bits);
+          _impl_.services_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 server_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string service_locator = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_service_locator();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerListEntry.service_locator");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 expected_read_mbytes_per_sec = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_expected_read_mbytes_per_sec(&has_bits);
+          _impl_.expected_read_mbytes_per_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 status = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_status(&has_bits);
+          _impl_.status_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 replication_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_replication_id(&has_bits);
+          _impl_.replication_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_master_recovery_info(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RAMCloud.ProtoBuf.ServerListEntry.Update update = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_update(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerListEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerListEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed32 services = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_services(), target);
+  }
+
+  // required fixed64 server_id = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_server_id(), target);
+  }
+
+  // required string service_locator = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_service_locator().data(), static_cast<int>(this->_internal_service_locator().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerListEntry.service_locator");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_service_locator(), target);
+  }
+
+  // required fixed32 expected_read_mbytes_per_sec = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(4, this->_internal_expected_read_mbytes_per_sec(), target);
+  }
+
+  // required fixed32 status = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(5, this->_internal_status(), target);
+  }
+
+  // required fixed64 replication_id = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(6, this->_internal_replication_id(), target);
+  }
+
+  // required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 7;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::master_recovery_info(this),
+        _Internal::master_recovery_info(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.ServerListEntry.Update update = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_update_size()); i < n; i++) {
+    const auto& repfield = this->_internal_update(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerListEntry)
+  return target;
+}
+
+size_t ServerListEntry::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerListEntry)
+  size_t total_size = 0;
+
+  if (_internal_has_service_locator()) {
+    // required string service_locator = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_locator());
+  }
+
+  if (_internal_has_master_recovery_info()) {
+    // required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.master_recovery_info_);
+  }
+
+  if (_internal_has_server_id()) {
+    // required fixed64 server_id = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_services()) {
+    // required fixed32 services = 1;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_expected_read_mbytes_per_sec()) {
+    // required fixed32 expected_read_mbytes_per_sec = 4;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_replication_id()) {
+    // required fixed64 replication_id = 6;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_status()) {
+    // required fixed32 status = 5;
+    total_size += 1 + 4;
+  }
+
+  return total_size;
+}
+size_t ServerListEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerListEntry)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000007f) ^ 0x0000007f) == 0) {  // All required fields are present.
+    // required string service_locator = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_locator());
+
+    // required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.master_recovery_info_);
+
+    // required fixed64 server_id = 2;
+    total_size += 1 + 8;
+
+    // required fixed32 services = 1;
+    total_size += 1 + 4;
+
+    // required fixed32 expected_read_mbytes_per_sec = 4;
+    total_size += 1 + 4;
+
+    // required fixed64 replication_id = 6;
+    total_size += 1 + 8;
+
+    // required fixed32 status = 5;
+    total_size += 1 + 4;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.ServerListEntry.Update update = 8;
+  total_size += 1UL * this->_internal_update_size();
+  for (const auto& msg : this->_impl_.update_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerListEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerListEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerListEntry::GetClassData() const { return &_class_data_; }
+
+
+void ServerListEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerListEntry*>(&to_msg);
+  auto& from = static_cast<const ServerListEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerListEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.update_.MergeFrom(from._impl_.update_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_service_locator(from._internal_service_locator());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_master_recovery_info()->::RAMCloud::ProtoBuf::MasterRecoveryInfo::MergeFrom(
+          from._internal_master_recovery_info());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.services_ = from._impl_.services_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.expected_read_mbytes_per_sec_ = from._impl_.expected_read_mbytes_per_sec_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.replication_id_ = from._impl_.replication_id_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerListEntry::CopyFrom(const ServerListEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerListEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerListEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.update_))
+    return false;
+  return true;
+}
+
+void ServerListEntry::InternalSwap(ServerListEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.update_.InternalSwap(&other->_impl_.update_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_locator_, lhs_arena,
+      &other->_impl_.service_locator_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerListEntry, _impl_.status_)
+      + sizeof(ServerListEntry::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(ServerListEntry, _impl_.master_recovery_info_)>(
+          reinterpret_cast<char*>(&_impl_.master_recovery_info_),
+          reinterpret_cast<char*>(&other->_impl_.master_recovery_info_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerListEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerListEntry_2eproto_getter, &descriptor_table_ServerListEntry_2eproto_once,
+      file_level_metadata_ServerListEntry_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerListEntry_Update*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerListEntry_Update >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerListEntry_Update >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerListEntry*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerListEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerListEntry >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,1662 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: TableConfig.proto
+
+#include "TableConfig.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR TableConfig_Tablet::TableConfig_Tablet(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.service_locator_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.start_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.state_)*/0
+  , /*decltype(_impl_.ctime_log_head_offset_)*/0u
+  , /*decltype(_impl_.user_data_)*/uint64_t{0u}
+  , /*decltype(_impl_.ctime_log_head_id_)*/uint64_t{0u}} {}
+struct TableConfig_TabletDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TableConfig_TabletDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TableConfig_TabletDefaultTypeInternal() {}
+  union {
+    TableConfig_Tablet _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TableConfig_TabletDefaultTypeInternal _TableConfig_Tablet_default_instance_;
+PROTOBUF_CONSTEXPR TableConfig_Index_Indexlet::TableConfig_Index_Indexlet(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.start_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.end_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.service_locator_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}} {}
+struct TableConfig_Index_IndexletDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TableConfig_Index_IndexletDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TableConfig_Index_IndexletDefaultTypeInternal() {}
+  union {
+    TableConfig_Index_Indexlet _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TableConfig_Index_IndexletDefaultTypeInternal _TableConfig_Index_Indexlet_default_instance_;
+PROTOBUF_CONSTEXPR TableConfig_Index::TableConfig_Index(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.indexlet_)*/{}
+  , /*decltype(_impl_.index_id_)*/0u
+  , /*decltype(_impl_.index_type_)*/0u} {}
+struct TableConfig_IndexDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TableConfig_IndexDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TableConfig_IndexDefaultTypeInternal() {}
+  union {
+    TableConfig_Index _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TableConfig_IndexDefaultTypeInternal _TableConfig_Index_default_instance_;
+PROTOBUF_CONSTEXPR TableConfig::TableConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tablet_)*/{}
+  , /*decltype(_impl_.index_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TableConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TableConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TableConfigDefaultTypeInternal() {}
+  union {
+    TableConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TableConfigDefaultTypeInternal _TableConfig_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_TableConfig_2eproto[4];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_TableConfig_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_TableConfig_2eproto = nullptr;
+
+const uint32_t TableStruct_TableConfig_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _impl_.table_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _impl_.start_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _impl_.end_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _impl_.service_locator_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _impl_.user_data_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _impl_.ctime_log_head_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Tablet, _impl_.ctime_log_head_offset_),
+  1,
+  2,
+  3,
+  5,
+  4,
+  0,
+  7,
+  8,
+  6,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet, _impl_.start_key_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet, _impl_.end_key_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet, _impl_.service_locator_),
+  0,
+  1,
+  3,
+  2,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index, _impl_.index_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index, _impl_.index_type_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig_Index, _impl_.indexlet_),
+  0,
+  1,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig, _impl_.tablet_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TableConfig, _impl_.index_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, -1, sizeof(::RAMCloud::ProtoBuf::TableConfig_Tablet)},
+  { 24, 34, -1, sizeof(::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet)},
+  { 38, 47, -1, sizeof(::RAMCloud::ProtoBuf::TableConfig_Index)},
+  { 50, -1, -1, sizeof(::RAMCloud::ProtoBuf::TableConfig)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_TableConfig_Tablet_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_TableConfig_Index_Indexlet_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_TableConfig_Index_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_TableConfig_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_TableConfig_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021TableConfig.proto\022\021RAMCloud.ProtoBuf\"\205"
+  "\005\n\013TableConfig\0225\n\006tablet\030\001 \003(\0132%.RAMClou"
+  "d.ProtoBuf.TableConfig.Tablet\0223\n\005index\030\002"
+  " \003(\0132$.RAMCloud.ProtoBuf.TableConfig.Ind"
+  "ex\032\274\002\n\006Tablet\022\020\n\010table_id\030\001 \002(\004\022\026\n\016start"
+  "_key_hash\030\002 \002(\004\022\024\n\014end_key_hash\030\003 \002(\004\022:\n"
+  "\005state\030\004 \002(\0162+.RAMCloud.ProtoBuf.TableCo"
+  "nfig.Tablet.State\022\021\n\tserver_id\030\005 \001(\006\022\027\n\017"
+  "service_locator\030\006 \001(\t\022\021\n\tuser_data\030\007 \001(\006"
+  "\022\031\n\021ctime_log_head_id\030\010 \002(\004\022\035\n\025ctime_log"
+  "_head_offset\030\t \002(\r\"=\n\005State\022\n\n\006NORMAL\020\000\022"
+  "\016\n\nRECOVERING\020\001\022\030\n\024RECOVERING_READ_ONLY\020"
+  "\002\032\312\001\n\005Index\022\020\n\010index_id\030\001 \002(\r\022\022\n\nindex_t"
+  "ype\030\002 \002(\r\022\?\n\010indexlet\030\003 \003(\0132-.RAMCloud.P"
+  "rotoBuf.TableConfig.Index.Indexlet\032Z\n\010In"
+  "dexlet\022\021\n\tstart_key\030\001 \002(\014\022\017\n\007end_key\030\002 \002"
+  "(\014\022\021\n\tserver_id\030\003 \002(\006\022\027\n\017service_locator"
+  "\030\004 \002(\t"
+  ;
+static ::_pbi::once_flag descriptor_table_TableConfig_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_TableConfig_2eproto = {
+    false, false, 686, descriptor_table_protodef_TableConfig_2eproto,
+    "TableConfig.proto",
+    &descriptor_table_TableConfig_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_TableConfig_2eproto::offsets,
+    file_level_metadata_TableConfig_2eproto, file_level_enum_descriptors_TableConfig_2eproto,
+    file_level_service_descriptors_TableConfig_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_TableConfig_2eproto_getter() {
+  return &descriptor_table_TableConfig_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_TableConfig_2eproto(&descriptor_table_TableConfig_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TableConfig_Tablet_State_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_TableConfig_2eproto);
+  return file_level_enum_descriptors_TableConfig_2eproto[0];
+}
+bool TableConfig_Tablet_State_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TableConfig_Tablet_State TableConfig_Tablet::NORMAL;
+constexpr TableConfig_Tablet_State TableConfig_Tablet::RECOVERING;
+constexpr TableConfig_Tablet_State TableConfig_Tablet::RECOVERING_READ_ONLY;
+constexpr TableConfig_Tablet_State TableConfig_Tablet::State_MIN;
+constexpr TableConfig_Tablet_State TableConfig_Tablet::State_MAX;
+constexpr int TableConfig_Tablet::State_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class TableConfig_Tablet::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TableConfig_Tablet>()._impl_._has_bits_);
+  static void set_has_table_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_start_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_end_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_service_locator(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_user_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_ctime_log_head_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_ctime_log_head_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000016e) ^ 0x0000016e) != 0;
+  }
+};
+
+TableConfig_Tablet::TableConfig_Tablet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.TableConfig.Tablet)
+}
+TableConfig_Tablet::TableConfig_Tablet(const TableConfig_Tablet& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TableConfig_Tablet* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.table_id_){}
+    , decltype(_impl_.start_key_hash_){}
+    , decltype(_impl_.end_key_hash_){}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.ctime_log_head_offset_){}
+    , decltype(_impl_.user_data_){}
+    , decltype(_impl_.ctime_log_head_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_service_locator()) {
+    _this->_impl_.service_locator_.Set(from._internal_service_locator(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.table_id_, &from._impl_.table_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ctime_log_head_id_) -
+    reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.ctime_log_head_id_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.TableConfig.Tablet)
+}
+
+inline void TableConfig_Tablet::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.table_id_){uint64_t{0u}}
+    , decltype(_impl_.start_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.end_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+    , decltype(_impl_.state_){0}
+    , decltype(_impl_.ctime_log_head_offset_){0u}
+    , decltype(_impl_.user_data_){uint64_t{0u}}
+    , decltype(_impl_.ctime_log_head_id_){uint64_t{0u}}
+  };
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TableConfig_Tablet::~TableConfig_Tablet() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.TableConfig.Tablet)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TableConfig_Tablet::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_locator_.Destroy();
+}
+
+void TableConfig_Tablet::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TableConfig_Tablet::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.TableConfig.Tablet)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.service_locator_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.table_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.user_data_) -
+        reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.user_data_));
+  }
+  _impl_.ctime_log_head_id_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TableConfig_Tablet::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 table_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_table_id(&has_bits);
+          _impl_.table_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 start_key_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_start_key_hash(&has_bits);
+          _impl_.start_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end_key_hash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_end_key_hash(&has_bits);
+          _impl_.end_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.TableConfig.Tablet.State state = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::RAMCloud::ProtoBuf::TableConfig_Tablet_State_IsValid(val))) {
+            _internal_set_state(static_cast<::RAMCloud::ProtoBuf::TableConfig_Tablet_State>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 server_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string service_locator = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_service_locator();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.TableConfig.Tablet.service_locator");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 user_data = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_user_data(&has_bits);
+          _impl_.user_data_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 ctime_log_head_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_ctime_log_head_id(&has_bits);
+          _impl_.ctime_log_head_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 ctime_log_head_offset = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_ctime_log_head_offset(&has_bits);
+          _impl_.ctime_log_head_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TableConfig_Tablet::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.TableConfig.Tablet)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 table_id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_table_id(), target);
+  }
+
+  // required uint64 start_key_hash = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_start_key_hash(), target);
+  }
+
+  // required uint64 end_key_hash = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_end_key_hash(), target);
+  }
+
+  // required .RAMCloud.ProtoBuf.TableConfig.Tablet.State state = 4;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_state(), target);
+  }
+
+  // optional fixed64 server_id = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(5, this->_internal_server_id(), target);
+  }
+
+  // optional string service_locator = 6;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_service_locator().data(), static_cast<int>(this->_internal_service_locator().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.TableConfig.Tablet.service_locator");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_service_locator(), target);
+  }
+
+  // optional fixed64 user_data = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(7, this->_internal_user_data(), target);
+  }
+
+  // required uint64 ctime_log_head_id = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_ctime_log_head_id(), target);
+  }
+
+  // required uint32 ctime_log_head_offset = 9;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_ctime_log_head_offset(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.TableConfig.Tablet)
+  return target;
+}
+
+size_t TableConfig_Tablet::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.TableConfig.Tablet)
+  size_t total_size = 0;
+
+  if (_internal_has_table_id()) {
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+  }
+
+  if (_internal_has_start_key_hash()) {
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+  }
+
+  if (_internal_has_end_key_hash()) {
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+  }
+
+  if (_internal_has_state()) {
+    // required .RAMCloud.ProtoBuf.TableConfig.Tablet.State state = 4;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+  }
+
+  if (_internal_has_ctime_log_head_offset()) {
+    // required uint32 ctime_log_head_offset = 9;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ctime_log_head_offset());
+  }
+
+  if (_internal_has_ctime_log_head_id()) {
+    // required uint64 ctime_log_head_id = 8;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ctime_log_head_id());
+  }
+
+  return total_size;
+}
+size_t TableConfig_Tablet::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.TableConfig.Tablet)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000016e) ^ 0x0000016e) == 0) {  // All required fields are present.
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+
+    // required .RAMCloud.ProtoBuf.TableConfig.Tablet.State state = 4;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+
+    // required uint32 ctime_log_head_offset = 9;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ctime_log_head_offset());
+
+    // required uint64 ctime_log_head_id = 8;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ctime_log_head_id());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string service_locator = 6;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_locator());
+  }
+
+  // optional fixed64 server_id = 5;
+  if (cached_has_bits & 0x00000010u) {
+    total_size += 1 + 8;
+  }
+
+  // optional fixed64 user_data = 7;
+  if (cached_has_bits & 0x00000080u) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TableConfig_Tablet::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TableConfig_Tablet::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TableConfig_Tablet::GetClassData() const { return &_class_data_; }
+
+
+void TableConfig_Tablet::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TableConfig_Tablet*>(&to_msg);
+  auto& from = static_cast<const TableConfig_Tablet&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.TableConfig.Tablet)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_service_locator(from._internal_service_locator());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.table_id_ = from._impl_.table_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.start_key_hash_ = from._impl_.start_key_hash_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.end_key_hash_ = from._impl_.end_key_hash_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.state_ = from._impl_.state_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.ctime_log_head_offset_ = from._impl_.ctime_log_head_offset_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.user_data_ = from._impl_.user_data_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_ctime_log_head_id(from._internal_ctime_log_head_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TableConfig_Tablet::CopyFrom(const TableConfig_Tablet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.TableConfig.Tablet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TableConfig_Tablet::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void TableConfig_Tablet::InternalSwap(TableConfig_Tablet* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_locator_, lhs_arena,
+      &other->_impl_.service_locator_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TableConfig_Tablet, _impl_.ctime_log_head_id_)
+      + sizeof(TableConfig_Tablet::_impl_.ctime_log_head_id_)
+      - PROTOBUF_FIELD_OFFSET(TableConfig_Tablet, _impl_.table_id_)>(
+          reinterpret_cast<char*>(&_impl_.table_id_),
+          reinterpret_cast<char*>(&other->_impl_.table_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TableConfig_Tablet::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_TableConfig_2eproto_getter, &descriptor_table_TableConfig_2eproto_once,
+      file_level_metadata_TableConfig_2eproto[0]);
+}
+
+// ===================================================================
+
+class TableConfig_Index_Indexlet::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TableConfig_Index_Indexlet>()._impl_._has_bits_);
+  static void set_has_start_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_end_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_service_locator(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+TableConfig_Index_Indexlet::TableConfig_Index_Indexlet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+}
+TableConfig_Index_Indexlet::TableConfig_Index_Indexlet(const TableConfig_Index_Indexlet& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TableConfig_Index_Indexlet* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_key_){}
+    , decltype(_impl_.end_key_){}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.server_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.start_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_start_key()) {
+    _this->_impl_.start_key_.Set(from._internal_start_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.end_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_end_key()) {
+    _this->_impl_.end_key_.Set(from._internal_end_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_service_locator()) {
+    _this->_impl_.service_locator_.Set(from._internal_service_locator(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.server_id_ = from._impl_.server_id_;
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+}
+
+inline void TableConfig_Index_Indexlet::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_key_){}
+    , decltype(_impl_.end_key_){}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+  };
+  _impl_.start_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.end_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TableConfig_Index_Indexlet::~TableConfig_Index_Indexlet() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TableConfig_Index_Indexlet::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.start_key_.Destroy();
+  _impl_.end_key_.Destroy();
+  _impl_.service_locator_.Destroy();
+}
+
+void TableConfig_Index_Indexlet::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TableConfig_Index_Indexlet::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.start_key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.end_key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.service_locator_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TableConfig_Index_Indexlet::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes start_key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_start_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes end_key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_end_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 server_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string service_locator = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_service_locator();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.service_locator");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TableConfig_Index_Indexlet::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes start_key = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_start_key(), target);
+  }
+
+  // required bytes end_key = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_end_key(), target);
+  }
+
+  // required fixed64 server_id = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_server_id(), target);
+  }
+
+  // required string service_locator = 4;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_service_locator().data(), static_cast<int>(this->_internal_service_locator().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.service_locator");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_service_locator(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+  return target;
+}
+
+size_t TableConfig_Index_Indexlet::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+  size_t total_size = 0;
+
+  if (_internal_has_start_key()) {
+    // required bytes start_key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_start_key());
+  }
+
+  if (_internal_has_end_key()) {
+    // required bytes end_key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_end_key());
+  }
+
+  if (_internal_has_service_locator()) {
+    // required string service_locator = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_locator());
+  }
+
+  if (_internal_has_server_id()) {
+    // required fixed64 server_id = 3;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t TableConfig_Index_Indexlet::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required bytes start_key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_start_key());
+
+    // required bytes end_key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_end_key());
+
+    // required string service_locator = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_locator());
+
+    // required fixed64 server_id = 3;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TableConfig_Index_Indexlet::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TableConfig_Index_Indexlet::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TableConfig_Index_Indexlet::GetClassData() const { return &_class_data_; }
+
+
+void TableConfig_Index_Indexlet::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TableConfig_Index_Indexlet*>(&to_msg);
+  auto& from = static_cast<const TableConfig_Index_Indexlet&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_start_key(from._internal_start_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_end_key(from._internal_end_key());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_service_locator(from._internal_service_locator());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TableConfig_Index_Indexlet::CopyFrom(const TableConfig_Index_Indexlet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TableConfig_Index_Indexlet::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void TableConfig_Index_Indexlet::InternalSwap(TableConfig_Index_Indexlet* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.start_key_, lhs_arena,
+      &other->_impl_.start_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.end_key_, lhs_arena,
+      &other->_impl_.end_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_locator_, lhs_arena,
+      &other->_impl_.service_locator_, rhs_arena
+  );
+  swap(_impl_.server_id_, other->_impl_.server_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TableConfig_Index_Indexlet::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_TableConfig_2eproto_getter, &descriptor_table_TableConfig_2eproto_once,
+      file_level_metadata_TableConfig_2eproto[1]);
+}
+
+// ===================================================================
+
+class TableConfig_Index::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TableConfig_Index>()._impl_._has_bits_);
+  static void set_has_index_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_index_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+TableConfig_Index::TableConfig_Index(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.TableConfig.Index)
+}
+TableConfig_Index::TableConfig_Index(const TableConfig_Index& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TableConfig_Index* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.indexlet_){from._impl_.indexlet_}
+    , decltype(_impl_.index_id_){}
+    , decltype(_impl_.index_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.index_id_, &from._impl_.index_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.index_type_) -
+    reinterpret_cast<char*>(&_impl_.index_id_)) + sizeof(_impl_.index_type_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.TableConfig.Index)
+}
+
+inline void TableConfig_Index::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.indexlet_){arena}
+    , decltype(_impl_.index_id_){0u}
+    , decltype(_impl_.index_type_){0u}
+  };
+}
+
+TableConfig_Index::~TableConfig_Index() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.TableConfig.Index)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TableConfig_Index::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.indexlet_.~RepeatedPtrField();
+}
+
+void TableConfig_Index::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TableConfig_Index::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.TableConfig.Index)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.indexlet_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.index_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.index_type_) -
+        reinterpret_cast<char*>(&_impl_.index_id_)) + sizeof(_impl_.index_type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TableConfig_Index::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 index_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_index_id(&has_bits);
+          _impl_.index_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 index_type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_index_type(&has_bits);
+          _impl_.index_type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RAMCloud.ProtoBuf.TableConfig.Index.Indexlet indexlet = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_indexlet(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TableConfig_Index::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.TableConfig.Index)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 index_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_index_id(), target);
+  }
+
+  // required uint32 index_type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_index_type(), target);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.TableConfig.Index.Indexlet indexlet = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_indexlet_size()); i < n; i++) {
+    const auto& repfield = this->_internal_indexlet(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.TableConfig.Index)
+  return target;
+}
+
+size_t TableConfig_Index::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.TableConfig.Index)
+  size_t total_size = 0;
+
+  if (_internal_has_index_id()) {
+    // required uint32 index_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index_id());
+  }
+
+  if (_internal_has_index_type()) {
+    // required uint32 index_type = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index_type());
+  }
+
+  return total_size;
+}
+size_t TableConfig_Index::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.TableConfig.Index)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint32 index_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index_id());
+
+    // required uint32 index_type = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.TableConfig.Index.Indexlet indexlet = 3;
+  total_size += 1UL * this->_internal_indexlet_size();
+  for (const auto& msg : this->_impl_.indexlet_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TableConfig_Index::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TableConfig_Index::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TableConfig_Index::GetClassData() const { return &_class_data_; }
+
+
+void TableConfig_Index::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TableConfig_Index*>(&to_msg);
+  auto& from = static_cast<const TableConfig_Index&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.TableConfig.Index)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.indexlet_.MergeFrom(from._impl_.indexlet_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.index_id_ = from._impl_.index_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.index_type_ = from._impl_.index_type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TableConfig_Index::CopyFrom(const TableConfig_Index& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.TableConfig.Index)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TableConfig_Index::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.indexlet_))
+    return false;
+  return true;
+}
+
+void TableConfig_Index::InternalSwap(TableConfig_Index* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.indexlet_.InternalSwap(&other->_impl_.indexlet_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TableConfig_Index, _impl_.index_type_)
+      + sizeof(TableConfig_Index::_impl_.index_type_)
+      - PROTOBUF_FIELD_OFFSET(TableConfig_Index, _impl_.index_id_)>(
+          reinterpret_cast<char*>(&_impl_.index_id_),
+          reinterpret_cast<char*>(&other->_impl_.index_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TableConfig_Index::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_TableConfig_2eproto_getter, &descriptor_table_TableConfig_2eproto_once,
+      file_level_metadata_TableConfig_2eproto[2]);
+}
+
+// ===================================================================
+
+class TableConfig::_Internal {
+ public:
+};
+
+TableConfig::TableConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.TableConfig)
+}
+TableConfig::TableConfig(const TableConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TableConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tablet_){from._impl_.tablet_}
+    , decltype(_impl_.index_){from._impl_.index_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.TableConfig)
+}
+
+inline void TableConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tablet_){arena}
+    , decltype(_impl_.index_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TableConfig::~TableConfig() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.TableConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TableConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tablet_.~RepeatedPtrField();
+  _impl_.index_.~RepeatedPtrField();
+}
+
+void TableConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TableConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.TableConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tablet_.Clear();
+  _impl_.index_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TableConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .RAMCloud.ProtoBuf.TableConfig.Tablet tablet = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_tablet(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RAMCloud.ProtoBuf.TableConfig.Index index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_index(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TableConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.TableConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.TableConfig.Tablet tablet = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tablet_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tablet(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.TableConfig.Index index = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_index_size()); i < n; i++) {
+    const auto& repfield = this->_internal_index(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.TableConfig)
+  return target;
+}
+
+size_t TableConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.TableConfig)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.TableConfig.Tablet tablet = 1;
+  total_size += 1UL * this->_internal_tablet_size();
+  for (const auto& msg : this->_impl_.tablet_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.TableConfig.Index index = 2;
+  total_size += 1UL * this->_internal_index_size();
+  for (const auto& msg : this->_impl_.index_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TableConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TableConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TableConfig::GetClassData() const { return &_class_data_; }
+
+
+void TableConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TableConfig*>(&to_msg);
+  auto& from = static_cast<const TableConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.TableConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.tablet_.MergeFrom(from._impl_.tablet_);
+  _this->_impl_.index_.MergeFrom(from._impl_.index_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TableConfig::CopyFrom(const TableConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.TableConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TableConfig::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.tablet_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.index_))
+    return false;
+  return true;
+}
+
+void TableConfig::InternalSwap(TableConfig* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.tablet_.InternalSwap(&other->_impl_.tablet_);
+  _impl_.index_.InternalSwap(&other->_impl_.index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TableConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_TableConfig_2eproto_getter, &descriptor_table_TableConfig_2eproto_once,
+      file_level_metadata_TableConfig_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::TableConfig_Tablet*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::TableConfig_Tablet >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::TableConfig_Tablet >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::TableConfig_Index*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::TableConfig_Index >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::TableConfig_Index >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::TableConfig*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::TableConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::TableConfig >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -331,6 +331,9 @@ def default(
     This function is used as the invocation function for most tests;
     it simply invokes ClusterPerf via cluster.run and prints the result.
     """
+    if options.forward_backup_writes:
+        cluster_args['master_args'] = '%s --forwardBackupWrites' % \
+                cluster_args.get('master_args', '')
     cluster.run(client='%s/apps/ClusterPerf %s %s' %
             (config.hooks.get_remote_obj_path(),
              flatten_args(client_args), name), **cluster_args)
@@ -900,6 +903,12 @@ if __name__ == '__main__':
             dest='master_args',
             help='Additional command-line arguments to pass to '
                  'each master')
+    parser.add_option('--forwardBackupWrites', action='store_true',
+            dest='forward_backup_writes', default=False,
+            help='Have the backup storing the primary replica of each '
+                 'segment forward replica writes to the secondary replicas, '
+                 'instead of the master sending them to every backup '
+                 '(compare writeThroughput with and without this)')
     parser.add_option('--dpdkPort', type=int, dest='dpdk_port',
             help='Ethernet port that the DPDK driver should use')
     parser.add_option('-T', '--transport', default='basic+infud',
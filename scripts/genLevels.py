@@ -42,6 +42,7 @@ import sys
 # the Opcode enum in WireFormat.h.
 
 callees = {
+    "BACKUP_WRITE_FORWARD":  ["BACKUP_WRITE"],
     "COORD_SPLIT_AND_MIGRATE_INDEXLET":
                              ["SPLIT_AND_MIGRATE_INDEXLET",
                               "TAKE_TABLET_OWNERSHIP",
@@ -51,32 +52,73 @@ callees = {
     "CREATE_TABLE":          ["TAKE_TABLET_OWNERSHIP"],
     "DROP_INDEX":            ["DROP_TABLET_OWNERSHIP"],
     "DROP_TABLE":            ["TAKE_TABLET_OWNERSHIP"],
-    "FILL_WITH_TEST_DATA":   ["BACKUP_WRITE"],
-    "GET_HEAD_OF_LOG":       ["BACKUP_WRITE"],
+    "FILL_WITH_TEST_DATA":   ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "GET_HEAD_OF_LOG":       ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
     "HINT_SERVER_CRASHED":   ["PING"],
-    "INCREMENT":             ["BACKUP_WRITE"],
-    "INSERT_INDEX_ENTRY":    ["BACKUP_WRITE"],
-    "MIGRATE_TABLET":        ["RECEIVE_MIGRATION_DATA",
+    "INCREMENT":             ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "INSERT_INDEX_ENTRY":    ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "MIGRATE_TABLET":        ["PULL_TABLET", "RECEIVE_MIGRATION_DATA",
                               "REASSIGN_TABLET_OWNERSHIP"],
-    "MULTI_OP":              ["BACKUP_WRITE", "INSERT_INDEX_ENTRY",
+    "MULTI_OP":              ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT", "INSERT_INDEX_ENTRY",
                               "REMOVE_INDEX_ENTRY"],
-    "READ":                  ["BACKUP_WRITE"],
-    "READ_HASHES":           ["BACKUP_WRITE"],
-    "READ_KEYS_AND_VALUE":   ["BACKUP_WRITE"],
+    "PULL_TABLET":           ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT", "PULL_TABLET_DATA",
+                              "REASSIGN_TABLET_OWNERSHIP"],
+    "READ":                  ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "READ_HASHES":           ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "READ_KEYS_AND_VALUE":   ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
     "REASSIGN_TABLET_OWNERSHIP": ["TAKE_TABLET_OWNERSHIP"],
-    "RECEIVE_MIGRATION_DATA":["BACKUP_WRITE"],
-    "RECOVER":               ["BACKUP_GETRECOVERYDATA", "BACKUP_WRITE"],
-    "REMOVE":                ["BACKUP_WRITE", "REMOVE_INDEX_ENTRY"],
-    "REMOVE_INDEX_ENTRY":    ["BACKUP_WRITE"],
+    "RECEIVE_MIGRATION_DATA":["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "RECOVER":               ["BACKUP_GETRECOVERYDATA", "BACKUP_WRITE",
+                              "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "REMOVE":                ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT", "REMOVE_INDEX_ENTRY"],
+    "REMOVE_INDEX_ENTRY":    ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
     "SERVER_CONTROL_ALL":    ["SERVER_CONTROL"],
     "SPLIT_AND_MIGRATE_INDEXLET":
                              ["RECEIVE_MIGRATION_DATA"],
-    "TAKE_TABLET_OWNERSHIP": ["BACKUP_WRITE"],
-    "TX_DECISION":           ["BACKUP_WRITE"],
-    "TX_HINT_FAILED":        ["BACKUP_WRITE"],
-    "TX_PREPARE":            ["BACKUP_WRITE"],
-    "TX_REQUEST_ABORT":      ["BACKUP_WRITE"],
-    "WRITE":                 ["BACKUP_WRITE", "INSERT_INDEX_ENTRY",
+    "TAKE_TABLET_OWNERSHIP": ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "TX_DECISION":           ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "TX_HINT_FAILED":        ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "TX_PREPARE":            ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "TX_REQUEST_ABORT":      ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT"],
+    "WRITE":                 ["BACKUP_WRITE", "BACKUP_WRITE_BATCH",
+                              "BACKUP_WRITE_FORWARD", "BACKUP_GETLOAD",
+                              "BACKUP_WRITE_FRAGMENT", "INSERT_INDEX_ENTRY",
                               "REMOVE_INDEX_ENTRY"],
 }
 
@@ -21,6 +21,8 @@
 #include "PerfStats.h"
 #include "ServerConfig.h"
 #include "ShortMacros.h"
+#include "SlowRpcLog.h"
+#include "TimeTrace.h"
 
 namespace RAMCloud {
 
@@ -56,7 +58,8 @@ AbstractLog::AbstractLog(LogEntryHandlers* entryHandlers,
 {
     SegletAllocator& alloc = segmentManager->getAllocator();
     maxLiveBytes = static_cast<uint64_t>(0.95 * alloc.getSegletSize() *
-            static_cast<double>(alloc.getTotalCount(SegletAllocator::DEFAULT)));
+            static_cast<double>(alloc.getTotalCount(SegletAllocator::DEFAULT) +
+                                alloc.getTotalCount(SegletAllocator::COLD)));
 }
 
 /**
@@ -82,6 +85,8 @@ bool
 AbstractLog::append(AppendVector* appends, uint32_t numAppends)
 {
     CycleCounter<uint64_t> _(&metrics.totalAppendTicks);
+    CycleCounter<uint64_t> appendTimer(
+            &SlowRpcLog::threadTimes.logAppendCycles);
     SpinLock::Guard lock(appendLock);
     metrics.totalAppendCalls++;
 
@@ -112,6 +117,7 @@ AbstractLog::append(AppendVector* appends, uint32_t numAppends)
     if (head != headBefore) {
         assert(head == headBefore);
     }
+    TimeTrace::recordSampled("trace %u: appended %u log entries", numAppends);
 
     return true;
 }
@@ -134,6 +140,8 @@ AbstractLog::append(Buffer *logBuffer, Reference *references,
                     uint32_t numEntries)
 {
     CycleCounter<uint64_t> _(&metrics.totalAppendTicks);
+    CycleCounter<uint64_t> appendTimer(
+            &SlowRpcLog::threadTimes.logAppendCycles);
     SpinLock::Guard lock(appendLock);
     metrics.totalAppendCalls++;
 
@@ -174,6 +182,7 @@ AbstractLog::append(Buffer *logBuffer, Reference *references,
     if (head != headBefore) {
         assert(head == headBefore);
     }
+    TimeTrace::recordSampled("trace %u: appended %u log entries", numEntries);
 
     return true;
 }
@@ -250,6 +259,7 @@ AbstractLog::getMemoryStats(PerfStats* stats)
     stats->logUsedBytesInBackups = segmentManager->getSegmentsOnDisk() *
                                    replicaManager->numReplicas *
                                    segmentSize;
+    stats->logPageBytes = alloc.getPageSize();
 }
 
 /**
@@ -594,7 +604,8 @@ AbstractLog::allocNewWritableHead()
 
     SegletAllocator& alloc = segmentManager->getAllocator();
     maxLiveBytes = static_cast<uint64_t>(0.95 * alloc.getSegletSize() *
-            static_cast<double>(alloc.getTotalCount(SegletAllocator::DEFAULT)));
+            static_cast<double>(alloc.getTotalCount(SegletAllocator::DEFAULT) +
+                                alloc.getTotalCount(SegletAllocator::COLD)));
 
     return true;
 }
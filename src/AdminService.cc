@@ -25,6 +25,7 @@
 #include "AdminClient.h"
 #include "AdminService.h"
 #include "ServerList.h"
+#include "SlowRpcLog.h"
 #include "TimeTrace.h"
 #include "CacheTrace.h"
 
@@ -322,9 +323,36 @@ AdminService::serverControl(const WireFormat::ServerControl::Request* reqHdr,
             MasterService* masterService = context->getMasterService();
             if (masterService) {
                 masterService->objectManager.getLog()->getMemoryStats(&stats);
+                stats.hashTablePageBytes = masterService->objectManager
+                        .getObjectMap()->getPageSize();
             }
             respHdr->outputLength = sizeof32(stats);
             rpc->replyPayload->appendCopy(&stats, respHdr->outputLength);
+
+            // Per-opcode hardware counts (if any) follow the PerfStats.
+            PerfStats::HardwareCountMap hardwareCounts;
+            PerfStats::collectHardwareCounts(&hardwareCounts);
+            foreach (PerfStats::HardwareCountMap::value_type& entry,
+                    hardwareCounts) {
+                PerfStats::OpcodeHardwareCounts opcodeCounts;
+                opcodeCounts.opcode = downCast<uint32_t>(entry.first);
+                opcodeCounts.counts = entry.second;
+                rpc->replyPayload->appendCopy(&opcodeCounts);
+                respHdr->outputLength += sizeof32(opcodeCounts);
+            }
+            break;
+        }
+        case WireFormat::GET_VALUE_COMPRESSION_STATS:
+        {
+            MasterService* masterService = context->getMasterService();
+            if (masterService == NULL) {
+                respHdr->common.status = STATUS_UNIMPLEMENTED_REQUEST;
+                return;
+            }
+            string s = masterService->objectManager.getValueCompressor()
+                    ->getStats();
+            respHdr->outputLength = downCast<uint32_t>(s.length());
+            rpc->replyPayload->appendCopy(s.c_str(), respHdr->outputLength);
             break;
         }
         case WireFormat::GET_TIME_TRACE:
@@ -334,6 +362,43 @@ AdminService::serverControl(const WireFormat::ServerControl::Request* reqHdr,
             rpc->replyPayload->appendCopy(s.c_str(), respHdr->outputLength);
             break;
         }
+        case WireFormat::GET_SAMPLED_TIME_TRACE:
+        {
+            string s = TimeTrace::getSampledTrace();
+            respHdr->outputLength = downCast<uint32_t>(s.length());
+            rpc->replyPayload->appendCopy(s.c_str(), respHdr->outputLength);
+            break;
+        }
+        case WireFormat::SET_TIME_TRACE_SAMPLING:
+        {
+            if (rpc->requestPayload->getOffset<uint32_t>(reqOffset) == NULL) {
+                respHdr->common.status = STATUS_MESSAGE_TOO_SHORT;
+                return;
+            }
+            const uint32_t* interval = (const uint32_t*) inputData;
+            TimeTrace::setSampleInterval(*interval);
+            break;
+        }
+        case WireFormat::GET_SLOW_RPCS:
+        {
+            std::vector<SlowRpcLog::Entry> entries;
+            SlowRpcLog::getEntries(&entries);
+            respHdr->outputLength = downCast<uint32_t>(
+                    entries.size() * sizeof(SlowRpcLog::Entry));
+            rpc->replyPayload->appendCopy(entries.data(),
+                    respHdr->outputLength);
+            break;
+        }
+        case WireFormat::SET_SLOW_RPC_THRESHOLD:
+        {
+            if (rpc->requestPayload->getOffset<uint32_t>(reqOffset) == NULL) {
+                respHdr->common.status = STATUS_MESSAGE_TOO_SHORT;
+                return;
+            }
+            const uint32_t* microseconds = (const uint32_t*) inputData;
+            SlowRpcLog::setThreshold(*microseconds);
+            break;
+        }
         case WireFormat::LOG_MESSAGE:
         {
             const LogLevel* logLevel = (const LogLevel*) inputData;
@@ -31,6 +31,7 @@
 #include "RawMetrics.h"
 #include "ServerList.h"
 #include "ServerMetrics.h"
+#include "SlowRpcLog.h"
 #include "Tablets.pb.h"
 #include "TimeTrace.h"
 #include "TransportManager.h"
@@ -594,6 +595,31 @@ TEST_F(AdminServiceTest, serverControl_logCacheTrace) {
     Util::mockPmcValue = 0;
 }
 
+TEST_F(AdminServiceTest, serverControl_slowRpcs) {
+    Buffer output;
+    uint32_t microseconds = 5;
+
+    SlowRpcLog::reset();
+    EXPECT_THROW(AdminClient::serverControl(&context, serverId,
+            WireFormat::SET_SLOW_RPC_THRESHOLD, "ab", 2, &output),
+            MessageTooShortError);
+    AdminClient::serverControl(&context, serverId,
+            WireFormat::SET_SLOW_RPC_THRESHOLD, &microseconds,
+            sizeof32(microseconds), &output);
+    EXPECT_EQ(Cycles::fromNanoseconds(5000), SlowRpcLog::thresholdCycles);
+
+    SlowRpcLog::RpcTimes times = SlowRpcLog::RpcTimes();
+    SlowRpcLog::record(WireFormat::READ, 0, 0, times,
+            Cycles::fromNanoseconds(6000));
+    AdminClient::serverControl(&context, serverId,
+            WireFormat::GET_SLOW_RPCS, "abc", 3, &output);
+    ASSERT_EQ(sizeof(SlowRpcLog::Entry), output.size());
+    EXPECT_EQ(WireFormat::READ, output.getStart<SlowRpcLog::Entry>()->opcode);
+
+    SlowRpcLog::setThreshold(0);
+    SlowRpcLog::reset();
+}
+
 TEST_F(AdminServiceTest, serverControl_addLogMessage) {
     AdminClient::logMessage(&context, serverId, ERROR,
             "Test string to write to log %d, %s%c", 42, "extra string", '!');
@@ -70,6 +70,103 @@ FreeSegmentRpc::FreeSegmentRpc(Context* context, ServerId backupId,
     send();
 }
 
+/**
+ * Constructor for GetFragmentRpc: asks a backup for the erasure-coded
+ * fragment it stores for a segment, without waiting for the reply.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param backupId
+ *      The id of a backup server believed to hold a fragment of the segment.
+ * \param masterId
+ *      The id of the master that created the segment.
+ * \param segmentId
+ *      The id of the segment.
+ * \param fragmentGeneration
+ *      Generation of the encoding being decoded; the backup refuses to
+ *      return a fragment of any other generation.
+ */
+GetFragmentRpc::GetFragmentRpc(Context* context, ServerId backupId,
+        ServerId masterId, uint64_t segmentId, uint32_t fragmentGeneration)
+    : ServerIdRpcWrapper(context, backupId,
+            sizeof(WireFormat::BackupGetFragment::Response))
+{
+    WireFormat::BackupGetFragment::Request* reqHdr(
+            allocHeader<WireFormat::BackupGetFragment>(backupId));
+    reqHdr->masterId = masterId.getId();
+    reqHdr->segmentId = segmentId;
+    reqHdr->fragmentGeneration = fragmentGeneration;
+    send();
+}
+
+/**
+ * Wait for a GetFragmentRpc to complete and copy out the fragment.
+ *
+ * \param[out] fragmentIndex
+ *      Set to the index of the fragment the backup returned.
+ * \param[out] data
+ *      The fragment's data is copied here.
+ * \param maxLength
+ *      Size of \a data; longer fragments are truncated.
+ * \return
+ *      The number of bytes copied to \a data.
+ *
+ * \throw ServerNotUpException
+ *      The backup is not part of the cluster.
+ * \throw BackupBadSegmentIdException
+ *      The backup has no fragment of the requested generation.
+ */
+uint32_t
+GetFragmentRpc::wait(uint8_t* fragmentIndex, void* data, uint32_t maxLength)
+{
+    waitAndCheckErrors();
+    const WireFormat::BackupGetFragment::Response* respHdr(
+            getResponseHeader<WireFormat::BackupGetFragment>());
+    *fragmentIndex = respHdr->fragmentIndex;
+    uint32_t length = std::min(respHdr->length, maxLength);
+    return response->copy(sizeof(*respHdr), length, data);
+}
+
+/**
+ * Constructor for GetLoadRpc: asks a backup for its current load without
+ * waiting for the reply.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param backupId
+ *      The id of a backup server.
+ */
+GetLoadRpc::GetLoadRpc(Context* context, ServerId backupId)
+    : ServerIdRpcWrapper(context, backupId,
+            sizeof(WireFormat::BackupGetLoad::Response))
+{
+    allocHeader<WireFormat::BackupGetLoad>(backupId);
+    send();
+}
+
+/**
+ * Wait for a GetLoadRpc to complete and return the backup's load.
+ *
+ * \param[out] queuedBytes
+ *      Set to the number of bytes of replica data the backup has accepted
+ *      but not yet written to storage.
+ * \param[out] writeMBytesPerSec
+ *      Set to the backup's recently measured storage write bandwidth in
+ *      MB/s, or 0 if it hasn't measured any yet.
+ *
+ * \throw ServerNotUpException
+ *      The backup is not part of the cluster.
+ */
+void
+GetLoadRpc::wait(uint64_t* queuedBytes, uint32_t* writeMBytesPerSec)
+{
+    waitAndCheckErrors();
+    const WireFormat::BackupGetLoad::Response* respHdr(
+            getResponseHeader<WireFormat::BackupGetLoad>());
+    *queuedBytes = respHdr->queuedBytes;
+    *writeMBytesPerSec = respHdr->writeMBytesPerSec;
+}
+
 /**
  * This method is invoked by recovery masters during crash recovery: it
  * retrieves from a backup all the objects from a particular segment that
@@ -318,6 +415,7 @@ StartReadingDataRpc::wait()
         result.logDigestSegmentId = respHdr->digestSegmentId;
         result.logDigestSegmentEpoch = respHdr->digestSegmentEpoch;
         result.tableStatsBytes = respHdr->tableStatsBytes;
+        result.queuedReplicaCount = respHdr->queuedReplicaCount;
         response->truncateFront(sizeof(*respHdr));
         // Remove header. Pointer now invalid.
     }
@@ -404,13 +502,18 @@ BackupClient::StartPartitioningReplicas(Context* context,
  *      The partition ids inside each entry act as an index describing which
  *      recovery segment for a particular replica each object should be placed
  *      in.
+ * \param decodeSources
+ *      For each segment of which the backup only has an erasure-coded
+ *      fragment and which it should rebuild, the other backups holding
+ *      fragments of it (see WireFormat::BackupStartPartitioningReplicas).
  */
 StartPartitioningRpc::StartPartitioningRpc(
     Context* context,
     ServerId backupId,
     uint64_t recoveryId,
     ServerId masterId,
-    const ProtoBuf::RecoveryPartition* partitions)
+    const ProtoBuf::RecoveryPartition* partitions,
+    const std::vector<Fragment>& decodeSources)
     : ServerIdRpcWrapper(context, backupId,
             sizeof(WireFormat::BackupStartPartitioningReplicas::Response))
 {
@@ -420,6 +523,9 @@ StartPartitioningRpc::StartPartitioningRpc(
     reqHdr->masterId = masterId.getId();
     reqHdr->partitionsLength = ProtoBuf::serializeToRequest(&request,
             partitions);
+    reqHdr->decodeCount = downCast<uint32_t>(decodeSources.size());
+    foreach (const Fragment& fragment, decodeSources)
+        request.emplaceAppend<Fragment>(fragment);
     send();
 }
 
@@ -432,6 +538,7 @@ StartReadingDataRpc::Result::Result()
     , logDigestSegmentId(-1)
     , logDigestSegmentEpoch(-1)
     , tableStatsBytes(-1)
+    , queuedReplicaCount(0)
 {
 }
 
@@ -444,6 +551,7 @@ StartReadingDataRpc::Result::Result(Result&& other)
     , logDigestSegmentId(other.logDigestSegmentId)
     , logDigestSegmentEpoch(other.logDigestSegmentEpoch)
     , tableStatsBytes(other.tableStatsBytes)
+    , queuedReplicaCount(other.queuedReplicaCount)
 {
 }
 
@@ -458,6 +566,7 @@ StartReadingDataRpc::Result::operator=(Result&& other)
     logDigestSegmentId = other.logDigestSegmentId;
     tableStatsBytes = other.tableStatsBytes;
     logDigestSegmentEpoch = other.logDigestSegmentEpoch;
+    queuedReplicaCount = other.queuedReplicaCount;
     return *this;
 }
 
@@ -639,6 +748,55 @@ WriteSegmentRpc::WriteSegmentRpc(Context* context,
     send();
 }
 
+/**
+ * Alternate constructor for WriteSegmentRpc, used by backups to forward a
+ * write they have received: the data comes from a Buffer rather than from
+ * a Segment. The arguments have the same meanings as for the other
+ * constructor, except:
+ *
+ * \param data
+ *      Buffer holding the data to write; it must not be modified or freed
+ *      until the rpc completes (or is canceled).
+ * \param dataOffset
+ *      Offset in \a data of the first byte to write (the data is written at
+ *      \a offset in the replica).
+ */
+WriteSegmentRpc::WriteSegmentRpc(Context* context,
+                                 ServerId backupId,
+                                 ServerId masterId,
+                                 uint64_t segmentId,
+                                 uint64_t segmentEpoch,
+                                 Buffer* data,
+                                 uint32_t dataOffset,
+                                 uint32_t offset,
+                                 uint32_t length,
+                                 const SegmentCertificate* certificate,
+                                 bool open,
+                                 bool close,
+                                 bool primary)
+    : ServerIdRpcWrapper(context, backupId,
+                         sizeof(WireFormat::BackupWrite::Response))
+{
+    WireFormat::BackupWrite::Request* reqHdr(
+            allocHeader<WireFormat::BackupWrite>(backupId));
+    reqHdr->masterId = masterId.getId();
+    reqHdr->segmentId = segmentId;
+    reqHdr->segmentEpoch = segmentEpoch;
+    reqHdr->offset = offset;
+    reqHdr->length = length;
+    reqHdr->certificateIncluded = (certificate != NULL);
+    if (reqHdr->certificateIncluded)
+        reqHdr->certificate = *certificate;
+    else
+        reqHdr->certificate = SegmentCertificate();
+    reqHdr->open = open;
+    reqHdr->close = close;
+    reqHdr->primary = primary;
+    if (length > 0)
+        request.appendExternal(data, dataOffset, length);
+    send();
+}
+
 /**
  * Wait for a writeSegment RPC to complete.
  *
@@ -652,4 +810,234 @@ WriteSegmentRpc::wait()
     waitAndCheckErrors();
 }
 
+/**
+ * Constructor for WriteSegmentBatchRpc: initiates an rpc that performs
+ * several replica writes on a backup. The writes are applied in the order
+ * given; each one has the same effect as a separate writeSegment call
+ * with the same arguments.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param backupId
+ *      The id of the backup to which the writes are sent.
+ * \param masterId
+ *      The id of the master whose segments are being replicated.
+ * \param writes
+ *      Describes the writes to perform. The segments they refer to must
+ *      not be modified in the ranges being written until the rpc
+ *      completes (or is canceled).
+ */
+WriteSegmentBatchRpc::WriteSegmentBatchRpc(Context* context,
+        ServerId backupId, ServerId masterId,
+        const std::vector<const Write*>& writes)
+    : ServerIdRpcWrapper(context, backupId,
+                         sizeof(WireFormat::BackupWriteBatch::Response))
+{
+    WireFormat::BackupWriteBatch::Request* reqHdr(
+            allocHeader<WireFormat::BackupWriteBatch>(backupId));
+    reqHdr->masterId = masterId.getId();
+    reqHdr->numWrites = downCast<uint32_t>(writes.size());
+    foreach (const Write* write, writes) {
+        request.emplaceAppend<WireFormat::BackupWriteBatch::Entry>(
+                write->segmentId, write->segmentEpoch, write->offset,
+                write->length, write->open, write->close, write->primary,
+                write->certificateIncluded, write->certificate);
+        if (write->segment) {
+            write->segment->appendToBuffer(request, write->offset,
+                                           write->length);
+        }
+    }
+    CycleCounter<RawMetric> _(&metrics->master.replicationPostingWriteRpcTicks);
+    send();
+}
+
+/**
+ * Wait for a WriteSegmentBatchRpc to complete, and return the outcome of
+ * each of its writes.
+ *
+ * \param[out] statuses
+ *      Filled in with one value for each write in the batch, in order:
+ *      STATUS_OK if the write succeeded, otherwise the status that a
+ *      WriteSegmentRpc for the same write would have returned.
+ *
+ * \throw ServerNotUpException
+ *      The intended server for this RPC is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ */
+void
+WriteSegmentBatchRpc::wait(std::vector<Status>* statuses)
+{
+    waitAndCheckErrors();
+    const WireFormat::BackupWriteBatch::Response* respHdr(
+            getResponseHeader<WireFormat::BackupWriteBatch>());
+    statuses->clear();
+    uint32_t offset = sizeof32(*respHdr);
+    for (uint32_t i = 0; i < respHdr->numWrites; i++) {
+        const Status* status = response->getOffset<Status>(offset);
+        if (status == NULL)
+            throw ResponseFormatError(HERE);
+        statuses->push_back(*status);
+        offset += sizeof32(*status);
+    }
+}
+
+/**
+ * Constructor for WriteSegmentForwardRpc: initiates an rpc that writes data
+ * to the primary replica of a segment and has the primary's backup forward
+ * the same write to the backups storing secondary replicas. This way the
+ * data leaves the master only once. The arguments not documented here have
+ * the same meanings as for WriteSegmentRpc; the write can't be an open.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param backupId
+ *      Backup that stores the primary replica of the segment.
+ * \param masterId
+ *      The id of the master to which the data belongs.
+ * \param segmentId
+ *      Log-unique, 64-bit identifier for the segment being replicated.
+ * \param segmentEpoch
+ *      The epoch of the segment being replicated.
+ * \param segment
+ *      Segment whose data is to be replicated.
+ * \param offset
+ *      Offset in the segment (and replicas) of the data to write.
+ * \param length
+ *      The length in bytes of the data to write.
+ * \param certificate
+ *      Certificate to store with each replica, or NULL.
+ * \param close
+ *      Whether this write closes the replicas.
+ * \param forwardIds
+ *      Backups storing secondary replicas of the segment; \a backupId will
+ *      forward the write to each of them. Their replicas must already be
+ *      open and must have received exactly the same data as the primary.
+ */
+WriteSegmentForwardRpc::WriteSegmentForwardRpc(Context* context,
+        ServerId backupId, ServerId masterId,
+        uint64_t segmentId, uint64_t segmentEpoch,
+        const Segment* segment, uint32_t offset, uint32_t length,
+        const SegmentCertificate* certificate, bool close,
+        const std::vector<ServerId>& forwardIds)
+    : ServerIdRpcWrapper(context, backupId,
+                         sizeof(WireFormat::BackupWriteForward::Response))
+{
+    WireFormat::BackupWriteForward::Request* reqHdr(
+            allocHeader<WireFormat::BackupWriteForward>(backupId));
+    reqHdr->masterId = masterId.getId();
+    reqHdr->segmentId = segmentId;
+    reqHdr->segmentEpoch = segmentEpoch;
+    reqHdr->offset = offset;
+    reqHdr->length = length;
+    reqHdr->close = close;
+    reqHdr->certificateIncluded = (certificate != NULL);
+    if (reqHdr->certificateIncluded)
+        reqHdr->certificate = *certificate;
+    else
+        reqHdr->certificate = SegmentCertificate();
+    reqHdr->numForwards = downCast<uint32_t>(forwardIds.size());
+    foreach (ServerId forwardId, forwardIds)
+        request.emplaceAppend<uint64_t>(forwardId.getId());
+    if (segment)
+        segment->appendToBuffer(request, offset, length);
+    CycleCounter<RawMetric> _(&metrics->master.replicationPostingWriteRpcTicks);
+    send();
+}
+
+/**
+ * Wait for a WriteSegmentForwardRpc to complete, and return the outcome of
+ * the write on each of the backups it was forwarded to.
+ *
+ * \param[out] statuses
+ *      Filled in with one value for each of the forwardIds passed to the
+ *      constructor, in order: STATUS_OK if the write succeeded on that
+ *      backup, otherwise the status its WriteSegmentRpc returned.
+ *
+ * \throw ServerNotUpException
+ *      The backup storing the primary replica is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ * \throw ClientException
+ *      The write to the primary replica failed (in which case it wasn't
+ *      forwarded).
+ */
+void
+WriteSegmentForwardRpc::wait(std::vector<Status>* statuses)
+{
+    waitAndCheckErrors();
+    const WireFormat::BackupWriteForward::Response* respHdr(
+            getResponseHeader<WireFormat::BackupWriteForward>());
+    statuses->clear();
+    uint32_t offset = sizeof32(*respHdr);
+    for (uint32_t i = 0; i < respHdr->numForwards; i++) {
+        const Status* status = response->getOffset<Status>(offset);
+        if (status == NULL)
+            throw ResponseFormatError(HERE);
+        statuses->push_back(*status);
+        offset += sizeof32(*status);
+    }
+}
+
+/**
+ * Constructor for WriteFragmentRpc: stores one erasure-coded fragment of a
+ * closed segment on a backup, without waiting for the reply. The backup
+ * replaces any replica or fragment of the segment it already has from
+ * this master.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param backupId
+ *      The id of the backup to store the fragment on.
+ * \param masterId
+ *      The id of the master that created the segment.
+ * \param segmentId
+ *      The id of the segment the fragment is part of.
+ * \param segmentEpoch
+ *      Epoch of the segment; see WriteSegmentRpc.
+ * \param certificate
+ *      Certificate covering the whole segment; stored with the fragment so
+ *      the segment can be checked and iterated once it has been rebuilt.
+ * \param dataFragments
+ *      Number of data fragments the segment was divided into.
+ * \param parityFragments
+ *      Number of parity fragments computed from them.
+ * \param fragmentIndex
+ *      Which fragment \a data is (data fragments first).
+ * \param fragmentGeneration
+ *      Distinguishes this encoding of the segment from any earlier ones.
+ * \param data
+ *      The fragment; must not be modified or freed until the rpc completes
+ *      (or is canceled).
+ * \param length
+ *      Bytes in \a data.
+ */
+WriteFragmentRpc::WriteFragmentRpc(Context* context,
+                                   ServerId backupId,
+                                   ServerId masterId,
+                                   uint64_t segmentId,
+                                   uint64_t segmentEpoch,
+                                   const SegmentCertificate& certificate,
+                                   uint8_t dataFragments,
+                                   uint8_t parityFragments,
+                                   uint8_t fragmentIndex,
+                                   uint32_t fragmentGeneration,
+                                   const void* data,
+                                   uint32_t length)
+    : ServerIdRpcWrapper(context, backupId,
+                         sizeof(WireFormat::BackupWriteFragment::Response))
+{
+    WireFormat::BackupWriteFragment::Request* reqHdr(
+            allocHeader<WireFormat::BackupWriteFragment>(backupId));
+    reqHdr->masterId = masterId.getId();
+    reqHdr->segmentId = segmentId;
+    reqHdr->segmentEpoch = segmentEpoch;
+    reqHdr->certificate = certificate;
+    reqHdr->dataFragments = dataFragments;
+    reqHdr->parityFragments = parityFragments;
+    reqHdr->fragmentIndex = fragmentIndex;
+    reqHdr->fragmentGeneration = fragmentGeneration;
+    reqHdr->length = length;
+    request.appendExternal(data, length);
+    send();
+}
+
 } // namespace RAMCloud
@@ -45,6 +45,37 @@ class FreeSegmentRpc : public ServerIdRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(FreeSegmentRpc);
 };
 
+/**
+ * Fetches the erasure-coded fragment of a closed segment that a backup
+ * stores; used by a backup rebuilding the segment during recovery (see
+ * BackupMasterRecovery). Allows the fetch to execute asynchronously.
+ */
+class GetFragmentRpc : public ServerIdRpcWrapper {
+  public:
+    GetFragmentRpc(Context* context, ServerId backupId, ServerId masterId,
+                   uint64_t segmentId, uint32_t fragmentGeneration);
+    ~GetFragmentRpc() {}
+    uint32_t wait(uint8_t* fragmentIndex, void* data, uint32_t maxLength);
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(GetFragmentRpc);
+};
+
+/**
+ * Asks a backup how much replica data it has waiting to be written to
+ * storage and how fast it has recently been writing; masters use this to
+ * steer new replicas away from busy backups (see LoadAwareBackupSelector).
+ */
+class GetLoadRpc : public ServerIdRpcWrapper {
+  public:
+    GetLoadRpc(Context* context, ServerId backupId);
+    ~GetLoadRpc() {}
+    void wait(uint64_t* queuedBytes, uint32_t* writeMBytesPerSec);
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(GetLoadRpc);
+};
+
 /**
  * Encapsulates the state of a BackupClient::getRecoveryData operation,
  * allowing it to execute asynchronously.
@@ -151,6 +182,14 @@ class StartReadingDataRpc : public ServerIdRpcWrapper {
          */
         uint32_t tableStatsBytes;
 
+        /**
+         * The number of replicas the backup still had to load from storage
+         * for the recoveries of other masters when it answered. Used by the
+         * coordinator to estimate when the replicas for this recovery will
+         * be loaded.
+         */
+        uint32_t queuedReplicaCount;
+
         DISALLOW_COPY_AND_ASSIGN(Result);
     };
 
@@ -169,9 +208,13 @@ class StartReadingDataRpc : public ServerIdRpcWrapper {
  */
 class StartPartitioningRpc : public ServerIdRpcWrapper {
   public:
+    typedef WireFormat::BackupStartPartitioningReplicas::Fragment Fragment;
+
     StartPartitioningRpc(Context* context, ServerId backupId,
                         uint64_t recoveryId, ServerId masterId,
-                        const ProtoBuf::RecoveryPartition* partitions);
+                        const ProtoBuf::RecoveryPartition* partitions,
+                        const std::vector<Fragment>& decodeSources =
+                            std::vector<Fragment>());
     ~StartPartitioningRpc() {}
     /// \copydoc ServerIdRpcWrapper::waitAndCheckErrors
     void wait() {waitAndCheckErrors();}
@@ -192,6 +235,13 @@ class WriteSegmentRpc : public ServerIdRpcWrapper {
                     const Segment* segment, uint32_t offset, uint32_t length,
                     const SegmentCertificate* certificate,
                     bool open, bool close, bool primary);
+    WriteSegmentRpc(Context* context, ServerId backupId,
+                    ServerId masterId,
+                    uint64_t segmentId, uint64_t segmentEpoch,
+                    Buffer* data, uint32_t dataOffset,
+                    uint32_t offset, uint32_t length,
+                    const SegmentCertificate* certificate,
+                    bool open, bool close, bool primary);
     ~WriteSegmentRpc() {}
     void wait();
 
@@ -199,6 +249,107 @@ class WriteSegmentRpc : public ServerIdRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(WriteSegmentRpc);
 };
 
+/**
+ * Carries several replica writes to a single backup in one
+ * BACKUP_WRITE_BATCH rpc, allowing it to execute asynchronously. The
+ * backup applies the writes in order and returns a separate status for
+ * each of them.
+ */
+class WriteSegmentBatchRpc : public ServerIdRpcWrapper {
+  public:
+    /**
+     * Describes one of the writes in a batch; the fields have the same
+     * meanings as the corresponding arguments to BackupClient::writeSegment.
+     */
+    struct Write {
+        Write(uint64_t segmentId, uint64_t segmentEpoch,
+              const Segment* segment, uint32_t offset, uint32_t length,
+              const SegmentCertificate* certificate,
+              bool open, bool close, bool primary)
+            : segmentId(segmentId)
+            , segmentEpoch(segmentEpoch)
+            , segment(segment)
+            , offset(offset)
+            , length(length)
+            , certificateIncluded(certificate != NULL)
+            , certificate(certificate ? *certificate : SegmentCertificate())
+            , open(open)
+            , close(close)
+            , primary(primary)
+        {}
+
+        uint64_t segmentId;
+        uint64_t segmentEpoch;
+        const Segment* segment;
+        uint32_t offset;
+        uint32_t length;
+
+        /// If false, #certificate is undefined.
+        bool certificateIncluded;
+
+        /// A copy of the certificate to send, so that the caller's copy
+        /// can change before the rpc is sent.
+        SegmentCertificate certificate;
+        bool open;
+        bool close;
+        bool primary;
+    };
+
+    WriteSegmentBatchRpc(Context* context, ServerId backupId,
+                         ServerId masterId,
+                         const std::vector<const Write*>& writes);
+    ~WriteSegmentBatchRpc() {}
+    void wait(std::vector<Status>* statuses);
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(WriteSegmentBatchRpc);
+};
+
+/**
+ * Sends a replica write to the backup storing the primary replica, which
+ * applies it and then forwards it to the backups storing the secondary
+ * replicas (see BackupService::writeSegmentForward). Allows the write to
+ * execute asynchronously. Opens can't be forwarded.
+ */
+class WriteSegmentForwardRpc : public ServerIdRpcWrapper {
+  public:
+    WriteSegmentForwardRpc(Context* context, ServerId backupId,
+                           ServerId masterId,
+                           uint64_t segmentId, uint64_t segmentEpoch,
+                           const Segment* segment, uint32_t offset,
+                           uint32_t length,
+                           const SegmentCertificate* certificate,
+                           bool close,
+                           const std::vector<ServerId>& forwardIds);
+    ~WriteSegmentForwardRpc() {}
+    void wait(std::vector<Status>* statuses);
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(WriteSegmentForwardRpc);
+};
+
+/**
+ * Stores one erasure-coded fragment of a closed segment on a backup, in
+ * place of a full replica (see ReplicatedSegment). Allows the write to
+ * execute asynchronously.
+ */
+class WriteFragmentRpc : public ServerIdRpcWrapper {
+  public:
+    WriteFragmentRpc(Context* context, ServerId backupId,
+                     ServerId masterId,
+                     uint64_t segmentId, uint64_t segmentEpoch,
+                     const SegmentCertificate& certificate,
+                     uint8_t dataFragments, uint8_t parityFragments,
+                     uint8_t fragmentIndex, uint32_t fragmentGeneration,
+                     const void* data, uint32_t length);
+    ~WriteFragmentRpc() {}
+    /// \copydoc ServerIdRpcWrapper::waitAndCheckErrors
+    void wait() {waitAndCheckErrors();}
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(WriteFragmentRpc);
+};
+
 /**
  * This class implements RPC requests that are sent to backup servers
  * to manage segment replicas. The class contains only static methods,
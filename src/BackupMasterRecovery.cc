@@ -13,10 +13,12 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include "BackupClient.h"
 #include "BackupMasterRecovery.h"
 #include "BackupService.h"
 #include "Object.h"
 #include "RecoverySegmentBuilder.h"
+#include "ReedSolomon.h"
 #include "ShortMacros.h"
 
 namespace RAMCloud {
@@ -32,6 +34,9 @@ SpinLock BackupMasterRecovery::deletionMutex
  * doesn't start any of them. See start() for details on the first phase of
  * master recovery which is initiated by the coordinator.
  *
+ * \param context
+ *      Overall information about the RAMCloud server; used to fetch
+ *      erasure-coded fragments from other backups.
  * \param taskQueue
  *      Task queue which will provide the context to load and filter replicas in
  *      the background. Not used until just before start() completes. This
@@ -58,13 +63,15 @@ SpinLock BackupMasterRecovery::deletionMutex
  *     point during recovery. This number will determine the size of this
  *     recovery's CyclicReplicaBuffer.
  */
-BackupMasterRecovery::BackupMasterRecovery(TaskQueue& taskQueue,
+BackupMasterRecovery::BackupMasterRecovery(Context* context,
+                                           TaskQueue& taskQueue,
                                            uint64_t recoveryId,
                                            ServerId crashedMasterId,
                                            uint32_t segmentSize,
                                            uint32_t readSpeed,
                                            uint32_t maxReplicasInMemory)
     : Task(taskQueue)
+    , context(context)
     , recoveryId(recoveryId)
     , crashedMasterId(crashedMasterId)
     , partitions()
@@ -78,6 +85,7 @@ BackupMasterRecovery::BackupMasterRecovery(TaskQueue& taskQueue,
     , logDigestSegmentEpoch()
     , tableStatsDigest()
     , startCompleted()
+    , pendingReplicaCount(0)
     , recoveryTicks()
     , readingDataTicks()
     , buildingStartTicks()
@@ -217,6 +225,7 @@ BackupMasterRecovery::start(const std::vector<BackupStorage::FrameRef>& frames,
             logDigestSegmentId);
     }
 
+    pendingReplicaCount = downCast<uint32_t>(primaries.size());
     startCompleted = true;
     populateStartResponse(buffer, response);
 }
@@ -228,10 +237,16 @@ BackupMasterRecovery::start(const std::vector<BackupStorage::FrameRef>& frames,
  *
  * \param partitions
  *       The partitioning scheme by which the replicas should be split
+ * \param decodeSources
+ *       For each segment of which this backup only has an erasure-coded
+ *       fragment and which the coordinator wants this backup to rebuild,
+ *       the other backups holding fragments of it. Those segments are
+ *       queued for loading along with the primary replicas.
  */
 void
 BackupMasterRecovery::setPartitionsAndSchedule(
-                          ProtoBuf::RecoveryPartition partitions)
+                          ProtoBuf::RecoveryPartition partitions,
+                          const std::vector<Fragment>& decodeSources)
 {
     assert(startCompleted);
 
@@ -243,6 +258,23 @@ BackupMasterRecovery::setPartitionsAndSchedule(
 
     this->partitions.construct(partitions);
 
+    foreach (const Fragment& source, decodeSources) {
+        auto replicaIt = segmentIdToReplica.find(source.segmentId);
+        if (replicaIt == segmentIdToReplica.end() ||
+                replicaIt->second->metadata->dataFragments == 0) {
+            LOG(WARNING, "Asked to rebuild segment <%s,%lu>, but there is "
+                "no fragment of it on this backup",
+                crashedMasterId.toString().c_str(), source.segmentId);
+            continue;
+        }
+        Replica* replica = replicaIt->second;
+        if (replica->decodeSources.empty()) {
+            replicaBuffer.enqueue(replica, CyclicReplicaBuffer::NORMAL);
+            pendingReplicaCount++;
+        }
+        replica->decodeSources.push_back(source);
+    }
+
     for (int i = 0; i < partitions.tablet_size(); ++i) {
         numPartitions = std::max(numPartitions,
                                  downCast<int>(
@@ -319,6 +351,13 @@ BackupMasterRecovery::getRecoverySegment(uint64_t recoveryId,
         throw BackupBadSegmentIdException(HERE);
     }
     Replica* replica = replicaIt->second;
+    if (replica->metadata->dataFragments != 0 &&
+            replica->decodeSources.empty()) {
+        LOG(NOTICE, "Asked for a recovery segment for segment <%s,%lu>, but "
+            "this backup only has a fragment of it and wasn't asked to "
+            "rebuild it", crashedMasterId.toString().c_str(), segmentId);
+        throw BackupBadSegmentIdException(HERE);
+    }
     CyclicReplicaBuffer::ActiveReplica activeRecord(replica, &replicaBuffer);
 
     if (!replicaBuffer.contains(replica)) {
@@ -403,6 +442,20 @@ BackupMasterRecovery::getRecoveryId()
     return recoveryId;
 }
 
+/**
+ * Returns the number of primary replicas this recovery has yet to load from
+ * storage and filter. Used by BackupService::startReadingData() to tell the
+ * coordinator how much work is already queued for this backup's storage, so
+ * it can steer other recoveries toward less busy backups.
+ * The result is only an estimate: replicas are loaded and built
+ * concurrently on another thread, which maintains the count.
+ */
+uint32_t
+BackupMasterRecovery::getPendingReplicaCount()
+{
+    return pendingReplicaCount;
+}
+
 /**
  * Alternates between attempting to add the next replica to the buffer (see
  * bufferNext()) and building the next recovery segment from a previously loaded
@@ -425,6 +478,101 @@ BackupMasterRecovery::performTask()
 
 // - private -
 
+/**
+ * Rebuild a segment of which this backup has one erasure-coded fragment by
+ * fetching enough other fragments from the backups in
+ * Replica::decodeSources and decoding them (see ReedSolomon). Fragments
+ * are fetched in parallel; if some fetches fail, other sources are tried.
+ * Runs on the task queue thread and blocks until the fetches complete.
+ *
+ * \param replica
+ *      The replica holding the local fragment; its metadata describes the
+ *      encoding and its decodeSources must not be empty.
+ * \param localFragment
+ *      The local fragment's data.
+ * \return
+ *      The rebuilt segment, at least #segmentSize bytes long.
+ * \throw SegmentRecoveryFailedException
+ *      If too few fragments could be fetched to rebuild the segment.
+ */
+std::unique_ptr<uint8_t[]>
+BackupMasterRecovery::decodeSegment(const Replica& replica,
+                                    const void* localFragment)
+{
+    const BackupReplicaMetadata* metadata = replica.metadata;
+    uint32_t dataFragments = metadata->dataFragments;
+    uint32_t totalFragments = dataFragments + metadata->parityFragments;
+    uint32_t fragmentLength = metadata->getFragmentLength();
+    if (metadata->fragmentIndex >= totalFragments ||
+            dataFragments * fragmentLength > segmentSize + dataFragments) {
+        LOG(WARNING, "Fragment of <%s,%lu> has an invalid encoding",
+            crashedMasterId.toString().c_str(), metadata->segmentId);
+        throw SegmentRecoveryFailedException(HERE);
+    }
+
+    // Fragments are laid out back to back, data fragments first, so once
+    // they are decoded the segment is at the start of the buffer.
+    size_t bufferLength = std::max(size_t(segmentSize),
+                                   size_t(totalFragments) * fragmentLength);
+    std::unique_ptr<uint8_t[]> fragments(new uint8_t[bufferLength]());
+    std::unique_ptr<bool[]> present(new bool[totalFragments]());
+    memcpy(&fragments[metadata->fragmentIndex * fragmentLength],
+           localFragment, fragmentLength);
+    present[metadata->fragmentIndex] = true;
+    uint32_t fragmentsPresent = 1;
+
+    auto source = replica.decodeSources.begin();
+    while (fragmentsPresent < dataFragments) {
+        std::vector<std::pair<uint8_t, std::unique_ptr<GetFragmentRpc>>> rpcs;
+        while (fragmentsPresent + rpcs.size() < dataFragments &&
+               source != replica.decodeSources.end()) {
+            uint8_t index = source->fragmentIndex;
+            if (index < totalFragments && !present[index]) {
+                rpcs.emplace_back(index, std::unique_ptr<GetFragmentRpc>(
+                    new GetFragmentRpc(context, ServerId(source->backupId),
+                                       crashedMasterId, metadata->segmentId,
+                                       metadata->fragmentGeneration)));
+            }
+            ++source;
+        }
+        if (rpcs.empty()) {
+            LOG(WARNING, "Only found %u of the %u fragments needed to "
+                "rebuild segment <%s,%lu>", fragmentsPresent, dataFragments,
+                crashedMasterId.toString().c_str(), metadata->segmentId);
+            throw SegmentRecoveryFailedException(HERE);
+        }
+        foreach (auto& rpc, rpcs) {
+            uint8_t index = rpc.first;
+            uint8_t returnedIndex;
+            try {
+                uint32_t length = rpc.second->wait(&returnedIndex,
+                        &fragments[index * fragmentLength], fragmentLength);
+                if (length != fragmentLength || returnedIndex != index) {
+                    LOG(WARNING, "Backup returned the wrong fragment of "
+                        "<%s,%lu>", crashedMasterId.toString().c_str(),
+                        metadata->segmentId);
+                    continue;
+                }
+            } catch (const ClientException& e) {
+                LOG(NOTICE, "Couldn't fetch fragment %u of <%s,%lu>: %s",
+                    index, crashedMasterId.toString().c_str(),
+                    metadata->segmentId, e.what());
+                continue;
+            }
+            present[index] = true;
+            fragmentsPresent++;
+        }
+    }
+
+    ReedSolomon code(dataFragments, metadata->parityFragments);
+    uint8_t* fragmentPointers[totalFragments];
+    for (uint32_t i = 0; i < totalFragments; i++)
+        fragmentPointers[i] = &fragments[i * fragmentLength];
+    if (!code.reconstruct(fragmentPointers, present.get(), fragmentLength))
+        throw SegmentRecoveryFailedException(HERE);
+    return fragments;
+}
+
 /**
  * Append replica information and the log digest (if any) to \a responseBuffer
  * and populate \a response with the corresponding details about the
@@ -446,7 +594,10 @@ BackupMasterRecovery::populateStartResponse(Buffer* responseBuffer,
         responseBuffer->emplaceAppend<
                 WireFormat::BackupStartReadingData::Replica>(
                 replica.metadata->segmentId, replica.metadata->segmentEpoch,
-                replica.metadata->closed);
+                replica.metadata->closed, replica.metadata->dataFragments,
+                replica.metadata->parityFragments,
+                replica.metadata->fragmentIndex,
+                replica.metadata->fragmentGeneration);
         ++response->replicaCount;
         if (replica.metadata->primary)
             ++response->primaryReplicaCount;
@@ -486,6 +637,7 @@ BackupMasterRecovery::Replica::Replica(const BackupStorage::FrameRef& frame)
     , metadata(static_cast<const BackupReplicaMetadata*>(frame->getMetadata()))
     , recoverySegments()
     , recoveryException()
+    , decodeSources()
     , built()
     , lastAccessTime(0)
     , refCount(0)
@@ -756,6 +908,14 @@ BackupMasterRecovery::CyclicReplicaBuffer::buildNext()
         }
     }
 
+    // Only a replica that has never been built can have a fetchCount of
+    // zero here (replicas are evicted only after they have been fetched).
+    if (replicaToBuild && (replicaToBuild->metadata->primary ||
+            !replicaToBuild->decodeSources.empty()) &&
+            replicaToBuild->fetchCount == 0) {
+        recovery->pendingReplicaCount--;
+    }
+
     if (!replicaToBuild) {
         return false;
     }
@@ -764,6 +924,7 @@ BackupMasterRecovery::CyclicReplicaBuffer::buildNext()
     replicaToBuild->recoverySegments.reset();
 
     void* replicaData = replicaToBuild->frame->load();
+    std::unique_ptr<uint8_t[]> decodedSegment;
     CycleCounter<RawMetric> _(&metrics->backup.filterTicks);
 
     // Recovery segments for this replica data are constructed by splitting data
@@ -773,6 +934,11 @@ BackupMasterRecovery::CyclicReplicaBuffer::buildNext()
         new Segment[recovery->numPartitions]);
     uint64_t start = Cycles::rdtsc();
     try {
+        if (!replicaToBuild->decodeSources.empty()) {
+            decodedSegment = recovery->decodeSegment(*replicaToBuild,
+                                                     replicaData);
+            replicaData = decodedSegment.get();
+        }
         if (!recovery->testingSkipBuild) {
             assert(recovery->partitions);
             RecoverySegmentBuilder::build(replicaData, recovery->segmentSize,
@@ -77,6 +77,13 @@ class TaskKiller : public Task {
  * is that primary replicas are loaded automatically and secondary replicas are
  * not loaded until they are requested.
  *
+ * A frame may also hold just one erasure-coded fragment of a closed segment
+ * (see BackupReplicaMetadata::dataFragments). Such a replica is never used
+ * unless the coordinator asks this backup to rebuild the segment (see
+ * setPartitionsAndSchedule()); it is then loaded like a primary, and before
+ * it is filtered the task queue thread fetches enough fragments from other
+ * backups to decode the segment.
+ *
  * The number of replicas in memory at any given time is limited to prevent
  * out-of-memory errors. In the case of extreme speed differences between
  * recovery masters, this can cause longer recovery times, but under normal
@@ -93,8 +100,10 @@ class TaskKiller : public Task {
 class BackupMasterRecovery : public Task {
   PUBLIC:
     typedef WireFormat::BackupStartReadingData::Response StartResponse;
+    typedef WireFormat::BackupStartPartitioningReplicas::Fragment Fragment;
 
-    BackupMasterRecovery(TaskQueue& taskQueue,
+    BackupMasterRecovery(Context* context,
+                         TaskQueue& taskQueue,
                          uint64_t recoveryId,
                          ServerId crashedMasterId,
                          uint32_t segmentSize,
@@ -104,7 +113,9 @@ class BackupMasterRecovery : public Task {
     void start(const std::vector<BackupStorage::FrameRef>& frames,
                Buffer* buffer,
                StartResponse* response);
-    void setPartitionsAndSchedule(ProtoBuf::RecoveryPartition partitions);
+    void setPartitionsAndSchedule(ProtoBuf::RecoveryPartition partitions,
+                                  const std::vector<Fragment>& decodeSources =
+                                      std::vector<Fragment>());
     Status getRecoverySegment(uint64_t recoveryId,
                               uint64_t segmentId,
                               int partitionId,
@@ -112,6 +123,7 @@ class BackupMasterRecovery : public Task {
                               SegmentCertificate* certificate);
     void free();
     uint64_t getRecoveryId();
+    uint32_t getPendingReplicaCount();
     void performTask();
 
   PRIVATE:
@@ -119,6 +131,11 @@ class BackupMasterRecovery : public Task {
                                StartResponse* response);
     struct Replica;
     bool getLogDigest(Replica& replica, Buffer* digestBuffer);
+    std::unique_ptr<uint8_t[]> decodeSegment(const Replica& replica,
+                                             const void* localFragment);
+
+    /// Used to fetch fragments from other backups.
+    Context* context;
 
     /**
      * Which master recovery this is for. The coordinator may schedule
@@ -217,6 +234,14 @@ class BackupMasterRecovery : public Task {
          */
         std::unique_ptr<SegmentRecoveryFailedException> recoveryException;
 
+        /**
+         * Empty unless #frame holds an erasure-coded fragment and the
+         * coordinator asked this backup to rebuild the segment from it;
+         * then lists the other backups holding fragments of the segment.
+         * Set by setPartitionsAndSchedule() before the replica is queued.
+         */
+        std::vector<Fragment> decodeSources;
+
         /**
          * Set when the replica has been filtered and all recovery segment
          * information has been flushed to main memory (via sfence).
@@ -443,6 +468,14 @@ class BackupMasterRecovery : public Task {
      */
     bool startCompleted;
 
+    /**
+     * Number of primary replicas that haven't been built yet (see
+     * getPendingReplicaCount()). Set by start() on the backup worker thread
+     * and decremented by CyclicReplicaBuffer::buildNext() on the recovery
+     * task thread.
+     */
+    Atomic<uint32_t> pendingReplicaCount;
+
     /**
      * Times each recovery.
      */
@@ -525,7 +558,11 @@ class BackupReplicaMetadata {
                           uint32_t segmentCapacity,
                           uint64_t segmentEpoch,
                           bool closed,
-                          bool primary)
+                          bool primary,
+                          uint8_t dataFragments = 0,
+                          uint8_t parityFragments = 0,
+                          uint8_t fragmentIndex = 0,
+                          uint32_t fragmentGeneration = 0)
         : certificate(certificate)
         , logId(logId)
         , segmentId(segmentId)
@@ -533,6 +570,10 @@ class BackupReplicaMetadata {
         , segmentEpoch(segmentEpoch)
         , closed(closed)
         , primary(primary)
+        , dataFragments(dataFragments)
+        , parityFragments(parityFragments)
+        , fragmentIndex(fragmentIndex)
+        , fragmentGeneration(fragmentGeneration)
         , checksum()
     {
         Crc32C calculatedChecksum;
@@ -555,6 +596,17 @@ class BackupReplicaMetadata {
         return calculatedChecksum.getResult() == checksum;
     }
 
+    /**
+     * Return the number of bytes in the fragment stored in the same frame
+     * as this metadata (only meaningful if #dataFragments is nonzero). The
+     * segment is zero-padded to a multiple of #dataFragments bytes before
+     * it is divided up, so all fragments are the same size.
+     */
+    uint32_t getFragmentLength() const {
+        return (certificate.segmentLength + dataFragments - 1) /
+                dataFragments;
+    }
+
     /**
      * Used to check the integrity of the replica stored in the same
      * storage frame as this metadata. Supplied by masters on calls
@@ -613,6 +665,37 @@ class BackupReplicaMetadata {
      */
     bool primary;
 
+    /**
+     * Zero if the frame holds a full replica of the segment. Otherwise the
+     * frame holds a single erasure-coded fragment of a closed segment and
+     * this is the number of data fragments the segment was divided into
+     * (see ReedSolomon); any this many distinct fragments of the same
+     * #fragmentGeneration suffice to rebuild the segment. #certificate
+     * always describes the whole segment, not the fragment.
+     */
+    uint8_t dataFragments;
+
+    /**
+     * Number of parity fragments computed for the segment. Only meaningful
+     * if #dataFragments is nonzero.
+     */
+    uint8_t parityFragments;
+
+    /**
+     * Which fragment of the segment the frame holds; data fragments come
+     * first, followed by parity fragments. Only meaningful if
+     * #dataFragments is nonzero.
+     */
+    uint8_t fragmentIndex;
+
+    /**
+     * Distinguishes successive encodings of the same segment: a master that
+     * loses a fragment re-replicates the segment and encodes it again with
+     * a higher generation, and recovery never mixes fragments of different
+     * generations. Only meaningful if #dataFragments is nonzero.
+     */
+    uint32_t fragmentGeneration;
+
   PRIVATE:
     /**
      * Checksum of all the above fields. Must come last in the class.
@@ -623,7 +706,7 @@ class BackupReplicaMetadata {
     Crc32C::ResultType checksum;
 } __attribute__((packed));
 // Substitute for std::is_trivially_copyable until we have real C++11.
-static_assert(sizeof(BackupReplicaMetadata) == 42,
+static_assert(sizeof(BackupReplicaMetadata) == 49,
               "Unexpected padding in BackupReplicaMetadata");
 
 } // namespace RAMCloud
@@ -27,6 +27,7 @@
 namespace RAMCloud {
 
 struct BackupMasterRecoveryTest : public ::testing::Test {
+    Context context;
     TaskQueue taskQueue;
     ProtoBuf::RecoveryPartition partitions;
     uint32_t segmentSize;
@@ -39,7 +40,8 @@ struct BackupMasterRecoveryTest : public ::testing::Test {
     Tub<BackupMasterRecovery> recovery;
 
     BackupMasterRecoveryTest()
-        : taskQueue()
+        : context()
+        , taskQueue()
         , partitions()
         , segmentSize(1024)
         , readSpeed(100)
@@ -62,7 +64,7 @@ struct BackupMasterRecoveryTest : public ::testing::Test {
             ProtoBuf::Tablets::Tablet& tablet(*partitions.add_tablet());
             tablet = tablets.tablet(i);
         }
-        recovery.construct(taskQueue, 456lu, ServerId{99, 0},
+        recovery.construct(&context, taskQueue, 456lu, ServerId{99, 0},
                            segmentSize, readSpeed, maxReplicasInMemory);
     }
 
@@ -243,7 +245,7 @@ TEST_F(BackupMasterRecoveryTest, start) {
 }
 
 TEST_F(BackupMasterRecoveryTest, setPartitionsAndSchedule) {
-    recovery.construct(taskQueue, 456lu, ServerId{99, 0},
+    recovery.construct(&context, taskQueue, 456lu, ServerId{99, 0},
                        segmentSize, readSpeed, maxReplicasInMemory);
 
     TestLog::Enable _;
@@ -360,8 +362,9 @@ TEST_F(BackupMasterRecoveryTest, getRecoverySegment_badArgs) {
 
 TEST_F(BackupMasterRecoveryTest, free) {
     std::unique_ptr<BackupMasterRecovery> recovery(
-        new BackupMasterRecovery(taskQueue, 456lu, ServerId{99, 0},
-                                 segmentSize, readSpeed, maxReplicasInMemory));
+        new BackupMasterRecovery(&context, taskQueue, 456lu,
+                                 ServerId{99, 0}, segmentSize, readSpeed,
+                                 maxReplicasInMemory));
     TestLog::Enable _;
     recovery->free();
     taskQueue.performTask();
@@ -375,6 +378,28 @@ TEST_F(BackupMasterRecoveryTest, free) {
               TestLog::get());
 }
 
+TEST_F(BackupMasterRecoveryTest, getPendingReplicaCount) {
+    EXPECT_EQ(0u, recovery->getPendingReplicaCount());
+    mockMetadata(88, true, true);
+    mockMetadata(89, true, true);
+    mockMetadata(90, true, false);
+    recovery->testingSkipBuild = true;
+    recovery->start(frames, NULL, NULL);
+    EXPECT_EQ(2u, recovery->getPendingReplicaCount());
+    recovery->replicaBuffer.bufferNext();
+    recovery->replicaBuffer.buildNext();
+    EXPECT_EQ(1u, recovery->getPendingReplicaCount());
+
+    // Rebuilding a replica that was evicted after being fetched doesn't
+    // count again.
+    BackupMasterRecovery::Replica* replica = &recovery->replicas.at(0);
+    replica->built = false;
+    replica->fetchCount = 1;
+    recovery->replicaBuffer.buildNext();
+    EXPECT_TRUE(replica->built);
+    EXPECT_EQ(1u, recovery->getPendingReplicaCount());
+}
+
 TEST_F(BackupMasterRecoveryTest, performTask) {
     mockMetadata(88, true, true);
     mockMetadata(89, true, false);
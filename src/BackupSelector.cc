@@ -38,6 +38,22 @@ BackupStats::getExpectedReadMs() {
            1024 / 1024 / expectedReadMBytesPerSec);
 }
 
+/**
+ * Return the expected number of microseconds the backup would take to
+ * write to its storage all of the data already waiting for it: the data
+ * this master has in flight to it plus the backlog the backup last
+ * reported. The backup's reported write bandwidth is used if it has one,
+ * otherwise its disk read bandwidth.
+ */
+uint64_t
+BackupStats::getExpectedQueueUs() {
+    uint32_t mBytesPerSec = reportedWriteMBytesPerSec != 0
+                          ? reportedWriteMBytesPerSec
+                          : expectedReadMBytesPerSec;
+    return (bytesInFlight + reportedQueuedBytes) * 1000 * 1000 / 1024 /
+           1024 / mBytesPerSec;
+}
+
 // --- BackupSelector ---
 
 /**
@@ -155,6 +171,43 @@ BackupSelector::signalFreedPrimary(const ServerId backupId)
     --stats->primaryReplicaCount;
 }
 
+/**
+ * Inform the BackupSelector that a replica write has been sent to a backup
+ * (see BackupStats::getExpectedQueueUs). Each call must eventually be
+ * matched by a call to signalWriteFinished with the same arguments.
+ * \param backupId
+ *      The ServerId of the backup the write was sent to.
+ * \param length
+ *      Number of bytes of segment data in the write.
+ */
+void
+BackupSelector::signalWriteStarted(const ServerId backupId, uint32_t length)
+{
+    BackupStats* stats = findStats(backupId);
+    if (stats == NULL)
+        return;
+    ++stats->writesInFlight;
+    stats->bytesInFlight += length;
+}
+
+/**
+ * Inform the BackupSelector that a replica write previously reported to
+ * signalWriteStarted has completed, failed, or been abandoned.
+ * \param backupId
+ *      The ServerId of the backup the write was sent to.
+ * \param length
+ *      Number of bytes of segment data in the write.
+ */
+void
+BackupSelector::signalWriteFinished(const ServerId backupId, uint32_t length)
+{
+    BackupStats* stats = findStats(backupId);
+    if (stats == NULL || stats->writesInFlight == 0)
+        return;
+    --stats->writesInFlight;
+    stats->bytesInFlight -= std::min<uint64_t>(length, stats->bytesInFlight);
+}
+
 // - private -
 
 /**
@@ -200,6 +253,21 @@ BackupSelector::applyTrackerChanges()
     }
 }
 
+/**
+ * Return the BackupStats for a backup, or NULL if the backup isn't known
+ * to #tracker (for example, because it has crashed since a write to it was
+ * sent).
+ */
+BackupStats*
+BackupSelector::findStats(const ServerId backupId)
+{
+    try {
+        return tracker[backupId];
+    } catch (const Exception& e) {
+        return NULL;
+    }
+}
+
 /**
  * Return whether it is unwise to place a replica on \a backup given
  * that a replica exists on backup \a otherBackupId.
@@ -18,6 +18,7 @@
 
 #include <unordered_map>
 #include "Common.h"
+#include "BackupClient.h"
 #include "ServerTracker.h"
 
 namespace RAMCloud {
@@ -33,9 +34,16 @@ struct BackupStats {
         : primaryReplicaCount(0)
         , expectedReadMBytesPerSec(0)
         , replicationId(0)
+        , writesInFlight(0)
+        , bytesInFlight(0)
+        , reportedQueuedBytes(0)
+        , reportedWriteMBytesPerSec(0)
+        , loadReportTime(0)
+        , loadRpc()
     {}
 
     uint32_t getExpectedReadMs();
+    uint64_t getExpectedQueueUs();
 
     /// Number of primary replicas this master has stored on the backup.
     uint32_t primaryReplicaCount;
@@ -45,6 +53,31 @@ struct BackupStats {
 
     /// Replication group Id of the backup.
     uint64_t replicationId;
+
+    /// Number of replica writes this master has outstanding to the backup.
+    uint32_t writesInFlight;
+
+    /// Total bytes of segment data carried by #writesInFlight.
+    uint64_t bytesInFlight;
+
+    /**
+     * Bytes of replica data (from all masters) the backup last reported
+     * as waiting to be written to its storage. Only maintained by
+     * LoadAwareBackupSelector; 0 otherwise.
+     */
+    uint64_t reportedQueuedBytes;
+
+    /// Storage write bandwidth in MB/s the backup last reported, or 0 if
+    /// it hasn't reported any.
+    uint32_t reportedWriteMBytesPerSec;
+
+    /// Cycles::rdtsc() time at which #loadRpc was last sent.
+    uint64_t loadReportTime;
+
+    /// Outstanding request for the backup's load, if any.
+    Tub<GetLoadRpc> loadRpc;
+
+    DISALLOW_COPY_AND_ASSIGN(BackupStats);
 };
 
 /// Tracks BackupStats; a ReplicaManager processes ServerListChanges.
@@ -60,6 +93,8 @@ class BaseBackupSelector {
     virtual ServerId selectSecondary(uint32_t numBackups,
                                      const ServerId backupIds[]) = 0;
     virtual void signalFreedPrimary(const ServerId backupId) = 0;
+    virtual void signalWriteStarted(const ServerId, uint32_t) {}
+    virtual void signalWriteFinished(const ServerId, uint32_t) {}
     virtual ~BaseBackupSelector() {}
 };
 
@@ -77,9 +112,12 @@ class BackupSelector : public BaseBackupSelector {
     virtual ServerId selectSecondary(uint32_t numBackups,
                                      const ServerId backupIds[]);
     void signalFreedPrimary(const ServerId backupId);
+    void signalWriteStarted(const ServerId backupId, uint32_t length);
+    void signalWriteFinished(const ServerId backupId, uint32_t length);
 
   PROTECTED:
     void applyTrackerChanges();
+    BackupStats* findStats(const ServerId backupId);
     bool conflictWithAny(const ServerId backupId,
                          uint32_t numBackups,
                          const ServerId backupIds[]) const;
@@ -84,6 +84,25 @@ TEST_F(BackupSelectorTest, backupStats_getExpectedReadMs) {
     EXPECT_EQ(960u, stats.getExpectedReadMs());
 }
 
+TEST_F(BackupSelectorTest, backupStats_getExpectedQueueUs) {
+    BackupStats stats;
+    stats.expectedReadMBytesPerSec = 100;
+    EXPECT_EQ(0u, stats.getExpectedQueueUs());
+    stats.bytesInFlight = 1024 * 1024;
+    EXPECT_EQ(10000u, stats.getExpectedQueueUs());
+    // Large amounts of outstanding data don't overflow.
+    stats.bytesInFlight = 16lu * 1024 * 1024 * 1024;
+    EXPECT_EQ(163840000u, stats.getExpectedQueueUs());
+
+    // The backup's reported backlog and write bandwidth are used once it
+    // has reported them.
+    stats.bytesInFlight = 1024 * 1024;
+    stats.reportedQueuedBytes = 3 * 1024 * 1024;
+    EXPECT_EQ(40000u, stats.getExpectedQueueUs());
+    stats.reportedWriteMBytesPerSec = 400;
+    EXPECT_EQ(10000u, stats.getExpectedQueueUs());
+}
+
 struct BackgroundEnlistBackup {
     explicit BackgroundEnlistBackup(Context* context)
         : context(context) {}
@@ -250,6 +269,31 @@ TEST_F(BackupSelectorTest, signalFreedPrimary) {
     EXPECT_EQ(9u, stats->primaryReplicaCount);
 }
 
+TEST_F(BackupSelectorTest, signalWriteStartedAndFinished) {
+    std::vector<ServerId> ids;
+    addEqualHosts(ids);
+    selector->applyTrackerChanges();
+
+    BackupStats *stats = selector->tracker[ids[0]];
+    selector->signalWriteStarted(ids[0], 1000);
+    selector->signalWriteStarted(ids[0], 500);
+    EXPECT_EQ(2u, stats->writesInFlight);
+    EXPECT_EQ(1500u, stats->bytesInFlight);
+    selector->signalWriteFinished(ids[0], 1000);
+    EXPECT_EQ(1u, stats->writesInFlight);
+    EXPECT_EQ(500u, stats->bytesInFlight);
+    selector->signalWriteFinished(ids[0], 500);
+    EXPECT_EQ(0u, stats->writesInFlight);
+    EXPECT_EQ(0u, stats->bytesInFlight);
+
+    // Unmatched finishes and unknown backups are ignored.
+    selector->signalWriteFinished(ids[0], 500);
+    EXPECT_EQ(0u, stats->writesInFlight);
+    EXPECT_EQ(0u, stats->bytesInFlight);
+    selector->signalWriteStarted(ServerId(99, 0), 1000);
+    selector->signalWriteFinished(ServerId(99, 0), 1000);
+}
+
 #if 0
 // This test should run forever, hence why it is commented out.
 // Occasionally, when self-doubt mounts, it is worth running, though.
@@ -23,6 +23,7 @@
 #include "ShortMacros.h"
 #include "MultiFileStorage.h"
 #include "Status.h"
+#include "TimeTrace.h"
 
 namespace RAMCloud {
 
@@ -78,7 +79,8 @@ BackupService::BackupService(Context* context,
                                            config->backup.writeRateLimit,
                                            maxWriteBuffers,
                                            config->backup.file.c_str(),
-                                           O_DIRECT | O_SYNC));
+                                           O_DIRECT | O_SYNC,
+                                           config->backup.compressReplicas));
     }
     if (storage->getMetadataSize() < sizeof(BackupReplicaMetadata))
         DIE("Storage metadata block too small to hold BackupReplicaMetadata");
@@ -176,6 +178,29 @@ BackupService::benchmark()
 void
 BackupService::dispatch(WireFormat::Opcode opcode, Rpc* rpc)
 {
+    // Forwarded writes wait for rpcs to other backups, so #mutex can't be
+    // held for the whole rpc (two backups forwarding to each other would
+    // deadlock); the handler locks it itself while it touches replicas.
+    if (opcode == WireFormat::BackupWriteForward::opcode) {
+        callHandler<WireFormat::BackupWriteForward, BackupService,
+                    &BackupService::writeSegmentForward>(rpc);
+        return;
+    }
+    // Load reports only read counters that #storage protects itself, and
+    // shouldn't wait behind the writes whose backlog they describe.
+    if (opcode == WireFormat::BackupGetLoad::opcode) {
+        callHandler<WireFormat::BackupGetLoad, BackupService,
+                    &BackupService::getLoad>(rpc);
+        return;
+    }
+    // Fragment fetches may have to load a replica from storage, and come
+    // from other backups' recovery threads; don't hold up other rpcs.
+    if (opcode == WireFormat::BackupGetFragment::opcode) {
+        callHandler<WireFormat::BackupGetFragment, BackupService,
+                    &BackupService::getFragment>(rpc);
+        return;
+    }
+
     Lock _(mutex); // Lock out GC while any RPC is being processed.
                    // Also, prevent races between RPCs.
 
@@ -215,6 +240,14 @@ BackupService::dispatch(WireFormat::Opcode opcode, Rpc* rpc)
             callHandler<WireFormat::BackupWrite, BackupService,
                         &BackupService::writeSegment>(rpc);
             break;
+        case WireFormat::BackupWriteBatch::opcode:
+            callHandler<WireFormat::BackupWriteBatch, BackupService,
+                        &BackupService::writeSegmentBatch>(rpc);
+            break;
+        case WireFormat::BackupWriteFragment::opcode:
+            callHandler<WireFormat::BackupWriteFragment, BackupService,
+                        &BackupService::writeFragment>(rpc);
+            break;
         default:
             throw UnimplementedRequestError(HERE);
     }
@@ -255,6 +288,87 @@ BackupService::freeSegment(const WireFormat::BackupFree::Request* reqHdr,
     frames.erase(it);
 }
 
+/**
+ * Return the erasure-coded fragment this backup stores for a segment; used
+ * by another backup that is rebuilding the segment for a recovery. Unlike
+ * most rpcs this one isn't dispatched with #mutex held; the lock is only
+ * held while the frame is looked up, not while it is loaded.
+ *
+ * \param reqHdr
+ *      Header of the Rpc request.
+ * \param respHdr
+ *      Header for the Rpc response; the fragment is appended after it.
+ * \param rpc
+ *      The Rpc being serviced.
+ *
+ * \throw BackupBadSegmentIdException
+ *      If the backup doesn't have a fragment of the requested generation
+ *      for the segment.
+ */
+void
+BackupService::getFragment(
+        const WireFormat::BackupGetFragment::Request* reqHdr,
+        WireFormat::BackupGetFragment::Response* respHdr,
+        Rpc* rpc)
+{
+    ServerId masterId(reqHdr->masterId);
+    BackupStorage::FrameRef frame;
+    {
+        Lock _(mutex);
+        if (!initCalled) {
+            throw RetryException(HERE, 100, 100,
+                    "backup service not yet initialized");
+        }
+        auto it = frames.find({masterId, reqHdr->segmentId});
+        if (it != frames.end())
+            frame = it->second;
+    }
+
+    const BackupReplicaMetadata* metadata = NULL;
+    if (frame && !frame->currentlyOpen()) {
+        metadata =
+            static_cast<const BackupReplicaMetadata*>(frame->getMetadata());
+    }
+    if (metadata == NULL || !metadata->checkIntegrity() ||
+            metadata->logId != masterId.getId() ||
+            metadata->dataFragments == 0 ||
+            metadata->fragmentGeneration != reqHdr->fragmentGeneration) {
+        LOG(NOTICE, "Asked for fragment of <%s,%lu> (generation %u), which "
+            "isn't stored on this backup", masterId.toString().c_str(),
+            reqHdr->segmentId, reqHdr->fragmentGeneration);
+        throw BackupBadSegmentIdException(HERE);
+    }
+
+    // Leave the frame loaded if this backup's own recovery is using it.
+    bool wasLoaded = frame->isLoaded();
+    uint32_t length = metadata->getFragmentLength();
+    rpc->replyPayload->appendCopy(frame->load(), length);
+    if (!wasLoaded)
+        frame->unload();
+    respHdr->fragmentIndex = metadata->fragmentIndex;
+    respHdr->length = length;
+}
+
+/**
+ * Report how much replica data this backup has waiting to be written to
+ * storage and how fast its storage has recently been writing.
+ *
+ * \param reqHdr
+ *      Header of the Rpc request.
+ * \param respHdr
+ *      Header for the Rpc response, filled in with the load.
+ * \param rpc
+ *      The Rpc being serviced.
+ */
+void
+BackupService::getLoad(const WireFormat::BackupGetLoad::Request* reqHdr,
+                       WireFormat::BackupGetLoad::Response* respHdr,
+                       Rpc* rpc)
+{
+    respHdr->queuedBytes = storage->getQueuedBytes();
+    respHdr->writeMBytesPerSec = storage->getWriteMBytesPerSec();
+}
+
 /**
  * Return the data for a particular tablet that was recovered by a call
  * to startReadingData().
@@ -472,9 +586,17 @@ BackupService::startReadingData(
         oldRecovery->free();
         mustCreateRecovery = true;
     }
+    // Replicas the storage still has to load for other crashed masters;
+    // the coordinator uses this to spread replica loads across backups.
+    uint32_t queuedReplicaCount = 0;
+    foreach (const auto& other, recoveries) {
+        if (other.first != crashedMasterId)
+            queuedReplicaCount += other.second->getPendingReplicaCount();
+    }
+
     BackupMasterRecovery* recovery;
     if (mustCreateRecovery) {
-        recovery = new BackupMasterRecovery(taskQueue,
+        recovery = new BackupMasterRecovery(context, taskQueue,
                                             reqHdr->recoveryId,
                                             crashedMasterId,
                                             segmentSize,
@@ -493,6 +615,7 @@ BackupService::startReadingData(
         framesForRecovery.emplace_back(it->second);
     }
     recovery->start(framesForRecovery, rpc->replyPayload, respHdr);
+    respHdr->queuedReplicaCount = queuedReplicaCount;
     metrics->backup.storageType = uint64_t(storage->storageType);
 }
 
@@ -527,7 +650,93 @@ BackupService::startPartitioningReplicas(
     ProtoBuf::RecoveryPartition partitions;
     ProtoBuf::parseFromResponse(rpc->requestPayload, sizeof(*reqHdr),
                                 reqHdr->partitionsLength, &partitions);
-    recovery->setPartitionsAndSchedule(partitions);
+
+    typedef WireFormat::BackupStartPartitioningReplicas::Fragment Fragment;
+    std::vector<Fragment> decodeSources;
+    uint32_t offset = sizeof32(*reqHdr) + reqHdr->partitionsLength;
+    for (uint32_t i = 0; i < reqHdr->decodeCount; i++) {
+        const Fragment* source =
+            rpc->requestPayload->getOffset<Fragment>(offset);
+        if (source == NULL)
+            throw MessageTooShortError(HERE);
+        decodeSources.push_back(*source);
+        offset += sizeof32(*source);
+    }
+    recovery->setPartitionsAndSchedule(partitions, decodeSources);
+}
+
+/**
+ * Store one erasure-coded fragment of a closed segment in place of a full
+ * replica (see ReplicatedSegment). The fragment is written and closed in a
+ * single step. Any replica or fragment of the same segment already on this
+ * backup is released: the master never places a fragment on a backup that
+ * holds a replica it still needs, so an existing frame is either a retry of
+ * this write or left over from an earlier encoding.
+ *
+ * \param reqHdr
+ *      Header of the Rpc request; the fragment follows it.
+ * \param respHdr
+ *      Header for the Rpc response.
+ * \param rpc
+ *      The Rpc being serviced.
+ *
+ * \throw BackupSegmentOverflowException
+ *      If the fragment is larger than a segment.
+ */
+void
+BackupService::writeFragment(
+        const WireFormat::BackupWriteFragment::Request* reqHdr,
+        WireFormat::BackupWriteFragment::Response* respHdr,
+        Rpc* rpc)
+{
+    ServerId masterId(reqHdr->masterId);
+    checkWriteCaller(masterId);
+    if (rpc->requestPayload->size() - sizeof32(*reqHdr) < reqHdr->length)
+        throw MessageTooShortError(HERE);
+    if (reqHdr->length > segmentSize)
+        throw BackupSegmentOverflowException(HERE);
+    if (reqHdr->dataFragments == 0)
+        throw RequestFormatError(HERE);
+
+    uint64_t segmentId = reqHdr->segmentId;
+    auto frameIt = frames.find({masterId, segmentId});
+    if (frameIt != frames.end()) {
+        const BackupReplicaMetadata* metadata =
+            static_cast<const BackupReplicaMetadata*>(
+                frameIt->second->getMetadata());
+        if (!frameIt->second->currentlyOpen() &&
+                frameIt->second->wasAppendedToByCurrentProcess() &&
+                metadata->dataFragments != 0 &&
+                metadata->fragmentIndex == reqHdr->fragmentIndex &&
+                metadata->fragmentGeneration == reqHdr->fragmentGeneration) {
+            LOG(NOTICE, "Fragment %u of <%s,%lu> already stored; treating "
+                "the request as noop", reqHdr->fragmentIndex,
+                masterId.toString().c_str(), segmentId);
+            return;
+        }
+        frames.erase(frameIt);
+    }
+
+    LOG(DEBUG, "Storing fragment %u of <%s,%lu>", reqHdr->fragmentIndex,
+        masterId.toString().c_str(), segmentId);
+    BackupStorage::FrameRef frame =
+        storage->open(config->backup.sync, masterId, segmentId);
+    frames[MasterSegmentIdPair(masterId, segmentId)] = frame;
+    BackupReplicaMetadata metadata(reqHdr->certificate,
+                                   masterId.getId(), segmentId,
+                                   segmentSize, reqHdr->segmentEpoch,
+                                   true, false,
+                                   reqHdr->dataFragments,
+                                   reqHdr->parityFragments,
+                                   reqHdr->fragmentIndex,
+                                   reqHdr->fragmentGeneration);
+    CycleCounter<RawMetric> _(&metrics->backup.writeCopyTicks);
+    frame->append(*rpc->requestPayload, sizeof32(*reqHdr), reqHdr->length, 0,
+                  &metadata, sizeof(metadata));
+    frame->close();
+    metrics->backup.writeCopyBytes += reqHdr->length;
+    PerfStats::threadStats.backupBytesReceived += reqHdr->length;
+    bytesWritten += reqHdr->length;
 }
 
 /**
@@ -569,10 +778,155 @@ BackupService::writeSegment(const WireFormat::BackupWrite::Request* reqHdr,
                             Rpc* rpc)
 {
     ServerId masterId(reqHdr->masterId);
-    uint64_t segmentId = reqHdr->segmentId;
+    checkWriteCaller(masterId);
+    WireFormat::BackupWriteBatch::Entry write(reqHdr->segmentId,
+            reqHdr->segmentEpoch, reqHdr->offset, reqHdr->length,
+            reqHdr->open, reqHdr->close, reqHdr->primary,
+            reqHdr->certificateIncluded, reqHdr->certificate);
+    writeReplica(masterId, write, rpc->requestPayload, sizeof32(*reqHdr));
+}
+
+/**
+ * Perform several replica writes for a single master, as if each had
+ * arrived in a separate BACKUP_WRITE request. The writes are applied in
+ * order; a failure in one of them doesn't prevent the others from being
+ * applied, and is reported in that write's status in the response.
+ *
+ * \param reqHdr
+ *      Header of the Rpc request; it is followed by reqHdr->numWrites
+ *      BackupWriteBatch::Entry structures, each followed by its data.
+ * \param respHdr
+ *      Header for the Rpc response; one Status for each write will be
+ *      appended after it.
+ * \param rpc
+ *      The Rpc being serviced.
+ */
+void
+BackupService::writeSegmentBatch(
+        const WireFormat::BackupWriteBatch::Request* reqHdr,
+        WireFormat::BackupWriteBatch::Response* respHdr,
+        Rpc* rpc)
+{
+    ServerId masterId(reqHdr->masterId);
+    checkWriteCaller(masterId);
 
+    uint32_t offset = sizeof32(*reqHdr);
+    for (uint32_t i = 0; i < reqHdr->numWrites; i++) {
+        const WireFormat::BackupWriteBatch::Entry* write =
+                rpc->requestPayload->getOffset<
+                WireFormat::BackupWriteBatch::Entry>(offset);
+        if (write == NULL ||
+                rpc->requestPayload->size() - offset - sizeof32(*write) <
+                write->length) {
+            throw MessageTooShortError(HERE);
+        }
+        offset += sizeof32(*write);
+        Status status = STATUS_OK;
+        try {
+            writeReplica(masterId, *write, rpc->requestPayload, offset);
+        } catch (const ClientException& e) {
+            status = e.status;
+        }
+        rpc->replyPayload->emplaceAppend<Status>(status);
+        offset += write->length;
+    }
+    respHdr->numWrites = reqHdr->numWrites;
+}
+
+/**
+ * Apply a write to the primary replica of a segment stored on this backup,
+ * then forward the same write to the backups storing the segment's
+ * secondary replicas, so that the master only has to send the data once.
+ * Unlike other rpcs this one isn't dispatched with #mutex held; the lock is
+ * only held while the local replica is written, not while waiting for the
+ * forwarded writes.
+ *
+ * \param reqHdr
+ *      Header of the Rpc request; it is followed by reqHdr->numForwards
+ *      backup ids and then the data to be written.
+ * \param respHdr
+ *      Header for the Rpc response; one Status for each backup the write
+ *      was forwarded to will be appended after it.
+ * \param rpc
+ *      The Rpc being serviced.
+ *
+ * \throw BackupSegmentOverflowException
+ *      If the write request is beyond the end of the segment.
+ * \throw BackupBadSegmentIdException
+ *      If the segment is not open on this backup. The write isn't
+ *      forwarded if it fails locally.
+ */
+void
+BackupService::writeSegmentForward(
+        const WireFormat::BackupWriteForward::Request* reqHdr,
+        WireFormat::BackupWriteForward::Response* respHdr,
+        Rpc* rpc)
+{
+    ServerId masterId(reqHdr->masterId);
+    uint32_t dataOffset = sizeof32(*reqHdr) +
+            reqHdr->numForwards * sizeof32(uint64_t);
+    if (rpc->requestPayload->size() < dataOffset ||
+            rpc->requestPayload->size() - dataOffset < reqHdr->length) {
+        throw MessageTooShortError(HERE);
+    }
+    SegmentCertificate certificate = reqHdr->certificate;
+
+    {
+        Lock _(mutex);
+        if (!initCalled) {
+            LOG(WARNING, "%s invoked before initialization complete; "
+                    "returning STATUS_RETRY",
+                    WireFormat::opcodeSymbol(WireFormat::BACKUP_WRITE_FORWARD));
+            throw RetryException(HERE, 100, 100,
+                    "backup service not yet initialized");
+        }
+        CycleCounter<RawMetric> serviceTicks(&metrics->backup.serviceTicks);
+        checkWriteCaller(masterId);
+        WireFormat::BackupWriteBatch::Entry write(reqHdr->segmentId,
+                reqHdr->segmentEpoch, reqHdr->offset, reqHdr->length,
+                false, reqHdr->close, true, reqHdr->certificateIncluded,
+                certificate);
+        writeReplica(masterId, write, rpc->requestPayload, dataOffset);
+    }
+
+    // Issue all of the forwarded writes before waiting for any of them.
+    std::vector<std::unique_ptr<WriteSegmentRpc>> rpcs;
+    for (uint32_t i = 0; i < reqHdr->numForwards; i++) {
+        ServerId backupId(*rpc->requestPayload->getOffset<uint64_t>(
+                sizeof32(*reqHdr) + i * sizeof32(uint64_t)));
+        rpcs.emplace_back(new WriteSegmentRpc(context, backupId, masterId,
+                reqHdr->segmentId, reqHdr->segmentEpoch,
+                rpc->requestPayload, dataOffset, reqHdr->offset,
+                reqHdr->length,
+                reqHdr->certificateIncluded ? &certificate : NULL,
+                false, reqHdr->close, false));
+    }
+    foreach (auto& forward, rpcs) {
+        Status status = STATUS_OK;
+        try {
+            forward->wait();
+        } catch (const ClientException& e) {
+            status = e.status;
+        }
+        rpc->replyPayload->emplaceAppend<Status>(status);
+    }
+    respHdr->numForwards = reqHdr->numForwards;
+}
+
+/**
+ * Reject replica writes from masters that aren't in this backup's server
+ * list. See "Zombies" in designNotes.
+ *
+ * \param masterId
+ *      The master that sent the write request.
+ *
+ * \throw CallerNotInClusterException
+ *      If \a masterId isn't an active member of the cluster.
+ */
+void
+BackupService::checkWriteCaller(ServerId masterId)
+{
     if  (!context->serverList->isUp(masterId) && !testingSkipCallerIdCheck) {
-        // See "Zombies" in designNotes.
         LOG(WARNING, "Received backup write request from server %s which is "
             "not in server list version %lu:\n%s",
             masterId.toString().c_str(),
@@ -580,13 +934,39 @@ BackupService::writeSegment(const WireFormat::BackupWrite::Request* reqHdr,
             context->serverList->toString().c_str());
         throw CallerNotInClusterException(HERE);
     }
+}
+
+/**
+ * Does most of the work for writeSegment and writeSegmentBatch: apply a
+ * single write (including opening and closing, if requested) to a replica.
+ *
+ * \param masterId
+ *      The master whose segment is being replicated.
+ * \param write
+ *      Describes the write.
+ * \param payload
+ *      Buffer containing the data to be written.
+ * \param dataOffset
+ *      Offset in \a payload of the first byte of data to be written.
+ *
+ * \throw BackupSegmentOverflowException
+ *      If the write request is beyond the end of the segment.
+ * \throw BackupBadSegmentIdException
+ *      If the segment is not open.
+ */
+void
+BackupService::writeReplica(ServerId masterId,
+                            const WireFormat::BackupWriteBatch::Entry& write,
+                            Buffer* payload, uint32_t dataOffset)
+{
+    uint64_t segmentId = write.segmentId;
     auto frameIt = frames.find({masterId, segmentId});
     BackupStorage::FrameRef frame;
     if (frameIt != frames.end())
         frame = frameIt->second;
 
     if (frame && !frame->wasAppendedToByCurrentProcess()) {
-        if (reqHdr->open) {
+        if (write.open) {
             // We get here if a backup crashes, restarts, reloads a
             // replica from disk, and then the master detects the crash and
             // tries to re-replicate the segment that lost a replica on
@@ -606,7 +986,7 @@ BackupService::writeSegment(const WireFormat::BackupWrite::Request* reqHdr,
     }
 
     // Perform open, if any.
-    if (reqHdr->open && !frame) {
+    if (write.open && !frame) {
         LOG(DEBUG, "Opening <%s,%lu>", masterId.toString().c_str(),
             segmentId);
         frame = storage->open(config->backup.sync, masterId, segmentId);
@@ -633,23 +1013,25 @@ BackupService::writeSegment(const WireFormat::BackupWrite::Request* reqHdr,
         }
         CycleCounter<RawMetric> __(&metrics->backup.writeCopyTicks);
         Tub<BackupReplicaMetadata> metadata;
-        if (reqHdr->certificateIncluded) {
-            metadata.construct(reqHdr->certificate,
+        if (write.certificateIncluded) {
+            metadata.construct(write.certificate,
                                masterId.getId(), segmentId,
                                segmentSize,
-                               reqHdr->segmentEpoch,
-                               reqHdr->close, reqHdr->primary);
+                               write.segmentEpoch,
+                               write.close, write.primary);
         }
-        frame->append(*rpc->requestPayload, sizeof(*reqHdr),
-                      reqHdr->length, reqHdr->offset,
+        frame->append(*payload, dataOffset,
+                      write.length, write.offset,
                       metadata.get(), sizeof(*metadata));
-        metrics->backup.writeCopyBytes += reqHdr->length;
-        PerfStats::threadStats.backupBytesReceived += reqHdr->length;
-        bytesWritten += reqHdr->length;
+        TimeTrace::recordSampled("trace %u: backup wrote %u bytes of "
+                "segment %u", write.length, static_cast<uint32_t>(segmentId));
+        metrics->backup.writeCopyBytes += write.length;
+        PerfStats::threadStats.backupBytesReceived += write.length;
+        bytesWritten += write.length;
     }
 
     // Perform close, if any.
-    if (reqHdr->close) {
+    if (write.close) {
         LOG(DEBUG, "Closing <%s,%lu>", masterId.toString().c_str(), segmentId);
         frame->close();
     }
@@ -51,6 +51,12 @@ class BackupService : public Service
     void freeSegment(const WireFormat::BackupFree::Request* reqHdr,
                      WireFormat::BackupFree::Response* respHdr,
                      Rpc* rpc);
+    void getFragment(const WireFormat::BackupGetFragment::Request* reqHdr,
+                     WireFormat::BackupGetFragment::Response* respHdr,
+                     Rpc* rpc);
+    void getLoad(const WireFormat::BackupGetLoad::Request* reqHdr,
+                 WireFormat::BackupGetLoad::Response* respHdr,
+                 Rpc* rpc);
     void getRecoveryData(
         const WireFormat::BackupGetRecoveryData::Request* reqHdr,
         WireFormat::BackupGetRecoveryData::Response* respHdr,
@@ -69,9 +75,23 @@ class BackupService : public Service
         const WireFormat::BackupStartPartitioningReplicas::Request* reqHdr,
         WireFormat::BackupStartPartitioningReplicas::Response* respHdr,
         Rpc* rpc);
+    void writeFragment(const WireFormat::BackupWriteFragment::Request* req,
+                       WireFormat::BackupWriteFragment::Response* resp,
+                       Rpc* rpc);
     void writeSegment(const WireFormat::BackupWrite::Request* req,
                       WireFormat::BackupWrite::Response* resp,
                       Rpc* rpc);
+    void writeSegmentBatch(const WireFormat::BackupWriteBatch::Request* req,
+                           WireFormat::BackupWriteBatch::Response* resp,
+                           Rpc* rpc);
+    void writeSegmentForward(
+            const WireFormat::BackupWriteForward::Request* req,
+            WireFormat::BackupWriteForward::Response* resp,
+            Rpc* rpc);
+    void checkWriteCaller(ServerId masterId);
+    void writeReplica(ServerId masterId,
+                      const WireFormat::BackupWriteBatch::Entry& write,
+                      Buffer* payload, uint32_t dataOffset);
     void gcMain();
     void initOnceEnlisted();
     void trackerChangesEnqueued();
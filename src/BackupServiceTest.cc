@@ -491,7 +491,7 @@ TEST_F(BackupServiceTest, writeSegment_segmentClosed) {
     closeSegment(ServerId(99, 0), 88);
     TestLog::reset();
     writeRawString({99, 0}, 88, 10, "test");
-    EXPECT_EQ("writeSegment: Write requested for closed replica <99.0,88>; "
+    EXPECT_EQ("writeReplica: Write requested for closed replica <99.0,88>; "
             "treating the request as noop", TestLog::get());
 }
 
@@ -580,6 +580,148 @@ TEST_F(BackupServiceTest, writeSegment_openSegmentOutOfStorage) {
         BackupOpenRejectedException);
 }
 
+TEST_F(BackupServiceTest, writeSegmentBatch) {
+    Segment segment;
+    segment.copyIn(10, "first", 6);
+    segment.copyIn(20, "second", 7);
+    SegmentCertificate certificate;
+    WriteSegmentBatchRpc::Write open(88, 0, &segment, 0, 0, &certificate,
+                                     true, false, true);
+    WriteSegmentBatchRpc::Write first(88, 0, &segment, 10, 6, NULL,
+                                      false, false, true);
+    WriteSegmentBatchRpc::Write bad(89, 0, &segment, 20, 7, NULL,
+                                    false, false, true);
+    WriteSegmentBatchRpc::Write second(88, 0, &segment, 20, 7, NULL,
+                                       false, true, true);
+    std::vector<const WriteSegmentBatchRpc::Write*> writes =
+            {&open, &first, &bad, &second};
+    WriteSegmentBatchRpc rpc(&context, backupId, {99, 0}, writes);
+    std::vector<Status> statuses;
+    rpc.wait(&statuses);
+
+    // The write to the unopened segment fails without affecting the others.
+    ASSERT_EQ(4u, statuses.size());
+    EXPECT_EQ(STATUS_OK, statuses[0]);
+    EXPECT_EQ(STATUS_OK, statuses[1]);
+    EXPECT_EQ(STATUS_BACKUP_BAD_SEGMENT_ID, statuses[2]);
+    EXPECT_EQ(STATUS_OK, statuses[3]);
+    auto frameIt = backup->frames.find({{99, 0}, 88});
+    ASSERT_TRUE(frameIt != backup->frames.end());
+    const char* replicaData =
+        static_cast<const char*>(frameIt->second->load());
+    EXPECT_STREQ("first", &replicaData[10]);
+    EXPECT_STREQ("second", &replicaData[20]);
+    EXPECT_FALSE(frameIt->second->currentlyOpen());
+}
+
+TEST_F(BackupServiceTest, writeSegmentBatch_checkCallerId) {
+    backup->testingSkipCallerIdCheck = false;
+    Segment segment;
+    WriteSegmentBatchRpc::Write open(88, 0, &segment, 0, 0, NULL,
+                                     true, false, true);
+    std::vector<const WriteSegmentBatchRpc::Write*> writes = {&open};
+    WriteSegmentBatchRpc rpc(&context, backupId, {99, 0}, writes);
+    std::vector<Status> statuses;
+    EXPECT_THROW(rpc.wait(&statuses), CallerNotInClusterException);
+}
+
+TEST_F(BackupServiceTest, writeSegmentForward) {
+    Server* secondary = cluster->addServer(config);
+    secondary->backup->testingSkipCallerIdCheck = true;
+    openSegment({99, 0}, 88);
+    BackupClient::writeSegment(&context, secondary->serverId, {99, 0}, 88, 0,
+                               NULL, 0, 0, NULL, true, false, false);
+
+    Segment segment;
+    segment.copyIn(10, "forwarded", 10);
+    SegmentCertificate certificate;
+    WriteSegmentForwardRpc rpc(&context, backupId, {99, 0}, 88, 0, &segment,
+                               10, 10, &certificate, true,
+                               {secondary->serverId, ServerId(57, 0)});
+    std::vector<Status> statuses;
+    rpc.wait(&statuses);
+
+    ASSERT_EQ(2u, statuses.size());
+    EXPECT_EQ(STATUS_OK, statuses[0]);
+    EXPECT_EQ(STATUS_SERVER_NOT_UP, statuses[1]);
+    std::vector<BackupService*> services = {backup, secondary->backup.get()};
+    foreach (BackupService* service, services) {
+        auto frameIt = service->frames.find({{99, 0}, 88});
+        ASSERT_TRUE(frameIt != service->frames.end());
+        const char* replicaData =
+            static_cast<const char*>(frameIt->second->load());
+        EXPECT_STREQ("forwarded", &replicaData[10]);
+        EXPECT_FALSE(frameIt->second->currentlyOpen());
+    }
+}
+
+TEST_F(BackupServiceTest, writeSegmentForward_localWriteFails) {
+    Server* secondary = cluster->addServer(config);
+    secondary->backup->testingSkipCallerIdCheck = true;
+    BackupClient::writeSegment(&context, secondary->serverId, {99, 0}, 88, 0,
+                               NULL, 0, 0, NULL, true, false, false);
+
+    // The primary replica isn't open, so the write isn't forwarded.
+    Segment segment;
+    segment.copyIn(10, "forwarded", 10);
+    WriteSegmentForwardRpc rpc(&context, backupId, {99, 0}, 88, 0, &segment,
+                               10, 10, NULL, false, {secondary->serverId});
+    std::vector<Status> statuses;
+    EXPECT_THROW(rpc.wait(&statuses), BackupBadSegmentIdException);
+    EXPECT_EQ(0lu, secondary->backup->bytesWritten);
+}
+
+TEST_F(BackupServiceTest, writeFragmentAndGetFragment) {
+    SegmentCertificate certificate;
+    certificate.segmentLength = 20;
+    WriteFragmentRpc(&context, backupId, {99, 0}, 88, 0, certificate,
+                     2, 1, 1, 3, "fragment!", 10).wait();
+
+    auto frameIt = backup->frames.find({{99, 0}, 88});
+    ASSERT_TRUE(frameIt != backup->frames.end());
+    EXPECT_FALSE(frameIt->second->currentlyOpen());
+    auto* metadata = toMetadata(frameIt->second->getMetadata());
+    EXPECT_TRUE(metadata->closed);
+    EXPECT_FALSE(metadata->primary);
+    EXPECT_EQ(2u, metadata->dataFragments);
+    EXPECT_EQ(1u, metadata->parityFragments);
+    EXPECT_EQ(1u, metadata->fragmentIndex);
+    EXPECT_EQ(3u, metadata->fragmentGeneration);
+    EXPECT_EQ(10u, metadata->getFragmentLength());
+
+    char data[20];
+    uint8_t fragmentIndex = 0;
+    GetFragmentRpc rpc(&context, backupId, {99, 0}, 88, 3);
+    EXPECT_EQ(10u, rpc.wait(&fragmentIndex, data, sizeof(data)));
+    EXPECT_EQ(1u, fragmentIndex);
+    EXPECT_STREQ("fragment!", data);
+
+    GetFragmentRpc staleRpc(&context, backupId, {99, 0}, 88, 2);
+    EXPECT_THROW(staleRpc.wait(&fragmentIndex, data, sizeof(data)),
+                 BackupBadSegmentIdException);
+}
+
+TEST_F(BackupServiceTest, writeFragment_replacesReplica) {
+    openSegment({99, 0}, 88);
+    SegmentCertificate certificate;
+    certificate.segmentLength = 10;
+    WriteFragmentRpc(&context, backupId, {99, 0}, 88, 0, certificate,
+                     1, 1, 0, 0, "fragment!", 10).wait();
+    auto frameIt = backup->frames.find({{99, 0}, 88});
+    ASSERT_TRUE(frameIt != backup->frames.end());
+    EXPECT_EQ(1u, toMetadata(frameIt->second->getMetadata())->dataFragments);
+}
+
+TEST_F(BackupServiceTest, getFragment_notAFragment) {
+    openSegment({99, 0}, 88);
+    closeSegment({99, 0}, 88);
+    char data[20];
+    uint8_t fragmentIndex;
+    GetFragmentRpc rpc(&context, backupId, {99, 0}, 88, 0);
+    EXPECT_THROW(rpc.wait(&fragmentIndex, data, sizeof(data)),
+                 BackupBadSegmentIdException);
+}
+
 TEST_F(BackupServiceTest, GarbageCollectDownServerTask) {
     openSegment({99, 0}, 88);
     openSegment({99, 0}, 89);
@@ -590,7 +732,7 @@ TEST_F(BackupServiceTest, GarbageCollectDownServerTask) {
     EXPECT_NE(backup->frames.end(), backup->frames.find({{99, 1}, 88}));
 
     backup->recoveries[ServerId{99, 0}] =
-        new BackupMasterRecovery(backup->taskQueue, 456, {99, 0},
+        new BackupMasterRecovery(&context, backup->taskQueue, 456, {99, 0},
                                  config.segmentSize, 450, 20);
     EXPECT_NE(backup->recoveries.end(), backup->recoveries.find({99, 0}));
 
@@ -93,6 +93,28 @@ BackupStorage::freeFrame(Frame* frame)
     frame->free();
 }
 
+/**
+ * Return the number of bytes appended to frames that haven't yet been
+ * written to storage: the backlog that new replica data sent to this
+ * backup queues behind. Storage that writes appended data immediately
+ * (the default) always returns 0.
+ */
+uint64_t
+BackupStorage::getQueuedBytes()
+{
+    return 0;
+}
+
+/**
+ * Return the bandwidth, in MB/s, at which this storage has recently been
+ * writing replica data, or 0 if it hasn't measured any (the default).
+ */
+uint32_t
+BackupStorage::getWriteMBytesPerSec()
+{
+    return 0;
+}
+
 /**
  * Called by subclass instances to throttle the client-perceived write
  * throughput after each write operation.
@@ -441,6 +441,9 @@ class BackupStorage {
      */
     virtual void fry() = 0;
 
+    virtual uint64_t getQueuedBytes();
+    virtual uint32_t getWriteMBytesPerSec();
+
     /// See #storageType.
     enum class Type { UNKNOWN = 0, MEMORY = 1, DISK = 2 };
 
@@ -0,0 +1,219 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "BackupWriteBatcher.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+// --- BackupWriteBatcher::Write ---
+
+/**
+ * Submit a replica write to a BackupWriteBatcher; it will be sent the next
+ * time the batcher runs. The arguments other than \a batcher have the same
+ * meanings as for WriteSegmentRpc.
+ */
+BackupWriteBatcher::Write::Write(BackupWriteBatcher& batcher,
+        ServerId backupId, ServerId masterId, uint64_t segmentId,
+        uint64_t segmentEpoch, const Segment* segment, uint32_t offset,
+        uint32_t length, const SegmentCertificate* certificate,
+        bool open, bool close, bool primary)
+    : batcher(batcher)
+    , backupId(backupId)
+    , masterId(masterId)
+    , write(segmentId, segmentEpoch, segment, offset, length, certificate,
+            open, close, primary)
+    , batch(NULL)
+    , finished(false)
+    , status(STATUS_OK)
+{
+    batcher.waiting.push_back(this);
+    batcher.schedule();
+}
+
+BackupWriteBatcher::Write::~Write()
+{
+    cancel();
+}
+
+/**
+ * Abandon the write. If it hasn't been sent yet it never will be; if it
+ * has, the outcome will be ignored. After this method returns isReady
+ * returns true, and wait returns without throwing.
+ */
+void
+BackupWriteBatcher::Write::cancel()
+{
+    if (finished)
+        return;
+    if (batch == NULL) {
+        batcher.waiting.remove(this);
+    } else {
+        foreach (Write*& write, batch->writes) {
+            if (write == this)
+                write = NULL;
+        }
+        batch = NULL;
+    }
+    finished = true;
+    status = STATUS_OK;
+}
+
+/**
+ * Return true if the write has completed (successfully or not), meaning
+ * wait will not block.
+ */
+bool
+BackupWriteBatcher::Write::isReady()
+{
+    return finished;
+}
+
+/**
+ * Return once the write has completed; the batcher must continue to run
+ * in the meantime (normally the caller is itself a Task on the same
+ * TaskQueue and only calls this once isReady returns true).
+ *
+ * \throw ClientException
+ *      The write failed; the exception is the same one a WriteSegmentRpc
+ *      for the same write would have thrown.
+ */
+void
+BackupWriteBatcher::Write::wait()
+{
+    while (!finished)
+        batcher.performTask();
+    if (status != STATUS_OK)
+        ClientException::throwException(HERE, status);
+}
+
+// --- BackupWriteBatcher ---
+
+/**
+ * Construct a BackupWriteBatcher.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param taskQueue
+ *      The ReplicaManager's TaskQueue; the batcher schedules itself here
+ *      whenever it has writes to send or rpcs to poll.
+ */
+BackupWriteBatcher::BackupWriteBatcher(Context* context, TaskQueue& taskQueue)
+    : Task(taskQueue)
+    , context(context)
+    , waiting()
+    , outstanding()
+{
+}
+
+/**
+ * Cancel all outstanding rpcs; any writes still referring to this batcher
+ * must have been destroyed already.
+ */
+BackupWriteBatcher::~BackupWriteBatcher()
+{
+    foreach (auto& batch, outstanding)
+        batch->rpc->cancel();
+}
+
+/**
+ * Called by the TaskQueue whenever there are writes waiting to be sent
+ * or rpcs outstanding. Collects the results of completed rpcs, then sends
+ * all of the waiting writes.
+ */
+void
+BackupWriteBatcher::performTask()
+{
+    finishBatches();
+    sendBatches();
+    if (!outstanding.empty())
+        schedule();
+}
+
+/**
+ * Check each outstanding rpc; for the ones that have completed, record
+ * the outcome in each of their writes and discard the batch.
+ */
+void
+BackupWriteBatcher::finishBatches()
+{
+    for (auto it = outstanding.begin(); it != outstanding.end(); ) {
+        Batch* batch = it->get();
+        if (!batch->rpc->isReady()) {
+            ++it;
+            continue;
+        }
+        std::vector<Status> statuses;
+        try {
+            batch->rpc->wait(&statuses);
+        } catch (const ClientException& e) {
+            // The rpc as a whole failed (e.g. the backup crashed), so each
+            // of the writes failed the same way.
+            statuses.assign(batch->writes.size(), e.status);
+        }
+        for (size_t i = 0; i < batch->writes.size(); i++) {
+            Write* write = batch->writes[i];
+            if (write == NULL)
+                continue;
+            write->batch = NULL;
+            write->finished = true;
+            if (i < statuses.size())
+                write->status = statuses[i];
+            else
+                write->status = STATUS_RESPONSE_FORMAT_ERROR;
+        }
+        it = outstanding.erase(it);
+    }
+}
+
+/**
+ * Send all of the waiting writes, grouping those for the same backup
+ * into as few rpcs as the batch limits allow.
+ */
+void
+BackupWriteBatcher::sendBatches()
+{
+    while (!waiting.empty()) {
+        ServerId backupId = waiting.front()->backupId;
+        ServerId masterId = waiting.front()->masterId;
+        std::unique_ptr<Batch> batch(new Batch());
+        std::vector<const WriteSegmentBatchRpc::Write*> writes;
+        uint32_t bytes = 0;
+        for (auto it = waiting.begin(); it != waiting.end(); ) {
+            Write* write = *it;
+            if (write->backupId != backupId || write->masterId != masterId) {
+                ++it;
+                continue;
+            }
+            if (!writes.empty() &&
+                    bytes + write->write.length > MAX_BYTES_PER_BATCH) {
+                break;
+            }
+            bytes += write->write.length;
+            write->batch = batch.get();
+            batch->writes.push_back(write);
+            writes.push_back(&write->write);
+            it = waiting.erase(it);
+            if (writes.size() == MAX_WRITES_PER_BATCH)
+                break;
+        }
+        TEST_LOG("Sending %lu writes (%u bytes) to backup %s",
+                 writes.size(), bytes, backupId.toString().c_str());
+        batch->rpc.construct(context, backupId, masterId, writes);
+        outstanding.push_back(std::move(batch));
+    }
+}
+
+} // namespace RAMCloud
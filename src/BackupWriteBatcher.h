@@ -0,0 +1,151 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_BACKUPWRITEBATCHER_H
+#define RAMCLOUD_BACKUPWRITEBATCHER_H
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "Common.h"
+#include "BackupClient.h"
+#include "ServerId.h"
+#include "TaskQueue.h"
+#include "Tub.h"
+
+namespace RAMCloud {
+
+/**
+ * A Task (see TaskQueue) that combines replica writes headed for the same
+ * backup into a single BACKUP_WRITE_BATCH rpc. Without it every replica
+ * of every segment with data to replicate (typically the head segment plus
+ * any segments that were just closed, or many segments at once during
+ * recovery) costs its own rpc.
+ *
+ * ReplicatedSegments create a BackupWriteBatcher::Write wherever they would
+ * otherwise create a WriteSegmentRpc; the write is held until the next time
+ * the batcher runs, at which point all of the writes waiting for a given
+ * backup are sent together. Each Write completes (with its own status) when
+ * the batch containing it completes.
+ *
+ * Logically part of ReplicaManager, which owns the batcher and shares its
+ * TaskQueue with it. Not thread-safe: all methods of this class and of
+ * Write must be invoked with ReplicaManager::dataMutex held.
+ */
+class BackupWriteBatcher : public Task {
+  PRIVATE:
+    struct Batch;
+
+  PUBLIC:
+    /**
+     * Handle for a single replica write submitted to a BackupWriteBatcher.
+     * Has the same interface as WriteSegmentRpc, so that ReplicatedSegment
+     * can treat the two interchangeably.
+     */
+    class Write {
+      PUBLIC:
+        Write(BackupWriteBatcher& batcher, ServerId backupId,
+              ServerId masterId, uint64_t segmentId, uint64_t segmentEpoch,
+              const Segment* segment, uint32_t offset, uint32_t length,
+              const SegmentCertificate* certificate,
+              bool open, bool close, bool primary);
+        ~Write();
+        void cancel();
+        bool isReady();
+        void wait();
+
+      PRIVATE:
+        /// The batcher this write was submitted to.
+        BackupWriteBatcher& batcher;
+
+        /// Backup the write is destined for.
+        ServerId backupId;
+
+        /// Master whose segment is being replicated.
+        ServerId masterId;
+
+        /// Describes the write; passed to WriteSegmentBatchRpc.
+        WriteSegmentBatchRpc::Write write;
+
+        /// The batch carrying this write, or NULL if the write hasn't
+        /// been sent yet (or has finished).
+        Batch* batch;
+
+        /// True means the write has completed (or has been canceled);
+        /// #status holds its outcome.
+        bool finished;
+
+        /// Outcome of the write; valid only if #finished is true.
+        Status status;
+
+        friend class BackupWriteBatcher;
+        DISALLOW_COPY_AND_ASSIGN(Write);
+    };
+
+    BackupWriteBatcher(Context* context, TaskQueue& taskQueue);
+    ~BackupWriteBatcher();
+    virtual void performTask();
+
+  PRIVATE:
+    /**
+     * A group of writes that has been sent to a backup in a single rpc.
+     */
+    struct Batch {
+        Batch()
+            : writes()
+            , rpc()
+        {}
+
+        /// The writes carried by #rpc, in order. An entry is set to NULL
+        /// if the write is canceled while the rpc is outstanding.
+        std::vector<Write*> writes;
+
+        /// The outstanding rpc carrying #writes.
+        Tub<WriteSegmentBatchRpc> rpc;
+
+        DISALLOW_COPY_AND_ASSIGN(Batch);
+    };
+
+    /**
+     * Maximum number of writes carried in a single rpc.
+     */
+    enum { MAX_WRITES_PER_BATCH = 16 };
+
+    /**
+     * Writes are not added to a batch once it holds this many bytes of
+     * segment data (a single larger write is still sent on its own).
+     * Keeps a batch from monopolizing the backup for too long.
+     */
+    enum { MAX_BYTES_PER_BATCH = 1024 * 1024 };
+
+    void finishBatches();
+    void sendBatches();
+
+    /// Shared RAMCloud information.
+    Context* context;
+
+    /// Writes that haven't been sent yet, in the order they were submitted.
+    std::list<Write*> waiting;
+
+    /// Batches whose rpcs are outstanding.
+    std::list<std::unique_ptr<Batch>> outstanding;
+
+    DISALLOW_COPY_AND_ASSIGN(BackupWriteBatcher);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_BACKUPWRITEBATCHER_H
@@ -0,0 +1,165 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "BackupService.h"
+#include "BackupWriteBatcher.h"
+#include "MockCluster.h"
+#include "Segment.h"
+#include "Server.h"
+
+namespace RAMCloud {
+
+class BackupWriteBatcherTest : public ::testing::Test {
+  public:
+    Context context;
+    ServerConfig config;
+    Tub<MockCluster> cluster;
+    ServerId backupId;
+    ServerId masterId;
+    TaskQueue taskQueue;
+    BackupWriteBatcher batcher;
+    Segment segment;
+    TestLog::Enable logEnabler;
+
+    BackupWriteBatcherTest()
+        : context()
+        , config(ServerConfig::forTesting())
+        , cluster()
+        , backupId()
+        , masterId(99, 0)
+        , taskQueue()
+        , batcher(&context, taskQueue)
+        , segment()
+        , logEnabler("sendBatches")
+    {
+        Logger::get().setLogLevels(SILENT_LOG_LEVEL);
+
+        cluster.construct(&context);
+        config.services = {WireFormat::BACKUP_SERVICE};
+        config.backup.numSegmentFrames = 5;
+        Server* server = cluster->addServer(config);
+        server->backup->testingSkipCallerIdCheck = true;
+        backupId = server->serverId;
+    }
+
+    ~BackupWriteBatcherTest()
+    {
+        cluster.destroy();
+    }
+
+    // Run the batcher until it has nothing left to do.
+    void
+    runBatcher()
+    {
+        while (!taskQueue.isIdle())
+            taskQueue.performTask();
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(BackupWriteBatcherTest);
+};
+
+TEST_F(BackupWriteBatcherTest, basics) {
+    SegmentCertificate certificate;
+    BackupWriteBatcher::Write open88(batcher, backupId, masterId, 88, 0,
+            &segment, 0, 0, &certificate, true, false, true);
+    BackupWriteBatcher::Write open89(batcher, backupId, masterId, 89, 0,
+            &segment, 0, 0, &certificate, true, false, false);
+    EXPECT_FALSE(open88.isReady());
+    EXPECT_TRUE(batcher.isScheduled());
+
+    runBatcher();
+    EXPECT_EQ(format("sendBatches: Sending 2 writes (0 bytes) to backup %s",
+              backupId.toString().c_str()), TestLog::get());
+    EXPECT_TRUE(open88.isReady());
+    EXPECT_TRUE(open89.isReady());
+    EXPECT_NO_THROW(open88.wait());
+    EXPECT_NO_THROW(open89.wait());
+}
+
+TEST_F(BackupWriteBatcherTest, finishBatches_perWriteStatus) {
+    SegmentCertificate certificate;
+    BackupWriteBatcher::Write open(batcher, backupId, masterId, 88, 0,
+            &segment, 0, 0, &certificate, true, false, true);
+    BackupWriteBatcher::Write notOpen(batcher, backupId, masterId, 89, 0,
+            &segment, 0, 0, NULL, false, false, true);
+    runBatcher();
+    EXPECT_NO_THROW(open.wait());
+    EXPECT_THROW(notOpen.wait(), BackupBadSegmentIdException);
+}
+
+TEST_F(BackupWriteBatcherTest, finishBatches_rpcFailed) {
+    BackupWriteBatcher::Write write(batcher, ServerId(57, 0), masterId, 88, 0,
+            &segment, 0, 0, NULL, true, false, true);
+    runBatcher();
+    EXPECT_TRUE(write.isReady());
+    EXPECT_THROW(write.wait(), ServerNotUpException);
+}
+
+TEST_F(BackupWriteBatcherTest, sendBatches_maxWritesPerBatch) {
+    std::vector<std::unique_ptr<BackupWriteBatcher::Write>> writes;
+    for (uint64_t i = 0; i <= BackupWriteBatcher::MAX_WRITES_PER_BATCH; i++) {
+        writes.emplace_back(new BackupWriteBatcher::Write(batcher, backupId,
+                masterId, 100 + i, 0, &segment, 0, 0, NULL,
+                false, false, true));
+    }
+    runBatcher();
+    EXPECT_EQ(format("sendBatches: Sending 16 writes (0 bytes) to backup %s | "
+              "sendBatches: Sending 1 writes (0 bytes) to backup %s",
+              backupId.toString().c_str(), backupId.toString().c_str()),
+              TestLog::get());
+    foreach (auto& write, writes)
+        EXPECT_TRUE(write->isReady());
+}
+
+TEST_F(BackupWriteBatcherTest, sendBatches_separateBackups) {
+    BackupWriteBatcher::Write write1(batcher, backupId, masterId, 88, 0,
+            &segment, 0, 0, NULL, true, false, true);
+    BackupWriteBatcher::Write write2(batcher, ServerId(57, 0), masterId, 88, 0,
+            &segment, 0, 0, NULL, true, false, false);
+    BackupWriteBatcher::Write write3(batcher, backupId, masterId, 89, 0,
+            &segment, 0, 0, NULL, true, false, true);
+    runBatcher();
+    EXPECT_EQ(format("sendBatches: Sending 2 writes (0 bytes) to backup %s | "
+              "sendBatches: Sending 1 writes (0 bytes) to backup 57.0",
+              backupId.toString().c_str()), TestLog::get());
+}
+
+TEST_F(BackupWriteBatcherTest, cancel_beforeSend) {
+    BackupWriteBatcher::Write write(batcher, backupId, masterId, 88, 0,
+            &segment, 0, 0, NULL, true, false, true);
+    write.cancel();
+    EXPECT_TRUE(write.isReady());
+    EXPECT_TRUE(batcher.waiting.empty());
+    runBatcher();
+    EXPECT_EQ("", TestLog::get());
+    EXPECT_NO_THROW(write.wait());
+}
+
+TEST_F(BackupWriteBatcherTest, cancel_afterSend) {
+    BackupWriteBatcher::Write write(batcher, backupId, masterId, 88, 0,
+            &segment, 0, 0, NULL, false, false, true);
+    batcher.sendBatches();
+    ASSERT_EQ(1u, batcher.outstanding.size());
+    write.cancel();
+    EXPECT_TRUE(batcher.outstanding.front()->writes[0] == NULL);
+
+    // The failure of the (abandoned) write isn't reported.
+    runBatcher();
+    EXPECT_TRUE(batcher.outstanding.empty());
+    EXPECT_NO_THROW(write.wait());
+}
+
+}  // namespace RAMCloud
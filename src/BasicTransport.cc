@@ -459,6 +459,11 @@ BasicTransport::tryToTransmitData()
             driver->getTransmitQueueSpace(context->dispatch->currentTime)));
     uint32_t maxBytes;
 
+    // Let the driver combine all of the data packets we send below into
+    // as few transmissions as possible. Packets must be flushed before
+    // deleting an RPC, since they may still refer to its message.
+    driver->startTransmitBatch();
+
     // Each iteration of the following loop transmits data packets for
     // a single request or response.
     while (transmitQueueSpace >= maxDataPerPacket) {
@@ -556,13 +561,16 @@ BasicTransport::tryToTransmitData()
                 // this data is lost we won't be able to retransmit it (the
                 // whole RPC will be retried). However, this approach is
                 // simpler and faster in the common case where data isn't lost.
+                driver->flushTransmitBatch();
                 deleteServerRpc(serverRpc);
+                driver->startTransmitBatch();
             }
         } else {
             // There are no messages with data that can be transmitted.
             break;
         }
     }
+    driver->flushTransmitBatch();
 
     return result;
 }
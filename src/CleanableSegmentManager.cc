@@ -92,13 +92,54 @@ CleanableSegmentManager::getSegmentToCompact()
     SpinLock::Guard guard(lock);
     update(guard);
 
-    if (compactionCandidates.empty())
+    foreach (LogSegment& segment, compactionCandidates) {
+        // Compacting a cold segment would only free flash, not memory.
+        if (segment.isCold)
+            continue;
+        eraseFromAll(&segment, guard);
+        segmentsToCleaner++;
+        return &segment;
+    }
+
+    return NULL;
+}
+
+/**
+ * Choose a segment to demote to cold storage: the one in memory whose newest
+ * entry is oldest. Segments without live data are left for compaction and
+ * disk cleaning to deal with.
+ *
+ * 
+eturn
+ *      NULL if there is no such segment or there is not enough free cold
+ *      storage to hold one. Otherwise, the segment, which (like one returned
+ *      from getSegmentToCompact()) is no longer tracked here.
+ */
+LogSegment*
+CleanableSegmentManager::getSegmentToDemote()
+{
+    SegletAllocator& allocator = segmentManager.getAllocator();
+    if (allocator.getFreeCount(SegletAllocator::COLD) < segletsPerSegment)
         return NULL;
 
-    LogSegment& segment = *compactionCandidates.begin();
-    eraseFromAll(&segment, guard);
+    SpinLock::Guard guard(lock);
+    update(guard);
+
+    LogSegment* oldest = NULL;
+    foreach (LogSegment& segment, costBenefitCandidates) {
+        if (segment.isCold || segment.getLiveBytes() == 0)
+            continue;
+        if (oldest == NULL ||
+          segment.newestEntryTimestamp < oldest->newestEntryTimestamp)
+            oldest = &segment;
+    }
+
+    if (oldest == NULL)
+        return NULL;
+
+    eraseFromAll(oldest, guard);
     segmentsToCleaner++;
-    return &segment;
+    return oldest;
 }
 
 void
@@ -122,6 +163,13 @@ CleanableSegmentManager::getSegmentsToClean(LogSegmentVector& outSegsToClean)
         if (utilization > LogCleaner::MAX_CLEANABLE_MEMORY_UTILIZATION)
             continue;
 
+        // Segments in cold storage are never cleaned together with those in
+        // memory, so that the cleaner can put the survivors of each back
+        // where their data came from.
+        if (!outSegsToClean.empty() &&
+          candidate.isCold != outSegsToClean[0]->isCold)
+            continue;
+
         uint64_t liveBytes = candidate.getLiveBytes();
         if ((totalLiveBytes + liveBytes) > maximumLiveBytes)
             break;
@@ -221,6 +269,11 @@ CleanableSegmentManager::update(const SpinLock::Guard& guard)
             tombstoneScanCandidates.insert(segment);
         }
 
+        // Cold segments don't occupy memory, so they don't count toward
+        // the utilizations that decide when to clean.
+        if (segment.isCold)
+            continue;
+
         const LogEntryType objType = LOG_ENTRY_TYPE_OBJ;
         liveObjectBytes += segment.entryLengths[objType] -
                            segment.deadEntryLengths[objType];
@@ -244,6 +297,8 @@ CleanableSegmentManager::update(const SpinLock::Guard& guard)
             computeTombstoneScanScore(segment);
         insertInAll(segment, guard);
 
+        if (segment->isCold)
+            continue;
         liveObjectBytes += segment->entryLengths[LOG_ENTRY_TYPE_OBJ] -
                            segment->deadEntryLengths[LOG_ENTRY_TYPE_OBJ];
         undeadTombstoneBytes += segment->entryLengths[LOG_ENTRY_TYPE_OBJTOMB];
@@ -50,6 +50,9 @@ namespace RAMCloud {
  *   2) It chooses the best candidate segment for memory compaction.
  *   3) It chooses the best candidate segments for disk cleaning.
  *
+ * If the master has cold storage, it also chooses the segments to demote
+ * there (those holding the oldest data).
+ *
  * In order to make these operations fast, this class maintains several
  * different data structures that it updates periodically to avoid the overhead
  * needed to return perfect statistics or choose optimal candidate segments at
@@ -77,6 +80,7 @@ class CleanableSegmentManager {
     int getLiveObjectUtilization();
     int getUndeadTombstoneUtilization();
     LogSegment* getSegmentToCompact();
+    LogSegment* getSegmentToDemote();
     void getSegmentsToClean(LogSegmentVector& outSegsToClean);
 
   PRIVATE:
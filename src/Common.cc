@@ -236,9 +236,22 @@ string demangle(const char* name) {
  * best to call this at the end of initialisation (after most large allocations
  * have been made). This is also a good idea because pinning slows down mmap
  * probing in #LargeBlockOfMemory.
+ *
+ * \param onFault
+ *      If true, pages are only pinned once they are touched, rather than all
+ *      being faulted in now. This is needed if some mappings (such as a
+ *      master's cold storage) are much larger than memory and will be
+ *      unpinned again with munlock.
  */
-void pinAllMemory() {
-    int r = mlockall(MCL_CURRENT | MCL_FUTURE);
+void pinAllMemory(bool onFault) {
+// Older C libraries don't define this, but the kernel may still support it.
+#ifndef MCL_ONFAULT
+#define MCL_ONFAULT 4
+#endif
+    int flags = MCL_CURRENT | MCL_FUTURE;
+    if (onFault)
+        flags |= MCL_ONFAULT;
+    int r = mlockall(flags);
     if (r != 0) {
         LOG(WARNING, "Could not lock all memory pages (%s), so the OS might "
                      "swap memory later. Check your user's \"ulimit -l\" and "
@@ -237,7 +237,7 @@ prefetch(const T* object)
     prefetch(object, sizeof(*object));
 }
 
-void pinAllMemory();
+void pinAllMemory(bool onFault = false);
 
 /**
  * Convert the annoying unix timeval structure into a single 64-bit microsecond
@@ -592,6 +592,37 @@ CoordinatorClient::recoveryMasterFinished(Context* context, uint64_t recoveryId,
     return rpc.wait();
 }
 
+/**
+ * This method is invoked by a recovery master (if early recovery reads are
+ * enabled) once it has replayed all of the log data for its partition of a
+ * crashed master, but before it has finished the rest of recovery (such as
+ * re-replicating the data). If the coordinator agrees, it directs clients'
+ * reads for the tablets in the partition to the recovery master from then
+ * on. The recovery master must still call recoveryMasterFinished later.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param recoveryId
+ *      Identifies the recovery this master is performing a portion of.
+ * \param recoveryMasterId
+ *      ServerId of the server invoking this method.
+ * \param recoveryPartition
+ *      The tablets in the partition that were replayed, with the recovery
+ *      master's server id and service locator filled in.
+ * \return
+ *      True if the recovery master may serve reads for the tablets now;
+ *      false if it must wait until recovery finishes.
+ */
+bool
+CoordinatorClient::recoveryMasterReplayed(Context* context,
+        uint64_t recoveryId, ServerId recoveryMasterId,
+        const ProtoBuf::RecoveryPartition* recoveryPartition)
+{
+    RecoveryMasterFinishedRpc rpc(context, recoveryId, recoveryMasterId,
+            recoveryPartition, true, true);
+    return !rpc.wait();
+}
+
 /**
  * Constructor for RecoveryMasterFinishedRpc: initiates an RPC in the same
  * way as #CoordinatorClient::recoveryMasterFinished, but returns once the
@@ -612,10 +643,14 @@ CoordinatorClient::recoveryMasterFinished(Context* context, uint64_t recoveryId,
  *      in recovering its partition of the crashed master. If false the
  *      coordinator will not assign ownership to this master and this master
  *      can clean up any state resulting attempting recovery.
+ * \param replayOnly
+ *      True means this is a #CoordinatorClient::recoveryMasterReplayed
+ *      request rather than the final report of the recovery master.
  */
 RecoveryMasterFinishedRpc::RecoveryMasterFinishedRpc(Context* context,
         uint64_t recoveryId, ServerId recoveryMasterId,
-        const ProtoBuf::RecoveryPartition* recoveryPartition, bool successful)
+        const ProtoBuf::RecoveryPartition* recoveryPartition, bool successful,
+        bool replayOnly)
     : CoordinatorRpcWrapper(context,
             sizeof(WireFormat::RecoveryMasterFinished::Response))
 {
@@ -625,6 +660,7 @@ RecoveryMasterFinishedRpc::RecoveryMasterFinishedRpc(Context* context,
     reqHdr->recoveryMasterId = recoveryMasterId.getId();
     reqHdr->tabletsLength = serializeToRequest(&request, recoveryPartition);
     reqHdr->successful = successful;
+    reqHdr->replayOnly = replayOnly;
     send();
 }
 
@@ -62,6 +62,9 @@ class CoordinatorClient {
             ServerId recoveryMasterId,
             const ProtoBuf::RecoveryPartition* recoveryPartition,
             bool successful);
+    static bool recoveryMasterReplayed(Context* context, uint64_t recoveryId,
+            ServerId recoveryMasterId,
+            const ProtoBuf::RecoveryPartition* recoveryPartition);
     static WireFormat::ClientLease renewLease(Context* context,
             uint64_t leaseId);
     static void sendServerList(Context* context, ServerId destination);
@@ -204,7 +207,7 @@ class RecoveryMasterFinishedRpc : public CoordinatorRpcWrapper {
     RecoveryMasterFinishedRpc(Context* context, uint64_t recoveryId,
             ServerId recoveryMasterId,
             const ProtoBuf::RecoveryPartition* recoveryPartition,
-            bool successful);
+            bool successful, bool replayOnly = false);
     ~RecoveryMasterFinishedRpc() {}
     bool wait();
 
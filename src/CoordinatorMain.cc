@@ -54,6 +54,7 @@ main(int argc, char *argv[])
     uint32_t maxCores;
     bool reset;
     bool neverKill;
+    TabletBalancer::Config balancerConfig;
     try {
         OptionsDescription coordinatorOptions("Coordinator");
         coordinatorOptions.add_options()
@@ -65,6 +66,37 @@ main(int argc, char *argv[])
             "timeout, the slower real crashes are responded to. The shorter "
             "the timeout, the greater the chance is of falsely deciding a "
             "machine is down when it's not.")
+            ("balancerImbalance",
+             ProgramOptions::value<double>(&balancerConfig.imbalanceRatio)->
+                default_value(1.5),
+             "The tablet balancer only acts when the busiest master's load "
+             "is at least this many times the average load across masters.")
+            ("balancerInterval",
+             ProgramOptions::value<double>(&balancerConfig.intervalSeconds)->
+                default_value(0),
+             "Number of seconds between rounds of automatic tablet splitting "
+             "and migration to even out load among masters. 0 means the "
+             "tablet balancer is disabled.")
+            ("balancerMaxActions",
+             ProgramOptions::value<uint32_t>(
+                &balancerConfig.maxActionsPerRound)->default_value(1),
+             "Maximum number of tablet splits and migrations the tablet "
+             "balancer will start in each round.")
+            ("balancerMaxTablets",
+             ProgramOptions::value<uint32_t>(
+                &balancerConfig.maxTabletsPerTable)->default_value(64),
+             "The tablet balancer will not split a table into more than "
+             "this many tablets.")
+            ("balancerMinOps",
+             ProgramOptions::value<double>(&balancerConfig.minOpsPerSecond)->
+                default_value(10000),
+             "The tablet balancer does nothing unless the busiest master is "
+             "handling at least this many reads and writes per second.")
+            ("balancerPullPartitions",
+             ProgramOptions::value<uint32_t>(
+                &balancerConfig.pullPartitions)->default_value(0),
+             "If nonzero, migrations started by the tablet balancer use "
+             "pull-based transfer with this many parallel partitions.")
             ("maxCores",
             ProgramOptions::value<uint32_t>(
                 &maxCores)->default_value(4),
@@ -144,6 +176,7 @@ main(int argc, char *argv[])
                                               deadServerTimeout,
                                               false,
                                               neverKill);
+        coordinatorService.tabletBalancer.start(balancerConfig);
         AdminService adminService(&context, NULL, NULL);
         while (true) {
             context.dispatch->poll();
@@ -52,6 +52,7 @@ CoordinatorService::CoordinatorService(Context* context,
     , serverList(context)
     , tableManager(context, &updateManager)
     , leaseAuthority(context)
+    , tabletBalancer(context, &tableManager)
     , runtimeOptions()
     , recoveryManager(context, tableManager, &runtimeOptions)
     , activeVerifications()
@@ -82,6 +83,7 @@ CoordinatorService::CoordinatorService(Context* context,
 CoordinatorService::~CoordinatorService()
 {
     context->services[WireFormat::COORDINATOR_SERVICE] = NULL;
+    tabletBalancer.halt();
     recoveryManager.halt();
 }
 
@@ -594,6 +596,13 @@ CoordinatorService::recoveryMasterFinished(
                                reqHdr->tabletsLength, &recoveryPartition);
 
     ServerId serverId = ServerId(reqHdr->recoveryMasterId);
+    if (reqHdr->replayOnly) {
+        respHdr->cancelRecovery =
+            recoveryManager.recoveryMasterReplayed(reqHdr->recoveryId,
+                                                   serverId,
+                                                   recoveryPartition);
+        return;
+    }
     respHdr->cancelRecovery =
         recoveryManager.recoveryMasterFinished(reqHdr->recoveryId,
                                                serverId,
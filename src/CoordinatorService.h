@@ -34,6 +34,7 @@
 #include "RuntimeOptions.h"
 #include "Service.h"
 #include "TableManager.h"
+#include "TabletBalancer.h"
 #include "TransportManager.h"
 #include "ServerConfig.h"
 
@@ -187,6 +188,12 @@ class CoordinatorService : public Service {
      */
     ClientLeaseAuthority leaseAuthority;
 
+    /**
+     * Periodically moves and splits tablets to even out load among
+     * masters; it only runs if started explicitly (see CoordinatorMain).
+     */
+    TabletBalancer tabletBalancer;
+
   PRIVATE:
     /**
      * Contains coordinator configuration options which can be modified while
@@ -602,7 +602,11 @@ try {
         for (int i = 0; i < count; i++) {
             int fd = events[i].data.fd;
             int readyEvents = 0;
-            if (events[i].events & EPOLLIN) {
+            // Errors are reported as readability, so that handlers find
+            // out about them when they next read the file (this is also
+            // how TcpTransport learns about zero-copy completions, which
+            // are queued on the socket's error queue).
+            if (events[i].events & (EPOLLIN|EPOLLERR)) {
                 readyEvents |= READABLE;
             }
             if (events[i].events & EPOLLOUT) {
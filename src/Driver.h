@@ -389,6 +389,22 @@ class Driver {
         sendPacket(recipient, header, sizeof(T), payload, priority);
     }
 
+    /**
+     * Invoked by a transport before it sends a group of packets with
+     * sendPacket (for example, several packets of a long message). Until
+     * the matching call to flushTransmitBatch, the driver may hold packets
+     * back so that it can transmit them together more efficiently. In this
+     * case the caller must preserve the payload data and the recipient
+     * Address until flushTransmitBatch returns. Batches may not be nested.
+     */
+    virtual void startTransmitBatch() {}
+
+    /**
+     * Transmit any packets that are being held back since the last call to
+     * startTransmitBatch, and return to sending each packet immediately.
+     */
+    virtual void flushTransmitBatch() {}
+
     /**
      * Return the ServiceLocator for this Driver (which shouldn't contain
      * any transport-level information). If the Driver was not provided
@@ -124,18 +124,43 @@ enumerateBucket(uint64_t reference, void* cookie)
  *      and data. True means that the returned objects have
  *      been truncated so that the object data (normally the last
  *      field of the object) is omitted.       
+ * \param valueCompressor
+ *      If non-NULL, full objects with compressed values are returned with
+ *      their values decompressed.
  */
 static int64_t
 appendObjectsToBuffer(Log& log,
                       Buffer* buffer,
                       std::vector<Log::Reference>& references,
-                      uint32_t maxBytes, bool keysOnly)
+                      uint32_t maxBytes, bool keysOnly,
+                      ValueCompressor* valueCompressor)
 {
     for (uint32_t index = 0; index < references.size(); index++) {
         Buffer objectBuffer;
         log.getEntry(references[index], objectBuffer);
 
         Object object(objectBuffer);
+        if (!keysOnly && valueCompressor != NULL &&
+                object.isValueCompressed()) {
+            Buffer keysAndValue;
+            if (valueCompressor->decompress(object, &keysAndValue, false)
+                    == STATUS_OK) {
+                Object uncompressed(object.getTableId(), object.getVersion(),
+                                    object.getTimestamp(), keysAndValue);
+                uncompressed.setCompactHeader(true);
+                Buffer uncompressedBuffer;
+                uncompressed.assembleForLog(uncompressedBuffer);
+                uint32_t length = uncompressedBuffer.size();
+                if (buffer->size() + sizeof(length) + length > maxBytes) {
+                    return index;
+                }
+                buffer->emplaceAppend<uint32_t>(length);
+                buffer->appendCopy(uncompressedBuffer.getRange(0, length),
+                                   length);
+                continue;
+            }
+        }
+
         uint32_t length = objectBuffer.size();
         if (keysOnly) {
             uint32_t dataLength = object.getValueLength();
@@ -234,6 +259,9 @@ class ObjectHashComparator {
  *      A Buffer to hold the resulting objects.
  * \param maxPayloadBytes
  *      The maximum number of bytes of objects to be returned.
+ * \param valueCompressor
+ *      Used to decompress values before returning them. May be NULL if
+ *      values are never compressed.
  */
 Enumeration::Enumeration(uint64_t tableId,
                          bool keysOnly,
@@ -244,7 +272,8 @@ Enumeration::Enumeration(uint64_t tableId,
                          EnumerationIterator& iter,
                          Log& log,
                          HashTable& objectMap,
-                         Buffer& payload, uint32_t maxPayloadBytes)
+                         Buffer& payload, uint32_t maxPayloadBytes,
+                         ValueCompressor* valueCompressor)
     : tableId(tableId)
     , keysOnly(keysOnly)
     , requestedTabletStartHash(requestedTabletStartHash)
@@ -256,6 +285,7 @@ Enumeration::Enumeration(uint64_t tableId,
     , objectMap(objectMap)
     , payload(payload)
     , maxPayloadBytes(maxPayloadBytes)
+    , valueCompressor(valueCompressor)
 {
 }
 
@@ -300,7 +330,8 @@ Enumeration::complete()
         bucketStart = payload.size();
         objectMap.forEachInBucket(enumerateBucket, cookie, bucketIndex);
         int64_t overflow = appendObjectsToBuffer(log, &payload, objectRefs,
-                                                 maxPayloadBytes, keysOnly);
+                                                 maxPayloadBytes, keysOnly,
+                                                 valueCompressor);
         payloadFull = overflow >= 0;
         if (payloadFull) {
             break;
@@ -320,7 +351,8 @@ Enumeration::complete()
             std::sort(objectRefs.begin(), objectRefs.end(), comparator);
 
             int64_t overflow = appendObjectsToBuffer(log, &payload, objectRefs,
-                                                     maxPayloadBytes, keysOnly);
+                                                     maxPayloadBytes, keysOnly,
+                                                     valueCompressor);
             if (overflow >= 0) {
                 LogEntryType type;
                 Buffer buffer;
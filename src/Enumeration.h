@@ -20,6 +20,7 @@
 #include "EnumerationIterator.h"
 #include "HashTable.h"
 #include "Log.h"
+#include "ValueCompressor.h"
 
 namespace RAMCloud {
 
@@ -45,7 +46,8 @@ class Enumeration {
                 EnumerationIterator& iter,
                 Log& log,
                 HashTable& objectMap,
-                Buffer& payload, uint32_t maxPayloadBytes);
+                Buffer& payload, uint32_t maxPayloadBytes,
+                ValueCompressor* valueCompressor = NULL);
     void complete();
 
   PRIVATE:
@@ -84,6 +86,10 @@ class Enumeration {
 
     /// The maximum number of bytes of objects to be returned.
     uint32_t maxPayloadBytes;
+
+    /// Used to decompress values before returning them; NULL if values
+    /// are never compressed.
+    ValueCompressor* valueCompressor;
 };
 
 }
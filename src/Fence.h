@@ -39,6 +39,19 @@ class Fence {
         __asm__ __volatile__("lfence" ::: "memory");
     }
 
+    /**
+     * This method keeps the compiler from moving memory accesses across it,
+     * but emits no instruction. x86 CPUs never reorder a load with earlier
+     * loads, so this is enough to order a series of reads (such as a
+     * sequence number check followed by the data it protects) and is much
+     * cheaper than lfence, which also waits for earlier instructions to
+     * finish.
+     */
+    static void inline compilerBarrier()
+    {
+        __asm__ __volatile__("" ::: "memory");
+    }
+
     /**
      * This method creates a boundary across which store instructions cannot
      * migrate: if a memory store comes from code occurring before (after)
@@ -14,6 +14,7 @@
  */
 
 #include "Common.h"
+#include "Fence.h"
 #include "HashTable.h"
 
 namespace RAMCloud {
@@ -116,6 +117,19 @@ HashTable::Entry::hashMatches(uint64_t hash) const
     return (!ue.chain && ue.ptr != 0 && ue.hash == hash);
 }
 
+/**
+ * Return a copy of this hash table entry, read with a single load. The
+ * copy's fields are consistent with one another even if another thread is
+ * changing this entry concurrently.
+ */
+HashTable::Entry
+HashTable::Entry::snapshot() const
+{
+    Entry entry;
+    entry.value = *reinterpret_cast<const volatile uint64_t*>(&value);
+    return entry;
+}
+
 /**
  * Replace this hash table entry.
  * \param[in] hash
@@ -154,6 +168,7 @@ HashTable::Entry::pack(uint64_t hash, bool chain, uint64_t ptr)
 HashTable::Candidates::Candidates()
     : bucket(NULL)
     , index()
+    , reference(0)
     , secondaryHash()
 {
 }
@@ -181,7 +196,7 @@ HashTable::Candidates::getReference()
 {
     if (bucket == NULL)
         return 0;
-    return bucket->entries[index].getReference();
+    return reference;
 }
 
 /**
@@ -191,8 +206,10 @@ HashTable::Candidates::getReference()
 void
 HashTable::Candidates::setReference(uint64_t reference)
 {
-    if (bucket != NULL)
+    if (bucket != NULL) {
         bucket->entries[index].setReference(secondaryHash, reference);
+        this->reference = reference;
+    }
 }
 
 /**
@@ -226,17 +243,19 @@ HashTable::Candidates::next()
 
         // Resume in the current cache line.
         index++;
-        Entry* candidate = &bucket->entries[index];
         while (index < ENTRIES_PER_CACHE_LINE) {
-            if (candidate->hashMatches(secondaryHash)) {
+            // Read the entry just once, so that a concurrent writer can't
+            // change it between matching the hash and taking the reference.
+            Entry candidate = bucket->entries[index].snapshot();
+            if (candidate.hashMatches(secondaryHash)) {
                 // The hash within the hash table entry matches, so with
                 // high probability this is the pointer we're looking
                 // for. We'll report this index to the user of this
                 // class in the next getReference() call so that they
                 // can verify the match.
+                reference = candidate.getReference();
                 return;
             }
-            candidate++;
             index++;
         }
     }
@@ -257,12 +276,16 @@ HashTable::Candidates::isDone()
  * \param[in] numBuckets
  *      The number of buckets in the new hash table. This should be a power
  *      of two.
+ * \param[in] hugePages
+ *      If true, back the buckets with huge pages (see LargeBlockOfMemory).
+ *      Lookups touch a random bucket each, so with small pages nearly every
+ *      one misses in the TLB.
  * \throw Exception
  *      An exception is thrown if numBuckets is 0.
  */
-HashTable::HashTable(uint64_t numBuckets)
+HashTable::HashTable(uint64_t numBuckets, bool hugePages)
     : numBuckets(BitOps::powerOfTwoLessOrEqual(numBuckets))
-    , buckets(this->numBuckets * sizeof(CacheLine))
+    , buckets(this->numBuckets * sizeof(CacheLine), hugePages)
 {
     if (numBuckets != this->numBuckets) {
         RAMCLOUD_LOG(DEBUG,
@@ -367,6 +390,10 @@ HashTable::insert(KeyHash keyHash, uint64_t reference)
             bucket->entries[0] = *last;
             for (size_t i = 1; i < ENTRIES_PER_CACHE_LINE; i++)
                 bucket->entries[i].clear();
+
+            // Lock-free readers may follow the chain pointer as soon as it
+            // is set, so the new cache line must be initialized first.
+            Fence::sfence();
             last->setChainPointer(bucket);
         }
     }
@@ -469,6 +496,15 @@ HashTable::getNumBuckets() const
     return numBuckets;
 }
 
+/**
+ * Returns the size in bytes of the pages backing the buckets.
+ */
+size_t
+HashTable::getPageSize() const
+{
+    return buckets.pageSize;
+}
+
 /**
  * Find the bucket index corresponding to a particular key.
  * This also calculates the secondary hash bits used to disambiguate entries
@@ -85,6 +85,7 @@ class HashTable {
         uint64_t getReference() const;
         CacheLine* getChainPointer() const;
         bool hashMatches(uint64_t hash) const;
+        Entry snapshot() const;
 
       PRIVATE:
         /**
@@ -208,6 +209,12 @@ class HashTable {
         /// Index into bucket we're currently iterating over.
         uint32_t index;
 
+        /// The reference in the entry at #index, as read when the iterator
+        /// stopped there. Readers that don't hold the bucket lock (see
+        /// ObjectManager::readObject) rely on this being the very value that
+        /// matched #secondaryHash, even if the entry has changed since.
+        uint64_t reference;
+
         /// This iterator only returns references to entries that share this
         /// secondaryHash. All others cannot possibly be matches. This helps
         /// to reduce the number of candidates whose keys are extracted from
@@ -217,7 +224,7 @@ class HashTable {
         friend class HashTable;
     };
 
-    explicit HashTable(uint64_t numBuckets);
+    explicit HashTable(uint64_t numBuckets, bool hugePages = false);
     ~HashTable();
     void lookup(KeyHash keyHash, Candidates& candidates);
     void insert(KeyHash keyHash, uint64_t reference);
@@ -229,6 +236,7 @@ class HashTable {
     static uint32_t bytesPerCacheLine();
     static uint32_t entriesPerCacheLine();
     uint64_t getNumBuckets() const;
+    size_t getPageSize() const;
     static uint64_t findBucketIndex(uint64_t numBuckets,
                                     KeyHash keyHash,
                                     uint64_t *secondaryHash);
@@ -503,9 +503,31 @@ TEST_F(HashTableTest, constructor_truncate) {
     EXPECT_EQ(8UL, HashTable(8).numBuckets);
 }
 
+TEST_F(HashTableTest, constructor_hugePages) {
+    // No hugetlb pages and transparent huge pages disabled: base pages.
+    LargeBlockOfMemoryInternal::mockHugePages = -1;
+    HashTable small(1024, true);
+    EXPECT_EQ(static_cast<size_t>(sysconf(_SC_PAGESIZE)),
+              small.getPageSize());
+
+    LargeBlockOfMemoryInternal::mockHugePages = 1;
+    HashTable ht(1024, true);
+    LargeBlockOfMemoryInternal::mockHugePages = 0;
+    EXPECT_EQ(2UL * 1024 * 1024, ht.getPageSize());
+    for (uint32_t i = 0; i < 1024; i++) {
+        for (uint32_t j = 0; j < ht.entriesPerCacheLine(); j++)
+            EXPECT_TRUE(ht.buckets.get()[i].entries[j].isAvailable());
+    }
+}
+
 TEST_F(HashTableTest, destructor) {
 }
 
+TEST_F(HashTableTest, getPageSize) {
+    HashTable ht(16);
+    EXPECT_EQ(static_cast<size_t>(sysconf(_SC_PAGESIZE)), ht.getPageSize());
+}
+
 TEST_F(HashTableTest, simple) {
     HashTable ht(1024);
 
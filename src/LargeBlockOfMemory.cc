@@ -40,6 +40,33 @@ namespace LargeBlockOfMemoryInternal {
 #else
     uint64_t nextProbeBase = (uint64_t)1 << 30;
 #endif
+
+#ifdef TESTING
+    int mockHugePages = 0;
+#endif
+
+/**
+ * Return true if the kernel backs memory advised with MADV_HUGEPAGE with
+ * transparent huge pages: that is, if they are set to "always" or
+ * "madvise" in /sys/kernel/mm/transparent_hugepage/enabled rather than
+ * "never" (or aren't supported at all).
+ */
+bool
+transparentHugePagesEnabled()
+{
+#ifdef TESTING
+    if (mockHugePages != 0)
+        return mockHugePages > 0;
+#endif
+    FILE* f = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+    if (f == NULL)
+        return false;
+    char line[100];
+    bool enabled = (fgets(line, sizeof(line), f) != NULL) &&
+            (strstr(line, "[never]") == NULL);
+    fclose(f);
+    return enabled;
+}
 }
 
 }
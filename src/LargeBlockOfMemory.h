@@ -19,6 +19,7 @@
 #include <limits.h>
 #include <sys/file.h>
 #include <sys/mman.h>
+#include <linux/mman.h>
 #include <boost/type_traits.hpp>
 #include <boost/utility/enable_if.hpp>
 #include "Common.h"
@@ -34,8 +35,22 @@ namespace RAMCloud {
  */
 namespace LargeBlockOfMemoryInternal {
     extern uint64_t nextProbeBase;
+    bool transparentHugePagesEnabled();
+#ifdef TESTING
+    /// If nonzero, huge page mode skips the hugetlb pool as if it were
+    /// empty, and transparentHugePagesEnabled() returns whether this is
+    /// positive. Used in unit tests.
+    extern int mockHugePages;
+#endif
 }
 
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
 /**
  * A wrapper for a large block of memory. Returned memory is guaranteed to be
  * at least one gigabyte aligned (at least the first 30 address bits will be 0).
@@ -49,13 +64,33 @@ struct LargeBlockOfMemory {
      * and zeros them. The memory is aligned to a gigabyte boundary.
      * \param length
      *      The number of bytes of memory to allocate.
+     * \param hugePages
+     *      If true, try to back the memory with huge pages without needing
+     *      a hugetlbfs mount: first 1 GB pages from the kernel's hugetlb
+     *      pool (MAP_HUGETLB), then 2 MB ones, and if neither pool has room,
+     *      ordinary pages that the kernel is advised to merge into
+     *      transparent huge pages (MADV_HUGEPAGE). #pageSize records which
+     *      was obtained.
+     * \param populate
+     *      If false, the pages are neither pinned nor faulted in until
+     *      populate() is called. This lets the caller set a memory policy
+     *      for the block (with mbind) before any of it is allocated.
      * \throw FatalError
      *      If the memory could not be allocated.
      */
-    explicit LargeBlockOfMemory(size_t length)
+    explicit LargeBlockOfMemory(size_t length, bool hugePages = false,
+                                bool populate = true)
         : length(length)
-        , block(static_cast<T*>(mmapGigabyteAligned(length, MAP_ANONYMOUS)))
+        , mappedLength(length)
+        , pageSize(sysconf(_SC_PAGESIZE))
+        , block(static_cast<T*>(MAP_FAILED))
     {
+        if (hugePages && length > 0) {
+            block = static_cast<T*>(mmapHuge(length, populate));
+        } else {
+            block = static_cast<T*>(mmapGigabyteAligned(length,
+                    MAP_SHARED | MAP_ANONYMOUS, -1, 0, false, populate));
+        }
         if (block == MAP_FAILED) {
             if (length == 0)
                 return;
@@ -74,13 +109,19 @@ struct LargeBlockOfMemory {
      *      exist.
      * \param length
      *      The number of bytes of memory to allocate.
+     * \param populate
+     *      If false, the pages are neither pinned nor faulted in: they are
+     *      read from and written back to the file on demand. SegletAllocator
+     *      uses this to map files on flash that are larger than memory.
      * \throw FatalError
      *      If the memory could not be allocated, i.e. if the file already
      *      existed, could not be created, could not be truncated, or could
      *      not be mmapped.
      */
-    LargeBlockOfMemory(string filePath, size_t length)
+    LargeBlockOfMemory(string filePath, size_t length, bool populate = true)
         : length(length),
+          mappedLength(length),
+          pageSize(sysconf(_SC_PAGESIZE)),
           block(NULL)
     {
         const char* path = filePath.c_str();
@@ -105,7 +146,9 @@ struct LargeBlockOfMemory {
                 errno);
         }
 
-        block = reinterpret_cast<T*>(mmapGigabyteAligned(length, 0, fd));
+        block = reinterpret_cast<T*>(mmapGigabyteAligned(length, MAP_SHARED,
+                                                         fd, 0, false,
+                                                         populate));
         if (reinterpret_cast<void*>(block) == MAP_FAILED) {
             unlink(path);
             close(fd);
@@ -123,24 +166,44 @@ struct LargeBlockOfMemory {
                      "Mmapped %lu-byte region from [%s] at %p\n",
                      length, path, reinterpret_cast<void*>(block));
 
+        if (!populate)
+            return;
+
         // Fault in each mapping.
-        uint64_t pageSize = sysconf(_SC_PAGESIZE);
-        for (uint64_t i = 0; i < length; i += pageSize)
+        uint64_t step = sysconf(_SC_PAGESIZE);
+        for (uint64_t i = 0; i < length; i += step)
             reinterpret_cast<uint8_t*>(block)[i] = 0;
     }
 
     ~LargeBlockOfMemory()
     {
-        if (block != NULL && munmap(block, length) != 0)
+        if (block != NULL && block != MAP_FAILED &&
+                munmap(block, mappedLength) != 0)
             RAMCLOUD_LOG(WARNING, "munmap of large block failed with %d",
                          errno);
     }
 
     void swap(LargeBlockOfMemory<T>& other) {
         std::swap(this->length, other.length);
+        std::swap(this->mappedLength, other.mappedLength);
+        std::swap(this->pageSize, other.pageSize);
         std::swap(this->block, other.block);
     }
 
+    /**
+     * Pin and fault in all of the pages of a block that was constructed
+     * without populating it.
+     *
+     * \throw FatalError
+     *      If the pages could not be pinned.
+     */
+    void
+    populate()
+    {
+        if (!populatePages(block, mappedLength, 0))
+            throw FatalError(HERE, "Couldn't pin down the memory!");
+    }
+
     /// Returns #block.
     T* operator*() { return block; }
     /// Returns #block.
@@ -151,6 +214,20 @@ struct LargeBlockOfMemory {
     /// The number of bytes valid starting at #block.
     size_t length;
 
+    /// The number of bytes actually mapped starting at #block: #length
+    /// rounded up to a multiple of #pageSize.
+    size_t mappedLength;
+
+    /// Size in bytes of the pages backing #block. For memory that was
+    /// advised to use transparent huge pages, this is the size of those
+    /// pages (2 MB) only if the advice was accepted and the kernel has them
+    /// enabled; even then, the kernel may not have backed all of it with
+    /// them. Otherwise it is the base page size.
+    size_t pageSize;
+
+    /// Size of the transparent huge pages the kernel uses on x86-64.
+    static const size_t TRANSPARENT_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
     /// Just for convenience.
     static const uint64_t GIGABYTE = (uint64_t)1 << 30;
 
@@ -161,6 +238,63 @@ struct LargeBlockOfMemory {
     T* block;
 
   private:
+    /**
+     * Allocate memory for the constructor's huge page mode, trying each
+     * kind of huge page in turn (see the constructor). 1 GB pages are only
+     * tried for regions that are a whole number of gigabytes, so smaller
+     * regions (such as most hash tables) never reserve mostly unused
+     * gigabyte pages. Sets #mappedLength and #pageSize to match what was
+     * obtained.
+     *
+     * \param length
+     *      Length of the memory area to be mapped in bytes.
+     * \param populate
+     *      If false, leave the pages to be faulted in on demand.
+     * \return
+     *      The gigabyte-aligned memory, or MAP_FAILED.
+     */
+    void*
+    mmapHuge(size_t length, bool populate)
+    {
+        static const size_t hugePageSizes[] = { GIGABYTE, 2 * 1024 * 1024 };
+        static const int hugePageFlags[] = { MAP_HUGE_1GB, MAP_HUGE_2MB };
+        int first = (length >= GIGABYTE && length % GIGABYTE == 0) ? 0 : 1;
+#ifdef TESTING
+        if (LargeBlockOfMemoryInternal::mockHugePages != 0)
+            first = 2;
+#endif
+        for (int i = first; i < 2; i++) {
+            size_t rounded = (length + hugePageSizes[i] - 1) &
+                    ~(hugePageSizes[i] - 1);
+            void* base = mmapGigabyteAligned(rounded,
+                    MAP_SHARED | MAP_ANONYMOUS | MAP_HUGETLB |
+                    hugePageFlags[i], -1, hugePageSizes[i], false, populate);
+            if (base != MAP_FAILED) {
+                mappedLength = rounded;
+                pageSize = hugePageSizes[i];
+                RAMCLOUD_LOG(NOTICE, "Backed %lu-byte region at %p with "
+                             "%lu-byte huge pages", length, base, pageSize);
+                return base;
+            }
+        }
+
+        // Transparent huge pages only apply to private anonymous memory.
+        void* base = mmapGigabyteAligned(length, MAP_PRIVATE | MAP_ANONYMOUS,
+                                         -1, 0, true, populate);
+        if (base == MAP_FAILED)
+            return base;
+        if (pageSize == TRANSPARENT_HUGE_PAGE_SIZE) {
+            RAMCLOUD_LOG(NOTICE, "No hugetlb pages available for %lu-byte "
+                         "region at %p; using transparent huge pages",
+                         length, base);
+        } else {
+            RAMCLOUD_LOG(WARNING, "No hugetlb or transparent huge pages "
+                         "available for %lu-byte region at %p; using "
+                         "%lu-byte pages", length, base, pageSize);
+        }
+        return base;
+    }
+
     /**
      * Mmap the desired amount of space with gigabyte alignment (lower 30
      * bits of the address are 0). Also, ensure that all mappings are faulted
@@ -174,13 +308,25 @@ struct LargeBlockOfMemory {
      *
      * \param[in] length
      *      Length of the memory area to be mapped in bytes.
-     * \param[in] extraFlags
-     *      Extra flags to be passed to mmap(2).
+     * \param[in] flags
+     *      Flags to be passed to mmap(2).
      * \param[in] fd
      *      Optional file descriptor (if mmaping a file, for instance).
+     * \param[in] hugePageSize
+     *      Nonzero means \a flags include MAP_HUGETLB for pages of this
+     *      size. If mmap fails the hugetlb pool is exhausted, so give up
+     *      rather than probing further.
+     * \param[in] adviseHugePages
+     *      If true, advise the kernel to back the memory with transparent
+     *      huge pages before faulting it in. #pageSize is set to their size
+     *      if the kernel accepts the advice and has them enabled.
+     * \param[in] populate
+     *      If false, leave the pages to be faulted in on demand.
      */
     void*
-    mmapGigabyteAligned(size_t length, int extraFlags, int fd = -1)
+    mmapGigabyteAligned(size_t length, int flags, int fd = -1,
+                        size_t hugePageSize = 0, bool adviseHugePages = false,
+                        bool populate = true)
     {
         const int maxTries = 10000;
         int i;
@@ -190,13 +336,16 @@ struct LargeBlockOfMemory {
             void *base = mmap(reinterpret_cast<void*>(tryBase),
                               length,
                               PROT_READ | PROT_WRITE,
-                              MAP_SHARED | extraFlags,
+                              flags,
                               fd,
                               0);
 
             if (base == reinterpret_cast<void*>(tryBase))
                 break;
 
+            if (base == MAP_FAILED && hugePageSize != 0)
+                return MAP_FAILED;
+
             if (base != MAP_FAILED) {
                 if (munmap(base, length)) {
                     RAMCLOUD_LOG(ERROR, "couldn't munmap undesirable mapping!");
@@ -214,6 +363,46 @@ struct LargeBlockOfMemory {
 
         void* block = reinterpret_cast<void*>(tryBase);
 
+        if (adviseHugePages) {
+            if (madvise(block, length, MADV_HUGEPAGE) != 0) {
+                RAMCLOUD_LOG(WARNING, "madvise(MADV_HUGEPAGE) failed: %s",
+                             strerror(errno));
+            } else if (LargeBlockOfMemoryInternal::
+                    transparentHugePagesEnabled()) {
+                pageSize = TRANSPARENT_HUGE_PAGE_SIZE;
+            }
+        }
+
+        // Cache last mapped address to avoid re-probing same addresses later.
+        LargeBlockOfMemoryInternal::nextProbeBase =
+            (tryBase + length + GIGABYTE - 1) & ~(GIGABYTE - 1);
+
+        if (!populate)
+            return block;
+        if (!populatePages(block, length, hugePageSize)) {
+            munmap(block, length);
+            return MAP_FAILED;
+        }
+
+        return block;
+    }
+
+    /**
+     * Pin (if MLOCK_PAGES is defined) and fault in a range of memory.
+     *
+     * \param block
+     *      Start of the range.
+     * \param length
+     *      Length of the range in bytes.
+     * \param hugePageSize
+     *      Nonzero means the range is backed by hugetlb pages of this size,
+     *      so only one byte per huge page needs to be touched.
+     * \return
+     *      False if the pages could not be pinned, otherwise true.
+     */
+    static bool
+    populatePages(void* block, size_t length, size_t hugePageSize)
+    {
         // Do not pin and fault in pages if we're testing, since that just
         // slows things down considerably (we usually don't touch anywhere near
         // all of the memory we allocate).
@@ -224,17 +413,18 @@ struct LargeBlockOfMemory {
         // pages before it knows that it can actually give us the entire
         // range?).
         if (mlock(block, length)) {
-            munmap(block, length);
             RAMCLOUD_LOG(ERROR, "Couldn't pin down the memory!");
-            return MAP_FAILED;
+            return false;
         }
 #endif
 
         // Force the OS to populate backing pages.  MAP_POPULATE doesn't seem
         // to do the trick and using it makes polling mmap for aligned base
         // addresses much slower.
-        uint64_t pageSize = sysconf(_SC_PAGESIZE);
-        for (uint64_t i = 0; i < length; i += pageSize) {
+        uint64_t step = hugePageSize;
+        if (step == 0)
+            step = sysconf(_SC_PAGESIZE);
+        for (uint64_t i = 0; i < length; i += step) {
             reinterpret_cast<uint8_t*>(block)[i] = 0;
             if (!(i & ((1 << 30) - 1))) {
                 RAMCLOUD_LOG(NOTICE, "Populating pages; progress %lu of %lu MB",
@@ -243,11 +433,7 @@ struct LargeBlockOfMemory {
         }
 #endif // !TESTING
 
-        // Cache last mapped address to avoid re-probing same addresses later.
-        LargeBlockOfMemoryInternal::nextProbeBase =
-            (tryBase + length + GIGABYTE - 1) & ~(GIGABYTE - 1);
-
-        return block;
+        return true;
     }
 
     DISALLOW_COPY_AND_ASSIGN(LargeBlockOfMemory);
@@ -0,0 +1,177 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_LATENCYHISTOGRAM_H
+#define RAMCLOUD_LATENCYHISTOGRAM_H
+
+#include "Common.h"
+
+namespace RAMCloud {
+
+/**
+ * A fixed-size histogram of latencies, measured in nanoseconds, with
+ * log-linear buckets: each power of two is split into SUB_BUCKETS buckets
+ * of equal width, so a sample is known to within 1/SUB_BUCKETS of its value
+ * whether it's 100ns or 10s. Unlike Histogram, the bucket layout is the
+ * same for every instance, so histograms can be combined by adding their
+ * counts bucket by bucket.
+ *
+ * This is what lets each thread keep its own histograms (see
+ * PerfStats::recordServiceTime): only the owning thread calls record, and
+ * other threads may add the counts to their own histograms at any time
+ * without locking. Such a reader may see a sample in #counts but not yet in
+ * #totalNanoseconds (or vice versa), which is fine for statistics.
+ */
+class LatencyHistogram {
+  public:
+    /// Each power of two is divided into 2^SUB_BUCKET_BITS buckets.
+    static const uint32_t SUB_BUCKET_BITS = 4;
+    static const uint32_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+
+    /// Enough buckets to distinguish latencies up to 2^36ns (about 68
+    /// seconds); anything longer is counted in the last bucket.
+    static const uint32_t NUM_BUCKETS = (36 - SUB_BUCKET_BITS + 1) *
+            SUB_BUCKETS;
+
+    LatencyHistogram()
+        : counts()
+        , totalNanoseconds(0)
+    {
+    }
+
+    /**
+     * Record one sample.
+     *
+     * \param nanoseconds
+     *      The latency to record.
+     */
+    void
+    record(uint64_t nanoseconds)
+    {
+        counts[bucketIndex(nanoseconds)]++;
+        totalNanoseconds += nanoseconds;
+    }
+
+    /**
+     * Add all of the samples in another histogram to this one.
+     */
+    void
+    add(const LatencyHistogram& other)
+    {
+        for (uint32_t i = 0; i < NUM_BUCKETS; i++) {
+            counts[i] += other.counts[i];
+        }
+        totalNanoseconds += other.totalNanoseconds;
+    }
+
+    /**
+     * Remove the samples in an earlier reading of this histogram from this
+     * one, leaving only the samples recorded since then.
+     */
+    void
+    subtract(const LatencyHistogram& earlier)
+    {
+        for (uint32_t i = 0; i < NUM_BUCKETS; i++) {
+            counts[i] -= earlier.counts[i];
+        }
+        totalNanoseconds -= earlier.totalNanoseconds;
+    }
+
+    /**
+     * Return the total number of samples recorded.
+     */
+    uint64_t
+    getCount() const
+    {
+        uint64_t count = 0;
+        for (uint32_t i = 0; i < NUM_BUCKETS; i++) {
+            count += counts[i];
+        }
+        return count;
+    }
+
+    /**
+     * Return (an upper bound on) the latency below which a given fraction
+     * of the samples fall, or 0 if there are no samples.
+     *
+     * \param fraction
+     *      Between 0 and 1: 0.5 gives the median, 0.99 the 99th percentile.
+     */
+    uint64_t
+    getPercentile(double fraction) const
+    {
+        uint64_t count = getCount();
+        if (count == 0) {
+            return 0;
+        }
+        uint64_t rank = static_cast<uint64_t>(fraction *
+                static_cast<double>(count) + 0.5);
+        if (rank < 1) {
+            rank = 1;
+        }
+        uint64_t seen = 0;
+        uint32_t i = 0;
+        for (; i < NUM_BUCKETS - 1; i++) {
+            seen += counts[i];
+            if (seen >= rank) {
+                break;
+            }
+        }
+        return bucketLowerBound(i + 1) - 1;
+    }
+
+    /**
+     * Return the index of the bucket that counts a given latency.
+     */
+    static uint32_t
+    bucketIndex(uint64_t nanoseconds)
+    {
+        if (nanoseconds < SUB_BUCKETS) {
+            return downCast<uint32_t>(nanoseconds);
+        }
+        uint32_t msb = 63 - __builtin_clzll(nanoseconds);
+        uint32_t index = (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKETS +
+                downCast<uint32_t>((nanoseconds >> (msb - SUB_BUCKET_BITS)) &
+                (SUB_BUCKETS - 1));
+        if (index >= NUM_BUCKETS) {
+            return NUM_BUCKETS - 1;
+        }
+        return index;
+    }
+
+    /**
+     * Return the smallest latency counted in a given bucket.
+     */
+    static uint64_t
+    bucketLowerBound(uint32_t index)
+    {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+        uint32_t shift = index / SUB_BUCKETS - 1;
+        return static_cast<uint64_t>(SUB_BUCKETS + index % SUB_BUCKETS) <<
+                shift;
+    }
+
+    /// Number of samples in each bucket.
+    uint64_t counts[NUM_BUCKETS];
+
+    /// Sum of all the samples, for computing the mean.
+    uint64_t totalNanoseconds;
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_LATENCYHISTOGRAM_H
@@ -0,0 +1,80 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "LatencyHistogram.h"
+
+namespace RAMCloud {
+
+TEST(LatencyHistogramTest, bucketIndex) {
+    EXPECT_EQ(0U, LatencyHistogram::bucketIndex(0));
+    EXPECT_EQ(15U, LatencyHistogram::bucketIndex(15));
+    EXPECT_EQ(16U, LatencyHistogram::bucketIndex(16));
+    EXPECT_EQ(31U, LatencyHistogram::bucketIndex(31));
+    EXPECT_EQ(32U, LatencyHistogram::bucketIndex(32));
+    EXPECT_EQ(32U, LatencyHistogram::bucketIndex(33));
+    EXPECT_EQ(33U, LatencyHistogram::bucketIndex(34));
+    EXPECT_EQ(LatencyHistogram::NUM_BUCKETS - 1,
+              LatencyHistogram::bucketIndex(~0UL));
+
+    // Every value falls between its bucket's bounds.
+    for (uint64_t value = 1; value < (1UL << 36); value = value * 3 + 1) {
+        uint32_t index = LatencyHistogram::bucketIndex(value);
+        EXPECT_LE(LatencyHistogram::bucketLowerBound(index), value);
+        EXPECT_GT(LatencyHistogram::bucketLowerBound(index + 1), value);
+    }
+}
+
+TEST(LatencyHistogramTest, bucketLowerBound) {
+    EXPECT_EQ(7U, LatencyHistogram::bucketLowerBound(7));
+    EXPECT_EQ(16U, LatencyHistogram::bucketLowerBound(16));
+    EXPECT_EQ(34U, LatencyHistogram::bucketLowerBound(33));
+    EXPECT_EQ(1UL << 36, LatencyHistogram::bucketLowerBound(
+            LatencyHistogram::NUM_BUCKETS));
+}
+
+TEST(LatencyHistogramTest, addAndSubtract) {
+    LatencyHistogram a, b;
+    a.record(10);
+    a.record(1000);
+    b.record(1000);
+    a.add(b);
+    EXPECT_EQ(3U, a.getCount());
+    EXPECT_EQ(2U, a.counts[LatencyHistogram::bucketIndex(1000)]);
+    EXPECT_EQ(2010U, a.totalNanoseconds);
+
+    a.subtract(b);
+    EXPECT_EQ(2U, a.getCount());
+    EXPECT_EQ(1010U, a.totalNanoseconds);
+}
+
+TEST(LatencyHistogramTest, getPercentile) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0U, histogram.getPercentile(0.5));
+    for (int i = 0; i < 99; i++) {
+        histogram.record(5);
+    }
+    histogram.record(100000);
+    EXPECT_EQ(5U, histogram.getPercentile(0.0));
+    EXPECT_EQ(5U, histogram.getPercentile(0.5));
+    EXPECT_EQ(5U, histogram.getPercentile(0.99));
+
+    // Reported as the top of the sample's bucket.
+    uint64_t p999 = histogram.getPercentile(0.999);
+    EXPECT_LE(100000U, p999);
+    EXPECT_GT(100000U * 17 / 16, p999);
+}
+
+}  // namespace RAMCloud
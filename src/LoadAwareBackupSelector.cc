@@ -0,0 +1,176 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "Cycles.h"
+#include "LoadAwareBackupSelector.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+// --- LoadAwareBackupSelector ---
+
+/**
+ * Constructor.
+ * \param context
+ *      Overall information about this RAMCloud server; used to register
+ *      #tracker with this server's ServerList and to ask backups for their
+ *      load.
+ * \param serverId
+ *      The ServerId of the backup. Used for selecting appropriate primary
+ *      and secondary replicas.
+ * \param numReplicas
+ *      The replication factor of each segment.
+ * \param allowLocalBackup
+ *      Specifies whether to allow replication to the local backup.
+ */
+LoadAwareBackupSelector::LoadAwareBackupSelector(Context* context,
+    const ServerId* serverId, uint32_t numReplicas, bool allowLocalBackup)
+    : BackupSelector(context, serverId, numReplicas, allowLocalBackup)
+    , context(context)
+{
+}
+
+/**
+ * From a few random backups that do not conflict with an existing set of
+ * backups choose the one that minimizes the sum of its expected time to
+ * read this master's replicas during recovery and the time to drain the
+ * writes already outstanding to it. The ServerId returned is !isValid() if
+ * there are no machines to choose from.
+ * \param numBackups
+ *      The number of entries in the \a backupIds array.
+ * \param backupIds
+ *      An array of numBackups backup ids, none of which may conflict with the
+ *      returned backup. All existing replica locations should be listed (the
+ *      server Id of the master itself should not be listed).
+ */
+ServerId
+LoadAwareBackupSelector::selectPrimary(uint32_t numBackups,
+                                       const ServerId backupIds[])
+{
+    ServerId primary = BackupSelector::selectSecondary(numBackups, backupIds);
+    if (!primary.isValid())
+        return primary;
+    refreshLoad(primary);
+
+    for (uint32_t i = 0; i < CANDIDATES - 1; ++i) {
+        ServerId candidate =
+            BackupSelector::selectSecondary(numBackups, backupIds);
+        if (!candidate.isValid())
+            break;
+        refreshLoad(candidate);
+
+        if (expectedWorkUs(tracker[primary]) >
+            expectedWorkUs(tracker[candidate])) {
+            primary = candidate;
+        }
+    }
+    BackupStats* stats = tracker[primary];
+    LOG(DEBUG, "Chose server %s with %u primary replicas, %u MB/s disk "
+               "bandwidth, %u writes outstanding, and %lu bytes queued for "
+               "storage (expected time to read on recovery is %u ms, to "
+               "drain writes is %lu us)",
+               primary.toString().c_str(), stats->primaryReplicaCount,
+               stats->expectedReadMBytesPerSec, stats->writesInFlight,
+               stats->reportedQueuedBytes, stats->getExpectedReadMs(),
+               stats->getExpectedQueueUs());
+    ++stats->primaryReplicaCount;
+
+    return primary;
+}
+
+/**
+ * Choose the least loaded of a few random backups that do not conflict with
+ * an existing set of backups. The ServerId will be invalid if there are no
+ * more machines to choose from.
+ * \param numBackups
+ *      The number of entries in the \a backupIds array.
+ * \param backupIds
+ *      An array of numBackups backup ids, none of which may conflict with the
+ *      returned backup. All existing replica locations as well as the
+ *      server id of the master should be listed.
+ */
+ServerId
+LoadAwareBackupSelector::selectSecondary(uint32_t numBackups,
+                                         const ServerId backupIds[])
+{
+    ServerId backup = BackupSelector::selectSecondary(numBackups, backupIds);
+    if (!backup.isValid())
+        return backup;
+    refreshLoad(backup);
+
+    for (uint32_t i = 0; i < CANDIDATES - 1; ++i) {
+        ServerId candidate =
+            BackupSelector::selectSecondary(numBackups, backupIds);
+        if (!candidate.isValid())
+            break;
+        refreshLoad(candidate);
+        if (tracker[backup]->getExpectedQueueUs() >
+            tracker[candidate]->getExpectedQueueUs()) {
+            backup = candidate;
+        }
+    }
+    return backup;
+}
+
+// - private -
+
+/**
+ * Return the measure of a backup's load that selectPrimary minimizes: the
+ * expected time, in microseconds, for the backup to read this master's
+ * primary replicas during recovery plus the time to write the data
+ * already waiting for it.
+ */
+uint64_t
+LoadAwareBackupSelector::expectedWorkUs(BackupStats* stats)
+{
+    return uint64_t(stats->getExpectedReadMs()) * 1000 +
+           stats->getExpectedQueueUs();
+}
+
+/**
+ * Bring the load a backup has reported up to date: collect the reply to
+ * an earlier GetLoadRpc if it has arrived, and ask again if the last
+ * request is more than LOAD_REPORT_INTERVAL_US old. Never waits for a
+ * reply, so selection uses the latest report that has arrived (until the
+ * first one does, only this master's own writes count).
+ * \param backupId
+ *      The backup being considered for a replica.
+ */
+void
+LoadAwareBackupSelector::refreshLoad(ServerId backupId)
+{
+    BackupStats* stats = tracker[backupId];
+    if (stats->loadRpc) {
+        if (!stats->loadRpc->isReady())
+            return;
+        try {
+            stats->loadRpc->wait(&stats->reportedQueuedBytes,
+                                 &stats->reportedWriteMBytesPerSec);
+        } catch (const ClientException& e) {
+            // The backup has crashed (the tracker will soon drop it) or
+            // predates BACKUP_GETLOAD; keep the last report.
+        }
+        stats->loadRpc.destroy();
+    }
+
+    uint64_t now = Cycles::rdtsc();
+    if (Cycles::toMicroseconds(now - stats->loadReportTime) <
+            LOAD_REPORT_INTERVAL_US)
+        return;
+    stats->loadReportTime = now;
+    stats->loadRpc.construct(context, backupId);
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,71 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_LOADAWAREBACKUPSELECTOR_H
+#define RAMCLOUD_LOADAWAREBACKUPSELECTOR_H
+
+#include "Common.h"
+#include "BackupSelector.h"
+
+namespace RAMCloud {
+
+/**
+ * Selects backups like BackupSelector, but steers replicas away from
+ * backups that are currently busy. Each selection draws a few random
+ * backups that satisfy the placement constraints and takes the one with
+ * the least data waiting to be written relative to its write bandwidth
+ * (see BackupStats::getExpectedQueueUs): the writes this master has in
+ * flight to it plus the backlog and bandwidth the backup itself reports
+ * (see refreshLoad). Primary selection also keeps weighing the expected
+ * recovery read time, so replicas remain spread out for recovery. Because
+ * the candidates are still chosen randomly, an idle cluster places
+ * replicas exactly as BackupSelector does.
+ */
+class LoadAwareBackupSelector : public BackupSelector {
+  PUBLIC:
+    explicit LoadAwareBackupSelector(Context* context,
+                                     const ServerId* serverId,
+                                     uint32_t numReplicas,
+                                     bool allowLocalBackup);
+    ServerId selectPrimary(uint32_t numBackups, const ServerId backupIds[]);
+    ServerId selectSecondary(uint32_t numBackups, const ServerId backupIds[]);
+
+  PRIVATE:
+    static uint64_t expectedWorkUs(BackupStats* stats);
+    void refreshLoad(ServerId backupId);
+
+    /// Used to send GetLoadRpcs.
+    Context* context;
+
+    /**
+     * Number of random candidates considered for each selection, primary
+     * or secondary (the same number BackupSelector::selectPrimary uses). A
+     * handful is enough to avoid the busiest backups without concentrating
+     * all new replicas on the few idlest ones.
+     */
+    enum { CANDIDATES = 5 };
+
+    /**
+     * A backup is asked for its load again once its last report is this
+     * old, and only while it is being considered for new replicas.
+     */
+    enum { LOAD_REPORT_INTERVAL_US = 10000 };
+
+    DISALLOW_COPY_AND_ASSIGN(LoadAwareBackupSelector);
+};
+
+} // namespace RAMCloud
+
+#endif
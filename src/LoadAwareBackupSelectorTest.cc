@@ -0,0 +1,161 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "Common.h"
+#include "LoadAwareBackupSelector.h"
+#include "MockCluster.h"
+#include "ServiceMask.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+struct LoadAwareBackupSelectorTest : public ::testing::Test {
+    TestLog::Enable logEnabler;
+    Context context;
+    MockCluster cluster;
+    LoadAwareBackupSelector* selector;
+    std::vector<ServerId> ids;
+
+    LoadAwareBackupSelectorTest()
+        : logEnabler()
+        , context()
+        , cluster(&context)
+        , selector()
+        , ids()
+    {
+        ServerConfig config = ServerConfig::forTesting();
+        config.services = {WireFormat::MASTER_SERVICE,
+                           WireFormat::ADMIN_SERVICE};
+        config.master.loadAwareBackupSelection = true;
+        Server* server = cluster.addServer(config);
+        selector = static_cast<LoadAwareBackupSelector*>(
+            server->master->objectManager.replicaManager.backupSelector.get());
+
+        config.services = {WireFormat::BACKUP_SERVICE,
+                           WireFormat::ADMIN_SERVICE};
+        config.backup.mockSpeed = 100;
+        for (uint32_t i = 1; i < 10; i++) {
+            config.localLocator = format("mock:host=backup%u", i);
+            ids.push_back(cluster.addServer(config)->serverId);
+        }
+        selector->applyTrackerChanges();
+    }
+
+    void setLoad(uint32_t backup, uint32_t megabytes,
+                 uint32_t primaryReplicas = 0) {
+        BackupStats* stats = selector->tracker[ids[backup]];
+        stats->bytesInFlight = uint64_t(megabytes) * 1024 * 1024;
+        stats->primaryReplicaCount = primaryReplicas;
+    }
+
+    // Make a backup appear to have reported a load; it won't be asked
+    // again during the test.
+    void setReportedLoad(uint32_t backup, uint32_t megabytes,
+                         uint32_t mBytesPerSec) {
+        BackupStats* stats = selector->tracker[ids[backup]];
+        stats->reportedQueuedBytes = uint64_t(megabytes) * 1024 * 1024;
+        stats->reportedWriteMBytesPerSec = mBytesPerSec;
+        stats->loadReportTime = Cycles::rdtsc();
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(LoadAwareBackupSelectorTest);
+};
+
+// With MockRandom(1), the random candidates are the backups in the order
+// they enlisted, skipping any that conflict.
+
+TEST_F(LoadAwareBackupSelectorTest, selectPrimary) {
+    MockRandom _(1);
+    // Each replica adds 80 ms of recovery reads and each MB in flight adds
+    // 10 ms of writes.
+    setLoad(0, 10);     // 180 ms
+    setLoad(1, 0, 1);   // 160 ms
+    setLoad(2, 1);      // 90 ms
+    setLoad(3, 0, 1);   // 160 ms
+    setLoad(4, 0, 2);   // 240 ms
+    EXPECT_EQ(ids[2], selector->selectPrimary(0, NULL));
+    EXPECT_EQ(1u, selector->tracker[ids[2]]->primaryReplicaCount);
+}
+
+TEST_F(LoadAwareBackupSelectorTest, selectPrimary_recoveryBalanceKept) {
+    MockRandom _(1);
+    setLoad(0, 0, 3);   // 320 ms
+    setLoad(1, 1, 2);   // 250 ms
+    setLoad(2, 0, 2);   // 240 ms
+    setLoad(3, 20);     // 280 ms
+    setLoad(4, 0, 4);   // 400 ms
+    EXPECT_EQ(ids[2], selector->selectPrimary(0, NULL));
+}
+
+TEST_F(LoadAwareBackupSelectorTest, selectSecondary) {
+    {
+        MockRandom _(1);
+        EXPECT_EQ(ids[0], selector->selectSecondary(0, NULL));
+    }
+    setLoad(0, 2);
+    setLoad(2, 1);
+    {
+        MockRandom _(1);
+        EXPECT_EQ(ids[1], selector->selectSecondary(0, NULL));
+    }
+    {
+        MockRandom _(1);
+        const ServerId conflicts[] = { ids[1] };
+        EXPECT_EQ(ids[3], selector->selectSecondary(1, conflicts));
+    }
+}
+
+TEST_F(LoadAwareBackupSelectorTest, selectSecondary_reportedLoad) {
+    MockRandom _(1);
+    setReportedLoad(0, 1, 50);      // 20 ms
+    setLoad(1, 2);
+    setReportedLoad(1, 0, 400);     // 5 ms
+    setLoad(2, 1);                  // 10 ms
+    setReportedLoad(3, 3, 0);       // 30 ms
+    setReportedLoad(4, 8, 1000);    // 8 ms
+    EXPECT_EQ(ids[1], selector->selectSecondary(0, NULL));
+}
+
+TEST_F(LoadAwareBackupSelectorTest, selectSecondary_noHosts) {
+    const ServerId conflicts[] = { ids[0], ids[1], ids[2], ids[3], ids[4],
+                                   ids[5], ids[6], ids[7], ids[8] };
+    EXPECT_EQ(ServerId(), selector->selectSecondary(9, conflicts));
+}
+
+TEST_F(LoadAwareBackupSelectorTest, refreshLoad) {
+    BackupStats* stats = selector->tracker[ids[0]];
+    stats->reportedQueuedBytes = 5;
+    stats->reportedWriteMBytesPerSec = 7;
+    Cycles::mockTscValue = Cycles::fromNanoseconds(
+            LoadAwareBackupSelector::LOAD_REPORT_INTERVAL_US * 1000);
+    selector->refreshLoad(ids[0]);
+    ASSERT_TRUE(stats->loadRpc);
+    EXPECT_EQ(5u, stats->reportedQueuedBytes);
+
+    // The reply is collected; it's too soon to ask again.
+    selector->refreshLoad(ids[0]);
+    EXPECT_FALSE(stats->loadRpc);
+    EXPECT_EQ(0u, stats->reportedQueuedBytes);
+    EXPECT_EQ(0u, stats->reportedWriteMBytesPerSec);
+
+    Cycles::mockTscValue += Cycles::fromNanoseconds(
+            LoadAwareBackupSelector::LOAD_REPORT_INTERVAL_US * 1000);
+    selector->refreshLoad(ids[0]);
+    EXPECT_TRUE(stats->loadRpc);
+    Cycles::mockTscValue = 0;
+}
+
+} // namespace RAMCloud
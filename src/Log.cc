@@ -21,6 +21,8 @@
 #include "PerfStats.h"
 #include "ServerConfig.h"
 #include "ShortMacros.h"
+#include "SlowRpcLog.h"
+#include "TimeTrace.h"
 
 namespace RAMCloud {
 
@@ -154,6 +156,9 @@ void
 Log::sync()
 {
     CycleCounter<uint64_t> __(&PerfStats::threadStats.logSyncCycles);
+    CycleCounter<uint64_t> syncTimer(
+            &SlowRpcLog::threadTimes.logSyncCycles);
+    TimeTrace::recordSampled("trace %u: log sync starting");
 
     Tub<SpinLock::Guard> lock;
     lock.construct(appendLock);
@@ -204,6 +209,7 @@ Log::sync()
 
         originalHead->replicatedSegment->sync(appendedLength, &certificate);
         originalHead->syncedLength = appendedLength;
+        TimeTrace::recordSampled("trace %u: log sync finished");
         TEST_LOG("log synced");
     } else {
         TEST_LOG("sync not needed: already fully replicated");
@@ -221,7 +227,10 @@ void
 Log::syncTo(Log::Reference reference)
 {
     CycleCounter<uint64_t> __(&PerfStats::threadStats.logSyncCycles);
+    CycleCounter<uint64_t> syncTimer(
+            &SlowRpcLog::threadTimes.logSyncCycles);
     metrics.totalSyncCalls++;
+    TimeTrace::recordSampled("trace %u: log sync starting");
 
     LogSegment* segment = getSegment(reference);
 
@@ -261,6 +270,7 @@ Log::syncTo(Log::Reference reference)
 
         head->replicatedSegment->sync(appendedLength, &certificate);
         head->syncedLength = appendedLength;
+        TimeTrace::recordSampled("trace %u: log sync finished");
         TEST_LOG("log synced");
         return;
     }
@@ -25,6 +25,7 @@
 #include "Segment.h"
 #include "SegmentIterator.h"
 #include "ServerConfig.h"
+#include "Util.h"
 #include "WallTime.h"
 
 namespace RAMCloud {
@@ -61,6 +62,7 @@ LogCleaner::LogCleaner(Context* context,
       writeCostThreshold(config->master.cleanerWriteCostThreshold),
       disableInMemoryCleaning(config->master.disableInMemoryCleaning),
       numThreads(config->master.cleanerThreadCount),
+      numaNodes(config->master.numaNodes),
       segletSize(config->segletSize),
       segmentSize(config->segmentSize),
       activeThreads(0),
@@ -201,6 +203,14 @@ LogCleaner::cleanerThreadEntry(LogCleaner* logCleaner, Context* context)
 
     CleanerThreadState state;
     state.threadNumber = __sync_fetch_and_add(&threadCnt, 1);
+    if (logCleaner->numaNodes > 1) {
+        int node = downCast<int>(state.threadNumber % logCleaner->numaNodes);
+        if (Util::pinThreadToNumaNode(node))
+            LOG(NOTICE, "LogCleaner thread pinned to NUMA node %d", node);
+        else
+            LOG(WARNING, "Couldn't pin LogCleaner thread to NUMA node %d",
+                node);
+    }
     try {
         while (1) {
             Fence::lfence();
@@ -298,6 +308,10 @@ LogCleaner::doWork(CleanerThreadState* state)
  * Perform an in-memory cleaning pass. This takes a segment and compacts it,
  * re-packing all live entries together sequentially, allowing us to reclaim
  * some of the dead space.
+ *
+ * If the master has cold storage and memory is mostly full of live data,
+ * the segment holding the oldest data is "compacted" into cold storage
+ * instead, which frees all of the memory it occupied.
  */
 void
 LogCleaner::doMemoryCleaning()
@@ -309,7 +323,17 @@ LogCleaner::doMemoryCleaning()
     if (disableInMemoryCleaning)
         return;
 
-    LogSegment* segment = getSegmentToCompact();
+    LogSegment* segment = NULL;
+    SegletAllocator& allocator = segmentManager.getAllocator();
+    if (allocator.getTotalCount(SegletAllocator::COLD) > 0 &&
+      cleanableSegments.getLiveObjectUtilization() >=
+        MIN_DEMOTION_UTILIZATION) {
+        AtomicCycleCounter __(&inMemoryMetrics.getSegmentToCompactTicks);
+        segment = cleanableSegments.getSegmentToDemote();
+    }
+    const bool demote = (segment != NULL);
+    if (segment == NULL)
+        segment = getSegmentToCompact();
     if (segment == NULL)
         return;
 
@@ -324,10 +348,13 @@ LogCleaner::doMemoryCleaning()
     // is not available right now.
     CycleCounter<uint64_t> waitTicks(&localMetrics.waitForFreeSurvivorTicks);
     LogSegment* survivor = segmentManager.allocSideSegment(
-            SegmentManager::FOR_CLEANING | SegmentManager::MUST_NOT_FAIL,
+            SegmentManager::FOR_CLEANING | SegmentManager::MUST_NOT_FAIL |
+            (demote ? SegmentManager::COLD : SegmentManager::EMPTY),
             segment);
     assert(survivor != NULL);
     waitTicks.stop();
+    if (survivor->isCold)
+        faultInColdSurvivor(survivor);
 
     localMetrics.totalBytesInCompactedSegments +=
         segment->getSegletsAllocated() * segletSize;
@@ -386,8 +413,14 @@ LogCleaner::doMemoryCleaning()
     }
     assert(segment->getSegletsAllocated() >= survivor->getSegletsAllocated());
 
-    uint64_t freeSegletsGained = segment->getSegletsAllocated() -
-                                 survivor->getSegletsAllocated();
+    uint64_t freeSegletsGained = segment->getSegletsAllocated();
+    if (survivor->isCold) {
+        releaseColdSurvivor(survivor);
+        localMetrics.totalSegmentsDemoted++;
+        localMetrics.totalBytesDemoted += survivor->getAppendedLength();
+    } else {
+        freeSegletsGained -= survivor->getSegletsAllocated();
+    }
     if (freeSegletsGained == 0)
         balancer->compactionFailed();
     uint64_t bytesFreed = freeSegletsGained * segletSize;
@@ -454,9 +487,13 @@ LogCleaner::doDiskCleaning()
     // Relocate the live entries to survivor segments. Be sure to use local
     // counters and merge them into our global metrics afterwards to avoid
     // cache line ping-ponging in the hot path.
+    // Cold segments are only ever cleaned together (see
+    // CleanableSegmentManager::getSegmentsToClean), and their survivors go
+    // back to cold storage.
+    const bool cold = segmentsToClean[0]->isCold;
     LogSegmentVector survivors;
     uint64_t entryBytesAppended = relocateLiveEntries(entries, survivors,
-            &localMetrics);
+            &localMetrics, cold);
 
     uint32_t segmentsAfter = downCast<uint32_t>(survivors.size());
     uint32_t segletsAfter = 0;
@@ -479,7 +516,9 @@ LogCleaner::doDiskCleaning()
         assert(segmentsBefore >= segmentsAfter);
     }
 
-    uint64_t memoryBytesFreed = (segletsBefore - segletsAfter) * segletSize;
+    uint64_t memoryBytesFreed = 0;
+    if (!cold)
+        memoryBytesFreed = (segletsBefore - segletsAfter) * segletSize;
     uint64_t diskBytesFreed = (segmentsBefore - segmentsAfter) * segmentSize;
     localMetrics.totalMemoryBytesFreed += memoryBytesFreed;
     localMetrics.totalDiskBytesFreed += diskBytesFreed;
@@ -619,6 +658,9 @@ LogCleaner::getSortedEntries(LogSegmentVector& segmentsToClean,
  *      returned here.
  * \param[out] localMetrics
  *      Contains various performance counters that are incremented here.
+ * \param cold
+ *      If true, the entries came from segments in cold storage, so the
+ *      survivors should be allocated there too, if possible.
  * \return
  *      The number of live bytes appended to survivors is returned. This value
  *      includes any segment metadata overhead. This makes it directly
@@ -628,7 +670,8 @@ LogCleaner::getSortedEntries(LogSegmentVector& segmentsToClean,
 uint64_t
 LogCleaner::relocateLiveEntries(EntryVector& entries,
                             LogSegmentVector& outSurvivors,
-                            LogCleanerMetrics::OnDisk<uint64_t>* localMetrics)
+                            LogCleanerMetrics::OnDisk<uint64_t>* localMetrics,
+                            bool cold)
 {
     CycleCounter<uint64_t> _(&localMetrics->relocateLiveEntriesTicks);
 
@@ -642,6 +685,8 @@ LogCleaner::relocateLiveEntries(EntryVector& entries,
         LogEntryType type = entry.reference.getEntry(
             &segmentManager.getAllocator(), &buffer);
         Log::Reference reference = entry.reference;
+        if (cold)
+            faultInColdEntry(buffer);
         uint32_t bytesAppended = 0;
         RelocStatus s = relocateEntry(type,
                                       buffer,
@@ -668,12 +713,19 @@ LogCleaner::relocateLiveEntries(EntryVector& entries,
             CycleCounter<uint64_t> waitTicks(
                 &localMetrics->waitForFreeSurvivorsTicks);
             survivor = segmentManager.allocSideSegment(
-                SegmentManager::FOR_CLEANING | SegmentManager::MUST_NOT_FAIL,
+                SegmentManager::FOR_CLEANING | SegmentManager::MUST_NOT_FAIL |
+                (cold ? SegmentManager::COLD : SegmentManager::EMPTY),
                 NULL);
             assert(survivor != NULL);
             waitTicks.stop();
+            if (survivor->isCold)
+                faultInColdSurvivor(survivor);
             outSurvivors.push_back(survivor);
 
+            // Entries are sorted by age, so the survivor's newest entry
+            // timestamp is recomputed from what is written to it.
+            survivor->newestEntryTimestamp = 0;
+
             s = relocateEntry(type,
                               buffer,
                               reference,
@@ -692,6 +744,8 @@ LogCleaner::relocateLiveEntries(EntryVector& entries,
                 buffer.size();
             currentLiveEntries[type]++;
             currentLiveEntryLengths[type] += bytesAppended;
+            if (entry.timestamp > survivor->newestEntryTimestamp)
+                survivor->newestEntryTimestamp = entry.timestamp;
         }
 
         totalEntryBytesAppended += bytesAppended;
@@ -749,6 +803,68 @@ LogCleaner::closeSurvivor(LogSegment* survivor)
     if (!r) {
         assert(r);
     }
+
+    if (survivor->isCold)
+        releaseColdSurvivor(survivor);
+}
+
+/**
+ * Read all of a newly allocated survivor segment in cold storage into
+ * memory. Entries are appended to survivors while holding hash table bucket
+ * locks (see ObjectManager::relocateObject), and writing to a page of cold
+ * storage that isn't in memory has to read it from flash first, so those
+ * page faults are taken here instead.
+ *
+ * \param survivor
+ *      The survivor segment, whose seglets must be cold.
+ */
+void
+LogCleaner::faultInColdSurvivor(LogSegment* survivor)
+{
+    assert(survivor->isCold);
+    SegletAllocator& allocator = segmentManager.getAllocator();
+    for (uint32_t i = 0; i < survivor->getSegletsAllocated(); i++) {
+        const void* p = NULL;
+        survivor->peek(i * segletSize, &p);
+        allocator.faultInColdMemory(p, segletSize);
+    }
+}
+
+/**
+ * Read a log entry in cold storage into memory before it is relocated, so
+ * that copying it to a survivor under a hash table bucket lock doesn't wait
+ * for flash.
+ *
+ * \param buffer
+ *      Buffer describing the entry.
+ */
+void
+LogCleaner::faultInColdEntry(Buffer& buffer)
+{
+    SegletAllocator& allocator = segmentManager.getAllocator();
+    for (Buffer::Iterator it(&buffer); !it.isDone(); it.next())
+        allocator.faultInColdMemory(it.getData(), it.getLength());
+}
+
+/**
+ * Write the contents of a closed survivor segment in cold storage out to
+ * flash and drop them from memory. Until this is done, they are only in the
+ * page cache of the cold storage file; afterwards, reads will fault in
+ * whatever they need.
+ *
+ * \param survivor
+ *      The closed survivor segment, whose seglets must be cold.
+ */
+void
+LogCleaner::releaseColdSurvivor(LogSegment* survivor)
+{
+    assert(survivor->isCold);
+    SegletAllocator& allocator = segmentManager.getAllocator();
+    for (uint32_t i = 0; i < survivor->getSegletsAllocated(); i++) {
+        const void* p = NULL;
+        survivor->peek(i * segletSize, &p);
+        allocator.releaseColdMemory(p, segletSize);
+    }
 }
 
 bool
@@ -115,6 +115,11 @@ class LogCleaner {
     /// the in-memory cleaner.
     enum { MIN_MEMORY_UTILIZATION = 90 };
 
+    /// If the master has cold storage, the in-memory cleaner demotes the
+    /// segments holding the oldest data there instead of compacting once live
+    /// objects take up at least this percentage of memory.
+    enum { MIN_DEMOTION_UTILIZATION = 80 };
+
     /// The minimum amount of backup disk utilization we will begin cleaning at
     /// using the disk cleaner. Note that the disk cleaner may also run if the
     /// in-memory cleaner is not working efficiently enough to keep up with the
@@ -238,8 +243,12 @@ class LogCleaner {
                           LogCleanerMetrics::OnDisk<uint64_t>* localMetrics);
     uint64_t relocateLiveEntries(EntryVector& entries,
                             LogSegmentVector& outSurvivors,
-                            LogCleanerMetrics::OnDisk<uint64_t>* localMetrics);
+                            LogCleanerMetrics::OnDisk<uint64_t>* localMetrics,
+                            bool cold = false);
     void closeSurvivor(LogSegment* survivor);
+    void faultInColdSurvivor(LogSegment* survivor);
+    void faultInColdEntry(Buffer& buffer);
+    void releaseColdSurvivor(LogSegment* survivor);
     void waitForAvailableSurvivors(size_t count, uint64_t& outTicks);
 
     /**
@@ -369,6 +378,11 @@ class LogCleaner {
     /// keep up with higher write rates and memory utilizations.
     const int numThreads;
 
+    /// Number of NUMA nodes the log's memory is divided among. If greater
+    /// than 1, cleaner threads are pinned round-robin to the cores of each
+    /// node, so that every node's memory has a cleaner running nearby.
+    const uint32_t numaNodes;
+
     /// Size of each seglet in bytes. Used to calculate the best segment for in-
     /// memory cleaning.
     uint32_t segletSize;
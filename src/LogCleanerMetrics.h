@@ -57,6 +57,8 @@ class InMemory {
           totalBytesAppendedToSurvivors(0),
           totalSegmentsCompacted(0),
           totalEmptySegmentsCompacted(0),
+          totalSegmentsDemoted(0),
+          totalBytesDemoted(0),
           totalEntriesScanned(),
           totalLiveEntriesScanned(),
           totalScannedEntryLengths(),
@@ -92,6 +94,8 @@ class InMemory {
         m.set_total_bytes_appended_to_survivors(totalBytesAppendedToSurvivors);
         m.set_total_segments_compacted(totalSegmentsCompacted);
         m.set_total_empty_segments_compacted(totalEmptySegmentsCompacted);
+        m.set_total_segments_demoted(totalSegmentsDemoted);
+        m.set_total_bytes_demoted(totalBytesDemoted);
 
         foreach (uint64_t count, totalEntriesScanned)
             m.add_total_entries_scanned(count);
@@ -130,6 +134,8 @@ class InMemory {
         MERGE_FIELD(totalBytesAppendedToSurvivors);
         MERGE_FIELD(totalSegmentsCompacted);
         MERGE_FIELD(totalEmptySegmentsCompacted);
+        MERGE_FIELD(totalSegmentsDemoted);
+        MERGE_FIELD(totalBytesDemoted);
 
         for (int i = 0; i < TOTAL_LOG_ENTRY_TYPES; i++) {
             MERGE_FIELD(totalEntriesScanned[i]);
@@ -175,6 +181,13 @@ class InMemory {
     /// Number of segments compacted that were empty (no live data whatsoever).
     CounterType totalEmptySegmentsCompacted;
 
+    /// Number of segments compacted into cold storage rather than memory.
+    /// These are included in totalSegmentsCompacted.
+    CounterType totalSegmentsDemoted;
+
+    /// Total number of bytes appended to cold survivor segments.
+    CounterType totalBytesDemoted;
+
     /// Total number of each log entry the in-memory cleaner has encountered
     /// while compacting segments. These counts include both dead and alive
     /// entries.
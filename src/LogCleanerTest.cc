@@ -39,7 +39,8 @@ class TestEntryHandlers : public LogEntryHandlers {
   public:
     TestEntryHandlers()
         : timestamp(0),
-          attemptToRelocate(false)
+          attemptToRelocate(false),
+          relocatedObject()
     {
     }
 
@@ -57,12 +58,16 @@ class TestEntryHandlers : public LogEntryHandlers {
     {
         RAMCLOUD_TEST_LOG("type %d, size %u",
             downCast<int>(type), oldBuffer.size());
-        if (attemptToRelocate)
-            relocator.append(type, oldBuffer);
+        if (attemptToRelocate && relocator.append(type, oldBuffer) &&
+          type == LOG_ENTRY_TYPE_OBJ)
+            relocatedObject = relocator.getNewReference();
     }
 
     uint32_t timestamp;
     bool attemptToRelocate;
+
+    /// New location of the last object relocated.
+    Log::Reference relocatedObject;
 };
 
 class CleanerServerConfig {
@@ -287,8 +292,45 @@ TEST_F(LogCleanerTest, doWork_notifyConditionVariable) {
     thread.join();
 }
 
-// There are currently no meaningful tests for doMemoryCleaning;
-// please write some!
+TEST_F(LogCleanerTest, doMemoryCleaning_demote) {
+    ServerConfig* config = serverConfig();
+    config->master.coldStorageFile =
+        format("/tmp/ramcloud-cold-storage-test-%d", getpid());
+    config->master.coldStorageBytes = 2 * config->segmentSize;
+    config->master.disableInMemoryCleaning = false;
+    config->master.cleanerWriteCostThreshold = 1;
+    SegletAllocator allocator2(config);
+    SegmentManager segmentManager2(&context, config, &serverId,
+                                   allocator2, replicaManager,
+                                   &masterTableMetadata);
+    LogCleaner cleaner2(&context, config,
+                        segmentManager2, replicaManager, entryHandlers);
+    entryHandlers.attemptToRelocate = true;
+
+    LogSegment* segment = segmentManager2.allocHeadSegment();
+    uint32_t lengthBefore = segment->getAppendedLength();
+    EXPECT_TRUE(segment->append(LOG_ENTRY_TYPE_OBJ, "cold object", 12));
+    segment->trackNewEntries(LOG_ENTRY_TYPE_OBJ, 1,
+                             segment->getAppendedLength() - lengthBefore);
+    segmentManager2.allocHeadSegment(); // roll over
+
+    CleanableSegmentManager::mockLiveObjectUtilization =
+        LogCleaner::MIN_DEMOTION_UTILIZATION;
+    cleaner2.doMemoryCleaning();
+    CleanableSegmentManager::mockLiveObjectUtilization = 0;
+    EXPECT_EQ(1U, cleaner2.inMemoryMetrics.totalSegmentsDemoted);
+    EXPECT_GT(2 * segmentManager2.segletsPerSegment,
+              allocator2.getFreeCount(SegletAllocator::COLD));
+
+    // The object was moved to cold storage, whose pages were dropped from
+    // memory, and can still be read from there.
+    Log::Reference reference = entryHandlers.relocatedObject;
+    EXPECT_TRUE(allocator2.isCold(reinterpret_cast<void*>(
+        reference.toInteger())));
+    Buffer buffer;
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, reference.getEntry(&allocator2, &buffer));
+    EXPECT_EQ("cold object", string(buffer.getStart<char>(), 11));
+}
 
 TEST_F(LogCleanerTest, doDiskCleaning) {
     // Not entirely sure what to check here. doDiskCleaning() mostly just
@@ -398,6 +398,10 @@ LogMetricsStringer::getMemoryCompactorMetrics()
         d(segmentsCompacted) / cleanerTime,
         inMemoryMetrics.total_empty_segments_compacted());
 
+    s += ls + format("  Segments Demoted to Flash:     %lu (%.2f MB)\n",
+        inMemoryMetrics.total_segments_demoted(),
+        d(inMemoryMetrics.total_bytes_demoted()) / 1024 / 1024);
+
     uint64_t bytesInCompactedSegments =
         inMemoryMetrics.total_bytes_in_compacted_segments();
     s += ls + format("  Avg Seg Util Pre-Compaction:   %.2f%%\n",
@@ -69,6 +69,9 @@ class LogSegment : public Segment {
      * \param isEmergencyHead
      *      If true, this is a special segment that is being used to roll over
      *      to a new head and write a new digest when otherwise out of memory.
+     * \param isCold
+     *      If true, the seglets are backed by cold storage rather than memory
+     *      (see SegletAllocator).
      */
     LogSegment(vector<Seglet*>& seglets,
                uint32_t segletSize,
@@ -76,7 +79,8 @@ class LogSegment : public Segment {
                uint64_t id,
                SegmentSlot slot,
                uint32_t creationTimestamp,
-               bool isEmergencyHead)
+               bool isEmergencyHead,
+               bool isCold = false)
         : Segment(seglets, segletSize),
           id(id),
           slot(slot),
@@ -84,6 +88,8 @@ class LogSegment : public Segment {
           segmentSize(segmentSize),
           creationTimestamp(creationTimestamp),
           isEmergencyHead(isEmergencyHead),
+          isCold(isCold),
+          newestEntryTimestamp(creationTimestamp),
           cleanedEpoch(0),
           cachedCleaningCostBenefitScore(0),
           cachedCompactionCostBenefitScore(0),
@@ -247,6 +253,19 @@ class LogSegment : public Segment {
     /// that is expected to live longer.
     const bool isEmergencyHead;
 
+    /// If true, this segment's seglets are backed by cold storage on flash
+    /// rather than memory: the cleaner demoted it there because it held the
+    /// oldest data (see LogCleaner::doMemoryCleaning).
+    const bool isCold;
+
+    /// Approximate timestamp (in the sense of LogEntryHandlers::getTimestamp)
+    /// of the newest entry in this segment. It is the creation time for a
+    /// segment filled at the log head; the disk cleaner sets it to that of
+    /// the newest entry it relocates into a survivor, and memory compaction
+    /// preserves it. The cleaner demotes segments with the oldest value to
+    /// cold storage first.
+    uint32_t newestEntryTimestamp;
+
     /// The epoch value when cleaning was completed on this segment. Once no
     /// more RPCs in the system exist with epochs less than or equal to this,
     /// there can be no more outstanding references into the segment and its
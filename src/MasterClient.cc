@@ -226,6 +226,67 @@ GetHeadOfLogRpc::wait()
     return { respHdr->headSegmentId, respHdr->headSegmentOffset };
 }
 
+/**
+ * Retrieve a master's access statistics for the tablets it owns. This is
+ * used by the coordinator's TabletBalancer.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param serverId
+ *      Identifier for the target master.
+ * \param[out] serverStats
+ *      Filled in with the master's statistics.
+ *
+ * \throw ServerNotUpException
+ *      The intended server for this RPC is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ */
+void
+MasterClient::getStatistics(Context* context, ServerId serverId,
+        ProtoBuf::ServerStatistics* serverStats)
+{
+    GetStatisticsRpc rpc(context, serverId);
+    rpc.wait(serverStats);
+}
+
+/**
+ * Constructor for GetStatisticsRpc: initiates an RPC in the same way as
+ * #MasterClient::getStatistics, but returns once the RPC has been
+ * initiated, without waiting for it to complete.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param serverId
+ *      Identifier for the target master.
+ */
+GetStatisticsRpc::GetStatisticsRpc(Context* context, ServerId serverId)
+    : ServerIdRpcWrapper(context, serverId,
+            sizeof(WireFormat::GetServerStatistics::Response))
+{
+    allocHeader<WireFormat::GetServerStatistics>();
+    send();
+}
+
+/**
+ * Wait for a getStatistics RPC to complete.
+ *
+ * \param[out] serverStats
+ *      Filled in with the master's statistics.
+ *
+ * \throw ServerNotUpException
+ *      The intended server for this RPC is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ */
+void
+GetStatisticsRpc::wait(ProtoBuf::ServerStatistics* serverStats)
+{
+    waitAndCheckErrors();
+    const WireFormat::GetServerStatistics::Response* respHdr(
+            getResponseHeader<WireFormat::GetServerStatistics>());
+    ProtoBuf::parseFromResponse(response, sizeof(*respHdr),
+            respHdr->serverStatsLength, serverStats);
+}
+
 /**
  * This RPC is sent to an index server to request that it insert an index
  * entry in an indexlet it holds.
@@ -378,6 +439,65 @@ IsReplicaNeededRpc::wait()
     return respHdr->needed;
 }
 
+/**
+ * Ask a master to migrate one of its tablets to another master. This is
+ * the same operation as RamCloud::migrateTablet, but addressed by server
+ * id; the coordinator uses it to rebalance load.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param serverId
+ *      Identifier for the master that currently owns the tablet.
+ * \param tableId
+ *      Identifier for the table.
+ * \param firstKeyHash
+ *      Lowest key hash in the tablet range to be migrated.
+ * \param lastKeyHash
+ *      Highest key hash in the tablet range to be migrated.
+ * \param newOwnerId
+ *      Identifier for the master that will own the tablet.
+ * \param pullPartitions
+ *      If nonzero, the new owner pulls the tablet's data using this many
+ *      partitions (see MasterService::pullTablet); otherwise the current
+ *      owner pushes it.
+ *
+ * \throw ServerNotUpException
+ *      The intended server for this RPC is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ */
+void
+MasterClient::migrateMasterTablet(Context* context, ServerId serverId,
+        uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+        ServerId newOwnerId, uint32_t pullPartitions)
+{
+    MigrateMasterTabletRpc rpc(context, serverId, tableId, firstKeyHash,
+            lastKeyHash, newOwnerId, pullPartitions);
+    rpc.wait();
+}
+
+/**
+ * Constructor for MigrateMasterTabletRpc: initiates an RPC in the same way
+ * as #MasterClient::migrateMasterTablet, but returns once the RPC has been
+ * initiated, without waiting for it to complete.
+ *
+ * \copydetails MasterClient::migrateMasterTablet
+ */
+MigrateMasterTabletRpc::MigrateMasterTabletRpc(Context* context,
+        ServerId serverId, uint64_t tableId, uint64_t firstKeyHash,
+        uint64_t lastKeyHash, ServerId newOwnerId, uint32_t pullPartitions)
+    : ServerIdRpcWrapper(context, serverId,
+            sizeof(WireFormat::MigrateTablet::Response))
+{
+    WireFormat::MigrateTablet::Request* reqHdr(
+            allocHeader<WireFormat::MigrateTablet>());
+    reqHdr->tableId = tableId;
+    reqHdr->firstKeyHash = firstKeyHash;
+    reqHdr->lastKeyHash = lastKeyHash;
+    reqHdr->newOwnerMasterId = newOwnerId.getId();
+    reqHdr->pullPartitions = pullPartitions;
+    send();
+}
+
 /**
  * Request that a master decide whether it will accept a migrated indexlet
  * and set up any necessary state to begin receiving indexlet data from the
@@ -522,6 +642,163 @@ PrepForMigrationRpc::PrepForMigrationRpc(Context* context, ServerId serverId,
     send();
 }
 
+/**
+ * Ask a master to take over a tablet from its current owner by pulling
+ * the tablet's data from the current owner's hash table. The new owner
+ * takes ownership of the tablet once all of the data has been copied;
+ * if the pull fails, the tablet stays with its current owner.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param serverId
+ *      Identifier for the master that will take over the tablet.
+ * \param tableId
+ *      Identifier for the table.
+ * \param firstKeyHash
+ *      Lowest key hash in the tablet range to be migrated.
+ * \param lastKeyHash
+ *      Highest key hash in the tablet range to be migrated.
+ * \param sourceId
+ *      Identifier for the master that currently owns the tablet.
+ * \param numPartitions
+ *      The source's hash table is divided into this many ranges of
+ *      buckets, which are pulled and replayed in parallel.
+ */
+void
+MasterClient::pullTablet(Context* context, ServerId serverId,
+        uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+        ServerId sourceId, uint32_t numPartitions)
+{
+    PullTabletRpc rpc(context, serverId, tableId, firstKeyHash, lastKeyHash,
+            sourceId, numPartitions);
+    rpc.wait();
+}
+
+/**
+ * Constructor for PullTabletRpc: initiates an RPC in the same way as
+ * #MasterClient::pullTablet, but returns once the RPC has been
+ * initiated, without waiting for it to complete.
+ *
+ * \copydetails MasterClient::pullTablet
+ */
+PullTabletRpc::PullTabletRpc(Context* context, ServerId serverId,
+        uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+        ServerId sourceId, uint32_t numPartitions)
+    : ServerIdRpcWrapper(context, serverId,
+            sizeof(WireFormat::PullTablet::Response))
+{
+    WireFormat::PullTablet::Request* reqHdr(
+            allocHeader<WireFormat::PullTablet>(serverId));
+    reqHdr->tableId = tableId;
+    reqHdr->firstKeyHash = firstKeyHash;
+    reqHdr->lastKeyHash = lastKeyHash;
+    reqHdr->sourceServerId = sourceId.getId();
+    reqHdr->numPartitions = numPartitions;
+    send();
+}
+
+/**
+ * Issue one of the control operations of a pull-based migration (see
+ * WireFormat::PullTabletData::Op) to the current owner of a tablet.
+ * Data is pulled with PullTabletDataRpc.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param serverId
+ *      Identifier for the master that currently owns the tablet.
+ * \param tableId
+ *      Identifier for the table.
+ * \param firstKeyHash
+ *      Lowest key hash in the tablet range being migrated.
+ * \param lastKeyHash
+ *      Highest key hash in the tablet range being migrated.
+ * \param op
+ *      BEGIN, LOCK, END, or ABORT.
+ * \return
+ *      The number of buckets in the source's hash table.
+ */
+uint64_t
+MasterClient::pullTabletData(Context* context, ServerId serverId,
+        uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+        WireFormat::PullTabletData::Op op)
+{
+    PullTabletDataRpc rpc(context, serverId, tableId, firstKeyHash,
+            lastKeyHash, op);
+    return rpc.wait().numBuckets;
+}
+
+/**
+ * Constructor for PullTabletDataRpc: initiates an RPC in the same way as
+ * #MasterClient::pullTabletData, but returns once the RPC has been
+ * initiated, without waiting for it to complete.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param serverId
+ *      Identifier for the master that currently owns the tablet.
+ * \param tableId
+ *      Identifier for the table.
+ * \param firstKeyHash
+ *      Lowest key hash in the tablet range being migrated.
+ * \param lastKeyHash
+ *      Highest key hash in the tablet range being migrated.
+ * \param op
+ *      Operation to perform; see WireFormat::PullTabletData::Op.
+ * \param startBucket
+ *      For PULL operations: first hash table bucket to scan.
+ * \param endBucket
+ *      For PULL operations: 1 + the last hash table bucket to scan.
+ * \param maxBytes
+ *      For PULL operations: the source stops scanning once it has
+ *      collected about this many bytes of objects.
+ * \param response
+ *      For PULL operations: the segment of objects will be returned
+ *      here (after the RPC completes, wait() strips the response header).
+ *      May be NULL for other operations.
+ */
+PullTabletDataRpc::PullTabletDataRpc(Context* context, ServerId serverId,
+        uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+        WireFormat::PullTabletData::Op op, uint64_t startBucket,
+        uint64_t endBucket, uint32_t maxBytes, Buffer* response)
+    : ServerIdRpcWrapper(context, serverId,
+            sizeof(WireFormat::PullTabletData::Response), response)
+{
+    WireFormat::PullTabletData::Request* reqHdr(
+            allocHeader<WireFormat::PullTabletData>(serverId));
+    reqHdr->tableId = tableId;
+    reqHdr->firstKeyHash = firstKeyHash;
+    reqHdr->lastKeyHash = lastKeyHash;
+    reqHdr->op = op;
+    reqHdr->startBucket = startBucket;
+    reqHdr->endBucket = endBucket;
+    reqHdr->maxBytes = maxBytes;
+    send();
+}
+
+/**
+ * Wait for a pullTabletData RPC to complete, and throw exceptions for
+ * any errors.
+ *
+ * \return
+ *      A copy of the response header. For PULL operations, the header
+ *      has been removed from the response buffer, leaving only the
+ *      segment of objects (described by the header's certificate).
+ * \throw ServerNotUpException
+ *      The intended server for this RPC is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ */
+WireFormat::PullTabletData::Response
+PullTabletDataRpc::wait()
+{
+    waitAndCheckErrors();
+    WireFormat::PullTabletData::Response respHdr(
+            *getResponseHeader<WireFormat::PullTabletData>());
+
+    // respHdr off limits.
+    response->truncateFront(sizeof(WireFormat::PullTabletData::Response));
+    return respHdr;
+}
+
 /**
  * Request that a master add some migrated data to its storage.
  * The receiving master will not service requests on the data,
@@ -50,18 +50,29 @@ class MasterClient {
     static void dropTabletOwnership(Context* context, ServerId serverId,
             uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash);
     static LogPosition getHeadOfLog(Context* context, ServerId serverId);
+    static void getStatistics(Context* context, ServerId serverId,
+            ProtoBuf::ServerStatistics* serverStats);
     static void insertIndexEntry(Context* context,
             uint64_t tableId, uint8_t indexId,
             const void* indexKey, KeyLength indexKeyLength,
             uint64_t primaryKeyHash);
     static bool isReplicaNeeded(Context* context, ServerId serverId,
             ServerId backupServerId, uint64_t segmentId);
+    static void migrateMasterTablet(Context* context, ServerId serverId,
+            uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+            ServerId newOwnerId, uint32_t pullPartitions = 0);
     static void prepForIndexletMigration(Context* context, ServerId serverId,
             uint64_t tableId, uint8_t indexId, uint64_t backingTableId,
             const void* firstKey, uint16_t firstKeyLength,
             const void* firstNotOwnedKey, uint16_t firstNotOwnedKeyLength);
     static void prepForMigration(Context* context, ServerId serverId,
             uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash);
+    static void pullTablet(Context* context, ServerId serverId,
+            uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+            ServerId sourceId, uint32_t numPartitions);
+    static uint64_t pullTabletData(Context* context, ServerId serverId,
+            uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+            WireFormat::PullTabletData::Op op);
     static void recover(Context* context, ServerId serverId,
             uint64_t recoveryId, ServerId crashedServerId,
             uint64_t partitionId,
@@ -146,6 +157,20 @@ class GetHeadOfLogRpc : public ServerIdRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(GetHeadOfLogRpc);
 };
 
+/**
+ * Encapsulates the state of a MasterClient::getStatistics
+ * request, allowing it to execute asynchronously.
+ */
+class GetStatisticsRpc : public ServerIdRpcWrapper {
+  public:
+    GetStatisticsRpc(Context* context, ServerId serverId);
+    ~GetStatisticsRpc() {}
+    void wait(ProtoBuf::ServerStatistics* serverStats);
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(GetStatisticsRpc);
+};
+
 /**
  * Encapsulates the state of a MasterClient::insertIndexEntry
  * request, allowing it to execute asynchronously.
@@ -179,6 +204,23 @@ class IsReplicaNeededRpc : public ServerIdRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(IsReplicaNeededRpc);
 };
 
+/**
+ * Encapsulates the state of a MasterClient::migrateMasterTablet
+ * request, allowing it to execute asynchronously.
+ */
+class MigrateMasterTabletRpc : public ServerIdRpcWrapper {
+  public:
+    MigrateMasterTabletRpc(Context* context, ServerId serverId,
+            uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+            ServerId newOwnerId, uint32_t pullPartitions = 0);
+    ~MigrateMasterTabletRpc() {}
+    /// \copydoc ServerIdRpcWrapper::waitAndCheckErrors
+    void wait() {waitAndCheckErrors();}
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(MigrateMasterTabletRpc);
+};
+
 /**
  * Encapsulates the state of a MasterClient::prepForIndexletMigration
  * request, allowing it to execute asynchronously.
@@ -214,6 +256,41 @@ class PrepForMigrationRpc : public ServerIdRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(PrepForMigrationRpc);
 };
 
+/**
+ * Encapsulates the state of a MasterClient::pullTablet
+ * request, allowing it to execute asynchronously.
+ */
+class PullTabletRpc : public ServerIdRpcWrapper {
+  public:
+    PullTabletRpc(Context* context, ServerId serverId,
+            uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+            ServerId sourceId, uint32_t numPartitions);
+    ~PullTabletRpc() {}
+    /// \copydoc ServerIdRpcWrapper::waitAndCheckErrors
+    void wait() {waitAndCheckErrors();}
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(PullTabletRpc);
+};
+
+/**
+ * Encapsulates the state of a MasterClient::pullTabletData
+ * request, allowing it to execute asynchronously.
+ */
+class PullTabletDataRpc : public ServerIdRpcWrapper {
+  public:
+    PullTabletDataRpc(Context* context, ServerId serverId,
+            uint64_t tableId, uint64_t firstKeyHash, uint64_t lastKeyHash,
+            WireFormat::PullTabletData::Op op, uint64_t startBucket = 0,
+            uint64_t endBucket = 0, uint32_t maxBytes = 0,
+            Buffer* response = NULL);
+    ~PullTabletDataRpc() {}
+    WireFormat::PullTabletData::Response wait();
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(PullTabletDataRpc);
+};
+
 /**
  * Encapsulates the state of a MasterClient::receiveMigrationData
  * request, allowing it to execute asynchronously.
@@ -180,19 +180,26 @@ class RecoveryMasterFinishedTask : public Task {
      *      then \a recoveryPartition is ignored and the tablets of
      *      the partition the recovery master was supposed to recover
      *      are left marked RECOVERING.
+     * \param replayOnly
+     *      If true the recovery master has only replayed the tablets in
+     *      \a recoveryPartition and is asking to serve reads for them
+     *      until it finishes recovery (see recoveryMasterReplayed);
+     *      \a successful is ignored.
      */
     RecoveryMasterFinishedTask(MasterRecoveryManager& recoveryManager,
                                uint64_t recoveryId,
                                ServerId recoveryMasterId,
                                const ProtoBuf::RecoveryPartition&
                                      recoveryPartition,
-                               bool successful)
+                               bool successful,
+                               bool replayOnly = false)
         : Task(recoveryManager.taskQueue)
         , mgr(recoveryManager)
         , recoveryId(recoveryId)
         , recoveryMasterId(recoveryMasterId)
         , recoveryPartition(recoveryPartition)
         , successful(successful)
+        , replayOnly(replayOnly)
         , mutex()
         , taskPerformed(false)
         , performed()
@@ -219,6 +226,13 @@ class RecoveryMasterFinishedTask : public Task {
             return;
         }
 
+        if (replayOnly) {
+            performReplayed(it->second);
+            taskPerformed = true;
+            performed.notify_all();
+            return;
+        }
+
         if (successful) {
             // Update tablet map to point to new owner and mark as available.
             foreach (const auto& tablet, recoveryPartition.tablet()) {
@@ -296,6 +310,7 @@ class RecoveryMasterFinishedTask : public Task {
         } else {
             LOG(WARNING, "A recovery master failed to recover its partition");
             cancelRecoveryOnRecoveryMaster = true;
+            mgr.tableManager.cancelRecoveryReads(recoveryMasterId);
         }
 
         Recovery* recovery = it->second;
@@ -325,11 +340,50 @@ class RecoveryMasterFinishedTask : public Task {
     }
 
   PRIVATE:
+    /**
+     * The part of performTask for a replayOnly task: direct reads for the
+     * replayed tablets to the recovery master, provided it is still
+     * recovering a partition for \a recovery.
+     */
+    void performReplayed(Recovery* recovery)
+    {
+        bool assigned = false;
+        try {
+            assigned = (mgr.tracker[recoveryMasterId] == recovery);
+        } catch (const Exception& e) {
+            // The recovery master is no longer in the tracker.
+        }
+        if (!assigned) {
+            LOG(WARNING, "Recovery master %s reported replaying a partition "
+                "for recovery %lu, but isn't recovering a partition for it; "
+                "not serving reads early", recoveryMasterId.toString().c_str(),
+                recoveryId);
+            cancelRecoveryOnRecoveryMaster = true;
+            return;
+        }
+        foreach (const auto& tablet, recoveryPartition.tablet()) {
+            try {
+                mgr.tableManager.tabletReplayed(tablet.table_id(),
+                        tablet.start_key_hash(), tablet.end_key_hash(),
+                        recoveryMasterId);
+            } catch (const TableManager::NoSuchTablet& e) {
+                LOG(WARNING, "Tablet %lu, 0x%lx-0x%lx replayed by recovery "
+                    "master %s is no longer recovering; not serving reads "
+                    "early", tablet.table_id(), tablet.start_key_hash(),
+                    tablet.end_key_hash(), recoveryMasterId.toString().c_str());
+                mgr.tableManager.cancelRecoveryReads(recoveryMasterId);
+                cancelRecoveryOnRecoveryMaster = true;
+                return;
+            }
+        }
+    }
+
     MasterRecoveryManager& mgr;
     uint64_t recoveryId;
     ServerId recoveryMasterId;
     ProtoBuf::RecoveryPartition recoveryPartition;
     bool successful;
+    bool replayOnly;
 
     /**
      * Mutex to synchronize access to the #taskPerformed and
@@ -510,6 +564,7 @@ class ApplyTrackerChangesTask : public Task {
                 // but unsuccessfully.
                 recovery->recoveryMasterFinished(server.serverId, false);
                 mgr.tracker[server.serverId] = NULL;
+                mgr.tableManager.cancelRecoveryReads(server.serverId);
             }
         }
         delete this;
@@ -649,6 +704,38 @@ MasterRecoveryManager::recoveryMasterFinished(
     return shouldAbort;
 }
 
+/**
+ * Schedule the notification that a recovery master has replayed (but not
+ * finished recovering) its partition of a crashed master, and wait for it;
+ * if the recovery master is still part of the recovery, clients are
+ * directed to it for reads of the replayed tablets until the recovery of
+ * each tablet completes or the recovery master fails.
+ *
+ * \param recoveryId
+ *      Id of the recovery this recovery master is performing.
+ * \param recoveryMasterId
+ *      ServerId of the recovery master which has replayed its partition.
+ * \param recoveryPartition
+ *      Tablets the recovery master replayed. Indexlets are ignored.
+ * \return
+ *      True if the recovery master must not serve reads for the tablets
+ *      yet; false if it may begin to.
+ */
+bool
+MasterRecoveryManager::recoveryMasterReplayed(
+    uint64_t recoveryId,
+    ServerId recoveryMasterId,
+    const ProtoBuf::RecoveryPartition& recoveryPartition)
+{
+    LOG(NOTICE, "Called by masterId %s with %u replayed tablets",
+        recoveryMasterId.toString().c_str(), recoveryPartition.tablet_size());
+
+    RecoveryMasterFinishedTask task(*this, recoveryId, recoveryMasterId,
+                                    recoveryPartition, true, true);
+    task.schedule();
+    return task.wait();
+}
+
 // - private -
 
 /**
@@ -65,6 +65,10 @@ class MasterRecoveryManager : public Recovery::Owner
                                 const ProtoBuf::RecoveryPartition&
                                       recoveryPartition,
                                 bool successful);
+    bool recoveryMasterReplayed(uint64_t recoveryId,
+                                ServerId recoveryMasterId,
+                                const ProtoBuf::RecoveryPartition&
+                                      recoveryPartition);
 
     virtual void trackerChangesEnqueued();
 
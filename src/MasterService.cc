@@ -13,6 +13,10 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -202,6 +206,14 @@ MasterService::dispatch(WireFormat::Opcode opcode, Rpc* rpc)
             callHandler<WireFormat::PrepForMigration, MasterService,
                         &MasterService::prepForMigration>(rpc);
             break;
+        case WireFormat::PullTablet::opcode:
+            callHandler<WireFormat::PullTablet, MasterService,
+                        &MasterService::pullTablet>(rpc);
+            break;
+        case WireFormat::PullTabletData::opcode:
+            callHandler<WireFormat::PullTabletData, MasterService,
+                        &MasterService::pullTabletData>(rpc);
+            break;
         case WireFormat::Read::opcode:
             callHandler<WireFormat::Read, MasterService,
                         &MasterService::read>(rpc);
@@ -454,7 +466,8 @@ MasterService::enumerate(const WireFormat::Enumerate::Request* reqHdr,
             &respHdr->tabletFirstHash, iter,
             *objectManager.getLog(),
             *objectManager.getObjectMap(),
-            *rpc->replyPayload, maxPayloadBytes);
+            *rpc->replyPayload, maxPayloadBytes,
+            objectManager.getValueCompressor());
     enumeration.complete();
     respHdr->payloadBytes = rpc->replyPayload->size()
             - downCast<uint32_t>(sizeof(*respHdr));
@@ -952,7 +965,8 @@ MasterService::migrateSingleLogEntry(
         type != LOG_ENTRY_TYPE_PREP &&
         type != LOG_ENTRY_TYPE_PREPTOMB &&
         type != LOG_ENTRY_TYPE_TXDECISION &&
-        type != LOG_ENTRY_TYPE_TXPLIST)
+        type != LOG_ENTRY_TYPE_TXPLIST &&
+        type != LOG_ENTRY_TYPE_VALUEDICT)
     {
         // We aren't interested in any other types.
         TEST_LOG("Ignoring log entry type %s",
@@ -998,6 +1012,11 @@ MasterService::migrateSingleLogEntry(
                 continue;
             break;
         }
+    } else if (type == LOG_ENTRY_TYPE_VALUEDICT) {
+        // Any of the table's objects may need the dictionary.
+        entryTableId = buffer.getStart<ValueCompressor::DictionaryHeader>()
+                        ->tableId;
+        entryKeyHash = firstKeyHash;
     }
 
     // Skip if not applicable.
@@ -1115,6 +1134,61 @@ MasterService::migrateTablet(const WireFormat::MigrateTablet::Request* reqHdr,
         return;
     }
 
+    if (reqHdr->pullPartitions != 0) {
+        // Let the receiver drive the migration: it pulls the data out of
+        // our hash table, then takes ownership (see pullTablet).
+        LOG(NOTICE, "Asking %s to pull tablet [0x%lx,0x%lx] in tableId %lu "
+                "using %u partitions",
+                context->serverList->toString(receiver).c_str(),
+                firstKeyHash, lastKeyHash, tableId, reqHdr->pullPartitions);
+        try {
+            MasterClient::pullTablet(context, receiver, tableId,
+                    firstKeyHash, lastKeyHash, serverId,
+                    reqHdr->pullPartitions);
+        } catch (const ServerNotUpException& e) {
+            // The receiver crashed, perhaps leaving the tablet frozen here.
+            // The coordinator knows whether it took ownership first.
+            ProtoBuf::TableConfig config;
+            CoordinatorClient::getTableConfig(context, tableId, &config);
+            bool stillOwner = false;
+            foreach (const ProtoBuf::TableConfig::Tablet& tablet,
+                    config.tablet()) {
+                if (tablet.start_key_hash() == firstKeyHash &&
+                        tablet.end_key_hash() == lastKeyHash &&
+                        tablet.server_id() == serverId.getId()) {
+                    stillOwner = true;
+                }
+            }
+            if (stillOwner) {
+                LOG(WARNING, "%s crashed while pulling tablet [0x%lx,0x%lx] "
+                        "in tableId %lu; resuming service of the tablet",
+                        context->serverList->toString(receiver).c_str(),
+                        firstKeyHash, lastKeyHash, tableId);
+                TabletManager::Tablet tablet;
+                if (tabletManager.getTablet(tableId, firstKeyHash,
+                        lastKeyHash, &tablet) &&
+                        tablet.state != TabletManager::NORMAL) {
+                    tabletManager.changeState(tableId, firstKeyHash,
+                            lastKeyHash, tablet.state, TabletManager::NORMAL);
+                }
+            } else {
+                LOG(WARNING, "%s crashed after pulling tablet [0x%lx,0x%lx] "
+                        "in tableId %lu; dropping the tablet",
+                        context->serverList->toString(receiver).c_str(),
+                        firstKeyHash, lastKeyHash, tableId);
+                if (tabletManager.deleteTablet(tableId, firstKeyHash,
+                        lastKeyHash)) {
+                    TableStats::deleteKeyHashRange(&masterTableMetadata,
+                            tableId, firstKeyHash, lastKeyHash);
+                }
+                objectManager.removeOrphanedObjects();
+                transactionManager.removeOrphanedOps();
+            }
+            throw;
+        }
+        return;
+    }
+
     // The last two arguments to prepForMigration() are to hint at how much data
     // would be migrated to the new master, giving it the ability to reject if
     // it didn't have sufficient resources. But at the time of writing this code
@@ -1705,6 +1779,594 @@ MasterService::prepForMigration(
     }
 }
 
+namespace MasterServiceInternal {
+/// Number of PULL_TABLET_DATA requests for data that MasterService::pullTablet
+/// keeps outstanding at once (each one is for a different partition).
+static const uint32_t MAX_PULLS_IN_FLIGHT = 8;
+
+/// Upper limit on the number of threads MasterService::pullTablet uses to
+/// replay pulled data.
+static const uint32_t MAX_PULL_REPLAY_THREADS = 4;
+
+/// Approximate number of bytes of objects returned by each PULL_TABLET_DATA
+/// request.
+static const uint32_t PULL_BYTES_PER_RPC = 1024 * 1024;
+
+/// MasterService::pullTablet stops issuing new requests while this many
+/// pulled segments are waiting to be replayed.
+static const uint32_t MAX_PULL_REPLAY_BACKLOG = 4 * MAX_PULLS_IN_FLIGHT;
+
+/**
+ * Each object of this class is responsible for pulling the objects in one
+ * partition (a contiguous range of hash table buckets) of a tablet from the
+ * tablet's previous owner, one PULL_TABLET_DATA request at a time.
+ */
+class PullTask {
+  PUBLIC:
+    PullTask(Context* context, ServerId sourceId, uint64_t tableId,
+             uint64_t firstKeyHash, uint64_t lastKeyHash, uint64_t partition,
+             uint64_t startBucket, uint64_t endBucket)
+        : context(context)
+        , sourceId(sourceId)
+        , tableId(tableId)
+        , firstKeyHash(firstKeyHash)
+        , lastKeyHash(lastKeyHash)
+        , partition(partition)
+        , nextBucket(startBucket)
+        , endBucket(endBucket)
+        , response()
+        , rpc()
+    {
+        send();
+    }
+
+    /// Request the next batch of objects in the partition, starting at
+    /// nextBucket.
+    void send() {
+        response.reset(new Buffer());
+        rpc.construct(context, sourceId, tableId, firstKeyHash, lastKeyHash,
+                WireFormat::PullTabletData::PULL, nextBucket, endBucket,
+                PULL_BYTES_PER_RPC, response.get());
+    }
+
+    Context* context;
+    ServerId sourceId;
+    uint64_t tableId;
+    uint64_t firstKeyHash;
+    uint64_t lastKeyHash;
+    uint64_t partition;
+
+    /// First bucket in the partition that hasn't been pulled yet.
+    uint64_t nextBucket;
+
+    /// 1 + the last bucket in the partition.
+    uint64_t endBucket;
+
+    /// Holds the response to rpc; ownership passes to the PullReplayer
+    /// once the response has arrived.
+    std::unique_ptr<Buffer> response;
+    Tub<PullTabletDataRpc> rpc;
+    DISALLOW_COPY_AND_ASSIGN(PullTask);
+};
+
+/**
+ * Replays segments pulled by MasterService::pullTablet on a few threads of
+ * its own, so that pulling and replaying overlap and replay isn't limited
+ * to a single core. Each partition is always replayed by the same thread,
+ * in the order its segments were pulled; once the last segment of a
+ * partition has been replayed, the thread's side log is committed.
+ */
+class PullReplayer {
+  PUBLIC:
+    PullReplayer(MasterService* service, uint64_t tableId,
+                 uint64_t firstKeyHash, uint32_t numThreads)
+        : service(service)
+        , tableId(tableId)
+        , firstKeyHash(firstKeyHash)
+        , mutex()
+        , workAvailable()
+        , queues(numThreads)
+        , threads()
+        , backlog(0)
+        , finished(false)
+        , failed(false)
+    {
+        for (uint32_t i = 0; i < numThreads; i++) {
+            threads.emplace_back(&PullReplayer::replayMain, this, i);
+        }
+    }
+
+    ~PullReplayer()
+    {
+        finish();
+    }
+
+    /**
+     * Arrange for a pulled segment to be replayed.
+     *
+     * \param partition
+     *      Partition the segment's objects came from.
+     * \param segment
+     *      Holds the segment; the replayer takes ownership of it.
+     * \param header
+     *      Response header for the PULL_TABLET_DATA request that returned
+     *      the segment.
+     * \param lastInPartition
+     *      True means this is the last segment for partition.
+     */
+    void enqueue(uint64_t partition, Buffer* segment,
+            const WireFormat::PullTabletData::Response& header,
+            bool lastInPartition)
+    {
+        std::lock_guard<std::mutex> _(mutex);
+        queues[partition % queues.size()].emplace_back(partition, segment,
+                header.segmentBytes, header.certificate, lastInPartition);
+        backlog++;
+        workAvailable.notify_all();
+    }
+
+    /// Returns the number of pulled segments that haven't been replayed yet.
+    uint32_t getBacklog()
+    {
+        std::lock_guard<std::mutex> _(mutex);
+        return backlog;
+    }
+
+    /**
+     * Wait for all enqueued segments to be replayed, then stop the replay
+     * threads.
+     *
+     * \return
+     *      False means that some segment couldn't be replayed (the error
+     *      has been logged).
+     */
+    bool finish()
+    {
+        {
+            std::lock_guard<std::mutex> _(mutex);
+            finished = true;
+            workAvailable.notify_all();
+        }
+        foreach (std::thread& thread, threads) {
+            if (thread.joinable())
+                thread.join();
+        }
+        return !failed;
+    }
+
+  PRIVATE:
+    /// Describes one segment waiting to be replayed.
+    struct Item {
+        Item()
+            : partition()
+            , segment()
+            , segmentBytes()
+            , certificate()
+            , lastInPartition()
+        {}
+        Item(uint64_t partition, Buffer* segment, uint32_t segmentBytes,
+             const SegmentCertificate& certificate, bool lastInPartition)
+            : partition(partition)
+            , segment(segment)
+            , segmentBytes(segmentBytes)
+            , certificate(certificate)
+            , lastInPartition(lastInPartition)
+        {}
+        uint64_t partition;
+        Buffer* segment;
+        uint32_t segmentBytes;
+        SegmentCertificate certificate;
+        bool lastInPartition;
+    };
+
+    /**
+     * Main loop for a replay thread.
+     *
+     * \param index
+     *      Identifies the thread's queue in queues.
+     */
+    void replayMain(uint32_t index)
+    {
+        SideLog sideLog(service->objectManager.getLog());
+        while (true) {
+            Item item;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                while (queues[index].empty() && !finished) {
+                    workAvailable.wait(lock);
+                }
+                if (queues[index].empty())
+                    break;
+                item = queues[index].front();
+                queues[index].pop_front();
+            }
+            try {
+                if (item.segmentBytes != 0) {
+                    SegmentIterator it(item.segment->getRange(0,
+                            item.segmentBytes), item.segmentBytes,
+                            item.certificate);
+                    it.checkMetadataIntegrity();
+                    service->objectManager.replaySegment(&sideLog, it);
+                }
+                if (item.lastInPartition) {
+                    sideLog.commit();
+                }
+            } catch (Exception& e) {
+                LOG(ERROR, "Couldn't replay data pulled for partition %lu "
+                        "of tablet [0x%lx,??] in tableId %lu: %s",
+                        item.partition, firstKeyHash, tableId,
+                        e.what());
+                failed = true;
+            }
+            delete item.segment;
+            std::lock_guard<std::mutex> _(mutex);
+            backlog--;
+        }
+        sideLog.commit();
+    }
+
+    /// The master that is pulling the tablet.
+    MasterService* service;
+
+    /// Identifies the tablet being pulled.
+    uint64_t tableId;
+    uint64_t firstKeyHash;
+
+    /// Protects all of the variables below.
+    std::mutex mutex;
+
+    /// Signaled whenever something is added to a queue, and by finish().
+    std::condition_variable workAvailable;
+
+    /// One queue of segments waiting to be replayed for each thread.
+    std::vector<std::deque<Item>> queues;
+
+    /// The replay threads.
+    std::vector<std::thread> threads;
+
+    /// Total number of items in all of the queues, plus those being
+    /// replayed.
+    uint32_t backlog;
+
+    /// Set by finish(): threads exit once their queues are empty.
+    bool finished;
+
+    /// Set if any segment couldn't be replayed; only read after the
+    /// threads have exited.
+    bool failed;
+
+    DISALLOW_COPY_AND_ASSIGN(PullReplayer);
+};
+} // namespace MasterServiceInternal
+
+/**
+ * Top-level server method to handle the PULL_TABLET request.
+ *
+ * This method is invoked by the current owner of a tablet to migrate the
+ * tablet to us by pulling. Rather than having the owner scan its log and
+ * push the data to us, we block writes to the tablet at its owner and pull
+ * its live objects out of the owner's hash table, in several partitions in
+ * parallel, replaying them on several threads. Ownership of the tablet
+ * moves to us only once all of the data has been replayed and committed
+ * to our log. Until then the owner keeps serving reads of the tablet,
+ * whose data can't change, while clients that try to write it are asked
+ * to retry; reads are blocked only for the short time it takes the
+ * coordinator to hand the tablet over. If either master fails during the
+ * pull, nothing has been lost and the pull can simply be abandoned.
+ *
+ * \copydetails Service::ping
+ */
+void
+MasterService::pullTablet(const WireFormat::PullTablet::Request* reqHdr,
+        WireFormat::PullTablet::Response* respHdr,
+        Rpc* rpc)
+{
+    uint64_t tableId = reqHdr->tableId;
+    uint64_t firstKeyHash = reqHdr->firstKeyHash;
+    uint64_t lastKeyHash = reqHdr->lastKeyHash;
+    ServerId sourceId(reqHdr->sourceServerId);
+    uint32_t numPartitions = std::max(reqHdr->numPartitions, 1u);
+
+    bool added = tabletManager.addTablet(tableId, firstKeyHash, lastKeyHash,
+            TabletManager::NOT_READY);
+    if (!added) {
+        LOG(WARNING, "Can't pull tablet [0x%lx,0x%lx] in tableId %lu: it "
+                "overlaps a tablet we already have",
+                firstKeyHash, lastKeyHash, tableId);
+        respHdr->common.status = STATUS_OBJECT_EXISTS;
+        return;
+    }
+    TableStats::addKeyHashRange(&masterTableMetadata, tableId,
+            firstKeyHash, lastKeyHash);
+
+    // Block writes to the tablet at its current owner, pull all of its
+    // data, and only then take ownership of it. Any failure along the way
+    // leaves the tablet with its current owner: undo everything we've done
+    // and tell the owner to resume serving the tablet normally.
+    bool frozen = false;
+    uint64_t totalBytes = 0;
+    try {
+        uint64_t numBuckets = MasterClient::pullTabletData(context, sourceId,
+                tableId, firstKeyHash, lastKeyHash,
+                WireFormat::PullTabletData::BEGIN);
+        frozen = true;
+
+        // Pulled objects are written to side logs whose segments are
+        // allocated after this point, so recovery of the tablet can ignore
+        // everything in our log before the new head.
+        LogPosition head = objectManager.getLog()->rollHeadOver();
+        totalBytes = pullTabletPartitions(tableId, firstKeyHash, lastKeyHash,
+                sourceId, numBuckets, numPartitions);
+
+        // Once the coordinator hands the tablet over we may accept writes,
+        // so the owner must stop serving (soon to be stale) reads first.
+        MasterClient::pullTabletData(context, sourceId, tableId,
+                firstKeyHash, lastKeyHash, WireFormat::PullTabletData::LOCK);
+        CoordinatorClient::reassignTabletOwnership(context, tableId,
+                firstKeyHash, lastKeyHash, serverId, head.getSegmentId(),
+                head.getSegmentOffset());
+    } catch (ClientException& e) {
+        LOG(WARNING, "Couldn't pull tablet [0x%lx,0x%lx] in tableId %lu "
+                "from %s: %s", firstKeyHash, lastKeyHash, tableId,
+                context->serverList->toString(sourceId).c_str(), e.what());
+        tabletManager.deleteTablet(tableId, firstKeyHash, lastKeyHash);
+        TableStats::deleteKeyHashRange(&masterTableMetadata, tableId,
+                firstKeyHash, lastKeyHash);
+
+        // Get rid of any objects that were replayed before the failure.
+        objectManager.removeOrphanedObjects();
+        if (frozen) {
+            try {
+                MasterClient::pullTabletData(context, sourceId, tableId,
+                        firstKeyHash, lastKeyHash,
+                        WireFormat::PullTabletData::ABORT);
+            } catch (ClientException& e2) {
+                // The source has crashed (or the tablet has gone away
+                // some other way); recovery takes care of the tablet.
+                LOG(WARNING, "Couldn't abort pull of tablet [0x%lx,0x%lx] "
+                        "in tableId %lu at %s: %s", firstKeyHash,
+                        lastKeyHash, tableId,
+                        context->serverList->toString(sourceId).c_str(),
+                        e2.what());
+            }
+        }
+        throw;
+    }
+
+    // We own the tablet now; the source just needs to drop its copy. If it
+    // has crashed in the meantime, its recovery won't include the tablet.
+    try {
+        MasterClient::pullTabletData(context, sourceId, tableId, firstKeyHash,
+                lastKeyHash, WireFormat::PullTabletData::END);
+    } catch (ClientException& e) {
+        LOG(WARNING, "Couldn't tell %s that tablet [0x%lx,0x%lx] in "
+                "tableId %lu has been pulled: %s",
+                context->serverList->toString(sourceId).c_str(),
+                firstKeyHash, lastKeyHash, tableId, e.what());
+    }
+    LOG(NOTICE, "Pulled tablet [0x%lx,0x%lx] in tableId %lu from %s; "
+            "%lu bytes in total", firstKeyHash, lastKeyHash, tableId,
+            context->serverList->toString(sourceId).c_str(), totalBytes);
+}
+
+/**
+ * This method does most of the work of pullTablet: it pulls all of the
+ * live objects in a (frozen) tablet from its current owner and replays
+ * them into side logs, which are committed before it returns.
+ *
+ * \param tableId
+ *      Identifier for the table.
+ * \param firstKeyHash
+ *      Lowest key hash in the tablet range.
+ * \param lastKeyHash
+ *      Highest key hash in the tablet range.
+ * \param sourceId
+ *      The tablet's current owner.
+ * \param numBuckets
+ *      Number of buckets in the source's hash table.
+ * \param numPartitions
+ *      Divide the source's hash table into this many ranges of buckets,
+ *      which are pulled in parallel.
+ * \return
+ *      The total number of bytes of objects pulled.
+ * \throw ClientException
+ *      Some of the data couldn't be pulled or replayed. Any requests still
+ *      outstanding have been cancelled and the replay threads have exited,
+ *      but objects that were already replayed remain in the hash table.
+ */
+uint64_t
+MasterService::pullTabletPartitions(uint64_t tableId, uint64_t firstKeyHash,
+        uint64_t lastKeyHash, ServerId sourceId, uint64_t numBuckets,
+        uint32_t numPartitions)
+{
+    using MasterServiceInternal::PullReplayer;
+    using MasterServiceInternal::PullTask;
+
+    // replaySegment requires that tombstones not be removed from the hash
+    // table while it runs.
+    ObjectManager::TombstoneProtector protector(&objectManager);
+
+    uint64_t bucketsPerPartition = std::max(
+            (numBuckets + numPartitions - 1) / numPartitions, uint64_t(1));
+    uint64_t partitions = (numBuckets + bucketsPerPartition - 1) /
+            bucketsPerPartition;
+    LOG(NOTICE, "Pulling tablet [0x%lx,0x%lx] in tableId %lu from %s in "
+            "%lu partitions", firstKeyHash, lastKeyHash, tableId,
+            context->serverList->toString(sourceId).c_str(), partitions);
+
+    CycleCounter<> pullCycles{};
+    uint64_t totalBytes = 0;
+    PullReplayer replayer(this, tableId, firstKeyHash, downCast<uint32_t>(
+            std::min(partitions, uint64_t(
+            MasterServiceInternal::MAX_PULL_REPLAY_THREADS))));
+
+    // If a request fails, the exception propagates from here: destroying
+    // the tasks cancels their outstanding requests, and destroying the
+    // replayer waits for its threads to exit.
+    Tub<PullTask> tasks[MasterServiceInternal::MAX_PULLS_IN_FLIGHT];
+    uint64_t nextPartition = 0;
+    while (true) {
+        bool active = false;
+        foreach (Tub<PullTask>& task, tasks) {
+            if (!task) {
+                if (nextPartition >= partitions)
+                    continue;
+                uint64_t start = nextPartition * bucketsPerPartition;
+                task.construct(context, sourceId, tableId, firstKeyHash,
+                        lastKeyHash, nextPartition, start,
+                        std::min(start + bucketsPerPartition, numBuckets));
+                nextPartition++;
+            }
+            active = true;
+            if (!task->rpc->isReady() || replayer.getBacklog() >=
+                    MasterServiceInternal::MAX_PULL_REPLAY_BACKLOG)
+                continue;
+            WireFormat::PullTabletData::Response header = task->rpc->wait();
+            bool last = header.nextBucket >= task->endBucket;
+            totalBytes += header.segmentBytes;
+            replayer.enqueue(task->partition, task->response.release(),
+                    header, last);
+            if (last) {
+                task.destroy();
+            } else {
+                task->nextBucket = header.nextBucket;
+                task->send();
+            }
+        }
+        if (!active)
+            break;
+    }
+    if (!replayer.finish()) {
+        throw InternalError(HERE, STATUS_INTERNAL_ERROR);
+    }
+    PerfStats::threadStats.migrationPhase1Cycles += pullCycles.stop();
+    return totalBytes;
+}
+
+/**
+ * Top-level server method to handle the PULL_TABLET_DATA request.
+ *
+ * This method is invoked by the master that is pulling one of our tablets
+ * (see pullTablet) to block writes to the tablet, fetch its objects, block
+ * reads just before ownership moves, and finally drop the tablet.
+ *
+ * \copydetails Service::ping
+ */
+void
+MasterService::pullTabletData(
+        const WireFormat::PullTabletData::Request* reqHdr,
+        WireFormat::PullTabletData::Response* respHdr,
+        Rpc* rpc)
+{
+    uint64_t tableId = reqHdr->tableId;
+    uint64_t firstKeyHash = reqHdr->firstKeyHash;
+    uint64_t lastKeyHash = reqHdr->lastKeyHash;
+
+    // Mark this request as read-only, to avoid deadlock when performing
+    // epoch-related waits below.
+    rpc->worker->rpc->activities = Transport::ServerRpc::READ_ACTIVITY;
+
+    uint64_t numBuckets = objectManager.getObjectMap()->getNumBuckets();
+    respHdr->numBuckets = numBuckets;
+
+    TabletManager::Tablet tablet;
+    if (!tabletManager.getTablet(tableId, firstKeyHash, lastKeyHash, &tablet)
+            || tablet.startKeyHash != firstKeyHash
+            || tablet.endKeyHash != lastKeyHash) {
+        LOG(WARNING, "Pull request for tablet this master does not own: "
+            "tablet [0x%lx,0x%lx] in tableId %lu", firstKeyHash, lastKeyHash,
+            tableId);
+        respHdr->common.status = STATUS_UNKNOWN_TABLET;
+        return;
+    }
+
+    switch (reqHdr->op) {
+    case WireFormat::PullTabletData::BEGIN:
+        if (!tabletManager.changeState(tableId, firstKeyHash, lastKeyHash,
+                TabletManager::NORMAL, TabletManager::LOCKED_FOR_PULL)) {
+            LOG(WARNING, "Can't start pull of tablet [0x%lx,0x%lx] in "
+                    "tableId %lu: tablet is in state %d", firstKeyHash,
+                    lastKeyHash, tableId, static_cast<int>(tablet.state));
+            respHdr->common.status = STATUS_RETRY;
+            return;
+        }
+
+        // Wait for the remainder of already running writes to finish.
+        LogProtector::wait(context, Transport::ServerRpc::APPEND_ACTIVITY);
+        LOG(NOTICE, "Froze tablet [0x%lx,0x%lx] in tableId %lu for pulling",
+                firstKeyHash, lastKeyHash, tableId);
+        break;
+
+    case WireFormat::PullTabletData::LOCK:
+        if (!tabletManager.changeState(tableId, firstKeyHash, lastKeyHash,
+                TabletManager::LOCKED_FOR_PULL,
+                TabletManager::LOCKED_FOR_MIGRATION)) {
+            LOG(WARNING, "Can't hand over tablet [0x%lx,0x%lx] in tableId "
+                    "%lu: tablet is in state %d", firstKeyHash,
+                    lastKeyHash, tableId, static_cast<int>(tablet.state));
+            respHdr->common.status = STATUS_INTERNAL_ERROR;
+            return;
+        }
+        break;
+
+    case WireFormat::PullTabletData::PULL: {
+        if (tablet.state == TabletManager::NORMAL) {
+            LOG(WARNING, "Pull request for tablet [0x%lx,0x%lx] in tableId "
+                    "%lu, which hasn't been frozen", firstKeyHash,
+                    lastKeyHash, tableId);
+            respHdr->common.status = STATUS_INTERNAL_ERROR;
+            return;
+        }
+
+        Segment segment;
+        respHdr->nextBucket = objectManager.copyTabletObjects(tableId,
+                firstKeyHash, lastKeyHash, reqHdr->startBucket,
+                std::min(reqHdr->endBucket, numBuckets), reqHdr->maxBytes,
+                &segment);
+        segment.close();
+        SegmentCertificate certificate;
+        uint32_t segmentBytes = segment.getAppendedLength(&certificate);
+        respHdr->segmentBytes = segmentBytes;
+        respHdr->certificate = certificate;
+
+        // The segment disappears when we return, so its contents must be
+        // copied into the response.
+        segment.copyOut(0, rpc->replyPayload->alloc(segmentBytes),
+                segmentBytes);
+        break;
+    }
+
+    case WireFormat::PullTabletData::END:
+        if (tabletManager.deleteTablet(tableId, firstKeyHash, lastKeyHash)) {
+            TableStats::deleteKeyHashRange(&masterTableMetadata, tableId,
+                    firstKeyHash, lastKeyHash);
+        }
+
+        // Ensure that the ObjectManager never returns objects from this
+        // deleted tablet again.
+        objectManager.removeOrphanedObjects();
+
+        // Removed unnecessary prepared transaction operations.
+        transactionManager.removeOrphanedOps();
+        LOG(NOTICE, "Tablet [0x%lx,0x%lx] in tableId %lu has been pulled "
+                "by its new owner", firstKeyHash, lastKeyHash, tableId);
+        break;
+
+    case WireFormat::PullTabletData::ABORT:
+        if (tablet.state != TabletManager::NORMAL) {
+            tabletManager.changeState(tableId, firstKeyHash, lastKeyHash,
+                    tablet.state, TabletManager::NORMAL);
+        }
+        LOG(NOTICE, "Pull of tablet [0x%lx,0x%lx] in tableId %lu aborted",
+                firstKeyHash, lastKeyHash, tableId);
+        break;
+
+    default:
+        respHdr->common.status = STATUS_REQUEST_FORMAT_ERROR;
+        break;
+    }
+}
+
 /**
  * Top-level server method to handle the READ request.
  *
@@ -3436,6 +4098,11 @@ MasterService::detectSegmentRecoveryFailure(
  * \param nextNodeIdMap
  *      A unordered map that keeps track of the nextNodeId in
  *      each indexlet table.
+ * \param earlyReadPartition
+ *      If non-NULL, the partition being recovered: once all of its segments
+ *      have been replayed, and before the replayed data is made durable,
+ *      this master starts serving reads for its tablets (see
+ *      startRecoveryReads).
  * \throw SegmentRecoveryFailedException
  *      If some segment was not recovered and the recovery master is not
  *      a valid replacement for the crashed master.
@@ -3443,7 +4110,8 @@ MasterService::detectSegmentRecoveryFailure(
 void
 MasterService::recover(uint64_t recoveryId, ServerId masterId,
         uint64_t partitionId, vector<Replica>& replicas,
-        std::unordered_map<uint64_t, uint64_t>& nextNodeIdMap)
+        std::unordered_map<uint64_t, uint64_t>& nextNodeIdMap,
+        const ProtoBuf::RecoveryPartition* earlyReadPartition)
 {
     /* Overview of the internals of this method and its structures.
      *
@@ -3714,6 +4382,9 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
 
     detectSegmentRecoveryFailure(masterId, partitionId, replicas);
 
+    if (earlyReadPartition != NULL)
+        startRecoveryReads(recoveryId, *earlyReadPartition);
+
     {
         CycleCounter<RawMetric> logSyncTicks(&metrics->master.logSyncTicks);
         LOG(NOTICE, "Committing the SideLog...");
@@ -3764,6 +4435,60 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
             totalSecs * 1e03, usefulSecs * 1e03, 100 * usefulSecs / totalSecs);
 }
 
+/**
+ * Helper for recover(): called once every segment of a partition has been
+ * replayed, to serve reads for its tablets while the rest of recovery
+ * (mainly re-replicating the replayed data) proceeds. Every object in the
+ * partition is now in the hash table, so reads see the same values they
+ * would after recovery. The coordinator is asked to direct reads to this
+ * master; if it agrees, the tablets move from NOT_READY to
+ * RECOVERED_READ_ONLY. Writes keep waiting until recovery completes.
+ *
+ * \param recoveryId
+ *      Id of the recovery this recovery master is performing.
+ * \param recoveryPartition
+ *      The partition that was replayed.
+ */
+void
+MasterService::startRecoveryReads(uint64_t recoveryId,
+        const ProtoBuf::RecoveryPartition& recoveryPartition)
+{
+    // Change the state before telling the coordinator, so that reads are
+    // accepted as soon as clients learn of the new location.
+    ProtoBuf::RecoveryPartition replayed;
+    foreach (const ProtoBuf::Tablets::Tablet& tablet,
+            recoveryPartition.tablet()) {
+        tabletManager.changeState(tablet.table_id(),
+                tablet.start_key_hash(), tablet.end_key_hash(),
+                TabletManager::NOT_READY, TabletManager::RECOVERED_READ_ONLY);
+        ProtoBuf::Tablets::Tablet& entry(*replayed.add_tablet());
+        entry = tablet;
+        entry.set_service_locator(config->localLocator);
+        entry.set_server_id(serverId.getId());
+    }
+
+    bool allowed = false;
+    try {
+        allowed = CoordinatorClient::recoveryMasterReplayed(context,
+                recoveryId, serverId, &replayed);
+    } catch (const ClientException& e) {
+        LOG(WARNING, "Couldn't start serving reads early for recovery %lu: "
+                "%s", recoveryId, e.what());
+    }
+    if (!allowed) {
+        foreach (const ProtoBuf::Tablets::Tablet& tablet,
+                recoveryPartition.tablet()) {
+            tabletManager.changeState(tablet.table_id(),
+                    tablet.start_key_hash(), tablet.end_key_hash(),
+                    TabletManager::RECOVERED_READ_ONLY,
+                    TabletManager::NOT_READY);
+        }
+        return;
+    }
+    LOG(NOTICE, "Serving reads for %d replayed tablets of recovery %lu",
+            replayed.tablet_size(), recoveryId);
+}
+
 /**
  * Thrown during recovery in recoverSegment when a log append fails. Caught
  * by recover() which aborts the recovery cleanly and notifies the coordinator
@@ -3863,7 +4588,8 @@ MasterService::recover(const WireFormat::Recover::Request* reqHdr,
             nextNodeIdMap[indexlet.backing_table_id()] = 0;
         }
         recover(recoveryId, crashedServerId, partitionId, replicas,
-                nextNodeIdMap);
+                nextNodeIdMap, config->master.earlyRecoveryReads ?
+                &recoveryPartition : NULL);
         // Install indexlets we are recovering
         foreach (const ProtoBuf::Indexlet& newIndexlet,
                  recoveryPartition.indexlet()) {
@@ -3939,7 +4665,11 @@ MasterService::recover(const WireFormat::Recover::Request* reqHdr,
             bool changed = tabletManager.changeState(
                     tablet.table_id(),
                     tablet.start_key_hash(), tablet.end_key_hash(),
-                    TabletManager::NOT_READY, TabletManager::NORMAL);
+                    TabletManager::NOT_READY, TabletManager::NORMAL) ||
+                tabletManager.changeState(
+                    tablet.table_id(),
+                    tablet.start_key_hash(), tablet.end_key_hash(),
+                    TabletManager::RECOVERED_READ_ONLY, TabletManager::NORMAL);
             if (!changed) {
                 throw FatalError(HERE, format("Could not change recovering "
                         "tablet's state to NORMAL (%lu range [%lu,%lu])",
@@ -49,6 +49,7 @@ namespace RAMCloud {
 
 // forward declaration
 namespace MasterServiceInternal {
+class PullReplayer;
 class RecoveryTask;
 }
 
@@ -246,6 +247,15 @@ class MasterService : public Service {
     void prepForMigration(const WireFormat::PrepForMigration::Request* reqHdr,
                 WireFormat::PrepForMigration::Response* respHdr,
                 Rpc* rpc);
+    void pullTablet(const WireFormat::PullTablet::Request* reqHdr,
+                WireFormat::PullTablet::Response* respHdr,
+                Rpc* rpc);
+    void pullTabletData(const WireFormat::PullTabletData::Request* reqHdr,
+                WireFormat::PullTabletData::Response* respHdr,
+                Rpc* rpc);
+    uint64_t pullTabletPartitions(uint64_t tableId, uint64_t firstKeyHash,
+                uint64_t lastKeyHash, ServerId sourceId, uint64_t numBuckets,
+                uint32_t numPartitions);
     void read(const WireFormat::Read::Request* reqHdr,
                 WireFormat::Read::Response* respHdr,
                 Rpc* rpc);
@@ -485,7 +495,10 @@ class MasterService : public Service {
                 ServerId masterId,
                 uint64_t partitionId,
                 vector<Replica>& replicas,
-                std::unordered_map<uint64_t, uint64_t>& nextNodeIdMap);
+                std::unordered_map<uint64_t, uint64_t>& nextNodeIdMap,
+                const ProtoBuf::RecoveryPartition* earlyReadPartition = NULL);
+    void startRecoveryReads(uint64_t recoveryId,
+                const ProtoBuf::RecoveryPartition& recoveryPartition);
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////End of Recovery related code./////////////////////////
@@ -495,6 +508,7 @@ class MasterService : public Service {
     friend void removeObjectIfFromUnknownTablet(uint64_t reference,
                 void *cookie);
     friend class RecoverSegmentBenchmark;
+    friend class MasterServiceInternal::PullReplayer;
     friend class MasterServiceInternal::RecoveryTask;
 
     DISALLOW_COPY_AND_ASSIGN(MasterService);
@@ -1365,6 +1365,37 @@ TEST_F(MasterServiceTest, migrateTablet_movingData) {
     EXPECT_LT(ctimeCoord, master2HeadPositionAfter);
 }
 
+TEST_F(MasterServiceTest, migrateTablet_pullingData) {
+    ramcloud->createTable("migrationTable");
+    uint64_t tbl = ramcloud->getTableId("migrationTable");
+    ramcloud->write(tbl, "hi", 2, "abcdefg", 7);
+    ramcloud->write(tbl, "there", 5, "hijk", 4);
+    ramcloud->remove(tbl, "hi", 2);
+
+    ServerConfig master2Config = masterConfig;
+    master2Config.master.numReplicas = 0;
+    master2Config.localLocator = "mock:host=master2";
+    Server* master2 = cluster.addServer(master2Config);
+
+    TestLog::Enable _("pullTablet", NULL);
+    ramcloud->migrateTablet(tbl, 0, -1, master2->serverId, 4);
+    EXPECT_TRUE(TestUtil::contains(TestLog::get(),
+            "pullTablet: Pulled tablet [0x0,0xffffffffffffffff] "
+            "in tableId 1"));
+    EXPECT_FALSE(service->tabletManager.getTablet(tbl, 0, ~0UL));
+    TabletManager::Tablet tablet;
+    EXPECT_TRUE(master2->master->tabletManager.getTablet(tbl, 0, ~0UL,
+            &tablet));
+    EXPECT_EQ(TabletManager::NORMAL, tablet.state);
+
+    // Only live objects move.
+    Buffer value;
+    ramcloud->read(tbl, "there", 5, &value);
+    EXPECT_EQ("hijk", TestUtil::toString(&value));
+    EXPECT_THROW(ramcloud->read(tbl, "hi", 2, &value),
+            ObjectDoesntExistException);
+}
+
 TEST_F(MasterServiceTest, multiIncrement_basics) {
     uint64_t tableId1 = ramcloud->createTable("table1");
 
@@ -1853,6 +1884,104 @@ TEST_F(MasterServiceTest, prepForIndexletMigration) {
     EXPECT_EQ(IndexletManager::Indexlet::RECOVERING, indexlet->state);
 }
 
+TEST_F(MasterServiceTest, pullTablet_overlap) {
+    service->tabletManager.addTablet(5, 27, 873, TabletManager::NORMAL);
+    TestLog::Enable _("pullTablet");
+    EXPECT_THROW(MasterClient::pullTablet(&context, masterServer->serverId,
+            5, 0, 100, ServerId(99), 4), ObjectExistsException);
+    EXPECT_EQ("pullTablet: Can't pull tablet [0x0,0x64] in tableId 5: it "
+            "overlaps a tablet we already have", TestLog::get());
+}
+
+TEST_F(MasterServiceTest, pullTablet_ownershipTransferFails) {
+    ServerConfig master2Config = masterConfig;
+    master2Config.localLocator = "mock:host=master2";
+    Server* master2 = cluster.addServer(master2Config);
+
+    // The coordinator doesn't know about this tablet, so it refuses to
+    // reassign it once all of its data has been pulled.
+    service->tabletManager.addTablet(99, 0, ~0UL, TabletManager::NORMAL);
+    TestLog::Enable _("pullTablet", "pullTabletData", NULL);
+    EXPECT_THROW(MasterClient::pullTablet(&context, master2->serverId,
+            99, 0, ~0UL, masterServer->serverId, 4),
+            TableDoesntExistException);
+    EXPECT_TRUE(TestUtil::contains(TestLog::get(),
+            "pullTablet: Couldn't pull tablet [0x0,0xffffffffffffffff] "
+            "in tableId 99"));
+    EXPECT_TRUE(TestUtil::contains(TestLog::get(),
+            "pullTabletData: Pull of tablet [0x0,0xffffffffffffffff] in "
+            "tableId 99 aborted"));
+    EXPECT_FALSE(master2->master->tabletManager.getTablet(99, 0, ~0UL));
+    EXPECT_TRUE(master2->master->masterTableMetadata.find(99) == NULL);
+    TabletManager::Tablet tablet;
+    EXPECT_TRUE(service->tabletManager.getTablet(99, 0, ~0UL, &tablet));
+    EXPECT_EQ(TabletManager::NORMAL, tablet.state);
+}
+
+TEST_F(MasterServiceTest, pullTablet_sourceDoesntHaveTablet) {
+    ServerConfig master2Config = masterConfig;
+    master2Config.localLocator = "mock:host=master2";
+    Server* master2 = cluster.addServer(master2Config);
+
+    EXPECT_THROW(MasterClient::pullTablet(&context, master2->serverId,
+            5, 0, 100, masterServer->serverId, 4), UnknownTabletException);
+    EXPECT_FALSE(master2->master->tabletManager.getTablet(5, 0, 100));
+    EXPECT_TRUE(master2->master->masterTableMetadata.find(5) == NULL);
+}
+
+TEST_F(MasterServiceTest, pullTabletData_beginPullLockAndAbort) {
+    uint64_t tbl = ramcloud->createTable("table");
+    ramcloud->write(tbl, "a", 1, "value", 5);
+    TabletManager::Tablet tablet;
+
+    // Can't pull before the tablet is frozen.
+    EXPECT_THROW(PullTabletDataRpc(&context, masterServer->serverId, tbl,
+            0, ~0UL, WireFormat::PullTabletData::PULL, 0, 1).wait(),
+            InternalError);
+
+    uint64_t numBuckets = MasterClient::pullTabletData(&context,
+            masterServer->serverId, tbl, 0, ~0UL,
+            WireFormat::PullTabletData::BEGIN);
+    EXPECT_EQ(service->objectManager.getObjectMap()->getNumBuckets(),
+            numBuckets);
+    EXPECT_TRUE(service->tabletManager.getTablet(tbl, 0, ~0UL, &tablet));
+    EXPECT_EQ(TabletManager::LOCKED_FOR_PULL, tablet.state);
+
+    // The tablet can still be read while it's being pulled.
+    Buffer value;
+    ramcloud->read(tbl, "a", 1, &value);
+    EXPECT_EQ("value", TestUtil::toString(&value));
+
+    Buffer response;
+    PullTabletDataRpc rpc(&context, masterServer->serverId, tbl, 0, ~0UL,
+            WireFormat::PullTabletData::PULL, 0, numBuckets, 1000, &response);
+    WireFormat::PullTabletData::Response header = rpc.wait();
+    EXPECT_EQ(numBuckets, header.nextBucket);
+    EXPECT_EQ(header.segmentBytes, response.size());
+    SegmentIterator it(response.getRange(0, response.size()),
+            response.size(), header.certificate);
+    ASSERT_FALSE(it.isDone());
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, it.getType());
+    it.next();
+    EXPECT_TRUE(it.isDone());
+    EXPECT_TRUE(service->tabletManager.getTablet(tbl, 0, ~0UL, &tablet));
+    EXPECT_EQ(TabletManager::LOCKED_FOR_PULL, tablet.state);
+
+    // Reads stop once ownership is about to move.
+    MasterClient::pullTabletData(&context, masterServer->serverId, tbl,
+            0, ~0UL, WireFormat::PullTabletData::LOCK);
+    EXPECT_TRUE(service->tabletManager.getTablet(tbl, 0, ~0UL, &tablet));
+    EXPECT_EQ(TabletManager::LOCKED_FOR_MIGRATION, tablet.state);
+    EXPECT_THROW(MasterClient::pullTabletData(&context,
+            masterServer->serverId, tbl, 0, ~0UL,
+            WireFormat::PullTabletData::LOCK), InternalError);
+
+    MasterClient::pullTabletData(&context, masterServer->serverId, tbl,
+            0, ~0UL, WireFormat::PullTabletData::ABORT);
+    EXPECT_TRUE(service->tabletManager.getTablet(tbl, 0, ~0UL, &tablet));
+    EXPECT_EQ(TabletManager::NORMAL, tablet.state);
+}
+
 TEST_F(MasterServiceTest, readHashes) {
     // Most of the functionality for readHashes is in ObjectManager,
     // so we do extensive unit testing there.
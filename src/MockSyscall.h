@@ -39,10 +39,13 @@ class MockSyscall : public Syscall {
                     epollWaitCount(-1), epollWaitEvents(NULL),
                     epollWaitErrno(0), exitCount(0), fcntlErrno(0),
                     futexWaitErrno(0), futexWakeErrno(0), fwriteResult(~0LU),
-                    getsocknameErrno(0), ioctlErrno(0),
-                    ioctlRetriesToSuccess(0), listenErrno(0), pipeErrno(0),
+                    getsocknameErrno(0), getsockoptErrno(0), ioctlErrno(0),
+                    ioctlRetriesToSuccess(0), killErrno(0), listenErrno(0),
+                    memfdCreateErrno(0), openErrno(0), pipeErrno(0),
                     recvErrno(0), recvEof(false), recvfromErrno(0),
-                    recvfromEof(false), recvmmsgErrno(0),
+                    recvfromEof(false), recvmmsgErrno(0), recvmsgErrno(0),
+                    sendmmsgErrno(0), sendmmsgCount(0),
+                    sendmmsgReturnCount(-1),
                     sendmsgErrno(0), sendmsgReturnCount(-1),
                     sendtoErrno(0), sendtoReturnCount(-1), setsockoptErrno(0),
                     socketErrno(0), writeErrno(0) {}
@@ -180,6 +183,16 @@ class MockSyscall : public Syscall {
         return -1;
     }
 
+    int getsockoptErrno;
+    int getsockopt(int sockfd, int level, int optname, void *optval,
+                    socklen_t *optlen) {
+        if (getsockoptErrno == 0) {
+            return ::getsockopt(sockfd, level, optname, optval, optlen);
+        }
+        errno = getsockoptErrno;
+        return -1;
+    }
+
     int ioctlErrno;
     int ioctlRetriesToSuccess;
     int ioctl(int fd, int reqType, void* request) {
@@ -198,6 +211,15 @@ class MockSyscall : public Syscall {
         }
     }
 
+    int killErrno;
+    int kill(pid_t pid, int sig) {
+        if (killErrno == 0) {
+            return ::kill(pid, sig);
+        }
+        errno = killErrno;
+        return -1;
+    }
+
     int listenErrno;
     int listen(int sockfd, int backlog) {
         if (listenErrno == 0) {
@@ -207,6 +229,26 @@ class MockSyscall : public Syscall {
         return -1;
     }
 
+    int memfdCreateErrno;
+    int memfdCreate(const char* name, unsigned int flags) {
+        if (memfdCreateErrno == 0) {
+            return static_cast<int>(::syscall(SYS_memfd_create, name, flags));
+        }
+        errno = memfdCreateErrno;
+        memfdCreateErrno = 0;
+        return -1;
+    }
+
+    int openErrno;
+    int open(const char* pathname, int flags) {
+        if (openErrno == 0) {
+            return ::open(pathname, flags);
+        }
+        errno = openErrno;
+        openErrno = 0;
+        return -1;
+    }
+
     int pipeErrno;
     int pipe(int fds[2]) {
         if (pipeErrno == 0) {
@@ -255,6 +297,34 @@ class MockSyscall : public Syscall {
 
     }
 
+    int recvmsgErrno;
+    ssize_t recvmsg(int sockfd, msghdr *msg, int flags) {
+        if (recvmsgErrno == 0) {
+            return ::recvmsg(sockfd, msg, flags);
+        }
+        errno = recvmsgErrno;
+        return -1;
+    }
+
+    int sendmmsgErrno;
+    int sendmmsgCount;
+    int sendmmsgReturnCount;
+    int sendmmsg(int sockfd, struct mmsghdr *msgvec, unsigned int vlen,
+            int flags) {
+        sendmmsgCount++;
+        if (sendmmsgErrno != 0) {
+            errno = sendmmsgErrno;
+            sendmmsgErrno = 0;
+            return -1;
+        } else if (sendmmsgReturnCount >= 0) {
+            // Simulates sending only some of the messages.
+            int result = sendmmsgReturnCount;
+            sendmmsgReturnCount = -1;
+            return ::sendmmsg(sockfd, msgvec, result, flags);
+        }
+        return ::sendmmsg(sockfd, msgvec, vlen, flags);
+    }
+
     int sendmsgErrno;
     int sendmsgReturnCount;
     ssize_t sendmsg(int sockfd, const msghdr *msg, int flags) {
@@ -86,6 +86,7 @@ class MockWrapper : public Transport::RpcNotifier {
         if (request.size() < sizeof(WireFormat::RequestCommon)) {
             request.reset();
             header = request.emplaceAppend<WireFormat::RequestCommon>();
+            header->traceId = 0;
         } else {
             header = const_cast<WireFormat::RequestCommon*>(
                     request.getStart<WireFormat::RequestCommon>());
@@ -19,6 +19,9 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
+#if ENABLE_LZ4
+#include <lz4.h>
+#endif
 
 #include "MultiFileStorage.h"
 #include "BackupMasterRecovery.h"
@@ -92,6 +95,8 @@ MultiFileStorage::Frame::Frame(MultiFileStorage* storage, size_t frameIndex)
     , committedMetadataVersion(0)
     , loadRequested(false)
     , performingIo(false)
+    , storedLength(0)
+    , checkForCompression(false)
     , epoch(1)
     , scheduledInEpoch(0)
     , testingHadToWaitForBufferOnLoad(false)
@@ -241,7 +246,8 @@ MultiFileStorage::Frame::isLoaded()
  * loaded from storage into memory. If the replica is already in memory a load
  * from disk is avoided. If the replica buffer is dirty this call blocks until
  * all data has been flushed to disk to ensure that recoveries only use durable
- * data.
+ * data. If the replica was stored compressed, it is decompressed by the
+ * calling thread.
  *
  * After this call the start of new appends to this frame are rejected until
  * this frame is recycled for use with another replica (via open()).
@@ -260,6 +266,10 @@ MultiFileStorage::Frame::load()
             testingHadToWaitForSyncOnLoad = true;
             continue;
         }
+        if (performingIo)
+            continue;
+        if (checkForCompression)
+            decompress(lock);
         return buffer.get();
     }
 }
@@ -275,6 +285,7 @@ MultiFileStorage::Frame::unload()
     Lock lock(storage->mutex);
     assert(loadRequested);
     buffer.reset();
+    checkForCompression = false;
     loadRequested = false;
 }
 
@@ -353,6 +364,7 @@ MultiFileStorage::Frame::append(Buffer& source,
     // situations where older data could get rewritten, such as a delayed
     // RPC or RAM-573).
     if ((destinationOffset + length) > appendedLength) {
+        storage->queuedBytes += destinationOffset + length - appendedLength;
         appendedLength = destinationOffset + length;
     }
 
@@ -365,7 +377,7 @@ MultiFileStorage::Frame::append(Buffer& source,
     if (!isSynced()) {
         if (sync) {
             performWrite(lock);
-        } else {
+        } else if (!storage->compressReplicas) {
             schedule(lock, LOW);
         }
     }
@@ -452,6 +464,7 @@ MultiFileStorage::Frame::free()
     deschedule();
     if (!isSynced())
         CycleCounter<RawMetric> _(&metrics->backup.uncommittedFramesFreed);
+    storage->queuedBytes -= unsyncedLength();
     isOpen = false;
     isClosed = false;
     // Must reset this before open(), because on startup after benchmark, the
@@ -474,8 +487,11 @@ MultiFileStorage::Frame::free()
             isWriteBuffer = false;
         }
     }
+    storedLength = 0;
+    checkForCompression = false;
 
     storage->freeMap[frameIndex] = 1;
+    storage->setFrameIndexEntry(frameIndex, FRAME_FREE);
 }
 
 // See BackupStorage.h for documentation.
@@ -486,8 +502,13 @@ MultiFileStorage::Frame::reopen(size_t length)
     load();
 
     Lock _(storage->mutex);
+    storage->queuedBytes -= unsyncedLength();
     appendedLength = length;
-    committedLength = length;
+    // A replica stored compressed must be rewritten as is before anything
+    // can be appended to it.
+    committedLength = storedLength == 0 ? length : 0;
+    storage->queuedBytes += unsyncedLength();
+    storedLength = 0;
     isOpen = true;
     isClosed = false;
     loadRequested = false;
@@ -495,6 +516,10 @@ MultiFileStorage::Frame::reopen(size_t length)
         isWriteBuffer = true;
         storage->writeBuffersInUse++;
     }
+
+    // The frame index may still describe the replica as closed; after a
+    // restart its metadata must be read from the frame again.
+    storage->setFrameIndexEntry(frameIndex, FRAME_OPEN);
 }
 
 // - private -
@@ -544,6 +569,9 @@ MultiFileStorage::Frame::open(bool sync, ServerId masterId, uint64_t segmentId)
     appendedMetadataVersion = 0;
     committedMetadataVersion = 0;
     loadRequested = false;
+    storedLength = 0;
+    checkForCompression = false;
+    storage->setFrameIndexEntry(frameIndex, FRAME_OPEN);
 }
 
 /**
@@ -556,6 +584,9 @@ MultiFileStorage::Frame::open(bool sync, ServerId masterId, uint64_t segmentId)
  * \param buf
  *     Pointer to the buffer that the Frame's data will be written to. Must
  *     be large enough to hold an entire segment.
+ * \param count
+ *     Number of bytes to read from the start of the frame; must be a
+ *     multiple of BLOCK_SIZE, or the size of the whole frame.
  * \param frameIndex
  *     Identifies which Frame to fetch from disk.
  * \param usingDevNull
@@ -563,8 +594,8 @@ MultiFileStorage::Frame::open(bool sync, ServerId masterId, uint64_t segmentId)
  *     reads cause the method to DIE.
  */
 void
-MultiFileStorage::unlockedRead(Frame::Lock& lock, void* buf, size_t frameIndex,
-                               bool usingDevNull)
+MultiFileStorage::unlockedRead(Frame::Lock& lock, void* buf, size_t count,
+                               size_t frameIndex, bool usingDevNull)
 {
     lock.unlock();
     CycleCounter<RawMetric> _(&metrics->backup.storageReadTicks);
@@ -576,18 +607,21 @@ MultiFileStorage::unlockedRead(Frame::Lock& lock, void* buf, size_t frameIndex,
     // Linux documentation recommends clearing control blocks before use.
     memset(cbs, 0, sizeof(struct aiocb) * fds.size());
     size_t frameletStart = offsetOfFramelet(frameIndex);
-    for (size_t fileIndex = 0; fileIndex < fds.size(); fileIndex++) {
-        size_t frameletSize = bytesInFramelet(fileIndex);
-        struct aiocb* cb = &cbs[fileIndex];
-        cb->aio_fildes = fds[fileIndex];
+    size_t files = 0;
+    for (size_t remaining = count; remaining > 0 && files < fds.size(); ) {
+        size_t bytesToRead = std::min(bytesInFramelet(files), remaining);
+        struct aiocb* cb = &cbs[files];
+        cb->aio_fildes = fds[files];
         cb->aio_offset = frameletStart;
-        cb->aio_buf = static_cast<char*>(buf) + (frameletSize * fileIndex);
-        cb->aio_nbytes = frameletSize;
+        cb->aio_buf = static_cast<char*>(buf) + (count - remaining);
+        cb->aio_nbytes = bytesToRead;
         aio_read(cb);
+        remaining -= bytesToRead;
+        files++;
     }
 
     // Wait for all of the IO operations to complete.
-    for (size_t i = 0; i < fds.size(); i++) {
+    for (size_t i = 0; i < files; i++) {
         struct aiocb* cb = &cbs[i];
         aio_suspend(&cb, 1, NULL);
         ssize_t r = aio_return(cb);
@@ -731,6 +765,13 @@ MultiFileStorage::unlockedWrite(Frame::Lock& lock, void* buf, size_t count,
     metrics->backup.storageWriteTicks += elapsed;
     PerfStats::threadStats.backupWriteActiveCycles += elapsed;
     lock.lock();
+
+    recentWriteBytes += count + metadataCount;
+    recentWriteCycles += elapsed;
+    if (recentWriteBytes > WRITE_BANDWIDTH_WINDOW) {
+        recentWriteBytes /= 2;
+        recentWriteCycles /= 2;
+    }
 }
 
 namespace {
@@ -769,20 +810,24 @@ MultiFileStorage::Frame::performRead(Lock& lock)
     assert(loadRequested);
     BufferPtr buffer = storage->allocateBuffer();
 
+    // Only the compressed image needs to be read, if there is one.
+    const size_t count = storedLength != 0 ? roundUp(storedLength)
+                                           : storage->segmentSize;
     if (testingSkipRealIo) {
-        TEST_LOG("count %lu frameIndex %lu", storage->segmentSize, frameIndex);
+        TEST_LOG("count %lu frameIndex %lu", count, frameIndex);
     } else {
         ++metrics->backup.storageReadCount;
-        metrics->backup.storageReadBytes += storage->segmentSize;
+        metrics->backup.storageReadBytes += count;
         ++PerfStats::threadStats.backupReadOps;
-        PerfStats::threadStats.backupReadBytes += storage->segmentSize;
+        PerfStats::threadStats.backupReadBytes += count;
         // Lock released during this call; assume any field could have changed.
-        storage->unlockedRead(lock, buffer.get(), frameIndex,
+        storage->unlockedRead(lock, buffer.get(), count, frameIndex,
                               storage->usingDevNull);
     }
 
     assert(!this->buffer);
     this->buffer = std::move(buffer);
+    checkForCompression = true;
 }
 
 /*
@@ -815,17 +860,41 @@ MultiFileStorage::Frame::performWrite(Lock& lock)
     memcpy(metadataBlock, appendedMetadata.get(), appendedMetadataLength);
     const size_t appendedMetadataVersion = this->appendedMetadataVersion;
 
+    // If this is the first write of a new (or reopened) replica, the index
+    // must record the frame as open before the replica reaches storage;
+    // otherwise a restart could skip the replica or use stale metadata.
+    storage->writeFrameIndexBlock(frameIndex);
+
+    // A closed replica none of which has been written yet can be written
+    // compressed, as a whole.
+    char* source = firstDirtyBlock;
+    size_t offset = startOfFirstDirtyBlock;
+    size_t count = dirtyLength;
+    BufferPtr image(NULL, storage->bufferDeleter);
+    size_t imageLength = 0;
+    if (storage->compressReplicas && isClosed && committedLength == 0 &&
+            appendedLength > 0) {
+        image = storage->allocateBuffer();
+        // Lock released during this call; the frame is closed, so its
+        // data can't change.
+        imageLength = compress(lock, appendedLength, image.get());
+        if (imageLength != 0) {
+            source = static_cast<char*>(image.get());
+            offset = 0;
+            count = roundUp(imageLength);
+        }
+    }
+
     if (testingSkipRealIo) {
         TEST_LOG("sourceBufferOffset %lu count %lu frameIndex %lu",
-                 startOfFirstDirtyBlock, dirtyLength, frameIndex);
+                 offset, count, frameIndex);
     } else {
         ++metrics->backup.storageWriteCount;
-        metrics->backup.storageWriteBytes += dirtyLength;
+        metrics->backup.storageWriteBytes += count;
         ++PerfStats::threadStats.backupWriteOps;
-        PerfStats::threadStats.backupWriteBytes += dirtyLength;
+        PerfStats::threadStats.backupWriteBytes += count;
         // Lock released during this call; assume any field could have changed.
-        storage->unlockedWrite(lock, firstDirtyBlock, dirtyLength,
-                               frameIndex, startOfFirstDirtyBlock,
+        storage->unlockedWrite(lock, source, count, frameIndex, offset,
                                metadataBlock, METADATA_SIZE);
     }
 
@@ -833,8 +902,22 @@ MultiFileStorage::Frame::performWrite(Lock& lock)
 
     // Update committed based on the above snapshots of fields taken
     // just before the write.
+    storage->queuedBytes -= unsyncedLength();
     committedLength = appendedLength;
+    storage->queuedBytes += unsyncedLength();
     committedMetadataVersion = appendedMetadataVersion;
+    if (imageLength != 0)
+        storedLength = imageLength;
+
+    // Once a closed replica's final metadata is on storage, record it in
+    // the index so restarts needn't read it from the frame.
+    const BackupReplicaMetadata* metadata =
+        reinterpret_cast<const BackupReplicaMetadata*>(metadataBlock);
+    if (metadata->checkIntegrity() && metadata->closed) {
+        storage->setFrameIndexEntry(frameIndex, FRAME_CLOSED, metadataBlock,
+                                    storedLength);
+        storage->writeFrameIndexBlock(frameIndex);
+    }
 
     // Release the in-memory copy if it won't be used again.
     if (isClosed && isSynced() && !loadRequested && buffer) {
@@ -859,6 +942,134 @@ MultiFileStorage::Frame::isSynced() const
            (appendedMetadataVersion == committedMetadataVersion);
 }
 
+/**
+ * Return the number of bytes appended to this frame that haven't yet been
+ * flushed to storage. Any change to #appendedLength or #committedLength
+ * must update MultiFileStorage::queuedBytes to match.
+ */
+size_t
+MultiFileStorage::Frame::unsyncedLength() const
+{
+    return appendedLength - committedLength;
+}
+
+namespace {
+/// Identifies a MultiFileStorage::CompressedReplicaHeader.
+const uint64_t COMPRESSED_REPLICA_MAGIC = 0x347a4c70655279aelu;
+
+/// Returns the Crc32C of the first \a length bytes at \a data.
+uint32_t
+computeChecksum(const void* data, size_t length)
+{
+    Crc32C crc;
+    crc.update(data, downCast<uint32_t>(length));
+    return crc.getResult();
+}
+}
+
+/**
+ * Compress the replica in #buffer for storage, if that would make it take
+ * fewer blocks. Releases #lock while compressing.
+ *
+ * \param lock
+ *     Lock on the storage mutex which must be held before calling. This lock
+ *     is released during compression and reacquired before returning.
+ * \param length
+ *     Bytes of replica data at the start of #buffer.
+ * \param[out] image
+ *     Buffer from allocateBuffer() where the compressed image (starting
+ *     with a CompressedReplicaHeader) is built.
+ * \return
+ *     Length of the compressed image, or 0 if the replica should be stored
+ *     as is.
+ */
+size_t
+MultiFileStorage::Frame::compress(Lock& lock, size_t length, void* image)
+{
+#if ENABLE_LZ4
+    const size_t segmentSize = storage->segmentSize;
+    CompressedReplicaHeader* header =
+        static_cast<CompressedReplicaHeader*>(image);
+    lock.unlock();
+    uint64_t start = Cycles::rdtsc();
+    int r = LZ4_compress_default(static_cast<const char*>(buffer.get()),
+                                 static_cast<char*>(image) + sizeof(*header),
+                                 downCast<int>(length),
+                                 downCast<int>(segmentSize - sizeof(*header)));
+    size_t imageLength = 0;
+    if (r > 0 &&
+            roundUp(sizeof(*header) + static_cast<size_t>(r)) <
+            roundUp(length)) {
+        header->magic = COMPRESSED_REPLICA_MAGIC;
+        header->compressedLength = downCast<uint32_t>(r);
+        header->uncompressedLength = downCast<uint32_t>(length);
+        header->checksum = computeChecksum(header,
+                offsetof(CompressedReplicaHeader, checksum));
+        imageLength = sizeof(*header) + static_cast<size_t>(r);
+    }
+    PerfStats::threadStats.backupCompressionCycles += Cycles::rdtsc() - start;
+    PerfStats::threadStats.backupCompressionInputBytes += length;
+    PerfStats::threadStats.backupCompressionOutputBytes +=
+        imageLength != 0 ? imageLength : length;
+    lock.lock();
+    return imageLength;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * If #buffer (just read from storage) holds a compressed replica, replace
+ * it with the decompressed replica. Releases #lock while decompressing;
+ * #performingIo is set in the meantime.
+ *
+ * \param lock
+ *     Lock on the storage mutex which must be held before calling. This lock
+ *     is released during decompression and reacquired before returning.
+ */
+void
+MultiFileStorage::Frame::decompress(Lock& lock)
+{
+    checkForCompression = false;
+    const size_t segmentSize = storage->segmentSize;
+    const CompressedReplicaHeader* header =
+        static_cast<const CompressedReplicaHeader*>(buffer.get());
+    if (header->magic != COMPRESSED_REPLICA_MAGIC ||
+            header->checksum != computeChecksum(header,
+                offsetof(CompressedReplicaHeader, checksum)) ||
+            header->compressedLength > segmentSize - sizeof(*header) ||
+            header->uncompressedLength > segmentSize) {
+        return;
+    }
+    storedLength = sizeof(*header) + header->compressedLength;
+
+    BufferPtr decompressed = storage->allocateBuffer();
+    performingIo = true;
+    lock.unlock();
+    uint64_t start = Cycles::rdtsc();
+#if ENABLE_LZ4
+    int r = LZ4_decompress_safe(
+            static_cast<const char*>(buffer.get()) + sizeof(*header),
+            static_cast<char*>(decompressed.get()),
+            downCast<int>(header->compressedLength),
+            downCast<int>(segmentSize));
+#else
+    int r = -1;
+#endif
+    if (r != downCast<int>(header->uncompressedLength)) {
+        // Leave nothing that could pass for the replica; recovery will
+        // find that the replica doesn't match its certificate.
+        LOG(WARNING, "Couldn't decompress the replica stored in frame %lu",
+            frameIndex);
+        memset(decompressed.get(), '\0', segmentSize);
+    }
+    PerfStats::threadStats.backupDecompressionCycles +=
+        Cycles::rdtsc() - start;
+    lock.lock();
+    performingIo = false;
+    buffer = std::move(decompressed);
+}
+
 // --- MultiFileStorage::BufferDeleter ---
 
 /**
@@ -920,13 +1131,17 @@ MultiFileStorage::BufferDeleter::operator()(void* buffer)
  * \param openFlags
  *      Extra flags for use while opening files in filePathsStr (default to 0,
  *      O_DIRECT may be used to disable the OS buffer cache.
+ * \param compressReplicas
+ *      If true, compress closed replicas before writing them (see
+ *      #compressReplicas). Ignored unless built with LZ4 support.
  */
 MultiFileStorage::MultiFileStorage(size_t segmentSize,
                                    size_t frameCount,
                                    size_t writeRateLimit,
                                    size_t maxWriteBuffers,
                                    const char* filePathsStr,
-                                   int openFlags)
+                                   int openFlags,
+                                   bool compressReplicas)
     : BackupStorage(segmentSize, Type::DISK, writeRateLimit)
     , mutex()
     , ioQueue()
@@ -941,12 +1156,24 @@ MultiFileStorage::MultiFileStorage(size_t segmentSize,
     , usingDevNull(filePathsStr != NULL && string(filePathsStr) == "/dev/null")
     , writeBuffersInUse(0)
     , maxWriteBuffers(maxWriteBuffers)
+    , compressReplicas(compressReplicas)
+    , queuedBytes(0)
+    , recentWriteBytes(0)
+    , recentWriteCycles(0)
     , bufferDeleter(this)
     , buffers()
+    , frameIndexImage(Memory::xmemalign(HERE, BUFFER_ALIGNMENT,
+                                        frameIndexBytes()),
+                      std::free)
+    , dirtyFrameIndexBlocks((frameCount + FRAME_INDEX_ENTRIES_PER_BLOCK - 1) /
+                            FRAME_INDEX_ENTRIES_PER_BLOCK)
+    , frameIndexActive(false)
 {
     assert(filePathsStr);
 
     freeMap.set();
+    memset(frameIndexImage.get(), 0, frameIndexBytes());
+    dirtyFrameIndexBlocks.set();
 
     // If we were given /dev/null (to take disk bandwidth out of the
     // equation during testing/benchmarking), don't supply the O_DIRECT
@@ -957,6 +1184,14 @@ MultiFileStorage::MultiFileStorage(size_t segmentSize,
             "know what you're doing!");
     }
 
+#if !ENABLE_LZ4
+    if (compressReplicas) {
+        LOG(WARNING, "Not built with LZ4 support; replicas will be stored "
+            "uncompressed");
+        this->compressReplicas = false;
+    }
+#endif
+
     std::string filePathsCopy(filePathsStr);
     size_t filePathIndex = 0;
     bool doneParsing = false;
@@ -1148,6 +1383,11 @@ MultiFileStorage::getMetadataSize()
  * reponsible for freeing the frames if the metadata indicates the replica data
  * stored there isn't useful.
  *
+ * If the frame index on storage is intact and goes with the superblock
+ * returned by the last call to loadSuperblock(), metadata comes from the
+ * index, and only frames holding open replicas are read individually.
+ * Otherwise the metadata of every frame is read from storage.
+ *
  * \return
  *      Pointer to every frame which has various uses depending on the
  *      metadata that is found in that frame. BackupService code is expected
@@ -1157,19 +1397,41 @@ MultiFileStorage::getMetadataSize()
 std::vector<BackupStorage::FrameRef>
 MultiFileStorage::loadAllMetadata()
 {
+    bool indexValid = loadFrameIndex();
+    size_t framesRead = 0;
+
     std::vector<FrameRef> ret;
     ret.reserve(frames.size());
     foreach (Frame& frame, frames) {
-        frame.loadMetadata();
+        const FrameIndexEntry& entry = getFrameIndexBlock(frame.frameIndex)->
+            entries[frame.frameIndex % FRAME_INDEX_ENTRIES_PER_BLOCK];
+        if (entry.state == FRAME_OPEN) {
+            frame.loadMetadata();
+            ++framesRead;
+        } else {
+            memset(frame.appendedMetadata.get(), '\0', METADATA_SIZE);
+            if (entry.state == FRAME_CLOSED) {
+                memcpy(frame.appendedMetadata.get(), entry.metadata,
+                       sizeof(entry.metadata));
+                frame.storedLength = entry.storedLength;
+            }
+        }
         assert(freeMap[frame.frameIndex] == 1);
         freeMap[frame.frameIndex] = 0;
 
         const BackupReplicaMetadata* metadata =
                 static_cast<const BackupReplicaMetadata*>(frame.getMetadata());
         if (!metadata->checkIntegrity()) {
+            setFrameIndexEntry(frame.frameIndex, FRAME_FREE);
             ret.push_back({&frame, BackupStorage::freeFrame});
             continue;
         }
+        if (metadata->closed) {
+            setFrameIndexEntry(frame.frameIndex, FRAME_CLOSED,
+                               frame.getMetadata(), frame.storedLength);
+        } else {
+            setFrameIndexEntry(frame.frameIndex, FRAME_OPEN);
+        }
 
         frame.isClosed = metadata->closed;
         frame.isOpen = !metadata->closed;
@@ -1182,6 +1444,9 @@ MultiFileStorage::loadAllMetadata()
 
         ret.push_back({&frame, BackupStorage::freeFrame});
     }
+    LOG(NOTICE, "Read the metadata of %lu of %lu frames from storage "
+        "(frame index %s)", framesRead, frames.size(),
+        indexValid ? "valid" : "missing or stale");
     return ret;
 }
 
@@ -1266,6 +1531,12 @@ MultiFileStorage::resetSuperblock(ServerId serverId,
     }
 
     superblock = newSuperblock;
+
+    // Tie the frame index to the new superblock. Until this completes the
+    // index on storage is stale (it names an older superblock version), so
+    // a crash in the meantime just means the next restart scans all frames.
+    Lock lock(mutex);
+    frameIndexActive = writeFrameIndex(newSuperblock.version);
 }
 
 /**
@@ -1367,6 +1638,26 @@ MultiFileStorage::fry()
     }
 }
 
+// See BackupStorage::getQueuedBytes.
+uint64_t
+MultiFileStorage::getQueuedBytes()
+{
+    Lock _(mutex);
+    return queuedBytes;
+}
+
+// See BackupStorage::getWriteMBytesPerSec.
+uint32_t
+MultiFileStorage::getWriteMBytesPerSec()
+{
+    Lock _(mutex);
+    if (recentWriteCycles == 0)
+        return 0;
+    return downCast<uint32_t>(static_cast<uint64_t>(
+            static_cast<double>(recentWriteBytes) / 1024 / 1024 /
+            Cycles::toSeconds(recentWriteCycles)));
+}
+
 // - private -
 
 /**
@@ -1446,6 +1737,233 @@ MultiFileStorage::offsetOfSuperblockFrame(size_t superblockIndex) const
            BLOCK_SIZE;
 }
 
+namespace {
+/// Identifies a FrameIndexHeader on storage.
+const uint64_t FRAME_INDEX_MAGIC = 0x7865646e49656d47lu;
+}
+
+/**
+ * Returns the number of bytes the frame index occupies on storage (and in
+ * #frameIndexImage): a header block followed by one block for every
+ * FRAME_INDEX_ENTRIES_PER_BLOCK frames.
+ */
+size_t
+MultiFileStorage::frameIndexBytes() const
+{
+    return (1 + (frameCount + FRAME_INDEX_ENTRIES_PER_BLOCK - 1) /
+                FRAME_INDEX_ENTRIES_PER_BLOCK) * BLOCK_SIZE;
+}
+
+/**
+ * Returns the offset into the first file where the frame index starts;
+ * it follows the last frame. The other files leave this space empty.
+ */
+off_t
+MultiFileStorage::offsetOfFrameIndex() const
+{
+    return offsetOfFramelet(frameCount);
+}
+
+/**
+ * Returns the block of #frameIndexImage that holds the entry for a frame.
+ *
+ * \param frameIndex
+ *      Frame whose entry is needed.
+ */
+MultiFileStorage::FrameIndexBlock*
+MultiFileStorage::getFrameIndexBlock(size_t frameIndex)
+{
+    char* image = static_cast<char*>(frameIndexImage.get());
+    return reinterpret_cast<FrameIndexBlock*>(image +
+        (frameIndex / FRAME_INDEX_ENTRIES_PER_BLOCK + 1) * BLOCK_SIZE);
+}
+
+/**
+ * Update the entry for a frame in #frameIndexImage. The change only reaches
+ * storage when writeFrameIndexBlock() is next called for a frame in the same
+ * block, so callers must flush changes that restarts depend on. Frames
+ * marked FRAME_FREE needn't be flushed: a stale FRAME_OPEN or FRAME_CLOSED
+ * entry only describes a replica that a full scan of the frames would have
+ * found anyway. The caller must hold #mutex, except during startup.
+ *
+ * \param frameIndex
+ *      Frame whose entry should be changed.
+ * \param state
+ *      What is now stored in the frame.
+ * \param metadata
+ *      If \a state is FRAME_CLOSED, the replica's final metadata as written
+ *      to the frame (a BackupReplicaMetadata); otherwise ignored.
+ * \param storedLength
+ *      If \a state is FRAME_CLOSED, the frame's Frame::storedLength;
+ *      otherwise ignored.
+ */
+void
+MultiFileStorage::setFrameIndexEntry(size_t frameIndex,
+                                     FrameIndexState state,
+                                     const void* metadata,
+                                     size_t storedLength)
+{
+    static_assert(sizeof(BackupReplicaMetadata) <= FRAME_INDEX_METADATA_SIZE,
+                  "BackupReplicaMetadata doesn't fit in a FrameIndexEntry");
+    FrameIndexEntry& entry = getFrameIndexBlock(frameIndex)->
+        entries[frameIndex % FRAME_INDEX_ENTRIES_PER_BLOCK];
+    entry.state = state;
+    entry.storedLength = 0;
+    memset(entry.metadata, '\0', sizeof(entry.metadata));
+    if (state == FRAME_CLOSED) {
+        entry.storedLength = downCast<uint32_t>(storedLength);
+        if (metadata != NULL)
+            memcpy(entry.metadata, metadata, sizeof(BackupReplicaMetadata));
+    }
+    dirtyFrameIndexBlocks[frameIndex / FRAME_INDEX_ENTRIES_PER_BLOCK] = 1;
+}
+
+/**
+ * Write the block of the frame index holding a frame's entry to storage if
+ * it has changed since it was last written. Frame::performWrite() calls this
+ * before writing a replica's data (so the frame is known to be FRAME_OPEN
+ * before anything from the new replica can be found in it) and again once
+ * a closed replica's final metadata is durable. Blocks are written
+ * synchronously (the files are opened with O_SYNC in production) while
+ * holding #mutex; the index is small and changes at most a few times per
+ * replica, so this is cheap compared to the replica writes themselves.
+ *
+ * Does nothing until resetSuperblock() has activated the index. DIEs if
+ * the block can't be written, since a restart could then lose replicas.
+ *
+ * \param frameIndex
+ *      Frame whose block should be written.
+ */
+void
+MultiFileStorage::writeFrameIndexBlock(size_t frameIndex)
+{
+    const size_t blockIndex = frameIndex / FRAME_INDEX_ENTRIES_PER_BLOCK;
+    if (!frameIndexActive || !dirtyFrameIndexBlocks[blockIndex])
+        return;
+    FrameIndexBlock* block = getFrameIndexBlock(frameIndex);
+    block->checksum = computeChecksum(block,
+                                      offsetof(FrameIndexBlock, checksum));
+    ssize_t r = pwrite(fds[0], block, BLOCK_SIZE,
+                       offsetOfFrameIndex() + (blockIndex + 1) * BLOCK_SIZE);
+    if (r == -1) {
+        DIE("Failed to write the backup frame index; "
+            "cannot continue safely: %s", strerror(errno));
+    } else if (r < BLOCK_SIZE) {
+        DIE("Short write while writing the backup frame index; "
+            "cannot continue safely");
+    }
+    dirtyFrameIndexBlocks[blockIndex] = 0;
+}
+
+/**
+ * Write all of #frameIndexImage to storage and tie it to a superblock
+ * version. Blocks are flushed before the header, so the header never
+ * vouches for blocks that aren't on storage yet.
+ *
+ * \param superblockVersion
+ *      Version of the superblock most recently written to storage.
+ * \return
+ *      True if the index was written; false if it couldn't be (for
+ *      example, because the device has no room past the last frame), in
+ *      which case restarts will scan all frames.
+ */
+bool
+MultiFileStorage::writeFrameIndex(uint64_t superblockVersion)
+{
+    char* image = static_cast<char*>(frameIndexImage.get());
+    const size_t blockCount = dirtyFrameIndexBlocks.size();
+    for (size_t i = 0; i < blockCount; ++i) {
+        FrameIndexBlock* block = getFrameIndexBlock(
+                i * FRAME_INDEX_ENTRIES_PER_BLOCK);
+        block->checksum = computeChecksum(block,
+                                          offsetof(FrameIndexBlock, checksum));
+    }
+    const size_t blocksBytes = blockCount * BLOCK_SIZE;
+    ssize_t r = pwrite(fds[0], image + BLOCK_SIZE, blocksBytes,
+                       offsetOfFrameIndex() + BLOCK_SIZE);
+    if (r != static_cast<ssize_t>(blocksBytes) ||
+            (fdatasync(fds[0]) == -1 && !usingDevNull)) {
+        LOG(WARNING, "Couldn't write the backup frame index; future restarts "
+            "will have to read the metadata of every frame: %s",
+            r == -1 ? strerror(errno) : "short write");
+        return false;
+    }
+
+    memset(image, '\0', BLOCK_SIZE);
+    FrameIndexHeader* header = reinterpret_cast<FrameIndexHeader*>(image);
+    header->magic = FRAME_INDEX_MAGIC;
+    header->superblockVersion = superblockVersion;
+    header->frameCount = frameCount;
+    header->segmentSize = segmentSize;
+    header->fileCount = fds.size();
+    header->checksum = computeChecksum(header,
+                                       offsetof(FrameIndexHeader, checksum));
+    r = pwrite(fds[0], image, BLOCK_SIZE, offsetOfFrameIndex());
+    if (r != BLOCK_SIZE || (fdatasync(fds[0]) == -1 && !usingDevNull)) {
+        LOG(WARNING, "Couldn't write the backup frame index header; future "
+            "restarts will have to read the metadata of every frame: %s",
+            r == -1 ? strerror(errno) : "short write");
+        return false;
+    }
+
+    dirtyFrameIndexBlocks.reset();
+    return true;
+}
+
+/**
+ * Read the frame index from storage into #frameIndexImage; used by
+ * loadAllMetadata() at startup. Entries that can't be trusted (because the
+ * index is missing, was written for a different superblock or layout, or
+ * its block was damaged) are set to FRAME_OPEN, which means the metadata for
+ * the frame must be read from the frame itself.
+ *
+ * \return
+ *      True if the index was written for the superblock returned by the last
+ *      call to loadSuperblock(), even if some of its blocks were damaged.
+ */
+bool
+MultiFileStorage::loadFrameIndex()
+{
+    char* image = static_cast<char*>(frameIndexImage.get());
+    const size_t bytes = frameIndexBytes();
+    ssize_t r = pread(fds[0], image, bytes, offsetOfFrameIndex());
+
+    const FrameIndexHeader* header =
+        reinterpret_cast<const FrameIndexHeader*>(image);
+    bool valid = r == static_cast<ssize_t>(bytes) &&
+        header->magic == FRAME_INDEX_MAGIC &&
+        header->checksum == computeChecksum(header,
+                                offsetof(FrameIndexHeader, checksum)) &&
+        header->superblockVersion == superblock.version &&
+        header->frameCount == frameCount &&
+        header->segmentSize == segmentSize &&
+        header->fileCount == fds.size();
+
+    size_t damagedBlocks = 0;
+    const size_t blockCount = dirtyFrameIndexBlocks.size();
+    for (size_t i = 0; i < blockCount; ++i) {
+        FrameIndexBlock* block = getFrameIndexBlock(
+                i * FRAME_INDEX_ENTRIES_PER_BLOCK);
+        if (valid && block->checksum == computeChecksum(block,
+                                offsetof(FrameIndexBlock, checksum))) {
+            continue;
+        }
+        if (valid)
+            ++damagedBlocks;
+        memset(block, '\0', BLOCK_SIZE);
+        for (size_t j = 0; j < FRAME_INDEX_ENTRIES_PER_BLOCK; ++j)
+            block->entries[j].state = FRAME_OPEN;
+    }
+    if (damagedBlocks > 0) {
+        LOG(WARNING, "%lu of %lu blocks of the backup frame index were "
+            "damaged; reading the metadata of their frames instead",
+            damagedBlocks, blockCount);
+    }
+
+    dirtyFrameIndexBlocks.set();
+    return valid;
+}
+
 /**
  * Fix the size of the logfile to ensure that the OS doesn't tell us
  * the filesystem is out of space later.
@@ -1456,7 +1974,7 @@ MultiFileStorage::offsetOfSuperblockFrame(size_t superblockIndex) const
 void
 MultiFileStorage::reserveSpace(int fd)
 {
-    uint64_t logSpace = offsetOfFramelet(frameCount);
+    uint64_t logSpace = offsetOfFrameIndex() + frameIndexBytes();
 
     LOG(DEBUG, "Reserving %lu bytes of log space", logSpace);
     int r = ftruncate(fd, logSpace);
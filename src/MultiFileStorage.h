@@ -90,8 +90,11 @@ class MultiFileStorage : public BackupStorage {
 
         void performRead(Lock& lock);
         void performWrite(Lock& lock);
+        size_t compress(Lock& lock, size_t length, void* image);
+        void decompress(Lock& lock);
 
         bool isSynced() const;
+        size_t unsyncedLength() const;
 
         /// Storage where this frame resides.
         MultiFileStorage* storage;
@@ -194,9 +197,27 @@ class MultiFileStorage : public BackupStorage {
          */
         bool loadRequested;
 
-        /// True if a read or write is ongoing (which is done without a lock).
+        /**
+         * True if a read, write, or decompression is ongoing (which is done
+         * without a lock).
+         */
         bool performingIo;
 
+        /**
+         * If the replica was stored compressed, the number of bytes at the
+         * start of the frame holding its compressed image (see
+         * CompressedReplicaHeader); otherwise 0. Also 0 if it isn't known
+         * (after a restart that couldn't use the frame index), in which
+         * case performRead() reads the whole frame.
+         */
+        size_t storedLength;
+
+        /**
+         * True if #buffer was filled by performRead() and load() hasn't yet
+         * checked whether it holds a compressed replica.
+         */
+        bool checkForCompression;
+
         /**
          * Logical timestamp used to track which lifecycle of the frame io was
          * scheduled during. If a task is scheduled and then freed this can be
@@ -228,7 +249,8 @@ class MultiFileStorage : public BackupStorage {
                      size_t writeRateLimit,
                      size_t maxNonVolatileBuffers,
                      const char* filePaths,
-                     int openFlags = 0);
+                     int openFlags = 0,
+                     bool compressReplicas = false);
     ~MultiFileStorage();
 
     FrameRef open(bool sync, ServerId masterId, uint64_t segmentId);
@@ -241,6 +263,8 @@ class MultiFileStorage : public BackupStorage {
     Superblock loadSuperblock();
     void quiesce();
     void fry();
+    uint64_t getQueuedBytes();
+    uint32_t getWriteMBytesPerSec();
 
     BufferPtr allocateBuffer();
 
@@ -260,12 +284,108 @@ class MultiFileStorage : public BackupStorage {
     enum { METADATA_SIZE = BLOCK_SIZE };
 
   PRIVATE:
+    /**
+     * What the frame index records about a frame. FRAME_FREE frames hold
+     * no replica worth keeping. FRAME_OPEN frames hold (or may soon hold)
+     * a replica whose metadata is still changing, so it must be read from
+     * the frame itself on restart. FRAME_CLOSED frames hold a closed
+     * replica whose final metadata is copied into the index.
+     */
+    enum FrameIndexState : uint8_t {
+        FRAME_FREE = 0,
+        FRAME_OPEN = 1,
+        FRAME_CLOSED = 2,
+    };
+
+    /**
+     * getWriteMBytesPerSec() reports the bandwidth of roughly this many of
+     * the most recently written bytes.
+     */
+    enum { WRITE_BANDWIDTH_WINDOW = 64 * 1024 * 1024 };
+
+    /// Space for a copy of a frame's metadata in a FrameIndexEntry.
+    enum { FRAME_INDEX_METADATA_SIZE = 59 };
+
+    /// What the frame index stores for each frame.
+    struct FrameIndexEntry {
+        /// A FrameIndexState.
+        uint8_t state;
+
+        /// Frame::storedLength if #state is FRAME_CLOSED.
+        uint32_t storedLength;
+
+        /// Copy of the frame's metadata if #state is FRAME_CLOSED.
+        char metadata[FRAME_INDEX_METADATA_SIZE];
+    } __attribute__((packed));
+
+    /// Number of FrameIndexEntries stored in each block of the frame index.
+    enum { FRAME_INDEX_ENTRIES_PER_BLOCK = 7 };
+
+    /**
+     * One block of the frame index. Blocks are checksummed individually
+     * since they are rewritten individually as frames change state; a
+     * block torn by a crash only costs a scan of its own frames.
+     */
+    struct FrameIndexBlock {
+        FrameIndexEntry entries[FRAME_INDEX_ENTRIES_PER_BLOCK];
+        char unused[BLOCK_SIZE - sizeof(FrameIndexEntry) *
+                                 FRAME_INDEX_ENTRIES_PER_BLOCK -
+                    sizeof(uint32_t)];
+        /// Crc32C of the rest of the block.
+        uint32_t checksum;
+    } __attribute__((packed));
+    static_assert(sizeof(FrameIndexBlock) == BLOCK_SIZE,
+                  "FrameIndexBlock must fill exactly one disk block");
+
+    /**
+     * Precedes the blocks of the frame index on storage and says whether
+     * they can be trusted: the index is only used if it was written for
+     * the superblock found on storage and for the same storage layout.
+     */
+    struct FrameIndexHeader {
+        /// Always FRAME_INDEX_MAGIC.
+        uint64_t magic;
+
+        /// Superblock::version of the superblock the index goes with.
+        uint64_t superblockVersion;
+
+        /// Layout the index was written for.
+        uint64_t frameCount;
+        uint64_t segmentSize;
+        uint64_t fileCount;
+
+        /// Crc32C of the fields above.
+        uint32_t checksum;
+    } __attribute__((packed));
+    static_assert(sizeof(FrameIndexHeader) <= BLOCK_SIZE,
+                  "FrameIndexHeader doesn't fit in a single disk block");
+
+    /**
+     * Precedes the compressed image of a replica at the start of its frame
+     * (the LZ4-compressed replica data follows immediately). Replicas stored
+     * as is have no header; a header is recognized by its magic number and
+     * checksum.
+     */
+    struct CompressedReplicaHeader {
+        /// Always COMPRESSED_REPLICA_MAGIC.
+        uint64_t magic;
+
+        /// Bytes of compressed data following the header.
+        uint32_t compressedLength;
+
+        /// Bytes of replica data the compressed data expands to.
+        uint32_t uncompressedLength;
+
+        /// Crc32C of the fields above.
+        uint32_t checksum;
+    } __attribute__((packed));
+
     size_t bytesInFramelet(size_t fileIndex) const;
     off_t offsetOfFramelet(size_t frameIndex) const;
     off_t offsetOfFrameMetadata(size_t frameIndex) const;
     off_t offsetOfSuperblockFrame(size_t superblockIndex) const;
-    void unlockedRead(Frame::Lock& lock, void* buf, size_t frameIndex,
-                      bool usingDevNull);
+    void unlockedRead(Frame::Lock& lock, void* buf, size_t count,
+                      size_t frameIndex, bool usingDevNull);
     void unlockedWrite(Frame::Lock& lock, void* buf, size_t count,
                        size_t frameIndex, off_t offsetInFrame,
                        void* metadataBuf, size_t metadataCount);
@@ -273,6 +393,16 @@ class MultiFileStorage : public BackupStorage {
     void reserveSpace(int fd);
     Tub<Superblock> tryLoadSuperblock(uint32_t superblockFrame);
 
+    size_t frameIndexBytes() const;
+    off_t offsetOfFrameIndex() const;
+    FrameIndexBlock* getFrameIndexBlock(size_t frameIndex);
+    void setFrameIndexEntry(size_t frameIndex, FrameIndexState state,
+                            const void* metadata = NULL,
+                            size_t storedLength = 0);
+    void writeFrameIndexBlock(size_t frameIndex);
+    bool writeFrameIndex(uint64_t superblockVersion);
+    bool loadFrameIndex();
+
     /// Protects concurrent operations on storage and all of its frames.
     std::mutex mutex;
     typedef std::unique_lock<std::mutex> Lock;
@@ -344,6 +474,31 @@ class MultiFileStorage : public BackupStorage {
      */
     size_t maxWriteBuffers;
 
+    /**
+     * If true, replicas are compressed (with LZ4) before being written, if
+     * that makes them smaller. Only replicas that are closed before any of
+     * their data has been written are compressed, so frames opened without
+     * sync hold off writing until they are closed (as if their buffers were
+     * non-volatile). The I/O thread compresses replicas, and load()
+     * decompresses them in the thread performing the recovery.
+     */
+    bool compressReplicas;
+
+    /**
+     * Bytes appended to frames that haven't yet been written to storage;
+     * the sum of Frame::unsyncedLength() over all frames. See
+     * getQueuedBytes().
+     */
+    uint64_t queuedBytes;
+
+    /**
+     * Bytes written by unlockedWrite() and the cycles the writes took,
+     * both halved whenever the bytes exceed WRITE_BANDWIDTH_WINDOW. Their
+     * ratio is the bandwidth returned by getWriteMBytesPerSec().
+     */
+    uint64_t recentWriteBytes;
+    uint64_t recentWriteCycles;
+
     /**
      * Returns buffers allocated with MultiFileStorage::allocateBuffer()
      * to a pool, or if there are already plenty of buffers
@@ -359,6 +514,29 @@ class MultiFileStorage : public BackupStorage {
      */
     std::stack<void*, std::vector<void*>> buffers;
 
+    /**
+     * In-memory image of the frame index, which is stored on storage just
+     * past the last frame: a FrameIndexHeader block followed by a
+     * FrameIndexBlock for every FRAME_INDEX_ENTRIES_PER_BLOCK frames. It
+     * lets loadAllMetadata() find the replicas on storage with one
+     * sequential read instead of reading the metadata of every frame.
+     * Kept up to date as frames are opened, closed, and freed; blocks are
+     * written back as described in writeFrameIndexBlock().
+     */
+    Memory::unique_ptr_free frameIndexImage;
+
+    /// One bit per block of #frameIndexImage; set if the block has changed
+    /// since it was last written to storage.
+    boost::dynamic_bitset<> dirtyFrameIndexBlocks;
+
+    /**
+     * True once resetSuperblock() has written #frameIndexImage to storage.
+     * Until then changes to the index are only made in memory, so that a
+     * valid index left on storage by a previous process isn't disturbed
+     * before loadAllMetadata() has had a chance to use it.
+     */
+    bool frameIndexActive;
+
     DISALLOW_COPY_AND_ASSIGN(MultiFileStorage);
 };
 
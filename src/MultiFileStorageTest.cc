@@ -136,6 +136,36 @@ class MultiFileStorageTest : public ::testing::Test {
         fclose(f);
     }
 
+    /**
+     * Replace storage1 with a new instance using the same file, as if
+     * the backup had restarted.
+     */
+    void
+    restartStorage1(bool compressReplicas = false)
+    {
+        storage1.destroy();
+        storage1.construct(segmentSize, segmentFrames, 0, segmentFrames,
+                           filePath1, O_DIRECT | O_SYNC, compressReplicas);
+    }
+
+    /**
+     * Open a frame on storage1 and write a replica to it with the given
+     * metadata; the frame is freed on return, which (like any free) isn't
+     * recorded in the frame index right away.
+     */
+    void
+    appendReplica(uint64_t segmentId, bool closed)
+    {
+        BackupStorage::FrameRef frameRef = storage1->open(true, ServerId(), 0);
+        Frame* frame = static_cast<Frame*>(frameRef.get());
+        SegmentCertificate certificate;
+        certificate.segmentLength = testLength + 1;
+        BackupReplicaMetadata metadata(certificate, 99, segmentId,
+                                       segmentSize, 0, closed, false);
+        frame->append(testSource, 0, testLength + 1, 0,
+                      &metadata, sizeof(metadata));
+    }
+
     DISALLOW_COPY_AND_ASSIGN(MultiFileStorageTest);
 };
 
@@ -404,6 +434,43 @@ TEST_F(MultiFileStorageTest, Frame_reopen) {
             static_cast<char*>(frame->buffer.get()));
 }
 
+TEST_F(MultiFileStorageTest, Frame_reopenAfterRestart) {
+    Frame::testingSkipRealIo = false;
+    storage1->resetSuperblock({9999, 1}, "hasso");
+    appendReplica(88, true);
+    restartStorage1();
+    storage1->loadSuperblock();
+    auto frames = storage1->loadAllMetadata();
+    Frame* frame = static_cast<Frame*>(frames[0].get());
+    ASSERT_TRUE(frame->isClosed);
+
+    frame->reopen(testLength + 1);
+    EXPECT_EQ(MultiFileStorage::FRAME_OPEN,
+              storage1->getFrameIndexBlock(0)->entries[0].state);
+    SegmentCertificate certificate;
+    certificate.segmentLength = testLength + 1;
+    BackupReplicaMetadata metadata(certificate, 99, 88, segmentSize, 0,
+                                   false, false);
+    Buffer empty;
+    frame->append(empty, 0, 0, 0, &metadata, sizeof(metadata));
+    while (!frame->isSynced());
+    storage1->quiesce();
+
+    // The index no longer holds the metadata of the closed replica, so the
+    // frame's own (open) metadata is used after a restart.
+    frames.clear();
+    restartStorage1();
+    storage1->loadSuperblock();
+    frames = storage1->loadAllMetadata();
+    frame = static_cast<Frame*>(frames[0].get());
+    EXPECT_TRUE(frame->isOpen);
+    const BackupReplicaMetadata* loaded =
+        static_cast<const BackupReplicaMetadata*>(frame->getMetadata());
+    EXPECT_TRUE(loaded->checkIntegrity());
+    EXPECT_EQ(88lu, loaded->segmentId);
+    EXPECT_FALSE(loaded->closed);
+}
+
 TEST_F(MultiFileStorageTest, Frame_open) {
     BackupStorage::FrameRef frameRef = storage1->open(false, ServerId(), 0);
     Frame* frame = static_cast<Frame*>(frameRef.get());
@@ -671,10 +738,112 @@ TEST_F(MultiFileStorageTest, Frame_performRead) {
     EXPECT_TRUE(frame->buffer);
 }
 
+#if ENABLE_LZ4
+TEST_F(MultiFileStorageTest, Frame_compressedReplica) {
+    Frame::testingSkipRealIo = false;
+    restartStorage1(true);
+    Memory::unique_ptr_free data(
+        Memory::xmemalign(HERE, getpagesize(), segmentSize),
+        std::free);
+    for (uint32_t i = 0; i < segmentSize; i++)
+        static_cast<char*>(data.get())[i] = static_cast<char>('a' + i % 10);
+    Buffer source;
+    source.appendExternal(data.get(), segmentSize);
+
+    BackupStorage::FrameRef frameRef = storage1->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(source, 0, segmentSize, 0, test, testLength + 1);
+    // Nothing is written until the replica is closed.
+    EXPECT_FALSE(frame->isScheduled());
+    EXPECT_EQ(0lu, frame->committedLength);
+    frame->close();
+    while (!frame->isSynced());
+    storage1->quiesce();
+    EXPECT_LT(0lu, frame->storedLength);
+    EXPECT_GT(size_t(BLOCK_SIZE), frame->storedLength);
+    EXPECT_FALSE(frame->buffer);
+
+    TestLog::Enable _;
+    char* replica = bytes(frame->load());
+    EXPECT_EQ("", TestLog::get());
+    EXPECT_EQ(0, memcmp(data.get(), replica, segmentSize));
+}
+
+TEST_F(MultiFileStorageTest, Frame_compressedReplicaIncompressible) {
+    Frame::testingSkipRealIo = false;
+    restartStorage1(true);
+    Memory::unique_ptr_free data(
+        Memory::xmemalign(HERE, getpagesize(), segmentSize),
+        std::free);
+    for (uint32_t i = 0; i < segmentSize; i++)
+        static_cast<char*>(data.get())[i] = static_cast<char>(generateRandom());
+    Buffer source;
+    source.appendExternal(data.get(), segmentSize);
+
+    BackupStorage::FrameRef frameRef = storage1->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(source, 0, segmentSize, 0, test, testLength + 1);
+    frame->close();
+    while (!frame->isSynced());
+    storage1->quiesce();
+    EXPECT_EQ(0lu, frame->storedLength);
+
+    char* replica = bytes(frame->load());
+    EXPECT_EQ(0, memcmp(data.get(), replica, segmentSize));
+}
+
+TEST_F(MultiFileStorageTest, Frame_compressedReplicaAfterRestart) {
+    Frame::testingSkipRealIo = false;
+    restartStorage1(true);
+    storage1->resetSuperblock({9999, 1}, "hasso");
+    Buffer source;
+    source.appendExternal(test, testLength + 1);
+    size_t storedLength;
+    {
+        BackupStorage::FrameRef frameRef = storage1->open(false, ServerId(),
+                                                          0);
+        Frame* frame = static_cast<Frame*>(frameRef.get());
+        // Pad the replica with zeroes so that compression pays off.
+        frame->append(source, 0, testLength + 1, segmentSize - BLOCK_SIZE,
+                      NULL, 0);
+        SegmentCertificate certificate;
+        certificate.segmentLength = segmentSize;
+        BackupReplicaMetadata metadata(certificate, 99, 88, segmentSize, 0,
+                                       true, false);
+        frame->append(source, 0, 0, 0, &metadata, sizeof(metadata));
+        frame->close();
+        while (!frame->isSynced());
+        storage1->quiesce();
+        storedLength = frame->storedLength;
+        EXPECT_LT(0lu, storedLength);
+    }
+
+    // With the frame index, only the compressed image is read.
+    restartStorage1();
+    storage1->loadSuperblock();
+    auto frames = storage1->loadAllMetadata();
+    Frame* frame = static_cast<Frame*>(frames[0].get());
+    EXPECT_EQ(storedLength, frame->storedLength);
+    char* replica = bytes(frame->load());
+    EXPECT_STREQ(test, replica + segmentSize - BLOCK_SIZE);
+
+    // Without it, the whole frame is read, and the compressed image is
+    // recognized once it's in memory.
+    frames.clear();
+    restartStorage1();
+    frames = storage1->loadAllMetadata();
+    frame = static_cast<Frame*>(frames[0].get());
+    EXPECT_EQ(0lu, frame->storedLength);
+    replica = bytes(frame->load());
+    EXPECT_STREQ(test, replica + segmentSize - BLOCK_SIZE);
+    EXPECT_EQ(storedLength, frame->storedLength);
+}
+#endif
+
 TEST_F(MultiFileStorageTest, constructor) {
     struct stat s;
     stat(filePath1, &s);
-    EXPECT_EQ(storage1->offsetOfFramelet(segmentFrames),
+    EXPECT_EQ(storage1->offsetOfFrameIndex() + storage1->frameIndexBytes(),
               uint32_t(s.st_size));
 }
 
@@ -752,6 +921,91 @@ TEST_F(MultiFileStorageTest, loadAllMetadata) {
     EXPECT_EQ(storage1->frames.size(), frames.size());
 }
 
+namespace {
+bool loadAllMetadataFilter(string s) {
+    return s == "loadAllMetadata" || s == "loadFrameIndex";
+}
+}
+
+TEST_F(MultiFileStorageTest, loadAllMetadata_frameIndex) {
+    Frame::testingSkipRealIo = false;
+    storage1->resetSuperblock({9999, 1}, "hasso");
+    appendReplica(88, true);
+    appendReplica(89, false);
+    // Not recorded in the index, so never found.
+    writeReplica(2, 50, 99LU, 90LU, true, true);
+
+    restartStorage1();
+    storage1->loadSuperblock();
+    TestLog::Enable _(loadAllMetadataFilter);
+    auto frames = storage1->loadAllMetadata();
+    EXPECT_EQ("loadAllMetadata: Read the metadata of 1 of 4 frames from "
+              "storage (frame index valid)", TestLog::get());
+
+    const BackupReplicaMetadata* metadata =
+        static_cast<const BackupReplicaMetadata*>(frames[0]->getMetadata());
+    EXPECT_TRUE(metadata->checkIntegrity());
+    EXPECT_EQ(88lu, metadata->segmentId);
+    EXPECT_TRUE(static_cast<Frame*>(frames[0].get())->isClosed);
+    metadata =
+        static_cast<const BackupReplicaMetadata*>(frames[1]->getMetadata());
+    EXPECT_TRUE(metadata->checkIntegrity());
+    EXPECT_EQ(89lu, metadata->segmentId);
+    EXPECT_TRUE(static_cast<Frame*>(frames[1].get())->isOpen);
+    metadata =
+        static_cast<const BackupReplicaMetadata*>(frames[2]->getMetadata());
+    EXPECT_FALSE(metadata->checkIntegrity());
+}
+
+TEST_F(MultiFileStorageTest, loadAllMetadata_frameIndexStale) {
+    Frame::testingSkipRealIo = false;
+    storage1->resetSuperblock({9999, 1}, "hasso");
+    appendReplica(88, true);
+    writeReplica(2, 50, 99LU, 90LU, true, true);
+
+    // Without loadSuperblock() the index doesn't match the superblock.
+    restartStorage1();
+    TestLog::Enable _(loadAllMetadataFilter);
+    auto frames = storage1->loadAllMetadata();
+    EXPECT_EQ("loadAllMetadata: Read the metadata of 4 of 4 frames from "
+              "storage (frame index missing or stale)", TestLog::get());
+    const BackupReplicaMetadata* metadata =
+        static_cast<const BackupReplicaMetadata*>(frames[0]->getMetadata());
+    EXPECT_EQ(88lu, metadata->segmentId);
+    metadata =
+        static_cast<const BackupReplicaMetadata*>(frames[2]->getMetadata());
+    EXPECT_TRUE(metadata->checkIntegrity());
+    EXPECT_EQ(90lu, metadata->segmentId);
+}
+
+TEST_F(MultiFileStorageTest, loadAllMetadata_frameIndexDamagedBlock) {
+    Frame::testingSkipRealIo = false;
+    storage1->resetSuperblock({9999, 1}, "hasso");
+    appendReplica(88, true);
+
+    Memory::unique_ptr_free buffer(
+        Memory::xmemalign(HERE, getpagesize(), BLOCK_SIZE),
+        std::free);
+    off_t offset = storage1->offsetOfFrameIndex() + BLOCK_SIZE;
+    ASSERT_EQ(BLOCK_SIZE,
+              pread(storage1->fds[0], buffer.get(), BLOCK_SIZE, offset));
+    static_cast<char*>(buffer.get())[BLOCK_SIZE - 5] ^= 1;
+    ASSERT_EQ(BLOCK_SIZE,
+              pwrite(storage1->fds[0], buffer.get(), BLOCK_SIZE, offset));
+
+    restartStorage1();
+    storage1->loadSuperblock();
+    TestLog::Enable _(loadAllMetadataFilter);
+    auto frames = storage1->loadAllMetadata();
+    EXPECT_EQ("loadFrameIndex: 1 of 1 blocks of the backup frame index were "
+              "damaged; reading the metadata of their frames instead | "
+              "loadAllMetadata: Read the metadata of 4 of 4 frames from "
+              "storage (frame index valid)", TestLog::get());
+    const BackupReplicaMetadata* metadata =
+        static_cast<const BackupReplicaMetadata*>(frames[0]->getMetadata());
+    EXPECT_EQ(88lu, metadata->segmentId);
+}
+
 TEST_F(MultiFileStorageTest, resetSuperblock) {
     for (uint32_t expectedVersion = 1; expectedVersion < 3; ++expectedVersion) {
         storage1->resetSuperblock({9999, expectedVersion}, "hasso");
@@ -765,6 +1019,8 @@ TEST_F(MultiFileStorageTest, resetSuperblock) {
             EXPECT_EQ(expectedVersion, storage1->superblock.version);
             EXPECT_EQ(1u, storage1->lastSuperblockFrame);
         }
+        EXPECT_TRUE(storage1->frameIndexActive);
+        EXPECT_TRUE(storage1->dirtyFrameIndexBlocks.none());
     }
 }
 
@@ -811,6 +1067,44 @@ TEST_F(MultiFileStorageTest, fry)
     EXPECT_EQ(uint8_t(0), metadata[0]);
 }
 
+TEST_F(MultiFileStorageTest, getQueuedBytes) {
+    storage1->ioQueue.halt();
+    BackupStorage::FrameRef frameRef = storage1->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 5, 0, test, testLength + 1);
+    frame->append(testSource, 0, 3, 5, NULL, 0);
+    EXPECT_EQ(8lu, storage1->getQueuedBytes());
+    // Rewriting data already appended adds nothing.
+    frame->append(testSource, 0, 5, 0, NULL, 0);
+    EXPECT_EQ(8lu, storage1->getQueuedBytes());
+
+    frame->deschedule();
+    frame->performTask();
+    EXPECT_EQ(0lu, storage1->getQueuedBytes());
+
+    frame->append(testSource, 0, 2, 8, NULL, 0);
+    EXPECT_EQ(2lu, storage1->getQueuedBytes());
+    frame->free();
+    EXPECT_EQ(0lu, storage1->getQueuedBytes());
+}
+
+TEST_F(MultiFileStorageTest, getWriteMBytesPerSec) {
+    EXPECT_EQ(0u, storage1->getWriteMBytesPerSec());
+    Frame::testingSkipRealIo = false;
+    BackupStorage::FrameRef frameRef = storage1->open(true, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 5, 0, test, testLength + 1);
+    EXPECT_EQ(1024lu, storage1->recentWriteBytes);
+    EXPECT_LT(0lu, storage1->recentWriteCycles);
+
+    // Older writes count for less and less.
+    storage1->recentWriteBytes = MultiFileStorage::WRITE_BANDWIDTH_WINDOW;
+    storage1->recentWriteCycles = 1000;
+    frame->append(testSource, 0, 5, 5, NULL, 0);
+    EXPECT_EQ(uint64_t(MultiFileStorage::WRITE_BANDWIDTH_WINDOW / 2 + 512),
+              storage1->recentWriteBytes);
+}
+
 TEST_F(MultiFileStorageTest, loadSuperblockBothEqual) {
     storage1->resetSuperblock({9998, 1}, "gruuuu");
     auto superblock = storage1->loadSuperblock();
@@ -56,6 +56,8 @@ Object::Object(uint64_t tableId,
     : header(tableId,
              timestamp,
              version),
+      compactHeader(false),
+      valueCompressed(false),
       keysAndValueLength(),
       keysAndValue(),
       keysAndValueBuffer(&keysAndValueBuffer),
@@ -112,6 +114,8 @@ Object::Object(Key& key,
     : header(key.getTableId(),
              timestamp,
              version),
+      compactHeader(false),
+      valueCompressed(false),
       keysAndValueLength(),
       keysAndValue(),
       keysAndValueBuffer(),
@@ -161,22 +165,29 @@ Object::Object(Key& key,
  *      starting at offset.
  */
 Object::Object(Buffer& buffer, uint32_t offset, uint32_t length)
-    : header(*buffer.getOffset<Header>(offset)),
+    : header(0, 0, 0),
+      compactHeader(false),
+      valueCompressed(false),
       keysAndValueLength(),
       keysAndValue(),
       keysAndValueBuffer(&buffer),
-      keysAndValueOffset(offset + sizeof32(header)),
+      keysAndValueOffset(),
       keyOffsets(NULL)
 {
-    // If length is not specified, compute the length of keysAndValue
     if (length == 0)
-        keysAndValueLength = buffer.size() - offset -
-                             sizeof32(header);
-    else
-        keysAndValueLength = length - sizeof32(header);
+        length = buffer.size() - offset;
+
+    uint8_t raw[MAX_COMPACT_HEADER_LENGTH];
+    uint32_t rawLength = length;
+    if (rawLength > MAX_COMPACT_HEADER_LENGTH)
+        rawLength = MAX_COMPACT_HEADER_LENGTH;
+    uint32_t headerLength = deserializeHeader(raw,
+            buffer.copy(offset, rawLength, raw));
+    keysAndValueOffset = offset + headerLength;
+    keysAndValueLength = length - headerLength;
 
     void* retPtr;
-    if (buffer.peek(offset + sizeof32(header), &retPtr) >= keysAndValueLength)
+    if (buffer.peek(keysAndValueOffset, &retPtr) >= keysAndValueLength)
         keysAndValue = static_cast<char*>(retPtr);
 }
 
@@ -193,14 +204,18 @@ Object::Object(Buffer& buffer, uint32_t offset, uint32_t length)
  *      Total length of the object in bytes.
  */
 Object::Object(const void* buffer, uint32_t length)
-    : header(*reinterpret_cast<const Header*>(buffer)),
-      keysAndValueLength(length - sizeof32(header)),
-      keysAndValue(reinterpret_cast<const void*>(reinterpret_cast<
-                   const uint8_t*>(buffer) + sizeof32(header))),
+    : header(0, 0, 0),
+      compactHeader(false),
+      valueCompressed(false),
+      keysAndValueLength(),
+      keysAndValue(),
       keysAndValueBuffer(),
       keysAndValueOffset(0),
       keyOffsets(NULL)
 {
+    uint32_t headerLength = deserializeHeader(buffer, length);
+    keysAndValueLength = length - headerLength;
+    keysAndValue = static_cast<const uint8_t*>(buffer) + headerLength;
 }
 
 /**
@@ -214,7 +229,10 @@ void
 Object::assembleForLog(Buffer& buffer)
 {
     header.checksum = computeChecksum();
-    buffer.append(&header, sizeof32(header));
+    if (compactHeader)
+        serializeHeader(buffer.alloc(getSerializedHeaderLength()));
+    else
+        buffer.append(&header, sizeof32(header));
     appendKeysAndValueToBuffer(buffer);
 }
 
@@ -233,8 +251,8 @@ Object::assembleForLog(void* memBlock)
     uint8_t *dst = reinterpret_cast<uint8_t*>(memBlock);
     header.checksum = computeChecksum();
 
-    memcpy(dst, &header, sizeof32(header));
-    memcpy(dst + sizeof32(header), getKeysAndValue(), keysAndValueLength);
+    uint32_t headerLength = serializeHeader(dst);
+    memcpy(dst + headerLength, getKeysAndValue(), keysAndValueLength);
 }
 
 /**
@@ -709,7 +727,21 @@ Object::getTimestamp()
 uint32_t
 Object::getSerializedLength()
 {
-    return sizeof32(header) + keysAndValueLength;
+    return getSerializedHeaderLength() + keysAndValueLength;
+}
+
+/**
+ * Obtain the size of the object's header as it is (or will be) stored in
+ * the log; keysAndValue immediately follow it.
+ */
+uint32_t
+Object::getSerializedHeaderLength()
+{
+    if (!compactHeader)
+        return sizeof32(header);
+    return sizeof32(header.checksum) + sizeof32(header.timestamp) +
+           varintLength(header.version) +
+           varintLength(header.tableId << 1 | valueCompressed);
 }
 
 /**
@@ -723,6 +755,29 @@ Object::checkIntegrity()
     return computeChecksum() == header.checksum;
 }
 
+/**
+ * Choose whether the object is serialized with a compact header (see the
+ * class comment). Must be called before assembleForLog.
+ */
+void
+Object::setCompactHeader(bool enabled)
+{
+    assert(enabled || !valueCompressed);
+    compactHeader = enabled;
+}
+
+/**
+ * Record whether the object's value is compressed. Compressed values are
+ * always stored with a compact header, which is where this is recorded.
+ */
+void
+Object::setValueCompressed(bool compressed)
+{
+    valueCompressed = compressed;
+    if (compressed)
+        compactHeader = true;
+}
+
 /* Set the version for this object */
 void
 Object::setVersion(uint64_t version)
@@ -749,11 +804,18 @@ Object::applyChecksum(Crc32C *crc)
 {
     // first compute the checksum on the object header excluding the
     // checksum field
-    crc->update(reinterpret_cast<void *>(
-               reinterpret_cast<uint8_t*>(
-               &header) + sizeof(header.checksum)),
-               downCast<uint32_t>(sizeof(header) -
-               sizeof(header.checksum)));
+    if (compactHeader) {
+        uint8_t raw[MAX_COMPACT_HEADER_LENGTH];
+        uint32_t headerLength = serializeHeader(raw);
+        crc->update(raw + sizeof(header.checksum),
+                    headerLength - sizeof32(header.checksum));
+    } else {
+        crc->update(reinterpret_cast<void *>(
+                   reinterpret_cast<uint8_t*>(
+                   &header) + sizeof(header.checksum)),
+                   downCast<uint32_t>(sizeof(header) -
+                   sizeof(header.checksum)));
+    }
 
     // then compute the checksum on keysAndValue.
     if (keysAndValue) {
@@ -773,22 +835,7 @@ Object::computeChecksum()
     assert(OFFSET_OF(Header, checksum) == 0);
 
     Crc32C crc;
-    // first compute the checksum on the object header excluding the
-    // checksum field
-    crc.update(reinterpret_cast<void *>(
-               reinterpret_cast<uint8_t*>(
-               &header) + sizeof(header.checksum)),
-               downCast<uint32_t>(sizeof(header) -
-               sizeof(header.checksum)));
-
-    // then compute the checksum on keysAndValue.
-    if (keysAndValue) {
-        crc.update(keysAndValue, keysAndValueLength);
-    } else {
-        crc.update(*keysAndValueBuffer, keysAndValueOffset,
-                   getKeysAndValueLength());
-    }
-
+    applyChecksum(&crc);
     return crc.getResult();
 }
 
@@ -806,16 +853,138 @@ uint32_t
 Object::computeChecksum(const Object::Header* object,
                         uint32_t totalLength)
 {
-    Crc32C crc;
-    crc.update(reinterpret_cast<const void *>(
-               reinterpret_cast<const uint8_t *>(
-               object) + sizeof(header.checksum)),
-               downCast<uint32_t>(sizeof(header) -
-               sizeof(header.checksum)));
-
-    uint32_t len = totalLength - sizeof32(Header);
-    crc.update(&object->keysAndData[0], len);
-    return crc.getResult();
+    Object parsed(object, totalLength);
+    return parsed.computeChecksum();
+}
+
+/**
+ * Fill in #header and #compactHeader from a serialized object header in
+ * either form.
+ *
+ * \param src
+ *      The serialized header.
+ * \param length
+ *      Number of bytes available at src.
+ * \return
+ *      The length of the serialized header; keysAndValue follow it.
+ */
+uint32_t
+Object::deserializeHeader(const void* src, uint32_t length)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(src);
+    uint32_t timestamp;
+    memcpy(&timestamp, bytes + sizeof(header.checksum), sizeof(timestamp));
+    compactHeader = (timestamp & COMPACT_BIT) != 0;
+    valueCompressed = false;
+    if (!compactHeader) {
+        memcpy(&header, bytes, sizeof(header));
+        return sizeof32(header);
+    }
+
+    memcpy(&header.checksum, bytes, sizeof(header.checksum));
+    header.timestamp = timestamp & ~COMPACT_BIT;
+    uint32_t offset = sizeof32(header.checksum) + sizeof32(timestamp);
+    // The header is packed, so its fields can't be passed by pointer.
+    uint64_t version;
+    uint64_t tableIdField;
+    offset += readVarint(bytes + offset, length - offset, &version);
+    offset += readVarint(bytes + offset, length - offset, &tableIdField);
+    header.version = version;
+    header.tableId = tableIdField >> 1;
+    valueCompressed = (tableIdField & 1) != 0;
+    return offset;
+}
+
+/**
+ * Write the object's header, in compact form if #compactHeader is set.
+ *
+ * \param dst
+ *      Where to write the header; must have room for
+ *      getSerializedHeaderLength() bytes.
+ * \return
+ *      The number of bytes written.
+ */
+uint32_t
+Object::serializeHeader(void* dst)
+{
+    uint8_t* bytes = static_cast<uint8_t*>(dst);
+    if (!compactHeader) {
+        memcpy(bytes, &header, sizeof(header));
+        return sizeof32(header);
+    }
+
+    uint32_t timestamp = header.timestamp | COMPACT_BIT;
+    memcpy(bytes, &header.checksum, sizeof(header.checksum));
+    memcpy(bytes + sizeof(header.checksum), &timestamp, sizeof(timestamp));
+    uint32_t offset = sizeof32(header.checksum) + sizeof32(timestamp);
+    offset += writeVarint(header.version, bytes + offset);
+    offset += writeVarint(header.tableId << 1 | valueCompressed,
+                          bytes + offset);
+    return offset;
+}
+
+/**
+ * Decode an unsigned LEB128 varint (7 bits per byte, low-order group
+ * first, high bit set on all but the last byte).
+ *
+ * \param src
+ *      First byte of the varint.
+ * \param length
+ *      Number of bytes available at src; decoding stops there even if
+ *      the varint is incomplete.
+ * \param[out] value
+ *      The decoded value.
+ * \return
+ *      The number of bytes consumed.
+ */
+uint32_t
+Object::readVarint(const uint8_t* src, uint32_t length, uint64_t* value)
+{
+    uint64_t result = 0;
+    uint32_t i = 0;
+    while (i < length && i < 10) {
+        result |= static_cast<uint64_t>(src[i] & 0x7f) << (7 * i);
+        if ((src[i++] & 0x80) == 0)
+            break;
+    }
+    *value = result;
+    return i;
+}
+
+/**
+ * Return the number of bytes writeVarint would use to encode value.
+ */
+uint32_t
+Object::varintLength(uint64_t value)
+{
+    uint32_t length = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        length++;
+    }
+    return length;
+}
+
+/**
+ * Encode value as an unsigned LEB128 varint (see readVarint).
+ *
+ * \param value
+ *      The value to encode.
+ * \param dst
+ *      Where to write the encoding; at most 10 bytes are written.
+ * \return
+ *      The number of bytes written.
+ */
+uint32_t
+Object::writeVarint(uint64_t value, uint8_t* dst)
+{
+    uint32_t i = 0;
+    while (value >= 0x80) {
+        dst[i++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    dst[i++] = static_cast<uint8_t>(value);
+    return i;
 }
 
 /**
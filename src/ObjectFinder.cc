@@ -504,6 +504,10 @@ ObjectFinder::tryLookup(uint64_t tableId, const void* key, KeyLength keyLength)
  *      The table containing the desired object.
  * \param keyHash
  *      A hash value in the space of key hashes.
+ * \param readOnly
+ *      True means the caller only wants to read the object, so the session
+ *      may be for a recovery master that serves reads for the tablet
+ *      before its recovery completes (see Tablet::RECOVERING_READ_ONLY).
  * \return
  *      Session for communication with the server who holds the tablet.
  *      NULL session means the result is not available yet and the caller
@@ -513,10 +517,11 @@ ObjectFinder::tryLookup(uint64_t tableId, const void* key, KeyLength keyLength)
  *      The coordinator has no record of the table.
  */
 Transport::SessionRef
-ObjectFinder::tryLookup(uint64_t tableId, KeyHash keyHash)
+ObjectFinder::tryLookup(uint64_t tableId, KeyHash keyHash, bool readOnly)
 {
     // No lock needed: doesn't access ObjectFinder object.
-    TabletWithLocator* tabletWithLocator = tryLookupTablet(tableId, keyHash);
+    TabletWithLocator* tabletWithLocator =
+            tryLookupTablet(tableId, keyHash, readOnly);
     if (tabletWithLocator == NULL) {
         return Transport::SessionRef();
     }
@@ -638,6 +643,9 @@ ObjectFinder::tryLookupIndexlet(uint64_t tableId, uint8_t indexId,
  *      previous call to getTableId).
  * \param keyHash
  *      A hash value in the space of key hashes.
+ * \param readOnly
+ *      True means a tablet in the RECOVERING_READ_ONLY state will do, since
+ *      the caller only wants to read.
  * \return
  *      Reference to a tablet with the details of the server that owns
  *      the specified key. This reference may be invalidated by any future
@@ -648,14 +656,17 @@ ObjectFinder::tryLookupIndexlet(uint64_t tableId, uint8_t indexId,
  *      The coordinator has no record of the table.
  */
 TabletWithLocator*
-ObjectFinder::tryLookupTablet(uint64_t tableId, KeyHash keyHash)
+ObjectFinder::tryLookupTablet(uint64_t tableId, KeyHash keyHash,
+                              bool readOnly)
 {
     SpinLock::Guard guard(mutex);
     // First lookup the tablet in our local cache
     TabletKey key{tableId, keyHash};
     TabletWithLocator* tabletWithLocator = lookupTabletInCache(guard, &key);
     if (tabletWithLocator != NULL) {
-        if (tabletWithLocator->tablet.status == Tablet::Status::NORMAL) {
+        Tablet::Status status = tabletWithLocator->tablet.status;
+        if (status == Tablet::Status::NORMAL || (readOnly &&
+                status == Tablet::Status::RECOVERING_READ_ONLY)) {
             return tabletWithLocator;
         }
 
@@ -677,11 +688,13 @@ ObjectFinder::tryLookupTablet(uint64_t tableId, KeyHash keyHash)
     tabletWithLocator = lookupTabletInCache(guard, &key);
     if (tabletWithLocator == NULL) {
         throw TableDoesntExistException(HERE);
-    } else if (tabletWithLocator->tablet.status != Tablet::Status::NORMAL) {
-        return NULL;
-    } else {
+    }
+    Tablet::Status status = tabletWithLocator->tablet.status;
+    if (status == Tablet::Status::NORMAL || (readOnly &&
+            status == Tablet::Status::RECOVERING_READ_ONLY)) {
         return tabletWithLocator;
     }
+    return NULL;
 }
 
 /**
@@ -94,7 +94,7 @@ struct TabletWithLocator {
     /// yet fetched the session from TransportManager.
     Transport::SessionRef session;
 
-    /// If the status of the tablet is RECOVERING, this specifies the clock
+    /// If the status of the tablet isn't NORMAL, this specifies the clock
     /// time in rdtsc ticks before which we should not attempt to load the
     /// configuration information again. If the status of the tablet is
     /// NORMAL, it is simply set to 0.
@@ -104,7 +104,7 @@ struct TabletWithLocator {
         : tablet(tablet)
         , serviceLocator(serviceLocator)
         , session(NULL)
-        , nextFetchTime(tablet.status == Tablet::Status::RECOVERING ?
+        , nextFetchTime(tablet.status != Tablet::Status::NORMAL ?
                         Cycles::rdtsc() + Cycles::fromMicroseconds(10000) : 0)
     {}
 };
@@ -142,7 +142,8 @@ class ObjectFinder {
 
     Transport::SessionRef tryLookup(uint64_t tableId, const void* key,
                                     KeyLength keyLength);
-    Transport::SessionRef tryLookup(uint64_t tableId, KeyHash keyHash);
+    Transport::SessionRef tryLookup(uint64_t tableId, KeyHash keyHash,
+                                    bool readOnly = false);
     Transport::SessionRef tryLookup(uint64_t tableId, uint8_t indexId,
                                     const void* key, KeyLength keyLength,
                                     bool* indexDoesntExist);
@@ -166,7 +167,8 @@ class ObjectFinder {
                                            const void* key,
                                            KeyLength keyLength,
                                            bool* indexDoesntExist);
-    TabletWithLocator* tryLookupTablet(uint64_t tableId, KeyHash keyHash);
+    TabletWithLocator* tryLookupTablet(uint64_t tableId, KeyHash keyHash,
+                                       bool readOnly = false);
 
     /**
      * Shared RAMCloud information.
@@ -19,7 +19,7 @@
 
 namespace RAMCloud {
 struct Refresher : public ObjectFinder::TableConfigFetcher {
-    Refresher() : called(0) {}
+    Refresher() : called(0), recoveryStatus(Tablet::RECOVERING) {}
 
     void setupTableMap(std::map<TabletKey, TabletWithLocator>* tableMap)
     {
@@ -52,7 +52,7 @@ struct Refresher : public ObjectFinder::TableConfigFetcher {
         TabletWithLocator tablet7(rawTablet7, "mock:host=server5");
 
         if (called < 2) {
-            tablet2.tablet.status = Tablet::RECOVERING;
+            tablet2.tablet.status = recoveryStatus;
         }
 
         TabletKey key2 {tablet2.tablet.tableId,
@@ -123,6 +123,9 @@ struct Refresher : public ObjectFinder::TableConfigFetcher {
         return true;
     }
     uint32_t called;
+
+    /// Status of table 1's tablet for the first two fetches.
+    Tablet::Status recoveryStatus;
 };
 
 class ObjectFinderTest : public ::testing::Test {
@@ -287,6 +290,18 @@ TEST_F(ObjectFinderTest, tryLookup_keyHash) {
     EXPECT_EQ(session, objectFinder->tryLookup(1, 9999lu));
 }
 
+TEST_F(ObjectFinderTest, tryLookup_keyHash_readOnly) {
+    refresher->recoveryStatus = Tablet::RECOVERING_READ_ONLY;
+    EXPECT_TRUE(objectFinder->tryLookup(1, 9999lu) == NULL);
+    EXPECT_EQ(1U, refresher->called);
+
+    // Readers may use the recovery master right away.
+    Transport::SessionRef session = objectFinder->tryLookup(1, 9999lu, true);
+    ASSERT_TRUE(session != NULL);
+    EXPECT_EQ("mock:host=server1", session->serviceLocator);
+    EXPECT_EQ(1U, refresher->called);
+}
+
 TEST_F(ObjectFinderTest, tryLookup_index_noSuchIndex) {
     bool indexDoesntExist;
     Transport::SessionRef session = objectFinder->tryLookup(2, 99, "abc", 3,
@@ -24,6 +24,7 @@
 #include "Object.h"
 #include "PerfStats.h"
 #include "ShortMacros.h"
+#include "SlowRpcLog.h"
 #include "RawMetrics.h"
 #include "Tub.h"
 #include "ProtoBuf.h"
@@ -86,13 +87,22 @@ ObjectManager::ObjectManager(Context* context, ServerId* serverId,
     , replicaManager(context, serverId,
                      config->master.numReplicas,
                      config->master.useMinCopysets,
-                     config->master.allowLocalBackup)
+                     config->master.allowLocalBackup,
+                     config->master.maxWriteRpcsPerReplica,
+                     config->master.batchBackupWrites,
+                     config->master.forwardBackupWrites,
+                     config->master.loadAwareBackupSelection,
+                     config->master.erasureDataFragments,
+                     config->master.erasureParityFragments)
     , segmentManager(context, config, serverId,
                      allocator, replicaManager, masterTableMetadata)
     , log(context, config, this, &segmentManager, &replicaManager)
-    , objectMap(config->master.hashTableBytes / HashTable::bytesPerCacheLine())
+    , objectMap(config->master.hashTableBytes / HashTable::bytesPerCacheLine(),
+                config->master.hugePages)
+    , valueCompressor(config, &log, masterTableMetadata)
     , anyWrites(false)
     , hashTableBucketLocks()
+    , hashTableBucketVersions()
     , lockTable(1000, log)
     , mutex("ObjectManager::mutex")
     , tombstoneRemover(this, &objectMap)
@@ -216,7 +226,8 @@ ObjectManager::readHashes(const uint64_t tableId, uint32_t reqNumHashes,
         TabletManager::Tablet tablet;
         if (!tabletManager->getTablet(tableId, pKHash, &tablet))
             return;
-        if (tablet.state != TabletManager::NORMAL) {
+        if (tablet.state != TabletManager::NORMAL &&
+                tablet.state != TabletManager::LOCKED_FOR_PULL) {
             if (tablet.state == TabletManager::LOCKED_FOR_MIGRATION)
                 throw RetryException(HERE, 1000, 2000,
                         "Tablet is currently locked for migration!");
@@ -239,9 +250,19 @@ ObjectManager::readHashes(const uint64_t tableId, uint32_t reqNumHashes,
             if (object.getPKHash() == pKHash) {
                 *numObjects += 1;
                 response->emplaceAppend<uint64_t>(object.getVersion());
-                response->emplaceAppend<uint32_t>(
+                uint32_t* length = response->emplaceAppend<uint32_t>(
                         object.getKeysAndValueLength());
-                object.appendKeysAndValueToBuffer(*response);
+                if (object.isValueCompressed()) {
+                    uint32_t start = response->size();
+                    if (valueCompressor.decompress(object, response, false)
+                            != STATUS_OK) {
+                        throw RetryException(HERE, 1000, 2000,
+                                "Couldn't decompress object");
+                    }
+                    *length = response->size() - start;
+                } else {
+                    object.appendKeysAndValueToBuffer(*response);
+                }
 
                 tabletManager->incrementReadCount(object.getTableId(),
                         object.getPKHash());
@@ -286,7 +307,7 @@ ObjectManager::prefetchHashTableBucket(SegmentIterator* it)
         KeyLength primaryKeyLen = 0;
         const void *primaryKey = prefetchObj.getKey(0, &primaryKeyLen);
 
-        Key key(obj->tableId, primaryKey, primaryKeyLen);
+        Key key(prefetchObj.getTableId(), primaryKey, primaryKeyLen);
         objectMap.prefetchBucket(key.getHash());
     } else if (it->getType() == LOG_ENTRY_TYPE_OBJTOMB) {
         const ObjectTombstone::Header* tomb =
@@ -325,7 +346,6 @@ ObjectManager::readObject(Key& key, Buffer* outBuffer,
                 bool valueOnly)
 {
     objectMap.prefetchBucket(key.getHash());
-    HashTableBucketLock lock(*this, key);
 
     // If the tablet doesn't exist in the NORMAL state, we must plead ignorance.
     if (!tabletManager->checkAndIncrementReadCount(key))
@@ -335,7 +355,15 @@ ObjectManager::readObject(Key& key, Buffer* outBuffer,
     LogEntryType type;
     uint64_t version;
     Log::Reference reference;
-    bool found = lookup(lock, key, type, buffer, &version, &reference);
+    bool found;
+
+    // Reads rarely race with updates to the same bucket, so try first without
+    // the bucket lock: taking it would bounce its cache line between cores
+    // and make reads wait behind writes.
+    if (!lookupWithoutLock(key, type, buffer, &version, &reference, &found)) {
+        HashTableBucketLock lock(*this, key);
+        found = lookup(lock, key, type, buffer, &version, &reference);
+    }
     if (!found || type != LOG_ENTRY_TYPE_OBJ)
         return STATUS_OBJECT_DOESNT_EXIST;
 
@@ -352,7 +380,25 @@ ObjectManager::readObject(Key& key, Buffer* outBuffer,
     log.syncTo(reference);
 
     Object object(buffer);
-    if (valueOnly) {
+    if (object.isValueCompressed()) {
+        Status status = valueCompressor.decompress(object, outBuffer,
+                                                   valueOnly);
+        if (status != STATUS_OK)
+            return status;
+    } else if (allocator.isCold(
+            reinterpret_cast<const void*>(reference.toInteger()))) {
+        // Objects in cold storage are copied into the reply here, in the
+        // worker thread. Referring to them instead would leave the dispatch
+        // thread to fault the rest of the value in from flash while sending
+        // the reply, stalling every other RPC on the server.
+        Buffer value;
+        if (valueOnly)
+            object.appendValueToBuffer(&value);
+        else
+            object.appendKeysAndValueToBuffer(value);
+        for (Buffer::Iterator it(&value); !it.isDone(); it.next())
+            outBuffer->appendCopy(it.getData(), it.getLength());
+    } else if (valueOnly) {
         object.appendValueToBuffer(outBuffer);
     } else {
         object.appendKeysAndValueToBuffer(*outBuffer);
@@ -411,7 +457,7 @@ ObjectManager::removeObject(Key& key, RejectRules* rejectRules,
     if (!tabletManager->getTablet(key, &tablet))
         return STATUS_UNKNOWN_TABLET;
     if (tablet.state != TabletManager::NORMAL) {
-        if (tablet.state == TabletManager::LOCKED_FOR_MIGRATION)
+        if (TabletManager::isLockedForMigration(tablet.state))
             throw RetryException(HERE, 1000, 2000,
                     "Tablet is currently locked for migration!");
         return STATUS_UNKNOWN_TABLET;
@@ -488,6 +534,86 @@ ObjectManager::removeObject(Key& key, RejectRules* rejectRules,
     return STATUS_OK;
 }
 
+/**
+ * Copy the live objects of a tablet into a segment by scanning a range of
+ * buckets in the hash table, rather than the log. This is used to pull a
+ * tablet's data during migration (see MasterService::pullTablet); the
+ * tablet must not be accepting writes.
+ *
+ * Buckets are scanned in order; the objects from a bucket are copied only
+ * if they all fit in the segment, so that no bucket is ever split between
+ * two calls.
+ *
+ * \param tableId
+ *      Identifier for the table containing the tablet.
+ * \param firstKeyHash
+ *      Lowest key hash in the tablet.
+ * \param lastKeyHash
+ *      Highest key hash in the tablet.
+ * \param startBucket
+ *      Index of the first hash table bucket to scan.
+ * \param endBucket
+ *      1 + the index of the last bucket to scan.
+ * \param maxBytes
+ *      Stop scanning once the segment contains at least this many bytes.
+ * \param segment
+ *      Objects are appended here.
+ * \return
+ *      The index of the first bucket that wasn't scanned; if this equals
+ *      endBucket, the range is finished.
+ */
+uint64_t
+ObjectManager::copyTabletObjects(uint64_t tableId, uint64_t firstKeyHash,
+        uint64_t lastKeyHash, uint64_t startBucket, uint64_t endBucket,
+        uint32_t maxBytes, Segment* segment)
+{
+    if (endBucket > objectMap.getNumBuckets())
+        endBucket = objectMap.getNumBuckets();
+
+    // The tablet's compressed objects are useless to the receiver without
+    // the table's dictionaries, so send those first.
+    if (startBucket == 0)
+        valueCompressor.appendDictionaries(tableId, segment);
+
+    vector<uint64_t> references;
+    vector<uint32_t> lengths;
+    TabletObjectsParameters params = { this, tableId, firstKeyHash,
+                                       lastKeyHash, &references };
+    uint64_t bucket;
+    for (bucket = startBucket; bucket < endBucket; bucket++) {
+        if (segment->getAppendedLength() >= maxBytes)
+            break;
+
+        HashTableBucketLock lock(*this, bucket);
+        references.clear();
+        objectMap.forEachInBucket(collectTabletObject, &params, bucket);
+        if (references.empty())
+            continue;
+
+        lengths.clear();
+        foreach (uint64_t reference, references) {
+            Buffer buffer;
+            log.getEntry(Log::Reference(reference), buffer);
+            lengths.push_back(buffer.size());
+        }
+        if (!segment->hasSpaceFor(lengths.data(),
+                downCast<uint32_t>(lengths.size()))) {
+            if (segment->getAppendedLength() == 0) {
+                throw FatalError(HERE, format("Objects in hash table bucket "
+                        "%lu don't fit in an empty segment", bucket));
+            }
+            break;
+        }
+        foreach (uint64_t reference, references) {
+            Buffer buffer;
+            log.getEntry(Log::Reference(reference), buffer);
+            segment->append(LOG_ENTRY_TYPE_OBJ, buffer);
+            PerfStats::threadStats.migrationPhase1Bytes += buffer.size();
+        }
+    }
+    return bucket;
+}
+
 /**
  * Scan the hashtable and remove all objects that do not belong to a
  * tablet currently owned by this master. Used to clean up any objects
@@ -638,13 +764,13 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
             KeyLength primaryKeyLen = 0;
             const void *primaryKey = replayObj.getKey(0, &primaryKeyLen);
 
-            Key key(recoveryObj->tableId, primaryKey, primaryKeyLen);
+            Key key(replayObj.getTableId(), primaryKey, primaryKeyLen);
 
             // If table is an BTree table,i.e., tableId exists in
             // nextNodeIdMap, update nextNodeId of its table.
             if (nextNodeIdMap) {
                 std::unordered_map<uint64_t, uint64_t>::iterator iter
-                    = nextNodeIdMap->find(recoveryObj->tableId);
+                    = nextNodeIdMap->find(replayObj.getTableId());
                 if (iter != nextNodeIdMap->end()) {
                     const uint64_t *bTreeKey =
                         reinterpret_cast<const uint64_t*>(primaryKey);
@@ -656,12 +782,11 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
 
             bool checksumIsValid = ({
                 CycleCounter<uint64_t> c(&verifyChecksumTicks);
-                Object::computeChecksum(recoveryObj, it.getLength()) ==
-                    recoveryObj->checksum;
+                replayObj.checkIntegrity();
             });
             if (expect_false(!checksumIsValid)) {
                 LOG(WARNING, "bad object checksum! key: %s, version: %lu",
-                    key.toString().c_str(), recoveryObj->version);
+                    key.toString().c_str(), replayObj.getVersion());
                 // JIRA Issue: RAM-673:
                 // Should throw and try another segment replica.
             }
@@ -1099,6 +1224,20 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
                         "(leaseId: %lu, txId: %lu)",
                         txId.clientLeaseId, txId.clientTransactionId);
             }
+        } else if (type == LOG_ENTRY_TYPE_VALUEDICT) {
+            Buffer buffer;
+            it.appendToBuffer(buffer);
+
+            // Every segment holding a table's objects may carry a copy of
+            // its dictionaries, so only the first copy is kept.
+            if (valueCompressor.installDictionary(buffer)) {
+                CycleCounter<uint64_t> _(&segmentAppendTicks);
+                sideLog->append(LOG_ENTRY_TYPE_VALUEDICT, buffer);
+                TableStats::increment(masterTableMetadata,
+                        buffer.getStart<ValueCompressor::DictionaryHeader>()
+                            ->tableId,
+                        buffer.size(), 1);
+            }
         }
     }
 
@@ -1194,7 +1333,7 @@ ObjectManager::writeObject(Object& newObject, RejectRules* rejectRules,
         return STATUS_UNKNOWN_TABLET;
     }
     if (tablet.state != TabletManager::NORMAL) {
-        if (tablet.state == TabletManager::LOCKED_FOR_MIGRATION)
+        if (TabletManager::isLockedForMigration(tablet.state))
             throw RetryException(HERE, 1000, 2000,
                     "Tablet is currently locked for migration!");
         return STATUS_UNKNOWN_TABLET;
@@ -1269,7 +1408,22 @@ ObjectManager::writeObject(Object& newObject, RejectRules* rejectRules,
     // record should exist if and only if new object is written.
     Log::AppendVector appends[2 + (rpcResult ? 1 : 0)];
 
-    newObject.assembleForLog(appends[0].buffer);
+    // If the value compresses, what goes in the log is a copy of newObject
+    // with the compressed value in place of the original.
+    Buffer compressedKeysAndValue;
+    Tub<Object> compressedObject;
+    if (valueCompressor.compress(newObject, &compressedKeysAndValue)) {
+        compressedObject.construct(newObject.getTableId(),
+                                   newObject.getVersion(),
+                                   newObject.getTimestamp(),
+                                   compressedKeysAndValue);
+        compressedObject->setValueCompressed(true);
+        chooseObjectHeader(*compressedObject);
+        compressedObject->assembleForLog(appends[0].buffer);
+    } else {
+        chooseObjectHeader(newObject);
+        newObject.assembleForLog(appends[0].buffer);
+    }
     appends[0].type = LOG_ENTRY_TYPE_OBJ;
 
     // Note: only check for enough space for the object (tombstones
@@ -2016,6 +2170,7 @@ ObjectManager::commitWrite(PreparedOp& op,
     byteCount += appends[0].buffer.size();
     recordCount++;
 
+    chooseObjectHeader(op.object);
     op.object.assembleForLog(appends[1].buffer);
     appends[1].type = LOG_ENTRY_TYPE_OBJ;
     byteCount += appends[1].buffer.size();
@@ -2255,7 +2410,7 @@ ObjectManager::prepareForLog(Object& newObject, Buffer *logBuffer,
     if (!tabletManager->getTablet(key, &tablet))
         return STATUS_UNKNOWN_TABLET;
     if (tablet.state != TabletManager::NORMAL) {
-        if (tablet.state == TabletManager::LOCKED_FOR_MIGRATION)
+        if (TabletManager::isLockedForMigration(tablet.state))
             DIE("Tablet is currently locked for migration!");
         return STATUS_UNKNOWN_TABLET;
     }
@@ -2296,6 +2451,7 @@ ObjectManager::prepareForLog(Object& newObject, Buffer *logBuffer,
                             WallTime::secondsTimestamp());
     }
 
+    chooseObjectHeader(newObject);
     Segment::appendLogHeader(LOG_ENTRY_TYPE_OBJ,
                              newObject.getSerializedLength(),
                              logBuffer);
@@ -2305,7 +2461,8 @@ ObjectManager::prepareForLog(Object& newObject, Buffer *logBuffer,
     uint32_t valueOffset = 0;
 
     newObject.getValueOffset(&valueOffset);
-    objectOffset = lengthBefore + sizeof32(Object::Header) + valueOffset;
+    objectOffset = lengthBefore + newObject.getSerializedHeaderLength() +
+                   valueOffset;
 
     void* target = logBuffer->alloc(newObject.getSerializedLength());
     newObject.assembleForLog(target);
@@ -2349,7 +2506,7 @@ ObjectManager::writeTombstone(Key& key, Buffer *logBuffer)
     if (!tabletManager->getTablet(key, &tablet))
         return STATUS_UNKNOWN_TABLET;
     if (tablet.state != TabletManager::NORMAL) {
-        if (tablet.state == TabletManager::LOCKED_FOR_MIGRATION)
+        if (TabletManager::isLockedForMigration(tablet.state))
             throw RetryException(HERE, 1000, 2000,
                     "Tablet is currently locked for migration!");
         return STATUS_UNKNOWN_TABLET;
@@ -2440,6 +2597,8 @@ ObjectManager::relocate(LogEntryType type, Buffer& oldBuffer,
         transactionManager->relocateParticipantList(oldBuffer,
                                                     oldReference,
                                                     relocator);
+    else if (type == LOG_ENTRY_TYPE_VALUEDICT)
+        relocateValueDictionary(oldBuffer, relocator);
 }
 
 /**
@@ -2513,6 +2672,33 @@ ObjectManager::TombstoneProtector::~TombstoneProtector()
     }
 }
 
+/**
+ * Decide whether a new object about to be appended to the log should use
+ * the compact header (see Object). Small objects do, if enabled by
+ * config->master.compactObjectThreshold and if that actually saves space
+ * (it won't for enormous versions or table ids).
+ *
+ * \param object
+ *      The object to be appended; its version and table id must be final.
+ */
+void
+ObjectManager::chooseObjectHeader(Object& object)
+{
+    // Only compact headers can mark compressed values (and they can't
+    // represent table ids with the top bit set, which are never compressed).
+    if (object.isValueCompressed())
+        return;
+    object.setCompactHeader(false);
+    if (object.getTableId() >> 63)
+        return;
+    if (object.getKeysAndValueLength() >
+            config->master.compactObjectThreshold)
+        return;
+    object.setCompactHeader(true);
+    if (object.getSerializedHeaderLength() >= sizeof32(Object::Header))
+        object.setCompactHeader(false);
+}
+
 /**
  * Produce a human-readable description of the contents of a segment.
  * Intended primarily for use in unit tests.
@@ -2607,6 +2793,15 @@ ObjectManager::dumpSegment(Segment* segment)
                     participantList.getTransactionId().clientLeaseId,
                     participantList.getTransactionId().clientTransactionId,
                     participantList.getParticipantCount());
+        } else if (type == LOG_ENTRY_TYPE_VALUEDICT) {
+            Buffer buffer;
+            it.appendToBuffer(buffer);
+            const ValueCompressor::DictionaryHeader* header =
+                buffer.getStart<ValueCompressor::DictionaryHeader>();
+            result += format("%svalueDictionary at offset %u, length %u with "
+                    "tableId %lu, dictionaryId 0x%08x",
+                    separator, it.getOffset(), it.getLength(),
+                    header->tableId, header->dictionaryId);
         }
 
         it.next();
@@ -2705,6 +2900,8 @@ ObjectManager::lookup(HashTableBucketLock& lock, Key& key,
                 Log::Reference* outReference,
                 HashTable::Candidates* outCandidates)
 {
+    CycleCounter<uint64_t> lookupTimer(
+            &SlowRpcLog::threadTimes.hashLookupCycles);
     HashTable::Candidates candidates;
     objectMap.lookup(key.getHash(), candidates);
     while (!candidates.isDone()) {
@@ -2738,6 +2935,129 @@ ObjectManager::lookup(HashTableBucketLock& lock, Key& key,
     return false;
 }
 
+/**
+ * Read into memory the beginnings of any log entries in cold storage that a
+ * given key's hash table bucket refers to. This is called before taking the
+ * bucket lock (see HashTableBucketLock) so that lookup() won't have to wait
+ * for flash while holding it and stall every other thread that needs the
+ * bucket.
+ *
+ * Only the first COLD_FAULT_IN_BYTES of each entry are touched (enough for
+ * the entry and object headers and typical keys); readObject() copies the
+ * rest of an object into its reply, without any locks held. The entries
+ * aren't parsed, since without the lock they may be in the middle of being
+ * cleaned.
+ *
+ * \param key
+ *      Key whose candidate entries are to be faulted in.
+ */
+void
+ObjectManager::faultInColdEntries(Key& key)
+{
+    if (allocator.getTotalCount(SegletAllocator::COLD) == 0)
+        return;
+
+    // The hash table's overflow cache lines are never freed, so the bucket
+    // can safely be walked without the lock.
+    HashTable::Candidates candidates;
+    objectMap.lookup(key.getHash(), candidates);
+    while (!candidates.isDone()) {
+        allocator.faultInColdMemory(
+                reinterpret_cast<const void*>(candidates.getReference()),
+                COLD_FAULT_IN_BYTES);
+        candidates.next();
+    }
+}
+
+/**
+ * Look up an object or tombstone like lookup(), but without holding the hash
+ * table bucket lock. Instead, the bucket's entry in hashTableBucketVersions is
+ * checked before the lookup and again before following each candidate
+ * reference and at the end; if it changed, an update overlapped the lookup
+ * and the result can't be trusted.
+ *
+ * The log entries themselves need no such checks. A reference read while the
+ * bucket was unchanged was current at that moment, and the segment holding it
+ * can't be freed until every RPC in progress then has finished (see
+ * LogProtector), so it remains readable for the rest of this RPC. Callers
+ * outside of RPCs must not run concurrently with the cleaner.
+ *
+ * \param key
+ *      Key of the object being looked up.
+ * \param[out] outType
+ *      The type of the log entry is returned here.
+ * \param[out] buffer
+ *      The entry, if found, is appended to this buffer. Nothing is appended
+ *      if false is returned.
+ * \param[out] outVersion
+ *      The version of the object or tombstone, when one is found, stored in
+ *      this parameter.
+ * \param[out] outReference
+ *      The log reference to the entry, if found, is stored in this parameter.
+ * \param[out] outFound
+ *      If true is returned, this indicates whether an entry matching the key
+ *      was found.
+ * \return
+ *      False if the bucket was being updated, in which case the caller should
+ *      retry with lookup() while holding the bucket lock. Otherwise true.
+ */
+bool
+ObjectManager::lookupWithoutLock(Key& key, LogEntryType& outType,
+                Buffer& buffer, uint64_t* outVersion,
+                Log::Reference* outReference, bool* outFound)
+{
+    CycleCounter<uint64_t> lookupTimer(
+            &SlowRpcLog::threadTimes.hashLookupCycles);
+    uint64_t unused;
+    uint64_t bucket = HashTable::findBucketIndex(objectMap.getNumBuckets(),
+                                                 key.getHash(), &unused);
+    Atomic<uint64_t>& bucketVersion = hashTableBucketVersions[
+        bucket & (arrayLength(hashTableBucketVersions) - 1)];
+    uint64_t startVersion = bucketVersion.load();
+    if ((startVersion & 1) != 0)
+        return false;
+    // The loads below must not be hoisted above the version check. x86
+    // doesn't reorder loads, so only the compiler needs to be stopped.
+    Fence::compilerBarrier();
+
+    HashTable::Candidates candidates;
+    objectMap.lookup(key.getHash(), candidates);
+    while (!candidates.isDone()) {
+        // Don't follow the reference unless it was current when read.
+        Log::Reference candidateRef(candidates.getReference());
+        Fence::compilerBarrier();
+        if (bucketVersion.load() != startVersion)
+            return false;
+
+        Buffer candidateBuffer;
+        LogEntryType type = log.getEntry(candidateRef, candidateBuffer);
+
+        Key candidateKey(type, candidateBuffer);
+        if (key == candidateKey) {
+            outType = type;
+            buffer.append(&candidateBuffer);
+            if (type == LOG_ENTRY_TYPE_OBJ) {
+                Object o(candidateBuffer);
+                *outVersion = o.getVersion();
+            } else {
+                ObjectTombstone o(candidateBuffer);
+                *outVersion = o.getObjectVersion();
+            }
+            *outReference = candidateRef;
+            *outFound = true;
+            return true;
+        }
+
+        candidates.next();
+    }
+
+    Fence::compilerBarrier();
+    if (bucketVersion.load() != startVersion)
+        return false;
+    *outFound = false;
+    return true;
+}
+
 /**
  * Remove an object from the hash table, if it exists in it. Return whether or
  * not it was found and removed.
@@ -2808,6 +3128,36 @@ ObjectManager::removeIfOrphanedObject(uint64_t reference, void *cookie)
     }
 }
 
+/**
+ * Callback used by copyTabletObjects: records the reference if it refers
+ * to an object in the tablet being copied.
+ *
+ * \param reference
+ *      Reference into the log for an entry in the hash table.
+ * \param cookie
+ *      Pointer to a TabletObjectsParameters structure.
+ */
+void
+ObjectManager::collectTabletObject(uint64_t reference, void *cookie)
+{
+    TabletObjectsParameters* params =
+            reinterpret_cast<TabletObjectsParameters*>(cookie);
+    LogEntryType type;
+    Buffer buffer;
+
+    type = params->objectManager->log.getEntry(Log::Reference(reference),
+            buffer);
+    if (type != LOG_ENTRY_TYPE_OBJ)
+        return;
+
+    Key key(type, buffer);
+    if (key.getTableId() == params->tableId &&
+            key.getHash() >= params->firstKeyHash &&
+            key.getHash() <= params->lastKeyHash) {
+        params->references->push_back(reference);
+    }
+}
+
 /**
  * This function is a callback used to purge the tombstones from the hash
  * table after a recovery has taken place. It is invoked by HashTable::
@@ -3257,6 +3607,59 @@ ObjectManager::relocateTxDecisionRecord(
     }
 }
 
+/**
+ * Callback used by the LogCleaner when it's cleaning a Segment and comes
+ * across a value compression dictionary (see ValueCompressor).
+ *
+ * A dictionary is kept as long as this master owns any tablet of its table:
+ * the table's live objects may have been compressed with it, and finding
+ * out which dictionaries those objects use isn't worth the trouble for
+ * entries this rare.
+ *
+ * \param oldBuffer
+ *      Buffer pointing to the dictionary's current location, which will soon
+ *      be invalidated.
+ * \param relocator
+ *      The relocator may be used to store the dictionary in a new location
+ *      if it is still alive. It also provides a reference to the new
+ *      location and keeps track of whether this call wanted the dictionary
+ *      anymore or not.
+ *
+ *      It is possible that relocation may fail (because more memory needs to
+ *      be allocated). In this case, the callback should just return. The
+ *      cleaner will note the failure, allocate more memory, and try again.
+ */
+void
+ObjectManager::relocateValueDictionary(
+        Buffer& oldBuffer, LogEntryRelocator& relocator)
+{
+    uint64_t tableId =
+        oldBuffer.getStart<ValueCompressor::DictionaryHeader>()->tableId;
+
+    bool needed = false;
+    vector<TabletManager::Tablet> tablets;
+    tabletManager->getTablets(&tablets);
+    foreach (TabletManager::Tablet& tablet, tablets) {
+        if (tablet.tableId == tableId) {
+            needed = true;
+            break;
+        }
+    }
+
+    if (needed) {
+        // Try to relocate it. If it fails, just return. The cleaner will
+        // allocate more memory and retry.
+        if (!relocator.append(LOG_ENTRY_TYPE_VALUEDICT, oldBuffer))
+            return;
+    } else {
+        // Dictionary will be dropped/"cleaned" so stats should be updated.
+        TableStats::decrement(masterTableMetadata,
+                              tableId,
+                              oldBuffer.size(),
+                              1);
+    }
+}
+
 /**
  * Insert an object reference into the hash table, or replace the object
  * reference currently associated with the key if one already exists in the
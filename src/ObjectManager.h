@@ -17,6 +17,7 @@
 #define RAMCLOUD_OBJECTMANAGER_H
 
 #include "Common.h"
+#include "Fence.h"
 #include "Log.h"
 #include "SideLog.h"
 #include "LogEntryHandlers.h"
@@ -38,6 +39,7 @@
 #include "MasterTableMetadata.h"
 #include "UnackedRpcResults.h"
 #include "LockTable.h"
+#include "ValueCompressor.h"
 
 namespace RAMCloud {
 
@@ -74,6 +76,9 @@ class ObjectManager : public LogEntryHandlers,
                 uint32_t maxLength, Buffer* response, uint32_t* respNumHashes,
                 uint32_t* numObjects);
     void prefetchHashTableBucket(SegmentIterator* it);
+    uint64_t copyTabletObjects(uint64_t tableId, uint64_t firstKeyHash,
+                uint64_t lastKeyHash, uint64_t startBucket,
+                uint64_t endBucket, uint32_t maxBytes, Segment* segment);
     Status readObject(Key& key, Buffer* outBuffer,
                 RejectRules* rejectRules, uint64_t* outVersion,
                 bool valueOnly = false);
@@ -133,6 +138,8 @@ class ObjectManager : public LogEntryHandlers,
     Log* getLog() { return &log; }
     ReplicaManager* getReplicaManager() { return &replicaManager; }
     HashTable* getObjectMap() { return &objectMap; }
+    SegletAllocator* getSegletAllocator() { return &allocator; }
+    ValueCompressor* getValueCompressor() { return &valueCompressor; }
 
     /**
      * An object of this class must be held by any activity that places
@@ -155,6 +162,10 @@ class ObjectManager : public LogEntryHandlers,
     };
 
   PRIVATE:
+    /// Number of bytes at the start of each candidate entry in cold storage
+    /// that faultInColdEntries() brings into memory before a bucket is locked.
+    enum { COLD_FAULT_IN_BYTES = 1024 };
+
     /**
      * An instance of this class locks the bucket of the hash table that a given
      * key maps into. The lock is taken in the constructor and released in the
@@ -169,7 +180,9 @@ class ObjectManager : public LogEntryHandlers,
       public:
         /**
          * This constructor finds the bucket a given key maps to in the hash
-         * table and acquires the lock.
+         * table and acquires the lock. Any of the key's candidate entries in
+         * cold storage are read in from flash first, so the lock is never
+         * held across such page faults.
          *
          * \param objectManager
          *      The ObjectManager that owns the hash table bucket to lock.
@@ -178,7 +191,9 @@ class ObjectManager : public LogEntryHandlers,
          */
         HashTableBucketLock(ObjectManager& objectManager, Key& key)
             : lock(NULL)
+            , version(NULL)
         {
+            objectManager.faultInColdEntries(key);
             uint64_t unused;
             uint64_t bucket = HashTable::findBucketIndex(
                         objectManager.objectMap.getNumBuckets(),
@@ -197,12 +212,16 @@ class ObjectManager : public LogEntryHandlers,
          */
         HashTableBucketLock(ObjectManager& objectManager, uint64_t bucket)
             : lock(NULL)
+            , version(NULL)
         {
             takeBucketLock(objectManager, bucket);
         }
 
         ~HashTableBucketLock()
         {
+            // Make our changes visible before the version becomes even.
+            Fence::sfence();
+            version->store(version->load() + 1);
             lock->unlock();
         }
 
@@ -225,12 +244,22 @@ class ObjectManager : public LogEntryHandlers,
             uint64_t lockIndex = bucket & (numLocks - 1);
             lock = &objectManager.hashTableBucketLocks[lockIndex];
             lock->lock();
+
+            // The version stays odd while we hold the lock, telling lock-free
+            // readers that the bucket may be changing.
+            version = &objectManager.hashTableBucketVersions[lockIndex];
+            version->store(version->load() + 1);
+            Fence::sfence();
         }
 
         /// The hash table bucket spinlock this object acquired in the
         /// constructor and will release in the destructor.
         SpinLock* lock;
 
+        /// The entry of ObjectManager::hashTableBucketVersions corresponding
+        /// to #lock. Bumped when the lock is taken and again when released.
+        Atomic<uint64_t>* version;
+
         DISALLOW_COPY_AND_ASSIGN(HashTableBucketLock);
     };
 
@@ -248,6 +277,23 @@ class ObjectManager : public LogEntryHandlers,
         ObjectManager::HashTableBucketLock* lock;
     };
 
+    /**
+     * Struct used to pass parameters into the collectTabletObject method
+     * through the generic HashTable::forEachInBucket method.
+     */
+    struct TabletObjectsParameters {
+        /// Pointer to the ObjectManager class owning the hash table.
+        ObjectManager* objectManager;
+
+        /// Identifies the tablet whose objects are wanted.
+        uint64_t tableId;
+        uint64_t firstKeyHash;
+        uint64_t lastKeyHash;
+
+        /// References to the tablet's objects are appended here.
+        vector<uint64_t>* references;
+    };
+
     /**
      * This object executes in the background (as a WorkerTimer) to remove
      * tombstones that were added to the objectMap by replaySegment().
@@ -274,6 +320,7 @@ class ObjectManager : public LogEntryHandlers,
         DISALLOW_COPY_AND_ASSIGN(TombstoneRemover);
     };
 
+    void chooseObjectHeader(Object& object);
     static string dumpSegment(Segment* segment);
     uint32_t getObjectTimestamp(Buffer& buffer);
     uint32_t getTombstoneTimestamp(Buffer& buffer);
@@ -283,8 +330,13 @@ class ObjectManager : public LogEntryHandlers,
                 uint64_t* outVersion = NULL,
                 Log::Reference* outReference = NULL,
                 HashTable::Candidates* outCandidates = NULL);
+    void faultInColdEntries(Key& key);
+    bool lookupWithoutLock(Key& key, LogEntryType& outType, Buffer& buffer,
+                uint64_t* outVersion, Log::Reference* outReference,
+                bool* outFound);
     friend void recoveryCleanup(uint64_t maybeTomb, void *cookie);
     bool remove(HashTableBucketLock& lock, Key& key);
+    static void collectTabletObject(uint64_t reference, void *cookie);
     static void removeIfOrphanedObject(uint64_t reference, void *cookie);
     static void removeIfTombstone(uint64_t maybeTomb, void *cookie);
     void removeTombstones();
@@ -301,6 +353,8 @@ class ObjectManager : public LogEntryHandlers,
             LogEntryRelocator& relocator);
     void relocateTxDecisionRecord(
             Buffer& oldBuffer, LogEntryRelocator& relocator);
+    void relocateValueDictionary(
+            Buffer& oldBuffer, LogEntryRelocator& relocator);
     bool replace(HashTableBucketLock& lock, Key& key, Log::Reference reference);
 
     /**
@@ -378,6 +432,12 @@ class ObjectManager : public LogEntryHandlers,
      */
     HashTable objectMap;
 
+    /**
+     * Compresses the values of objects written by writeObject and
+     * decompresses them when they are read.
+     */
+    ValueCompressor valueCompressor;
+
     /**
      * Used to identify the first write request, so that we can initialize
      * connections to all backups at that time (this is a temporary kludge
@@ -394,6 +454,16 @@ class ObjectManager : public LogEntryHandlers,
      */
     UnnamedSpinLock hashTableBucketLocks[1024];
 
+    /**
+     * Sequence numbers that let readObject() look up objects without taking
+     * hashTableBucketLocks, seqlock-style. Each corresponds to the lock with
+     * the same index, and is incremented when that lock is acquired and again
+     * when it is released (see HashTableBucketLock). It is odd exactly when
+     * the lock is held; a lock-free reader that sees it unchanged across its
+     * lookup knows that no update to the bucket overlapped it.
+     */
+    Atomic<uint64_t> hashTableBucketVersions[1024];
+
     /**
      * Locks objects during transactions.
      */
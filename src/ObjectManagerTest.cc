@@ -614,6 +614,62 @@ TEST_F(ObjectManagerTest, readObject) {
         tabletManager.toString());
 }
 
+TEST_F(ObjectManagerTest, readObject_cold) {
+    ServerConfig config(masterConfig);
+    config.master.coldStorageFile =
+        format("/tmp/ramcloud-cold-storage-test-%d", getpid());
+    config.master.coldStorageBytes = 2 * config.segmentSize;
+    ObjectManager coldManager(&context,
+                              &serverId,
+                              &config,
+                              &tabletManager,
+                              &masterTableMetadata,
+                              &unackedRpcResults,
+                              &transactionManager,
+                              &txRecoveryManager);
+    tabletManager.addTablet(1, 0, ~0UL, TabletManager::NORMAL);
+
+    // Write an object directly into a cold segment (as the cleaner would
+    // when demoting) and drop its pages from memory.
+    LogSegment* segment = coldManager.segmentManager.allocSideSegment(
+        SegmentManager::FOR_CLEANING | SegmentManager::COLD);
+    ASSERT_NE(static_cast<LogSegment*>(NULL), segment);
+    ASSERT_TRUE(segment->isCold);
+    Key key(1, "1", 1);
+    string value(3000, 'c');
+    Buffer dataBuffer;
+    Object o(key, value.c_str(), downCast<uint32_t>(value.size()), 93, 0,
+             dataBuffer);
+    Buffer objectBuffer;
+    o.assembleForLog(objectBuffer);
+    Log::Reference reference;
+    ASSERT_TRUE(segment->append(LOG_ENTRY_TYPE_OBJ, objectBuffer,
+                                &reference));
+    {
+        ObjectManager::HashTableBucketLock lock(coldManager, key);
+        coldManager.replace(lock, key, reference);
+    }
+    segment->close();
+    segment->closedCommitted = true;
+    const void* start = NULL;
+    segment->peek(0, &start);
+    coldManager.allocator.releaseColdMemory(start, config.segletSize);
+
+    // The reply must hold copies of the keys and value, not references
+    // into cold storage that the transport would fault in.
+    Buffer buffer;
+    EXPECT_EQ(STATUS_OK, coldManager.readObject(key, &buffer, 0, 0, true));
+    EXPECT_EQ(value, string(static_cast<const char*>(
+        buffer.getRange(0, buffer.size())), buffer.size()));
+    for (Buffer::Iterator it(&buffer); !it.isDone(); it.next())
+        EXPECT_FALSE(coldManager.allocator.isCold(it.getData()));
+
+    buffer.reset();
+    EXPECT_EQ(STATUS_OK, coldManager.readObject(key, &buffer, 0, 0, false));
+    for (Buffer::Iterator it(&buffer); !it.isDone(); it.next())
+        EXPECT_FALSE(coldManager.allocator.isCold(it.getData()));
+}
+
 static bool
 antiGetEntryFilter(string s)
 {
@@ -735,6 +791,47 @@ TEST_F(ObjectManagerTest, removeObject_returnRemovedObj) {
                            oldValueLength));
 }
 
+TEST_F(ObjectManagerTest, copyTabletObjects) {
+    Key key1(1, "1", 1);
+    Key key2(1, "2", 1);
+    Key key3(2, "3", 1);
+    Key key4(1, "4", 1);
+    storeObject(key1, "one");
+    storeObject(key2, "two");
+    storeObject(key3, "three");
+    storeTombstone(key4);
+    uint64_t numBuckets = objectManager.objectMap.getNumBuckets();
+
+    // Only live objects in the tablet are copied.
+    Segment segment;
+    EXPECT_EQ(numBuckets, objectManager.copyTabletObjects(1, 0, ~0UL, 0,
+            numBuckets + 10, 1000000, &segment));
+    int count = 0;
+    for (SegmentIterator it(segment); !it.isDone(); it.next()) {
+        EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, it.getType());
+        count++;
+    }
+    EXPECT_EQ(2, count);
+
+    // Scanning stops once maxBytes has been reached.
+    Segment segment2;
+    uint64_t nextBucket = objectManager.copyTabletObjects(1, 0, ~0UL, 0,
+            numBuckets, 1, &segment2);
+    EXPECT_LT(nextBucket, numBuckets);
+    count = 0;
+    for (SegmentIterator it(segment2); !it.isDone(); it.next()) {
+        count++;
+    }
+    EXPECT_EQ(1, count);
+    EXPECT_EQ(numBuckets, objectManager.copyTabletObjects(1, 0, ~0UL,
+            nextBucket, numBuckets, 1000000, &segment2));
+    count = 0;
+    for (SegmentIterator it(segment2); !it.isDone(); it.next()) {
+        count++;
+    }
+    EXPECT_EQ(2, count);
+}
+
 TEST_F(ObjectManagerTest, removeOrphanedObjects) {
     tabletManager.addTablet(97, 0, ~0UL, TabletManager::NORMAL);
 
@@ -1643,6 +1740,66 @@ TEST_F(ObjectManagerTest, writeObject) {
     objectManager.getLog()->totalLiveBytes = original;
 }
 
+TEST_F(ObjectManagerTest, writeObject_compactHeader) {
+    masterConfig.master.compactObjectThreshold = 64;
+    tabletManager.addTablet(1, 0, ~0UL, TabletManager::NORMAL);
+    TestLog::Enable _(writeObjectFilter);
+
+    // Small object: 10-byte header instead of 24.
+    Key key(1, "1", 1);
+    Buffer buffer;
+    Object obj(key, "value", 5, 0, 0, buffer);
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(obj, 0, 0));
+    EXPECT_EQ("writeObject: object: 19 bytes, version 1", TestLog::get());
+
+    Buffer value;
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key, &value, 0, 0));
+    EXPECT_EQ("value", TestUtil::toString(&value));
+
+    // Objects over the threshold keep the full header.
+    TestLog::reset();
+    char big[100];
+    memset(big, 'x', sizeof(big));
+    Key key2(1, "2", 1);
+    Buffer buffer2;
+    Object obj2(key2, big, sizeof32(big), 0, 0, buffer2);
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(obj2, 0, 0));
+    EXPECT_EQ("writeObject: object: 128 bytes, version 2", TestLog::get());
+}
+
+#if ENABLE_LZ4
+TEST_F(ObjectManagerTest, writeObject_compressedValue) {
+    masterConfig.master.valueDictionaryBytes = 100;
+    tabletManager.addTablet(1, 0, ~0UL, TabletManager::NORMAL);
+
+    // The first values are sampled for the dictionary; the rest are
+    // compressed with it.
+    for (int i = 0; i < 4; i++) {
+        string key = format("%d", i);
+        string value = format("{\"name\": \"user%04d\", \"status\": "
+                "\"active\"}", i);
+        Key k(1, key.data(), downCast<uint16_t>(key.size()));
+        Buffer buffer;
+        Object obj(k, value.data(), downCast<uint32_t>(value.size()), 0, 0,
+                   buffer);
+        EXPECT_EQ(STATUS_OK, objectManager.writeObject(obj, 0, 0));
+    }
+    TableStats::Block& stats = masterTableMetadata.find(1)->stats;
+    EXPECT_LT(0U, stats.compressionInputBytes);
+    EXPECT_LT(stats.compressionOutputBytes, stats.compressionInputBytes);
+
+    for (int i = 0; i < 4; i++) {
+        string key = format("%d", i);
+        Key k(1, key.data(), downCast<uint16_t>(key.size()));
+        Buffer value;
+        EXPECT_EQ(STATUS_OK, objectManager.readObject(k, &value, 0, 0));
+        EXPECT_EQ(format("{\"name\": \"user%04d\", \"status\": "
+                "\"active\"}", i), TestUtil::toString(&value));
+    }
+    EXPECT_LT(0U, stats.decompressionCount);
+}
+#endif
+
 TEST_F(ObjectManagerTest, writeObject_returnRemovedObj) {
     tabletManager.addTablet(1, 0, ~0UL, TabletManager::NORMAL);
     Key key(1, "a", 1);
@@ -2300,6 +2457,41 @@ TEST_F(ObjectManagerTest, lookup_tombstone) {
     EXPECT_EQ(reference, r);
 }
 
+TEST_F(ObjectManagerTest, lookupWithoutLock) {
+    Key key(1, "1", 1);
+    Buffer buffer;
+    LogEntryType type;
+    uint64_t v;
+    Log::Reference r;
+    bool found = true;
+
+    EXPECT_TRUE(objectManager.lookupWithoutLock(key, type, buffer, &v, &r,
+                                                &found));
+    EXPECT_FALSE(found);
+
+    Log::Reference reference = storeObject(key, "value", 15);
+    EXPECT_TRUE(objectManager.lookupWithoutLock(key, type, buffer, &v, &r,
+                                                &found));
+    EXPECT_TRUE(found);
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, type);
+    EXPECT_EQ(15U, v);
+    EXPECT_EQ(reference, r);
+    Object o(buffer);
+    EXPECT_EQ("value", string(reinterpret_cast<const char*>(o.getValue()), 5));
+
+    // Someone is updating the bucket.
+    Buffer buffer2;
+    {
+        ObjectManager::HashTableBucketLock lock(objectManager, key);
+        EXPECT_FALSE(objectManager.lookupWithoutLock(key, type, buffer2, &v,
+                                                     &r, &found));
+        EXPECT_EQ(0U, buffer2.size());
+    }
+    EXPECT_TRUE(objectManager.lookupWithoutLock(key, type, buffer2, &v, &r,
+                                                &found));
+    EXPECT_TRUE(found);
+}
+
 TEST_F(ObjectManagerTest, remove) {
     Key key(1, "1", 1);
     Key key2(2, "2", 2);
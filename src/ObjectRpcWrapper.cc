@@ -50,6 +50,7 @@ ObjectRpcWrapper::ObjectRpcWrapper(Context* context, uint64_t tableId,
     , context(context)
     , tableId(tableId)
     , keyHash(Key::getHash(tableId, key, keyLength))
+    , readOnly(false)
 {
 }
 
@@ -79,6 +80,7 @@ ObjectRpcWrapper::ObjectRpcWrapper(Context* context, uint64_t tableId,
     , context(context)
     , tableId(tableId)
     , keyHash(keyHash)
+    , readOnly(false)
 {
 }
 
@@ -119,7 +121,8 @@ void
 ObjectRpcWrapper::send()
 {
     try {
-        session = context->objectFinder->tryLookup(tableId, keyHash);
+        session = context->objectFinder->tryLookup(tableId, keyHash,
+                                                   readOnly);
         if (session) {
             state = IN_PROGRESS;
             session->sendRequest(&request, response, this);
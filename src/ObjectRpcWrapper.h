@@ -57,6 +57,11 @@ class ObjectRpcWrapper : public RpcWrapper {
     uint64_t tableId;
     uint64_t keyHash;
 
+    /// True means the RPC only reads the object, so it may be sent to a
+    /// recovery master that serves reads for the object's tablet before
+    /// recovery of the tablet completes. Set by subclasses.
+    bool readOnly;
+
     DISALLOW_COPY_AND_ASSIGN(ObjectRpcWrapper);
 };
 
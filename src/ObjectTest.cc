@@ -468,6 +468,67 @@ TEST_F(ObjectTest, assembleForLog_contigMemory) {
 
 }
 
+TEST_F(ObjectTest, assembleForLog_compactHeader) {
+    Object& object = *objectDataFromBuffer;
+    object.setCompactHeader(true);
+
+    // 4-byte checksum, 4-byte timestamp, 1 byte each for the version and
+    // table id, instead of 24 bytes.
+    EXPECT_EQ(10U, object.getSerializedHeaderLength());
+    EXPECT_EQ(30U, object.getSerializedLength());
+    Buffer compact;
+    object.assembleForLog(compact);
+    EXPECT_EQ(30U, compact.size());
+
+    Object fromBuffer(compact);
+    EXPECT_TRUE(fromBuffer.isCompactHeader());
+    EXPECT_EQ(57U, fromBuffer.getTableId());
+    EXPECT_EQ(75U, fromBuffer.getVersion());
+    EXPECT_EQ(723U, fromBuffer.getTimestamp());
+    EXPECT_EQ(3U, fromBuffer.getKeyCount());
+    EXPECT_EQ("ho", string(reinterpret_cast<const char*>(
+            fromBuffer.getKey(2))));
+    EXPECT_EQ("YO!", string(reinterpret_cast<const char*>(
+            fromBuffer.getValue())));
+    EXPECT_TRUE(fromBuffer.checkIntegrity());
+
+    char contiguous[30];
+    compact.copy(0, sizeof32(contiguous), contiguous);
+    Object fromPointer(contiguous, sizeof32(contiguous));
+    EXPECT_TRUE(fromPointer.isCompactHeader());
+    EXPECT_EQ(30U, fromPointer.getSerializedLength());
+    EXPECT_TRUE(fromPointer.checkIntegrity());
+
+    // Corrupt the version.
+    contiguous[8]++;
+    Object corrupt(contiguous, sizeof32(contiguous));
+    EXPECT_EQ(76U, corrupt.getVersion());
+    EXPECT_FALSE(corrupt.checkIntegrity());
+}
+
+TEST_F(ObjectTest, assembleForLog_valueCompressed) {
+    Object& object = *objectDataFromBuffer;
+    EXPECT_FALSE(object.isValueCompressed());
+    object.setValueCompressed(true);
+    EXPECT_TRUE(object.isCompactHeader());
+
+    // The flag shares the table id's byte.
+    EXPECT_EQ(10U, object.getSerializedHeaderLength());
+    Buffer compact;
+    object.assembleForLog(compact);
+    Object fromBuffer(compact);
+    EXPECT_TRUE(fromBuffer.isValueCompressed());
+    EXPECT_EQ(57U, fromBuffer.getTableId());
+    EXPECT_TRUE(fromBuffer.checkIntegrity());
+
+    object.setValueCompressed(false);
+    Buffer uncompressed;
+    object.assembleForLog(uncompressed);
+    Object fromBuffer2(uncompressed);
+    EXPECT_FALSE(fromBuffer2.isValueCompressed());
+    EXPECT_EQ(57U, fromBuffer2.getTableId());
+}
+
 TEST_F(ObjectTest, appendValueToBuffer) {
     for (uint32_t i = 0; i < arrayLength(objects); i++) {
         Object& object = *objects[i];
@@ -771,6 +832,15 @@ TEST_F(ObjectTest, getSerializedLength) {
     EXPECT_EQ(44U, objects[2]->getSerializedLength());
 }
 
+TEST_F(ObjectTest, getSerializedLength_compactHeader) {
+    Object& object = *objectDataFromBuffer;
+    object.setCompactHeader(true);
+    object.setVersion(1UL << 40);
+    object.changeTableId(300);
+    EXPECT_EQ(8U + 6U + 2U, object.getSerializedHeaderLength());
+    EXPECT_EQ(16U + 20U, object.getSerializedLength());
+}
+
 TEST_F(ObjectTest, checkIntegrity) {
     for (uint32_t i = 0; i < arrayLength(objects); i++) {
         Object& object = *objects[i];
@@ -835,6 +905,25 @@ TEST_F(ObjectTest, checkIntegrity) {
     }
 }
 
+TEST_F(ObjectTest, varint) {
+    uint64_t values[] = { 0, 127, 128, 300, ~0UL };
+    uint32_t lengths[] = { 1, 1, 2, 2, 10 };
+    for (uint32_t i = 0; i < arrayLength(values); i++) {
+        uint8_t raw[10];
+        uint64_t value;
+        EXPECT_EQ(lengths[i], Object::varintLength(values[i]));
+        EXPECT_EQ(lengths[i], Object::writeVarint(values[i], raw));
+        EXPECT_EQ(lengths[i], Object::readVarint(raw, 10, &value));
+        EXPECT_EQ(values[i], value);
+    }
+
+    // Truncated input.
+    uint8_t raw[2] = { 0xac, 0x02 };
+    uint64_t value;
+    EXPECT_EQ(1U, Object::readVarint(raw, 1, &value));
+    EXPECT_EQ(0x2cU, value);
+}
+
 /**
  * Unit tests for ObjectTombstone.
  */
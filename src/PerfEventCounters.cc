@@ -0,0 +1,217 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "Fence.h"
+#include "Logger.h"
+#include "PerfEventCounters.h"
+#include "PerfStats.h"
+#include "ShortMacros.h"
+#include "Util.h"
+
+namespace RAMCloud {
+
+bool PerfEventCounters::enabled = false;
+HardwareCounts* PerfEventCounters::mockCounts = NULL;
+__thread PerfEventCounters* PerfEventCounters::threadCounters = NULL;
+bool PerfEventCounters::openFailureLogged = false;
+
+/**
+ * The events counted by each thread, in the same order as the fields of
+ * HardwareCounts.
+ */
+static const struct {
+    uint32_t type;
+    uint64_t config;
+    const char* name;
+} countedEvents[] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "cycles"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "LLC misses"},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB |
+            (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), "DTLB misses"},
+};
+
+/**
+ * Construct a PerfEventCounters with no counters open.
+ */
+PerfEventCounters::PerfEventCounters()
+    : fds()
+    , pages()
+{
+    for (int i = 0; i < NUM_COUNTERS; i++) {
+        fds[i] = -1;
+        pages[i] = NULL;
+    }
+}
+
+/**
+ * Start attributing hardware events to RPCs in all threads (see Scope).
+ * There's no way to stop, since the counters are only useful for
+ * profiling; restarting the server turns them off.
+ */
+void
+PerfEventCounters::enable()
+{
+    static_assert(sizeof(countedEvents) / sizeof(countedEvents[0]) ==
+            NUM_COUNTERS,
+            "countedEvents doesn't match NUM_COUNTERS");
+    enabled = true;
+}
+
+/**
+ * Read the current values of the current thread's counters, opening them
+ * if this is the first call in this thread.
+ *
+ * \param[out] counts
+ *      Filled in with the counter values.
+ * \return
+ *      True means success; false means this thread's counters couldn't
+ *      be opened, and \a counts is unchanged.
+ */
+bool
+PerfEventCounters::read(HardwareCounts* counts)
+{
+    if (mockCounts != NULL) {
+        *counts = *mockCounts;
+        return true;
+    }
+    if (threadCounters == NULL) {
+        threadCounters = new PerfEventCounters();
+        threadCounters->open();
+    }
+    PerfEventCounters* c = threadCounters;
+    if (c->fds[0] < 0) {
+        return false;
+    }
+    counts->cycles = readCounter(c->fds[0], c->pages[0]);
+    counts->instructions = readCounter(c->fds[1], c->pages[1]);
+    counts->llcMisses = readCounter(c->fds[2], c->pages[2]);
+    counts->dtlbMisses = readCounter(c->fds[3], c->pages[3]);
+    return true;
+}
+
+/**
+ * Open the counters for the current thread, as a single group so that
+ * they are always scheduled together.
+ *
+ * \return
+ *      True means success. False means the kernel or the machine doesn't
+ *      support one of the counters; all of them are left closed.
+ */
+bool
+PerfEventCounters::open()
+{
+    long pageSize = sysconf(_SC_PAGESIZE);
+    for (int i = 0; i < NUM_COUNTERS; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = countedEvents[i].type;
+        attr.config = countedEvents[i].config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1,
+                fds[0], 0));
+        if (fds[i] < 0) {
+            if (!openFailureLogged) {
+                openFailureLogged = true;
+                LOG(WARNING, "Couldn't open %s counter for per-opcode "
+                        "profiling: %s", countedEvents[i].name,
+                        strerror(errno));
+            }
+            for (int j = 0; j < i; j++) {
+                if (pages[j] != NULL) {
+                    munmap(pages[j], pageSize);
+                    pages[j] = NULL;
+                }
+                close(fds[j]);
+                fds[j] = -1;
+            }
+            return false;
+        }
+
+        void* page = mmap(NULL, pageSize, PROT_READ, MAP_SHARED, fds[i], 0);
+        if (page != MAP_FAILED) {
+            pages[i] = static_cast<perf_event_mmap_page*>(page);
+            if (!pages[i]->cap_user_rdpmc) {
+                munmap(page, pageSize);
+                pages[i] = NULL;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Return the current value of one of the current thread's counters.
+ *
+ * \param fd
+ *      File descriptor for the counter.
+ * \param page
+ *      The kernel's mmapped information for the counter, or NULL if the
+ *      counter can't be read with rdpmc.
+ */
+uint64_t
+PerfEventCounters::readCounter(int fd, perf_event_mmap_page* page)
+{
+    if (page == NULL) {
+        uint64_t value;
+        if (::read(fd, &value, sizeof(value)) != sizeof(value)) {
+            return 0;
+        }
+        return value;
+    }
+
+    // This follows the protocol described in linux/perf_event.h: the
+    // kernel changes page->lock whenever it reschedules the counter, in
+    // which case we must try again.
+    uint32_t sequence;
+    uint64_t count;
+    do {
+        sequence = page->lock;
+        Fence::lfence();
+        uint32_t index = page->index;
+        count = page->offset;
+        if (index != 0) {
+            int shift = 64 - page->pmc_width;
+            int64_t pmc = static_cast<int64_t>(
+                    Util::readPmc(static_cast<int>(index - 1)) << shift);
+            count += static_cast<uint64_t>(pmc >> shift);
+        }
+        Fence::lfence();
+    } while (page->lock != sequence);
+    return count;
+}
+
+/**
+ * Record the events that occurred since this object was constructed.
+ */
+void
+PerfEventCounters::Scope::finish()
+{
+    HardwareCounts end;
+    if (read(&end)) {
+        end.subtract(start);
+        PerfStats::recordHardwareCounts(opcode, end);
+    }
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,171 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_PERFEVENTCOUNTERS_H
+#define RAMCLOUD_PERFEVENTCOUNTERS_H
+
+#include <linux/perf_event.h>
+
+#include "Common.h"
+
+namespace RAMCloud {
+
+/**
+ * A reading of the hardware performance counters kept by
+ * PerfEventCounters, or the difference between two readings.
+ */
+struct HardwareCounts {
+    HardwareCounts()
+        : cycles(0)
+        , instructions(0)
+        , llcMisses(0)
+        , dtlbMisses(0)
+    {}
+
+    /// Add the counts in another reading to this one.
+    void
+    add(const HardwareCounts& other)
+    {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        llcMisses += other.llcMisses;
+        dtlbMisses += other.dtlbMisses;
+    }
+
+    /// Subtract the counts in an earlier reading from this one.
+    void
+    subtract(const HardwareCounts& earlier)
+    {
+        cycles -= earlier.cycles;
+        instructions -= earlier.instructions;
+        llcMisses -= earlier.llcMisses;
+        dtlbMisses -= earlier.dtlbMisses;
+    }
+
+    /// CPU cycles (at the core's current clock rate, which may differ
+    /// from Cycles::rdtsc).
+    uint64_t cycles;
+
+    /// Instructions retired.
+    uint64_t instructions;
+
+    /// Last-level cache misses.
+    uint64_t llcMisses;
+
+    /// Data TLB load misses.
+    uint64_t dtlbMisses;
+} __attribute__((packed));
+
+/**
+ * This class uses the kernel's perf_event interface to count hardware
+ * events (cycles, instructions, last-level cache misses and data TLB
+ * misses) separately for each thread, so that they can be attributed to
+ * the RPC each worker or dispatch thread is working on: a Scope object
+ * passes the events that occur during its lifetime to
+ * PerfStats::recordHardwareCounts.
+ *
+ * Counting is off unless enable is called. Each thread opens its counters
+ * the first time it reads them; they count only user-level events, so no
+ * special privileges are needed. When the kernel allows it, counters are
+ * read with the rdpmc instruction, which avoids a system call for each
+ * reading; otherwise they are read with read().
+ */
+class PerfEventCounters {
+  public:
+    /**
+     * While an object of this class exists, hardware events in the current
+     * thread are attributed to a given opcode.
+     */
+    class Scope {
+      public:
+        /**
+         * \param opcode
+         *      The WireFormat::Opcode of the RPC the current thread is
+         *      working on.
+         */
+        explicit Scope(int opcode)
+            : opcode(opcode)
+            , start()
+            , active(false)
+        {
+            if (enabled) {
+                active = read(&start);
+            }
+        }
+
+        ~Scope()
+        {
+            if (active) {
+                finish();
+            }
+        }
+
+      PRIVATE:
+        void finish();
+
+        /// Opcode to attribute events to.
+        int opcode;
+
+        /// Counter values when this object was constructed.
+        HardwareCounts start;
+
+        /// True if #start is valid and events should be recorded when this
+        /// object is destroyed.
+        bool active;
+
+        DISALLOW_COPY_AND_ASSIGN(Scope);
+    };
+
+    static void enable();
+    static bool read(HardwareCounts* counts);
+
+    /// True means threads should count hardware events; set by enable.
+    static bool enabled;
+
+    /// If non-NULL, read returns this instead of reading any counters
+    /// (for unit tests).
+    static HardwareCounts* mockCounts;
+
+  PRIVATE:
+    /// Number of counters each thread opens: one for each of the fields
+    /// of HardwareCounts, in the same order.
+    static const int NUM_COUNTERS = 4;
+
+    PerfEventCounters();
+    bool open();
+    static uint64_t readCounter(int fd, perf_event_mmap_page* page);
+
+    /// File descriptors for the perf_event counters; the first one is the
+    /// group leader. -1 means not open.
+    int fds[NUM_COUNTERS];
+
+    /// The kernel's mmapped information for each counter, used to read it
+    /// with rdpmc; NULL if that isn't possible.
+    perf_event_mmap_page* pages[NUM_COUNTERS];
+
+    /// The current thread's counters; NULL until the thread first calls
+    /// read while counting is enabled. Never freed, since server threads
+    /// live until the process exits.
+    static __thread PerfEventCounters* threadCounters;
+
+    /// Used to log only once when the counters can't be opened.
+    static bool openFailureLogged;
+
+    DISALLOW_COPY_AND_ASSIGN(PerfEventCounters);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_PERFEVENTCOUNTERS_H
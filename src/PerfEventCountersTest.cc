@@ -0,0 +1,111 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "PerfEventCounters.h"
+#include "PerfStats.h"
+#include "WireFormat.h"
+
+namespace RAMCloud {
+
+class PerfEventCountersTest : public ::testing::Test {
+  public:
+    HardwareCounts counts;
+
+    PerfEventCountersTest()
+        : counts()
+    {
+        counts.cycles = 1000;
+        counts.instructions = 2000;
+        counts.llcMisses = 30;
+        counts.dtlbMisses = 4;
+        PerfEventCounters::mockCounts = &counts;
+    }
+
+    ~PerfEventCountersTest()
+    {
+        PerfEventCounters::enabled = false;
+        PerfEventCounters::mockCounts = NULL;
+    }
+
+    // Returns the total counts recorded so far for an opcode.
+    HardwareCounts
+    getTotal(int opcode)
+    {
+        PerfStats::HardwareCountMap total;
+        PerfStats::collectHardwareCounts(&total);
+        return total[opcode];
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(PerfEventCountersTest);
+};
+
+TEST_F(PerfEventCountersTest, hardwareCounts_addAndSubtract) {
+    HardwareCounts other;
+    other.cycles = 1;
+    other.instructions = 2;
+    other.llcMisses = 3;
+    other.dtlbMisses = 4;
+    counts.add(other);
+    EXPECT_EQ(1001u, counts.cycles);
+    EXPECT_EQ(2002u, counts.instructions);
+    EXPECT_EQ(33u, counts.llcMisses);
+    EXPECT_EQ(8u, counts.dtlbMisses);
+    counts.subtract(other);
+    counts.subtract(other);
+    EXPECT_EQ(999u, counts.cycles);
+    EXPECT_EQ(1998u, counts.instructions);
+    EXPECT_EQ(27u, counts.llcMisses);
+    EXPECT_EQ(0u, counts.dtlbMisses);
+}
+
+TEST_F(PerfEventCountersTest, scope_disabled) {
+    HardwareCounts before = getTotal(WireFormat::READ);
+    {
+        PerfEventCounters::Scope scope(WireFormat::READ);
+        EXPECT_FALSE(scope.active);
+        counts.cycles += 500;
+    }
+    EXPECT_EQ(before.cycles, getTotal(WireFormat::READ).cycles);
+}
+
+TEST_F(PerfEventCountersTest, scope_recordDifference) {
+    PerfEventCounters::enable();
+    HardwareCounts before = getTotal(WireFormat::READ);
+    {
+        PerfEventCounters::Scope scope(WireFormat::READ);
+        EXPECT_TRUE(scope.active);
+        counts.cycles += 500;
+        counts.instructions += 600;
+        counts.llcMisses += 7;
+        counts.dtlbMisses += 8;
+    }
+    HardwareCounts after = getTotal(WireFormat::READ);
+    EXPECT_EQ(before.cycles + 500, after.cycles);
+    EXPECT_EQ(before.instructions + 600, after.instructions);
+    EXPECT_EQ(before.llcMisses + 7, after.llcMisses);
+    EXPECT_EQ(before.dtlbMisses + 8, after.dtlbMisses);
+}
+
+TEST_F(PerfEventCountersTest, read_mock) {
+    HardwareCounts result;
+    EXPECT_TRUE(PerfEventCounters::read(&result));
+    EXPECT_EQ(1000u, result.cycles);
+    EXPECT_EQ(2000u, result.instructions);
+    EXPECT_EQ(30u, result.llcMisses);
+    EXPECT_EQ(4u, result.dtlbMisses);
+}
+
+} // namespace RAMCloud
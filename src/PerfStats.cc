@@ -14,6 +14,7 @@
  */
 
 #include "Cycles.h"
+#include "Fence.h"
 #include "Minimal.h"
 #include "PerfStats.h"
 #include "ServerId.h"
@@ -25,6 +26,12 @@ SpinLock PerfStats::mutex("PerfStats");
 std::vector<PerfStats*> PerfStats::registeredStats;
 int PerfStats::nextThreadId = 1;
 __thread PerfStats PerfStats::threadStats;
+__thread PerfStats::ThreadLatencies* PerfStats::threadLatencies = NULL;
+std::vector<PerfStats::ThreadLatencies*> PerfStats::registeredLatencies;
+__thread PerfStats::ThreadHardwareCounts* PerfStats::threadHardwareCounts =
+        NULL;
+std::vector<PerfStats::ThreadHardwareCounts*>
+        PerfStats::registeredHardwareCounts;
 
 /**
  * This method must be called to make a PerfStats structure "known" so that
@@ -113,10 +120,18 @@ PerfStats::collectStats(PerfStats* total)
         total->backupWriteOps += stats->backupWriteOps;
         total->backupWriteBytes += stats->backupWriteBytes;
         total->backupWriteActiveCycles += stats->backupWriteActiveCycles;
+        total->backupCompressionInputBytes +=
+                stats->backupCompressionInputBytes;
+        total->backupCompressionOutputBytes +=
+                stats->backupCompressionOutputBytes;
+        total->backupCompressionCycles += stats->backupCompressionCycles;
+        total->backupDecompressionCycles += stats->backupDecompressionCycles;
         total->migrationPhase1Bytes += stats->migrationPhase1Bytes;
         total->migrationPhase1Cycles += stats->migrationPhase1Cycles;
         total->networkInputBytes += stats->networkInputBytes;
         total->networkOutputBytes += stats->networkOutputBytes;
+        total->networkOutputPackets += stats->networkOutputPackets;
+        total->networkOutputSyscalls += stats->networkOutputSyscalls;
         total->temp1 += stats->temp1;
         total->temp2 += stats->temp2;
         total->temp3 += stats->temp3;
@@ -125,6 +140,161 @@ PerfStats::collectStats(PerfStats* total)
     }
 }
 
+/**
+ * This method aggregates the per-opcode latency histograms recorded by all
+ * threads via recordQueueingTime and recordServiceTime. It doesn't stop
+ * other threads from recording while it runs, so a few samples may be
+ * only partly reflected in the result.
+ *
+ * \param[out] total
+ *      Filled in with the sum of all of the threads' histograms for each
+ *      opcode; any existing contents are discarded.
+ */
+void
+PerfStats::collectLatencies(LatencyMap* total)
+{
+    std::lock_guard<SpinLock> lock(mutex);
+    total->clear();
+    foreach (ThreadLatencies* latencies, registeredLatencies) {
+        for (int opcode = 0; opcode < WireFormat::ILLEGAL_RPC_TYPE;
+                opcode++) {
+            LatencyHistogram* queueing = latencies->queueing[opcode];
+            LatencyHistogram* service = latencies->service[opcode];
+            if (queueing != NULL) {
+                (*total)[opcode].queueing.add(*queueing);
+            }
+            if (service != NULL) {
+                (*total)[opcode].service.add(*service);
+            }
+        }
+    }
+}
+
+/**
+ * This method aggregates the per-opcode hardware event counts recorded by
+ * all threads via recordHardwareCounts. As with collectLatencies, counts
+ * recorded while it runs may be only partly reflected in the result.
+ *
+ * \param[out] total
+ *      Filled in with the sum of all of the threads' counts for each
+ *      opcode that has any; any existing contents are discarded.
+ */
+void
+PerfStats::collectHardwareCounts(HardwareCountMap* total)
+{
+    std::lock_guard<SpinLock> lock(mutex);
+    total->clear();
+    foreach (ThreadHardwareCounts* threadCounts, registeredHardwareCounts) {
+        for (int opcode = 0; opcode < WireFormat::ILLEGAL_RPC_TYPE;
+                opcode++) {
+            HardwareCounts* counts = &threadCounts->counts[opcode];
+            if (counts->cycles != 0) {
+                (*total)[opcode].add(*counts);
+            }
+        }
+    }
+}
+
+/**
+ * Add hardware events that occurred while working on an RPC to the
+ * current thread's counts for its opcode. Normally invoked by
+ * PerfEventCounters::Scope.
+ *
+ * \param opcode
+ *      The RPC's opcode; out-of-range values are ignored.
+ * \param counts
+ *      Events to add.
+ */
+void
+PerfStats::recordHardwareCounts(int opcode, const HardwareCounts& counts)
+{
+    if ((opcode < 0) || (opcode >= WireFormat::ILLEGAL_RPC_TYPE)) {
+        return;
+    }
+    if (threadHardwareCounts == NULL) {
+        ThreadHardwareCounts* threadCounts = new ThreadHardwareCounts();
+        std::lock_guard<SpinLock> lock(mutex);
+        registeredHardwareCounts.push_back(threadCounts);
+        threadHardwareCounts = threadCounts;
+    }
+    threadHardwareCounts->counts[opcode].add(counts);
+}
+
+/**
+ * Record how long an RPC waited for a worker thread, in the current
+ * thread's histogram for its opcode.
+ *
+ * \param opcode
+ *      The RPC's opcode; out-of-range values are ignored.
+ * \param cycles
+ *      How long the RPC waited, in Cycles::rdtsc ticks.
+ */
+void
+PerfStats::recordQueueingTime(int opcode, uint64_t cycles)
+{
+    if ((opcode < 0) || (opcode >= WireFormat::ILLEGAL_RPC_TYPE)) {
+        return;
+    }
+    getHistogram(&getThreadLatencies()->queueing[opcode])->record(
+            Cycles::toNanoseconds(cycles));
+}
+
+/**
+ * Record how long it took to execute an RPC, in the current thread's
+ * histogram for its opcode.
+ *
+ * \param opcode
+ *      The RPC's opcode; out-of-range values are ignored.
+ * \param cycles
+ *      How long the RPC took, in Cycles::rdtsc ticks.
+ */
+void
+PerfStats::recordServiceTime(int opcode, uint64_t cycles)
+{
+    if ((opcode < 0) || (opcode >= WireFormat::ILLEGAL_RPC_TYPE)) {
+        return;
+    }
+    getHistogram(&getThreadLatencies()->service[opcode])->record(
+            Cycles::toNanoseconds(cycles));
+}
+
+/**
+ * Return the current thread's latency histograms, allocating and
+ * registering them the first time this is called in a thread.
+ */
+PerfStats::ThreadLatencies*
+PerfStats::getThreadLatencies()
+{
+    if (threadLatencies == NULL) {
+        ThreadLatencies* latencies = new ThreadLatencies();
+        std::lock_guard<SpinLock> lock(mutex);
+        registeredLatencies.push_back(latencies);
+        threadLatencies = latencies;
+    }
+    return threadLatencies;
+}
+
+/**
+ * Return the histogram stored in one of the current thread's
+ * ThreadLatencies slots, allocating it if this is the first use.
+ *
+ * \param histogram
+ *      Slot in threadLatencies holding the histogram.
+ */
+LatencyHistogram*
+PerfStats::getHistogram(LatencyHistogram** histogram)
+{
+    if (*histogram == NULL) {
+        LatencyHistogram* newHistogram = new LatencyHistogram();
+
+        // collectLatencies may read the slot at any time, so make sure the
+        // histogram is initialized before it can find it.
+        Fence::sfence();
+        *histogram = newHistogram;
+    }
+    return *histogram;
+}
+
 /**
  * Given two collections of cluster PerfStats, computes the changes from
  * the first collection to the second and formats it for printing.
@@ -298,6 +468,15 @@ PerfStats::printClusterStats(Buffer* first, Buffer* second)
     result.append(format("%-30s %s\n", "  Storage read load factor",
             formatMetricRatio(&diff, "backupReadActiveCycles",
             "collectionTime", " %8.3f").c_str()));
+    result.append(format("%-30s %s\n", "  Replica compression ratio",
+            formatMetricRatio(&diff, "backupCompressionInputBytes",
+            "backupCompressionOutputBytes", " %8.2f").c_str()));
+    result.append(format("%-30s %s\n", "  Compression load factor",
+            formatMetricRatio(&diff, "backupCompressionCycles",
+            "collectionTime", " %8.3f").c_str()));
+    result.append(format("%-30s %s\n", "  Decompression load factor",
+            formatMetricRatio(&diff, "backupDecompressionCycles",
+            "collectionTime", " %8.3f").c_str()));
 
     result.append("\nMigration:\n");
     result.append(format("%-30s %s\n", "  P1 migrated bytes (MB/s)",
@@ -314,6 +493,41 @@ PerfStats::printClusterStats(Buffer* first, Buffer* second)
     result.append(format("%-30s %s\n", "  Output bytes (MB/s)",
             formatMetricRate(&diff, "networkOutputBytes",
             " %8.2f", 1e-6).c_str()));
+    result.append(format("%-30s %s\n", "  Packets per transmit syscall",
+            formatMetricRatio(&diff, "networkOutputPackets",
+            "networkOutputSyscalls", " %8.2f").c_str()));
+
+    // Per-opcode hardware events are only present if the servers were
+    // started with counting enabled.
+    HardwareCountMap before, after;
+    parseHardwareCounts(first, &before);
+    parseHardwareCounts(second, &after);
+    bool printedHeading = false;
+    foreach (HardwareCountMap::value_type& entry, after) {
+        HardwareCounts counts = entry.second;
+        HardwareCountMap::iterator it = before.find(entry.first);
+        if (it != before.end()) {
+            counts.subtract(it->second);
+        }
+        if ((counts.cycles == 0) || (counts.instructions == 0)) {
+            continue;
+        }
+        if (!printedHeading) {
+            result.append("\nHardware events by opcode:\n");
+            result.append(format("  %-26s %9s %6s %9s %9s\n", "Opcode",
+                    "Mcycles", "IPC", "LLC MPKI", "DTLB MPKI"));
+            printedHeading = true;
+        }
+        double kiloInstructions = static_cast<double>(counts.instructions)
+                * 1e-3;
+        result.append(format("  %-26s %9.2f %6.2f %9.3f %9.3f\n",
+                WireFormat::opcodeSymbol(downCast<uint32_t>(entry.first)),
+                static_cast<double>(counts.cycles) * 1e-6,
+                static_cast<double>(counts.instructions)
+                / static_cast<double>(counts.cycles),
+                static_cast<double>(counts.llcMisses) / kiloInstructions,
+                static_cast<double>(counts.dtlbMisses) / kiloInstructions));
+    }
     return result;
 }
 
@@ -397,10 +611,16 @@ PerfStats::clusterDiff(Buffer* before, Buffer* after,
         ADD_METRIC(backupWriteOps);
         ADD_METRIC(backupWriteBytes);
         ADD_METRIC(backupWriteActiveCycles);
+        ADD_METRIC(backupCompressionInputBytes);
+        ADD_METRIC(backupCompressionOutputBytes);
+        ADD_METRIC(backupCompressionCycles);
+        ADD_METRIC(backupDecompressionCycles);
         ADD_METRIC(migrationPhase1Bytes);
         ADD_METRIC(migrationPhase1Cycles);
         ADD_METRIC(networkInputBytes);
         ADD_METRIC(networkOutputBytes);
+        ADD_METRIC(networkOutputPackets);
+        ADD_METRIC(networkOutputSyscalls);
         ADD_METRIC(temp1);
         ADD_METRIC(temp2);
         ADD_METRIC(temp3);
@@ -438,11 +658,52 @@ PerfStats::parseStats(Buffer* rawData, std::vector<PerfStats>* results)
         if (i >= results->size()) {
             results->resize(i+1);
         }
-        rawData->copy(offset, header->outputLength, &results->at(i));
+        // Anything after the PerfStats (such as per-opcode hardware
+        // counts) is parsed by other methods.
+        rawData->copy(offset, std::min(header->outputLength,
+                sizeof32(PerfStats)), &results->at(i));
         offset += header->outputLength;
     }
 }
 
+/**
+ * Extract the per-opcode hardware event counts from the response to a
+ * GET_PERF_STATS serverControlAll and sum them over all of the servers.
+ *
+ * \param rawData
+ *      Response buffer from a call to CoordinatorClient::serverControlAll.
+ * \param[out] total
+ *      Filled in with the sum over all servers of the counts for each
+ *      opcode; any existing contents are discarded. Empty if none of the
+ *      servers has hardware counting enabled.
+ */
+void
+PerfStats::parseHardwareCounts(Buffer* rawData, HardwareCountMap* total)
+{
+    total->clear();
+    uint32_t offset = sizeof(WireFormat::ServerControlAll::Response);
+    while (offset < rawData->size()) {
+        WireFormat::ServerControl::Response* header =
+                rawData->getOffset<WireFormat::ServerControl::Response>(offset);
+        offset += sizeof32(*header);
+        if (header == NULL) {
+            break;
+        }
+        uint32_t end = offset + header->outputLength;
+        for (uint32_t entryOffset = offset + sizeof32(PerfStats);
+                entryOffset + sizeof32(OpcodeHardwareCounts) <= end;
+                entryOffset += sizeof32(OpcodeHardwareCounts)) {
+            OpcodeHardwareCounts entry;
+            if (rawData->copy(entryOffset, sizeof32(entry), &entry)
+                    != sizeof32(entry)) {
+                break;
+            }
+            (*total)[entry.opcode].add(entry.counts);
+        }
+        offset = end;
+    }
+}
+
 /**
  * Generates a formatted string containing the values of a particular metric
  * for each of the servers.
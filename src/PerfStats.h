@@ -16,10 +16,14 @@
 #ifndef RAMCLOUD_PERFSTATS_H
 #define RAMCLOUD_PERFSTATS_H
 
+#include <map>
 #include <unordered_map>
 #include <vector>
 #include "Buffer.h"
+#include "LatencyHistogram.h"
+#include "PerfEventCounters.h"
 #include "SpinLock.h"
+#include "WireFormat.h"
 
 namespace RAMCloud {
 
@@ -205,6 +209,21 @@ struct PerfStats {
     /// storage device(s) were actively performing backup writes.
     uint64_t backupWriteActiveCycles;
 
+    /// Total bytes of closed replicas that backups tried to compress
+    /// before writing them to secondary storage.
+    uint64_t backupCompressionInputBytes;
+
+    /// Total bytes those replicas occupied once stored (compressed if that
+    /// made them smaller, otherwise as is).
+    uint64_t backupCompressionOutputBytes;
+
+    /// Total time (in Cycles::rdtsc ticks) spent compressing replicas.
+    uint64_t backupCompressionCycles;
+
+    /// Total time (in Cycles::rdtsc ticks) spent decompressing replicas
+    /// read from secondary storage during recoveries.
+    uint64_t backupDecompressionCycles;
+
     //--------------------------------------------------------------------
     // Statistics for the migration follow below.
     //--------------------------------------------------------------------
@@ -228,6 +247,14 @@ struct PerfStats {
     /// Total bytes transmitted on the network by all transports.
     uint64_t networkOutputBytes;
 
+    /// Total packets transmitted by kernel-based drivers (e.g. UdpDriver).
+    uint64_t networkOutputPackets;
+
+    /// Total kernel calls made by kernel-based transports and drivers
+    /// to transmit data. Comparing this with networkOutputPackets shows
+    /// how effectively transmissions are being batched.
+    uint64_t networkOutputSyscalls;
+
     //--------------------------------------------------------------------
     // Statistics for space used by log in memory and backups.
     // Note: these are NOT counter based statistics.
@@ -264,6 +291,14 @@ struct PerfStats {
     /// Backup disk spaces spent for holding replicas for data of this server.
     uint64_t logUsedBytesInBackups;
 
+    /// Size of the pages backing the log's memory (4 KB unless the server
+    /// was started with --hugePages).
+    uint64_t logPageBytes;
+
+    /// Size of the pages backing the master's hash table. Must be filled
+    /// in by the caller from HashTable::getPageSize.
+    uint64_t hashTablePageBytes;
+
     //--------------------------------------------------------------------
     // Temporary counters. The values below have no pre-defined use;
     // they are intended for temporary use during debugging or performance
@@ -295,6 +330,44 @@ struct PerfStats {
     ///   for each of the servers.
     typedef std::unordered_map<string, std::vector<double>> Diff;
 
+    /// Latency distributions for one kind of RPC, summed over all the
+    /// threads that have executed it. Returned by collectLatencies.
+    struct OpcodeLatencies {
+        OpcodeLatencies()
+            : queueing()
+            , service()
+        {}
+
+        /// Time between WorkerManager::handleRpc receiving a request and
+        /// a worker thread starting to execute it.
+        LatencyHistogram queueing;
+
+        /// Time spent executing requests in Service::handleRpc.
+        LatencyHistogram service;
+    };
+
+    /// Maps from opcode to the latencies for that kind of RPC; only
+    /// opcodes that have been executed at least once are present.
+    typedef std::map<int, OpcodeLatencies> LatencyMap;
+
+    /// Maps from opcode to the hardware events attributed to RPCs with
+    /// that opcode (see PerfEventCounters); only opcodes with events are
+    /// present.
+    typedef std::map<int, HardwareCounts> HardwareCountMap;
+
+    /// When per-opcode hardware counting is enabled, the GET_PERF_STATS
+    /// response consists of a PerfStats followed by one of these for each
+    /// opcode in the HardwareCountMap.
+    struct OpcodeHardwareCounts {
+        OpcodeHardwareCounts()
+            : opcode(0)
+            , counts()
+        {}
+
+        uint32_t opcode;
+        HardwareCounts counts;
+    } __attribute__((packed));
+
     static string formatMetric(Diff* diff, const char* metric,
             const char* formatString, double scale = 1.0);
     static string formatMetricRate(Diff* diff, const char* metric,
@@ -303,8 +376,16 @@ struct PerfStats {
             const char* metric2, const char* formatString, double scale = 1.0);
     static void clusterDiff(Buffer* before, Buffer* after,
             PerfStats::Diff* diff);
+    static void collectHardwareCounts(HardwareCountMap* total);
+    static void collectLatencies(LatencyMap* total);
     static void collectStats(PerfStats* total);
+    static void parseHardwareCounts(Buffer* rawData,
+            HardwareCountMap* total);
     static string printClusterStats(Buffer* first, Buffer* second);
+    static void recordHardwareCounts(int opcode,
+            const HardwareCounts& counts);
+    static void recordQueueingTime(int opcode, uint64_t cycles);
+    static void recordServiceTime(int opcode, uint64_t cycles);
     static void registerStats(PerfStats* stats);
 
     /// The following thread-local variable is used to access the statistics
@@ -312,6 +393,30 @@ struct PerfStats {
     static __thread PerfStats threadStats;
 
   PRIVATE:
+    /**
+     * Per-opcode latency histograms for the RPCs executed by one thread.
+     * These are kept separately from the counters above so that they don't
+     * bloat the GET_PERF_STATS response, and each histogram is only
+     * allocated once the thread executes an RPC with that opcode. Once
+     * allocated, neither this structure nor its histograms are ever freed,
+     * so collectLatencies can read them without synchronizing with the
+     * owning thread.
+     */
+    struct ThreadLatencies {
+        LatencyHistogram* queueing[WireFormat::ILLEGAL_RPC_TYPE];
+        LatencyHistogram* service[WireFormat::ILLEGAL_RPC_TYPE];
+    };
+
+    /**
+     * Per-opcode hardware event counts for the RPCs executed by one thread;
+     * like ThreadLatencies, never freed once allocated.
+     */
+    struct ThreadHardwareCounts {
+        HardwareCounts counts[WireFormat::ILLEGAL_RPC_TYPE];
+    };
+
+    static ThreadLatencies* getThreadLatencies();
+    static LatencyHistogram* getHistogram(LatencyHistogram** histogram);
     static void parseStats(Buffer* rawData, std::vector<PerfStats>* results);
 
     /// Used in a monitor-style fashion for mutual exclusion.
@@ -323,6 +428,21 @@ struct PerfStats {
     /// aggregate their statistics in collectStats.
     static std::vector<PerfStats*> registeredStats;
 
+    /// Latency histograms for the current thread; NULL until the thread
+    /// records its first latency.
+    static __thread ThreadLatencies* threadLatencies;
+
+    /// Every ThreadLatencies that has been allocated, for collectLatencies.
+    static std::vector<ThreadLatencies*> registeredLatencies;
+
+    /// Hardware event counts for the current thread; NULL until the thread
+    /// records its first counts.
+    static __thread ThreadHardwareCounts* threadHardwareCounts;
+
+    /// Every ThreadHardwareCounts that has been allocated, for
+    /// collectHardwareCounts.
+    static std::vector<ThreadHardwareCounts*> registeredHardwareCounts;
+
     /// Next value to assign for the threadId member variable.  Used only
     /// by RegisterStats.
     static int nextThreadId;
@@ -0,0 +1,225 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "Cycles.h"
+#include "Logger.h"
+#include "PerfStatsExporter.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+/**
+ * The PerfStats counters included in each export, and where to find them.
+ */
+static const struct {
+    const char* name;
+    size_t offset;
+} exportedCounters[] = {
+#define COUNTER(field) {#field, offsetof(PerfStats, field)}
+    COUNTER(readCount),
+    COUNTER(readObjectBytes),
+    COUNTER(writeCount),
+    COUNTER(writeObjectBytes),
+    COUNTER(dispatchActiveCycles),
+    COUNTER(workerActiveCycles),
+    COUNTER(logBytesAppended),
+    COUNTER(replicationRpcs),
+    COUNTER(logSyncCycles),
+    COUNTER(cleanerActiveCycles),
+    COUNTER(compactorActiveCycles),
+    COUNTER(backupReadBytes),
+    COUNTER(backupWriteBytes),
+    COUNTER(networkInputBytes),
+    COUNTER(networkOutputBytes),
+#undef COUNTER
+};
+
+/**
+ * Construct a PerfStatsExporter; the first export happens one interval
+ * from now.
+ *
+ * \param dispatch
+ *      The dispatcher that will be used to schedule execution of this
+ *      object.
+ * \param destination
+ *      Where to write the statistics: either the name of a file to append
+ *      to, or "unix:" followed by the path of a Unix domain datagram socket.
+ * \param intervalSeconds
+ *      Statistics are exported at regular intervals of this length.
+ *
+ * \throw FatalError
+ *      The destination couldn't be opened.
+ */
+PerfStatsExporter::PerfStatsExporter(Dispatch* dispatch,
+        const string& destination, double intervalSeconds)
+    : WorkerTimer(dispatch)
+    , intervalTicks(Cycles::fromSeconds(intervalSeconds))
+    , fd(-1)
+    , isSocket(false)
+    , socketAddress()
+    , outputFailed(false)
+    , lastStats()
+    , lastLatencies()
+{
+    const string prefix("unix:");
+    if (destination.compare(0, prefix.size(), prefix) == 0) {
+        string path = destination.substr(prefix.size());
+        if (path.size() >= sizeof(socketAddress.sun_path)) {
+            throw FatalError(HERE, format("Socket path too long for stats "
+                    "export: %s", path.c_str()));
+        }
+        socketAddress.sun_family = AF_UNIX;
+        strncpy(socketAddress.sun_path, path.c_str(),
+                sizeof(socketAddress.sun_path) - 1);
+        fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+        isSocket = true;
+    } else {
+        fd = open(destination.c_str(), O_WRONLY|O_CREAT|O_APPEND, 0644);
+    }
+    if (fd < 0) {
+        throw FatalError(HERE, format("Couldn't open %s for stats export",
+                destination.c_str()), errno);
+    }
+    LOG(NOTICE, "Exporting performance statistics to %s every %.3f seconds",
+            destination.c_str(), intervalSeconds);
+
+    PerfStats::collectStats(&lastStats);
+    PerfStats::collectLatencies(&lastLatencies);
+    start(Cycles::rdtsc() + intervalTicks);
+}
+
+/**
+ * Destructor for PerfStatsExporter.
+ */
+PerfStatsExporter::~PerfStatsExporter()
+{
+    stop();
+    close(fd);
+}
+
+void
+PerfStatsExporter::handleTimerEvent()
+{
+    PerfStats stats;
+    PerfStats::collectStats(&stats);
+    PerfStats::LatencyMap latencies;
+    PerfStats::collectLatencies(&latencies);
+
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    string time = format("\"time\":%lu.%03lu", now.tv_sec,
+            now.tv_usec / 1000);
+
+    std::vector<string> lines;
+    string counters = format("{%s,\"intervalSeconds\":%.3f,"
+            "\"cyclesPerSecond\":%.0f", time.c_str(),
+            Cycles::toSeconds(stats.collectionTime - lastStats.collectionTime),
+            stats.cyclesPerSecond);
+    foreach (const auto& counter, exportedCounters) {
+        const char* current = reinterpret_cast<const char*>(&stats);
+        const char* last = reinterpret_cast<const char*>(&lastStats);
+        counters += format(",\"%s\":%lu", counter.name,
+                *reinterpret_cast<const uint64_t*>(current + counter.offset) -
+                *reinterpret_cast<const uint64_t*>(last + counter.offset));
+    }
+    lines.push_back(counters + "}");
+
+    foreach (auto& entry, latencies) {
+        PerfStats::OpcodeLatencies delta = entry.second;
+        PerfStats::LatencyMap::iterator last = lastLatencies.find(entry.first);
+        if (last != lastLatencies.end()) {
+            delta.queueing.subtract(last->second.queueing);
+            delta.service.subtract(last->second.service);
+        }
+        if (delta.service.getCount() == 0 && delta.queueing.getCount() == 0) {
+            continue;
+        }
+        lines.push_back(format("{%s,\"opcode\":\"%s\",\"queueing\":%s,"
+                "\"service\":%s}", time.c_str(),
+                WireFormat::opcodeSymbol(downCast<uint32_t>(entry.first)),
+                formatHistogram(delta.queueing).c_str(),
+                formatHistogram(delta.service).c_str()));
+    }
+    output(lines);
+
+    lastStats = stats;
+    lastLatencies.swap(latencies);
+    start(Cycles::rdtsc() + intervalTicks);
+}
+
+/**
+ * Return a JSON object describing a histogram.
+ */
+string
+PerfStatsExporter::formatHistogram(const LatencyHistogram& histogram)
+{
+    uint64_t count = histogram.getCount();
+    string result = format("{\"count\":%lu,\"meanNs\":%lu,\"p50Ns\":%lu,"
+            "\"p99Ns\":%lu,\"p999Ns\":%lu,\"buckets\":[", count,
+            (count == 0) ? 0 : histogram.totalNanoseconds / count,
+            histogram.getPercentile(0.5), histogram.getPercentile(0.99),
+            histogram.getPercentile(0.999));
+    const char* separator = "";
+    for (uint32_t i = 0; i < LatencyHistogram::NUM_BUCKETS; i++) {
+        if (histogram.counts[i] != 0) {
+            result += format("%s[%lu,%lu]", separator,
+                    LatencyHistogram::bucketLowerBound(i),
+                    histogram.counts[i]);
+            separator = ",";
+        }
+    }
+    return result + "]}";
+}
+
+/**
+ * Write lines to the export destination: all at once if it's a file, or
+ * one datagram per line if it's a socket (so a receiver never sees part
+ * of a line).
+ */
+void
+PerfStatsExporter::output(const std::vector<string>& lines)
+{
+    bool failed = false;
+    if (isSocket) {
+        foreach (const string& line, lines) {
+            if (sendto(fd, line.data(), line.size(), MSG_DONTWAIT,
+                    reinterpret_cast<struct sockaddr*>(&socketAddress),
+                    sizeof(socketAddress)) < 0) {
+                failed = true;
+                break;
+            }
+        }
+    } else {
+        string all;
+        foreach (const string& line, lines) {
+            all += line + "\n";
+        }
+        failed = (write(fd, all.data(), all.size()) !=
+                static_cast<ssize_t>(all.size()));
+    }
+    if (failed && !outputFailed) {
+        LOG(WARNING, "Couldn't export performance statistics: %s",
+                strerror(errno));
+    }
+    outputFailed = failed;
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,81 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_PERFSTATSEXPORTER_H
+#define RAMCLOUD_PERFSTATSEXPORTER_H
+
+#include <sys/un.h>
+
+#include "PerfStats.h"
+#include "WorkerTimer.h"
+
+namespace RAMCloud {
+
+/**
+ * This class implements a WorkerTimer that wakes up at regular intervals
+ * and writes out how much the server's PerfStats counters and per-opcode
+ * latency histograms have changed since the last interval, so that an
+ * external monitoring system can follow them without polling the server
+ * with GET_PERF_STATS.
+ *
+ * Each interval produces one line of JSON with the counters, followed by
+ * one line for each opcode executed during the interval, containing its
+ * queueing and service time histograms (as [lowerBoundNs, count] pairs for
+ * the non-empty buckets, so they can be merged across intervals and
+ * servers) along with a few percentiles for convenience. The lines are
+ * appended to a file, or, if the destination has the form "unix:<path>",
+ * sent as datagrams to a Unix domain socket bound to that path.
+ */
+class PerfStatsExporter : public WorkerTimer {
+  PUBLIC:
+    PerfStatsExporter(Dispatch* dispatch, const string& destination,
+            double intervalSeconds = 1.0);
+    ~PerfStatsExporter();
+
+  PRIVATE:
+    void handleTimerEvent();
+    static string formatHistogram(const LatencyHistogram& histogram);
+    void output(const std::vector<string>& lines);
+
+    /// The time period in Cycles::rdtsc() ticks between successive exports.
+    uint64_t intervalTicks;
+
+    /// File descriptor for the file or socket that lines are written to.
+    int fd;
+
+    /// True if #fd is a datagram socket sending to #socketAddress; false
+    /// if it's a file.
+    bool isSocket;
+
+    /// If #isSocket, where to send the lines.
+    struct sockaddr_un socketAddress;
+
+    /// True if the last attempt to output lines failed; used to avoid
+    /// logging the same error every interval.
+    bool outputFailed;
+
+    /// Counters as of the last export; the next export reports the
+    /// differences from these.
+    PerfStats lastStats;
+
+    /// Latency histograms as of the last export.
+    PerfStats::LatencyMap lastLatencies;
+
+    DISALLOW_COPY_AND_ASSIGN(PerfStatsExporter);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_PERFSTATSEXPORTER_H
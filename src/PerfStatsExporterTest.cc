@@ -0,0 +1,122 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <fstream>
+
+#include "TestUtil.h"
+#include "PerfStatsExporter.h"
+
+namespace RAMCloud {
+class PerfStatsExporterTest : public ::testing::Test {
+  public:
+    TestLog::Enable logEnabler;
+    Dispatch dispatch;
+    string path;
+
+    PerfStatsExporterTest()
+        : logEnabler()
+        , dispatch(false)
+        , path(format("/tmp/PerfStatsExporterTest.%d", getpid()))
+    {
+        unlink(path.c_str());
+    }
+
+    ~PerfStatsExporterTest()
+    {
+        unlink(path.c_str());
+    }
+
+    // Returns the contents of the file at #path.
+    string
+    readFile()
+    {
+        std::ifstream in(path.c_str());
+        return string(std::istreambuf_iterator<char>(in),
+                std::istreambuf_iterator<char>());
+    }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(PerfStatsExporterTest);
+};
+
+TEST_F(PerfStatsExporterTest, constructor_badDestination) {
+    EXPECT_THROW(PerfStatsExporter(&dispatch, "/nonexistent/dir/file"),
+            FatalError);
+    EXPECT_THROW(PerfStatsExporter(&dispatch, "unix:" + string(200, 'x')),
+            FatalError);
+}
+
+TEST_F(PerfStatsExporterTest, handleTimerEvent_file) {
+    PerfStatsExporter exporter(&dispatch, path);
+    PerfStats::registerStats(&PerfStats::threadStats);
+    PerfStats::threadStats.readCount += 3;
+    PerfStats::recordQueueingTime(WireFormat::READ, 0);
+    PerfStats::recordServiceTime(WireFormat::READ, 0);
+    exporter.handleTimerEvent();
+    string contents = readFile();
+    EXPECT_TRUE(TestUtil::contains(contents, "\"readCount\":3,"));
+    EXPECT_TRUE(TestUtil::contains(contents, "\"opcode\":\"READ\","
+            "\"queueing\":{\"count\":1,\"meanNs\":0,\"p50Ns\":0,\"p99Ns\":0,"
+            "\"p999Ns\":0,\"buckets\":[[0,1]]},\"service\":{\"count\":1,"));
+    EXPECT_EQ(2, std::count(contents.begin(), contents.end(), '\n'));
+
+    // Only changes since the last export are reported.
+    unlink(path.c_str());
+    PerfStatsExporter exporter2(&dispatch, path);
+    exporter2.handleTimerEvent();
+    contents = readFile();
+    EXPECT_TRUE(TestUtil::contains(contents, "\"readCount\":0,"));
+    EXPECT_FALSE(TestUtil::contains(contents, "READ"));
+}
+
+TEST_F(PerfStatsExporterTest, handleTimerEvent_socket) {
+    int receiver = socket(AF_UNIX, SOCK_DGRAM, 0);
+    ASSERT_LE(0, receiver);
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    ASSERT_EQ(0, bind(receiver, reinterpret_cast<struct sockaddr*>(&address),
+            sizeof(address)));
+
+    PerfStatsExporter exporter(&dispatch, "unix:" + path);
+    PerfStats::recordServiceTime(WireFormat::WRITE, 0);
+    exporter.handleTimerEvent();
+    char buffer[10000];
+    ssize_t length = recv(receiver, buffer, sizeof(buffer), MSG_DONTWAIT);
+    ASSERT_LT(0, length);
+    EXPECT_TRUE(TestUtil::contains(string(buffer, length), "\"readCount\""));
+    length = recv(receiver, buffer, sizeof(buffer), MSG_DONTWAIT);
+    ASSERT_LT(0, length);
+    EXPECT_TRUE(TestUtil::contains(string(buffer, length),
+            "\"opcode\":\"WRITE\""));
+    close(receiver);
+}
+
+TEST_F(PerfStatsExporterTest, output_failure) {
+    PerfStatsExporter exporter(&dispatch, "unix:" + path);
+    exporter.handleTimerEvent();
+    EXPECT_TRUE(TestUtil::contains(TestLog::get(),
+            "Couldn't export performance statistics"));
+
+    // Only logged once.
+    TestLog::reset();
+    exporter.handleTimerEvent();
+    EXPECT_EQ("", TestLog::get());
+}
+
+}  // namespace RAMCloud
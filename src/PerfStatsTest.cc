@@ -14,6 +14,7 @@
  */
 
 #include <stdarg.h>
+#include <thread>
 
 #include "TestUtil.h"
 #include "PerfStats.h"
@@ -106,6 +107,28 @@ class PerfStatsTest : public ::testing::Test {
         va_end(args);
     }
 
+    /**
+     * Append per-opcode hardware counts to a buffer created by
+     * combineStats with a single server, as AdminService does for
+     * GET_PERF_STATS. Instructions and misses are derived from cycles.
+     */
+    void
+    appendHardwareCounts(Buffer* buffer, uint32_t opcode, uint64_t cycles)
+    {
+        PerfStats::OpcodeHardwareCounts entry;
+        entry.opcode = opcode;
+        entry.counts.cycles = cycles;
+        entry.counts.instructions = 2*cycles;
+        entry.counts.llcMisses = cycles/100;
+        entry.counts.dtlbMisses = cycles/1000;
+        buffer->appendCopy(&entry);
+        buffer->getStart<WireFormat::ServerControlAll::Response>()->
+                totalRespLength += sizeof32(entry);
+        buffer->getOffset<WireFormat::ServerControl::Response>(
+                sizeof32(WireFormat::ServerControlAll::Response))->
+                outputLength += sizeof32(entry);
+    }
+
     DISALLOW_COPY_AND_ASSIGN(PerfStatsTest);
 };
 
@@ -161,6 +184,68 @@ TEST_F(PerfStatsTest, collectStats) {
     EXPECT_EQ(220u, total.writeCount);
 }
 
+TEST_F(PerfStatsTest, collectLatencies) {
+    PerfStats::LatencyMap before;
+    PerfStats::collectLatencies(&before);
+    uint64_t readCount = before[WireFormat::READ].service.getCount();
+    uint64_t writeCount = before[WireFormat::WRITE].queueing.getCount();
+
+    // Histograms from different threads are combined.
+    PerfStats::recordServiceTime(WireFormat::READ, 100);
+    std::thread thread([] {
+        PerfStats::recordServiceTime(WireFormat::READ, 100);
+        PerfStats::recordQueueingTime(WireFormat::WRITE, 100);
+    });
+    thread.join();
+
+    PerfStats::LatencyMap after;
+    PerfStats::collectLatencies(&after);
+    EXPECT_EQ(readCount + 2, after[WireFormat::READ].service.getCount());
+    EXPECT_EQ(writeCount + 1, after[WireFormat::WRITE].queueing.getCount());
+}
+
+TEST_F(PerfStatsTest, recordServiceTime_badOpcode) {
+    PerfStats::LatencyMap before;
+    PerfStats::collectLatencies(&before);
+    PerfStats::recordServiceTime(-1, 100);
+    PerfStats::recordServiceTime(WireFormat::ILLEGAL_RPC_TYPE, 100);
+    PerfStats::LatencyMap after;
+    PerfStats::collectLatencies(&after);
+    EXPECT_EQ(before.size(), after.size());
+}
+
+TEST_F(PerfStatsTest, collectHardwareCounts) {
+    PerfStats::HardwareCountMap before;
+    PerfStats::collectHardwareCounts(&before);
+    uint64_t readCycles = before[WireFormat::READ].cycles;
+
+    // Counts from different threads are combined.
+    HardwareCounts counts;
+    counts.cycles = 100;
+    counts.instructions = 50;
+    PerfStats::recordHardwareCounts(WireFormat::READ, counts);
+    std::thread thread([&counts] {
+        PerfStats::recordHardwareCounts(WireFormat::READ, counts);
+    });
+    thread.join();
+
+    PerfStats::HardwareCountMap after;
+    PerfStats::collectHardwareCounts(&after);
+    EXPECT_EQ(readCycles + 200, after[WireFormat::READ].cycles);
+}
+
+TEST_F(PerfStatsTest, recordHardwareCounts_badOpcode) {
+    PerfStats::HardwareCountMap before;
+    PerfStats::collectHardwareCounts(&before);
+    HardwareCounts counts;
+    counts.cycles = 100;
+    PerfStats::recordHardwareCounts(-1, counts);
+    PerfStats::recordHardwareCounts(WireFormat::ILLEGAL_RPC_TYPE, counts);
+    PerfStats::HardwareCountMap after;
+    PerfStats::collectHardwareCounts(&after);
+    EXPECT_EQ(before.size(), after.size());
+}
+
 TEST_F(PerfStatsTest, clusterDiff_findMatchingData) {
     // Test code that skips entries where either before or after
     // data is missing.
@@ -235,6 +320,68 @@ TEST_F(PerfStatsTest, parseStats_shortBuffer) {
     PerfStats::parseStats(&buffer, &parsed);
     ASSERT_EQ(0u, parsed.size());
 }
+TEST_F(PerfStatsTest, parseStats_hardwareCounts) {
+    PerfStats stats;
+    fill(&stats, 1000);
+
+    Buffer buffer;
+    combineStats(&buffer, &stats, ServerId(1, 0).getId(), NULL);
+    appendHardwareCounts(&buffer, WireFormat::READ, 1000);
+    std::vector<PerfStats> parsed;
+    PerfStats::parseStats(&buffer, &parsed);
+    ASSERT_EQ(2u, parsed.size());
+    EXPECT_EQ(1000u, parsed[1].readCount);
+    EXPECT_EQ(5000u, parsed[1].temp5);
+}
+
+TEST_F(PerfStatsTest, parseHardwareCounts) {
+    PerfStats stats;
+    fill(&stats, 1000);
+
+    Buffer buffer;
+    combineStats(&buffer, &stats, ServerId(1, 0).getId(), NULL);
+    PerfStats::HardwareCountMap counts;
+    PerfStats::parseHardwareCounts(&buffer, &counts);
+    EXPECT_EQ(0u, counts.size());
+
+    appendHardwareCounts(&buffer, WireFormat::READ, 1000);
+    appendHardwareCounts(&buffer, WireFormat::WRITE, 3000);
+    appendHardwareCounts(&buffer, WireFormat::READ, 500);
+    PerfStats::parseHardwareCounts(&buffer, &counts);
+    ASSERT_EQ(2u, counts.size());
+    EXPECT_EQ(1500u, counts[WireFormat::READ].cycles);
+    EXPECT_EQ(3000u, counts[WireFormat::READ].instructions);
+    EXPECT_EQ(15u, counts[WireFormat::READ].llcMisses);
+    EXPECT_EQ(1u, counts[WireFormat::READ].dtlbMisses);
+    EXPECT_EQ(3000u, counts[WireFormat::WRITE].cycles);
+
+    // A truncated entry is ignored.
+    buffer.truncate(buffer.size() - 1);
+    PerfStats::parseHardwareCounts(&buffer, &counts);
+    EXPECT_EQ(1000u, counts[WireFormat::READ].cycles);
+}
+
+TEST_F(PerfStatsTest, printClusterStats_hardwareCounts) {
+    PerfStats stats1, stats2;
+    fill(&stats1, 1000);
+    fill(&stats2, 2000);
+
+    Buffer before, after;
+    combineStats(&before, &stats1, ServerId(1, 0).getId(), NULL);
+    combineStats(&after, &stats2, ServerId(1, 0).getId(), NULL);
+    string output = PerfStats::printClusterStats(&before, &after);
+    EXPECT_EQ(string::npos, output.find("Hardware events by opcode"));
+
+    appendHardwareCounts(&before, WireFormat::READ, 1000000);
+    appendHardwareCounts(&after, WireFormat::READ, 3000000);
+    appendHardwareCounts(&after, WireFormat::WRITE, 1000000);
+    output = PerfStats::printClusterStats(&before, &after);
+    EXPECT_NE(string::npos, output.find("Hardware events by opcode"));
+    EXPECT_NE(string::npos, output.find("  READ                            "
+            "2.00   2.00     5.000     0.500"));
+    EXPECT_NE(string::npos, output.find("  WRITE                           "
+            "1.00   2.00     5.000     0.500"));
+}
 
 TEST_F(PerfStatsTest, clusterDiff_formatMetric) {
     PerfStats::Diff diff;
@@ -1793,13 +1793,20 @@ LookupIndexKeysRpc::wait(uint32_t* numHashes, uint16_t* nextKeyLength,
  *      Last key hash of the tablet range to be migrated.
  * \param newOwnerMasterId
  *      ServerId of the node to which the tablet should be migrated.
+ * \param pullPartitions
+ *      If zero (the default), the current owner pushes the tablet's data
+ *      by scanning its log. Otherwise, the new owner pulls the data from
+ *      the current owner's hash table, using this many partitions in
+ *      parallel, and takes ownership once it has all of the data; until
+ *      then the tablet can be read, but not written.
  */
 void
 RamCloud::migrateTablet(uint64_t tableId, uint64_t firstKeyHash,
-        uint64_t lastKeyHash, ServerId newOwnerMasterId)
+        uint64_t lastKeyHash, ServerId newOwnerMasterId,
+        uint32_t pullPartitions)
 {
     MigrateTabletRpc rpc(this, tableId, firstKeyHash, lastKeyHash,
-            newOwnerMasterId);
+            newOwnerMasterId, pullPartitions);
     rpc.wait();
 }
 
@@ -1818,10 +1825,13 @@ RamCloud::migrateTablet(uint64_t tableId, uint64_t firstKeyHash,
  *      Last key hash of the tablet range to be migrated.
  * \param newOwnerMasterId
  *      ServerId of the node to which the tablet should be migrated.
+ * \param pullPartitions
+ *      If nonzero, the new owner pulls the data using this many
+ *      partitions in parallel (see RamCloud::migrateTablet).
  */
 MigrateTabletRpc::MigrateTabletRpc(RamCloud* ramcloud, uint64_t tableId,
         uint64_t firstKeyHash, uint64_t lastKeyHash,
-        ServerId newOwnerMasterId)
+        ServerId newOwnerMasterId, uint32_t pullPartitions)
     : ObjectRpcWrapper(ramcloud->clientContext, tableId, firstKeyHash,
             sizeof(WireFormat::MigrateTablet::Response))
 {
@@ -1831,6 +1841,7 @@ MigrateTabletRpc::MigrateTabletRpc(RamCloud* ramcloud, uint64_t tableId,
     reqHdr->firstKeyHash = firstKeyHash;
     reqHdr->lastKeyHash = lastKeyHash;
     reqHdr->newOwnerMasterId = newOwnerMasterId.getId();
+    reqHdr->pullPartitions = pullPartitions;
     send();
 }
 
@@ -2009,6 +2020,7 @@ ReadRpc::ReadRpc(RamCloud* ramcloud, uint64_t tableId,
     : ObjectRpcWrapper(ramcloud->clientContext, tableId, key, keyLength,
             sizeof(WireFormat::Read::Response), value)
 {
+    readOnly = true;
     value->reset();
     WireFormat::Read::Request* reqHdr(allocHeader<WireFormat::Read>());
     reqHdr->tableId = tableId;
@@ -2074,6 +2086,7 @@ ReadKeysAndValueRpc::ReadKeysAndValueRpc(RamCloud* ramcloud, uint64_t tableId,
     : ObjectRpcWrapper(ramcloud->clientContext, tableId, key, keyLength,
             sizeof(WireFormat::ReadKeysAndValue::Response), value)
 {
+    readOnly = true;
     value->reset();
     WireFormat::ReadKeysAndValue::Request* reqHdr(allocHeader<
                             WireFormat::ReadKeysAndValue>());
@@ -113,7 +113,8 @@ class RamCloud {
             uint32_t* numHashes, uint16_t* nextKeyLength,
             uint64_t* nextKeyHash);
     void migrateTablet(uint64_t tableId, uint64_t firstKeyHash,
-            uint64_t lastKeyHash, ServerId newOwnerMasterId);
+            uint64_t lastKeyHash, ServerId newOwnerMasterId,
+            uint32_t pullPartitions = 0);
     void multiIncrement(MultiIncrementObject* requests[], uint32_t numRequests);
     void multiRead(MultiReadObject* requests[], uint32_t numRequests);
     void multiRemove(MultiRemoveObject* requests[], uint32_t numRequests);
@@ -551,7 +552,7 @@ class MigrateTabletRpc : public ObjectRpcWrapper {
   public:
     MigrateTabletRpc(RamCloud* ramcloud, uint64_t tableId,
             uint64_t firstKeyHash, uint64_t lastKeyHash,
-            ServerId newMasterOwnerId);
+            ServerId newMasterOwnerId, uint32_t pullPartitions = 0);
     ~MigrateTabletRpc() {}
     /// \copydoc RpcWrapper::docForWait
     void wait() {simpleWait(context);}
@@ -15,6 +15,7 @@
 
 #include <unordered_set>
 #include <algorithm>
+#include <set>
 #include <cmath>
 
 #include "Recovery.h"
@@ -462,6 +463,7 @@ BackupStartTask::BackupStartTask(Recovery* recovery,
                                  ServerId backupId)
     : backupId(backupId)
     , result()
+    , decodeSources()
     , recovery(recovery)
     , rpc()
     , done()
@@ -583,11 +585,13 @@ BackupStartTask::wait()
 }
 
 BackupStartPartitionTask::BackupStartPartitionTask(Recovery* recovery,
-                                                   ServerId backupServerId)
+        ServerId backupServerId,
+        const vector<StartPartitioningRpc::Fragment>& decodeSources)
         : done()
         , rpc()
         , backupServerId(backupServerId)
         , recovery(recovery)
+        , decodeSources(decodeSources)
 {
 }
 
@@ -598,7 +602,8 @@ BackupStartPartitionTask::send()
     LOG(DEBUG, "Sending StartPartitioning: %s",
         backupServerId.toString().c_str());
     rpc.construct(recovery->context, backupServerId, recovery->recoveryId,
-                recovery->crashedServerId, &(recovery->dataToRecover));
+                recovery->crashedServerId, &(recovery->dataToRecover),
+                decodeSources);
 }
 
 void
@@ -620,6 +625,119 @@ BackupStartPartitionTask::wait()
     done = true;
 }
 
+/**
+ * Arrange for the segments of which backups only have erasure-coded
+ * fragments (and no full replica) to be rebuilt during recovery. For each
+ * such segment one backup holding a fragment is chosen to fetch enough of
+ * the others and decode the segment; it is picked among the holders of the
+ * newest generation of fragments that has enough distinct fragments,
+ * preferring backups with few primary replicas to load. Its fragment is
+ * turned into a primary replica in its results and the other holders are
+ * recorded in its decodeSources. All other fragments are dropped from the
+ * results, so a segment that can't be rebuilt shows up as missing in
+ * verifyLogComplete().
+ *
+ * \param tasks
+ *      Already run tasks holding the results of startReadingData calls
+ *      to all of the available backups.
+ * \param taskCount
+ *      Number of elements in #tasks.
+ */
+void
+planDecodes(Tub<BackupStartTask> tasks[], size_t taskCount)
+{
+    typedef StartReadingDataRpc::Replica Replica;
+
+    // Fragments of each <segment id, generation> along with the index in
+    // tasks of the backup holding each one.
+    std::map<std::pair<uint64_t, uint32_t>,
+             vector<std::pair<size_t, Replica>>> fragments;
+    std::unordered_set<uint64_t> fullReplicas;
+    vector<uint32_t> primaryCounts(taskCount);
+    for (size_t i = 0; i < taskCount; ++i) {
+        const auto& result = tasks[i]->result;
+        primaryCounts[i] = result.primaryReplicaCount;
+        foreach (const auto& replica, result.replicas) {
+            if (replica.dataFragments == 0) {
+                fullReplicas.insert(replica.segmentId);
+            } else {
+                fragments[{replica.segmentId, replica.fragmentGeneration}].
+                    emplace_back(i, replica);
+            }
+        }
+    }
+    if (fragments.empty())
+        return;
+
+    vector<vector<Replica>> decodes(taskCount);
+    std::unordered_set<uint64_t> planned;
+    for (auto it = fragments.rbegin(); it != fragments.rend(); ++it) {
+        uint64_t segmentId = it->first.first;
+        const auto& holders = it->second;
+        if (contains(fullReplicas, segmentId) || contains(planned, segmentId))
+            continue;
+        uint32_t dataFragments = holders[0].second.dataFragments;
+        uint32_t totalFragments =
+            dataFragments + holders[0].second.parityFragments;
+        std::set<uint8_t> indexes;
+        foreach (const auto& holder, holders) {
+            if (holder.second.fragmentIndex < totalFragments)
+                indexes.insert(holder.second.fragmentIndex);
+        }
+        if (indexes.size() < dataFragments) {
+            LOG(NOTICE, "Only %lu of the %u fragments needed to rebuild "
+                "segment %lu (generation %u) are available",
+                indexes.size(), dataFragments, segmentId, it->first.second);
+            continue;
+        }
+
+        size_t decoder = holders[0].first;
+        foreach (const auto& holder, holders) {
+            if (primaryCounts[holder.first] < primaryCounts[decoder])
+                decoder = holder.first;
+        }
+        foreach (const auto& holder, holders) {
+            if (holder.first == decoder) {
+                decodes[decoder].push_back(holder.second);
+                continue;
+            }
+            tasks[decoder]->decodeSources.emplace_back(segmentId,
+                tasks[holder.first]->backupId.getId(),
+                holder.second.fragmentIndex);
+        }
+        ++primaryCounts[decoder];
+        planned.insert(segmentId);
+    }
+
+    // Put the fragments to be decoded after each backup's primaries and
+    // drop all of the others.
+    for (size_t i = 0; i < taskCount; ++i) {
+        auto& result = tasks[i]->result;
+        vector<Replica> newReplicas;
+        newReplicas.reserve(result.replicas.size());
+        uint32_t newPrimaryReplicaCount = 0;
+        for (size_t j = 0; j < result.primaryReplicaCount; ++j) {
+            if (result.replicas[j].dataFragments == 0) {
+                newReplicas.push_back(result.replicas[j]);
+                ++newPrimaryReplicaCount;
+            }
+        }
+        foreach (const auto& replica, decodes[i]) {
+            newReplicas.push_back(replica);
+            ++newPrimaryReplicaCount;
+        }
+        for (size_t j = result.primaryReplicaCount;
+             j < result.replicas.size(); ++j) {
+            if (result.replicas[j].dataFragments == 0)
+                newReplicas.push_back(result.replicas[j]);
+        }
+        std::swap(result.replicas, newReplicas);
+        result.primaryReplicaCount = newPrimaryReplicaCount;
+    }
+    LOG(NOTICE, "Rebuilding %lu segments from erasure-coded fragments",
+        planned.size());
+}
+
 /**
  * Given lists of replicas provided by backups determine whether all
  * the segments in a log digest are claimed to be available on at
@@ -731,6 +849,12 @@ findLogDigest(Tub<BackupStartTask> tasks[], size_t taskCount)
 struct ReplicaAndLoadTime {
     WireFormat::Recover::Replica replica;
     uint64_t expectedLoadTimeMs;
+    /// Index in the tasks array of the backup holding the replica.
+    size_t taskIndex;
+    /// True for primary replicas, which the backup loads eagerly.
+    bool primary;
+    /// True for secondary replicas chosen to take load off a busy backup.
+    bool stolen;
     bool operator<(const ReplicaAndLoadTime& r) const {
         return expectedLoadTimeMs < r.expectedLoadTimeMs;
     }
@@ -742,6 +866,17 @@ struct ReplicaAndLoadTime {
  * Order primaries (and even secondaries among themselves anyway) based
  * on when they are expected to be loaded in from disk.
  *
+ * Each backup's estimates start after the replicas it reported still having
+ * queued for other recoveries, so the disks of backups serving several
+ * crashed masters at once aren't treated as idle. Then, starting with the
+ * segments expected to load last, a segment whose primary is stuck behind
+ * a long queue is moved to a secondary replica on a backup that will have
+ * finished all of its own primaries before then. Secondaries are loaded on
+ * demand ahead of the backup's primaries, so each such move delays that
+ * backup's primaries by one replica; the condition above ensures this never
+ * pushes out the time the last segment is expected to load. The primary
+ * stays in the script as a fallback.
+ *
  * \param tasks
  *      Already run tasks holding the results of startReadingData calls
  *      to all of the available backups.
@@ -765,35 +900,47 @@ buildReplicaMap(Tub<BackupStartTask> tasks[],
                 uint64_t headId)
 {
     vector<ReplicaAndLoadTime> replicasToSort;
+    // Estimated time for each backup to load one replica, to work through
+    // the replicas it has queued for other recoveries, and how much moving
+    // replicas onto it has delayed its primaries; all indexed like #tasks.
+    vector<uint64_t> replicaLoadTimeMs(taskCount);
+    vector<uint64_t> queuedLoadTimeMs(taskCount);
+    vector<uint64_t> delayMs(taskCount);
     for (uint32_t taskIndex = 0; taskIndex < taskCount; taskIndex++) {
         const auto& task = tasks[taskIndex];
         const auto backupId = task->backupId;
         const uint64_t speed = (*tracker).getServerDetails(backupId)->
                                                     expectedReadMBytesPerSec;
+        const uint64_t loadTimeMs = 8 * 1000 / (speed ?: 1);
+        const uint64_t queuedMs = task->result.queuedReplicaCount * loadTimeMs;
+        replicaLoadTimeMs[taskIndex] = loadTimeMs;
+        queuedLoadTimeMs[taskIndex] = queuedMs;
 
         LOG(DEBUG, "Adding %lu segment replicas from %s "
-                   "with bench speed of %lu",
+                   "with bench speed of %lu and %u replicas already queued",
             task->result.replicas.size(),
-            backupId.toString().c_str(), speed);
+            backupId.toString().c_str(), speed,
+            task->result.queuedReplicaCount);
 
         for (size_t i = 0; i < task->result.replicas.size(); ++i) {
             uint64_t expectedLoadTimeMs;
-            if (i < task->result.primaryReplicaCount) {
+            bool primary = i < task->result.primaryReplicaCount;
+            if (primary) {
                 // for primaries just estimate when they'll load
-                expectedLoadTimeMs = (i + 1) * 8 * 1000 / (speed ?: 1);
+                expectedLoadTimeMs = queuedMs + (i + 1) * loadTimeMs;
             } else {
                 // for secondaries estimate when they'll load
                 // but add a huge bias so secondaries don't overlap
                 // with primaries but are still interleaved
-                expectedLoadTimeMs =
-                    ((i + 1) - task->result.primaryReplicaCount) *
-                                     8 * 1000/ (speed ?: 1);
+                expectedLoadTimeMs = queuedMs +
+                    ((i + 1) - task->result.primaryReplicaCount) * loadTimeMs;
                 expectedLoadTimeMs += 1000000;
             }
             const auto& replica = task->result.replicas[i];
             if (replica.segmentId <= headId) {
                 ReplicaAndLoadTime r{{ backupId.getId(), replica.segmentId },
-                                      expectedLoadTimeMs};
+                                      expectedLoadTimeMs, taskIndex, primary,
+                                      false};
                 replicasToSort.push_back(r);
             } else {
                 // Getting here is not necessarily a sign of a problem.
@@ -806,14 +953,74 @@ buildReplicaMap(Tub<BackupStartTask> tasks[],
             }
         }
     }
-    std::sort(replicasToSort.begin(), replicasToSort.end());
+
+    // Group the replicas by segment and consider the segments with both
+    // primary and secondary replicas, latest expected load time first.
+    std::map<uint64_t, vector<ReplicaAndLoadTime*>> segments;
+    foreach (auto& r, replicasToSort)
+        segments[r.replica.segmentId].push_back(&r);
+    vector<std::pair<uint64_t, uint64_t>> segmentsByLoadTime;
+    foreach (const auto& segment, segments) {
+        uint64_t primaryMs = ~0lu;
+        bool hasSecondary = false;
+        foreach (const auto* r, segment.second) {
+            if (r->primary)
+                primaryMs = std::min(primaryMs, r->expectedLoadTimeMs);
+            else
+                hasSecondary = true;
+        }
+        if (primaryMs != ~0lu && hasSecondary)
+            segmentsByLoadTime.emplace_back(primaryMs, segment.first);
+    }
+    std::sort(segmentsByLoadTime.rbegin(), segmentsByLoadTime.rend());
+
+    uint32_t stolenCount = 0;
+    foreach (const auto& entry, segmentsByLoadTime) {
+        uint64_t primaryMs = ~0lu;
+        ReplicaAndLoadTime* best = NULL;
+        uint64_t bestDoneMs = ~0lu;
+        foreach (auto* r, segments[entry.second]) {
+            size_t i = r->taskIndex;
+            if (r->primary) {
+                primaryMs = std::min(primaryMs,
+                                     r->expectedLoadTimeMs + delayMs[i]);
+                continue;
+            }
+            uint64_t doneMs = queuedLoadTimeMs[i] + delayMs[i] +
+                (tasks[i]->result.primaryReplicaCount + 1) *
+                replicaLoadTimeMs[i];
+            if (doneMs < bestDoneMs) {
+                best = r;
+                bestDoneMs = doneMs;
+            }
+        }
+        if (best == NULL || bestDoneMs >= primaryMs)
+            continue;
+        size_t i = best->taskIndex;
+        best->expectedLoadTimeMs =
+            queuedLoadTimeMs[i] + delayMs[i] + replicaLoadTimeMs[i];
+        best->stolen = true;
+        delayMs[i] += replicaLoadTimeMs[i];
+        ++stolenCount;
+    }
+    foreach (auto& r, replicasToSort) {
+        if (r.primary)
+            r.expectedLoadTimeMs += delayMs[r.taskIndex];
+    }
+    if (stolenCount > 0) {
+        LOG(NOTICE, "Reading %u segments from secondary replicas to take "
+            "load off of busy backups", stolenCount);
+    }
+
+    std::stable_sort(replicasToSort.begin(), replicasToSort.end());
     vector<WireFormat::Recover::Replica> replicaMap;
     foreach(const auto& sortedReplica, replicasToSort) {
         LOG(DEBUG, "Load segment %lu replica from backup %s "
-            "with expected load time of %lu ms",
+            "with expected load time of %lu ms%s",
             sortedReplica.replica.segmentId,
             ServerId(sortedReplica.replica.backupId).toString().c_str(),
-            sortedReplica.expectedLoadTimeMs);
+            sortedReplica.expectedLoadTimeMs,
+            sortedReplica.stolen ? " (instead of its primary)" : "");
         replicaMap.push_back(sortedReplica.replica);
     }
     return replicaMap;
@@ -861,12 +1068,14 @@ Recovery::startBackups()
     uint32_t i = 0;
     foreach (ServerId backup, backups) {
         backupStartTasks[i].construct(this, backup);
-        backupPartitionTasks[i].construct(this, backup);
+        backupPartitionTasks[i].construct(this, backup,
+                                          backupStartTasks[i]->decodeSources);
         i++;
     }
 
     /* Broadcast 1: start reading replicas from disk and verify log integrity */
     parallelRun(backupStartTasks.get(), backups.size(), maxActiveBackupHosts);
+    planDecodes(backupStartTasks.get(), backups.size());
 
     auto digestInfo = findLogDigest(backupStartTasks.get(), backups.size());
     if (!digestInfo) {
@@ -57,6 +57,13 @@ class BackupStartTask {
     const ServerId backupId;
     StartReadingDataRpc::Result result;
 
+    /**
+     * Segments this backup should rebuild from erasure-coded fragments,
+     * along with the other backups holding fragments of them. Filled in by
+     * planDecodes() and sent by the matching BackupStartPartitionTask.
+     */
+    vector<StartPartitioningRpc::Fragment> decodeSources;
+
   PRIVATE:
     Recovery* recovery;
     Tub<StartReadingDataRpc> rpc;
@@ -80,7 +87,8 @@ class BackupStartTask {
  */
 class BackupStartPartitionTask {
   PUBLIC:
-    BackupStartPartitionTask(Recovery* recovery, ServerId backupServerId);
+    BackupStartPartitionTask(Recovery* recovery, ServerId backupServerId,
+        const vector<StartPartitioningRpc::Fragment>& decodeSources);
     bool isReady() { return rpc && rpc->isReady(); }
     bool isDone() const { return done; }
     void send();
@@ -92,10 +100,12 @@ class BackupStartPartitionTask {
     Tub<StartPartitioningRpc> rpc;
     const ServerId backupServerId;
     const Recovery* recovery;
+    const vector<StartPartitioningRpc::Fragment>& decodeSources;
 
     DISALLOW_COPY_AND_ASSIGN(BackupStartPartitionTask);
 };
 
+void planDecodes(Tub<BackupStartTask> tasks[], size_t taskCount);
 bool verifyLogComplete(Tub<BackupStartTask> tasks[],
                        size_t taskCount,
                        const LogDigest& digest);
@@ -13,6 +13,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <set>
+
 #include "RecoverySegmentBuilder.h"
 #include "Object.h"
 #include "RpcResult.h"
@@ -21,6 +23,7 @@
 #include "ShortMacros.h"
 #include "TransactionManager.h"
 #include "TxDecisionRecord.h"
+#include "ValueCompressor.h"
 
 namespace RAMCloud {
 
@@ -85,7 +88,8 @@ RecoverySegmentBuilder::build(const void* buffer, uint32_t length,
             && type != LOG_ENTRY_TYPE_PREP
             && type != LOG_ENTRY_TYPE_PREPTOMB
             && type != LOG_ENTRY_TYPE_TXDECISION
-            && type != LOG_ENTRY_TYPE_TXPLIST)
+            && type != LOG_ENTRY_TYPE_TXPLIST
+            && type != LOG_ENTRY_TYPE_VALUEDICT)
             continue;
 
         if (header == NULL) {
@@ -140,6 +144,30 @@ RecoverySegmentBuilder::build(const void* buffer, uint32_t length,
             continue;
         }
 
+        if (type == LOG_ENTRY_TYPE_VALUEDICT) {
+            // Copy value dictionaries to every partition with a tablet of
+            // their table, since any of the table's objects may need them.
+            tableId = entryBuffer.getStart<ValueCompressor::DictionaryHeader>()
+                        ->tableId;
+            std::set<uint64_t> partitionIds;
+            for (int i = 0; i < partitions.tablet_size(); i++) {
+                const ProtoBuf::Tablets::Tablet& tablet(partitions.tablet(i));
+                if (tablet.table_id() == tableId)
+                    partitionIds.insert(tablet.user_data());
+            }
+            foreach (uint64_t partitionId, partitionIds) {
+                if (!recoverySegments[partitionId].append(type,
+                                                          entryBuffer)) {
+                    LOG(WARNING, "Failure appending to a recovery segment "
+                            "for a replica of <%s,%lu>",
+                            ServerId(header->logId).toString().c_str(),
+                            header->segmentId);
+                    throw SegmentRecoveryFailedException(HERE);
+                }
+            }
+            continue;
+        }
+
         if (type == LOG_ENTRY_TYPE_OBJ) {
             Object object(entryBuffer);
             tableId = object.getTableId();
@@ -907,6 +907,51 @@ TEST_F(RecoveryTest, BackupStartTask_filterOutInvalidReplicas) {
     EXPECT_EQ(~0lu, task.result.logDigestSegmentEpoch);
 }
 
+TEST_F(RecoveryTest, planDecodes) {
+    Tub<BackupStartTask> tasks[3];
+    Recovery recovery(&context, taskQueue, &tableManager, &tracker, NULL,
+                      {1, 0}, recoveryInfo);
+    tasks[0].construct(&recovery, ServerId(2, 0));
+    tasks[1].construct(&recovery, ServerId(3, 0));
+    tasks[2].construct(&recovery, ServerId(4, 0));
+    // Segment 10 has a full replica, segment 11 has 2 of 3 fragments
+    // needed, and segment 12 has enough fragments of generation 1 but not
+    // of generation 2.
+    tasks[0]->result.replicas = {{10, 0, true},
+                                 {10, 0, true, 2, 1, 0, 0},
+                                 {11, 0, true, 3, 1, 0, 0},
+                                 {12, 0, true, 2, 1, 0, 1}};
+    tasks[0]->result.primaryReplicaCount = 1;
+    tasks[1]->result.replicas = {{11, 0, true, 3, 1, 2, 0},
+                                 {12, 0, true, 2, 1, 1, 1},
+                                 {12, 0, true, 2, 1, 2, 2}};
+    tasks[2]->result.replicas = {{12, 0, true, 2, 1, 2, 1}};
+
+    TestLog::Enable _;
+    planDecodes(tasks, 3);
+    EXPECT_EQ(
+        "planDecodes: Only 1 of the 2 fragments needed to rebuild segment 12 "
+            "(generation 2) are available | "
+        "planDecodes: Only 2 of the 3 fragments needed to rebuild segment 11 "
+            "(generation 0) are available | "
+        "planDecodes: Rebuilding 1 segments from erasure-coded fragments",
+        TestLog::get());
+    EXPECT_EQ((vector<StartReadingDataRpc::Replica>{{10, 0, true}}),
+              tasks[0]->result.replicas);
+    EXPECT_EQ(1u, tasks[0]->result.primaryReplicaCount);
+    EXPECT_EQ(0lu, tasks[0]->decodeSources.size());
+    EXPECT_EQ((vector<StartReadingDataRpc::Replica>{
+                    {12, 0, true, 2, 1, 1, 1}}),
+              tasks[1]->result.replicas);
+    EXPECT_EQ(1u, tasks[1]->result.primaryReplicaCount);
+    ASSERT_EQ(2lu, tasks[1]->decodeSources.size());
+    EXPECT_EQ(ServerId(2, 0).getId(), tasks[1]->decodeSources[0].backupId);
+    EXPECT_EQ(0u, tasks[1]->decodeSources[0].fragmentIndex);
+    EXPECT_EQ(ServerId(4, 0).getId(), tasks[1]->decodeSources[1].backupId);
+    EXPECT_EQ(2u, tasks[1]->decodeSources[1].fragmentIndex);
+    EXPECT_EQ(0lu, tasks[2]->result.replicas.size());
+}
+
 TEST_F(RecoveryTest, verifyLogComplete) {
     LogDigest digest;
     digest.addSegmentId(10);
@@ -1025,6 +1070,57 @@ TEST_F(RecoveryTest, buildReplicaMap) {
               replicaMap);
 }
 
+TEST_F(RecoveryTest, buildReplicaMap_busyBackups) {
+    Tub<BackupStartTask> tasks[2];
+    Recovery recovery(&context, taskQueue, &tableManager, &tracker, NULL,
+                      {1, 0}, recoveryInfo);
+    tasks[0].construct(&recovery, ServerId(2, 0));
+    auto* result = &tasks[0]->result;
+    result->replicas.push_back(Replica{88lu, 100u, true});
+    result->replicas.push_back(Replica{89lu, 100u, true});
+    result->replicas.push_back(Replica{90lu, 100u, true});
+    result->primaryReplicaCount = 3;
+
+    tasks[1].construct(&recovery, ServerId(3, 0));
+    result = &tasks[1]->result;
+    result->replicas.push_back(Replica{91lu, 100u, true});
+    result->replicas.push_back(Replica{90lu, 100u, true});
+    result->primaryReplicaCount = 1;
+
+    addServersToTracker(3, {WireFormat::BACKUP_SERVICE});
+
+    // Backup 3 finishes its only primary early, so it takes over segment 90
+    // from the end of backup 2's queue.
+    TestLog::Enable _("buildReplicaMap");
+    auto replicaMap = buildReplicaMap(tasks, 2, &tracker, 91);
+    EXPECT_EQ((vector<WireFormat::Recover::Replica> {
+                    { 2, 88 },
+                    { 3, 90 },
+                    { 2, 89 },
+                    { 3, 91 },
+                    { 2, 90 },
+               }),
+              replicaMap);
+    EXPECT_TRUE(TestUtil::contains(TestLog::get(),
+        "buildReplicaMap: Reading 1 segments from secondary replicas to take "
+        "load off of busy backups"));
+
+    // Once backup 3 is busy with another recovery it doesn't help out, and
+    // its own primary is expected to load later.
+    tasks[1]->result.queuedReplicaCount = 2;
+    TestLog::reset();
+    replicaMap = buildReplicaMap(tasks, 2, &tracker, 91);
+    EXPECT_EQ((vector<WireFormat::Recover::Replica> {
+                    { 2, 88 },
+                    { 2, 89 },
+                    { 2, 90 },
+                    { 3, 91 },
+                    { 3, 90 },
+               }),
+              replicaMap);
+    EXPECT_FALSE(TestUtil::contains(TestLog::get(), "Reading"));
+}
+
 TEST_F(RecoveryTest, buildReplicaMap_badReplicas) {
     Tub<BackupStartTask> tasks[1];
     Recovery recovery(&context, taskQueue, &tableManager, &tracker, NULL,
@@ -0,0 +1,332 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#if __SSSE3__
+#include <tmmintrin.h>
+#endif
+
+#include "ReedSolomon.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+namespace {
+
+/**
+ * Logarithm and antilogarithm tables for GF(2^8), using the generator 2
+ * and the reducing polynomial x^8 + x^4 + x^3 + x^2 + 1 (0x11d).
+ */
+struct GaloisTables {
+    GaloisTables()
+        : exp()
+        , log()
+    {
+        uint32_t x = 1;
+        for (uint32_t i = 0; i < 255; i++) {
+            exp[i] = static_cast<uint8_t>(x);
+            log[x] = static_cast<uint8_t>(i);
+            x <<= 1;
+            if (x & 0x100)
+                x ^= 0x11d;
+        }
+        // Doubling the table lets multiply() skip reducing the sum of two
+        // logarithms mod 255.
+        for (uint32_t i = 255; i < 510; i++)
+            exp[i] = exp[i - 255];
+    }
+
+    /// exp[i] is 2 raised to the i'th power.
+    uint8_t exp[510];
+
+    /// log[x] is the power of 2 that equals x (undefined for x == 0).
+    uint8_t log[256];
+};
+
+/// Returns the tables, building them the first time they are needed.
+const GaloisTables&
+tables()
+{
+    static GaloisTables galoisTables;
+    return galoisTables;
+}
+
+} // anonymous namespace
+
+/**
+ * Construct a ReedSolomon code.
+ *
+ * \param dataFragments
+ *      Number of fragments the data will be divided into. Must be nonzero.
+ * \param parityFragments
+ *      Number of parity fragments to compute. The total number of fragments
+ *      may not exceed 256.
+ *
+ * \throw FatalError
+ *      The parameters don't describe a valid code.
+ */
+ReedSolomon::ReedSolomon(uint32_t dataFragments, uint32_t parityFragments)
+    : dataFragments(dataFragments)
+    , parityFragments(parityFragments)
+    , matrix()
+{
+    if (dataFragments == 0 || dataFragments + parityFragments > 256) {
+        throw FatalError(HERE, format("invalid Reed-Solomon code: %u data "
+                "fragments, %u parity fragments", dataFragments,
+                parityFragments));
+    }
+    uint32_t k = dataFragments;
+    matrix.resize((k + parityFragments) * k);
+    for (uint32_t j = 0; j < k; j++)
+        matrix[j * k + j] = 1;
+
+    // Parity row i, column j is 1 / (x_i + y_j) with x_i = k + i and
+    // y_j = j; the two sets of values are disjoint, so the sum (xor) is
+    // never zero.
+    for (uint32_t i = 0; i < parityFragments; i++) {
+        for (uint32_t j = 0; j < k; j++) {
+            matrix[(k + i) * k + j] =
+                    inverse(static_cast<uint8_t>((k + i) ^ j));
+        }
+    }
+}
+
+/**
+ * Compute the parity fragments for a set of data fragments.
+ *
+ * \param data
+ *      #dataFragments pointers to the data fragments.
+ * \param[out] parity
+ *      #parityFragments pointers to buffers that will be filled in with
+ *      the parity fragments. Must not overlap the data fragments.
+ * \param length
+ *      Length in bytes of each fragment.
+ */
+void
+ReedSolomon::encode(const uint8_t* const data[], uint8_t* const parity[],
+                    uint32_t length) const
+{
+    uint32_t k = dataFragments;
+    for (uint32_t i = 0; i < parityFragments; i++) {
+        memset(parity[i], 0, length);
+        for (uint32_t j = 0; j < k; j++)
+            multiplyAdd(matrix[(k + i) * k + j], data[j], parity[i], length);
+    }
+}
+
+/**
+ * Rebuild the missing fragments of an encoded set, given any #dataFragments
+ * of them.
+ *
+ * \param fragments
+ *      #dataFragments + #parityFragments pointers to fragment buffers: the
+ *      data fragments in order, followed by the parity fragments in order.
+ *      Missing fragments are filled in.
+ * \param present
+ *      One entry for each element of \a fragments; true means that fragment
+ *      holds valid contents, false means it is missing.
+ * \param length
+ *      Length in bytes of each fragment.
+ * \return
+ *      True if the missing fragments were rebuilt; false if fewer than
+ *      #dataFragments fragments were present (in which case \a fragments is
+ *      unmodified).
+ */
+bool
+ReedSolomon::reconstruct(uint8_t* const fragments[], const bool present[],
+                         uint32_t length) const
+{
+    uint32_t k = dataFragments;
+    uint32_t total = k + parityFragments;
+
+    // Decode from the first k fragments that are present.
+    std::vector<uint32_t> rows;
+    for (uint32_t i = 0; i < total && rows.size() < k; i++) {
+        if (present[i])
+            rows.push_back(i);
+    }
+    if (rows.size() < k)
+        return false;
+
+    bool dataMissing = false;
+    for (uint32_t j = 0; j < k; j++) {
+        if (!present[j])
+            dataMissing = true;
+    }
+    if (dataMissing) {
+        // The chosen fragments are the product of the corresponding rows of
+        // the encoding matrix and the data, so the inverse of those rows
+        // turns them back into the data.
+        std::vector<uint8_t> decoding(k * k);
+        for (uint32_t r = 0; r < k; r++) {
+            memcpy(&decoding[r * k], &matrix[rows[r] * k], k);
+        }
+        if (!invert(decoding, k))
+            DIE("Reed-Solomon decoding matrix is singular");
+        for (uint32_t j = 0; j < k; j++) {
+            if (present[j])
+                continue;
+            memset(fragments[j], 0, length);
+            for (uint32_t r = 0; r < k; r++) {
+                multiplyAdd(decoding[j * k + r], fragments[rows[r]],
+                            fragments[j], length);
+            }
+        }
+    }
+
+    // With all of the data in hand, missing parity is just re-encoded.
+    for (uint32_t i = 0; i < parityFragments; i++) {
+        if (present[k + i])
+            continue;
+        memset(fragments[k + i], 0, length);
+        for (uint32_t j = 0; j < k; j++) {
+            multiplyAdd(matrix[(k + i) * k + j], fragments[j],
+                        fragments[k + i], length);
+        }
+    }
+    return true;
+}
+
+/**
+ * Return the product of two elements of GF(2^8).
+ */
+uint8_t
+ReedSolomon::multiply(uint8_t a, uint8_t b)
+{
+    if (a == 0 || b == 0)
+        return 0;
+    const GaloisTables& t = tables();
+    return t.exp[t.log[a] + t.log[b]];
+}
+
+/**
+ * Return the multiplicative inverse of a nonzero element of GF(2^8).
+ */
+uint8_t
+ReedSolomon::inverse(uint8_t a)
+{
+    assert(a != 0);
+    const GaloisTables& t = tables();
+    return t.exp[255 - t.log[a]];
+}
+
+/**
+ * Multiply each byte of a fragment by a constant and add (xor) the results
+ * into another fragment; this is where encoding and decoding spend nearly
+ * all of their time.
+ *
+ * Multiplication by a constant distributes over xor, so the product of a
+ * byte is the xor of the products of its low and high nibbles; each of
+ * those comes from a 16-entry table, and SSSE3's pshufb performs 16 such
+ * lookups in one instruction.
+ *
+ * \param coefficient
+ *      Constant to multiply by.
+ * \param in
+ *      Bytes to multiply.
+ * \param[in,out] out
+ *      The products are added to these bytes.
+ * \param length
+ *      Number of bytes in \a in and \a out.
+ */
+void
+ReedSolomon::multiplyAdd(uint8_t coefficient, const uint8_t* in,
+                         uint8_t* out, uint32_t length)
+{
+    if (coefficient == 0)
+        return;
+    uint8_t low[16];
+    uint8_t high[16];
+    for (uint32_t i = 0; i < 16; i++) {
+        low[i] = multiply(coefficient, static_cast<uint8_t>(i));
+        high[i] = multiply(coefficient, static_cast<uint8_t>(i << 4));
+    }
+
+    uint32_t i = 0;
+#if __SSSE3__
+    const __m128i lowTable =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(low));
+    const __m128i highTable =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(high));
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    for (; i + 16 <= length; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i lowNibbles = _mm_and_si128(x, mask);
+        __m128i highNibbles = _mm_and_si128(_mm_srli_epi64(x, 4), mask);
+        __m128i product = _mm_xor_si128(
+                _mm_shuffle_epi8(lowTable, lowNibbles),
+                _mm_shuffle_epi8(highTable, highNibbles));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(out + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm_xor_si128(y, product));
+    }
+#endif
+    for (; i < length; i++) {
+        out[i] = static_cast<uint8_t>(out[i] ^ low[in[i] & 0x0f] ^
+                                      high[in[i] >> 4]);
+    }
+}
+
+/**
+ * Invert a square matrix over GF(2^8) in place, using Gauss-Jordan
+ * elimination.
+ *
+ * \param[in,out] matrix
+ *      n x n matrix, stored by rows; replaced by its inverse.
+ * \param n
+ *      Dimension of \a matrix.
+ * \return
+ *      False if the matrix is singular (in which case \a matrix is left
+ *      in an undefined state).
+ */
+bool
+ReedSolomon::invert(std::vector<uint8_t>& matrix, uint32_t n)
+{
+    std::vector<uint8_t> result(n * n);
+    for (uint32_t i = 0; i < n; i++)
+        result[i * n + i] = 1;
+
+    for (uint32_t col = 0; col < n; col++) {
+        uint32_t pivot = col;
+        while (pivot < n && matrix[pivot * n + col] == 0)
+            pivot++;
+        if (pivot == n)
+            return false;
+        if (pivot != col) {
+            for (uint32_t c = 0; c < n; c++) {
+                std::swap(matrix[pivot * n + c], matrix[col * n + c]);
+                std::swap(result[pivot * n + c], result[col * n + c]);
+            }
+        }
+
+        uint8_t scale = inverse(matrix[col * n + col]);
+        for (uint32_t c = 0; c < n; c++) {
+            matrix[col * n + c] = multiply(matrix[col * n + c], scale);
+            result[col * n + c] = multiply(result[col * n + c], scale);
+        }
+        for (uint32_t r = 0; r < n; r++) {
+            uint8_t factor = matrix[r * n + col];
+            if (r == col || factor == 0)
+                continue;
+            for (uint32_t c = 0; c < n; c++) {
+                matrix[r * n + c] ^= multiply(factor, matrix[col * n + c]);
+                result[r * n + c] ^= multiply(factor, result[col * n + c]);
+            }
+        }
+    }
+    matrix.swap(result);
+    return true;
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,82 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_REEDSOLOMON_H
+#define RAMCLOUD_REEDSOLOMON_H
+
+#include <vector>
+
+#include "Common.h"
+
+namespace RAMCloud {
+
+/**
+ * A systematic Reed-Solomon erasure code over GF(2^8), intended for storing
+ * closed segments on backups more compactly than by keeping full replicas.
+ * The data is divided into #dataFragments equal-sized fragments, encode()
+ * computes #parityFragments more from them, and reconstruct() rebuilds any
+ * missing fragments from any #dataFragments of the total. For example, a
+ * 4+2 code survives the loss of any two fragments while using 1.5x the
+ * size of the data, rather than 3x for three full replicas.
+ *
+ * The parity rows of the encoding matrix form a Cauchy matrix, so every
+ * square submatrix made of rows of the full encoding matrix is invertible.
+ * The inner loop (multiplying a fragment by a constant and adding the
+ * result into another fragment) uses SSSE3 byte shuffles to perform 16
+ * multiplications at a time when the compiler allows it.
+ *
+ * Instances are immutable after construction, so they may be shared among
+ * threads.
+ */
+class ReedSolomon {
+  PUBLIC:
+    ReedSolomon(uint32_t dataFragments, uint32_t parityFragments);
+
+    void encode(const uint8_t* const data[], uint8_t* const parity[],
+                uint32_t length) const;
+    bool reconstruct(uint8_t* const fragments[], const bool present[],
+                     uint32_t length) const;
+
+    static uint8_t multiply(uint8_t a, uint8_t b);
+    static uint8_t inverse(uint8_t a);
+    static void multiplyAdd(uint8_t coefficient, const uint8_t* in,
+                            uint8_t* out, uint32_t length);
+
+    /// Number of fragments the original data is divided into; also the
+    /// number of fragments needed to reconstruct it.
+    const uint32_t dataFragments;
+
+    /// Number of parity fragments computed from the data fragments; also
+    /// the number of fragments that can be lost without losing data.
+    const uint32_t parityFragments;
+
+  PRIVATE:
+    static bool invert(std::vector<uint8_t>& matrix, uint32_t n);
+
+    /**
+     * The encoding matrix, stored by rows: (dataFragments + parityFragments)
+     * rows of dataFragments coefficients each. Fragment i is the sum over j
+     * of matrix[i * dataFragments + j] times data fragment j. The first
+     * dataFragments rows form an identity matrix (the code is systematic:
+     * the data fragments are just pieces of the original data).
+     */
+    std::vector<uint8_t> matrix;
+
+    DISALLOW_COPY_AND_ASSIGN(ReedSolomon);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_REEDSOLOMON_H
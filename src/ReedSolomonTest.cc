@@ -0,0 +1,137 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "ReedSolomon.h"
+
+namespace RAMCloud {
+
+class ReedSolomonTest : public ::testing::Test {
+  public:
+    enum { DATA = 4, PARITY = 2, TOTAL = DATA + PARITY };
+
+    // Odd length, so both the vectorized loop and the byte-at-a-time
+    // loop in multiplyAdd are exercised.
+    enum { LENGTH = 1001 };
+
+    ReedSolomon code;
+    uint8_t fragments[TOTAL][LENGTH];
+    uint8_t original[TOTAL][LENGTH];
+    uint8_t* pointers[TOTAL];
+
+    ReedSolomonTest()
+        : code(DATA, PARITY)
+        , fragments()
+        , original()
+        , pointers()
+    {
+        for (uint32_t j = 0; j < DATA; j++) {
+            for (uint32_t i = 0; i < LENGTH; i++)
+                fragments[j][i] = static_cast<uint8_t>(generateRandom());
+        }
+        for (uint32_t j = 0; j < TOTAL; j++)
+            pointers[j] = fragments[j];
+        const uint8_t* data[DATA];
+        for (uint32_t j = 0; j < DATA; j++)
+            data[j] = fragments[j];
+        code.encode(data, &pointers[DATA], LENGTH);
+        memcpy(original, fragments, sizeof(fragments));
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(ReedSolomonTest);
+};
+
+TEST_F(ReedSolomonTest, constructor_invalid) {
+    EXPECT_THROW(ReedSolomon(0, 2), FatalError);
+    EXPECT_THROW(ReedSolomon(200, 57), FatalError);
+    EXPECT_NO_THROW(ReedSolomon(200, 56));
+}
+
+TEST_F(ReedSolomonTest, multiply) {
+    EXPECT_EQ(0, ReedSolomon::multiply(0, 0x53));
+    EXPECT_EQ(0x53, ReedSolomon::multiply(1, 0x53));
+    // Overflow out of the top bit is reduced by the polynomial 0x11d.
+    EXPECT_EQ(0x1d, ReedSolomon::multiply(2, 0x80));
+    for (uint32_t x = 1; x < 256; x++) {
+        uint8_t a = static_cast<uint8_t>(x);
+        EXPECT_EQ(1, ReedSolomon::multiply(a, ReedSolomon::inverse(a)));
+    }
+}
+
+TEST_F(ReedSolomonTest, multiplyAdd) {
+    uint8_t expected[LENGTH];
+    uint8_t actual[LENGTH];
+    memcpy(expected, fragments[1], LENGTH);
+    memcpy(actual, fragments[1], LENGTH);
+    for (uint32_t i = 0; i < LENGTH; i++) {
+        expected[i] ^= ReedSolomon::multiply(0xa7, fragments[0][i]);
+    }
+    ReedSolomon::multiplyAdd(0xa7, fragments[0], actual, LENGTH);
+    EXPECT_EQ(0, memcmp(expected, actual, LENGTH));
+
+    ReedSolomon::multiplyAdd(0, fragments[0], actual, LENGTH);
+    EXPECT_EQ(0, memcmp(expected, actual, LENGTH));
+}
+
+TEST_F(ReedSolomonTest, encode_systematic) {
+    // The data fragments are untouched, and parity isn't trivial.
+    EXPECT_EQ(0, memcmp(original, fragments, sizeof(fragments)));
+    EXPECT_NE(0, memcmp(fragments[DATA], fragments[DATA + 1], LENGTH));
+}
+
+TEST_F(ReedSolomonTest, reconstruct_anyTwoLost) {
+    for (uint32_t a = 0; a < TOTAL; a++) {
+        for (uint32_t b = a; b < TOTAL; b++) {
+            bool present[TOTAL];
+            for (uint32_t j = 0; j < TOTAL; j++)
+                present[j] = true;
+            present[a] = present[b] = false;
+            memset(fragments[a], 0xee, LENGTH);
+            memset(fragments[b], 0xee, LENGTH);
+            EXPECT_TRUE(code.reconstruct(pointers, present, LENGTH));
+            EXPECT_EQ(0, memcmp(original, fragments, sizeof(fragments)))
+                << "lost fragments " << a << " and " << b;
+        }
+    }
+}
+
+TEST_F(ReedSolomonTest, reconstruct_tooManyLost) {
+    bool present[TOTAL] = {false, true, false, true, false, true};
+    memset(fragments[0], 0xee, LENGTH);
+    EXPECT_FALSE(code.reconstruct(pointers, present, LENGTH));
+    EXPECT_EQ(0xee, fragments[0][0]);
+}
+
+TEST_F(ReedSolomonTest, invert) {
+    std::vector<uint8_t> singular = {1, 2, 1, 2};
+    EXPECT_FALSE(ReedSolomon::invert(singular, 2));
+
+    // Needs a row swap to find a pivot.
+    std::vector<uint8_t> matrix = {0, 3, 5, 7};
+    std::vector<uint8_t> inverse = matrix;
+    ASSERT_TRUE(ReedSolomon::invert(inverse, 2));
+    for (uint32_t r = 0; r < 2; r++) {
+        for (uint32_t c = 0; c < 2; c++) {
+            uint8_t sum = 0;
+            for (uint32_t i = 0; i < 2; i++) {
+                sum ^= ReedSolomon::multiply(matrix[r * 2 + i],
+                                             inverse[i * 2 + c]);
+            }
+            EXPECT_EQ(r == c ? 1 : 0, sum);
+        }
+    }
+}
+
+}  // namespace RAMCloud
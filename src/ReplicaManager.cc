@@ -16,6 +16,7 @@
 #include "BackupClient.h"
 #include "CycleCounter.h"
 #include "Logger.h"
+#include "LoadAwareBackupSelector.h"
 #include "MinCopysetsBackupSelector.h"
 #include "ShortMacros.h"
 #include "RawMetrics.h"
@@ -41,12 +42,38 @@ namespace RAMCloud {
  *      replication.
  * \param allowLocalBackup
  *      Specifies whether to allow replication to the local backup.
+ * \param maxWriteRpcsPerReplica
+ *      Maximum number of write rpcs outstanding at once for each replica;
+ *      see ReplicatedSegment::maxWriteRpcsPerReplica.
+ * \param batchBackupWrites
+ *      True means writes for different segments headed to the same backup
+ *      are combined into a single rpc (see BackupWriteBatcher).
+ * \param forwardBackupWrites
+ *      True means writes are sent only to the backup storing a segment's
+ *      primary replica, which forwards them to the secondary replicas
+ *      (see ReplicatedSegment::forwardWrites).
+ * \param loadAwareBackupSelection
+ *      True means replicas are steered toward the backups with the least
+ *      data outstanding (see LoadAwareBackupSelector). Ignored if
+ *      \a useMinCopysets is true.
+ * \param erasureDataFragments
+ *      If nonzero, closed segments are stored on backups as this many data
+ *      fragments plus \a erasureParityFragments parity fragments instead
+ *      of as full replicas (see ReplicatedSegment::erasureCode).
+ * \param erasureParityFragments
+ *      Number of parity fragments; see \a erasureDataFragments.
  */
 ReplicaManager::ReplicaManager(Context* context,
                                const ServerId* masterId,
                                uint32_t numReplicas,
                                bool useMinCopysets,
-                               bool allowLocalBackup)
+                               bool allowLocalBackup,
+                               uint32_t maxWriteRpcsPerReplica,
+                               bool batchBackupWrites,
+                               bool forwardBackupWrites,
+                               bool loadAwareBackupSelection,
+                               uint32_t erasureDataFragments,
+                               uint32_t erasureParityFragments)
     : context(context)
     , numReplicas(numReplicas)
     , backupSelector()
@@ -58,6 +85,11 @@ ReplicaManager::ReplicaManager(Context* context,
     , writeRpcsInFlight(0)
     , freeRpcsInFlight(0)
     , replicationEpoch()
+    , writeBatcher()
+    , maxWriteRpcsPerReplica(maxWriteRpcsPerReplica)
+    , forwardBackupWrites(forwardBackupWrites)
+    , erasureCode()
+    , encodingsInFlight(0)
     , failureMonitor(context, this)
     , replicationCounter()
     , useMinCopysets(useMinCopysets)
@@ -67,11 +99,19 @@ ReplicaManager::ReplicaManager(Context* context,
         backupSelector.reset(new MinCopysetsBackupSelector(context, masterId,
                                                            numReplicas,
                                                            allowLocalBackup));
+    } else if (loadAwareBackupSelection) {
+        backupSelector.reset(new LoadAwareBackupSelector(context, masterId,
+                                                         numReplicas,
+                                                         allowLocalBackup));
     } else {
         backupSelector.reset(new BackupSelector(context, masterId,
                                                 numReplicas, allowLocalBackup));
     }
     replicationEpoch.construct(context, &taskQueue, masterId);
+    if (batchBackupWrites)
+        writeBatcher.construct(context, taskQueue);
+    if (erasureDataFragments > 0)
+        erasureCode.construct(erasureDataFragments, erasureParityFragments);
 }
 
 /**
@@ -422,7 +462,10 @@ ReplicaManager::allocateSegment(const Lock& lock,
                                  *replicationEpoch,
                                  dataMutex, segmentId, segment,
                                  isLogHead, *masterId, numReplicas,
-                                 &replicationCounter);
+                                 &replicationCounter, 1024 * 1024,
+                                 maxWriteRpcsPerReplica, writeBatcher.get(),
+                                 forwardBackupWrites, erasureCode.get(),
+                                 &encodingsInFlight);
     replicatedSegmentList.push_back(*replicatedSegment);
 
     // ReplicatedSegment's constructor has scheduled the open.
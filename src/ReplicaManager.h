@@ -23,7 +23,9 @@
 #include "BackupFailureMonitor.h"
 #include "BoostIntrusive.h"
 #include "BackupSelector.h"
+#include "BackupWriteBatcher.h"
 #include "CoordinatorClient.h"
+#include "ReedSolomon.h"
 #include "UpdateReplicationEpochTask.h"
 #include "ReplicatedSegment.h"
 #include "ServerTracker.h"
@@ -68,7 +70,13 @@ class ReplicaManager
                    const ServerId* masterId,
                    uint32_t numReplicas,
                    bool useMinCopysets,
-                   bool allowLocalBackup);
+                   bool allowLocalBackup,
+                   uint32_t maxWriteRpcsPerReplica = 1,
+                   bool batchBackupWrites = false,
+                   bool forwardBackupWrites = false,
+                   bool loadAwareBackupSelection = false,
+                   uint32_t erasureDataFragments = 0,
+                   uint32_t erasureParityFragments = 0);
     ~ReplicaManager();
 
     bool isIdle();
@@ -175,6 +183,38 @@ class ReplicaManager
      */
     Tub<UpdateReplicationEpochTask> replicationEpoch;
 
+    /**
+     * Combines write rpcs for different segments headed for the same
+     * backup; shared among ReplicatedSegments. Empty unless batching
+     * was requested in the constructor.
+     */
+    Tub<BackupWriteBatcher> writeBatcher;
+
+    /**
+     * Passed to each ReplicatedSegment; limits the number of write rpcs
+     * outstanding at once for each replica.
+     */
+    uint32_t maxWriteRpcsPerReplica;
+
+    /**
+     * Passed to each ReplicatedSegment; true means writes are sent to the
+     * primary replica's backup, which forwards them to the secondaries.
+     */
+    bool forwardBackupWrites;
+
+    /**
+     * If constructed, closed segments are stored on backups as fragments
+     * encoded with this code instead of as full replicas; passed to each
+     * ReplicatedSegment (see ReplicatedSegment::erasureCode).
+     */
+    Tub<ReedSolomon> erasureCode;
+
+    /**
+     * Number of segments being erasure-coded at once. Used by
+     * ReplicatedSegment to limit the memory used for encoding.
+     */
+    uint32_t encodingsInFlight;
+
     /**
      * Waits for backup failure notifications from the Server's main ServerList
      * and informs the ReplicaManager which takes corrective actions.  Runs in
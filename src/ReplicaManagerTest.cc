@@ -137,7 +137,7 @@ TEST_F(ReplicaManagerTest, allocateNonHead) {
     foreach (auto& replica, segment->replicas) {
         EXPECT_EQ(arrayLength(data), replica.sent.bytes);
         EXPECT_FALSE(replica.sent.close);
-        EXPECT_FALSE(replica.writeRpc);
+        EXPECT_FALSE(replica.writesInFlight);
         EXPECT_FALSE(replica.freeRpc);
     }
     EXPECT_EQ(arrayLength(data), cluster.servers[0]->backup->bytesWritten);
@@ -215,7 +215,7 @@ TEST_F(ReplicaManagerTest, proceed) {
     EXPECT_FALSE(segment.replicas[0].isActive);
     mgr->proceed();
     ASSERT_TRUE(segment.replicas[0].isActive);
-    EXPECT_TRUE(segment.replicas[0].writeRpc);
+    EXPECT_TRUE(segment.replicas[0].writesInFlight);
 }
 
 namespace {
@@ -377,7 +377,7 @@ TEST_F(ReplicaManagerTest, endToEndBackupRecovery) {
         "performWrite: Starting replication of segment 2 replica slot 1 on "
             "backup 4.0 | "
         "performWrite: Sending open to backup 4.0 | "
-        "writeSegment: Opening <3.0,2> | "
+        "writeReplica: Opening <3.0,2> | "
         // Segment 1 goes second because it was happily durable and descheduled
         // until the failure woke it up.
         "selectPrimary: Chose server 4.0 with 0 primary replicas and 100 MB/s "
@@ -385,7 +385,7 @@ TEST_F(ReplicaManagerTest, endToEndBackupRecovery) {
         "performWrite: Starting replication of segment 1 replica slot 0 on "
             "backup 4.0 | "
         "performWrite: Sending open to backup 4.0 | "
-        "writeSegment: Opening <3.0,1> | "
+        "writeReplica: Opening <3.0,1> | "
         "performWrite: Write RPC finished for replica slot 0 | "
         "performWrite: Write RPC finished for replica slot 1 | "
         "performWrite: Write RPC finished for replica slot 0 | "
@@ -393,7 +393,7 @@ TEST_F(ReplicaManagerTest, endToEndBackupRecovery) {
         "performWrite: Sending write to backup 4.0 | "
         // Write to re-replicate segment 1 replica slot 0 and close it.
         "performWrite: Sending write to backup 4.0 | "
-        "writeSegment: Closing <3.0,1> | "
+        "writeReplica: Closing <3.0,1> | "
         "performWrite: Write RPC finished for replica slot 1 | "
         // All re-replication has been taken care of; bump the epoch number
         // on the coordinator.
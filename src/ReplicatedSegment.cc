@@ -15,9 +15,11 @@
 
 #include "BitOps.h"
 #include "PerfStats.h"
+#include "ReedSolomon.h"
 #include "ReplicatedSegment.h"
 #include "Segment.h"
 #include "ShortMacros.h"
+#include "TimeTrace.h"
 
 namespace RAMCloud {
 
@@ -79,6 +81,21 @@ enum { OBEY_SAFETY_CONSTRAINTS = true };
  * \param maxBytesPerWriteRpc
  *      Maximum bytes to send in a single write rpc; can help latency of
  *      GetRecoveryDataRequests by unclogging backups a bit.
+ * \param maxWriteRpcsPerReplica
+ *      Maximum number of write rpcs outstanding at once for each replica
+ *      (clamped to MAX_WRITE_RPCS_PER_REPLICA).
+ * \param writeBatcher
+ *      If non-NULL, writes are sent through this batcher so that they can
+ *      share rpcs with writes for other segments on the same backup.
+ * \param forwardWrites
+ *      If true, the primary replica's backup forwards writes to the
+ *      secondary replicas; see #forwardWrites.
+ * \param erasureCode
+ *      If non-NULL, once the segment is durably closed its replicas are
+ *      replaced with fragments encoded with this code; see #erasureCode.
+ * \param encodingsInFlight
+ *      Number of segments being erasure-coded across all
+ *      ReplicatedSegments; must be non-NULL if \a erasureCode is.
  */
 ReplicatedSegment::ReplicatedSegment(Context* context,
                                      TaskQueue& taskQueue,
@@ -96,7 +113,12 @@ ReplicatedSegment::ReplicatedSegment(Context* context,
                                      uint32_t numReplicas,
                                      Tub<CycleCounter<RawMetric>>*
                                                              replicationCounter,
-                                     uint32_t maxBytesPerWriteRpc)
+                                     uint32_t maxBytesPerWriteRpc,
+                                     uint32_t maxWriteRpcsPerReplica,
+                                     BackupWriteBatcher* writeBatcher,
+                                     bool forwardWrites,
+                                     const ReedSolomon* erasureCode,
+                                     uint32_t* encodingsInFlight)
     : Task(taskQueue)
     , context(context)
     , backupSelector(backupSelector)
@@ -111,8 +133,24 @@ ReplicatedSegment::ReplicatedSegment(Context* context,
     , masterId(masterId)
     , segmentId(segmentId)
     , maxBytesPerWriteRpc(maxBytesPerWriteRpc)
+    , maxWriteRpcsPerReplica(std::max(1u, std::min(maxWriteRpcsPerReplica,
+            uint32_t(MAX_WRITE_RPCS_PER_REPLICA))))
+    , writeBatcher(writeBatcher)
+    , forwardWrites(forwardWrites)
+    , erasureCode(erasureCode)
+    , encodingsInFlight(encodingsInFlight)
+    , numFragments(erasureCode ? erasureCode->dataFragments +
+                                 erasureCode->parityFragments : 0)
+    , fragments(erasureCode ? new Fragment[numFragments] : NULL)
+    , encodeBuffer()
+    , encodedCertificate()
+    , fragmentLength(0)
+    , encoded(false)
+    , fragmentGeneration(0)
     , queued(true, 0, 0, false)
     , queuedCertificate()
+    , traceId(0)
+    , traceBytes(0)
     , openLen(0)
     , openingWriteCertificate()
     , freeQueued(false)
@@ -138,6 +176,8 @@ ReplicatedSegment::ReplicatedSegment(Context* context,
 
 ReplicatedSegment::~ReplicatedSegment()
 {
+    if (encodeBuffer)
+        --*encodingsInFlight;
 }
 
 /**
@@ -180,12 +220,17 @@ ReplicatedSegment::free()
     // this portion of the log. However, even if this piece of memory is reused
     // the checksum stored in the replica metadata keeps this safe; if garbage
     // is sent it will not be used during recovery.
+    abandonForwardedWrites();
     foreach (auto& replica, replicas) {
-        if (!replica.isActive || !replica.writeRpc)
+        if (!replica.isActive)
             continue;
-        replica.writeRpc->cancel();
-        replica.writeRpc.destroy();
-        --writeRpcsInFlight;
+        writeRpcsInFlight -= replica.cancelWrites();
+    }
+    for (uint32_t i = 0; i < numFragments; ++i) {
+        if (fragments[i].writeRpc) {
+            fragments[i].writeRpc->cancel();
+            fragments[i].writeRpc.destroy();
+        }
     }
 
     // Segment should free itself ASAP. It must not start new write rpcs after
@@ -309,8 +354,9 @@ ReplicatedSegment::handleBackupFailure(ServerId failedId, bool useMinCopysets)
             ++metrics->master.openReplicaRecoveries;
         }
 
-        if (replica.writeRpc)
-            --writeRpcsInFlight;
+        if (replicaIsPrimary(replica))
+            abandonForwardedWrites();
+        writeRpcsInFlight -= replica.writesInFlight;
         if (replica.freeRpc)
             --freeRpcsInFlight;
         replica.reset(true);
@@ -321,6 +367,40 @@ ReplicatedSegment::handleBackupFailure(ServerId failedId, bool useMinCopysets)
         ++queued.epoch;
         recoveringFromLostOpenReplicas = true;
     }
+
+    bool encodedFragmentLost = false;
+    for (uint32_t i = 0; i < numFragments; ++i) {
+        Fragment& fragment = fragments[i];
+        if (!fragment.isActive || fragment.backupId != failedId)
+            continue;
+        LOG(DEBUG, "Segment %lu lost fragment %u which was on backup %s",
+            segmentId, i, failedId.toString().c_str());
+        if (encoded && !fragment.stale)
+            encodedFragmentLost = true;
+        if (fragment.freeRpc)
+            --freeRpcsInFlight;
+        fragment.reset();
+        schedule();
+    }
+    if (encodedFragmentLost) {
+        // The replicas have been freed, so recreate them from the segment
+        // in memory before giving up on the remaining fragments; then
+        // encode the segment again. Like any replacement for a lost
+        // replica, the new replicas mustn't be used during recovery until
+        // they are complete.
+        LOG(NOTICE, "Lost a fragment of segment %lu due to crash of backup "
+            "%s; replicating it again", segmentId,
+            failedId.toString().c_str());
+        encoded = false;
+        ++fragmentGeneration;
+        for (uint32_t i = 0; i < numFragments; ++i) {
+            if (fragments[i].isActive)
+                fragments[i].stale = true;
+        }
+        foreach (auto& replica, replicas)
+            replica.replacesLostReplica = true;
+        ++metrics->master.replicaRecoveries;
+    }
 }
 
 /**
@@ -412,6 +492,11 @@ ReplicatedSegment::sync(uint32_t offset, SegmentCertificate* certificate)
         certificate = &localCertificate;
     }
 
+    if (TimeTrace::currentTraceId != 0) {
+        traceId = TimeTrace::currentTraceId;
+        traceBytes = appendedBytes;
+    }
+
     if (appendedBytes > queued.bytes) {
         queued.bytes = appendedBytes;
         queuedCertificate = *certificate;
@@ -537,6 +622,8 @@ ReplicatedSegment::performTask()
     if (freeQueued && !recoveringFromLostOpenReplicas) {
         foreach (Replica& replica, replicas)
             performFree(replica);
+        for (uint32_t i = 0; i < numFragments; ++i)
+            performFree(fragments[i]);
 
         // We assume that dataMutex is held by the caller so that the
         // scheduled flag is read atomically with performing the destroy.
@@ -546,8 +633,16 @@ ReplicatedSegment::performTask()
             return;
         }
     } else if (!freeQueued) {
-        foreach (Replica& replica, replicas)
-            performWrite(replica);
+        // Replicas are freed once the segment is erasure-coded; ones still
+        // being freed when a fragment is lost are recreated afterwards.
+        foreach (Replica& replica, replicas) {
+            if (encoded || replica.freeRpc)
+                performFree(replica);
+            else
+                performWrite(replica);
+        }
+        if (erasureCode)
+            performEncode();
     }
 
     if (unopenedStartCycles != 0) {
@@ -656,7 +751,7 @@ ReplicatedSegment::performFree(Replica& replica)
             if (replicaIsPrimary(replica)) {
                 backupSelector.signalFreedPrimary(replica.backupId);
             }
-            replica.reset();
+            replica.reset(replica.replacesLostReplica);
             --freeRpcsInFlight;
             // Free completed, no need to reschedule.
             return;
@@ -671,7 +766,7 @@ ReplicatedSegment::performFree(Replica& replica)
             schedule();
             return;
         }
-        if (replica.writeRpc) {
+        if (replica.writesInFlight > 0) {
             // Impossible by construction. See free().
             assert(false);
         } else {
@@ -686,6 +781,190 @@ ReplicatedSegment::performFree(Replica& replica)
     assert(false); // Unreachable by construction.
 }
 
+/**
+ * Make progress, if possible, in freeing an erasure-coded fragment of a
+ * segment; the fragment counterpart of performFree(Replica&). If future work
+ * is required this method automatically re-schedules this segment for future
+ * attention from the ReplicaManager.
+ */
+void
+ReplicatedSegment::performFree(Fragment& fragment)
+{
+    if (!fragment.isActive) {
+        // Do nothing if there was no fragment, no need to reschedule.
+        return;
+    }
+
+    if (fragment.freeRpc) {
+        if (!fragment.freeRpc->isReady()) {
+            schedule();
+            return;
+        }
+        try {
+            fragment.freeRpc->wait();
+        } catch (const ServerNotUpException& e) {
+            // See performFree(Replica&).
+            TEST_LOG("ServerNotUpException thrown");
+        }
+        fragment.reset();
+        --freeRpcsInFlight;
+        return;
+    }
+
+    if (freeRpcsInFlight == MAX_FREE_RPCS_IN_FLIGHT) {
+        schedule();
+        return;
+    }
+    if (fragment.writeRpc) {
+        fragment.writeRpc->cancel();
+        fragment.writeRpc.destroy();
+    }
+    fragment.freeRpc.construct(context, fragment.backupId, masterId,
+                               segmentId);
+    ++freeRpcsInFlight;
+    schedule();
+}
+
+/**
+ * Make progress, if possible, in replacing the replicas of this segment with
+ * erasure-coded fragments (see #erasureCode). Nothing happens until the
+ * segment is durably closed. Then any fragments left over from an earlier
+ * encoding are freed, the segment is encoded, and each fragment is written
+ * to a backup that has no other replica or fragment of the segment. Once all
+ * of the fragments are written the replicas are freed. If future work is
+ * required this method automatically re-schedules this segment for future
+ * attention from the ReplicaManager.
+ * \pre freeQueued must be false and #erasureCode non-NULL.
+ */
+void
+ReplicatedSegment::performEncode()
+{
+    if (encoded)
+        return;
+
+    uint32_t dataFragments = erasureCode->dataFragments;
+    if (!encodeBuffer) {
+        // performWrite() keeps this segment scheduled until it is durably
+        // closed.
+        if (!queued.close || recoveringFromLostOpenReplicas ||
+                getCommitted() != queued)
+            return;
+
+        bool staleFragments = false;
+        for (uint32_t i = 0; i < numFragments; ++i) {
+            if (!fragments[i].stale)
+                continue;
+            performFree(fragments[i]);
+            if (fragments[i].isActive)
+                staleFragments = true;
+        }
+        if (staleFragments)
+            return;
+
+        if (*encodingsInFlight == MAX_ENCODINGS_IN_FLIGHT) {
+            schedule();
+            return;
+        }
+        ++*encodingsInFlight;
+
+        // Fragments are laid out back to back, data fragments first, so
+        // the data fragments are just the segment padded with zeroes.
+        encodedCertificate = queuedCertificate;
+        fragmentLength = (queued.bytes + dataFragments - 1) / dataFragments;
+        encodeBuffer.reset(new uint8_t[numFragments * fragmentLength]());
+        segment->copyOut(0, encodeBuffer.get(), queued.bytes);
+        uint8_t* fragmentData[numFragments];
+        for (uint32_t i = 0; i < numFragments; ++i)
+            fragmentData[i] = &encodeBuffer[i * fragmentLength];
+        erasureCode->encode(fragmentData, fragmentData + dataFragments,
+                            fragmentLength);
+    }
+
+    bool allWritten = true;
+    for (uint32_t i = 0; i < numFragments; ++i) {
+        Fragment& fragment = fragments[i];
+        if (fragment.written)
+            continue;
+        allWritten = false;
+
+        if (!fragment.isActive) {
+            ServerId constraints[replicas.numElements + numFragments];
+            uint32_t numConstraints = 0;
+            foreach (auto& replica, replicas) {
+                if (replica.isActive)
+                    constraints[numConstraints++] = replica.backupId;
+            }
+            for (uint32_t j = 0; j < numFragments; ++j) {
+                if (fragments[j].isActive)
+                    constraints[numConstraints++] = fragments[j].backupId;
+            }
+            ServerId backupId = backupSelector.selectSecondary(numConstraints,
+                                                               constraints);
+            if (!backupId.isValid()) {
+                schedule();
+                continue;
+            }
+            fragment.isActive = true;
+            fragment.backupId = backupId;
+        }
+
+        if (!fragment.writeRpc) {
+            fragment.writeRpc.construct(context, fragment.backupId, masterId,
+                segmentId, queued.epoch, encodedCertificate,
+                downCast<uint8_t>(dataFragments),
+                downCast<uint8_t>(numFragments - dataFragments),
+                downCast<uint8_t>(i), fragmentGeneration,
+                &encodeBuffer[i * fragmentLength], fragmentLength);
+            schedule();
+            continue;
+        }
+
+        if (!fragment.writeRpc->isReady()) {
+            schedule();
+            continue;
+        }
+        try {
+            fragment.writeRpc->wait();
+            fragment.writeRpc.destroy();
+            fragment.written = true;
+            continue;
+        } catch (const ServerNotUpException& e) {
+            // The backup is gone; try another one.
+            LOG(WARNING, "Couldn't write fragment to backup %s; server is "
+                "down", fragment.backupId.toString().c_str());
+            fragment.reset();
+        } catch (const CallerNotInClusterException& e) {
+            // See performWrite().
+            LOG(WARNING, "Backup fragment write RPC rejected by %s with "
+                "STATUS_CALLER_NOT_IN_CLUSTER",
+                fragment.backupId.toString().c_str());
+            fragment.writeRpc.destroy();
+            CoordinatorClient::verifyMembership(context, masterId);
+        } catch (const ClientException& e) {
+            // The segment is still safe in its replicas; try another backup.
+            LOG(WARNING, "Backup fragment write RPC for segment %lu "
+                "rejected by %s with status %s", segmentId,
+                fragment.backupId.toString().c_str(),
+                statusToSymbol(e.status));
+            fragment.reset();
+        }
+        schedule();
+    }
+    if (!allWritten)
+        return;
+
+    LOG(DEBUG, "Segment %lu stored as %u erasure-coded fragments (generation "
+        "%u); freeing its replicas", segmentId, numFragments,
+        fragmentGeneration);
+    encoded = true;
+    encodeBuffer.reset();
+    --*encodingsInFlight;
+    abandonForwardedWrites();
+    foreach (auto& replica, replicas)
+        writeRpcsInFlight -= replica.cancelWrites();
+    schedule();
+}
+
 /**
  * Make progress, if possible, in durably writing segment data to a particular
  * replica.  If future work is required this method automatically re-schedules
@@ -709,13 +988,18 @@ ReplicatedSegment::performWrite(Replica& replica)
         // backup unless it is discovered that that backup failed.
         // Not doing so risks the existence a lost open replica which
         // isn't recovered from properly.
-        ServerId constraints[replicas.numElements];
+        ServerId constraints[replicas.numElements + numFragments];
         uint32_t numConstraints = 0;
         foreach (auto& constrainingReplica, replicas) {
             if (constrainingReplica.isActive)
                 constraints[numConstraints++] = constrainingReplica.backupId;
             assert(numConstraints <= replicas.numElements);
         }
+        // A backup stores at most one replica or fragment of a segment.
+        for (uint32_t i = 0; i < numFragments; ++i) {
+            if (fragments[i].isActive)
+                constraints[numConstraints++] = fragments[i].backupId;
+        }
         ServerId backupId;
         if (replicaIsPrimary(replica)) {
             backupId = backupSelector.selectPrimary(numConstraints,
@@ -740,235 +1024,433 @@ ReplicatedSegment::performWrite(Replica& replica)
         // for scheduling the task.
     }
 
-    if (replica.writeRpc) {
-        // This replica has a write request outstanding to a backup.
-        if (replica.writeRpc->isReady()) {
-            // Wait for it to complete if it is ready.
-            try {
-                replica.writeRpc->wait();
-                TEST_LOG("Write RPC finished for replica slot %ld",
-                         &replica - &replicas[0]);
-                if (replica.acked.open && !replica.sent.open) {
-                    LOG(NOTICE,
-                            "Resetting acked.open for segment %lu replica %lu",
-                            segmentId, &replica - &replicas[0]);
-                }
-                replica.acked = replica.sent;
-                if (replica.sentCertificate) {
-                    replica.committed = replica.acked;
-                } else {
-                    // Update open bit even if certificate wasn't sent; this
-                    // is needed to avoid deadlocks over the safety
-                    // constraints during recovery of lost replicas.
-                    replica.committed.open = replica.acked.open;
-                }
-                if (getCommitted().open && followingSegment)
-                    followingSegment->precedingSegmentOpenCommitted = true;
-                if (getCommitted().close) {
-                    const_cast<Segment*>(segment)->closedCommitted = true;
-                    if (followingSegment) {
-                        followingSegment->precedingSegmentCloseCommitted = true;
-                        // Don't poke at potentially non-existent segments later
-                        followingSegment = NULL;
-                    }
-                }
-            } catch (const ServerNotUpException& e) {
-                // Retry; wait for BackupFailureMonitor to call
-                // handleBackupFailure to reset the replica and break this
-                // loop.
-                replica.sent = replica.acked;
-                LOG(WARNING, "Couldn't write to backup %s; server is down",
-                    replica.backupId.toString().c_str());
-            } catch (const BackupOpenRejectedException& e) {
-                // The open request was rejected; typically happens when
-                // backups get overloaded because write traffic exceeds
-                // bandwidth of secondary storage. Try assigning a
-                // different backup for this replica.
-                TEST_LOG("BackupOpenRejectedException");
-                replica.reset(replica.replacesLostReplica);
-            } catch (const CallerNotInClusterException& e) {
-                // The backup seems to think we have crashed (or never existed).
-                // Check with the coordinator to be sure, then retry.  See
-                // "Zombies" in designNotes for more information.
-                LOG(WARNING, "Backup write RPC rejected by %s with "
-                    "STATUS_CALLER_NOT_IN_CLUSTER",
-                    replica.backupId.toString().c_str());
-                replica.sent = replica.acked;
-                CoordinatorClient::verifyMembership(context, masterId);
-            } catch (const ClientException& e) {
-                LOG(ERROR, "Backup write RPC for segment %lu rejected by "
-                    "%s with status %s",
-                    segmentId, replica.backupId.toString().c_str(),
-                    statusToSymbol(e.status));
-                throw;
+    if (replica.writesInFlight > 0 && replica.oldestWrite().isReady()) {
+        // The oldest write request outstanding to this replica's backup has
+        // completed. Writes are always processed in the order they were
+        // issued, so acked and committed progress only moves forward.
+        PendingWrite& write = replica.oldestWrite();
+        uint32_t writesFinished = 0;
+        try {
+            write.wait();
+            TEST_LOG("Write RPC finished for replica slot %ld",
+                     &replica - &replicas[0]);
+            if (write.traceId != 0) {
+                TimeTrace::record("trace %u: replica %u of segment %u "
+                        "acknowledged write", write.traceId,
+                        downCast<uint32_t>(&replica - &replicas[0]),
+                        static_cast<uint32_t>(segmentId));
             }
-            replica.writeRpc.destroy();
-            --writeRpcsInFlight;
-            if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
-                LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write <- %7u "
-                    "%u rpcs out %s",
-                    Cycles::toMicroseconds(Cycles::rdtsc() - recoveryStart),
-                    masterId.toString().c_str(),
-                    segmentId, &replica - &replicas[0], replica.acked.bytes,
-                    writeRpcsInFlight, replica.committed.close ? " CLOSE" : "");
+            if (replica.acked.open && !write.sent.open) {
+                LOG(NOTICE,
+                        "Resetting acked.open for segment %lu replica %lu",
+                        segmentId, &replica - &replicas[0]);
             }
-            if (replica.committed != queued || recoveringFromLostOpenReplicas)
-                schedule();
+            replica.acked = write.sent;
+            if (write.sentCertificate) {
+                replica.committed = replica.acked;
+            } else {
+                // Update open bit even if certificate wasn't sent; this
+                // is needed to avoid deadlocks over the safety
+                // constraints during recovery of lost replicas.
+                replica.committed.open = replica.acked.open;
+            }
+            if (!write.forwardedTo.empty())
+                finishForwardedWrite(write);
+            if (getCommitted().open && followingSegment)
+                followingSegment->precedingSegmentOpenCommitted = true;
+            if (getCommitted().close) {
+                const_cast<Segment*>(segment)->closedCommitted = true;
+                if (followingSegment) {
+                    followingSegment->precedingSegmentCloseCommitted = true;
+                    // Don't poke at potentially non-existent segments later
+                    followingSegment = NULL;
+                }
+            }
+        } catch (const ServerNotUpException& e) {
+            // Retry; wait for BackupFailureMonitor to call
+            // handleBackupFailure to reset the replica and break this
+            // loop. Later writes are abandoned too, since everything
+            // after acked will be resent.
+            abandonForwardedWrites();
+            replica.sent = replica.acked;
+            writesFinished = replica.cancelWrites();
+            LOG(WARNING, "Couldn't write to backup %s; server is down",
+                replica.backupId.toString().c_str());
+        } catch (const BackupOpenRejectedException& e) {
+            // The open request was rejected; typically happens when
+            // backups get overloaded because write traffic exceeds
+            // bandwidth of secondary storage. Try assigning a
+            // different backup for this replica.
+            TEST_LOG("BackupOpenRejectedException");
+            writesFinished = replica.cancelWrites();
+            replica.reset(replica.replacesLostReplica);
+        } catch (const CallerNotInClusterException& e) {
+            // The backup seems to think we have crashed (or never existed).
+            // Check with the coordinator to be sure, then retry.  See
+            // "Zombies" in designNotes for more information.
+            LOG(WARNING, "Backup write RPC rejected by %s with "
+                "STATUS_CALLER_NOT_IN_CLUSTER",
+                replica.backupId.toString().c_str());
+            abandonForwardedWrites();
+            replica.sent = replica.acked;
+            writesFinished = replica.cancelWrites();
+            CoordinatorClient::verifyMembership(context, masterId);
+        } catch (const ClientException& e) {
+            LOG(ERROR, "Backup write RPC for segment %lu rejected by "
+                "%s with status %s",
+                segmentId, replica.backupId.toString().c_str(),
+                statusToSymbol(e.status));
+            throw;
+        }
+        if (writesFinished == 0) {
+            replica.retireOldestWrite();
+            writesFinished = 1;
+        }
+        writeRpcsInFlight -= writesFinished;
+        if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
+            LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write <- %7u "
+                "%u rpcs out %s",
+                Cycles::toMicroseconds(Cycles::rdtsc() - recoveryStart),
+                masterId.toString().c_str(),
+                segmentId, &replica - &replicas[0], replica.acked.bytes,
+                writeRpcsInFlight, replica.committed.close ? " CLOSE" : "");
+        }
+        if (replica.committed != queued || replica.writesInFlight > 0 ||
+                recoveringFromLostOpenReplicas)
+            schedule();
+        return;
+    }
+
+    if (replica.forwardPending) {
+        // The primary replica's backup is forwarding data to this replica;
+        // the outcome arrives with the primary's write.
+        schedule();
+        return;
+    }
+
+    if (replica.writesInFlight == maxWriteRpcsPerReplica) {
+        // As many write requests as allowed are outstanding to this
+        // replica's backup; stay scheduled to wait on them.
+        schedule();
+        return;
+    }
+
+    if (!replica.committed.open) {
+        if (replica.writesInFlight > 0) {
+            // The open has been sent but not yet acknowledged; nothing
+            // else can be sent until it is.
+            schedule();
             return;
-        } else {
-            // Request is not yet finished, stay scheduled to wait on it.
+        }
+        if (OBEY_SAFETY_CONSTRAINTS && !precedingSegmentOpenCommitted) {
+            TEST_LOG("Cannot open segment %lu until preceding segment "
+                     "is durably open", segmentId);
+            schedule();
+            return;
+        }
+        // No outstanding write, but not yet durably open.
+        if (writeRpcsInFlight == MAX_WRITE_RPCS_IN_FLIGHT) {
+            RAMCLOUD_CLOG(DEBUG, "Delaying open for segment %lu, "
+                    "replica %lu: too many RPCs in flight", segmentId,
+                    &replica - &replicas[0]);
             schedule();
             return;
         }
-    } else {
-        if (!replica.committed.open) {
-            if (OBEY_SAFETY_CONSTRAINTS && !precedingSegmentOpenCommitted) {
-                TEST_LOG("Cannot open segment %lu until preceding segment "
-                         "is durably open", segmentId);
-                schedule();
-                return;
-            }
-            // No outstanding write, but not yet durably open.
-            if (writeRpcsInFlight == MAX_WRITE_RPCS_IN_FLIGHT) {
-                RAMCLOUD_CLOG(DEBUG, "Delaying open for segment %lu, "
-                        "replica %lu: too many RPCs in flight", segmentId,
-                        &replica - &replicas[0]);
-                schedule();
-                return;
-            }
 
-            // If segment is being re-replicated don't send the certificate
-            // for the opening write; the replica should atomically commit when
-            // it has been fully caught up.
-            SegmentCertificate* certificateToSend = &openingWriteCertificate;
-            replica.sentCertificate = true;
-            uint32_t length = openLen;
-            if (replica.replacesLostReplica) {
-                // This replica was lost, and we are creating a replacement;
-                // don't send any data or certificate in the open request
-                // (we could potentially send some data, but that would make
-                // this code more complicated; better to use the normal
-                // mechanism below to transfer data).
-                certificateToSend = NULL;
-                replica.sentCertificate = false;
-                length = 0;
-            }
+        // If segment is being re-replicated don't send the certificate
+        // for the opening write; the replica should atomically commit when
+        // it has been fully caught up.
+        SegmentCertificate* certificateToSend = &openingWriteCertificate;
+        uint32_t length = openLen;
+        if (replica.replacesLostReplica) {
+            // This replica was lost, and we are creating a replacement;
+            // don't send any data or certificate in the open request
+            // (we could potentially send some data, but that would make
+            // this code more complicated; better to use the normal
+            // mechanism below to transfer data).
+            certificateToSend = NULL;
+            length = 0;
+        }
+
+        TEST_LOG("Sending open to backup %s",
+                 replica.backupId.toString().c_str());
+        replica.sent.open = true;
+        replica.sent.bytes = length;
+        replica.sent.epoch = queued.epoch;
+        sendWrite(replica, 0, length, certificateToSend, true, false);
+        if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
+            LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write -> %7u+%7u "
+                "%u rpcs out OPEN",
+                Cycles::toMicroseconds(Cycles::rdtsc() - recoveryStart),
+                masterId.toString().c_str(), segmentId,
+                &replica - &replicas[0],
+                0, length, writeRpcsInFlight);
+        }
+        schedule();
+        return;
+    }
+
+    // Durably open but not yet synced.
+    if (replica.sent < queued) {
+        // Some part of the data hasn't been sent yet.  Send it.
+        if (OBEY_SAFETY_CONSTRAINTS && !precedingSegmentCloseCommitted) {
+            TEST_LOG("Cannot write segment %lu until preceding segment "
+                     "is durably closed", segmentId);
+            // This segment must wait to send write rpcs until the
+            // preceding segment in the log sets
+            // precedingSegmentCloseCommitted to true. The goal is to
+            // prevent data written in this segment from being undetectably
+            // lost in the case that all replicas of it are lost. See
+            // #precedingSegmentCloseCommitted.
 
-            TEST_LOG("Sending open to backup %s",
-                     replica.backupId.toString().c_str());
-            replica.writeRpc.construct(context, replica.backupId,
-                                       masterId, segmentId, queued.epoch,
-                                       segment, 0, length, certificateToSend,
-                                       true, false, replicaIsPrimary(replica));
-            if (replicaIsPrimary(replica)) {
-                PerfStats::threadStats.replicationRpcs++;
-            }
-            ++writeRpcsInFlight;
-            if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
-                LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write -> %7u+%7u "
-                    "%u rpcs out OPEN",
-                    Cycles::toMicroseconds(Cycles::rdtsc() - recoveryStart),
-                    masterId.toString().c_str(), segmentId,
-                    &replica - &replicas[0],
-                    0, length, writeRpcsInFlight);
-            }
-            replica.sent.open = true;
-            replica.sent.bytes = length;
-            replica.sent.epoch = queued.epoch;
             schedule();
             return;
         }
 
-        // No outstanding write but not yet synced.
-        if (replica.sent < queued) {
-            // Some part of the data hasn't been sent yet.  Send it.
-            if (OBEY_SAFETY_CONSTRAINTS && !precedingSegmentCloseCommitted) {
-                TEST_LOG("Cannot write segment %lu until preceding segment "
-                         "is durably closed", segmentId);
-                // This segment must wait to send write rpcs until the
-                // preceding segment in the log sets
-                // precedingSegmentCloseCommitted to true. The goal is to
-                // prevent data written in this segment from being undetectably
-                // lost in the case that all replicas of it are lost. See
-                // #precedingSegmentCloseCommitted.
-
-                schedule();
-                return;
-            }
+        uint32_t offset = replica.sent.bytes;
+        uint32_t length = queued.bytes - offset;
+        SegmentCertificate* certificateToSend = &queuedCertificate;
 
-            uint32_t offset = replica.sent.bytes;
-            uint32_t length = queued.bytes - offset;
-            SegmentCertificate* certificateToSend = &queuedCertificate;
-            replica.sentCertificate = true;
-
-            // Breaks atomicity of log entries, but it could happen anyway
-            // if a segment gets partially written to disk.
-            if (length > maxBytesPerWriteRpc) {
-                length = maxBytesPerWriteRpc;
-                certificateToSend = NULL;
-                replica.sentCertificate = false;
-            }
+        // Breaks atomicity of log entries, but it could happen anyway
+        // if a segment gets partially written to disk.
+        if (length > maxBytesPerWriteRpc) {
+            length = maxBytesPerWriteRpc;
+            certificateToSend = NULL;
+        }
 
-            bool sendClose = queued.close && (offset + length) == queued.bytes;
-            if (OBEY_SAFETY_CONSTRAINTS &&
-                sendClose &&
-                followingSegment &&
-                !followingSegment->getCommitted().open) {
-                TEST_LOG("Cannot close segment %lu until following segment "
-                         "is durably open", segmentId);
-                // Do not send a closing write rpc for this replica until
-                // some other segment later in the log has been durably
-                // opened.  This ensures that the coordinator will find
-                // an open segment during recovery which lets it know
-                // the entire log has been found (that is, log isn't missing
-                // some head segments).
-                schedule();
-                return;
-            }
+        bool sendClose = queued.close && (offset + length) == queued.bytes;
+        if (OBEY_SAFETY_CONSTRAINTS &&
+            sendClose &&
+            followingSegment &&
+            !followingSegment->getCommitted().open) {
+            TEST_LOG("Cannot close segment %lu until following segment "
+                     "is durably open", segmentId);
+            // Do not send a closing write rpc for this replica until
+            // some other segment later in the log has been durably
+            // opened.  This ensures that the coordinator will find
+            // an open segment during recovery which lets it know
+            // the entire log has been found (that is, log isn't missing
+            // some head segments).
+            schedule();
+            return;
+        }
 
-            if (writeRpcsInFlight == MAX_WRITE_RPCS_IN_FLIGHT) {
-                RAMCLOUD_CLOG(DEBUG, "Delaying write to segment %lu, "
-                        "replica %lu: too many RPCs in flight", segmentId,
-                        &replica - &replicas[0]);
-                schedule();
-                return;
-            }
+        if (followsPrimary(replica)) {
+            // The primary will carry this data for us next time it sends
+            // (replicas[0] is visited first, so it hasn't been able to
+            // send yet, e.g. because too many rpcs are in flight).
+            schedule();
+            return;
+        }
 
-            TEST_LOG("Sending write to backup %s",
-                     replica.backupId.toString().c_str());
-            replica.writeRpc.construct(context, replica.backupId, masterId,
-                                       segmentId, queued.epoch,
-                                       segment, offset, length,
-                                       certificateToSend,
-                                       false, sendClose,
-                                       replicaIsPrimary(replica));
-            if (replicaIsPrimary(replica)) {
-                PerfStats::threadStats.replicationRpcs++;
-            }
-            ++writeRpcsInFlight;
-            if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
-                LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write -> %7u+%7u "
-                    "%u rpcs out %s",
-                    Cycles::toMicroseconds(Cycles::rdtsc() - recoveryStart),
-                    masterId.toString().c_str(), segmentId,
-                    &replica - &replicas[0], offset, length,
-                    writeRpcsInFlight, sendClose ? " CLOSE" : "");
-            }
-            replica.sent.bytes += length;
-            replica.sent.epoch = queued.epoch;
-            replica.sent.close = sendClose;
+        if (replica.writesInFlight > 0 && (certificateToSend || sendClose)) {
+            // Backups may apply outstanding writes in any order. A
+            // certificate must never reach the backup ahead of the data it
+            // covers (and writes that arrive after a close are ignored),
+            // so only chunks without a certificate are pipelined; this
+            // write waits until the earlier ones have been acknowledged.
             schedule();
             return;
-        } else {
-            // Replica not synced, no rpc outstanding, but all data was sent.
-            // Impossible in the one in-flight rpc per replica case.
-            assert(false);
+        }
+
+        if (writeRpcsInFlight == MAX_WRITE_RPCS_IN_FLIGHT) {
+            RAMCLOUD_CLOG(DEBUG, "Delaying write to segment %lu, "
+                    "replica %lu: too many RPCs in flight", segmentId,
+                    &replica - &replicas[0]);
+            schedule();
             return;
         }
+
+        TEST_LOG("Sending write to backup %s",
+                 replica.backupId.toString().c_str());
+        std::vector<uint32_t> forwardTo;
+        if (forwardWrites && replicaIsPrimary(replica) &&
+                replica.writesInFlight == 0) {
+            for (uint32_t i = 1; i < replicas.numElements; i++) {
+                if (followsPrimary(replicas[i]))
+                    forwardTo.push_back(i);
+            }
+        }
+        replica.sent.bytes += length;
+        replica.sent.epoch = queued.epoch;
+        replica.sent.close = sendClose;
+        foreach (uint32_t i, forwardTo) {
+            replicas[i].sent = replica.sent;
+            replicas[i].forwardPending = true;
+        }
+        sendWrite(replica, offset, length, certificateToSend, false,
+                  sendClose, forwardTo);
+        if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
+            LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write -> %7u+%7u "
+                "%u rpcs out %s",
+                Cycles::toMicroseconds(Cycles::rdtsc() - recoveryStart),
+                masterId.toString().c_str(), segmentId,
+                &replica - &replicas[0], offset, length,
+                writeRpcsInFlight, sendClose ? " CLOSE" : "");
+        }
+        schedule();
+        return;
+    } else {
+        // All data has been sent, but some of it hasn't been acknowledged
+        // yet; stay scheduled to wait on the outstanding writes.
+        assert(replica.writesInFlight > 0);
+        schedule();
+        return;
     }
     assert(false); // Unreachable by construction
 }
 
+/**
+ * Issue a write rpc for a replica, either directly or through #writeBatcher,
+ * and record it as outstanding. The caller must already have updated
+ * replica.sent to reflect the write.
+ *
+ * \param replica
+ *      Replica to write to; must have fewer than maxWriteRpcsPerReplica
+ *      writes outstanding.
+ * \param offset
+ *      Offset in #segment of the first byte to send.
+ * \param length
+ *      Number of bytes to send.
+ * \param certificate
+ *      Certificate to store with the replica, or NULL if the write doesn't
+ *      include one (in which case it won't advance replica.committed).
+ * \param open
+ *      True if this write opens the replica.
+ * \param close
+ *      True if this write closes the replica.
+ * \param forwardTo
+ *      Indexes in #replicas of secondary replicas (whose #Replica::sent
+ *      and #Replica::forwardPending the caller has already updated) to
+ *      which the primary's backup should forward the write. Must be empty
+ *      unless \a replica is the primary. Forwarded writes aren't batched.
+ */
+void
+ReplicatedSegment::sendWrite(Replica& replica, uint32_t offset,
+                             uint32_t length,
+                             const SegmentCertificate* certificate,
+                             bool open, bool close,
+                             const std::vector<uint32_t>& forwardTo)
+{
+    PendingWrite& write = replica.addWrite();
+    write.backupSelector = &backupSelector;
+    write.loadedBackups.push_back(replica.backupId);
+    write.length = length;
+    write.traceId = (offset < traceBytes) ? traceId : 0;
+    if (write.traceId != 0) {
+        TimeTrace::record("trace %u: sending %u bytes to replica %u of "
+                "segment %u", write.traceId, length,
+                downCast<uint32_t>(&replica - &replicas[0]),
+                static_cast<uint32_t>(segmentId));
+    }
+
+    // Tag the rpcs themselves so the backups trace their side of it.
+    TimeTrace::TraceScope traceScope(write.traceId);
+    if (!forwardTo.empty()) {
+        std::vector<ServerId> forwardIds;
+        foreach (uint32_t i, forwardTo) {
+            forwardIds.push_back(replicas[i].backupId);
+            write.loadedBackups.push_back(replicas[i].backupId);
+        }
+        write.forwardRpc.construct(context, replica.backupId, masterId,
+                                   segmentId, queued.epoch, segment, offset,
+                                   length, certificate, close, forwardIds);
+        write.forwardedTo = forwardTo;
+    } else if (writeBatcher) {
+        write.batchedRpc.construct(*writeBatcher, replica.backupId, masterId,
+                                   segmentId, queued.epoch, segment, offset,
+                                   length, certificate, open, close,
+                                   replicaIsPrimary(replica));
+    } else {
+        write.rpc.construct(context, replica.backupId, masterId, segmentId,
+                            queued.epoch, segment, offset, length,
+                            certificate, open, close,
+                            replicaIsPrimary(replica));
+    }
+    write.sent = replica.sent;
+    write.sentCertificate = (certificate != NULL);
+    foreach (ServerId backupId, write.loadedBackups)
+        backupSelector.signalWriteStarted(backupId, length);
+    if (replicaIsPrimary(replica)) {
+        PerfStats::threadStats.replicationRpcs++;
+    }
+    ++writeRpcsInFlight;
+}
+
+/**
+ * Return true if a secondary replica's data should be sent by forwarding
+ * the primary replica's next write, rather than with a write of its own:
+ * that is, if forwarding is enabled and the replica is durably open, idle,
+ * and has been sent exactly the same data as the primary.
+ *
+ * \param replica
+ *      Replica to check; always false for the primary.
+ */
+bool
+ReplicatedSegment::followsPrimary(const Replica& replica) const
+{
+    if (!forwardWrites || &replica == &replicas[0])
+        return false;
+    const Replica& primary = replicas[0];
+    return replica.isActive && replica.committed.open &&
+            replica.writesInFlight == 0 && !replica.forwardPending &&
+            primary.isActive && primary.committed.open &&
+            replica.sent == primary.sent;
+}
+
+/**
+ * Called when a write to the primary replica that was forwarded to some
+ * secondary replicas has completed successfully: update the progress of
+ * each of those replicas to match the outcome of its forwarded write.
+ * A replica whose forwarded write failed resends the data itself.
+ *
+ * \param write
+ *      The primary's completed write; its forwardStatuses must have been
+ *      filled in by wait().
+ */
+void
+ReplicatedSegment::finishForwardedWrite(PendingWrite& write)
+{
+    for (size_t i = 0; i < write.forwardedTo.size(); i++) {
+        Replica& replica = replicas[write.forwardedTo[i]];
+        if (!replica.forwardPending) {
+            // Replica was reset (e.g. its backup crashed) after the write
+            // was sent.
+            continue;
+        }
+        replica.forwardPending = false;
+        Status status = STATUS_RESPONSE_FORMAT_ERROR;
+        if (i < write.forwardStatuses.size())
+            status = write.forwardStatuses[i];
+        if (status != STATUS_OK) {
+            LOG(NOTICE, "Forwarded write for segment %lu to backup %s "
+                "failed with status %s; resending directly", segmentId,
+                replica.backupId.toString().c_str(), statusToSymbol(status));
+            replica.sent = replica.acked;
+            continue;
+        }
+        replica.acked = write.sent;
+        if (write.sentCertificate)
+            replica.committed = replica.acked;
+    }
+}
+
+/**
+ * Called when the primary replica's outstanding writes are abandoned:
+ * any data that was being forwarded to secondary replicas will have to be
+ * sent again.
+ */
+void
+ReplicatedSegment::abandonForwardedWrites()
+{
+    foreach (auto& replica, replicas) {
+        if (!replica.forwardPending)
+            continue;
+        replica.forwardPending = false;
+        replica.sent = replica.acked;
+    }
+}
+
 /**
  * Prints a ton of internal state of the replica. Useful for diagnosing why
  * a particular segment's replication is stuck.
@@ -994,14 +1476,15 @@ ReplicatedSegment::dumpProgress()
             "    sent: open %u, bytes %u, close %u\n"
             "    acked: open %u, bytes %u, close %u\n"
             "    committed: open %u, bytes, %u, close %u\n"
-            "    write rpc outstanding: %u\n",
+            "    write rpcs outstanding: %u%s\n",
             i++,
             replica.backupId.toString().c_str(), backupLocator.c_str(),
             replica.sent.open, replica.sent.bytes, replica.sent.close,
             replica.acked.open, replica.acked.bytes, replica.acked.close,
             replica.committed.open, replica.committed.bytes,
             replica.committed.close,
-            bool(replica.writeRpc)));
+            replica.writesInFlight,
+            replica.forwardPending ? " (forwarded by primary)" : ""));
     }
     LOG(NOTICE, "\n%s", info.c_str());
 }
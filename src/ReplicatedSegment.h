@@ -21,6 +21,7 @@
 #include "Common.h"
 #include "BackupClient.h"
 #include "BackupSelector.h"
+#include "BackupWriteBatcher.h"
 #include "BoostIntrusive.h"
 #include "CycleCounter.h"
 #include "UpdateReplicationEpochTask.h"
@@ -43,6 +44,8 @@ namespace RAMCloud {
  */
 enum { LOG_RECOVERY_REPLICATION_RPC_TIMING = false };
 
+class ReedSolomon;
+
 /**
  * Acts as a handle for the log module to enqueue changes to its segments for
  * eventual replication and freeing; logically part of the BackupMananger.
@@ -216,6 +219,121 @@ class ReplicatedSegment : public Task {
         }
     };
 
+    /**
+     * Maximum number of write rpcs that may be outstanding at once for a
+     * single replica (the actual limit is set by the maxWriteRpcsPerReplica
+     * constructor argument).
+     */
+    enum { MAX_WRITE_RPCS_PER_REPLICA = 4 };
+
+    /**
+     * For internal use; an outstanding write rpc for a replica, along with
+     * the information needed to update the replica's progress when it
+     * completes.
+     */
+    struct PendingWrite {
+        PendingWrite()
+            : rpc()
+            , batchedRpc()
+            , forwardRpc()
+            , forwardedTo()
+            , forwardStatuses()
+            , sent()
+            , sentCertificate(false)
+            , backupSelector(NULL)
+            , loadedBackups()
+            , length(0)
+            , traceId(0)
+        {}
+
+        /// Returns true if the write has completed (see WriteSegmentRpc).
+        bool isReady() {
+            if (rpc)
+                return rpc->isReady();
+            if (forwardRpc)
+                return forwardRpc->isReady();
+            return batchedRpc->isReady();
+        }
+
+        /// Returns once the write has completed, throwing an exception
+        /// if it failed (see WriteSegmentRpc).
+        void wait() {
+            if (rpc)
+                rpc->wait();
+            else if (forwardRpc)
+                forwardRpc->wait(&forwardStatuses);
+            else
+                batchedRpc->wait();
+        }
+
+        /// Abandon the write and release its resources.
+        void destroy() {
+            if (rpc) {
+                rpc->cancel();
+                rpc.destroy();
+            }
+            if (forwardRpc) {
+                forwardRpc->cancel();
+                forwardRpc.destroy();
+            }
+            batchedRpc.destroy();
+            forwardedTo.clear();
+            forwardStatuses.clear();
+            foreach (ServerId backupId, loadedBackups)
+                backupSelector->signalWriteFinished(backupId, length);
+            loadedBackups.clear();
+        }
+
+        /// The write, if it was sent in its own rpc.
+        Tub<WriteSegmentRpc> rpc;
+
+        /// The write, if it was handed to a BackupWriteBatcher.
+        Tub<BackupWriteBatcher::Write> batchedRpc;
+
+        /// The write, if it was sent to the primary replica's backup to be
+        /// forwarded to the backups of some of the secondary replicas.
+        Tub<WriteSegmentForwardRpc> forwardRpc;
+
+        /// Indexes in #replicas of the secondary replicas #forwardRpc
+        /// carries data for, in the order their backups were listed.
+        std::vector<uint32_t> forwardedTo;
+
+        /// Filled in by wait(): the outcome of #forwardRpc on each of the
+        /// backups in #forwardedTo.
+        std::vector<Status> forwardStatuses;
+
+        /**
+         * The replica's #Replica::sent value once this write had been
+         * issued; becomes the replica's #Replica::acked value when the
+         * write completes.
+         */
+        Progress sent;
+
+        /**
+         * True means that this write contained a certificate (thus, if it
+         * completes successfully, everything in #sent is now committed).
+         */
+        bool sentCertificate;
+
+        /// Told when the write finishes, so it can keep track of how busy
+        /// each of the backups in #loadedBackups is.
+        BaseBackupSelector* backupSelector;
+
+        /// Backups the write has been reported to #backupSelector as
+        /// outstanding on: the target, plus any it is forwarded to.
+        std::vector<ServerId> loadedBackups;
+
+        /// Number of bytes of segment data carried by the write.
+        uint32_t length;
+
+        /// If nonzero, the write carries data appended by a sampled RPC
+        /// (see TimeTrace::sampleRpc), and its completion is traced under
+        /// this id.
+        uint32_t traceId;
+
+        DISALLOW_COPY_AND_ASSIGN(PendingWrite);
+    };
+
     /**
      * For internal use; stores all state for a single (potentially incomplete)
      * replica of a ReplicatedSegment.
@@ -229,14 +347,15 @@ class ReplicatedSegment : public Task {
             , acked()
             , sent()
             , freeRpc()
-            , writeRpc()
+            , writes()
+            , firstWrite(0)
+            , writesInFlight(0)
+            , forwardPending(false)
             , replacesLostReplica(false)
-            , sentCertificate(false)
         {}
 
         ~Replica() {
-            if (writeRpc)
-                writeRpc->cancel();
+            cancelWrites();
             if (freeRpc)
                 freeRpc->cancel();
         }
@@ -269,6 +388,52 @@ class ReplicatedSegment : public Task {
             this->replacesLostReplica = replacesLostReplica;
         }
 
+        /**
+         * Return the earliest-issued of this replica's outstanding writes.
+         * Only valid if #writesInFlight is nonzero.
+         */
+        PendingWrite& oldestWrite() {
+            assert(writesInFlight > 0);
+            return writes[firstWrite];
+        }
+
+        /**
+         * Reserve a slot for a new outstanding write, which the caller
+         * must fill in. Only valid if #writesInFlight is less than
+         * MAX_WRITE_RPCS_PER_REPLICA.
+         */
+        PendingWrite& addWrite() {
+            assert(writesInFlight < MAX_WRITE_RPCS_PER_REPLICA);
+            PendingWrite& write = writes[(firstWrite + writesInFlight) %
+                                         MAX_WRITE_RPCS_PER_REPLICA];
+            ++writesInFlight;
+            return write;
+        }
+
+        /**
+         * Discard the oldest outstanding write (which has completed and
+         * whose outcome has been processed).
+         */
+        void retireOldestWrite() {
+            oldestWrite().destroy();
+            firstWrite = (firstWrite + 1) % MAX_WRITE_RPCS_PER_REPLICA;
+            --writesInFlight;
+        }
+
+        /**
+         * Cancel all outstanding writes for this replica.
+         *
+         * \return
+         *      The number of writes that were outstanding.
+         */
+        uint32_t cancelWrites() {
+            uint32_t canceled = writesInFlight;
+            while (writesInFlight > 0)
+                retireOldestWrite();
+            firstWrite = 0;
+            return canceled;
+        }
+
         /**
          * If true the rest of the fields in this structure are valid and
          * represent the known state of some replica.  Otherwise, this
@@ -311,8 +476,27 @@ class ReplicatedSegment : public Task {
         /// The outstanding free operation to this backup, if any.
         Tub<FreeSegmentRpc> freeRpc;
 
-        /// The outstanding write operation to this backup, if any.
-        Tub<WriteSegmentRpc> writeRpc;
+        /**
+         * Outstanding write operations to this backup, oldest first,
+         * starting at #firstWrite and wrapping around. Writes are
+         * processed in the order they were issued, so #acked and
+         * #committed only ever move forward.
+         */
+        PendingWrite writes[MAX_WRITE_RPCS_PER_REPLICA];
+
+        /// Index in #writes of the oldest outstanding write.
+        uint32_t firstWrite;
+
+        /// Number of outstanding write operations to this backup.
+        uint32_t writesInFlight;
+
+        /**
+         * True means the data most recently sent to this replica (the
+         * difference between #acked and #sent) is being carried by a write
+         * to the primary replica's backup, which forwards it here; see
+         * #forwardWrites. #writesInFlight is zero in this case.
+         */
+        bool forwardPending;
 
         // Fields below survive across failed()/start() calls.
 
@@ -326,14 +510,61 @@ class ReplicatedSegment : public Task {
          */
         bool replacesLostReplica;
 
+        DISALLOW_COPY_AND_ASSIGN(Replica);
+    };
+
+    /**
+     * For internal use; stores all state for one erasure-coded fragment of
+     * a closed segment (see #erasureCode).
+     */
+    struct Fragment {
+        Fragment()
+            : isActive(false)
+            , backupId()
+            , writeRpc()
+            , written(false)
+            , freeRpc()
+            , stale(false)
+        {}
+
+        ~Fragment() {
+            if (writeRpc)
+                writeRpc->cancel();
+            if (freeRpc)
+                freeRpc->cancel();
+        }
+
+        /// Reset all state associated with this fragment to its initial
+        /// state (no backup chosen, nothing written).
+        void reset() {
+            this->~Fragment();
+            new(this) Fragment;
+        }
+
+        /// If true the rest of the fields are valid: a backup has been
+        /// chosen to store this fragment.
+        bool isActive;
+
+        /// Id of remote backup server where this fragment is (to be) stored.
+        ServerId backupId;
+
+        /// The outstanding write of this fragment, if any.
+        Tub<WriteFragmentRpc> writeRpc;
+
+        /// True once the backup has durably stored this fragment.
+        bool written;
+
+        /// The outstanding free operation to this backup, if any.
+        Tub<FreeSegmentRpc> freeRpc;
+
         /**
-         * True means that the most recent write RPC contained a certificate
-         * (thus, if it completes successfully, everything in "sent" is
-         * now committed).
+         * True means this fragment belongs to an older encoding of the
+         * segment, which was given up after another of its fragments was
+         * lost. It is freed once the segment has full replicas again.
          */
-        bool sentCertificate;
+        bool stale;
 
-        DISALLOW_COPY_AND_ASSIGN(Replica);
+        DISALLOW_COPY_AND_ASSIGN(Fragment);
     };
 
 // --- ReplicatedSegment ---
@@ -361,7 +592,7 @@ class ReplicatedSegment : public Task {
      * Maximum number of simultaneous outstanding write rpcs to backups
      * to allow across all ReplicatedSegments.
      */
-    enum { MAX_WRITE_RPCS_IN_FLIGHT = 8 };
+    enum { MAX_WRITE_RPCS_IN_FLIGHT = 16 };
 
     /**
      * Maximum number of simultaneous outstanding free rpcs to backups
@@ -369,6 +600,13 @@ class ReplicatedSegment : public Task {
      */
     enum { MAX_FREE_RPCS_IN_FLIGHT = 3 };
 
+    /**
+     * Maximum number of closed segments that may be in the middle of being
+     * erasure-coded at once across all ReplicatedSegments; each one holds a
+     * buffer with all of its fragments until they have been written.
+     */
+    enum { MAX_ENCODINGS_IN_FLIGHT = 2 };
+
     ReplicatedSegment(Context* context,
                       TaskQueue& taskQueue,
                       BaseBackupSelector& backupSelector,
@@ -383,13 +621,28 @@ class ReplicatedSegment : public Task {
                       ServerId masterId,
                       uint32_t numReplicas,
                       Tub<CycleCounter<RawMetric>>* replicationCounter = NULL,
-                      uint32_t maxBytesPerWriteRpc = 1024 * 1024);
+                      uint32_t maxBytesPerWriteRpc = 1024 * 1024,
+                      uint32_t maxWriteRpcsPerReplica = 1,
+                      BackupWriteBatcher* writeBatcher = NULL,
+                      bool forwardWrites = false,
+                      const ReedSolomon* erasureCode = NULL,
+                      uint32_t* encodingsInFlight = NULL);
     ~ReplicatedSegment();
 
     void schedule();
     void performTask();
     void performFree(Replica& replica);
+    void performFree(Fragment& fragment);
     void performWrite(Replica& replica);
+    void performEncode();
+    void sendWrite(Replica& replica, uint32_t offset, uint32_t length,
+                   const SegmentCertificate* certificate,
+                   bool open, bool close,
+                   const std::vector<uint32_t>& forwardTo =
+                        std::vector<uint32_t>());
+    bool followsPrimary(const Replica& replica) const;
+    void finishForwardedWrite(PendingWrite& write);
+    void abandonForwardedWrites();
 
     void dumpProgress();
 
@@ -398,6 +651,9 @@ class ReplicatedSegment : public Task {
      * committing data to its chosen backup.
      */
     Progress getCommitted() const {
+        // Once the fragments are written they stand in for the replicas.
+        if (encoded)
+            return queued;
         Progress p = queued;
         foreach (auto& replica, replicas) {
             if (replica.isActive)
@@ -498,6 +754,83 @@ class ReplicatedSegment : public Task {
      */
     const uint32_t maxBytesPerWriteRpc;
 
+    /**
+     * Maximum number of write rpcs that may be outstanding at once for
+     * each replica; at most MAX_WRITE_RPCS_PER_REPLICA. Allowing more than
+     * one lets replication of a large amount of queued data (e.g. during
+     * recovery or re-replication) proceed without waiting a round trip for
+     * each maxBytesPerWriteRpc chunk.
+     */
+    const uint32_t maxWriteRpcsPerReplica;
+
+    /**
+     * If non-NULL, write rpcs are handed to this batcher (shared among
+     * ReplicatedSegments) so that writes to the same backup are combined
+     * into a single rpc; otherwise each write is sent in its own rpc.
+     */
+    BackupWriteBatcher* writeBatcher;
+
+    /**
+     * If true, data written to the primary replica is also forwarded by
+     * the primary's backup to each secondary replica that is exactly as
+     * up to date as the primary (see followsPrimary()), so the master
+     * sends the data once instead of once per replica. Secondaries that
+     * fall behind (e.g. when they are being created or after a failed
+     * forward) catch up with writes of their own. Opens are always sent
+     * directly to each replica.
+     */
+    const bool forwardWrites;
+
+    /**
+     * If non-NULL, once this segment is durably closed it is split into
+     * fragments with this code, each fragment is written to a different
+     * backup, and then the replicas are freed, which uses much less
+     * backup storage than full replicas. Shared among ReplicatedSegments.
+     * If a fragment is lost afterwards, full replicas are recreated from
+     * the segment in memory and it is encoded again.
+     */
+    const ReedSolomon* erasureCode;
+
+    /**
+     * Number of segments across all ReplicatedSegments that hold an
+     * #encodeBuffer; see MAX_ENCODINGS_IN_FLIGHT. Only used if
+     * #erasureCode is non-NULL.
+     */
+    uint32_t* encodingsInFlight;
+
+    /// Number of elements in #fragments; zero if #erasureCode is NULL.
+    const uint32_t numFragments;
+
+    /// State for each of the fragments of this segment, data fragments
+    /// first. Allocated only if #erasureCode is non-NULL.
+    std::unique_ptr<Fragment[]> fragments;
+
+    /**
+     * All of the fragments of this segment, back to back, while they are
+     * being written to backups. Computed once from the segment contents so
+     * that they are consistent even if the segment is swapped out.
+     */
+    std::unique_ptr<uint8_t[]> encodeBuffer;
+
+    /// Certificate for the segment data held in #encodeBuffer.
+    SegmentCertificate encodedCertificate;
+
+    /// Size in bytes of each fragment in #encodeBuffer.
+    uint32_t fragmentLength;
+
+    /**
+     * True means all of the fragments of this segment have been written,
+     * so its replicas are no longer needed (and are freed).
+     */
+    bool encoded;
+
+    /**
+     * Stored with each fragment so that recovery never combines fragments
+     * from different encodings of the segment; incremented each time the
+     * segment has to be encoded again.
+     */
+    uint32_t fragmentGeneration;
+
     /**
      * Tracks how much of a segment the log module has made available for
      * replication.
@@ -519,6 +852,17 @@ class ReplicatedSegment : public Task {
      */
     SegmentCertificate queuedCertificate;
 
+    /**
+     * If nonzero, the trace id (see TimeTrace::sampleRpc) of the most
+     * recent sampled RPC to sync this segment; writes carrying any of the
+     * first #traceBytes bytes are traced under this id, whichever thread
+     * ends up sending them.
+     */
+    uint32_t traceId;
+
+    /// See #traceId.
+    uint32_t traceBytes;
+
     /**
      * Number of bytes that must be replicated to the backup before a
      * replica can be considered "open"; consists of all the data in the
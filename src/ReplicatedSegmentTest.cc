@@ -19,6 +19,7 @@
 #include "BackupSelector.h"
 #include "Memory.h"
 #include "PerfStats.h"
+#include "ReedSolomon.h"
 #include "ReplicatedSegment.h"
 #include "Segment.h"
 #include "ShortMacros.h"
@@ -45,6 +46,8 @@ struct MockBackupSelector : public BaseBackupSelector {
     explicit MockBackupSelector(size_t count)
         : backups()
         , primaryFreed()
+        , writesInFlight(0)
+        , bytesInFlight(0)
         , nextIndex(0)
     {
         makeSimpleHostList(count);
@@ -68,6 +71,16 @@ struct MockBackupSelector : public BaseBackupSelector {
         primaryFreed.push_back(backupId);
     }
 
+    void signalWriteStarted(const ServerId backupId, uint32_t length) {
+        ++writesInFlight;
+        bytesInFlight += length;
+    }
+
+    void signalWriteFinished(const ServerId backupId, uint32_t length) {
+        --writesInFlight;
+        bytesInFlight -= length;
+    }
+
     void makeSimpleHostList(size_t count) {
         for (uint32_t i = 0; i < count; ++i)
             backups.push_back(ServerId(i, 0));
@@ -75,6 +88,8 @@ struct MockBackupSelector : public BaseBackupSelector {
 
     std::vector<ServerId> backups;
     std::vector<ServerId> primaryFreed;
+    uint32_t writesInFlight;
+    uint64_t bytesInFlight;
     size_t nextIndex;
 };
 
@@ -99,7 +114,11 @@ struct ReplicatedSegmentTest : public ::testing::Test {
         CreateSegment(ReplicatedSegmentTest* test,
                       ReplicatedSegment* precedingSegment,
                       uint64_t segmentId,
-                      uint32_t numReplicas)
+                      uint32_t numReplicas,
+                      uint32_t maxWriteRpcsPerReplica = 1,
+                      bool forwardWrites = false,
+                      const ReedSolomon* erasureCode = NULL,
+                      uint32_t* encodingsInFlight = NULL)
             : logSegment(test->data, DATA_LEN)
             , segment()
         {
@@ -121,7 +140,12 @@ struct ReplicatedSegmentTest : public ::testing::Test {
                                               test->masterId,
                                               numReplicas,
                                               NULL,
-                                              MAX_BYTES_PER_WRITE));
+                                              MAX_BYTES_PER_WRITE,
+                                              maxWriteRpcsPerReplica,
+                                              NULL,
+                                              forwardWrites,
+                                              erasureCode,
+                                              encodingsInFlight));
             // Set up ordering constraints between this new segment and the
             // prior one in the log.
             if (precedingSegment) {
@@ -252,22 +276,23 @@ TEST_F(ReplicatedSegmentTest, freeWriteRpcInProgress) {
     segment->close();
     taskQueue.performTask(); // writeRpc created
     EXPECT_EQ(2lu, segment->writeRpcsInFlight);
-    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_TRUE(segment->replicas[0].writesInFlight);
     segment->free();
     EXPECT_EQ(0lu, segment->writeRpcsInFlight);
-    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
 
     // make sure the backup "free" opcode was not sent
     EXPECT_TRUE(TestUtil::doesNotMatchPosixRegex("0x1001c",
                                                  transport.outputLog));
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_FALSE(segment->replicas[0].writeRpc); // ensure the write completed
+    // ensure the write completed
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     EXPECT_FALSE(segment->replicas[0].freeRpc);
     EXPECT_TRUE(segment->isScheduled());
 
     taskQueue.performTask();
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     EXPECT_TRUE(segment->replicas[0].freeRpc); // ensure free gets sent
     EXPECT_TRUE(segment->isScheduled());
 
@@ -462,6 +487,92 @@ TEST_F(ReplicatedSegmentTest, handleBackupFailureWithMinCopysets) {
     EXPECT_TRUE(segment->replicas[1].replacesLostReplica);
 }
 
+TEST_F(ReplicatedSegmentTest, handleBackupFailureLostFragment) {
+    reset();
+    ReedSolomon erasureCode(2, 1);
+    uint32_t encodingsInFlight = 0;
+    CreateSegment createEncoded(this, NULL, segmentId + 1, numReplicas, 1,
+                                false, &erasureCode, &encodingsInFlight);
+    ReplicatedSegment* encoded = createEncoded.segment.get();
+    encoded->queued.close = true;
+    encoded->encoded = true;
+    for (uint32_t i = 0; i < 3; ++i) {
+        encoded->fragments[i].isActive = true;
+        encoded->fragments[i].backupId = ServerId(i + 2, 0);
+        encoded->fragments[i].written = true;
+    }
+    EXPECT_EQ(encoded->queued, encoded->getCommitted());
+
+    encoded->handleBackupFailure({3, 0}, false);
+    EXPECT_FALSE(encoded->encoded);
+    EXPECT_EQ(1u, encoded->fragmentGeneration);
+    EXPECT_TRUE(encoded->fragments[0].stale);
+    EXPECT_FALSE(encoded->fragments[1].isActive);
+    EXPECT_TRUE(encoded->fragments[2].stale);
+    foreach (auto& replica, encoded->replicas)
+        EXPECT_TRUE(replica.replacesLostReplica);
+    EXPECT_NE(encoded->queued, encoded->getCommitted());
+    taskQueue.tasks.pop();
+    encoded->scheduled = false;
+}
+
+TEST_F(ReplicatedSegmentTest, performEncode) {
+    reset();
+    ReedSolomon erasureCode(2, 1);
+    uint32_t encodingsInFlight = 0;
+    CreateSegment createEncoded(this, NULL, segmentId + 1, numReplicas, 1,
+                                false, &erasureCode, &encodingsInFlight);
+    ReplicatedSegment* encoded = createEncoded.segment.get();
+
+    // Nothing to do until the segment is durably closed.
+    encoded->performEncode();
+    EXPECT_FALSE(encoded->encodeBuffer);
+
+    encoded->queued.close = true;
+    foreach (auto& replica, encoded->replicas) {
+        replica.start(ServerId(
+            downCast<uint32_t>(&replica - &encoded->replicas[0]), 0));
+        replica.committed = encoded->queued;
+    }
+    backupSelector.backups = {{2, 0}, {3, 0}, {4, 0}};
+    backupSelector.nextIndex = 0;
+    encoded->performEncode();
+    ASSERT_TRUE(encoded->encodeBuffer);
+    EXPECT_EQ(1u, encodingsInFlight);
+    EXPECT_EQ(openLen / 2, encoded->fragmentLength);
+    EXPECT_EQ(0, memcmp(data, encoded->encodeBuffer.get(), openLen));
+    for (uint32_t i = 0; i < 3; ++i) {
+        EXPECT_TRUE(encoded->fragments[i].isActive);
+        EXPECT_EQ(ServerId(i + 2, 0), encoded->fragments[i].backupId);
+        EXPECT_TRUE(encoded->fragments[i].writeRpc);
+    }
+
+    // The parity fragment stands in for a lost data fragment.
+    uint32_t fragmentLength = encoded->fragmentLength;
+    char fragmentData[3 * fragmentLength];
+    memcpy(fragmentData, encoded->encodeBuffer.get(), sizeof(fragmentData));
+    memset(fragmentData, 0, fragmentLength);
+    uint8_t* fragments[3];
+    for (uint32_t i = 0; i < 3; ++i) {
+        fragments[i] =
+            reinterpret_cast<uint8_t*>(&fragmentData[i * fragmentLength]);
+    }
+    bool present[3] = {false, true, true};
+    EXPECT_TRUE(erasureCode.reconstruct(fragments, present, fragmentLength));
+    EXPECT_EQ(0, memcmp(data, fragmentData, openLen));
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        encoded->fragments[i].writeRpc.destroy();
+        encoded->fragments[i].written = true;
+    }
+    encoded->performEncode();
+    EXPECT_TRUE(encoded->encoded);
+    EXPECT_FALSE(encoded->encodeBuffer);
+    EXPECT_EQ(0u, encodingsInFlight);
+    taskQueue.tasks.pop();
+    encoded->scheduled = false;
+}
+
 TEST_F(ReplicatedSegmentTest, sync) {
     transport.setInput("0 0"); // write
     transport.setInput("0 0"); // write
@@ -1218,9 +1329,9 @@ TEST_F(ReplicatedSegmentTest, performWriteTooManyInFlight) {
     taskQueue.performTask(); // reap opens
     transport.clearOutput();
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     ASSERT_TRUE(segment->replicas[1].isActive);
-    EXPECT_FALSE(segment->replicas[1].writeRpc);
+    EXPECT_FALSE(segment->replicas[1].writesInFlight);
 
     writeRpcsInFlight = ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT;
     createSegment->logSegment.head = openLen + 10; // write queued
@@ -1243,7 +1354,7 @@ TEST_F(ReplicatedSegmentTest, performWriteTooManyInFlight) {
     transport.clearOutput();
     EXPECT_EQ(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT, writeRpcsInFlight);
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_TRUE(segment->replicas[0].writesInFlight);
     EXPECT_EQ(openLen + 10, segment->replicas[0].sent.bytes);
     EXPECT_TRUE(segment->replicas[1].isActive);
     EXPECT_EQ(openLen, segment->replicas[1].sent.bytes);
@@ -1257,13 +1368,14 @@ TEST_F(ReplicatedSegmentTest, performWriteTooManyInFlight) {
                 "klmnopqrst", 10));
     EXPECT_EQ(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT, writeRpcsInFlight);
     ASSERT_TRUE(segment->replicas[1].isActive);
-    EXPECT_TRUE(segment->replicas[1].writeRpc);
+    EXPECT_TRUE(segment->replicas[1].writesInFlight);
     EXPECT_EQ(openLen + 10, segment->replicas[1].sent.bytes);
-    EXPECT_FALSE(segment->replicas[0].writeRpc); // make sure one was started
+    // make sure one was started
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     EXPECT_TRUE(segment->isScheduled());
 
     taskQueue.performTask(); // reap write
-    EXPECT_FALSE(segment->replicas[1].writeRpc);
+    EXPECT_FALSE(segment->replicas[1].writesInFlight);
     EXPECT_EQ(uint32_t(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT - 1),
               writeRpcsInFlight);
     EXPECT_FALSE(segment->isScheduled());
@@ -1300,7 +1412,7 @@ TEST_F(ReplicatedSegmentTest, performWriteOpen) {
                 "abcdefghij", 10));
 
     EXPECT_TRUE(segment->replicas[0].isActive);
-    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_TRUE(segment->replicas[0].writesInFlight);
     EXPECT_TRUE(segment->replicas[0].sent.open);
     EXPECT_EQ(openLen, segment->replicas[0].sent.bytes);
     EXPECT_TRUE(segment->isScheduled());
@@ -1329,7 +1441,7 @@ TEST_F(ReplicatedSegmentTest, performWriteOpenTooManyInFlight) {
                 "abcdefghij", 10));
     EXPECT_EQ(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT, writeRpcsInFlight);
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_TRUE(segment->replicas[0].writesInFlight);
     EXPECT_TRUE(segment->replicas[0].sent.open);
     EXPECT_EQ(openLen, segment->replicas[0].sent.bytes);
     EXPECT_TRUE(segment->replicas[1].isActive);
@@ -1343,14 +1455,15 @@ TEST_F(ReplicatedSegmentTest, performWriteOpenTooManyInFlight) {
                 "abcdefghij", 10));
     EXPECT_EQ(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT, writeRpcsInFlight);
     ASSERT_TRUE(segment->replicas[1].isActive);
-    EXPECT_TRUE(segment->replicas[1].writeRpc);
+    EXPECT_TRUE(segment->replicas[1].writesInFlight);
     EXPECT_TRUE(segment->replicas[1].sent.open);
     EXPECT_EQ(openLen, segment->replicas[1].sent.bytes);
-    EXPECT_FALSE(segment->replicas[0].writeRpc); // make sure one was started
+    // make sure one was started
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     EXPECT_TRUE(segment->isScheduled());
 
     taskQueue.performTask(); // reap write
-    EXPECT_FALSE(segment->replicas[1].writeRpc);
+    EXPECT_FALSE(segment->replicas[1].writesInFlight);
     EXPECT_EQ(uint32_t(ReplicatedSegment::MAX_WRITE_RPCS_IN_FLIGHT - 1),
               writeRpcsInFlight);
     EXPECT_FALSE(segment->isScheduled());
@@ -1374,11 +1487,37 @@ TEST_F(ReplicatedSegmentTest, performWriteRpcIsReady) {
     EXPECT_EQ(openLen, segment->replicas[0].acked.bytes);
     EXPECT_EQ(openLen, segment->replicas[0].committed.bytes);
     EXPECT_TRUE(segment->isScheduled());
-    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     EXPECT_EQ(0u, deleter.count);
     reset();
 }
 
+TEST_F(ReplicatedSegmentTest, performWriteReportsBackupLoad) {
+    transport.setInput("0 0"); // write
+    transport.setInput("0 0"); // write
+
+    taskQueue.performTask(); // send opens
+    EXPECT_EQ(2u, backupSelector.writesInFlight);
+    EXPECT_EQ(2 * openLen, backupSelector.bytesInFlight);
+
+    taskQueue.performTask(); // reap opens
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
+    EXPECT_FALSE(segment->replicas[1].writesInFlight);
+    EXPECT_EQ(0u, backupSelector.writesInFlight);
+    EXPECT_EQ(0u, backupSelector.bytesInFlight);
+    reset();
+}
+
+TEST_F(ReplicatedSegmentTest, performWriteReportsBackupLoadCanceled) {
+    taskQueue.performTask(); // send opens; they never complete
+    EXPECT_EQ(2u, backupSelector.writesInFlight);
+
+    segment->handleBackupFailure(segment->replicas[0].backupId, false);
+    EXPECT_EQ(1u, backupSelector.writesInFlight);
+    EXPECT_EQ(openLen, backupSelector.bytesInFlight);
+    reset();
+}
+
 TEST_F(ReplicatedSegmentTest, performWriteRpcFailed) {
     ServerIdRpcWrapper::ConvertExceptionsToDoesntExist _;
     transport.clearInput();
@@ -1420,7 +1559,7 @@ TEST_F(ReplicatedSegmentTest, performWriteRpcFailed) {
     ASSERT_TRUE(segment->replicas[0].isActive);
     EXPECT_EQ(openLen, segment->replicas[0].acked.bytes);
     EXPECT_EQ(openLen, segment->replicas[0].committed.bytes);
-    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     ASSERT_TRUE(segment->replicas[1].isActive);
     EXPECT_EQ(0u, segment->replicas[1].acked.bytes);
     EXPECT_EQ(0u, segment->replicas[1].committed.bytes);
@@ -1460,12 +1599,12 @@ TEST_F(ReplicatedSegmentTest, performWriteRpcFailed) {
     EXPECT_EQ(openLen, segment->replicas[0].committed.bytes);
     EXPECT_EQ(openLen, segment->replicas[0].acked.bytes);
     EXPECT_EQ(openLen, segment->replicas[0].sent.bytes);
-    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     ASSERT_TRUE(segment->replicas[1].isActive);
     EXPECT_EQ(openLen + 10, segment->replicas[1].committed.bytes);
     EXPECT_EQ(openLen + 10, segment->replicas[1].acked.bytes);
     EXPECT_EQ(openLen + 10, segment->replicas[1].sent.bytes);
-    EXPECT_FALSE(segment->replicas[1].writeRpc);
+    EXPECT_FALSE(segment->replicas[1].writesInFlight);
 
     taskQueue.performTask();  // resend first close request
     EXPECT_TRUE(transport.outputMatches(0, MockTransport::SEND_REQUEST,
@@ -1476,7 +1615,7 @@ TEST_F(ReplicatedSegmentTest, performWriteRpcFailed) {
     EXPECT_TRUE(segment->isScheduled());
     ASSERT_TRUE(segment->replicas[0].isActive);
     EXPECT_EQ(openLen + 10, segment->replicas[0].sent.bytes);
-    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_TRUE(segment->replicas[0].writesInFlight);
 
     EXPECT_EQ(0u, deleter.count);
     reset();
@@ -1514,7 +1653,7 @@ TEST_F(ReplicatedSegmentTest, performWriteDataLargerThanLimit) {
                  certificate},
                 "klmnopqrstuvwxyzabcde", 21));
     EXPECT_TRUE(segment->isScheduled());
-    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_TRUE(segment->replicas[0].writesInFlight);
 
     taskQueue.performTask(); // reap first writes
     EXPECT_EQ(31u, segment->replicas[0].acked.bytes);
@@ -1545,6 +1684,221 @@ TEST_F(ReplicatedSegmentTest, performWriteDataLargerThanLimit) {
     reset();
 }
 
+TEST_F(ReplicatedSegmentTest, performWritePipelined) {
+    reset();
+    CreateSegment create(this, NULL, segmentId + 1, 1, 2);
+    ReplicatedSegment* segment = create.segment.get();
+    ReplicatedSegment::Replica& replica = segment->replicas[0];
+    create.logSegment.head = openLen + 2 * MAX_BYTES_PER_WRITE + 5;
+    segment->close();
+
+    // Completes the index'th oldest outstanding write successfully.
+    auto complete = [&replica](uint32_t index) {
+        ReplicatedSegment::PendingWrite& write = replica.writes[
+            (replica.firstWrite + index) %
+            ReplicatedSegment::MAX_WRITE_RPCS_PER_REPLICA];
+        write.rpc->response->fillFromString("0 0");
+        write.rpc->completed();
+    };
+
+    transport.setInput("0 0"); // open
+    taskQueue.performTask(); // send open
+    taskQueue.performTask(); // reap open
+    EXPECT_TRUE(replica.committed.open);
+
+    transport.clearOutput();
+    taskQueue.performTask(); // send first chunk
+    taskQueue.performTask(); // send second chunk without waiting
+    taskQueue.performTask(); // pipeline is full
+    EXPECT_EQ(2u, transport.output.size());
+    EXPECT_EQ(2u, replica.writesInFlight);
+    EXPECT_EQ(52u, replica.sent.bytes);
+
+    // Completions are processed in the order the writes were issued.
+    complete(1);
+    taskQueue.performTask();
+    EXPECT_EQ(10u, replica.acked.bytes);
+    complete(0);
+    taskQueue.performTask();
+    EXPECT_EQ(31u, replica.acked.bytes);
+    EXPECT_EQ(10u, replica.committed.bytes);
+    EXPECT_EQ(1u, replica.writesInFlight);
+    taskQueue.performTask();
+    EXPECT_EQ(52u, replica.acked.bytes);
+    EXPECT_EQ(0u, replica.writesInFlight);
+
+    // The final write carries the certificate and close; it is only sent
+    // once nothing else is outstanding.
+    transport.setInput("0 0");
+    transport.clearOutput();
+    taskQueue.performTask();
+    EXPECT_EQ(1u, transport.output.size());
+    taskQueue.performTask();
+    EXPECT_EQ(57u, replica.committed.bytes);
+    EXPECT_TRUE(replica.committed.close);
+    EXPECT_EQ(0u, writeRpcsInFlight);
+}
+
+TEST_F(ReplicatedSegmentTest, performWritePipelinedCertificateWaits) {
+    reset();
+    CreateSegment create(this, NULL, segmentId + 1, 1, 2);
+    ReplicatedSegment* segment = create.segment.get();
+    ReplicatedSegment::Replica& replica = segment->replicas[0];
+    create.logSegment.head = openLen + MAX_BYTES_PER_WRITE + 5;
+    segment->close();
+
+    transport.setInput("0 0"); // open
+    taskQueue.performTask(); // send open
+    taskQueue.performTask(); // reap open
+
+    transport.clearOutput();
+    taskQueue.performTask(); // send first chunk
+    taskQueue.performTask(); // closing write must wait for the first chunk
+    EXPECT_EQ(1u, transport.output.size());
+    EXPECT_EQ(1u, replica.writesInFlight);
+    EXPECT_EQ(31u, replica.sent.bytes);
+    EXPECT_TRUE(segment->isScheduled());
+
+    replica.oldestWrite().rpc->response->fillFromString("0 0");
+    replica.oldestWrite().rpc->completed();
+    transport.setInput("0 0");
+    taskQueue.performTask(); // reap first chunk
+    taskQueue.performTask(); // send closing write
+    EXPECT_EQ(2u, transport.output.size());
+    taskQueue.performTask(); // reap closing write
+    EXPECT_TRUE(replica.committed.close);
+    EXPECT_EQ(36u, replica.committed.bytes);
+}
+
+TEST_F(ReplicatedSegmentTest, performWriteForwarded) {
+    reset();
+    CreateSegment create(this, NULL, segmentId + 1, 2, 1, true);
+    ReplicatedSegment* segment = create.segment.get();
+    ReplicatedSegment::Replica& primary = segment->replicas[0];
+    ReplicatedSegment::Replica& secondary = segment->replicas[1];
+
+    transport.setInput("0 0"); // open first replica
+    transport.setInput("0 0"); // open second replica
+    taskQueue.performTask(); // send opens; these aren't forwarded
+    taskQueue.performTask(); // reap opens
+    EXPECT_TRUE(secondary.committed.open);
+
+    create.logSegment.head = openLen + 5;
+    segment->close();
+    transport.clearOutput();
+    taskQueue.performTask(); // send write to primary only
+    EXPECT_EQ(1u, transport.output.size());
+    EXPECT_EQ(1u, writeRpcsInFlight);
+    ASSERT_TRUE(primary.oldestWrite().forwardRpc);
+    EXPECT_EQ(std::vector<uint32_t>{1}, primary.oldestWrite().forwardedTo);
+    EXPECT_TRUE(secondary.forwardPending);
+    EXPECT_EQ(0u, secondary.writesInFlight);
+    EXPECT_EQ(15u, secondary.sent.bytes);
+    EXPECT_TRUE(secondary.sent.close);
+
+    taskQueue.performTask(); // secondary keeps waiting on the primary
+    EXPECT_EQ(1u, transport.output.size());
+
+    primary.oldestWrite().forwardRpc->response->fillFromString("0 1 0");
+    primary.oldestWrite().forwardRpc->completed();
+    taskQueue.performTask(); // reap write; covers both replicas
+    EXPECT_FALSE(secondary.forwardPending);
+    EXPECT_EQ(15u, secondary.committed.bytes);
+    EXPECT_TRUE(secondary.committed.close);
+    EXPECT_TRUE(segment->getCommitted().close);
+    EXPECT_EQ(0u, writeRpcsInFlight);
+    EXPECT_EQ(1u, transport.output.size());
+}
+
+TEST_F(ReplicatedSegmentTest, performWriteForwardFailed) {
+    reset();
+    CreateSegment create(this, NULL, segmentId + 1, 2, 1, true);
+    ReplicatedSegment* segment = create.segment.get();
+    ReplicatedSegment::Replica& primary = segment->replicas[0];
+    ReplicatedSegment::Replica& secondary = segment->replicas[1];
+
+    transport.setInput("0 0"); // open first replica
+    transport.setInput("0 0"); // open second replica
+    taskQueue.performTask(); // send opens
+    taskQueue.performTask(); // reap opens
+
+    create.logSegment.head = openLen + 5;
+    segment->close();
+    transport.clearOutput();
+    taskQueue.performTask(); // send write to primary only
+    EXPECT_TRUE(secondary.forwardPending);
+
+    // The forwarded write failed with STATUS_BACKUP_BAD_SEGMENT_ID; the
+    // secondary resends the data itself.
+    primary.oldestWrite().forwardRpc->response->fillFromString("0 1 12");
+    primary.oldestWrite().forwardRpc->completed();
+    transport.setInput("0 0");
+    taskQueue.performTask(); // reap write, secondary sends its own
+    EXPECT_TRUE(primary.committed.close);
+    EXPECT_FALSE(secondary.forwardPending);
+    EXPECT_EQ(10u, secondary.acked.bytes);
+    EXPECT_EQ(1u, secondary.writesInFlight);
+    EXPECT_EQ(2u, transport.output.size());
+
+    taskQueue.performTask(); // reap secondary's write
+    EXPECT_TRUE(secondary.committed.close);
+    EXPECT_EQ(15u, secondary.committed.bytes);
+}
+
+TEST_F(ReplicatedSegmentTest, performWriteForwardedPrimaryLost) {
+    reset();
+    CreateSegment create(this, NULL, segmentId + 1, 2, 1, true);
+    ReplicatedSegment* segment = create.segment.get();
+    ReplicatedSegment::Replica& secondary = segment->replicas[1];
+
+    transport.setInput("0 0"); // open first replica
+    transport.setInput("0 0"); // open second replica
+    taskQueue.performTask(); // send opens
+    taskQueue.performTask(); // reap opens
+
+    create.logSegment.head = openLen + 5;
+    segment->close();
+    taskQueue.performTask(); // send write to primary only
+    EXPECT_TRUE(secondary.forwardPending);
+
+    segment->handleBackupFailure(backupId1, false);
+    EXPECT_FALSE(segment->replicas[0].isActive);
+    EXPECT_FALSE(secondary.forwardPending);
+    EXPECT_EQ(10u, secondary.sent.bytes);
+    EXPECT_FALSE(secondary.sent.close);
+    EXPECT_EQ(0u, writeRpcsInFlight);
+}
+
+TEST_F(ReplicatedSegmentTest, followsPrimary) {
+    reset();
+    CreateSegment forwarding(this, NULL, segmentId + 1, 2, 1, true);
+    CreateSegment direct(this, NULL, segmentId + 2, 2, 1, false);
+    std::vector<CreateSegment*> creates = {&forwarding, &direct};
+    foreach (CreateSegment* create, creates) {
+        foreach (auto& replica, create->segment->replicas) {
+            replica.start(backupId1);
+            replica.committed.open = true;
+            replica.sent = {true, 10, 0, false};
+        }
+    }
+    ReplicatedSegment* segment = forwarding.segment.get();
+    ReplicatedSegment::Replica& primary = segment->replicas[0];
+    ReplicatedSegment::Replica& secondary = segment->replicas[1];
+    EXPECT_FALSE(segment->followsPrimary(primary));
+    EXPECT_TRUE(segment->followsPrimary(secondary));
+    EXPECT_FALSE(direct.segment->followsPrimary(direct.segment->replicas[1]));
+
+    secondary.sent.bytes = 5; // behind the primary
+    EXPECT_FALSE(segment->followsPrimary(secondary));
+    secondary.sent.bytes = 10;
+    primary.committed.open = false;
+    EXPECT_FALSE(segment->followsPrimary(secondary));
+    primary.committed.open = true;
+    secondary.forwardPending = true;
+    EXPECT_FALSE(segment->followsPrimary(secondary));
+    secondary.forwardPending = false;
+}
+
 TEST_F(ReplicatedSegmentTest, performWriteClosedButLongerThanMaxTxLimit) {
     SegmentCertificate emptyCertificate;
     transport.setInput("0 0"); // open/write
@@ -1577,7 +1931,7 @@ TEST_F(ReplicatedSegmentTest, performWriteClosedButLongerThanMaxTxLimit) {
                  emptyCertificate},
                 "klmnopqrstuvwxyzabcde", 21));
     EXPECT_TRUE(segment->isScheduled());
-    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_TRUE(segment->replicas[0].writesInFlight);
     transport.clearOutput();
 
     taskQueue.performTask(); // reap second round
@@ -1594,7 +1948,7 @@ TEST_F(ReplicatedSegmentTest, performWriteClosedButLongerThanMaxTxLimit) {
                  999, 888, 0, 31, 1, false, true, false, true, certificate},
                 "f", 1));
     EXPECT_TRUE(segment->isScheduled());
-    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_TRUE(segment->replicas[0].writesInFlight);
 
     EXPECT_EQ(0u, deleter.count);
     reset();
@@ -1622,14 +1976,14 @@ TEST_F(ReplicatedSegmentTest, performWriteEnsureNewHeadOpenAckedBeforeClose) {
 
     EXPECT_TRUE(newHead->isScheduled());
     ASSERT_TRUE(newHead->replicas[0].isActive);
-    EXPECT_TRUE(newHead->replicas[0].writeRpc);
+    EXPECT_TRUE(newHead->replicas[0].writesInFlight);
     EXPECT_TRUE(newHead->replicas[0].sent.open);
     EXPECT_FALSE(newHead->replicas[0].acked.open);
     EXPECT_FALSE(newHead->replicas[0].committed.open);
 
     EXPECT_TRUE(segment->isScheduled());
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     EXPECT_FALSE(segment->replicas[0].sent.close);
 
     taskQueue.performTask(); // reap newHead open, try segment close should work
@@ -1637,13 +1991,13 @@ TEST_F(ReplicatedSegmentTest, performWriteEnsureNewHeadOpenAckedBeforeClose) {
 
     EXPECT_FALSE(newHead->isScheduled());
     ASSERT_TRUE(newHead->replicas[0].isActive);
-    EXPECT_FALSE(newHead->replicas[0].writeRpc);
+    EXPECT_FALSE(newHead->replicas[0].writesInFlight);
     EXPECT_TRUE(newHead->replicas[0].acked.open);
     EXPECT_TRUE(newHead->replicas[0].committed.open);
 
     EXPECT_TRUE(segment->isScheduled());
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_TRUE(segment->replicas[0].writesInFlight);
     EXPECT_TRUE(segment->replicas[0].sent.close);
 
     EXPECT_EQ(0u, deleter.count);
@@ -1676,14 +2030,14 @@ TEST_F(ReplicatedSegmentTest, performWriteEnsureCloseBeforeNewHeadWrittenTo) {
     EXPECT_FALSE(newHead->segment->closedCommitted);
     EXPECT_FALSE(newHead->precedingSegmentCloseCommitted);
     ASSERT_TRUE(newHead->replicas[0].isActive);
-    EXPECT_FALSE(newHead->replicas[0].writeRpc);
+    EXPECT_FALSE(newHead->replicas[0].writesInFlight);
     EXPECT_TRUE(newHead->replicas[0].acked.open);
     EXPECT_TRUE(newHead->replicas[0].committed.open);
     EXPECT_EQ(openLen, newHead->replicas[0].sent.bytes);
 
     EXPECT_TRUE(segment->isScheduled());
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     EXPECT_FALSE(segment->replicas[0].sent.close);
     EXPECT_FALSE(segment->replicas[0].acked.close);
     EXPECT_FALSE(segment->replicas[0].committed.close);
@@ -1707,14 +2061,14 @@ TEST_F(ReplicatedSegmentTest, performWriteEnsureCloseBeforeNewHeadWrittenTo) {
     EXPECT_FALSE(newHead->segment->closedCommitted);
     EXPECT_FALSE(newHead->precedingSegmentCloseCommitted);
     ASSERT_TRUE(newHead->replicas[0].isActive);
-    EXPECT_FALSE(newHead->replicas[0].writeRpc);
+    EXPECT_FALSE(newHead->replicas[0].writesInFlight);
     EXPECT_TRUE(newHead->replicas[0].acked.open);
     EXPECT_TRUE(newHead->replicas[0].committed.open);
     EXPECT_EQ(openLen, newHead->replicas[0].sent.bytes);
 
     EXPECT_TRUE(segment->isScheduled());
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_TRUE(segment->replicas[0].writesInFlight);
     EXPECT_TRUE(segment->replicas[0].sent.close);
     EXPECT_FALSE(segment->replicas[0].acked.close);
     EXPECT_FALSE(segment->replicas[0].committed.close);
@@ -1726,19 +2080,19 @@ TEST_F(ReplicatedSegmentTest, performWriteEnsureCloseBeforeNewHeadWrittenTo) {
     EXPECT_FALSE(newHead->segment->closedCommitted);
     EXPECT_TRUE(newHead->precedingSegmentCloseCommitted);
     ASSERT_TRUE(newHead->replicas[0].isActive);
-    EXPECT_FALSE(newHead->replicas[0].writeRpc);
+    EXPECT_FALSE(newHead->replicas[0].writesInFlight);
     EXPECT_TRUE(newHead->replicas[0].acked.open);
     EXPECT_TRUE(newHead->replicas[0].committed.open);
     EXPECT_EQ(openLen, newHead->replicas[0].sent.bytes);
 
     EXPECT_FALSE(segment->isScheduled());
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     EXPECT_TRUE(segment->replicas[0].sent.close);
     EXPECT_TRUE(segment->replicas[0].acked.close);
     EXPECT_TRUE(segment->replicas[0].committed.close);
     ASSERT_TRUE(segment->replicas[1].isActive);
-    EXPECT_FALSE(segment->replicas[1].writeRpc);
+    EXPECT_FALSE(segment->replicas[1].writesInFlight);
     EXPECT_TRUE(segment->replicas[1].sent.close);
     EXPECT_TRUE(segment->replicas[1].acked.close);
     EXPECT_TRUE(segment->replicas[1].committed.close);
@@ -1750,12 +2104,12 @@ TEST_F(ReplicatedSegmentTest, performWriteEnsureCloseBeforeNewHeadWrittenTo) {
     EXPECT_FALSE(newHead->segment->closedCommitted);
     EXPECT_TRUE(newHead->precedingSegmentCloseCommitted);
     ASSERT_TRUE(newHead->replicas[0].isActive);
-    EXPECT_TRUE(newHead->replicas[0].writeRpc);
+    EXPECT_TRUE(newHead->replicas[0].writesInFlight);
     EXPECT_EQ(openLen + 10, newHead->replicas[0].sent.bytes);
 
     EXPECT_FALSE(segment->isScheduled());
     ASSERT_TRUE(segment->replicas[0].isActive);
-    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[0].writesInFlight);
     EXPECT_TRUE(segment->replicas[0].acked.close);
     EXPECT_TRUE(segment->replicas[0].committed.close);
 
@@ -1786,7 +2140,7 @@ TEST_F(ReplicatedSegmentTest, performWriteBackupRejectedOpen) {
     EXPECT_EQ(0u, segment->replicas[1].sent.bytes);
     EXPECT_EQ(0u, segment->replicas[1].acked.bytes);
     EXPECT_EQ(0u, segment->replicas[1].committed.bytes);
-    EXPECT_FALSE(segment->replicas[1].writeRpc);
+    EXPECT_FALSE(segment->replicas[1].writesInFlight);
     EXPECT_EQ(ServerId(), segment->replicas[1].backupId);
 
     taskQueue.performTask(); // send
@@ -1906,7 +2260,7 @@ TEST_F(ReplicatedSegmentTest, performWriteEnsureDurableOpensOrdered) {
     EXPECT_TRUE(newHead->isScheduled());
     EXPECT_FALSE(newHead->precedingSegmentOpenCommitted);
     ASSERT_TRUE(newHead->replicas[0].isActive);
-    EXPECT_FALSE(newHead->replicas[0].writeRpc);
+    EXPECT_FALSE(newHead->replicas[0].writesInFlight);
     EXPECT_FALSE(newHead->replicas[0].committed.open);
     EXPECT_FALSE(newHead->replicas[0].acked.open);
     EXPECT_EQ(0lu, newHead->replicas[0].sent.bytes);
@@ -1934,7 +2288,7 @@ TEST_F(ReplicatedSegmentTest, performWriteEnsureDurableOpensOrdered) {
     EXPECT_TRUE(newHead->isScheduled());
     EXPECT_TRUE(newHead->precedingSegmentOpenCommitted);
     ASSERT_TRUE(newHead->replicas[0].isActive);
-    EXPECT_TRUE(newHead->replicas[0].writeRpc);
+    EXPECT_TRUE(newHead->replicas[0].writesInFlight);
     EXPECT_FALSE(newHead->replicas[0].committed.open);
     EXPECT_FALSE(newHead->replicas[0].acked.open);
     EXPECT_EQ(openLen, newHead->replicas[0].sent.bytes);
@@ -19,6 +19,7 @@
 #include "Fence.h"
 #include "RpcLevel.h"
 #include "ServerId.h"
+#include "TimeTrace.h"
 #include "Transport.h"
 #include "WireFormat.h"
 
@@ -111,6 +112,7 @@ class RpcWrapper : public Transport::RpcNotifier {
         memset(reqHdr, 0, sizeof(*reqHdr));
         reqHdr->common.opcode = RpcType::opcode;
         reqHdr->common.service = RpcType::service;
+        reqHdr->common.traceId = TimeTrace::currentTraceId;
         return reqHdr;
     }
 
@@ -142,6 +144,7 @@ class RpcWrapper : public Transport::RpcNotifier {
         memset(reqHdr, 0, sizeof(*reqHdr));
         reqHdr->common.opcode = RpcType::opcode;
         reqHdr->common.service = RpcType::service;
+        reqHdr->common.traceId = TimeTrace::currentTraceId;
         reqHdr->common.targetId = targetId.getId();
         return reqHdr;
     }
@@ -13,6 +13,9 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+
 #include "Common.h"
 #include "BitOps.h"
 #include "LogSegment.h"
@@ -20,13 +23,17 @@
 #include "Segment.h"
 #include "ServerConfig.h"
 #include "ShortMacros.h"
+#include "Util.h"
 
 namespace RAMCloud {
 
 /**
  * Construct a new SegmentAllocator by allocating a large chunk of memory
  * and chopping it up into individual seglets of the specified size. All
- * seglets will be placed in the lowest priority "default" pool.
+ * seglets will be placed in the lowest priority "default" pool (or, if
+ * the configuration calls for more than one NUMA node, in the default pool
+ * of the node backing them). If the configuration calls for cold storage,
+ * its file is mapped and chopped up into the seglets of the cold pool.
  *
  * \param config
  *      Server runtime configuration, specifying various parameters like
@@ -41,18 +48,62 @@ SegletAllocator::SegletAllocator(const ServerConfig* config)
       emergencyHeadPoolReserve(0),
       cleanerPool(),
       cleanerPoolReserve(0),
-      defaultPool(),
+      numaNodes(getNumaNodes(config)),
+      segletsPerNode(0),
+      defaultPools(numaNodes),
+      coldPool(),
       segletToSegmentTable(),
-      block(config->master.logBytes)
+      block(config->master.logBytes, config->master.hugePages,
+            numaNodes == 1),
+      coldBlock()
 {
     assert(BitOps::isPowerOfTwo(segletSize));
+
+    // Each node's share must be a whole number of pages, or mbind() fails
+    // for memory backed by hugetlb pages.
+    size_t segletsPerPage = std::max(size_t(1), block.pageSize / segletSize);
+    size_t pages = getTotalCount() / segletsPerPage;
+    if (numaNodes > pages) {
+        numaNodes = downCast<uint32_t>(std::max(size_t(1), pages));
+        defaultPools.resize(numaNodes);
+    }
+    if (numaNodes < config->master.numaNodes) {
+        LOG(WARNING, "Too few seglets of log memory for %u NUMA nodes; "
+            "using %u", config->master.numaNodes, numaNodes);
+    }
+    segletsPerNode = getTotalCount() / numaNodes / segletsPerPage *
+            segletsPerPage;
+    if (numaNodes > 1)
+        bindToNodes();
+    if (getNumaNodes(config) > 1)
+        block.populate();
+
     uint8_t* segletBlock = block.get();
     for (size_t i = 0; i < (block.length / segletSize); i++) {
         Seglet* seglet = new Seglet(*this, segletBlock, segletSize);
         segletToSegmentTable.push_back(NULL);
-        defaultPool.push_back(seglet);
+        defaultPools[getNode(seglet)].push_back(seglet);
+        segletBlock += segletSize;
+    }
+
+    if (config->master.coldStorageBytes == 0)
+        return;
+
+    // The file may be many times larger than memory, so its pages must not
+    // be faulted in (or, later, pinned; see unpinColdMemory()).
+    coldBlock.construct(config->master.coldStorageFile,
+                        config->master.coldStorageBytes, false);
+    segletBlock = coldBlock->get();
+    for (size_t i = 0; i < (coldBlock->length / segletSize); i++) {
+        Seglet* seglet = new Seglet(*this, segletBlock, segletSize);
+        seglet->setSourcePool(&coldPool);
+        segletToSegmentTable.push_back(NULL);
+        coldPool.push_back(seglet);
         segletBlock += segletSize;
     }
+    LOG(NOTICE, "Using %lu MB of cold storage in %s",
+        coldBlock->length / 1024 / 1024,
+        config->master.coldStorageFile.c_str());
 }
 
 /**
@@ -63,8 +114,9 @@ SegletAllocator::~SegletAllocator()
 {
     size_t totalFree = emergencyHeadPool.size() +
                        cleanerPool.size() +
-                       defaultPool.size();
-    size_t expectedFree = block.length / segletSize;
+                       getDefaultPoolCount() +
+                       coldPool.size();
+    size_t expectedFree = getTotalCount() + getTotalCount(COLD);
 
     if (totalFree != expectedFree)
         LOG(WARNING, "Destructor called before all seglets freed!");
@@ -73,7 +125,11 @@ SegletAllocator::~SegletAllocator()
         delete s;
     foreach (Seglet* s, cleanerPool)
         delete s;
-    foreach (Seglet* s, defaultPool)
+    foreach (vector<Seglet*>& pool, defaultPools) {
+        foreach (Seglet* s, pool)
+            delete s;
+    }
+    foreach (Seglet* s, coldPool)
         delete s;
 }
 
@@ -95,7 +151,16 @@ SegletAllocator::getMetrics(ProtoBuf::LogMetrics_SegletMetrics& m)
     m.set_emergency_head_pool_count(emergencyHeadPool.size());
     m.set_cleaner_pool_reserve(cleanerPoolReserve);
     m.set_cleaner_pool_count(cleanerPool.size());
-    m.set_default_pool_count(defaultPool.size());
+    m.set_default_pool_count(getDefaultPoolCount());
+    for (uint32_t node = 0; node < numaNodes; node++) {
+        size_t seglets = segletsPerNode;
+        if (node == numaNodes - 1)
+            seglets = getTotalCount() - node * segletsPerNode;
+        m.add_node_seglets(seglets);
+        m.add_node_default_pool_count(defaultPools[node].size());
+    }
+    m.set_cold_seglets(getTotalCount(COLD));
+    m.set_cold_pool_count(coldPool.size());
 }
 
 /**
@@ -103,6 +168,8 @@ SegletAllocator::getMetrics(ProtoBuf::LogMetrics_SegletMetrics& m)
  * the way purpose for which the seglets will be used.
  *
  * This method either successfully allocates all seglets requested, or none.
+ * Default allocations come from the calling thread's NUMA node if it has
+ * enough free seglets.
  *
  * \param type
  *      Type specifying the pool to allocate from.
@@ -124,7 +191,10 @@ SegletAllocator::alloc(AllocationType type,
     if (type == CLEANER)
         return allocFromPool(cleanerPool, count, outSeglets);
 
-    return allocFromPool(defaultPool, count, outSeglets);
+    if (type == COLD)
+        return allocFromPool(coldPool, count, outSeglets);
+
+    return allocFromDefaultPools(count, outSeglets);
 }
 
 /**
@@ -148,7 +218,7 @@ SegletAllocator::initializeEmergencyHeadReserve(uint32_t numSeglets)
     if (emergencyHeadPoolReserve != 0)
         return false;
 
-    if (!allocFromPool(defaultPool, numSeglets, emergencyHeadPool))
+    if (!allocFromDefaultPools(numSeglets, emergencyHeadPool))
         return false;
 
     foreach (Seglet* seglet, emergencyHeadPool)
@@ -158,8 +228,8 @@ SegletAllocator::initializeEmergencyHeadReserve(uint32_t numSeglets)
         "%lu seglets (%lu MB) left in default pool.",
         numSeglets,
         static_cast<uint64_t>(numSeglets) * segletSize / 1024 / 1024,
-        defaultPool.size(),
-        defaultPool.size() * segletSize / 1024 / 1024);
+        getDefaultPoolCount(),
+        getDefaultPoolCount() * segletSize / 1024 / 1024);
 
     emergencyHeadPoolReserve = numSeglets;
     return true;
@@ -186,15 +256,15 @@ SegletAllocator::initializeCleanerReserve(uint32_t numSeglets)
     if (cleanerPoolReserve != 0)
         return false;
 
-    if (!allocFromPool(defaultPool, numSeglets, cleanerPool))
+    if (!allocFromDefaultPools(numSeglets, cleanerPool))
         return false;
 
     LOG(NOTICE, "Reserved %u seglets for the cleaner (%lu MB). %lu seglets "
         "(%lu MB) left in default pool.",
         numSeglets,
         static_cast<uint64_t>(numSeglets) * segletSize / 1024 / 1024,
-        defaultPool.size(),
-        defaultPool.size() * segletSize / 1024 / 1024);
+        getDefaultPoolCount(),
+        getDefaultPoolCount() * segletSize / 1024 / 1024);
 
     cleanerPoolReserve = numSeglets;
     return true;
@@ -207,7 +277,8 @@ SegletAllocator::initializeCleanerReserve(uint32_t numSeglets)
 void
 SegletAllocator::free(Seglet* seglet)
 {
-    if (DEBUG_BUILD)
+    // Scribbling over cold seglets would read them back in from flash.
+    if (DEBUG_BUILD && !isCold(seglet->get()))
         memset(seglet->get(), '!', seglet->getLength());
 
     std::lock_guard<SpinLock> guard(lock);
@@ -228,6 +299,12 @@ SegletAllocator::free(Seglet* seglet)
         return;
     }
 
+    // Cold seglets can't stand in for memory, and vice versa.
+    if (seglet->getSourcePool() == &coldPool) {
+        coldPool.push_back(seglet);
+        return;
+    }
+
     // Any seglets not allocated to emergency heads should be used to fill empty
     // space in the cleaner reserve. The cleaner maintains the invariant that
     // after every pass it has consumed no more seglets than it has freed. Thus
@@ -238,14 +315,15 @@ SegletAllocator::free(Seglet* seglet)
     }
 
     // If we're making forward progress, any excess clean seglets accumulate in
-    // the default pool. New log heads can allocate from this to service new
-    // log appends.
-    defaultPool.push_back(seglet);
+    // the default pool of their node. New log heads can allocate from this to
+    // service new log appends.
+    defaultPools[getNode(seglet)].push_back(seglet);
 }
 
 /**
- * Return the total number of seglets this allocator is managing. This includes
- * free seglets, reserved seglets, and currently allocated ones.
+ * Return the total number of seglets this allocator is managing in memory.
+ * This includes free seglets, reserved seglets, and currently allocated ones,
+ * but not cold seglets.
  */
 size_t
 SegletAllocator::getTotalCount()
@@ -266,8 +344,10 @@ SegletAllocator::getFreeCount(AllocationType type)
         return emergencyHeadPool.size();
     if (type == CLEANER)
         return cleanerPool.size();
+    if (type == COLD)
+        return coldPool.size();
     assert(type == DEFAULT);
-    return defaultPool.size();
+    return getDefaultPoolCount();
 }
 
 size_t
@@ -277,6 +357,8 @@ SegletAllocator::getTotalCount(AllocationType type)
         return emergencyHeadPoolReserve;
     if (type == CLEANER)
         return cleanerPoolReserve;
+    if (type == COLD)
+        return coldBlock ? coldBlock->length / segletSize : 0;
     assert(type == DEFAULT);
     return getTotalCount() - emergencyHeadPoolReserve - cleanerPoolReserve;
 }
@@ -310,6 +392,15 @@ SegletAllocator::getTotalBytes()
     return block.length;
 }
 
+/**
+ * Return the size in bytes of the pages backing the log's memory.
+ */
+size_t
+SegletAllocator::getPageSize()
+{
+    return block.pageSize;
+}
+
 /**
  * Return the percentage of unreserved seglets currently allocated. In other
  * words, the amount of space allocated in the log, not including seglets set
@@ -324,12 +415,14 @@ SegletAllocator::getMemoryUtilization()
     size_t maxDefaultPoolSize = getTotalCount() -
                                 emergencyHeadPoolReserve -
                                 cleanerPoolReserve;
-    return downCast<int>(100 * (maxDefaultPoolSize - defaultPool.size()) /
+    return downCast<int>(100 * (maxDefaultPoolSize - getDefaultPoolCount()) /
                          maxDefaultPoolSize);
 }
 
 /**
- * XXX
+ * Return the LogSegment that owns the seglet containing the given address,
+ * which may be in memory or in cold storage. NULL is returned if the seglet
+ * is free.
  */
 LogSegment*
 SegletAllocator::getOwnerSegment(const void* p)
@@ -358,17 +451,214 @@ SegletAllocator::setOwnerSegment(Seglet* seglet, LogSegment* segment)
     Fence::sfence();
 }
 
+/**
+ * Return true if the given address lies in a cold seglet (one backed by cold
+ * storage rather than memory).
+ */
+bool
+SegletAllocator::isCold(const void* p)
+{
+    if (!coldBlock)
+        return false;
+    uintptr_t i = reinterpret_cast<uintptr_t>(p);
+    uintptr_t coldBase = reinterpret_cast<uintptr_t>(coldBlock->get());
+    return (i >= coldBase) && (i < (coldBase + coldBlock->length));
+}
+
+/**
+ * Write the contents of part of a cold seglet back to cold storage and drop
+ * it from this process's memory. The contents remain accessible; they will
+ * be read back from flash the next time they're touched. The cleaner calls
+ * this once it has finished writing a segment into cold seglets.
+ *
+ * \param p
+ *      Page-aligned start of the range, which must lie in cold seglets.
+ * \param length
+ *      Number of bytes in the range.
+ */
+void
+SegletAllocator::releaseColdMemory(const void* p, uint32_t length)
+{
+    assert(isCold(p));
+    void* start = const_cast<void*>(p);
+    if (msync(start, length, MS_SYNC) != 0) {
+        LOG(WARNING, "Couldn't write %u bytes of cold storage at %p: %s",
+            length, p, strerror(errno));
+        return;
+    }
+    if (madvise(start, length, MADV_DONTNEED) != 0) {
+        LOG(WARNING, "Couldn't release %u bytes of cold storage at %p: %s",
+            length, p, strerror(errno));
+    }
+}
+
+/**
+ * Make sure a range of cold storage is in memory, reading it from flash if
+ * necessary. Callers use this to take page faults on cold data before
+ * acquiring locks that other threads may be waiting for, such as hash table
+ * bucket locks; touching the same data under the lock is then cheap. Does
+ * nothing if the range doesn't start in cold storage.
+ *
+ * \param p
+ *      Start of the range.
+ * \param length
+ *      Number of bytes in the range. The range is cut off at the end of
+ *      cold storage.
+ */
+void
+SegletAllocator::faultInColdMemory(const void* p, uint32_t length)
+{
+    if (!isCold(p))
+        return;
+    uintptr_t start = reinterpret_cast<uintptr_t>(p);
+    uintptr_t coldBase = reinterpret_cast<uintptr_t>(coldBlock->get());
+    uintptr_t end = std::min(start + length, coldBase + coldBlock->length);
+    uintptr_t pageSize = coldBlock->pageSize;
+    for (uintptr_t page = start & ~(pageSize - 1); page < end;
+            page += pageSize) {
+        static_cast<void>(*reinterpret_cast<volatile const uint8_t*>(page));
+    }
+}
+
+/**
+ * Unpin the memory mapping of cold storage, if any. This must be called
+ * after pinAllMemory(), which would otherwise try to read all of cold storage
+ * into memory and keep it there.
+ */
+void
+SegletAllocator::unpinColdMemory()
+{
+    if (coldBlock && munlock(coldBlock->get(), coldBlock->length) != 0) {
+        LOG(WARNING, "Couldn't unpin cold storage: %s", strerror(errno));
+    }
+}
+
 size_t
 SegletAllocator::getSegletIndex(const void* p)
 {
     uintptr_t i = reinterpret_cast<uintptr_t>(p);
     uintptr_t blockBase = reinterpret_cast<uintptr_t>(block.get());
-    if ((i < blockBase) || (i >= (blockBase + block.length))) {
-        RAMCLOUD_DIE("pointer out of range; p: %p, blockBase: 0x%lu, "
-                "length: %lu",
-                p, blockBase, block.length);
+    if ((i >= blockBase) && (i < (blockBase + block.length)))
+        return (i - blockBase) >> segletSizeShift;
+    if (isCold(p)) {
+        uintptr_t coldBase = reinterpret_cast<uintptr_t>(coldBlock->get());
+        return getTotalCount() + ((i - coldBase) >> segletSizeShift);
     }
-    return (i - blockBase) >> segletSizeShift;
+    RAMCLOUD_DIE("pointer out of range; p: %p, blockBase: 0x%lu, "
+            "length: %lu",
+            p, blockBase, block.length);
+}
+
+/**
+ * Return the number of NUMA nodes the log memory described by a server's
+ * configuration should be divided among: the number configured, but never
+ * less than one or more than the number of seglets (so every node has at
+ * least one seglet).
+ *
+ * \param config
+ *      Server runtime configuration.
+ */
+uint32_t
+SegletAllocator::getNumaNodes(const ServerConfig* config)
+{
+    uint64_t seglets = config->master.logBytes / config->segletSize;
+    return downCast<uint32_t>(std::max(uint64_t(1),
+            std::min(uint64_t(config->master.numaNodes), seglets)));
+}
+
+/**
+ * Return the NUMA node whose memory backs the given seglet (always 0 unless
+ * #numaNodes > 1).
+ */
+uint32_t
+SegletAllocator::getNode(Seglet* seglet)
+{
+    if (numaNodes == 1)
+        return 0;
+    size_t node = getSegletIndex(seglet->get()) / segletsPerNode;
+    return downCast<uint32_t>(std::min(node, size_t(numaNodes - 1)));
+}
+
+/**
+ * Return the total number of seglets in the default pools of all nodes.
+ * This must be called with the monitor lock held.
+ */
+size_t
+SegletAllocator::getDefaultPoolCount()
+{
+    size_t count = 0;
+    foreach (vector<Seglet*>& pool, defaultPools)
+        count += pool.size();
+    return count;
+}
+
+/**
+ * Bind each NUMA node's share of #block to that node's memory (see
+ * #segletsPerNode). This is done before the block is populated, so pages
+ * are allocated on the right node to begin with. Failures are logged and
+ * otherwise ignored: the memory still works, it just may not be local to
+ * the threads using it.
+ */
+void
+SegletAllocator::bindToNodes()
+{
+    for (uint32_t node = 0; node < numaNodes; node++) {
+        uint8_t* start = block.get() + node * segletsPerNode * segletSize;
+        size_t length = segletsPerNode * segletSize;
+        if (node == numaNodes - 1)
+            length = block.mappedLength - node * segletsPerNode * segletSize;
+        unsigned long nodeMask = 1UL << node; // NOLINT
+        if (syscall(SYS_mbind, start, length, MPOL_BIND, &nodeMask,
+                    sizeof(nodeMask) * 8, 0) != 0) {
+            LOG(WARNING, "Couldn't bind %lu MB of log memory to NUMA node "
+                "%u: %s", length / 1024 / 1024, node, strerror(errno));
+            continue;
+        }
+        LOG(NOTICE, "Bound %lu MB of log memory at %p to NUMA node %u",
+            length / 1024 / 1024, start, node);
+    }
+}
+
+/**
+ * Allocate the exact number of requested seglets from the default pools. The
+ * pool of the calling thread's NUMA node is preferred, then any other single
+ * node's pool; if no node has enough free seglets on its own, they are taken
+ * from several nodes. If even that isn't enough, nothing is allocated.
+ *
+ * This must be called with the monitor lock held.
+ *
+ * \param count
+ *      The number of seglets to allocate.
+ * \param outSeglets
+ *      Vector to return allocated seglets in.
+ * \return
+ *      True if the full allocation succeeded, otherwise false.
+ */
+bool
+SegletAllocator::allocFromDefaultPools(uint32_t count,
+                                       vector<Seglet*>& outSeglets)
+{
+    uint32_t localNode = 0;
+    if (numaNodes > 1) {
+        int node = Util::getNumaNode();
+        if (node >= 0)
+            localNode = downCast<uint32_t>(node) % numaNodes;
+    }
+    for (uint32_t i = 0; i < numaNodes; i++) {
+        uint32_t node = (localNode + i) % numaNodes;
+        if (allocFromPool(defaultPools[node], count, outSeglets))
+            return true;
+    }
+
+    if (getDefaultPoolCount() < count)
+        return false;
+    for (uint32_t i = 0; i < numaNodes && count > 0; i++) {
+        vector<Seglet*>& pool = defaultPools[(localNode + i) % numaNodes];
+        uint32_t n = std::min(count, downCast<uint32_t>(pool.size()));
+        allocFromPool(pool, n, outSeglets);
+        count -= n;
+    }
+    return true;
 }
 
 /**
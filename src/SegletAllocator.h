@@ -20,6 +20,7 @@
 #include "LargeBlockOfMemory.h"
 #include "Seglet.h"
 #include "SpinLock.h"
+#include "Tub.h"
 
 #include "LogMetrics.pb.h"
 
@@ -49,6 +50,23 @@ class LogSegment;
  * Finally, there is a "default" pool from which regular log heads are allocated
  * to service normal log appends.
  *
+ * On servers with several NUMA nodes the memory can be divided evenly among
+ * them (see ServerConfig::Master::numaNodes). Each node's share is bound to
+ * that node and the default pool is split into one pool per node; default
+ * allocations prefer the node of the calling thread, so a new head segment
+ * lives on the same socket as the worker that appends to it.
+ *
+ * If the configuration provides cold storage (see
+ * ServerConfig::Master::coldStorageBytes), there is also a "cold" pool of
+ * seglets carved out of a file on local flash that is mapped into memory
+ * but never pinned. The cleaner demotes segments holding old objects into
+ * cold seglets, freeing their memory; the objects keep ordinary log
+ * references, and reading one simply faults its pages in from flash in
+ * the worker thread serving the read (outside any hash table bucket lock;
+ * see faultInColdMemory()), which copies the object into the reply. Cold seglets are only ever
+ * allocated explicitly (AllocationType COLD) and always return to the cold
+ * pool.
+ *
  * How seglets are returned to appropriate pools is somewhat subtle (and
  * annoyingly so). See the free() method's documentation if you're interested.
  *
@@ -67,7 +85,8 @@ class SegletAllocator {
     enum AllocationType {
         EMERGENCY_HEAD,
         CLEANER,
-        DEFAULT
+        DEFAULT,
+        COLD
     };
 
     explicit SegletAllocator(const ServerConfig* config);
@@ -85,12 +104,23 @@ class SegletAllocator {
     uint32_t getSegletSize();
     const void* getBaseAddress();
     uint64_t getTotalBytes();
+    size_t getPageSize();
     int getMemoryUtilization();
     LogSegment* getOwnerSegment(const void* p);
     void setOwnerSegment(Seglet* seglet, LogSegment* segment);
+    bool isCold(const void* p);
+    void releaseColdMemory(const void* p, uint32_t length);
+    void faultInColdMemory(const void* p, uint32_t length);
+    void unpinColdMemory();
 
   PRIVATE:
     size_t getSegletIndex(const void* p);
+    static uint32_t getNumaNodes(const ServerConfig* config);
+    uint32_t getNode(Seglet* seglet);
+    size_t getDefaultPoolCount();
+    void bindToNodes();
+    bool allocFromDefaultPools(uint32_t count,
+                               vector<Seglet*>& outSeglets);
     bool allocFromPool(vector<Seglet*>& pool,
                        uint32_t count,
                        vector<Seglet*>& outSeglets);
@@ -137,17 +167,37 @@ class SegletAllocator {
     /// Maximum number of seglets to reserve in the cleanerPool.
     uint32_t cleanerPoolReserve;
 
-    /// Pool holding all other seglets not otherwise reserved.
-    vector<Seglet*> defaultPool;
+    /// Number of NUMA nodes the seglets are divided among (at least 1, and
+    /// no more than the number of pages backing #block).
+    uint32_t numaNodes;
+
+    /// Number of seglets backed by each NUMA node's memory; the seglets of
+    /// node i are the ones with indexes [i * segletsPerNode,
+    /// (i + 1) * segletsPerNode), except that the last node also takes any
+    /// remainder. Always a whole number of #block's pages.
+    size_t segletsPerNode;
+
+    /// Pools holding all other seglets not otherwise reserved, one for each
+    /// NUMA node (so just one unless numaNodes > 1).
+    vector<vector<Seglet*>> defaultPools;
+
+    /// Pool holding the free seglets backed by #coldBlock. Empty if there is
+    /// no cold storage.
+    vector<Seglet*> coldPool;
 
     /// Table mapping blocks of memory backing Seglets to their owner LogSegment
     /// objects. This allows getOwnerSegment() to look up a LogSegment object
-    /// based on a pointer anywhere into ``block'' below.
+    /// based on a pointer anywhere into ``block'' or ``coldBlock'' below (the
+    /// seglets of coldBlock follow those of block).
     vector<LogSegment*> segletToSegmentTable;
 
     /// Single contiguous block of memory backing all of our seglets.
     LargeBlockOfMemory<uint8_t> block;
 
+    /// Mapping of the cold storage file, backing the seglets in #coldPool.
+    /// Only constructed if the server has cold storage.
+    Tub<LargeBlockOfMemory<uint8_t>> coldBlock;
+
     DISALLOW_COPY_AND_ASSIGN(SegletAllocator);
 };
 
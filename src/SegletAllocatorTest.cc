@@ -44,7 +44,7 @@ TEST_F(SegletAllocatorTest, constructor) {
     EXPECT_EQ(0U, allocator.cleanerPoolReserve);
     EXPECT_EQ(0U, allocator.cleanerPool.size());
     EXPECT_EQ(serverConfig.master.logBytes / serverConfig.segletSize,
-        allocator.defaultPool.size());
+        allocator.defaultPools[0].size());
 }
 
 TEST_F(SegletAllocatorTest, destructor) {
@@ -74,7 +74,7 @@ TEST_F(SegletAllocatorTest, alloc) {
     EXPECT_EQ(0U, allocator.cleanerPool.size());
     EXPECT_FALSE(allocator.alloc(SegletAllocator::CLEANER, 1, seglets));
 
-    EXPECT_EQ(318U, allocator.defaultPool.size());
+    EXPECT_EQ(318U, allocator.defaultPools[0].size());
     EXPECT_TRUE(allocator.alloc(SegletAllocator::DEFAULT, 254, seglets));
     EXPECT_EQ(0U, allocator.cleanerPool.size());
 
@@ -88,7 +88,7 @@ TEST_F(SegletAllocatorTest, initializeEmergencyHeadReserve) {
     EXPECT_EQ(0U, allocator.emergencyHeadPool.size());
     allocator.emergencyHeadPoolReserve = 0;
 
-    uint32_t maxSeglets = downCast<uint32_t>(allocator.defaultPool.size());
+    uint32_t maxSeglets = downCast<uint32_t>(allocator.defaultPools[0].size());
     EXPECT_FALSE(allocator.initializeEmergencyHeadReserve(maxSeglets + 1));
     EXPECT_EQ(0U, allocator.emergencyHeadPool.size());
 
@@ -104,7 +104,7 @@ TEST_F(SegletAllocatorTest, initializeCleanerReserve) {
     EXPECT_EQ(0U, allocator.cleanerPool.size());
     allocator.cleanerPoolReserve = 0;
 
-    uint32_t maxSeglets = downCast<uint32_t>(allocator.defaultPool.size());
+    uint32_t maxSeglets = downCast<uint32_t>(allocator.defaultPools[0].size());
     EXPECT_FALSE(allocator.initializeCleanerReserve(maxSeglets + 1));
     EXPECT_EQ(0U, allocator.cleanerPool.size());
 
@@ -132,13 +132,51 @@ TEST_F(SegletAllocatorTest, free) {
     allocator.free(seglets[0]);
     EXPECT_EQ(1U, allocator.cleanerPool.size());
 
-    uint32_t defaultSeglets = downCast<uint32_t>(allocator.defaultPool.size());
+    uint32_t defaultSeglets =
+            downCast<uint32_t>(allocator.defaultPools[0].size());
     allocator.free(seglets[1]);
-    EXPECT_EQ(defaultSeglets + 1, allocator.defaultPool.size());
+    EXPECT_EQ(defaultSeglets + 1, allocator.defaultPools[0].size());
+}
+
+TEST_F(SegletAllocatorTest, coldStorage) {
+    serverConfig.master.coldStorageFile =
+        format("/tmp/ramcloud-cold-storage-test-%d", getpid());
+    serverConfig.master.coldStorageBytes = 4 * serverConfig.segletSize;
+    SegletAllocator cold(&serverConfig);
+    EXPECT_EQ(4U, cold.getTotalCount(SegletAllocator::COLD));
+    EXPECT_EQ(4U, cold.getFreeCount(SegletAllocator::COLD));
+    EXPECT_EQ(allocator.getTotalCount(), cold.getTotalCount());
+
+    vector<Seglet*> seglets;
+    EXPECT_TRUE(cold.alloc(SegletAllocator::COLD, 3, seglets));
+    EXPECT_FALSE(cold.alloc(SegletAllocator::COLD, 2, seglets));
+    EXPECT_EQ(1U, cold.getFreeCount(SegletAllocator::COLD));
+    EXPECT_EQ(cold.getFreeCount(SegletAllocator::DEFAULT),
+              allocator.getFreeCount(SegletAllocator::DEFAULT));
+    EXPECT_TRUE(cold.isCold(seglets[0]->get()));
+    EXPECT_FALSE(cold.isCold(cold.block.get()));
+    EXPECT_FALSE(allocator.isCold(seglets[0]->get()));
+
+    LogSegment* owner = reinterpret_cast<LogSegment*>(0x1234);
+    cold.setOwnerSegment(seglets[2], owner);
+    uint8_t* p = static_cast<uint8_t*>(seglets[2]->get());
+    EXPECT_EQ(owner, cold.getOwnerSegment(p + 10));
+    EXPECT_NE(owner, cold.getOwnerSegment(seglets[1]->get()));
+
+    // Data survives being written back and dropped from memory.
+    p[0] = 'x';
+    cold.releaseColdMemory(p, serverConfig.segletSize);
+    EXPECT_EQ('x', p[0]);
+
+    foreach (Seglet* seglet, seglets)
+        cold.free(seglet);
+    EXPECT_EQ(4U, cold.getFreeCount(SegletAllocator::COLD));
+    EXPECT_EQ(cold.getFreeCount(SegletAllocator::DEFAULT),
+              allocator.getFreeCount(SegletAllocator::DEFAULT));
 }
 
 TEST_F(SegletAllocatorTest, getFreeCount) {
-    size_t defaultSeglets = allocator.defaultPool.size();
+    size_t defaultSeglets = allocator.defaultPools[0].size();
 
     EXPECT_EQ(0U, allocator.getFreeCount(SegletAllocator::EMERGENCY_HEAD));
     allocator.initializeEmergencyHeadReserve(2);
@@ -184,22 +222,86 @@ TEST_F(SegletAllocatorTest, getMemoryUtilization) {
 
 TEST_F(SegletAllocatorTest, allocFromPool) {
     vector<Seglet*> seglets;
-    uint32_t maxSeglets = downCast<uint32_t>(allocator.defaultPool.size());
+    uint32_t maxSeglets = downCast<uint32_t>(allocator.defaultPools[0].size());
 
-    EXPECT_FALSE(allocator.allocFromPool(allocator.defaultPool,
+    EXPECT_FALSE(allocator.allocFromPool(allocator.defaultPools[0],
                                          maxSeglets + 1,
                                          seglets));
 
-    EXPECT_EQ(maxSeglets, allocator.defaultPool.size());
+    EXPECT_EQ(maxSeglets, allocator.defaultPools[0].size());
     EXPECT_EQ(0U, seglets.size());
-    EXPECT_TRUE(allocator.allocFromPool(allocator.defaultPool,
+    EXPECT_TRUE(allocator.allocFromPool(allocator.defaultPools[0],
                                         maxSeglets,
                                         seglets));
-    EXPECT_EQ(0U, allocator.defaultPool.size());
+    EXPECT_EQ(0U, allocator.defaultPools[0].size());
     EXPECT_EQ(maxSeglets, seglets.size());
 
     // return to allocator
-    allocator.allocFromPool(seglets, maxSeglets, allocator.defaultPool);
+    allocator.allocFromPool(seglets, maxSeglets, allocator.defaultPools[0]);
+}
+
+TEST_F(SegletAllocatorTest, allocFromDefaultPools_numaNodes) {
+    serverConfig.master.numaNodes = 2;
+    SegletAllocator numaAllocator(&serverConfig);
+    size_t total = numaAllocator.getTotalCount();
+    ASSERT_EQ(2U, numaAllocator.defaultPools.size());
+    EXPECT_EQ(total / 2, numaAllocator.defaultPools[0].size());
+    EXPECT_EQ(total - total / 2, numaAllocator.defaultPools[1].size());
+
+    // A node whose pool runs dry is backed by the other one; an allocation
+    // neither can satisfy alone is split between them.
+    vector<Seglet*> seglets;
+    uint32_t node0 = downCast<uint32_t>(numaAllocator.defaultPools[0].size());
+    EXPECT_TRUE(numaAllocator.allocFromPool(numaAllocator.defaultPools[0],
+                                            node0 - 1, seglets));
+    EXPECT_TRUE(numaAllocator.allocFromDefaultPools(2, seglets));
+    EXPECT_EQ(node0 + 1, seglets.size());
+    uint32_t remaining = downCast<uint32_t>(
+            numaAllocator.getFreeCount(SegletAllocator::DEFAULT));
+    EXPECT_FALSE(numaAllocator.allocFromDefaultPools(remaining + 1, seglets));
+    EXPECT_TRUE(numaAllocator.allocFromDefaultPools(remaining, seglets));
+    EXPECT_EQ(0U, numaAllocator.getFreeCount(SegletAllocator::DEFAULT));
+
+    // Freed seglets go back to the pool of the node backing them.
+    foreach (Seglet* s, seglets)
+        s->free();
+    EXPECT_EQ(total / 2, numaAllocator.defaultPools[0].size());
+    EXPECT_EQ(total - total / 2, numaAllocator.defaultPools[1].size());
+
+    ProtoBuf::LogMetrics_SegletMetrics m;
+    numaAllocator.getMetrics(m);
+    EXPECT_EQ(2, m.node_seglets_size());
+    EXPECT_EQ(total / 2, m.node_default_pool_count(0));
+}
+
+TEST_F(SegletAllocatorTest, constructor_fewerSegletsThanNumaNodes) {
+    serverConfig.master.numaNodes = 4;
+    serverConfig.master.logBytes = 2 * serverConfig.segletSize;
+    TestLog::Enable _("SegletAllocator");
+    SegletAllocator numaAllocator(&serverConfig);
+    EXPECT_EQ("SegletAllocator: Too few seglets of log memory for 4 NUMA "
+              "nodes; using 2", TestLog::get());
+    EXPECT_EQ(2U, numaAllocator.numaNodes);
+    EXPECT_EQ(1U, numaAllocator.segletsPerNode);
+    EXPECT_EQ(1U, numaAllocator.defaultPools[0].size());
+    EXPECT_EQ(1U, numaAllocator.defaultPools[1].size());
+}
+
+TEST_F(SegletAllocatorTest, constructor_numaNodesWholePages) {
+    // Pretend the log is backed by 2 MB transparent huge pages.
+    LargeBlockOfMemoryInternal::mockHugePages = 1;
+    serverConfig.master.hugePages = true;
+    serverConfig.master.numaNodes = 2;
+    serverConfig.master.logBytes = 3 * 2 * 1024 * 1024;
+    SegletAllocator numaAllocator(&serverConfig);
+    LargeBlockOfMemoryInternal::mockHugePages = 0;
+    ASSERT_EQ(2UL * 1024 * 1024, numaAllocator.block.pageSize);
+
+    // Node 0 gets one whole page rather than half of the three.
+    size_t segletsPerPage = 2 * 1024 * 1024 / serverConfig.segletSize;
+    EXPECT_EQ(segletsPerPage, numaAllocator.segletsPerNode);
+    EXPECT_EQ(segletsPerPage, numaAllocator.defaultPools[0].size());
+    EXPECT_EQ(2 * segletsPerPage, numaAllocator.defaultPools[1].size());
 }
 
 } // namespace RAMCloud
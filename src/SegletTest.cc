@@ -64,7 +64,7 @@ TEST_F(SegletTest, constructor) {
 
 TEST_F(SegletTest, free) {
     s->free();
-    EXPECT_EQ(allocator.defaultPool.back(), s);
+    EXPECT_EQ(allocator.defaultPools[0].back(), s);
     s = NULL;
 }
 
@@ -64,7 +64,8 @@ SegmentManager::SegmentManager(Context* context,
       masterTableMetadata(masterTableMetadata),
       segletsPerSegment(segmentSize / allocator.getSegletSize()),
       maxSegments(static_cast<uint32_t>(static_cast<double>(
-        allocator.getTotalCount() / segletsPerSegment)
+        (allocator.getTotalCount() +
+         allocator.getTotalCount(SegletAllocator::COLD)) / segletsPerSegment)
           * config->master.diskExpansionFactor)),
       segments(NULL),
       states(NULL),
@@ -94,7 +95,8 @@ SegmentManager::SegmentManager(Context* context,
     if (!allocator.initializeEmergencyHeadReserve(2 * segletsPerSegment))
         throw SegmentManagerException(HERE, "must have at least two segments");
 
-    assert(maxSegments >= (allocator.getTotalCount() / segletsPerSegment));
+    assert(maxSegments >= ((allocator.getTotalCount() +
+        allocator.getTotalCount(SegletAllocator::COLD)) / segletsPerSegment));
 
     segments = new Tub<LogSegment>[maxSegments];
     states = new State[maxSegments];
@@ -282,7 +284,9 @@ SegmentManager::allocHeadSegment(uint32_t flags)
  *
  * \param flags
  *      If the FOR_CLEANING flag is provided, the allocation will be attempted
- *      from a pool specially reserved for the cleaner. If MUST_NOT_FAIL is
+ *      from a pool specially reserved for the cleaner. If COLD is provided,
+ *      cold storage is tried first (and the survivor inherits the newest
+ *      entry timestamp of ``replacing''). If MUST_NOT_FAIL is
  *      provided, the method will block until a segment is free. Otherwise, it
  *      will return immediately with NULL if no segment is available.
  *
@@ -314,13 +318,18 @@ SegmentManager::allocSideSegment(uint32_t flags, LogSegment* replacing)
             creationTimestamp = replacing->creationTimestamp;
         }
 
-        if (flags & FOR_CLEANING)
+        if (flags & COLD)
+            s = alloc(ALLOC_COLD_SIDELOG, id, creationTimestamp);
+        if (s == NULL && (flags & FOR_CLEANING))
             s = alloc(ALLOC_CLEANER_SIDELOG, id, creationTimestamp);
-        else
+        else if (s == NULL)
             s = alloc(ALLOC_REGULAR_SIDELOG, id, creationTimestamp);
 
-        if (s != NULL)
+        if (s != NULL) {
+            if (replacing != NULL)
+                s->newestEntryTimestamp = replacing->newestEntryTimestamp;
             break;
+        }
 
         if ((flags & MUST_NOT_FAIL) == 0)
             return NULL;
@@ -661,8 +670,11 @@ SegmentManager::getMemoryUtilization()
         FREEABLE_PENDING_REFERENCES
     };
     foreach (State state, freeableStates) {
-        foreach (LogSegment& s, segmentsByState[state])
-            freeSeglets += s.getSegletsAllocated();
+        foreach (LogSegment& s, segmentsByState[state]) {
+            // Cold seglets return to the cold pool, not the default one.
+            if (!s.isCold)
+                freeSeglets += s.getSegletsAllocated();
+        }
     }
 
     return downCast<int>(100 * (totalSeglets - freeSeglets) / totalSeglets);
@@ -971,6 +983,8 @@ SegmentManager::alloc(AllocPurpose purpose,
         type = SegletAllocator::CLEANER;
     else if (purpose == ALLOC_EMERGENCY_HEAD)
         type = SegletAllocator::EMERGENCY_HEAD;
+    else if (purpose == ALLOC_COLD_SIDELOG)
+        type = SegletAllocator::COLD;
 
     if (!allocator.alloc(type, segmentSize / segletSize, seglets)) {
         assert(purpose != ALLOC_EMERGENCY_HEAD);
@@ -979,7 +993,9 @@ SegmentManager::alloc(AllocPurpose purpose,
     }
 
     State state = HEAD;
-    if (purpose == ALLOC_REGULAR_SIDELOG || purpose == ALLOC_CLEANER_SIDELOG)
+    if (purpose == ALLOC_REGULAR_SIDELOG ||
+        purpose == ALLOC_CLEANER_SIDELOG ||
+        purpose == ALLOC_COLD_SIDELOG)
         state = SIDELOG;
 
     segments[slot].construct(seglets,
@@ -988,7 +1004,8 @@ SegmentManager::alloc(AllocPurpose purpose,
                              segmentId,
                              slot,
                              creationTimestamp,
-                             (purpose == ALLOC_EMERGENCY_HEAD));
+                             (purpose == ALLOC_EMERGENCY_HEAD),
+                             (purpose == ALLOC_COLD_SIDELOG));
 
     foreach (Seglet* seglet, seglets)
         allocator.setOwnerSegment(seglet, segments[slot].get());
@@ -1025,6 +1042,7 @@ SegmentManager::allocSlot(AllocPurpose purpose)
         source = &freeEmergencyHeadSlots;
         break;
     case ALLOC_CLEANER_SIDELOG:
+    case ALLOC_COLD_SIDELOG:
         source = &freeSurvivorSlots;
         break;
     }
@@ -105,7 +105,14 @@ class SegmentManager {
         /// The segment being allocated will be used for cleaning. This simply
         /// tells SegmentManager which pool of memory to allocate from. This
         /// flag only makes sense in the allocSideSegment method.
-        FOR_CLEANING = 2
+        FOR_CLEANING = 2,
+
+        /// The segment being allocated will hold data demoted to cold
+        /// storage, so its seglets should come from the cold pool (see
+        /// SegletAllocator). If the cold pool is exhausted, the allocation
+        /// falls back to the pool selected by the other flags. This flag
+        /// only makes sense in the allocSideSegment method.
+        COLD = 4
     };
 
     SegmentManager(Context* context,
@@ -251,7 +258,12 @@ class SegmentManager {
         /// in log cleaning. These segments are allocated from the cleaner pool.
         /// This separate pool ensures that the system does not deadlock itself
         /// by allocating all segments and having nothing left to clean with.
-        ALLOC_CLEANER_SIDELOG
+        ALLOC_CLEANER_SIDELOG,
+
+        /// Allocate a segment for use by a SideLog instance that is demoting
+        /// data to cold storage. These segments take their slots from the
+        /// cleaner's reserve and their seglets from the cold pool.
+        ALLOC_COLD_SIDELOG
     };
 
     LogSegment* alloc(AllocPurpose purpose,
@@ -199,6 +199,44 @@ TEST_F(SegmentManagerTest, allocSideSegment_forCleanerSideLog) {
         segmentManager.allocSideSegment(SegmentManager::FOR_CLEANING));
 }
 
+TEST_F(SegmentManagerTest, allocSideSegment_cold) {
+    TestLog::Enable _(allocFilter);
+
+    // Without cold storage, the allocation falls back to the cleaner's pool.
+    segmentManager.initializeSurvivorReserve(1);
+    LogSegment* s = segmentManager.allocSideSegment(
+        SegmentManager::FOR_CLEANING | SegmentManager::COLD);
+    EXPECT_NE(static_cast<LogSegment*>(NULL), s);
+    EXPECT_EQ("alloc: purpose: 4 | alloc: purpose: 3", TestLog::get());
+    EXPECT_FALSE(s->isCold);
+
+    serverConfig.master.coldStorageFile =
+        format("/tmp/ramcloud-cold-storage-test-%d", getpid());
+    serverConfig.master.coldStorageBytes = 2 * serverConfig.segmentSize;
+    SegletAllocator allocator2(&serverConfig);
+    SegmentManager mgr(&context, &serverConfig, &serverId, allocator2,
+                       replicaManager, &masterTableMetadata);
+    EXPECT_EQ(segmentManager.maxSegments + 2, mgr.maxSegments);
+
+    mgr.initializeSurvivorReserve(1);
+    LogSegment* cold = mgr.allocSideSegment(
+        SegmentManager::FOR_CLEANING | SegmentManager::COLD);
+    ASSERT_NE(static_cast<LogSegment*>(NULL), cold);
+    EXPECT_TRUE(cold->isCold);
+    EXPECT_EQ(SegmentManager::SIDELOG, mgr.states[cold->slot]);
+    EXPECT_EQ(2 * mgr.segletsPerSegment - cold->getSegletsAllocated(),
+              allocator2.getFreeCount(SegletAllocator::COLD));
+
+    // Cold seglets don't count toward memory utilization.
+    // (RS::free() may not be called on an open segment; see free below.)
+    int utilization = mgr.getMemoryUtilization();
+    cold->replicatedSegment = NULL;
+    mgr.free(cold);
+    EXPECT_EQ(utilization, mgr.getMemoryUtilization());
+    EXPECT_EQ(2 * mgr.segletsPerSegment,
+              allocator2.getFreeCount(SegletAllocator::COLD));
+}
+
 static void
 initCleanerSegmentPool(SegmentManager* sm)
 {
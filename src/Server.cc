@@ -90,8 +90,14 @@ Server::run()
     // Only pin down memory _after_ users of LargeBlockOfMemory have
     // obtained their allocations (since LBOM probes are much slower if
     // the memory needs to be pinned during mmap).
+    // A master's cold storage is a mapping of a file that may be larger than
+    // memory; it must not be read in just to be pinned, and is unpinned
+    // again right away so that the OS can evict its pages.
     LOG(NOTICE, "Pinning memory");
-    pinAllMemory();
+    bool coldStorage = master && config.master.coldStorageBytes != 0;
+    pinAllMemory(coldStorage);
+    if (coldStorage)
+        master->objectManager.getSegletAllocator()->unpinColdMemory();
     LOG(NOTICE, "Memory pinned");
 
     // The following statement suppresses a "long gap" message that would
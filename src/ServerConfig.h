@@ -238,6 +238,19 @@ struct ServerConfig {
             , numReplicas(0)
             , useMinCopysets(false)
             , allowLocalBackup(false)
+            , maxWriteRpcsPerReplica(1)
+            , batchBackupWrites(false)
+            , forwardBackupWrites(false)
+            , loadAwareBackupSelection(false)
+            , earlyRecoveryReads(false)
+            , numaNodes(1)
+            , hugePages(false)
+            , compactObjectThreshold(0)
+            , valueDictionaryBytes(0)
+            , coldStorageFile()
+            , coldStorageBytes(0)
+            , erasureDataFragments(0)
+            , erasureParityFragments(0)
         {}
 
         /**
@@ -257,6 +270,19 @@ struct ServerConfig {
             , numReplicas()
             , useMinCopysets()
             , allowLocalBackup()
+            , maxWriteRpcsPerReplica()
+            , batchBackupWrites()
+            , forwardBackupWrites()
+            , loadAwareBackupSelection()
+            , earlyRecoveryReads()
+            , numaNodes(1)
+            , hugePages(false)
+            , compactObjectThreshold(0)
+            , valueDictionaryBytes(0)
+            , coldStorageFile()
+            , coldStorageBytes(0)
+            , erasureDataFragments(0)
+            , erasureParityFragments(0)
         {}
 
         /**
@@ -276,6 +302,19 @@ struct ServerConfig {
             config.set_num_replicas(numReplicas);
             config.set_use_mincopysets(useMinCopysets);
             config.set_use_local_backup(allowLocalBackup);
+            config.set_max_write_rpcs_per_replica(maxWriteRpcsPerReplica);
+            config.set_batch_backup_writes(batchBackupWrites);
+            config.set_forward_backup_writes(forwardBackupWrites);
+            config.set_load_aware_backup_selection(loadAwareBackupSelection);
+            config.set_early_recovery_reads(earlyRecoveryReads);
+            config.set_numa_nodes(numaNodes);
+            config.set_huge_pages(hugePages);
+            config.set_compact_object_threshold(compactObjectThreshold);
+            config.set_value_dictionary_bytes(valueDictionaryBytes);
+            config.set_cold_storage_file(coldStorageFile);
+            config.set_cold_storage_bytes(coldStorageBytes);
+            config.set_erasure_data_fragments(erasureDataFragments);
+            config.set_erasure_parity_fragments(erasureParityFragments);
         }
 
         /**
@@ -296,6 +335,19 @@ struct ServerConfig {
             numReplicas = config.num_replicas();
             useMinCopysets = config.use_mincopysets();
             allowLocalBackup = config.use_local_backup();
+            maxWriteRpcsPerReplica = config.max_write_rpcs_per_replica();
+            batchBackupWrites = config.batch_backup_writes();
+            forwardBackupWrites = config.forward_backup_writes();
+            loadAwareBackupSelection = config.load_aware_backup_selection();
+            earlyRecoveryReads = config.early_recovery_reads();
+            numaNodes = config.numa_nodes();
+            hugePages = config.huge_pages();
+            compactObjectThreshold = config.compact_object_threshold();
+            valueDictionaryBytes = config.value_dictionary_bytes();
+            coldStorageFile = config.cold_storage_file();
+            coldStorageBytes = config.cold_storage_bytes();
+            erasureDataFragments = config.erasure_data_fragments();
+            erasureParityFragments = config.erasure_parity_fragments();
         }
 
         /// Total number bytes to use for the in-memory Log.
@@ -339,6 +391,68 @@ struct ServerConfig {
 
         /// If true, allow replication to local backup.
         bool allowLocalBackup;
+
+        /// Maximum number of write rpcs outstanding at once for each
+        /// replica of a segment.
+        uint32_t maxWriteRpcsPerReplica;
+
+        /// If true, combine replica writes for different segments headed
+        /// to the same backup into a single rpc.
+        bool batchBackupWrites;
+
+        /// If true, send each write to the primary replica's backup only,
+        /// and have that backup forward it to the secondary replicas.
+        bool forwardBackupWrites;
+
+        /// If true, steer replicas toward backups with the fewest writes
+        /// outstanding (see LoadAwareBackupSelector). Ignored if
+        /// useMinCopysets is set.
+        bool loadAwareBackupSelection;
+
+        /// If true, when this master recovers a partition of a crashed
+        /// master it serves reads for the partition's tablets as soon as
+        /// it has replayed them, rather than waiting until the recovered
+        /// data is durable and the coordinator has handed over the tablets.
+        bool earlyRecoveryReads;
+
+        /// Number of NUMA nodes to spread the log's memory across (see
+        /// SegletAllocator). 1 means memory placement is left to the
+        /// kernel.
+        uint32_t numaNodes;
+
+        /// If true, back the log and the hash table with huge pages (see
+        /// LargeBlockOfMemory), which greatly reduces TLB misses on large
+        /// masters. No hugetlbfs mount is needed.
+        bool hugePages;
+
+        /// Objects whose keys and value total at most this many bytes are
+        /// written to the log with a compact header (see Object). 0 means
+        /// all objects use the full header.
+        uint32_t compactObjectThreshold;
+
+        /// If nonzero, compress object values with a dictionary of (up to)
+        /// this many bytes per table (see ValueCompressor). 0 disables
+        /// compression.
+        uint32_t valueDictionaryBytes;
+
+        /// If coldStorageBytes is nonzero, path of a file (which must not
+        /// already exist, and is removed once mapped) on local flash that
+        /// holds the log segments demoted from memory by the cleaner (see
+        /// SegletAllocator).
+        string coldStorageFile;
+
+        /// Size of coldStorageFile in bytes. 0 means all log segments are
+        /// kept in memory.
+        uint64_t coldStorageBytes;
+
+        /// If nonzero, closed segments are stored on backups as this many
+        /// data fragments plus erasureParityFragments parity fragments
+        /// (Reed-Solomon coded) rather than as numReplicas full replicas.
+        uint32_t erasureDataFragments;
+
+        /// Number of parity fragments for each closed segment; see
+        /// erasureDataFragments.
+        uint32_t erasureParityFragments;
     } master;
 
     /**
@@ -361,6 +475,7 @@ struct ServerConfig {
             , strategy(1)
             , mockSpeed(100)
             , writeRateLimit(0)
+            , compressReplicas(false)
         {}
 
         /**
@@ -379,6 +494,7 @@ struct ServerConfig {
             , strategy(1)
             , mockSpeed(0)
             , writeRateLimit(0)
+            , compressReplicas(false)
         {}
 
         /**
@@ -397,6 +513,7 @@ struct ServerConfig {
             config.set_strategy(strategy);
             config.set_mock_speed(mockSpeed);
             config.set_write_rate_limit(writeRateLimit);
+            config.set_compress_replicas(compressReplicas);
         }
 
         /**
@@ -416,6 +533,7 @@ struct ServerConfig {
             strategy = config.strategy();
             mockSpeed = config.mock_speed();
             writeRateLimit = config.write_rate_limit();
+            compressReplicas = config.compress_replicas();
         }
 
         /**
@@ -481,6 +599,14 @@ struct ServerConfig {
          * If non-0, limit writes to backup to this many megabytes per second.
          */
         size_t writeRateLimit;
+
+        /**
+         * If true, closed replicas are compressed before being written to
+         * storage, trading CPU time for disk bandwidth (and time) during
+         * recovery. Unless #sync is set, replicas aren't written until they
+         * are closed. See MultiFileStorage::compressReplicas.
+         */
+        bool compressReplicas;
     } backup;
 
   public:
@@ -27,8 +27,12 @@
 #include "OptionParser.h"
 #include "PortAlarm.h"
 #include "Server.h"
+#include "PerfEventCounters.h"
 #include "PerfStats.h"
+#include "PerfStatsExporter.h"
 #include "ShortMacros.h"
+#include "SlowRpcLog.h"
+#include "TimeTrace.h"
 #include "TransportManager.h"
 #include "WorkerTimer.h"
 
@@ -100,6 +104,12 @@ main(int argc, char *argv[])
     try {
         ServerConfig config = ServerConfig::forExecution();
         string masterTotalMemory, hashTableMemory;
+        uint64_t coldStorageMB;
+        string perfStatsExport;
+        double perfStatsExportInterval;
+        uint32_t timeTraceSampleInterval;
+        uint32_t slowRpcThreshold;
+        bool opcodeHardwareCounters;
 
         bool masterOnly;
         bool backupOnly;
@@ -127,6 +137,10 @@ main(int argc, char *argv[])
              "of bandwidth this backup should use. Useful for artificially "
              "restricting bandwidth when measuring various parts of the "
              "system.")
+            ("batchBackupWrites",
+             ProgramOptions::bool_switch(&config.master.batchBackupWrites),
+             "Combine replica writes for different segments that are headed "
+             "to the same backup into a single rpc")
             ("cleanerBalancer",
              ProgramOptions::value<string>(&config.master.cleanerBalancer)->
                 default_value("tombstoneRatio:0.40"),
@@ -136,6 +150,32 @@ main(int argc, char *argv[])
              "default value. Currently the only other option is \"fixed:X\", "
              "where 0 <= X <= 100 represents the percentage of CPU time the "
              "disk cleaner will be limited to (the rest is for compaction).")
+            ("coldStorageFile",
+             ProgramOptions::value<string>(&config.master.coldStorageFile)->
+                default_value(""),
+             "File on local flash (which must not already exist) to hold log "
+             "segments the cleaner demotes from memory; see --coldStorageMB")
+            ("coldStorageMB",
+             ProgramOptions::value<uint64_t>(&coldStorageMB)->
+                default_value(0),
+             "Megabytes of --coldStorageFile to use. When memory runs low, "
+             "the cleaner moves the segments holding the oldest objects there "
+             "instead of keeping everything in memory; reads of those objects "
+             "wait for flash. 0 keeps all objects in memory")
+            ("compactObjectThreshold",
+             ProgramOptions::value<uint32_t>(
+               &config.master.compactObjectThreshold)->default_value(0),
+             "Write objects whose keys and value total at most this many "
+             "bytes with a compact log header (varint version and table id), "
+             "saving 12 or more bytes per object. 0 disables compact headers. "
+             "Clients older than this option can't parse enumerated objects "
+             "that use them.")
+            ("compressBackupReplicas",
+             ProgramOptions::bool_switch(&config.backup.compressReplicas),
+             "Compress closed replicas (with LZ4) before writing them to "
+             "backup storage, trading CPU time for disk bandwidth during "
+             "recovery. Unless --sync is given, replicas are held in memory "
+             "until they are closed.")
             ("detectFailures",
              ProgramOptions::value<bool>(&config.detectFailures)->
                 default_value(true),
@@ -158,21 +198,61 @@ main(int argc, char *argv[])
              "the master has memory for 100 full segments and the expansion "
              "factor is 2.0, it will place up to 200 segments (each replicated "
              "R times) on backups.")
+            ("earlyRecoveryReads",
+             ProgramOptions::bool_switch(&config.master.earlyRecoveryReads),
+             "When recovering a partition of a crashed master, serve reads "
+             "for its tablets as soon as all of their data has been replayed, "
+             "while the recovered data is still being made durable; writes "
+             "wait until recovery of the partition completes")
+            ("erasureDataFragments",
+             ProgramOptions::value<uint32_t>(
+                &config.master.erasureDataFragments)->default_value(0),
+             "If nonzero, once a segment is closed replace its replicas on "
+             "backups with this many data fragments plus "
+             "--erasureParityFragments parity fragments, each on a different "
+             "backup; recovery rebuilds the segment from any "
+             "erasureDataFragments of them. Needs at least replicas + "
+             "data + parity fragments backups while a segment is encoded")
+            ("erasureParityFragments",
+             ProgramOptions::value<uint32_t>(
+                &config.master.erasureParityFragments)->default_value(2),
+             "Number of parity fragments per closed segment; see "
+             "--erasureDataFragments")
             ("file,f",
              ProgramOptions::value<string>(&config.backup.file)->
                 default_value("/var/tmp/backup.log"),
              "The file path to the backup storage.")
+            ("forwardBackupWrites",
+             ProgramOptions::bool_switch(&config.master.forwardBackupWrites),
+             "Send replica writes only to the backup storing the primary "
+             "replica, which forwards them to the secondary replicas; this "
+             "cuts the master's outgoing replication bandwidth by the number "
+             "of replicas")
             ("hashTableMemory,h",
              ProgramOptions::value<string>(&hashTableMemory)->
                 default_value("10%"),
              "Percentage or megabytes of master memory allocated to "
              "the hash table")
+            ("hugePages",
+             ProgramOptions::bool_switch(&config.master.hugePages),
+             "Back the log and hash table with huge pages: 1 GB or 2 MB pages "
+             "from the kernel's hugetlb pool if it has enough, otherwise "
+             "transparent huge pages (if enabled). The page sizes obtained "
+             "are reported in the server's PerfStats; DTLB misses are only "
+             "counted with --opcodeHardwareCounters")
             ("logCleanerThreads",
              ProgramOptions::value<uint32_t>(
                 &config.master.cleanerThreadCount)->default_value(1),
              "The number of cleaner threads controls the amount of parallelism "
              "in the cleaner. More threads will use more cores, but may be "
              "able to better keep up with high write rates.")
+            ("loadAwareBackupSelection",
+             ProgramOptions::bool_switch(
+                &config.master.loadAwareBackupSelection),
+             "Place replicas on the backups with the least replication data "
+             "outstanding (relative to their disk bandwidth) among a few "
+             "random candidates, rather than purely at random; ignored with "
+             "--useMinCopysets")
             ("masterOnly,M",
              ProgramOptions::bool_switch(&masterOnly),
              "The server should run the master service only (no backup)")
@@ -192,11 +272,44 @@ main(int argc, char *argv[])
              "value 0 is special: it tells the server to set the "
              "limit equal to the \"segmentFrames\" value, effectively making "
              "buffering unlimited.")
+            ("maxWriteRpcsPerReplica",
+             ProgramOptions::value<uint32_t>(
+               &config.master.maxWriteRpcsPerReplica)->default_value(4),
+             "Maximum number of write rpcs outstanding at once to each backup "
+             "holding a replica of a segment (at most 4). Values greater "
+             "than 1 let large amounts of queued data replicate without "
+             "waiting a round trip per write.")
             ("maxRecoveryReplicas",
              ProgramOptions::value<uint32_t>(
                &config.backup.maxRecoveryReplicas)->default_value(20),
              "Maximum number of replicas any given master recovery will buffer "
              "in memory.")
+            ("numaNodes",
+             ProgramOptions::value<uint32_t>(
+               &config.master.numaNodes)->default_value(1),
+             "Number of NUMA nodes to divide the log's memory among. If "
+             "greater than 1, each node's share is bound to that node, new "
+             "head segments are allocated from the node of the thread "
+             "creating them, and log cleaner threads are spread across the "
+             "nodes")
+            ("opcodeHardwareCounters",
+             ProgramOptions::bool_switch(&opcodeHardwareCounters),
+             "Count CPU cycles, instructions, last-level cache misses and "
+             "DTLB misses separately for each opcode, using per-thread "
+             "hardware counters; the totals are returned with GET_PERF_STATS "
+             "and shown by PerfStats::printClusterStats")
+            ("perfStatsExport",
+             ProgramOptions::value<string>(&perfStatsExport)->
+                default_value(""),
+             "Periodically write the changes in this server's performance "
+             "counters and per-opcode latency histograms, as lines of JSON, "
+             "to this file, or to a Unix domain datagram socket if given as "
+             "unix:<path>; see --perfStatsExportInterval")
+            ("perfStatsExportInterval",
+             ProgramOptions::value<double>(&perfStatsExportInterval)->
+                default_value(1.0),
+             "Seconds between exports of performance statistics to "
+             "--perfStatsExport")
             ("preferredIndex",
              ProgramOptions::value<uint32_t>(
                 &config.preferredIndex)->default_value(0),
@@ -215,10 +328,22 @@ main(int argc, char *argv[])
              "2NR/8M (gives the backup 2NR bytes of space); any value lower "
              "than this may cause the cluster to eventually fail to service "
              "write requests.")
+            ("slowRpcThreshold",
+             ProgramOptions::value<uint32_t>(&slowRpcThreshold)->
+                default_value(0),
+             "If nonzero, keep a breakdown of where the time went for recent "
+             "RPCs that take at least this many microseconds in the server "
+             "(see the GET_SLOW_RPCS server control)")
             ("sync",
              ProgramOptions::bool_switch(&config.backup.sync),
              "Make all updates completely synchronous all the way down to "
              "stable storage.")
+            ("timeTraceSampleInterval",
+             ProgramOptions::value<uint32_t>(&timeTraceSampleInterval)->
+                default_value(0),
+             "If nonzero, trace about one in this many incoming RPCs from "
+             "dispatch through log append, replication and reply, on this "
+             "server and on the servers it calls (0 means don't sample)")
             ("totalMasterMemory,t",
 
              // Note: we have tried changing the default value below to
@@ -235,6 +360,13 @@ main(int argc, char *argv[])
              ProgramOptions::value<bool>(&config.master.useMinCopysets)->
                 default_value(false),
              "Whether to use MinCopysets or random replication")
+            ("valueDictionaryBytes",
+             ProgramOptions::value<uint32_t>(
+               &config.master.valueDictionaryBytes)->default_value(0),
+             "Compress object values with LZ4, using a dictionary of this "
+             "many bytes (at most 65536) sampled from each table's values. "
+             "Helps most for small values that resemble each other. "
+             "0 disables compression.")
             ("writeCostThreshold,w",
              ProgramOptions::value<uint32_t>(
                 &config.master.cleanerWriteCostThreshold)->default_value(8),
@@ -327,6 +459,7 @@ main(int argc, char *argv[])
         if (!backupOnly) {
             LOG(NOTICE, "Using %u backups", config.master.numReplicas);
             config.setLogAndHashTableSize(masterTotalMemory, hashTableMemory);
+            config.master.coldStorageBytes = coldStorageMB * 1024 * 1024;
         }
 
         // Set PortTimeout and start portTimer
@@ -337,6 +470,17 @@ main(int argc, char *argv[])
         // Uncomment the following line to enable regular performance logging.
         // StatsLogger logger(context.dispatch, 1.0);
         MemoryMonitor monitor(context.dispatch, 1.0, 100);
+        Tub<PerfStatsExporter> exporter;
+        if (!perfStatsExport.empty()) {
+            exporter.construct(context.dispatch, perfStatsExport,
+                    perfStatsExportInterval);
+        }
+
+        TimeTrace::setSampleInterval(timeTraceSampleInterval);
+        SlowRpcLog::setThreshold(slowRpcThreshold);
+        if (opcodeHardwareCounters) {
+            PerfEventCounters::enable();
+        }
 
         Server server(&context, &config);
         server.run(); // Never returns except for exceptions.
@@ -14,6 +14,7 @@
  */
 
 #include "Cycles.h"
+#include "PerfStats.h"
 #include "RawMetrics.h"
 #include "RpcLevel.h"
 #include "Service.h"
@@ -181,7 +182,9 @@ Service::handleRpc(Context* context, Rpc* rpc) {
     // but it just wastes time.
     RpcLevel::setCurrentOpcode(RpcLevel::NO_RPC);
 #endif
-    (&metrics->rpc.rpc0Ticks)[opcode] += Cycles::rdtsc() - start;
+    uint64_t ticks = Cycles::rdtsc() - start;
+    (&metrics->rpc.rpc0Ticks)[opcode] += ticks;
+    PerfStats::recordServiceTime(opcode, ticks);
 }
 
 /**
@@ -0,0 +1,439 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any purpose
+ * with or without fee is hereby granted, provided that the above copyright
+ * notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER
+ * RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF
+ * CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "Common.h"
+#include "Fence.h"
+#include "PerfStats.h"
+#include "ServiceLocator.h"
+#include "ShortMacros.h"
+#include "SharedMemoryDriver.h"
+
+namespace RAMCloud {
+
+/**
+ * Default object used to make system calls.
+ */
+static Syscall defaultSyscall;
+
+/**
+ * Used by this class to make all system calls.  In normal production
+ * use it points to defaultSyscall; for testing it points to a mock
+ * object.
+ */
+Syscall* SharedMemoryDriver::sys = &defaultSyscall;
+
+/**
+ * Returns the name of this machine, which is included in locators so that
+ * clients on other machines won't try to attach.
+ */
+static string
+localHostName()
+{
+    char name[HOST_NAME_MAX + 1];
+    if (gethostname(name, sizeof(name)) != 0) {
+        throw DriverException(HERE, "gethostname failed", errno);
+    }
+    name[HOST_NAME_MAX] = 0;
+    return name;
+}
+
+/**
+ * Construct a SharedMemoryDriver.
+ *
+ * \param context
+ *      Overall information about the RAMCloud server or client.
+ * \param localServiceLocator
+ *      If non-NULL, this driver will accept packets from clients on the
+ *      same machine, so it creates a shared memory region for them to
+ *      attach to; the locator needs no options (the driver generates its
+ *      own locator, which identifies the region). If NULL, the driver can
+ *      only be used to communicate with servers.
+ *
+ * \throw DriverException
+ *      The shared memory region couldn't be created.
+ */
+SharedMemoryDriver::SharedMemoryDriver(Context* context,
+        const ServiceLocator* localServiceLocator)
+    : context(context)
+    , locatorString()
+    , regionFd(-1)
+    , region(NULL)
+    , channelAddresses()
+    , channelGenerations()
+    , connections()
+    , connectionList()
+    , numConnections(0)
+    , packetBufPool()
+    , mutex("SharedMemoryDriver")
+    , packetsDropped(0)
+{
+    if (localServiceLocator == NULL) {
+        return;
+    }
+
+    int fd = sys->memfdCreate("ramcloud-shm", 0);
+    if (fd < 0) {
+        throw DriverException(HERE, "SharedMemoryDriver couldn't create "
+                "shared memory region", errno);
+    }
+    if (sys->ftruncate(fd, sizeof(Region)) != 0) {
+        int e = errno;
+        sys->close(fd);
+        throw DriverException(HERE, "SharedMemoryDriver couldn't size "
+                "shared memory region", e);
+    }
+    void* base = sys->mmap(NULL, sizeof(Region), PROT_READ|PROT_WRITE,
+            MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        int e = errno;
+        sys->close(fd);
+        throw DriverException(HERE, "SharedMemoryDriver couldn't map "
+                "shared memory region", e);
+    }
+
+    // The memfd starts out zero-filled, so all of the channels are FREE
+    // and all of the rings are empty; all that's left is to fill in the
+    // header (magic goes last, so clients never see a partial header).
+    region = static_cast<Region*>(base);
+    region->numChannels = NUM_CHANNELS;
+    Fence::leave();
+    region->magic = REGION_MAGIC;
+    regionFd = fd;
+
+    locatorString = format("shm:host=%s,pid=%d,fd=%d",
+            localHostName().c_str(), getpid(), fd);
+    for (uint32_t i = 0; i < NUM_CHANNELS; i++) {
+        channelAddresses.push_back(new SharedMemoryAddress(
+                &region->channels[i].toClient, format("shm client %u", i)));
+        channelGenerations.push_back(0);
+    }
+    LOG(NOTICE, "Locator for SharedMemoryDriver: %s", locatorString.c_str());
+}
+
+/**
+ * Destroy a SharedMemoryDriver: release our channels in other servers'
+ * regions and unmap all shared memory.
+ */
+SharedMemoryDriver::~SharedMemoryDriver()
+{
+    for (uint32_t i = 0; i < numConnections.load(); i++) {
+        Connection* connection = connectionList[i];
+        connection->channel->state = FREE;
+        sys->munmap(connection->region, sizeof(Region));
+        delete connection;
+    }
+    foreach (SharedMemoryAddress* address, channelAddresses) {
+        delete address;
+    }
+    if (region != NULL) {
+        sys->munmap(region, sizeof(Region));
+    }
+    if (regionFd >= 0) {
+        sys->close(regionFd);
+    }
+}
+
+/**
+ * Find an unused channel in a server's region and take ownership of it.
+ *
+ * \param region
+ *      The server's region.
+ * \return
+ *      The channel that was claimed, or NULL if all channels are in use.
+ */
+SharedMemoryDriver::Channel*
+SharedMemoryDriver::claimChannel(Region* region)
+{
+    // Two passes: the first looks for free channels; the second reclaims
+    // channels belonging to clients that exited without releasing them.
+    for (int pass = 0; pass < 2; pass++) {
+        for (uint32_t i = 0; i < NUM_CHANNELS; i++) {
+            Channel* channel = &region->channels[i];
+            if (pass == 1) {
+                int32_t pid = channel->clientPid.load();
+                if ((channel->state.load() != IN_USE) || (pid == 0) ||
+                        (sys->kill(pid, 0) == 0) || (errno != ESRCH)) {
+                    continue;
+                }
+                LOG(NOTICE, "Reclaiming shared memory channel %u from "
+                        "defunct process %d", i, pid);
+                channel->state.compareExchange(IN_USE, FREE);
+            }
+            if (channel->state.compareExchange(FREE, IN_USE) != FREE) {
+                continue;
+            }
+            channel->clientPid = getpid();
+
+            // Discard any replies left over from a previous owner (we're
+            // now the only consumer of toClient). Requests that a previous
+            // owner left in toServer can only be discarded by the server,
+            // which consumes that ring: tell it where ours will start.
+            channel->toClient.tail = channel->toClient.head.load();
+            channel->firstPacket = channel->toServer.head.load();
+            Fence::leave();
+            channel->generation.inc();
+            Fence::leave();
+            return channel;
+        }
+    }
+    return NULL;
+}
+
+// See docs in Driver class.
+uint32_t
+SharedMemoryDriver::getMaxPacketSize()
+{
+    return MAX_PACKET_SIZE;
+}
+
+// See docs in Driver class.
+int
+SharedMemoryDriver::getTransmitQueueSpace(uint64_t currentTime)
+{
+    // Packets are handed to the receiver immediately, so there is never
+    // an output queue; however, limit the transport to about half of a
+    // ring's worth of data at a time to reduce the likelihood of drops.
+    return (RING_SLOTS/2) * MAX_PACKET_SIZE;
+}
+
+/**
+ * Return an Address for a server whose service locator was produced by
+ * another SharedMemoryDriver on this machine; attach to the server's
+ * region if we haven't done so already.
+ *
+ * \param serviceLocator
+ *      Must contain host, pid, and fd options.
+ *
+ * \throw DriverException
+ *      The server isn't on this machine, or its region couldn't be
+ *      attached (e.g. because the server has exited, or all of its
+ *      channels are in use).
+ */
+Driver::Address*
+SharedMemoryDriver::newAddress(const ServiceLocator* serviceLocator)
+{
+    string host = serviceLocator->getOption<string>("host");
+    int32_t pid = serviceLocator->getOption<int32_t>("pid");
+    int fd = serviceLocator->getOption<int>("fd");
+    if (host != localHostName()) {
+        throw DriverException(HERE, format("SharedMemoryDriver can't reach "
+                "host %s from this machine", host.c_str()));
+    }
+
+    SpinLock::Guard guard(mutex);
+    int64_t key = (static_cast<int64_t>(pid) << 32) | fd;
+    auto it = connections.find(key);
+    if (it != connections.end()) {
+        return new SharedMemoryAddress(it->second->address);
+    }
+    if (numConnections.load() >= MAX_CONNECTIONS) {
+        throw DriverException(HERE, "SharedMemoryDriver has too many "
+                "connections");
+    }
+
+    // Attach to the server's region.
+    string path = format("/proc/%d/fd/%d", pid, fd);
+    int regionFd = sys->open(path.c_str(), O_RDWR);
+    if (regionFd < 0) {
+        throw DriverException(HERE, format("SharedMemoryDriver couldn't "
+                "open %s", path.c_str()), errno);
+    }
+    struct stat status;
+    if ((fstat(regionFd, &status) != 0) ||
+            (status.st_size < static_cast<off_t>(sizeof(Region)))) {
+        sys->close(regionFd);
+        throw DriverException(HERE, format("SharedMemoryDriver found no "
+                "shared memory region at %s", path.c_str()));
+    }
+    void* base = sys->mmap(NULL, sizeof(Region), PROT_READ|PROT_WRITE,
+            MAP_SHARED, regionFd, 0);
+    int e = errno;
+    sys->close(regionFd);
+    if (base == MAP_FAILED) {
+        throw DriverException(HERE, format("SharedMemoryDriver couldn't "
+                "map %s", path.c_str()), e);
+    }
+    Region* serverRegion = static_cast<Region*>(base);
+    if ((serverRegion->magic != REGION_MAGIC) ||
+            (serverRegion->numChannels != NUM_CHANNELS)) {
+        sys->munmap(base, sizeof(Region));
+        throw DriverException(HERE, format("SharedMemoryDriver found no "
+                "shared memory region at %s", path.c_str()));
+    }
+    Channel* channel = claimChannel(serverRegion);
+    if (channel == NULL) {
+        sys->munmap(base, sizeof(Region));
+        throw DriverException(HERE, format("SharedMemoryDriver: all "
+                "channels in use at %s", path.c_str()));
+    }
+
+    Connection* connection = new Connection(serverRegion, channel,
+            serviceLocator->getOriginalString());
+    connections[key] = connection;
+    connectionList[numConnections.load()] = connection;
+    Fence::leave();
+    numConnections.inc();
+    return new SharedMemoryAddress(connection->address);
+}
+
+/**
+ * Remove packets from a ring and add them to a vector of received packets.
+ *
+ * \param ring
+ *      Incoming ring to check (we must be its consumer).
+ * \param sender
+ *      Address to record as the source of each packet.
+ * \param maxPackets
+ *      Maximum number of packets to remove.
+ * \param receivedPackets
+ *      Packets are appended here.
+ * \return
+ *      The number of packets removed from the ring.
+ */
+uint32_t
+SharedMemoryDriver::pollRing(Ring* ring, const Address* sender,
+        uint32_t maxPackets, std::vector<Received>* receivedPackets)
+{
+    uint32_t tail = ring->tail.load();
+    uint32_t available = ring->head.load() - tail;
+    if (available == 0) {
+        return 0;
+    }
+    if (available > maxPackets) {
+        available = maxPackets;
+    }
+    Fence::enter();
+    for (uint32_t i = 0; i < available; i++) {
+        Slot* slot = &ring->slots[(tail + i) % RING_SLOTS];
+        uint32_t length = slot->length;
+        if (length > MAX_PACKET_SIZE) {
+            // Shouldn't happen unless the other process is misbehaving.
+            length = MAX_PACKET_SIZE;
+        }
+        PacketBuf* buffer;
+        {
+            SpinLock::Guard guard(mutex);
+            buffer = packetBufPool.construct();
+        }
+        memcpy(buffer->payload, slot->data, length);
+        receivedPackets->emplace_back(sender, this, length, buffer->payload);
+    }
+    Fence::leave();
+    ring->tail = tail + available;
+    return available;
+}
+
+// See docs in Driver class.
+void
+SharedMemoryDriver::receivePackets(uint32_t maxPackets,
+        std::vector<Received>* receivedPackets)
+{
+    uint32_t received = 0;
+    if (region != NULL) {
+        for (uint32_t i = 0; (i < NUM_CHANNELS) && (received < maxPackets);
+                i++) {
+            Channel* channel = &region->channels[i];
+            if (channel->state.load() != IN_USE) {
+                continue;
+            }
+            uint32_t generation = channel->generation.load();
+            if (generation != channelGenerations[i]) {
+                // The channel has a new owner. Drop anything the previous
+                // owner (which may have exited) left in toServer, rather
+                // than delivering it as if the new client had sent it.
+                Fence::enter();
+                uint32_t firstPacket = channel->firstPacket.load();
+                if (static_cast<int32_t>(firstPacket
+                        - channel->toServer.tail.load()) > 0) {
+                    channel->toServer.tail = firstPacket;
+                }
+                channelGenerations[i] = generation;
+            }
+            received += pollRing(&channel->toServer, channelAddresses[i],
+                    maxPackets - received, receivedPackets);
+        }
+    }
+    uint32_t count = numConnections.load();
+    Fence::enter();
+    for (uint32_t i = 0; (i < count) && (received < maxPackets); i++) {
+        Connection* connection = connectionList[i];
+        received += pollRing(&connection->channel->toClient,
+                &connection->address, maxPackets - received,
+                receivedPackets);
+    }
+}
+
+// See docs in Driver class.
+void
+SharedMemoryDriver::release(char *payload)
+{
+    SpinLock::Guard guard(mutex);
+    packetBufPool.destroy(reinterpret_cast<PacketBuf*>(payload));
+}
+
+// See docs in Driver class.
+void
+SharedMemoryDriver::sendPacket(const Address* addr,
+                               const void* header,
+                               uint32_t headerLen,
+                               Buffer::Iterator* payload,
+                               int priority)
+{
+    Ring* ring = static_cast<const SharedMemoryAddress*>(addr)->ring;
+    uint32_t head = ring->head.load();
+    if ((head - ring->tail.load()) >= RING_SLOTS) {
+        // The receiver isn't keeping up; drop the packet and let the
+        // transport retransmit.
+        packetsDropped++;
+        RAMCLOUD_CLOG(NOTICE, "SharedMemoryDriver dropping packet to %s: "
+                "ring full (%lu packets dropped so far)",
+                addr->toString().c_str(), packetsDropped);
+        return;
+    }
+
+    Slot* slot = &ring->slots[head % RING_SLOTS];
+    memcpy(slot->data, header, headerLen);
+    uint32_t length = headerLen;
+    while (payload && !payload->isDone()) {
+        memcpy(slot->data + length, payload->getData(),
+                payload->getLength());
+        length += payload->getLength();
+        payload->next();
+    }
+    assert(length <= MAX_PACKET_SIZE);
+    slot->length = length;
+
+    // Make sure the packet is completely in memory before the receiver
+    // can see it.
+    Fence::leave();
+    ring->head = head + 1;
+    PerfStats::threadStats.networkOutputPackets++;
+    PerfStats::threadStats.networkOutputBytes += length;
+}
+
+// See docs in Driver class.
+string
+SharedMemoryDriver::getServiceLocator()
+{
+    return locatorString;
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,288 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_SHAREDMEMORYDRIVER_H
+#define RAMCLOUD_SHAREDMEMORYDRIVER_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "Atomic.h"
+#include "Driver.h"
+#include "ObjectPool.h"
+#include "SpinLock.h"
+#include "Syscall.h"
+
+namespace RAMCloud {
+
+/**
+ * A Driver that passes packets between processes on the same machine
+ * through shared memory, without involving the kernel or a NIC.
+ *
+ * A server-side driver (one constructed with a service locator) creates a
+ * memfd region containing a fixed number of channels; each channel holds a
+ * pair of single-producer single-consumer packet rings, one in each
+ * direction. A client attaches to the region by opening the server's memfd
+ * through /proc (the server's locator contains its host name, pid, and the
+ * descriptor number) and claims a free channel; after that, packets move
+ * between the two processes with nothing more than memory copies and a
+ * couple of cache-line transfers. Both sides poll their incoming rings from
+ * the dispatch thread.
+ *
+ * Rings have limited space, so packets are dropped if the receiver falls
+ * behind; the transport (BasicTransport) recovers with retransmissions,
+ * just as for a lossy network.
+ */
+class SharedMemoryDriver : public Driver {
+  public:
+    /// The largest packet (header plus payload) that can be sent through
+    /// a ring; chosen so that a ring slot fills exactly 2 pages.
+    static const uint32_t MAX_PACKET_SIZE = 8128;
+
+    /// Number of packets each ring can hold.
+    static const uint32_t RING_SLOTS = 64;
+
+    /// Number of channels in a server's region: this is the most clients
+    /// that can be attached at once.
+    static const uint32_t NUM_CHANNELS = 32;
+
+    /// Maximum number of other servers that one driver can attach to.
+    static const uint32_t MAX_CONNECTIONS = 64;
+
+    explicit SharedMemoryDriver(Context* context,
+            const ServiceLocator* localServiceLocator = NULL);
+    virtual ~SharedMemoryDriver();
+    virtual uint32_t getMaxPacketSize();
+    virtual int getTransmitQueueSpace(uint64_t currentTime);
+    virtual Address* newAddress(const ServiceLocator* serviceLocator);
+    virtual void receivePackets(uint32_t maxPackets,
+            std::vector<Received>* receivedPackets);
+    virtual void release(char *payload);
+    virtual void sendPacket(const Address* addr,
+                            const void* header,
+                            uint32_t headerLen,
+                            Buffer::Iterator* payload,
+                            int priority = 0);
+    virtual string getServiceLocator();
+
+  PROTECTED:
+    /**
+     * Holds one packet in a Ring.
+     */
+    struct Slot {
+        /// Number of valid bytes in data.
+        uint32_t length;
+
+        /// Pads the header of the slot to a full cache line.
+        char pad[60];
+
+        /// Packet contents.
+        char data[MAX_PACKET_SIZE];
+    };
+
+    /**
+     * A single-producer single-consumer queue of packets, stored in shared
+     * memory. Head and tail are free-running counters; their difference is
+     * the number of packets in the ring.
+     */
+    struct Ring {
+        /// Index of the next slot the producer will fill. Written only by
+        /// the producer.
+        Atomic<uint32_t> head;
+        char pad1[60];
+
+        /// Index of the next slot the consumer will read. Written only by
+        /// the consumer (the separate cache line keeps the two sides from
+        /// interfering with each other).
+        Atomic<uint32_t> tail;
+        char pad2[60];
+
+        Slot slots[RING_SLOTS];
+    };
+
+    /**
+     * Connects one client to a server.
+     */
+    struct Channel {
+        /// FREE or IN_USE; clients claim channels by changing this from
+        /// FREE to IN_USE with an atomic compare-and-swap.
+        Atomic<uint32_t> state;
+
+        /// Process id of the client that owns this channel; used to
+        /// reclaim channels from clients that exit without releasing them.
+        Atomic<int32_t> clientPid;
+
+        /// Incremented by each client that claims the channel, so that the
+        /// server can tell when packets left in toServer by a previous
+        /// owner must be discarded.
+        Atomic<uint32_t> generation;
+
+        /// Value of toServer.head when the current owner claimed the
+        /// channel: packets before this one came from a previous owner.
+        Atomic<uint32_t> firstPacket;
+        char pad[48];
+
+        /// Packets from the client to the server.
+        Ring toServer;
+
+        /// Packets from the server to the client.
+        Ring toClient;
+    };
+
+    /// Values for Channel::state.
+    enum { FREE = 0, IN_USE = 1 };
+
+    /**
+     * The layout of a server's shared memory region.
+     */
+    struct Region {
+        /// Must be REGION_MAGIC; used to make sure a client has attached
+        /// to the right thing.
+        uint64_t magic;
+
+        /// Must equal NUM_CHANNELS (protects against clients built with
+        /// a different configuration).
+        uint32_t numChannels;
+        char pad[52];
+
+        Channel channels[NUM_CHANNELS];
+    };
+
+    /// Value for Region::magic.
+    static const uint64_t REGION_MAGIC = 0x52414d436c536d31UL;
+
+    /**
+     * Identifies the ring on which packets for a particular destination
+     * should be placed.
+     */
+    class SharedMemoryAddress : public Driver::Address {
+      public:
+        SharedMemoryAddress(Ring* ring, const string& name)
+            : Address()
+            , ring(ring)
+            , name(name)
+        {}
+        SharedMemoryAddress(const SharedMemoryAddress& other)
+            : Address(other)
+            , ring(other.ring)
+            , name(other.name)
+        {}
+        virtual string toString() const {
+            return name;
+        }
+
+        /// Outgoing packets are placed here.
+        Ring* ring;
+
+        /// Human-readable description of the destination.
+        string name;
+
+      private:
+        void operator=(SharedMemoryAddress&);
+    };
+
+    /**
+     * Describes this driver's attachment to another server's region,
+     * through which it sends requests as a client.
+     */
+    struct Connection {
+        Connection(Region* region, Channel* channel, const string& name)
+            : region(region)
+            , channel(channel)
+            , address(&channel->toServer, name)
+        {}
+
+        /// The server's region, mapped into our address space.
+        Region* region;
+
+        /// The channel we own in region.
+        Channel* channel;
+
+        /// Identifies the server as the sender of packets that arrive on
+        /// channel->toClient, and is copied by newAddress.
+        SharedMemoryAddress address;
+
+        DISALLOW_COPY_AND_ASSIGN(Connection);
+    };
+
+    /**
+     * Incoming packets are copied out of rings into these buffers, so that
+     * ring slots can be recycled immediately even if a transport holds on
+     * to the packet data for a long time.
+     */
+    struct PacketBuf {
+        char payload[MAX_PACKET_SIZE];
+    };
+
+    Channel* claimChannel(Region* region);
+    uint32_t pollRing(Ring* ring, const Address* sender, uint32_t maxPackets,
+            std::vector<Received>* receivedPackets);
+
+    /// Shared RAMCloud information.
+    Context* context;
+
+    /// The service locator for this driver; empty if this is a
+    /// client-only driver.
+    string locatorString;
+
+    /// File descriptor for the memfd holding our region (-1 if this is a
+    /// client-only driver).
+    int regionFd;
+
+    /// Our region (server-side drivers only), shared with clients.
+    Region* region;
+
+    /// Entry i identifies the client attached to region->channels[i] as
+    /// the sender of its packets (server-side drivers only).
+    std::vector<SharedMemoryAddress*> channelAddresses;
+
+    /// Entry i is the value of region->channels[i].generation when
+    /// receivePackets last discarded a previous owner's packets from the
+    /// channel's toServer ring (server-side drivers only).
+    std::vector<uint32_t> channelGenerations;
+
+    /// Our connections to other servers' regions, indexed by the server's
+    /// pid (high-order 32 bits) and memfd descriptor (low-order 32 bits).
+    /// Connections remain until the driver is destroyed.
+    std::unordered_map<int64_t, Connection*> connections;
+
+    /// Copies of the values in connections, for fast scanning by
+    /// receivePackets. Entries are only appended, and numConnections
+    /// is updated after the new entry is filled in, so receivePackets
+    /// can scan this without acquiring mutex.
+    Connection* connectionList[MAX_CONNECTIONS];
+
+    /// Number of valid entries in connectionList.
+    Atomic<uint32_t> numConnections;
+
+    /// Holds packet buffers that are no longer in use, for use in future
+    /// packets; saves the overhead of calling malloc/free for each packet.
+    ObjectPool<PacketBuf> packetBufPool;
+
+    /// Used to synchronize accesses to packetBufPool and connections
+    /// (release and newAddress may be invoked from worker threads).
+    SpinLock mutex;
+
+    /// Counts packets dropped because a destination's ring was full.
+    uint64_t packetsDropped;
+
+    static Syscall* sys;
+
+    DISALLOW_COPY_AND_ASSIGN(SharedMemoryDriver);
+};
+
+} // end RAMCloud
+
+#endif  // RAMCLOUD_SHAREDMEMORYDRIVER_H
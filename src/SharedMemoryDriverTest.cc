@@ -0,0 +1,270 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any purpose
+ * with or without fee is hereby granted, provided that the above copyright
+ * notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER
+ * RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF
+ * CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "MockSyscall.h"
+#include "ServiceLocator.h"
+#include "SharedMemoryDriver.h"
+#include "Tub.h"
+
+namespace RAMCloud {
+class SharedMemoryDriverTest : public ::testing::Test {
+  public:
+    Context context;
+    string exceptionMessage;
+    MockSyscall* sys;
+    Syscall *savedSyscall;
+    TestLog::Enable logEnabler;
+    ServiceLocator serverLocator;
+    Tub<SharedMemoryDriver> server;
+    Tub<SharedMemoryDriver> client;
+    Tub<ServiceLocator> clientLocator;
+
+    SharedMemoryDriverTest()
+        : context()
+        , exceptionMessage("no exception")
+        , sys(NULL)
+        , savedSyscall(NULL)
+        , logEnabler()
+        , serverLocator("basic+shm:")
+        , server()
+        , client()
+        , clientLocator()
+    {
+        savedSyscall = SharedMemoryDriver::sys;
+        sys = new MockSyscall();
+        SharedMemoryDriver::sys = sys;
+        server.construct(&context, &serverLocator);
+        client.construct(&context);
+        clientLocator.construct(server->getServiceLocator());
+    }
+
+    ~SharedMemoryDriverTest() {
+        client.destroy();
+        server.destroy();
+        delete sys;
+        sys = NULL;
+        SharedMemoryDriver::sys = savedSyscall;
+    }
+
+    // Returns the contents of all the packets currently available on
+    // a driver, separated by commas.
+    string receivePackets(SharedMemoryDriver* driver) {
+        std::vector<Driver::Received> receivedPackets;
+        driver->receivePackets(100, &receivedPackets);
+        if (receivedPackets.size() == 0) {
+            return "no packet arrived";
+        }
+        string result;
+        for (uint32_t i = 0; i < receivedPackets.size(); i++) {
+            if (i != 0) {
+                result.append(", ");
+            }
+            result.append(receivedPackets[i].payload,
+                    receivedPackets[i].len);
+        }
+        return result;
+    }
+
+    void sendMessage(SharedMemoryDriver* driver, const Driver::Address* address,
+            const char *header, const char *payload) {
+        Buffer message;
+        message.appendExternal(payload, downCast<uint32_t>(strlen(payload)));
+        Buffer::Iterator iterator(&message);
+        driver->sendPacket(address, header, downCast<uint32_t>(strlen(header)),
+                           &iterator);
+    }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(SharedMemoryDriverTest);
+};
+
+TEST_F(SharedMemoryDriverTest, basics) {
+    // Send a packet from the client to the server and back again.
+    std::unique_ptr<Driver::Address> address(
+            client->newAddress(clientLocator.get()));
+    sendMessage(client.get(), address.get(), "header:", "first message");
+    sendMessage(client.get(), address.get(), "header:", "second message");
+
+    std::vector<Driver::Received> received;
+    server->receivePackets(10, &received);
+    ASSERT_EQ(2u, received.size());
+    EXPECT_EQ("header:first message",
+            string(received[0].payload, received[0].len));
+    EXPECT_EQ("shm client 0", received[0].sender->toString());
+
+    sendMessage(server.get(), received[0].sender, "h:", "response");
+    EXPECT_EQ("h:response", receivePackets(client.get()));
+    EXPECT_EQ("no packet arrived", receivePackets(client.get()));
+}
+
+TEST_F(SharedMemoryDriverTest, constructor_errorInMemfdCreate) {
+    sys->memfdCreateErrno = EPERM;
+    try {
+        SharedMemoryDriver server2(&context, &serverLocator);
+    } catch (DriverException& e) {
+        exceptionMessage = e.message;
+    }
+    EXPECT_EQ("SharedMemoryDriver couldn't create shared memory region: "
+            "Operation not permitted", exceptionMessage);
+}
+TEST_F(SharedMemoryDriverTest, constructor_clientOnly) {
+    EXPECT_EQ("", client->getServiceLocator());
+    EXPECT_EQ("no packet arrived", receivePackets(client.get()));
+}
+
+TEST_F(SharedMemoryDriverTest, claimChannel_reclaimDefunctClient) {
+    SharedMemoryDriver::Region* region = server->region;
+    for (uint32_t i = 0; i < SharedMemoryDriver::NUM_CHANNELS; i++) {
+        region->channels[i].state = SharedMemoryDriver::IN_USE;
+        region->channels[i].clientPid = getpid();
+    }
+    EXPECT_TRUE(client->claimChannel(region) == NULL);
+
+    // Pid values this large are never assigned, so the "owner" of
+    // channel 3 appears to have exited.
+    region->channels[3].clientPid = 0x7ffffff0;
+    region->channels[3].toServer.head = 5;
+    region->channels[3].toClient.head = 7;
+    TestLog::reset();
+    EXPECT_EQ(&region->channels[3], client->claimChannel(region));
+    EXPECT_EQ("claimChannel: Reclaiming shared memory channel 3 from "
+            "defunct process 2147483632", TestLog::get());
+    EXPECT_EQ(getpid(), region->channels[3].clientPid.load());
+
+    // Both rings are drained: replies right away, requests by the server.
+    EXPECT_EQ(7u, region->channels[3].toClient.tail.load());
+    EXPECT_EQ(5u, region->channels[3].firstPacket.load());
+    EXPECT_EQ(1u, region->channels[3].generation.load());
+    EXPECT_EQ("no packet arrived", receivePackets(server.get()));
+    EXPECT_EQ(5u, region->channels[3].toServer.tail.load());
+}
+TEST_F(SharedMemoryDriverTest, claimChannel_killGoesThroughSyscall) {
+    SharedMemoryDriver::Region* region = server->region;
+    for (uint32_t i = 0; i < SharedMemoryDriver::NUM_CHANNELS; i++) {
+        region->channels[i].state = SharedMemoryDriver::IN_USE;
+        region->channels[i].clientPid = getpid();
+    }
+    sys->killErrno = ESRCH;
+    EXPECT_EQ(&region->channels[0], client->claimChannel(region));
+}
+
+TEST_F(SharedMemoryDriverTest, newAddress_wrongHost) {
+    ServiceLocator locator(format("basic+shm:host=no.such.host,pid=%d,fd=3",
+            getpid()));
+    try {
+        delete client->newAddress(&locator);
+    } catch (DriverException& e) {
+        exceptionMessage = e.message;
+    }
+    EXPECT_EQ("SharedMemoryDriver can't reach host no.such.host from "
+            "this machine", exceptionMessage);
+}
+TEST_F(SharedMemoryDriverTest, newAddress_reuseConnection) {
+    std::unique_ptr<Driver::Address> address1(
+            client->newAddress(clientLocator.get()));
+    std::unique_ptr<Driver::Address> address2(
+            client->newAddress(clientLocator.get()));
+    EXPECT_EQ(1u, client->numConnections.load());
+    EXPECT_EQ(SharedMemoryDriver::IN_USE,
+            server->region->channels[0].state.load());
+    EXPECT_EQ(SharedMemoryDriver::FREE,
+            server->region->channels[1].state.load());
+}
+TEST_F(SharedMemoryDriverTest, newAddress_errorInOpen) {
+    sys->openErrno = ENOENT;
+    try {
+        delete client->newAddress(clientLocator.get());
+    } catch (DriverException& e) {
+        exceptionMessage = e.message;
+    }
+    EXPECT_TRUE(TestUtil::contains(exceptionMessage,
+            "SharedMemoryDriver couldn't open /proc/"));
+    EXPECT_EQ(0u, client->numConnections.load());
+}
+TEST_F(SharedMemoryDriverTest, newAddress_notSharedMemory) {
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    char hostName[HOST_NAME_MAX + 1];
+    gethostname(hostName, sizeof(hostName));
+    ServiceLocator locator(format("basic+shm:host=%s,pid=%d,fd=%d",
+            hostName, getpid(), fds[0]));
+    try {
+        delete client->newAddress(&locator);
+    } catch (DriverException& e) {
+        exceptionMessage = e.message;
+    }
+    close(fds[0]);
+    close(fds[1]);
+    EXPECT_TRUE(TestUtil::contains(exceptionMessage,
+            "SharedMemoryDriver found no shared memory region"));
+}
+
+TEST_F(SharedMemoryDriverTest, destructor_releasesChannels) {
+    delete client->newAddress(clientLocator.get());
+    EXPECT_EQ(SharedMemoryDriver::IN_USE,
+            server->region->channels[0].state.load());
+    client.destroy();
+    EXPECT_EQ(SharedMemoryDriver::FREE,
+            server->region->channels[0].state.load());
+}
+
+TEST_F(SharedMemoryDriverTest, receivePackets_discardPreviousOwnersPackets) {
+    std::unique_ptr<Driver::Address> address(
+            client->newAddress(clientLocator.get()));
+    sendMessage(client.get(), address.get(), "old:", "1");
+    address.reset();
+    client.destroy();
+
+    // The channel is reused by a new client; the server must not deliver
+    // the packet left behind by the old one, but must deliver the new
+    // client's packets even if they're sent before the server notices
+    // the change of ownership.
+    client.construct(&context);
+    address.reset(client->newAddress(clientLocator.get()));
+    EXPECT_EQ(&server->region->channels[0],
+            client->connectionList[0]->channel);
+    sendMessage(client.get(), address.get(), "new:", "2");
+    EXPECT_EQ("new:2", receivePackets(server.get()));
+    EXPECT_EQ("no packet arrived", receivePackets(server.get()));
+}
+
+TEST_F(SharedMemoryDriverTest, receivePackets_limitPackets) {
+    std::unique_ptr<Driver::Address> address(
+            client->newAddress(clientLocator.get()));
+    sendMessage(client.get(), address.get(), "a", "1");
+    sendMessage(client.get(), address.get(), "b", "2");
+    sendMessage(client.get(), address.get(), "c", "3");
+    std::vector<Driver::Received> received;
+    server->receivePackets(2, &received);
+    EXPECT_EQ(2u, received.size());
+    received.clear();
+    EXPECT_EQ("c3", receivePackets(server.get()));
+}
+
+TEST_F(SharedMemoryDriverTest, sendPacket_ringFull) {
+    std::unique_ptr<Driver::Address> address(
+            client->newAddress(clientLocator.get()));
+    for (uint32_t i = 0; i < SharedMemoryDriver::RING_SLOTS; i++) {
+        sendMessage(client.get(), address.get(), "x", "y");
+    }
+    EXPECT_EQ(0u, client->packetsDropped);
+    TestLog::reset();
+    sendMessage(client.get(), address.get(), "x", "y");
+    EXPECT_EQ(1u, client->packetsDropped);
+    EXPECT_TRUE(TestUtil::contains(TestLog::get(), "ring full"));
+}
+
+}  // namespace RAMCloud
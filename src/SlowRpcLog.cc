@@ -0,0 +1,127 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <sys/time.h>
+
+#include "Cycles.h"
+#include "Fence.h"
+#include "SlowRpcLog.h"
+
+namespace RAMCloud {
+
+__thread SlowRpcLog::RpcTimes SlowRpcLog::threadTimes;
+SlowRpcLog::Slot SlowRpcLog::ring[SlowRpcLog::RING_SIZE];
+Atomic<uint64_t> SlowRpcLog::nextEntry(0);
+uint64_t SlowRpcLog::thresholdCycles = 0;
+
+/**
+ * Convert a time in cycles to nanoseconds, saturating at the largest value
+ * that fits in an Entry.
+ */
+static uint32_t
+toEntryNs(uint64_t cycles)
+{
+    uint64_t ns = Cycles::toNanoseconds(cycles);
+    if (ns > ~0u) {
+        return ~0u;
+    }
+    return static_cast<uint32_t>(ns);
+}
+
+/**
+ * Return the slow RPCs currently in the ring, oldest first. Entries that are
+ * being overwritten while this method runs are left out.
+ *
+ * \param[out] entries
+ *      The entries are appended here.
+ */
+void
+SlowRpcLog::getEntries(std::vector<Entry>* entries)
+{
+    uint64_t end = nextEntry.load();
+    uint64_t start = (end > RING_SIZE) ? end - RING_SIZE : 0;
+    for (uint64_t i = start; i < end; i++) {
+        Slot* slot = &ring[i % RING_SIZE];
+        uint64_t sequence = slot->sequence.load();
+        if (sequence != 2*i + 2) {
+            continue;
+        }
+        Fence::lfence();
+        Entry entry = slot->entry;
+        Fence::lfence();
+        if (slot->sequence.load() != sequence) {
+            continue;
+        }
+        entries->push_back(entry);
+    }
+}
+
+/**
+ * Discard all of the entries in the ring. Intended primarily for unit
+ * testing; must not be invoked concurrently with recording.
+ */
+void
+SlowRpcLog::reset()
+{
+    for (uint32_t i = 0; i < RING_SIZE; i++) {
+        ring[i].sequence = 0;
+    }
+    nextEntry = 0;
+}
+
+/**
+ * Change which RPCs are recorded.
+ *
+ * \param microseconds
+ *      RPCs that spend at least this long in the server (from the arrival
+ *      of the request until the reply is sent) are recorded; 0 means stop
+ *      recording RPCs.
+ */
+void
+SlowRpcLog::setThreshold(uint32_t microseconds)
+{
+    thresholdCycles = Cycles::fromNanoseconds(1000lu * microseconds);
+}
+
+/**
+ * Add an entry to the ring for a slow RPC; the arguments are the same as
+ * for record.
+ */
+void
+SlowRpcLog::recordSlow(uint32_t opcode, uint32_t traceId,
+        uint64_t arrivalTime, const RpcTimes& times, uint64_t now)
+{
+    struct timeval wallTime;
+    gettimeofday(&wallTime, NULL);
+
+    uint64_t i = nextEntry.inc();
+    Slot* slot = &ring[i % RING_SIZE];
+    slot->sequence = 2*i + 1;
+    Fence::sfence();
+    Entry* entry = &slot->entry;
+    entry->time = wallTime.tv_sec * 1000000lu + wallTime.tv_usec;
+    entry->opcode = opcode;
+    entry->traceId = traceId;
+    entry->totalNs = toEntryNs(now - arrivalTime);
+    entry->queueNs = toEntryNs(times.startTime - arrivalTime);
+    entry->hashLookupNs = toEntryNs(times.hashLookupCycles);
+    entry->logAppendNs = toEntryNs(times.logAppendCycles);
+    entry->logSyncNs = toEntryNs(times.logSyncCycles);
+    entry->replyNs = toEntryNs(now - times.replyReadyTime);
+    Fence::sfence();
+    slot->sequence = 2*i + 2;
+}
+
+} // namespace RAMCloud
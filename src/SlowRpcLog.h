@@ -0,0 +1,173 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_SLOWRPCLOG_H
+#define RAMCLOUD_SLOWRPCLOG_H
+
+#include <vector>
+
+#include "Atomic.h"
+#include "Common.h"
+
+namespace RAMCloud {
+
+/**
+ * This class keeps a record of the RPCs that took a long time on this
+ * server, along with where the time went, so that a client that sees an
+ * occasional slow request can find out why after the fact.
+ *
+ * While a worker thread executes an RPC, the code along the way adds the
+ * time it spends in hash table lookups, log appends and log syncs (which
+ * include waiting for replication) to #threadTimes. When the dispatch
+ * thread has sent the reply, WorkerManager calls record, which adds an
+ * Entry to a fixed-size ring if the RPC spent longer than the threshold
+ * (see setThreshold) in the server. The ring is lock-free: any number of
+ * threads may record entries while others read them with getEntries.
+ */
+class SlowRpcLog {
+  public:
+    /**
+     * Times collected by a worker thread for the RPC it is executing.
+     */
+    struct RpcTimes {
+        /// Cycles::rdtsc time when a worker thread started the RPC.
+        uint64_t startTime;
+
+        /// Total cycles spent looking up objects in the hash table.
+        uint64_t hashLookupCycles;
+
+        /// Total cycles spent appending to the log.
+        uint64_t logAppendCycles;
+
+        /// Total cycles spent in Log::sync and Log::syncTo, which is mostly
+        /// waiting for backups to acknowledge replica writes.
+        uint64_t logSyncCycles;
+
+        /// Cycles::rdtsc time when the worker handed the reply back to the
+        /// dispatch thread.
+        uint64_t replyReadyTime;
+    };
+
+    /**
+     * Describes one slow RPC. The response to a GET_SLOW_RPCS server
+     * control consists of an array of these. All times are in nanoseconds
+     * (saturating at about 4 seconds).
+     */
+    struct Entry {
+        /// Wall-clock time when the reply was sent, in microseconds since
+        /// the epoch.
+        uint64_t time;
+
+        /// The RPC's WireFormat::Opcode.
+        uint32_t opcode;
+
+        /// The RPC's trace id, if it was sampled (see TimeTrace::sampleRpc);
+        /// otherwise 0.
+        uint32_t traceId;
+
+        /// Time from when the request arrived until the reply was sent.
+        uint32_t totalNs;
+
+        /// Time spent waiting for a worker thread.
+        uint32_t queueNs;
+
+        /// Time spent looking up objects in the hash table.
+        uint32_t hashLookupNs;
+
+        /// Time spent appending to the log.
+        uint32_t logAppendNs;
+
+        /// Time spent syncing the log (waiting for replication).
+        uint32_t logSyncNs;
+
+        /// Time from when the worker finished until the reply was sent.
+        uint32_t replyNs;
+    } __attribute__((packed));
+
+    static void getEntries(std::vector<Entry>* entries);
+    static void reset();
+    static void setThreshold(uint32_t microseconds);
+
+    /**
+     * Called after the reply to an RPC has been sent; records the RPC if
+     * it was slow.
+     *
+     * \param opcode
+     *      The RPC's WireFormat::Opcode.
+     * \param traceId
+     *      The RPC's trace id, or 0.
+     * \param arrivalTime
+     *      Cycles::rdtsc time when the request arrived.
+     * \param times
+     *      Collected by the worker thread that executed the RPC.
+     * \param now
+     *      Cycles::rdtsc time when the reply was sent.
+     */
+    static inline void
+    record(uint32_t opcode, uint32_t traceId, uint64_t arrivalTime,
+            const RpcTimes& times, uint64_t now)
+    {
+        uint64_t threshold = thresholdCycles;
+        if ((threshold == 0) || (now - arrivalTime < threshold)) {
+            return;
+        }
+        recordSlow(opcode, traceId, arrivalTime, times, now);
+    }
+
+    /// Number of entries in the ring; once it is full, each new entry
+    /// replaces the oldest one.
+    static const uint32_t RING_SIZE = 1024;
+
+    /// Times for the RPC that the current thread is executing.
+    static __thread RpcTimes threadTimes;
+
+  PRIVATE:
+    static void recordSlow(uint32_t opcode, uint32_t traceId,
+            uint64_t arrivalTime, const RpcTimes& times, uint64_t now);
+
+    /**
+     * One element of the ring.
+     */
+    struct Slot {
+        Slot()
+            : sequence(0)
+            , entry()
+        {}
+
+        /// 2 * (number of the entry in this slot) + 2 once the entry has
+        /// been completely written; odd while it's being written. Readers
+        /// use this to make sure they saw a consistent entry.
+        Atomic<uint64_t> sequence;
+
+        Entry entry;
+
+        DISALLOW_COPY_AND_ASSIGN(Slot);
+    };
+
+    /// Slow RPCs recorded so far; entry number i is in slot
+    /// i % RING_SIZE.
+    static Slot ring[RING_SIZE];
+
+    /// Number of the next entry to be recorded.
+    static Atomic<uint64_t> nextEntry;
+
+    /// RPCs that take at least this many cycles are recorded; 0 means
+    /// don't record any.
+    static uint64_t thresholdCycles;
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_SLOWRPCLOG_H
@@ -0,0 +1,115 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "Cycles.h"
+#include "SlowRpcLog.h"
+
+namespace RAMCloud {
+
+class SlowRpcLogTest : public ::testing::Test {
+  public:
+    SlowRpcLog::RpcTimes times;
+
+    SlowRpcLogTest()
+        : times()
+    {
+        Cycles::mockCyclesPerSec = 1e09;
+        SlowRpcLog::reset();
+        SlowRpcLog::setThreshold(10);
+        times.startTime = 1500;
+        times.hashLookupCycles = 200;
+        times.logAppendCycles = 300;
+        times.logSyncCycles = 4000;
+        times.replyReadyTime = 9000;
+    }
+
+    ~SlowRpcLogTest()
+    {
+        SlowRpcLog::setThreshold(0);
+        SlowRpcLog::reset();
+        Cycles::mockCyclesPerSec = 0;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(SlowRpcLogTest);
+};
+
+TEST_F(SlowRpcLogTest, getEntries_wrapAround) {
+    for (uint32_t i = 0; i < SlowRpcLog::RING_SIZE + 3; i++) {
+        SlowRpcLog::record(i, 0, 1000, times, 20000);
+    }
+    std::vector<SlowRpcLog::Entry> entries;
+    SlowRpcLog::getEntries(&entries);
+    ASSERT_EQ(SlowRpcLog::RING_SIZE, entries.size());
+    EXPECT_EQ(3u, entries.front().opcode);
+    EXPECT_EQ(SlowRpcLog::RING_SIZE + 2, entries.back().opcode);
+}
+
+TEST_F(SlowRpcLogTest, getEntries_skipEntryBeingWritten) {
+    SlowRpcLog::record(1, 0, 1000, times, 20000);
+    SlowRpcLog::record(2, 0, 1000, times, 20000);
+    SlowRpcLog::ring[1].sequence = 3;
+    std::vector<SlowRpcLog::Entry> entries;
+    SlowRpcLog::getEntries(&entries);
+    ASSERT_EQ(1u, entries.size());
+    EXPECT_EQ(1u, entries[0].opcode);
+}
+
+TEST_F(SlowRpcLogTest, record_belowThreshold) {
+    SlowRpcLog::record(1, 0, 1000, times, 10999);
+    std::vector<SlowRpcLog::Entry> entries;
+    SlowRpcLog::getEntries(&entries);
+    EXPECT_EQ(0u, entries.size());
+
+    SlowRpcLog::setThreshold(0);
+    SlowRpcLog::record(1, 0, 1000, times, 1000000);
+    SlowRpcLog::getEntries(&entries);
+    EXPECT_EQ(0u, entries.size());
+}
+
+TEST_F(SlowRpcLogTest, record_slowRpc) {
+    SlowRpcLog::record(7, 99, 1000, times, 11000);
+    std::vector<SlowRpcLog::Entry> entries;
+    SlowRpcLog::getEntries(&entries);
+    ASSERT_EQ(1u, entries.size());
+    SlowRpcLog::Entry& entry = entries[0];
+    EXPECT_NE(0u, entry.time);
+    EXPECT_EQ(7u, entry.opcode);
+    EXPECT_EQ(99u, entry.traceId);
+    EXPECT_EQ(10000u, entry.totalNs);
+    EXPECT_EQ(500u, entry.queueNs);
+    EXPECT_EQ(200u, entry.hashLookupNs);
+    EXPECT_EQ(300u, entry.logAppendNs);
+    EXPECT_EQ(4000u, entry.logSyncNs);
+    EXPECT_EQ(2000u, entry.replyNs);
+}
+
+TEST_F(SlowRpcLogTest, record_saturate) {
+    times.logSyncCycles = 5000000000lu;
+    SlowRpcLog::record(7, 0, 1000, times, 11000);
+    std::vector<SlowRpcLog::Entry> entries;
+    SlowRpcLog::getEntries(&entries);
+    ASSERT_EQ(1u, entries.size());
+    EXPECT_EQ(~0u, entries[0].logSyncNs);
+}
+
+TEST_F(SlowRpcLogTest, setThreshold) {
+    SlowRpcLog::setThreshold(25);
+    EXPECT_EQ(25000u, SlowRpcLog::thresholdCycles);
+    SlowRpcLog::setThreshold(0);
+    EXPECT_EQ(0u, SlowRpcLog::thresholdCycles);
+}
+
+} // namespace RAMCloud
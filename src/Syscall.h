@@ -23,6 +23,8 @@
 #include <netinet/in.h>
 #include <fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <signal.h>
 #include <cstdio>
 
 #include "Common.h"
@@ -101,14 +103,44 @@ class Syscall {
         return ::fwrite(src, size, count, f);
     }
     VIRTUAL_FOR_TESTING
+    int ftruncate(int fd, off_t length) {
+        return ::ftruncate(fd, length);
+    }
+    VIRTUAL_FOR_TESTING
     int getsockname(int sockfd, sockaddr* addr, socklen_t* addrlen) {
         return ::getsockname(sockfd, addr, addrlen);
     }
     VIRTUAL_FOR_TESTING
+    int getsockopt(int sockfd, int level, int optname, void *optval,
+                    socklen_t *optlen) {
+        return ::getsockopt(sockfd, level, optname, optval, optlen);
+    }
+    VIRTUAL_FOR_TESTING
+    int kill(pid_t pid, int sig) {
+        return ::kill(pid, sig);
+    }
+    VIRTUAL_FOR_TESTING
     int listen(int sockfd, int backlog) {
         return ::listen(sockfd, backlog);
     }
     VIRTUAL_FOR_TESTING
+    int memfdCreate(const char* name, unsigned int flags) {
+        return static_cast<int>(::syscall(SYS_memfd_create, name, flags));
+    }
+    VIRTUAL_FOR_TESTING
+    void* mmap(void* addr, size_t length, int prot, int flags, int fd,
+            off_t offset) {
+        return ::mmap(addr, length, prot, flags, fd, offset);
+    }
+    VIRTUAL_FOR_TESTING
+    int munmap(void* addr, size_t length) {
+        return ::munmap(addr, length);
+    }
+    VIRTUAL_FOR_TESTING
+    int open(const char* pathname, int flags) {
+        return ::open(pathname, flags);
+    }
+    VIRTUAL_FOR_TESTING
     int pipe(int fds[2]) {
         return ::pipe(fds);
     }
@@ -135,12 +167,21 @@ class Syscall {
         return ::recvmmsg(sockfd, msgvec, vlen, flags, timeout);
     }
     VIRTUAL_FOR_TESTING
+    ssize_t recvmsg(int sockfd, msghdr *msg, int flags) {
+        return ::recvmsg(sockfd, msg, flags);
+    }
+    VIRTUAL_FOR_TESTING
     int select(int nfds, fd_set *readfds, fd_set *writefds,
            fd_set *errorfds, struct timeval *timeout)
     {
         return ::select(nfds, readfds, writefds, errorfds, timeout);
     }
     VIRTUAL_FOR_TESTING
+    int sendmmsg(int sockfd, struct mmsghdr *msgvec, unsigned int vlen,
+            int flags) {
+        return ::sendmmsg(sockfd, msgvec, vlen, flags);
+    }
+    VIRTUAL_FOR_TESTING
     ssize_t sendmsg(int sockfd, const msghdr *msg, int flags) {
         return ::sendmsg(sockfd, msg, flags);
     }
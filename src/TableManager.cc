@@ -42,6 +42,7 @@ TableManager::TableManager(Context* context,
     , directory()
     , idMap()
     , backingTableMap()
+    , recoveryReaders()
 {
     context->tableManager = this;
 }
@@ -89,6 +90,27 @@ TableManager::Index::~Index()
 // TableManager Public Methods
 //////////////////////////////////////////////////////////////////////
 
+/**
+ * Stop directing reads for RECOVERING tablets to a particular recovery
+ * master (see tabletReplayed). Invoked when that server's part of a recovery
+ * fails or is cancelled.
+ *
+ * \param serverId
+ *      The recovery master whose reads are cancelled.
+ */
+void
+TableManager::cancelRecoveryReads(ServerId serverId)
+{
+    Lock lock(mutex);
+    for (RecoveryReaders::iterator it = recoveryReaders.begin();
+            it != recoveryReaders.end(); ) {
+        if (it->second == serverId)
+            it = recoveryReaders.erase(it);
+        else
+            ++it;
+    }
+}
+
 /**
  * Split an indexlet into two disjoint indexlets at a specific key.
  * Check if the split already exists, in which case, just return.
@@ -788,15 +810,27 @@ TableManager::serializeTableConfig(ProtoBuf::TableConfig* tableConfig,
     foreach (Tablet* tablet, table->tablets) {
         ProtoBuf::TableConfig::Tablet& entry(*tableConfig->add_tablet());
         tablet->serialize((ProtoBuf::Tablets::Tablet&)entry);
+        ServerId serverId = tablet->serverId;
+        if (tablet->status == Tablet::RECOVERING) {
+            // If the recovery master has already replayed the tablet, point
+            // clients at it for reads.
+            RecoveryReaders::iterator reader = recoveryReaders.find(
+                    {tableId, tablet->startKeyHash});
+            if (reader != recoveryReaders.end()) {
+                serverId = reader->second;
+                entry.set_server_id(serverId.getId());
+                entry.set_state(
+                        ProtoBuf::TableConfig::Tablet::RECOVERING_READ_ONLY);
+            }
+        }
         try {
-            string locator = context->serverList->getLocator(
-                    tablet->serverId);
+            string locator = context->serverList->getLocator(serverId);
             entry.set_service_locator(locator);
         } catch (const ServerListException& e) {
             RAMCLOUD_CLOG(NOTICE, "Server id (%s) in tablet map no longer "
                     "in server list; omitting locator for entry (tableName %s, "
                     "tableId %lu, startKeyHash 0x%lx)",
-                    tablet->serverId.toString().c_str(), table->name.c_str(),
+                    serverId.toString().c_str(), table->name.c_str(),
                     tableId, tablet->startKeyHash);
         }
     }
@@ -870,7 +904,48 @@ TableManager::splitTablet(const char* name, uint64_t splitKeyHash)
     Directory::iterator it = directory.find(name);
     if (it == directory.end())
         throw NoSuchTable(HERE);
-    Table* table = it->second;
+    splitTablet(lock, it->second, splitKeyHash);
+}
+
+/**
+ * Split a tablet into two disjoint tablets at a specific key hash. This
+ * method is identical to the one above, except that the table is identified
+ * by id rather than name.
+ *
+ * \param tableId
+ *      Id of the table that contains the tablet to be split.
+ * \param splitKeyHash
+ *      Key hash to used to partition the tablet into two. Keys less than
+ *      \a splitKeyHash belong to one tablet, keys greater than or equal to
+ *      \a splitKeyHash belong to the other.
+ *
+ * \throw NoSuchTable
+ *      If tableId does not correspond to an existing table.
+ */
+void
+TableManager::splitTablet(uint64_t tableId, uint64_t splitKeyHash)
+{
+    Lock lock(mutex);
+    IdMap::iterator it = idMap.find(tableId);
+    if (it == idMap.end())
+        throw NoSuchTable(HERE);
+    splitTablet(lock, it->second, splitKeyHash);
+}
+
+/**
+ * Does most of the work for the two public splitTablet methods.
+ *
+ * \param lock
+ *      Ensures that the caller holds the monitor lock; not actually used.
+ * \param table
+ *      The table that contains the tablet to be split.
+ * \param splitKeyHash
+ *      Key hash to used to partition the tablet into two.
+ */
+void
+TableManager::splitTablet(const Lock& lock, Table* table,
+        uint64_t splitKeyHash)
+{
     Tablet* tablet = findTablet(lock, table, splitKeyHash);
     if (splitKeyHash == tablet->startKeyHash)
         return;
@@ -989,6 +1064,7 @@ TableManager::tabletRecovered(
     tablet->serverId = serverId;
     tablet->status = Tablet::NORMAL;
     tablet->ctime = ctime;
+    recoveryReaders.erase({tableId, startKeyHash});
 
     // Record this update in external storage, in case we crash.  For this
     // operation there is nothing to "complete" after crash recovery other
@@ -1000,6 +1076,47 @@ TableManager::tabletRecovered(
     syncTable(lock, table, &externalInfo);
 }
 
+/**
+ * Invoked by MasterRecoveryManager when a recovery master has replayed a
+ * tablet, but recovery of the rest of its partition (or the rest of the
+ * recovery) hasn't finished yet. From now until tabletRecovered is
+ * invoked for the tablet (or cancelRecoveryReads for the recovery master),
+ * the tablet is reported to clients as RECOVERING_READ_ONLY on
+ * \a serverId, so reads for it can proceed. The tablet remains RECOVERING
+ * in the tablet map and this information isn't recorded on external
+ * storage.
+ *
+ * \param tableId
+ *      Id of table containing the tablet.
+ * \param startKeyHash
+ *      First key hash that is part of range of key hashes for the tablet.
+ * \param endKeyHash
+ *      Last key hash that is part of range of key hashes for the tablet.
+ * \param serverId
+ *      The recovery master that replayed the tablet.
+ * \throw NoSuchTablet
+ *      If the arguments do not identify a RECOVERING tablet currently in the
+ *      tablet map.
+ */
+void
+TableManager::tabletReplayed(
+        uint64_t tableId, uint64_t startKeyHash, uint64_t endKeyHash,
+        ServerId serverId)
+{
+    Lock lock(mutex);
+
+    IdMap::iterator it = idMap.find(tableId);
+    if (it == idMap.end())
+        throw NoSuchTablet(HERE);
+    Tablet* tablet = findTablet(lock, it->second, startKeyHash);
+    if ((tablet->startKeyHash != startKeyHash) ||
+            (tablet->endKeyHash != endKeyHash) ||
+            (tablet->status != Tablet::RECOVERING)) {
+        throw NoSuchTablet(HERE);
+    }
+    recoveryReaders[{tableId, startKeyHash}] = serverId;
+}
+
 /**
  * Create a table with the given name, if it doesn't already exist.
  *
@@ -16,6 +16,7 @@
 #ifndef RAMCLOUD_TABLEMANAGER_H
 #define RAMCLOUD_TABLEMANAGER_H
 
+#include <map>
 #include <mutex>
 
 #include "Common.h"
@@ -65,6 +66,7 @@ class TableManager {
             CoordinatorUpdateManager* updateManager);
     ~TableManager();
 
+    void cancelRecoveryReads(ServerId serverId);
     void coordSplitAndMigrateIndexlet(ServerId newOwner,
             uint64_t tableId, uint8_t indexId,
             const void* splitKey, KeyLength splitKeyLength);
@@ -92,9 +94,12 @@ class TableManager {
     void serializeTableConfig(ProtoBuf::TableConfig* tableConfig,
             uint64_t tableId);
     void splitTablet(const char* name, uint64_t splitKeyHash);
+    void splitTablet(uint64_t tableId, uint64_t splitKeyHash);
     void splitRecoveringTablet(uint64_t tableId, uint64_t splitKeyHash);
     void tabletRecovered(uint64_t tableId, uint64_t startKeyHash,
             uint64_t endKeyHash, ServerId serverId, LogPosition ctime);
+    void tabletReplayed(uint64_t tableId, uint64_t startKeyHash,
+            uint64_t endKeyHash, ServerId serverId);
 
   PRIVATE:
     /**
@@ -241,6 +246,14 @@ class TableManager {
     typedef std::unordered_map<uint64_t, Indexlet*> IndexletTableMap;
     IndexletTableMap backingTableMap;
 
+    /// For each RECOVERING tablet whose recovery master has finished
+    /// replaying it (see tabletReplayed), maps (tableId, startKeyHash) of the
+    /// tablet to the id of that recovery master, which serves reads for the
+    /// tablet until recovery completes. Not recorded on external storage:
+    /// after a coordinator crash clients just wait for recovery to finish.
+    typedef std::map<std::pair<uint64_t, uint64_t>, ServerId> RecoveryReaders;
+    RecoveryReaders recoveryReaders;
+
     uint64_t createTable(const Lock& lock, const char* name,
             uint32_t serverSpan, ServerId serverId = ServerId());
     void dropIndex(const Lock& lock, uint64_t tableId, uint8_t indexId);
@@ -256,6 +269,7 @@ class TableManager {
     void notifyReassignIndexlet(const Lock& lock, ProtoBuf::Table* info);
     void notifyReassignTablet(const Lock& lock, ProtoBuf::Table* info);
     Table* recreateTable(const Lock& lock, ProtoBuf::Table* info);
+    void splitTablet(const Lock& lock, Table* table, uint64_t splitKeyHash);
     void serializeTable(const Lock& lock, Table* table,
             ProtoBuf::Table* externalInfo);
     void syncNextTableId(const Lock& lock);
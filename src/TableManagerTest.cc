@@ -933,6 +933,19 @@ TEST_F(TableManagerTest, splitTablet_tabletRecovering) {
     EXPECT_THROW(tableManager->splitTablet("foo", 0xc000000000000000),
             RetryException);
 }
+TEST_F(TableManagerTest, splitTablet_byTableId) {
+    cluster.addServer(masterConfig);
+    tableManager->createTable("foo", 1);
+    cluster.externalStorage.log.clear();
+
+    tableManager->splitTablet(1, 0x8000000000000000);
+    EXPECT_EQ("{ foo(id 1): "
+            "{ 0x0-0x7fffffffffffffff on 1.0 } "
+            "{ 0x8000000000000000-0xffffffffffffffff on 1.0 } }",
+            tableManager->debugString(true));
+    EXPECT_THROW(tableManager->splitTablet(99, 0x1000),
+            TableManager::NoSuchTable);
+}
 
 TEST_F(TableManagerTest, splitRecoveringTablet_splitAlreadyExists) {
     cluster.addServer(masterConfig);
@@ -1002,6 +1015,42 @@ TEST_F(TableManagerTest, tabletRecovered_noSuchTablet) {
             serverId, ctime));
 }
 
+TEST_F(TableManagerTest, tabletReplayed) {
+    cluster.addServer(masterConfig);
+    cluster.addServer(masterConfig);
+    tableManager->createTable("foo", 1);
+    EXPECT_THROW(tableManager->tabletReplayed(1, 0, ~0UL, ServerId(2, 0)),
+            TableManager::NoSuchTablet);
+    tableManager->directory["foo"]->tablets[0]->status = Tablet::RECOVERING;
+    EXPECT_THROW(tableManager->tabletReplayed(99, 0, ~0UL, ServerId(2, 0)),
+            TableManager::NoSuchTablet);
+    EXPECT_THROW(tableManager->tabletReplayed(1, 0, 5, ServerId(2, 0)),
+            TableManager::NoSuchTablet);
+
+    // Replayed tablets are reported to clients on the recovery master.
+    tableManager->tabletReplayed(1, 0, ~0UL, ServerId(2, 0));
+    ProtoBuf::TableConfig tableConfig;
+    tableManager->serializeTableConfig(&tableConfig, 1);
+    EXPECT_EQ(ProtoBuf::TableConfig::Tablet::RECOVERING_READ_ONLY,
+            tableConfig.tablet(0).state());
+    EXPECT_EQ(ServerId(2, 0).getId(), tableConfig.tablet(0).server_id());
+    EXPECT_EQ("mock:host=server1", tableConfig.tablet(0).service_locator());
+    EXPECT_EQ(Tablet::RECOVERING,
+            tableManager->directory["foo"]->tablets[0]->status);
+
+    tableManager->cancelRecoveryReads(ServerId(2, 0));
+    tableConfig.Clear();
+    tableManager->serializeTableConfig(&tableConfig, 1);
+    EXPECT_EQ(ProtoBuf::TableConfig::Tablet::RECOVERING,
+            tableConfig.tablet(0).state());
+    EXPECT_EQ(ServerId(1, 0).getId(), tableConfig.tablet(0).server_id());
+
+    // Recovering the tablet forgets the reader.
+    tableManager->tabletReplayed(1, 0, ~0UL, ServerId(2, 0));
+    tableManager->tabletRecovered(1, 0, ~0UL, ServerId(2, 0), {0, 0});
+    EXPECT_TRUE(tableManager->recoveryReaders.empty());
+}
+
 TEST_F(TableManagerTest, findIndexlet) {
     TableManager::Index index(1, 1, 1);
     index.indexlets.push_back(new TableManager::Indexlet(
@@ -14,6 +14,7 @@
  */
 
 #include "TableStats.h"
+#include "Cycles.h"
 #include "MasterTableMetadata.h"
 #include "ShortMacros.h"
 
@@ -164,6 +165,100 @@ decrement(MasterTableMetadata* mtm,
     }
 }
 
+/**
+ * Record that ValueCompressor compressed (or tried to compress) one of a
+ * table's values.
+ *
+ * \param mtm
+ *      Pointer to MasterTableMetadata container that is storing the current
+ *      stats information.  Must not be NULL.
+ * \param tableId
+ *      Id of table whose stats information will be updated.
+ * \param inputBytes
+ *      Length of the value.
+ * \param outputBytes
+ *      Length of the value as stored in the log (the same as inputBytes if
+ *      compression didn't help).
+ * \param cycles
+ *      Time spent compressing, in Cycles::rdtsc ticks.
+ */
+void
+recordCompression(MasterTableMetadata* mtm,
+                  uint64_t tableId,
+                  uint64_t inputBytes,
+                  uint64_t outputBytes,
+                  uint64_t cycles)
+{
+    MasterTableMetadata::Entry* entry;
+    entry = mtm->findOrCreate(tableId);
+
+    SpinLock::Guard _(entry->stats.lock);
+    entry->stats.compressionInputBytes += inputBytes;
+    entry->stats.compressionOutputBytes += outputBytes;
+    entry->stats.compressionCycles += cycles;
+}
+
+/**
+ * Record that ValueCompressor decompressed one of a table's values.
+ *
+ * \param mtm
+ *      Pointer to MasterTableMetadata container that is storing the current
+ *      stats information.  Must not be NULL.
+ * \param tableId
+ *      Id of table whose stats information will be updated.
+ * \param cycles
+ *      Time spent decompressing, in Cycles::rdtsc ticks.
+ */
+void
+recordDecompression(MasterTableMetadata* mtm,
+                    uint64_t tableId,
+                    uint64_t cycles)
+{
+    MasterTableMetadata::Entry* entry;
+    entry = mtm->findOrCreate(tableId);
+
+    SpinLock::Guard _(entry->stats.lock);
+    entry->stats.decompressionCount++;
+    entry->stats.decompressionCycles += cycles;
+}
+
+/**
+ * Return a human-readable summary of value compression for every table
+ * whose values have been compressed on this master: one line per table
+ * giving the compression ratio and the average time to compress and
+ * decompress a value. Used by the GET_VALUE_COMPRESSION_STATS server
+ * control.
+ *
+ * \param mtm
+ *      Pointer to MasterTableMetadata container that is storing the current
+ *      stats information.  Must not be NULL.
+ */
+string
+compressionToString(MasterTableMetadata* mtm)
+{
+    string result;
+    MasterTableMetadata::scanner sc = mtm->getScanner();
+    while (sc.hasNext()) {
+        MasterTableMetadata::Entry* entry = sc.next();
+        SpinLock::Guard _(entry->stats.lock);
+        if (entry->stats.compressionInputBytes == 0)
+            continue;
+        result += format("table %lu: %lu bytes of values stored in %lu "
+                "(ratio %.2f), %.1f ns/KB to compress, %lu values "
+                "decompressed in %.1f ms\n",
+                entry->tableId,
+                entry->stats.compressionInputBytes,
+                entry->stats.compressionOutputBytes,
+                double(entry->stats.compressionInputBytes) /
+                double(entry->stats.compressionOutputBytes),
+                Cycles::toSeconds(entry->stats.compressionCycles) * 1e09 /
+                (double(entry->stats.compressionInputBytes) / 1024),
+                entry->stats.decompressionCount,
+                Cycles::toSeconds(entry->stats.decompressionCycles) * 1e03);
+    }
+    return result;
+}
+
 
 /**
  * Compress and serialize all table stats information in the MasterTableMetadata
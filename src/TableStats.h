@@ -62,6 +62,13 @@ struct Block {
     bool totalOwnership;    /// True if this master completely owns this table.
     uint64_t byteCount;     /// Number of bytes of data related to a table.
     uint64_t recordCount;   /// Number of log records related to a table.
+    uint64_t compressionInputBytes;  /// Total length of the values passed to
+                                     /// ValueCompressor::compress.
+    uint64_t compressionOutputBytes; /// Total length of those values as
+                                     /// stored in the log.
+    uint64_t compressionCycles;      /// Time spent compressing values.
+    uint64_t decompressionCount;     /// Number of values decompressed.
+    uint64_t decompressionCycles;    /// Time spent decompressing values.
 
     Block()
         : lock("TableStats::lock")
@@ -69,6 +76,11 @@ struct Block {
         , totalOwnership(false)
         , byteCount(0)
         , recordCount(0)
+        , compressionInputBytes(0)
+        , compressionOutputBytes(0)
+        , compressionCycles(0)
+        , decompressionCount(0)
+        , decompressionCycles(0)
     {}
 };
 
@@ -89,6 +101,15 @@ void decrement(MasterTableMetadata* mtm,
                uint64_t byteCount,
                uint64_t recordCount);
 void serialize(Buffer* buf, MasterTableMetadata *mtm);
+void recordCompression(MasterTableMetadata* mtm,
+                       uint64_t tableId,
+                       uint64_t inputBytes,
+                       uint64_t outputBytes,
+                       uint64_t cycles);
+void recordDecompression(MasterTableMetadata* mtm,
+                         uint64_t tableId,
+                         uint64_t cycles);
+string compressionToString(MasterTableMetadata* mtm);
 
 /**
  * This threshold defines the size below which tables stats information will be
@@ -66,7 +66,9 @@ Tablet::debugString(int usecase) const
             break;
         default:
             const char* status_str = "NORMAL";
-            if (status != Tablet::NORMAL)
+            if (status == Tablet::RECOVERING_READ_ONLY)
+                status_str = "RECOVERING_READ_ONLY";
+            else if (status != Tablet::NORMAL)
                 status_str = "RECOVERING";
             result = format("Tablet { tableId: %lu, startKeyHash: 0x%lx, "
                             "endKeyHash: 0x%lx, serverId: %s, status: %s, "
@@ -47,6 +47,11 @@ struct Tablet {
         NORMAL = 0 ,
         /// The tablet is being recovered, it is not available.
         RECOVERING = 1,
+        /// The tablet is being recovered, but #serverId (its recovery
+        /// master) has already replayed it and serves reads for it.
+        /// Only appears in the table configuration sent to clients;
+        /// the coordinator's tablet map still has the tablet RECOVERING.
+        RECOVERING_READ_ONLY = 2,
     };
 
     /// The status of the tablet, see Status.
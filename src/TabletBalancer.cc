@@ -0,0 +1,430 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <list>
+
+#include "Common.h"
+#include "ClientException.h"
+#include "Context.h"
+#include "CoordinatorServerList.h"
+#include "Cycles.h"
+#include "MasterClient.h"
+#include "ShortMacros.h"
+#include "TabletBalancer.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct a TabletBalancer. The balancer does nothing until start is
+ * invoked.
+ *
+ * \param context
+ *      Overall information about the coordinator; the server list in
+ *      this context is used to find masters.
+ * \param tableManager
+ *      The coordinator's table manager, used to check tablet ownership
+ *      and to split tablets.
+ */
+TabletBalancer::TabletBalancer(Context* context, TableManager* tableManager)
+    : context(context)
+    , tableManager(tableManager)
+    , config()
+    , samples()
+    , lastSampleTime(0)
+    , mutex()
+    , stop(true)
+    , wakeup()
+    , thread()
+{
+}
+
+TabletBalancer::~TabletBalancer()
+{
+    halt();
+}
+
+/**
+ * Stop the balancer thread, if it is running. This method blocks until
+ * the thread has exited (which may require waiting for an in-progress
+ * migration to complete).
+ */
+void
+TabletBalancer::halt()
+{
+    Lock lock(mutex);
+    stop = true;
+    wakeup.notify_one();
+    lock.unlock();
+
+    if (thread && thread->joinable()) {
+        thread->join();
+        thread.destroy();
+    }
+}
+
+/**
+ * Start a thread that periodically rebalances load among masters. If
+ * the balancer is already running, this method has no effect.
+ *
+ * \param config
+ *      Parameters that control the balancer's behavior. If
+ *      config.intervalSeconds is not positive, the balancer isn't started.
+ */
+void
+TabletBalancer::start(const Config& config)
+{
+    Lock _(mutex);
+    if (thread || config.intervalSeconds <= 0) {
+        return;
+    }
+    this->config = config;
+    samples.clear();
+    lastSampleTime = 0;
+    stop = false;
+    thread.construct(&TabletBalancer::balanceLoop, this);
+    LOG(NOTICE, "Tablet balancer started: interval %.1f s, imbalance ratio "
+            "%.2f, minimum load %.0f ops/s, at most %u actions per round",
+            config.intervalSeconds, config.imbalanceRatio,
+            config.minOpsPerSecond, config.maxActionsPerRound);
+}
+
+/**
+ * This is the top-level method of the balancer thread. It runs one
+ * balancing round every config.intervalSeconds until halt is invoked.
+ */
+void
+TabletBalancer::balanceLoop()
+{
+    try {
+        Lock lock(mutex);
+        while (!stop) {
+            std::chrono::steady_clock::time_point deadline =
+                    std::chrono::steady_clock::now() +
+                    std::chrono::microseconds(static_cast<uint64_t>(
+                    config.intervalSeconds * 1e06));
+            while (!stop && (wakeup.wait_until(lock, deadline) !=
+                    std::cv_status::timeout)) {
+                // Spurious wakeup; keep waiting.
+            }
+            if (stop) {
+                break;
+            }
+            lock.unlock();
+            runRound();
+            lock.lock();
+        }
+    } catch (const std::exception& e) {
+        LOG(ERROR, "Fatal error in TabletBalancer: %s", e.what());
+        throw;
+    } catch (...) {
+        LOG(ERROR, "Unknown fatal error in TabletBalancer.");
+        throw;
+    }
+    TEST_LOG("Balancer exited");
+}
+
+/**
+ * Retrieve access statistics from all of the masters that are currently
+ * up. RPCs are issued to all masters in parallel.
+ *
+ * \param[out] statistics
+ *      One entry is appended here for each master that responded.
+ *      Masters that crash or otherwise fail to respond are omitted.
+ */
+void
+TabletBalancer::collectStatistics(std::vector<MasterStatistics>* statistics)
+{
+    std::list<GetStatisticsRpc> rpcs;
+    std::vector<ServerId> ids;
+    ServerId id;
+    bool end = false;
+    while (true) {
+        id = context->coordinatorServerList->nextServer(id,
+                {WireFormat::MASTER_SERVICE}, &end, false);
+        if (end || !id.isValid()) {
+            break;
+        }
+        rpcs.emplace_back(context, id);
+        ids.push_back(id);
+    }
+
+    std::vector<ServerId>::iterator idIt = ids.begin();
+    for (GetStatisticsRpc& rpc : rpcs) {
+        ProtoBuf::ServerStatistics serverStats;
+        try {
+            rpc.wait(&serverStats);
+            statistics->emplace_back(*idIt, serverStats);
+        } catch (const ClientException& e) {
+            LOG(NOTICE, "Couldn't retrieve statistics from master %s: %s",
+                    idIt->toString().c_str(), e.toString());
+        }
+        idIt++;
+    }
+}
+
+/**
+ * Convert the access counts from the current round into request rates,
+ * using the counts saved from the previous round. On return, the current
+ * counts have replaced the saved ones.
+ *
+ * A tablet's rate is known only if the same master reported the same
+ * tablet (identical key hash range) in both rounds; otherwise the tablet
+ * is new, was split, or has moved, and its master is marked unsettled.
+ *
+ * \param statistics
+ *      Statistics from each master, as returned by collectStatistics.
+ * \param elapsedSeconds
+ *      Time since the previous set of statistics was collected; 0 means
+ *      there was no previous set.
+ * \param[out] loads
+ *      One entry is appended here for each master in \a statistics.
+ */
+void
+TabletBalancer::computeLoads(const std::vector<MasterStatistics>& statistics,
+        double elapsedSeconds, std::vector<MasterLoad>* loads)
+{
+    std::map<TabletKey, Sample> newSamples;
+    for (const MasterStatistics& masterStats : statistics) {
+        loads->emplace_back(masterStats.first);
+        MasterLoad& master = loads->back();
+        for (int i = 0; i < masterStats.second.tabletentry_size(); i++) {
+            const ProtoBuf::ServerStatistics_TabletEntry& entry =
+                    masterStats.second.tabletentry(i);
+            TabletKey key(entry.table_id(), entry.start_key_hash());
+            uint64_t count = entry.number_read_and_writes();
+            double rate = -1;
+            std::map<TabletKey, Sample>::iterator it = samples.find(key);
+            if (elapsedSeconds > 0 && it != samples.end()
+                    && it->second.owner == masterStats.first
+                    && it->second.endKeyHash == entry.end_key_hash()
+                    && it->second.count <= count) {
+                rate = static_cast<double>(count - it->second.count)
+                        / elapsedSeconds;
+                master.opsPerSecond += rate;
+            } else {
+                master.settled = false;
+            }
+            master.tablets.emplace_back(entry.table_id(),
+                    entry.start_key_hash(), entry.end_key_hash(), rate);
+            newSamples.insert({key, Sample(masterStats.first,
+                    entry.end_key_hash(), count)});
+        }
+    }
+    samples.swap(newSamples);
+}
+
+/**
+ * Decide which tablets to migrate or split in order to even out load.
+ *
+ * Each step compares the busiest and idlest settled masters. Nothing
+ * happens unless the busiest master is above config.minOpsPerSecond and
+ * more than config.imbalanceRatio times the mean load of the settled
+ * masters. If so, the busiest master's hottest tablet whose rate is no
+ * more than half the load difference is moved to the idlest master; this
+ * limit guarantees that the move can't make the idlest master busier than
+ * the busiest one, so tablets don't bounce back and forth. If every
+ * tablet is hotter than that, the hottest one is split in half instead.
+ * Masters involved in an action are marked unsettled, so each master
+ * takes part in at most one action per round.
+ *
+ * \param loads
+ *      Load information from computeLoads; modified to reflect the
+ *      actions chosen.
+ * \param[out] actions
+ *      The chosen actions are appended here (at most
+ *      config.maxActionsPerRound of them).
+ */
+void
+TabletBalancer::planActions(std::vector<MasterLoad>* loads,
+        std::vector<Action>* actions)
+{
+    std::map<uint64_t, uint32_t> tabletsPerTable;
+    for (const MasterLoad& master : *loads) {
+        for (const TabletLoad& tablet : master.tablets) {
+            tabletsPerTable[tablet.tableId]++;
+        }
+    }
+
+    for (uint32_t i = 0; i < config.maxActionsPerRound; i++) {
+        MasterLoad* busiest = NULL;
+        MasterLoad* idlest = NULL;
+        double totalOps = 0;
+        uint32_t settledMasters = 0;
+        for (MasterLoad& master : *loads) {
+            if (!master.settled) {
+                continue;
+            }
+            settledMasters++;
+            totalOps += master.opsPerSecond;
+            if ((busiest == NULL)
+                    || (master.opsPerSecond > busiest->opsPerSecond)) {
+                busiest = &master;
+            }
+            if ((idlest == NULL)
+                    || (master.opsPerSecond < idlest->opsPerSecond)) {
+                idlest = &master;
+            }
+        }
+        if (settledMasters < 2) {
+            return;
+        }
+        double mean = totalOps / settledMasters;
+        if ((busiest->opsPerSecond < config.minOpsPerSecond)
+                || (busiest->opsPerSecond <= config.imbalanceRatio * mean)) {
+            return;
+        }
+
+        double target = (busiest->opsPerSecond - idlest->opsPerSecond) / 2;
+        const TabletLoad* movable = NULL;
+        const TabletLoad* hottest = NULL;
+        for (const TabletLoad& tablet : busiest->tablets) {
+            if ((tablet.opsPerSecond <= 0)
+                    || tableManager->isIndexletTable(tablet.tableId)) {
+                continue;
+            }
+            if (tablet.opsPerSecond <= target) {
+                if ((movable == NULL)
+                        || (tablet.opsPerSecond > movable->opsPerSecond)) {
+                    movable = &tablet;
+                }
+            } else if ((hottest == NULL)
+                    || (tablet.opsPerSecond > hottest->opsPerSecond)) {
+                hottest = &tablet;
+            }
+        }
+
+        if (movable != NULL) {
+            actions->emplace_back(Action::MIGRATE, busiest->serverId,
+                    *movable);
+            actions->back().destination = idlest->serverId;
+            idlest->settled = false;
+        } else if ((hottest != NULL)
+                && (hottest->endKeyHash > hottest->startKeyHash)
+                && (tabletsPerTable[hottest->tableId] <
+                config.maxTabletsPerTable)) {
+            actions->emplace_back(Action::SPLIT, busiest->serverId,
+                    *hottest);
+            tabletsPerTable[hottest->tableId]++;
+        } else {
+            return;
+        }
+        busiest->settled = false;
+    }
+}
+
+/**
+ * Carry out a single action chosen by planActions. Errors are logged
+ * but otherwise ignored: the next round will see the current state of
+ * the cluster and can try again.
+ *
+ * \param action
+ *      Describes the migration or split to perform.
+ */
+void
+TabletBalancer::performAction(const Action& action)
+{
+    try {
+        if (action.type == Action::SPLIT) {
+            uint64_t splitKeyHash = splitPoint(action.startKeyHash,
+                    action.endKeyHash);
+            LOG(NOTICE, "Splitting hot tablet 0x%lx-0x%lx in table %lu "
+                    "on master %s at key hash 0x%lx",
+                    action.startKeyHash, action.endKeyHash, action.tableId,
+                    action.source.toString().c_str(), splitKeyHash);
+            tableManager->splitTablet(action.tableId, splitKeyHash);
+            return;
+        }
+
+        // The statistics may be stale by now (e.g. an operator moved the
+        // tablet, or its master crashed), so make sure the tablet is still
+        // where we think it is before asking its master to move it.
+        Tablet tablet = tableManager->getTablet(action.tableId,
+                action.startKeyHash);
+        if ((tablet.serverId != action.source)
+                || (tablet.startKeyHash != action.startKeyHash)
+                || (tablet.endKeyHash != action.endKeyHash)
+                || (tablet.status != Tablet::NORMAL)) {
+            LOG(NOTICE, "Tablet 0x%lx-0x%lx in table %lu changed since "
+                    "statistics were collected; not migrating it",
+                    action.startKeyHash, action.endKeyHash, action.tableId);
+            return;
+        }
+        LOG(NOTICE, "Migrating tablet 0x%lx-0x%lx in table %lu from "
+                "master %s to master %s",
+                action.startKeyHash, action.endKeyHash, action.tableId,
+                action.source.toString().c_str(),
+                action.destination.toString().c_str());
+        MasterClient::migrateMasterTablet(context, action.source,
+                action.tableId, action.startKeyHash, action.endKeyHash,
+                action.destination, config.pullPartitions);
+    } catch (const ClientException& e) {
+        LOG(WARNING, "Balancer couldn't %s tablet 0x%lx-0x%lx in table "
+                "%lu: %s", (action.type == Action::SPLIT) ? "split"
+                : "migrate", action.startKeyHash, action.endKeyHash,
+                action.tableId, e.toString());
+    } catch (const Exception& e) {
+        LOG(WARNING, "Balancer couldn't %s tablet 0x%lx-0x%lx in table "
+                "%lu: %s", (action.type == Action::SPLIT) ? "split"
+                : "migrate", action.startKeyHash, action.endKeyHash,
+                action.tableId, e.what());
+    }
+}
+
+/**
+ * Perform one balancing round: collect statistics from all masters,
+ * compute their loads, and carry out whatever actions are needed.
+ */
+void
+TabletBalancer::runRound()
+{
+    std::vector<MasterStatistics> statistics;
+    collectStatistics(&statistics);
+    uint64_t now = Cycles::rdtsc();
+    double elapsedSeconds = 0;
+    if (lastSampleTime != 0) {
+        elapsedSeconds = Cycles::toSeconds(now - lastSampleTime);
+    }
+    lastSampleTime = now;
+
+    std::vector<MasterLoad> loads;
+    computeLoads(statistics, elapsedSeconds, &loads);
+    std::vector<Action> actions;
+    planActions(&loads, &actions);
+    for (const Action& action : actions) {
+        performAction(action);
+    }
+}
+
+/**
+ * Returns the key hash at which a tablet should be split. Masters only
+ * report an access count for each tablet as a whole, so there's no way to
+ * tell where the hot keys are within the tablet; use the midpoint of the
+ * key hash range. If the hot keys all land in one half, a later round will
+ * split that half again.
+ *
+ * \param startKeyHash
+ *      Smallest key hash in the tablet.
+ * \param endKeyHash
+ *      Largest key hash in the tablet; must be greater than startKeyHash.
+ * \return
+ *      The split point, which is the first key hash of the upper half.
+ */
+uint64_t
+TabletBalancer::splitPoint(uint64_t startKeyHash, uint64_t endKeyHash)
+{
+    return startKeyHash + (endKeyHash - startKeyHash) / 2 + 1;
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,241 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_TABLETBALANCER_H
+#define RAMCLOUD_TABLETBALANCER_H
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ServerStatistics.pb.h"
+
+#include "Common.h"
+#include "ServerId.h"
+#include "TableManager.h"
+#include "Tub.h"
+
+namespace RAMCloud {
+
+/**
+ * The TabletBalancer runs on the coordinator and keeps request load spread
+ * evenly across masters. It periodically collects per-tablet access counts
+ * from every master (GET_SERVER_STATISTICS), converts them to request rates,
+ * and, when the busiest master is carrying noticeably more than its share
+ * of the load, either migrates a tablet from the busiest master to the
+ * idlest one or, if every tablet on the busiest master is too hot to move
+ * without simply shifting the hot spot, splits the hottest tablet in half
+ * so that a later round can move one of the halves.
+ *
+ * The balancer is deliberately conservative: it does at most a few
+ * operations per round, a master takes part in at most one operation per
+ * round, and masters whose tablets changed since the last round are left
+ * alone until fresh rates are available for all of their tablets.
+ */
+class TabletBalancer {
+  public:
+    /**
+     * Parameters that control how aggressively the balancer acts.
+     */
+    struct Config {
+        Config()
+            : intervalSeconds(0)
+            , imbalanceRatio(1.5)
+            , minOpsPerSecond(10000)
+            , maxActionsPerRound(1)
+            , maxTabletsPerTable(64)
+            , pullPartitions(0)
+        {}
+
+        /// Seconds between balancing rounds; 0 means the balancer is
+        /// disabled.
+        double intervalSeconds;
+
+        /// The balancer only acts if the busiest master's request rate
+        /// exceeds the mean rate across masters by at least this factor.
+        double imbalanceRatio;
+
+        /// The balancer does nothing unless the busiest master is handling
+        /// at least this many reads and writes per second (no point in
+        /// moving data around in a lightly loaded cluster).
+        double minOpsPerSecond;
+
+        /// Upper limit on the number of splits and migrations started in
+        /// a single round.
+        uint32_t maxActionsPerRound;
+
+        /// The balancer will not split a table into more than this many
+        /// tablets.
+        uint32_t maxTabletsPerTable;
+
+        /// Passed to MasterClient::migrateMasterTablet: nonzero means
+        /// migrations use pull-based transfer with this many partitions.
+        uint32_t pullPartitions;
+    };
+
+    TabletBalancer(Context* context, TableManager* tableManager);
+    ~TabletBalancer();
+    void halt();
+    void start(const Config& config);
+
+  PRIVATE:
+    /**
+     * Load information about one tablet, computed from two consecutive
+     * statistics samples.
+     */
+    struct TabletLoad {
+        TabletLoad(uint64_t tableId, uint64_t startKeyHash,
+                uint64_t endKeyHash, double opsPerSecond)
+            : tableId(tableId)
+            , startKeyHash(startKeyHash)
+            , endKeyHash(endKeyHash)
+            , opsPerSecond(opsPerSecond)
+        {}
+
+        uint64_t tableId;
+        uint64_t startKeyHash;
+        uint64_t endKeyHash;
+
+        /// Reads and writes per second over the last interval, or a
+        /// negative value if the rate isn't known yet (e.g. the tablet is
+        /// new, or has just moved).
+        double opsPerSecond;
+    };
+
+    /**
+     * Load information about one master.
+     */
+    struct MasterLoad {
+        explicit MasterLoad(ServerId serverId)
+            : serverId(serverId)
+            , opsPerSecond(0)
+            , settled(true)
+            , tablets()
+        {}
+
+        ServerId serverId;
+
+        /// Sum of opsPerSecond for all of the tablets whose rate is known.
+        double opsPerSecond;
+
+        /// False means that the rate is unknown for at least one of this
+        /// master's tablets (or the master was involved in an action
+        /// earlier in the current round), so it must not be chosen as a
+        /// source or destination.
+        bool settled;
+
+        /// One entry for each tablet currently owned by the master.
+        std::vector<TabletLoad> tablets;
+    };
+
+    /**
+     * Describes one operation chosen by planActions.
+     */
+    struct Action {
+        enum Type { MIGRATE, SPLIT };
+
+        Action(Type type, ServerId source, const TabletLoad& tablet)
+            : type(type)
+            , source(source)
+            , destination()
+            , tableId(tablet.tableId)
+            , startKeyHash(tablet.startKeyHash)
+            , endKeyHash(tablet.endKeyHash)
+        {}
+
+        Type type;
+
+        /// Master that currently owns the tablet.
+        ServerId source;
+
+        /// For MIGRATE, the master that will own the tablet afterwards.
+        ServerId destination;
+
+        /// Identifies the tablet to migrate or split.
+        uint64_t tableId;
+        uint64_t startKeyHash;
+        uint64_t endKeyHash;
+    };
+
+    /**
+     * The count reported for a tablet in the most recent round; used to
+     * turn the next round's count into a rate.
+     */
+    struct Sample {
+        Sample(ServerId owner, uint64_t endKeyHash, uint64_t count)
+            : owner(owner)
+            , endKeyHash(endKeyHash)
+            , count(count)
+        {}
+
+        ServerId owner;
+        uint64_t endKeyHash;
+        uint64_t count;
+    };
+
+    /// Identifies a tablet by table id and starting key hash.
+    typedef std::pair<uint64_t, uint64_t> TabletKey;
+
+    /// Statistics returned by one master in the current round.
+    typedef std::pair<ServerId, ProtoBuf::ServerStatistics> MasterStatistics;
+
+    void balanceLoop();
+    void collectStatistics(std::vector<MasterStatistics>* statistics);
+    void computeLoads(const std::vector<MasterStatistics>& statistics,
+            double elapsedSeconds, std::vector<MasterLoad>* loads);
+    void performAction(const Action& action);
+    void planActions(std::vector<MasterLoad>* loads,
+            std::vector<Action>* actions);
+    void runRound();
+    static uint64_t splitPoint(uint64_t startKeyHash, uint64_t endKeyHash);
+
+    /// Shared information about the server.
+    Context* context;
+
+    /// Used to look up current tablet ownership and to split tablets.
+    TableManager* tableManager;
+
+    /// Parameters for the current run of the balancer.
+    Config config;
+
+    /// Counts from the previous round, used by computeLoads.
+    std::map<TabletKey, Sample> samples;
+
+    /// Cycles::rdtsc() time when the previous round's statistics were
+    /// collected; 0 means there was no previous round.
+    uint64_t lastSampleTime;
+
+    /// Monitor lock for stop and wakeup.
+    std::mutex mutex;
+    typedef std::unique_lock<std::mutex> Lock;
+
+    /// Set by halt to ask the balancer thread to exit.
+    bool stop;
+
+    /// Used to wake the balancer thread early when it is asked to stop.
+    std::condition_variable wakeup;
+
+    /// The thread that runs balanceLoop; empty if the balancer isn't
+    /// running.
+    Tub<std::thread> thread;
+
+    DISALLOW_COPY_AND_ASSIGN(TabletBalancer);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_TABLETBALANCER_H
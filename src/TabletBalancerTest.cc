@@ -0,0 +1,316 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "MockCluster.h"
+#include "TabletBalancer.h"
+
+namespace RAMCloud {
+
+class TabletBalancerTest : public ::testing::Test {
+  public:
+    TestLog::Enable logEnabler;
+    Context context;
+    MockCluster cluster;
+    TableManager* tableManager;
+    ServerConfig masterConfig;
+    TabletBalancer balancer;
+
+    TabletBalancerTest()
+        : logEnabler()
+        , context()
+        , cluster(&context)
+        , tableManager(&cluster.coordinator->tableManager)
+        , masterConfig(ServerConfig::forTesting())
+        , balancer(cluster.coordinator->context, tableManager)
+    {
+        masterConfig.services = {WireFormat::MASTER_SERVICE,
+                                 WireFormat::ADMIN_SERVICE};
+        balancer.config.minOpsPerSecond = 1000;
+    }
+
+    // Add a tablet with the given rate to a MasterLoad.
+    void
+    addTablet(TabletBalancer::MasterLoad* master, uint64_t tableId,
+            uint64_t startKeyHash, uint64_t endKeyHash, double opsPerSecond)
+    {
+        master->tablets.emplace_back(tableId, startKeyHash, endKeyHash,
+                opsPerSecond);
+        if (opsPerSecond >= 0) {
+            master->opsPerSecond += opsPerSecond;
+        } else {
+            master->settled = false;
+        }
+    }
+
+    // Add a tablet entry to a master's statistics.
+    void
+    addEntry(TabletBalancer::MasterStatistics* stats, uint64_t tableId,
+            uint64_t startKeyHash, uint64_t endKeyHash, uint64_t count)
+    {
+        ProtoBuf::ServerStatistics_TabletEntry* entry =
+                stats->second.add_tabletentry();
+        entry->set_table_id(tableId);
+        entry->set_start_key_hash(startKeyHash);
+        entry->set_end_key_hash(endKeyHash);
+        entry->set_number_read_and_writes(count);
+    }
+
+    // Returns a human-readable description of a list of actions.
+    string
+    toString(const std::vector<TabletBalancer::Action>& actions)
+    {
+        string result;
+        for (const TabletBalancer::Action& action : actions) {
+            if (!result.empty()) {
+                result.append(" | ");
+            }
+            if (action.type == TabletBalancer::Action::MIGRATE) {
+                result.append(format("migrate %lu:0x%lx-0x%lx %s -> %s",
+                        action.tableId, action.startKeyHash,
+                        action.endKeyHash, action.source.toString().c_str(),
+                        action.destination.toString().c_str()));
+            } else {
+                result.append(format("split %lu:0x%lx-0x%lx on %s",
+                        action.tableId, action.startKeyHash,
+                        action.endKeyHash, action.source.toString().c_str()));
+            }
+        }
+        return result;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(TabletBalancerTest);
+};
+
+TEST_F(TabletBalancerTest, start_disabled) {
+    TabletBalancer::Config config;
+    balancer.start(config);
+    EXPECT_FALSE(balancer.thread);
+}
+
+TEST_F(TabletBalancerTest, startAndHalt) {
+    TabletBalancer::Config config;
+    config.intervalSeconds = 1000;
+    balancer.start(config);
+    EXPECT_TRUE(balancer.thread);
+    TestLog::reset();
+    balancer.halt();
+    EXPECT_FALSE(balancer.thread);
+    EXPECT_EQ("balanceLoop: Balancer exited", TestLog::get());
+}
+
+TEST_F(TabletBalancerTest, collectStatistics) {
+    cluster.addServer(masterConfig);
+    cluster.addServer(masterConfig);
+    tableManager->createTable("foo", 2);
+    std::vector<TabletBalancer::MasterStatistics> statistics;
+    balancer.collectStatistics(&statistics);
+    ASSERT_EQ(2u, statistics.size());
+    EXPECT_EQ(ServerId(1, 0), statistics[0].first);
+    EXPECT_EQ(1, statistics[0].second.tabletentry_size());
+    EXPECT_EQ(ServerId(2, 0), statistics[1].first);
+    EXPECT_EQ(1, statistics[1].second.tabletentry_size());
+}
+
+TEST_F(TabletBalancerTest, computeLoads) {
+    std::vector<TabletBalancer::MasterStatistics> statistics;
+    statistics.emplace_back(ServerId(1, 0), ProtoBuf::ServerStatistics());
+    addEntry(&statistics[0], 1, 0, 0x7fff, 1000);
+    addEntry(&statistics[0], 1, 0x8000, 0xffff, 500);
+    statistics.emplace_back(ServerId(2, 0), ProtoBuf::ServerStatistics());
+    addEntry(&statistics[1], 2, 0, 0xffff, 100);
+
+    // First sample: no rates known yet.
+    std::vector<TabletBalancer::MasterLoad> loads;
+    balancer.computeLoads(statistics, 0, &loads);
+    ASSERT_EQ(2u, loads.size());
+    EXPECT_FALSE(loads[0].settled);
+    EXPECT_FALSE(loads[1].settled);
+    EXPECT_EQ(-1, loads[0].tablets[0].opsPerSecond);
+
+    // Second sample: table 2 was split, so master 2 is unsettled.
+    statistics[0].second.mutable_tabletentry(0)->
+            set_number_read_and_writes(3000);
+    statistics[0].second.mutable_tabletentry(1)->
+            set_number_read_and_writes(1500);
+    statistics[1].second.mutable_tabletentry(0)->set_end_key_hash(0x7fff);
+    addEntry(&statistics[1], 2, 0x8000, 0xffff, 0);
+    loads.clear();
+    balancer.computeLoads(statistics, 2.0, &loads);
+    EXPECT_TRUE(loads[0].settled);
+    EXPECT_DOUBLE_EQ(1500.0, loads[0].opsPerSecond);
+    EXPECT_DOUBLE_EQ(1000.0, loads[0].tablets[0].opsPerSecond);
+    EXPECT_DOUBLE_EQ(500.0, loads[0].tablets[1].opsPerSecond);
+    EXPECT_FALSE(loads[1].settled);
+    EXPECT_EQ(4u, balancer.samples.size());
+
+    // Third sample: a tablet moves from master 1 to master 2.
+    statistics[0].second.mutable_tabletentry()->RemoveLast();
+    addEntry(&statistics[1], 1, 0x8000, 0xffff, 1500);
+    loads.clear();
+    balancer.computeLoads(statistics, 1.0, &loads);
+    EXPECT_TRUE(loads[0].settled);
+    EXPECT_DOUBLE_EQ(0.0, loads[0].opsPerSecond);
+    EXPECT_FALSE(loads[1].settled);
+    EXPECT_EQ(-1, loads[1].tablets[2].opsPerSecond);
+}
+
+TEST_F(TabletBalancerTest, planActions_migrate) {
+    std::vector<TabletBalancer::MasterLoad> loads;
+    loads.emplace_back(ServerId(1, 0));
+    addTablet(&loads[0], 1, 0, 0xff, 20000);
+    addTablet(&loads[0], 2, 0, 0xff, 8000);
+    addTablet(&loads[0], 3, 0, 0xff, 2000);
+    loads.emplace_back(ServerId(2, 0));
+    addTablet(&loads[1], 4, 0, 0xff, 1000);
+    loads.emplace_back(ServerId(3, 0));
+    addTablet(&loads[2], 5, 0, 0xff, 5000);
+
+    std::vector<TabletBalancer::Action> actions;
+    balancer.planActions(&loads, &actions);
+    EXPECT_EQ("migrate 2:0x0-0xff 1.0 -> 2.0", toString(actions));
+    EXPECT_FALSE(loads[0].settled);
+    EXPECT_FALSE(loads[1].settled);
+    EXPECT_TRUE(loads[2].settled);
+}
+
+TEST_F(TabletBalancerTest, planActions_splitHotTablet) {
+    std::vector<TabletBalancer::MasterLoad> loads;
+    loads.emplace_back(ServerId(1, 0));
+    addTablet(&loads[0], 1, 0, 0xff, 20000);
+    loads.emplace_back(ServerId(2, 0));
+    addTablet(&loads[1], 2, 0, 0xff, 1000);
+
+    std::vector<TabletBalancer::Action> actions;
+    balancer.planActions(&loads, &actions);
+    EXPECT_EQ("split 1:0x0-0xff on 1.0", toString(actions));
+    EXPECT_TRUE(loads[1].settled);
+
+    // Table already has the maximum number of tablets.
+    loads[0].settled = true;
+    actions.clear();
+    balancer.config.maxTabletsPerTable = 1;
+    balancer.planActions(&loads, &actions);
+    EXPECT_EQ("", toString(actions));
+
+    // Tablet contains a single key hash.
+    loads[0].tablets[0].endKeyHash = 0;
+    actions.clear();
+    balancer.config.maxTabletsPerTable = 10;
+    balancer.planActions(&loads, &actions);
+    EXPECT_EQ("", toString(actions));
+}
+
+TEST_F(TabletBalancerTest, planActions_thresholds) {
+    std::vector<TabletBalancer::MasterLoad> loads;
+    loads.emplace_back(ServerId(1, 0));
+    addTablet(&loads[0], 1, 0, 0xff, 900);
+    addTablet(&loads[0], 2, 0, 0xff, 100);
+    loads.emplace_back(ServerId(2, 0));
+    addTablet(&loads[1], 3, 0, 0xff, 0);
+    std::vector<TabletBalancer::Action> actions;
+
+    // Busiest master isn't busy enough.
+    balancer.config.minOpsPerSecond = 1001;
+    balancer.planActions(&loads, &actions);
+    EXPECT_EQ("", toString(actions));
+
+    // Load isn't imbalanced enough.
+    balancer.config.minOpsPerSecond = 1000;
+    balancer.config.imbalanceRatio = 2.0;
+    balancer.planActions(&loads, &actions);
+    EXPECT_EQ("", toString(actions));
+
+    balancer.config.imbalanceRatio = 1.5;
+    balancer.planActions(&loads, &actions);
+    EXPECT_EQ("migrate 2:0x0-0xff 1.0 -> 2.0", toString(actions));
+}
+
+TEST_F(TabletBalancerTest, planActions_unsettledMasters) {
+    std::vector<TabletBalancer::MasterLoad> loads;
+    loads.emplace_back(ServerId(1, 0));
+    addTablet(&loads[0], 1, 0, 0xff, 20000);
+    addTablet(&loads[0], 2, 0, 0xff, 5000);
+    loads.emplace_back(ServerId(2, 0));
+    addTablet(&loads[1], 3, 0, 0xff, -1);
+    std::vector<TabletBalancer::Action> actions;
+    balancer.planActions(&loads, &actions);
+    EXPECT_EQ("", toString(actions));
+}
+
+TEST_F(TabletBalancerTest, planActions_multipleActions) {
+    std::vector<TabletBalancer::MasterLoad> loads;
+    loads.emplace_back(ServerId(1, 0));
+    addTablet(&loads[0], 1, 0, 0xff, 20000);
+    addTablet(&loads[0], 2, 0, 0xff, 5000);
+    loads.emplace_back(ServerId(2, 0));
+    addTablet(&loads[1], 3, 0, 0xff, 16000);
+    addTablet(&loads[1], 4, 0, 0xff, 4000);
+    loads.emplace_back(ServerId(3, 0));
+    loads.emplace_back(ServerId(4, 0));
+    std::vector<TabletBalancer::Action> actions;
+
+    balancer.config.maxActionsPerRound = 3;
+    balancer.config.imbalanceRatio = 1.2;
+    balancer.planActions(&loads, &actions);
+    EXPECT_EQ("migrate 2:0x0-0xff 1.0 -> 3.0 | "
+            "migrate 4:0x0-0xff 2.0 -> 4.0", toString(actions));
+}
+
+TEST_F(TabletBalancerTest, performAction_split) {
+    cluster.addServer(masterConfig);
+    tableManager->createTable("foo", 1);
+    TabletBalancer::TabletLoad tablet(1, 0, ~0UL, 10000);
+    TabletBalancer::Action action(TabletBalancer::Action::SPLIT,
+            ServerId(1, 0), tablet);
+    balancer.performAction(action);
+    EXPECT_EQ("{ foo(id 1): "
+            "{ 0x0-0x7fffffffffffffff on 1.0 } "
+            "{ 0x8000000000000000-0xffffffffffffffff on 1.0 } }",
+            tableManager->debugString(true));
+}
+
+TEST_F(TabletBalancerTest, performAction_tabletChanged) {
+    cluster.addServer(masterConfig);
+    tableManager->createTable("foo", 1);
+    TabletBalancer::TabletLoad tablet(1, 0, 0x7fffffffffffffff, 10000);
+    TabletBalancer::Action action(TabletBalancer::Action::MIGRATE,
+            ServerId(1, 0), tablet);
+    action.destination = ServerId(2, 0);
+    TestLog::reset();
+    balancer.performAction(action);
+    EXPECT_EQ("performAction: Tablet 0x0-0x7fffffffffffffff in table 1 "
+            "changed since statistics were collected; not migrating it",
+            TestLog::get());
+}
+
+TEST_F(TabletBalancerTest, performAction_noSuchTable) {
+    TabletBalancer::TabletLoad tablet(5, 0, 0xff, 10000);
+    TabletBalancer::Action action(TabletBalancer::Action::MIGRATE,
+            ServerId(1, 0), tablet);
+    TestLog::reset();
+    balancer.performAction(action);
+    EXPECT_TRUE(TestUtil::contains(TestLog::get(),
+            "Balancer couldn't migrate tablet 0x0-0xff in table 5"));
+}
+
+TEST_F(TabletBalancerTest, splitPoint) {
+    EXPECT_EQ(0x8000000000000000UL,
+            TabletBalancer::splitPoint(0, 0xffffffffffffffffUL));
+    EXPECT_EQ(0x81UL, TabletBalancer::splitPoint(0x80, 0x81));
+    EXPECT_EQ(0x180UL, TabletBalancer::splitPoint(0x100, 0x1ff));
+}
+
+}  // namespace RAMCloud
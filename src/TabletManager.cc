@@ -62,7 +62,7 @@ TabletManager::addTablet(uint64_t tableId,
     tabletMap.insert(std::make_pair(tableId,
                      Tablet(tableId, startKeyHash, endKeyHash, state)));
 
-    if (state == TabletState::NOT_READY) {
+    if (isLoading(state)) {
         numLoadingTablets++;
     }
 
@@ -71,7 +71,9 @@ TabletManager::addTablet(uint64_t tableId,
 
 /**
  * Given a key, determine whether a tablet exists for this key and has status
- * NORMAL.  We simultaneously increments the read count on the tablet. This is
+ * NORMAL (or RECOVERED_READ_ONLY or LOCKED_FOR_PULL, since this is only used
+ * for reads).  We
+ * simultaneously increments the read count on the tablet. This is
  * called by ObjectManger::readObject to avoid looking up the Tablet twice, for
  * verification of state and incrementing the read count.
  *
@@ -87,7 +89,9 @@ TabletManager::checkAndIncrementReadCount(Key& key) {
 
     if (it == tabletMap.end())
         return false;
-    if (it->second.state != NORMAL) {
+    if (it->second.state != NORMAL &&
+            it->second.state != RECOVERED_READ_ONLY &&
+            it->second.state != LOCKED_FOR_PULL) {
         if (it->second.state == TabletManager::LOCKED_FOR_MIGRATION)
             throw RetryException(HERE, 1000, 2000,
                     "Tablet is currently locked for migration!");
@@ -250,7 +254,7 @@ TabletManager::deleteTablet(uint64_t tableId,
 
     tabletMap.erase(it);
 
-    if (t->state == TabletState::NOT_READY) {
+    if (isLoading(t->state)) {
         numLoadingTablets--;
     }
 
@@ -300,7 +304,7 @@ TabletManager::splitTablet(uint64_t tableId,
         // stick with that. At the very least it's what Christian expects.
         t->readCount = t->writeCount = 0;
 
-        if (t->state == TabletState::NOT_READY) {
+        if (isLoading(t->state)) {
             numLoadingTablets++;
         }
     }
@@ -352,9 +356,9 @@ TabletManager::changeState(uint64_t tableId,
     t->state = newState;
 
     assert(oldState != newState);
-    if (newState == TabletState::NOT_READY) {
+    if (isLoading(newState) && !isLoading(oldState)) {
         numLoadingTablets++;
-    } else if (oldState == TabletState::NOT_READY) {
+    } else if (isLoading(oldState) && !isLoading(newState)) {
         numLoadingTablets--;
     }
 
@@ -552,10 +556,11 @@ TabletManager::Protector::Protector(TabletManager* tabletManager)
 }
 
 /**
- * Tells whether any tablet in this master is in NOT_READY status.
+ * Tells whether any tablet in this master is in NOT_READY (or
+ * RECOVERED_READ_ONLY) status.
  *
  * \return
- *      true if there is a tablet with NOT_READY status.
+ *      true if there is a tablet with NOT_READY or RECOVERED_READ_ONLY status.
  */
 bool
 TabletManager::Protector::notReadyTabletExists()
@@ -59,6 +59,14 @@ class TabletManager {
         NOT_READY = 1,
         /// Migration of tablet is requested. Cannot take new writes.
         LOCKED_FOR_MIGRATION = 2,
+        /// Recovery has replayed all of the tablet's data, but the data
+        /// isn't durable yet and the coordinator hasn't handed the tablet
+        /// over. Reads are allowed; writes are not.
+        RECOVERED_READ_ONLY = 3,
+        /// The tablet is being pulled by its new owner (see
+        /// MasterService::pullTablet). Its data stays here, unchanged,
+        /// until ownership moves, so reads are allowed; writes are not.
+        LOCKED_FOR_PULL = 4,
     };
 
     /**
@@ -182,7 +190,22 @@ class TabletManager {
     size_t getNumTablets();
     string toString();
 
+    /// Returns true if a tablet in \a state is being migrated to another
+    /// master and can't take writes until that finishes; writers should
+    /// retry.
+    static bool isLockedForMigration(TabletState state)
+    {
+        return state == LOCKED_FOR_MIGRATION || state == LOCKED_FOR_PULL;
+    }
+
   PRIVATE:
+    /// Returns true if a tablet in \a state is still being recovered or
+    /// migrated in (see #numLoadingTablets).
+    static bool isLoading(TabletState state)
+    {
+        return state == NOT_READY || state == RECOVERED_READ_ONLY;
+    }
+
     /// Tablets are stored in a multimap that is indexed by table identifier.
     /// The assumption is that we are likely to have many tablets, but
     /// relatively few for the same table.
@@ -197,8 +220,8 @@ class TabletManager {
     /// Monitor spinlock used to protect the tabletMap from concurrent access.
     SpinLock lock;
 
-    /// Count of tablets whose status is NOT_READY. Used to determine if there
-    /// is any ongoing recovery.
+    /// Count of tablets whose status is NOT_READY or RECOVERED_READ_ONLY.
+    /// Used to determine if there is any ongoing recovery.
     /// Main use case is to prevent UnackedRpcResult::cleanByTimeout() from
     /// accidentally garbage collect the RpcResults of an expired client
     /// before corresponding transaction to complete.
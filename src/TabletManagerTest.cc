@@ -254,6 +254,38 @@ TEST_F(TabletManagerTest, numLoadingTablets) {
     EXPECT_EQ(2, tm.numLoadingTablets);
 }
 
+TEST_F(TabletManagerTest, recoveredReadOnly) {
+    Key key(0, "1", 1);
+    EXPECT_TRUE(tm.addTablet(0, 0, ~0UL, TabletManager::NOT_READY));
+    EXPECT_FALSE(tm.checkAndIncrementReadCount(key));
+
+    // Still loading, but reads are allowed.
+    EXPECT_TRUE(tm.changeState(0, 0, ~0UL, TabletManager::NOT_READY,
+                                           TabletManager::RECOVERED_READ_ONLY));
+    EXPECT_EQ(1, tm.numLoadingTablets);
+    EXPECT_TRUE(tm.checkAndIncrementReadCount(key));
+
+    EXPECT_TRUE(tm.changeState(0, 0, ~0UL, TabletManager::RECOVERED_READ_ONLY,
+                                           TabletManager::NORMAL));
+    EXPECT_EQ(0, tm.numLoadingTablets);
+}
+
+TEST_F(TabletManagerTest, lockedForPull) {
+    Key key(0, "1", 1);
+    EXPECT_TRUE(tm.addTablet(0, 0, ~0UL, TabletManager::NORMAL));
+
+    // Writes must retry, but reads are allowed.
+    EXPECT_TRUE(tm.changeState(0, 0, ~0UL, TabletManager::NORMAL,
+                                           TabletManager::LOCKED_FOR_PULL));
+    EXPECT_TRUE(TabletManager::isLockedForMigration(
+            TabletManager::LOCKED_FOR_PULL));
+    EXPECT_TRUE(tm.checkAndIncrementReadCount(key));
+
+    EXPECT_TRUE(tm.changeState(0, 0, ~0UL, TabletManager::LOCKED_FOR_PULL,
+            TabletManager::LOCKED_FOR_MIGRATION));
+    EXPECT_THROW(tm.checkAndIncrementReadCount(key), RetryException);
+}
+
 TEST_F(TabletManagerTest, getStatistics) {
     {
         ProtoBuf::ServerStatistics stats;
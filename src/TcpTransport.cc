@@ -17,13 +17,27 @@
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
+#include <linux/errqueue.h>
 
 #include "Common.h"
+#include "Cycles.h"
 #include "PerfStats.h"
 #include "ShortMacros.h"
 #include "TcpTransport.h"
 #include "WorkerManager.h"
 
+// Older system headers may not define the zero-copy constants, even
+// though the running kernel supports them.
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+#ifndef SO_EE_ORIGIN_ZEROCOPY
+#define SO_EE_ORIGIN_ZEROCOPY 5
+#endif
+
 namespace RAMCloud {
 
 int TcpTransport::messageChunks = 0;
@@ -50,6 +64,9 @@ Syscall* TcpTransport::sys = &defaultSyscall;
  *      RPC requests as well as make outgoing requests; this parameter
  *      specifies the (local) address on which to listen for connections.
  *      If NULL this transport will be used only for outgoing requests.
+ *      The "zeroCopy", "rxBuffer", and "txBatch" options enable
+ *      higher-throughput modes; see the documentation for
+ *      zeroCopyThreshold, inputBufferSize, and batchReplies.
  *
  * \throw TransportException
  *      There was a problem that prevented us from creating the transport.
@@ -60,6 +77,13 @@ TcpTransport::TcpTransport(Context* context,
     , locatorString()
     , listenSocket(-1)
     , acceptHandler()
+    , zeroCopyThreshold(0)
+    , inputBufferSize(0)
+    , batchReplies(false)
+    , socketsToFlush()
+    , flushPoller()
+    , lingeringSockets()
+    , lingerTimer()
     , sockets()
     , nextSocketId(100)
     , serverRpcPool()
@@ -69,6 +93,9 @@ TcpTransport::TcpTransport(Context* context,
         return;
     IpAddress address(serviceLocator);
     locatorString = serviceLocator->getOriginalString();
+    zeroCopyThreshold = serviceLocator->getOption<uint32_t>("zeroCopy", 0);
+    inputBufferSize = serviceLocator->getOption<uint32_t>("rxBuffer", 0);
+    batchReplies = serviceLocator->getOption<bool>("txBatch", false);
 
     listenSocket = sys->socket(PF_INET, SOCK_STREAM, 0);
     if (listenSocket == -1) {
@@ -118,6 +145,9 @@ TcpTransport::TcpTransport(Context* context,
 
     // Arrange to be notified whenever anyone connects to listenSocket.
     acceptHandler.construct(listenSocket, this);
+    if (batchReplies) {
+        flushPoller.construct(this);
+    }
 }
 
 /**
@@ -135,19 +165,64 @@ TcpTransport::~TcpTransport()
             closeSocket(i);
         }
     }
+
+    // The transport is going away, so there's no way to keep tracking
+    // these replies.
+    for (size_t i = 0; i < lingeringSockets.size(); i++) {
+        LingeringSocket* lingering = lingeringSockets[i];
+        while (!lingering->rpcsWaitingForCompletion.empty()) {
+            TcpServerRpc& rpc = lingering->rpcsWaitingForCompletion.front();
+            lingering->rpcsWaitingForCompletion.pop_front();
+            serverRpcPool.destroy(&rpc);
+        }
+        sys->close(lingering->fd);
+        delete lingering;
+    }
+    lingeringSockets.clear();
 }
 
 /**
  * This private method is invoked to close the server's end of a
  * connection to a client and cleanup any related state.
+ *
+ * If the kernel may still be transmitting zero-copy replies on the
+ * connection, the file descriptor isn't closed right away: it and
+ * the replies are moved to lingeringSockets, and reapLingeringSockets
+ * releases them once the kernel is done with the reply buffers.
+ * Otherwise the log cleaner could reuse memory that the NIC is still
+ * reading from.
+ *
  * \param fd
  *      File descriptor for the socket to be closed.
  */
 void
 TcpTransport::closeSocket(int fd) {
-    delete sockets[fd];
+    Socket* socket = sockets[fd];
     sockets[fd] = NULL;
-    sys->close(fd);
+    if (!socket->rpcsWaitingForCompletion.empty()) {
+        reapZeroCopyCompletions(fd, &socket->zeroCopyCompleted,
+                &socket->rpcsWaitingForCompletion);
+    }
+    if (socket->rpcsWaitingForCompletion.empty()) {
+        delete socket;
+        sys->close(fd);
+        return;
+    }
+
+    LingeringSocket* lingering = new LingeringSocket(fd,
+            socket->zeroCopyCompleted);
+    lingering->rpcsWaitingForCompletion.splice(
+            lingering->rpcsWaitingForCompletion.end(),
+            socket->rpcsWaitingForCompletion);
+    lingeringSockets.push_back(lingering);
+    delete socket;
+    if (!lingerTimer) {
+        lingerTimer.construct(this);
+    }
+    if (!lingerTimer->isRunning()) {
+        lingerTimer->start(Cycles::rdtsc() + Cycles::fromMicroseconds(
+                LINGER_POLL_MICROS));
+    }
 }
 
 /**
@@ -158,11 +233,19 @@ TcpTransport::Socket::Socket(int fd, TcpTransport* transport, sockaddr_in& sin)
     , id(transport->nextSocketId)
     , rpc(NULL)
     , ioHandler(fd, transport, this)
+    , input()
     , rpcsWaitingToReply()
     , bytesLeftToSend(0)
+    , zeroCopy(false)
+    , zeroCopySends(0)
+    , zeroCopyCompleted(0)
+    , rpcsWaitingForCompletion()
     , sin(sin)
 {
     transport->nextSocketId++;
+    if (transport->inputBufferSize != 0) {
+        input.construct(transport->inputBufferSize);
+    }
 }
 
 /**
@@ -177,6 +260,10 @@ TcpTransport::Socket::~Socket() {
         rpcsWaitingToReply.pop_front();
         transport->serverRpcPool.destroy(&rpc);
     }
+
+    // closeSocket hands RPCs that the kernel may still be transmitting
+    // from over to a LingeringSocket.
+    assert(rpcsWaitingForCompletion.empty());
 }
 
 
@@ -262,7 +349,18 @@ TcpTransport::AcceptHandler::handleFileEvent(int events)
             static_cast<unsigned int>(acceptedFd)) {
         transport->sockets.resize(acceptedFd + 1);
     }
-    transport->sockets[acceptedFd] = new Socket(acceptedFd, transport, sin);
+    Socket* socket = new Socket(acceptedFd, transport, sin);
+    transport->sockets[acceptedFd] = socket;
+
+    if (transport->zeroCopyThreshold != 0) {
+        if (sys->setsockopt(acceptedFd, SOL_SOCKET, SO_ZEROCOPY, &flag,
+                sizeof(flag)) == 0) {
+            socket->zeroCopy = true;
+        } else {
+            RAMCLOUD_CLOG(WARNING, "TcpTransport couldn't enable SO_ZEROCOPY "
+                    "(replies will be copied): %s", strerror(errno));
+        }
+    }
 }
 
 /**
@@ -308,16 +406,33 @@ TcpTransport::ServerSocketHandler::handleFileEvent(int events)
     Socket* socket = transport->sockets[socketFd];
     assert(socket != NULL);
     try {
+        if (!socket->rpcsWaitingForCompletion.empty()) {
+            transport->reapZeroCopyCompletions(fd,
+                    &socket->zeroCopyCompleted,
+                    &socket->rpcsWaitingForCompletion);
+        }
         if (events & Dispatch::FileEvent::READABLE) {
-            if (socket->rpc == NULL) {
-                socket->rpc = transport->serverRpcPool.construct(socket,
-                                                                 fd, transport);
-            }
-            if (socket->rpc->message.readMessage(fd)) {
-                // The incoming request is complete; pass it off for servicing.
+            // If there is an InputBuffer, keep reading requests as long as
+            // it holds data: the kernel won't tell us about those bytes
+            // again.
+            while (true) {
+                if (socket->rpc == NULL) {
+                    socket->rpc = transport->serverRpcPool.construct(socket,
+                            fd, transport);
+                }
+                if (!socket->rpc->message.readMessage(fd,
+                        socket->input.get())) {
+                    break;
+                }
+
+                // The incoming request is complete; pass it off for
+                // servicing.
                 TcpServerRpc *rpc = socket->rpc;
                 socket->rpc = NULL;
                 transport->context->workerManager->handleRpc(rpc);
+                if (!socket->input || (socket->input->available() == 0)) {
+                    break;
+                }
             }
         }
         // Check to see if this socket got closed due to an error in the
@@ -329,23 +444,8 @@ TcpTransport::ServerSocketHandler::handleFileEvent(int events)
             return;
         }
         if (events & Dispatch::FileEvent::WRITABLE) {
-            while (true) {
-                if (socket->rpcsWaitingToReply.empty()) {
-                    setEvents(Dispatch::FileEvent::READABLE);
-                    break;
-                }
-                TcpServerRpc& rpc = socket->rpcsWaitingToReply.front();
-                socket->bytesLeftToSend = TcpTransport::sendMessage(fd,
-                        rpc.message.header.nonce, &rpc.replyPayload,
-                        socket->bytesLeftToSend);
-                if (socket->bytesLeftToSend != 0) {
-                    break;
-                }
-                // The current reply is finished; start the next one, if
-                // there is one.
-                socket->rpcsWaitingToReply.pop_front();
-                transport->serverRpcPool.destroy(&rpc);
-                socket->bytesLeftToSend = -1;
+            if (transport->sendQueuedReplies(socket)) {
+                setEvents(Dispatch::FileEvent::READABLE);
             }
         }
     } catch (TransportException& e) {
@@ -371,6 +471,12 @@ TcpTransport::ServerSocketHandler::handleFileEvent(int events)
  *      Anything else means that part of the message was transmitted
  *      in a previous call, and the value of this parameter is the
  *      result returned by that call (always greater than 0).
+ * \param zeroCopySends
+ *      If non-NULL, the message is transmitted with MSG_ZEROCOPY (fd must
+ *      have SO_ZEROCOPY enabled) and the referenced counter is incremented
+ *      if any bytes were sent. In this case the payload memory must not
+ *      be modified or freed until the kernel has reported completion of
+ *      the send.
  *
  * \return
  *      The number of (trailing) bytes that could not be transmitted.
@@ -381,7 +487,7 @@ TcpTransport::ServerSocketHandler::handleFileEvent(int events)
  */
 int
 TcpTransport::sendMessage(int fd, uint64_t nonce, Buffer* payload,
-        int bytesToSend)
+        int bytesToSend, uint32_t* zeroCopySends)
 {
     assert(fd >= 0);
 
@@ -432,8 +538,15 @@ TcpTransport::sendMessage(int fd, uint64_t nonce, Buffer* payload,
     msg.msg_iov = iov;
     msg.msg_iovlen = iovecIndex;
 
-    int r = downCast<int>(sys->sendmsg(fd, &msg,
-            MSG_NOSIGNAL|MSG_DONTWAIT));
+    int flags = MSG_NOSIGNAL|MSG_DONTWAIT;
+    if (zeroCopySends != NULL) {
+        flags |= MSG_ZEROCOPY;
+    }
+    int r = downCast<int>(sys->sendmsg(fd, &msg, flags));
+    PerfStats::threadStats.networkOutputSyscalls++;
+    if ((zeroCopySends != NULL) && (r > 0)) {
+        (*zeroCopySends)++;
+    }
     if (r == bytesToSend) {
         PerfStats::threadStats.networkOutputBytes += r;
         return 0;
@@ -455,6 +568,406 @@ TcpTransport::sendMessage(int fd, uint64_t nonce, Buffer* payload,
     return bytesToSend - r;
 }
 
+/**
+ * Transmit several RPC requests or responses on a socket with a single
+ * kernel call. This method uses a nonblocking approach: it transmits as
+ * many bytes as possible and returns information about how much more work
+ * is still left to do.
+ *
+ * \param fd
+ *      File descriptor to write.
+ * \param messages
+ *      The messages to transmit, in order; this method adds on headers.
+ * \param count
+ *      Number of entries in messages; must be between 1 and
+ *      MAX_MESSAGES_PER_SEND.
+ * \param bytesLeftToSend
+ *      On entry, the number of (trailing) bytes in the first message that
+ *      still need to be transmitted; -1 or 0 means the entire message.
+ *      On return, the corresponding value for the first message that could
+ *      not be transmitted completely, or 0 if all messages were sent.
+ *
+ * \return
+ *      The number of messages (starting with the first) that were completely
+ *      transmitted.
+ *
+ * \throw TransportException
+ *      An I/O error occurred.
+ */
+uint32_t
+TcpTransport::sendMessages(int fd, OutgoingMessage* messages, uint32_t count,
+        int* bytesLeftToSend)
+{
+    assert(fd >= 0);
+    assert((count > 0) && (count <= MAX_MESSAGES_PER_SEND));
+
+    Header headers[MAX_MESSAGES_PER_SEND];
+    int lengths[MAX_MESSAGES_PER_SEND];
+    for (uint32_t i = 0; i < count; i++) {
+        headers[i].nonce = messages[i].nonce;
+        headers[i].len = messages[i].payload->size();
+        lengths[i] = downCast<int>(sizeof(Header) + headers[i].len);
+    }
+    int firstRemaining = (*bytesLeftToSend > 0) ? *bytesLeftToSend
+            : lengths[0];
+
+    // Build one iovec array covering as many of the messages as will fit
+    // (see sendMessage for the limit on iovecs).
+    const int maxIovecs = 100;
+    struct iovec iov[maxIovecs];
+    int iovecIndex = 0;
+    for (uint32_t i = 0; (i < count) && (iovecIndex < maxIovecs); i++) {
+        int alreadySent = (i == 0) ? (lengths[0] - firstRemaining) : 0;
+        uint32_t offset;
+        if (alreadySent < downCast<int>(sizeof(Header))) {
+            iov[iovecIndex].iov_base = reinterpret_cast<char*>(&headers[i])
+                    + alreadySent;
+            iov[iovecIndex].iov_len = sizeof(Header) - alreadySent;
+            ++iovecIndex;
+            offset = 0;
+        } else {
+            offset = alreadySent - downCast<uint32_t>(sizeof(Header));
+        }
+        Buffer::Iterator iter(messages[i].payload, offset,
+                headers[i].len - offset);
+        while (!iter.isDone() && (iovecIndex < maxIovecs)) {
+            iov[iovecIndex].iov_base = const_cast<void*>(iter.getData());
+            iov[iovecIndex].iov_len = iter.getLength();
+            ++iovecIndex;
+            iter.next();
+        }
+    }
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = iovecIndex;
+    int r = downCast<int>(sys->sendmsg(fd, &msg, MSG_NOSIGNAL|MSG_DONTWAIT));
+    PerfStats::threadStats.networkOutputSyscalls++;
+    if (r == -1) {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+            LOG(WARNING, "TcpTransport sendmsg error: %s", strerror(errno));
+            throw TransportException(HERE, "TcpTransport sendmsg error",
+                    errno);
+        }
+        r = 0;
+    }
+    PerfStats::threadStats.networkOutputBytes += r;
+
+    // Figure out which messages are now complete.
+    uint32_t finished = 0;
+    int remaining = firstRemaining;
+    while (r >= remaining) {
+        r -= remaining;
+        finished++;
+        if (finished == count) {
+            *bytesLeftToSend = 0;
+            return finished;
+        }
+        remaining = lengths[finished];
+    }
+    *bytesLeftToSend = remaining - r;
+    return finished;
+}
+
+/**
+ * Transmit as many as possible of the responses waiting on a socket's
+ * rpcsWaitingToReply list. Consecutive responses are combined into a
+ * single kernel call, except those large enough to use MSG_ZEROCOPY,
+ * which are sent individually.
+ *
+ * \param socket
+ *      Connection whose responses are to be sent.
+ * \return
+ *      True means all of the responses have been handed off to the
+ *      kernel; false means the socket is backed up and the caller
+ *      should wait for it to become writable.
+ *
+ * \throw TransportException
+ *      An I/O error occurred.
+ */
+bool
+TcpTransport::sendQueuedReplies(Socket* socket)
+{
+    while (!socket->rpcsWaitingToReply.empty()) {
+        TcpServerRpc& first = socket->rpcsWaitingToReply.front();
+        if (socket->zeroCopy &&
+                (first.replyPayload.size() >= zeroCopyThreshold)) {
+            socket->bytesLeftToSend = sendReplyMessage(socket, &first,
+                    socket->bytesLeftToSend);
+            if (socket->bytesLeftToSend != 0) {
+                return false;
+            }
+            socket->rpcsWaitingToReply.pop_front();
+            finishReply(socket, &first);
+            socket->bytesLeftToSend = -1;
+            continue;
+        }
+
+        OutgoingMessage messages[MAX_MESSAGES_PER_SEND];
+        uint32_t count = 0;
+        int fd = first.fd;
+        foreach (TcpServerRpc& rpc, socket->rpcsWaitingToReply) {
+            if (socket->zeroCopy &&
+                    (rpc.replyPayload.size() >= zeroCopyThreshold)) {
+                break;
+            }
+            messages[count].nonce = rpc.message.header.nonce;
+            messages[count].payload = &rpc.replyPayload;
+            count++;
+            if (count == MAX_MESSAGES_PER_SEND) {
+                break;
+            }
+        }
+        uint32_t finished = sendMessages(fd, messages, count,
+                &socket->bytesLeftToSend);
+        for (uint32_t i = 0; i < finished; i++) {
+            TcpServerRpc& rpc = socket->rpcsWaitingToReply.front();
+            socket->rpcsWaitingToReply.pop_front();
+            finishReply(socket, &rpc);
+        }
+        if (socket->bytesLeftToSend != 0) {
+            return false;
+        }
+        socket->bytesLeftToSend = -1;
+    }
+    return true;
+}
+
+/**
+ * Constructor for FlushPollers.
+ *
+ * \param transport
+ *      The TcpTransport whose queued replies this poller will send.
+ */
+TcpTransport::FlushPoller::FlushPoller(TcpTransport* transport)
+    : Dispatch::Poller(transport->context->dispatch,
+            "TcpTransport::FlushPoller")
+    , transport(transport)
+{
+    // Empty constructor body.
+}
+
+/**
+ * Invoked by the dispatcher during each pass through its polling loop;
+ * transmits replies that sendReply queued since the last call.
+ *
+ * \return
+ *      1 if any sockets had replies to flush, 0 otherwise.
+ */
+int
+TcpTransport::FlushPoller::poll()
+{
+    if (transport->socketsToFlush.empty()) {
+        return 0;
+    }
+    for (size_t i = 0; i < transport->socketsToFlush.size(); i++) {
+        int fd = transport->socketsToFlush[i].first;
+        Socket* socket = transport->sockets[fd];
+
+        // The connection may have been closed (and the fd perhaps reused)
+        // since the reply was queued; if so, its replies are already gone.
+        if ((socket == NULL) ||
+                (socket->id != transport->socketsToFlush[i].second)) {
+            continue;
+        }
+        try {
+            if (!transport->sendQueuedReplies(socket)) {
+                socket->ioHandler.setEvents(Dispatch::FileEvent::READABLE |
+                        Dispatch::FileEvent::WRITABLE);
+            }
+        } catch (TransportException& e) {
+            transport->closeSocket(fd);
+        }
+    }
+    transport->socketsToFlush.clear();
+    return 1;
+}
+
+/**
+ * Transmit as much as possible of the response for a server-side RPC,
+ * using MSG_ZEROCOPY if the response is large enough and the socket
+ * supports it.
+ *
+ * \param socket
+ *      Connection on which the response is to be sent.
+ * \param rpc
+ *      RPC whose replyPayload is to be sent; must be the first RPC
+ *      (if any) on socket->rpcsWaitingToReply.
+ * \param bytesToSend
+ *      -1 means the entire response must still be transmitted; see
+ *      sendMessage for other values.
+ * \return
+ *      The number of (trailing) bytes that could not be transmitted;
+ *      see sendMessage.
+ *
+ * \throw TransportException
+ *      An I/O error occurred.
+ */
+int
+TcpTransport::sendReplyMessage(Socket* socket, TcpServerRpc* rpc,
+        int bytesToSend)
+{
+    if (!socket->zeroCopy ||
+            (rpc->replyPayload.size() < zeroCopyThreshold)) {
+        return sendMessage(rpc->fd, rpc->message.header.nonce,
+                &rpc->replyPayload, bytesToSend);
+    }
+    int result = sendMessage(rpc->fd, rpc->message.header.nonce,
+            &rpc->replyPayload, bytesToSend, &socket->zeroCopySends);
+    rpc->usedZeroCopy = true;
+    rpc->zeroCopyEnd = socket->zeroCopySends;
+    return result;
+}
+
+/**
+ * This method is invoked once the response for a server-side RPC has
+ * been completely handed off to the kernel. It recycles the RPC, unless
+ * the kernel may still be transmitting directly from its reply buffer,
+ * in which case recycling is deferred until reapZeroCopyCompletions
+ * finds that the kernel is done.
+ *
+ * \param socket
+ *      Connection on which the response was sent.
+ * \param rpc
+ *      The RPC; must not be linked on any list.
+ */
+void
+TcpTransport::finishReply(Socket* socket, TcpServerRpc* rpc)
+{
+    if (rpc->usedZeroCopy && (static_cast<int32_t>(
+            rpc->zeroCopyEnd - socket->zeroCopyCompleted) > 0)) {
+        socket->rpcsWaitingForCompletion.push_back(*rpc);
+        return;
+    }
+    serverRpcPool.destroy(rpc);
+}
+
+/**
+ * Read zero-copy completion notifications from a socket's error queue,
+ * and recycle any RPCs whose replies the kernel is no longer using.
+ *
+ * \param fd
+ *      File descriptor for the socket.
+ * \param zeroCopyCompleted
+ *      The connection's Socket::zeroCopyCompleted; updated to reflect the
+ *      notifications read.
+ * \param rpcs
+ *      The connection's Socket::rpcsWaitingForCompletion.
+ */
+void
+TcpTransport::reapZeroCopyCompletions(int fd, uint32_t* zeroCopyCompleted,
+        ServerRpcList* rpcs)
+{
+    while (1) {
+        char control[100];
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        if (sys->recvmsg(fd, &msg, MSG_ERRQUEUE|MSG_DONTWAIT) < 0) {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                LOG(WARNING, "TcpTransport couldn't read zero-copy "
+                        "completions: %s", strerror(errno));
+            }
+            break;
+        }
+        for (struct cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != NULL;
+                cm = CMSG_NXTHDR(&msg, cm)) {
+            if (!((cm->cmsg_level == SOL_IP) && (cm->cmsg_type == IP_RECVERR))
+                    && !((cm->cmsg_level == SOL_IPV6)
+                    && (cm->cmsg_type == IPV6_RECVERR))) {
+                continue;
+            }
+            struct sock_extended_err* err =
+                    reinterpret_cast<struct sock_extended_err*>(
+                    CMSG_DATA(cm));
+            if ((err->ee_errno != 0) ||
+                    (err->ee_origin != SO_EE_ORIGIN_ZEROCOPY)) {
+                continue;
+            }
+
+            // Notifications cover the range of send ids [ee_info, ee_data];
+            // TCP acknowledges in order, so ranges arrive in order.
+            *zeroCopyCompleted = err->ee_data + 1;
+        }
+    }
+
+    while (!rpcs->empty()) {
+        TcpServerRpc& rpc = rpcs->front();
+        if (static_cast<int32_t>(rpc.zeroCopyEnd - *zeroCopyCompleted) > 0) {
+            break;
+        }
+        rpcs->pop_front();
+        serverRpcPool.destroy(&rpc);
+    }
+}
+
+/**
+ * Recycle the replies of closed connections (see closeSocket) that the
+ * kernel has finished transmitting, and close those connections' file
+ * descriptors.
+ */
+void
+TcpTransport::reapLingeringSockets()
+{
+    for (size_t i = 0; i < lingeringSockets.size(); ) {
+        LingeringSocket* lingering = lingeringSockets[i];
+        reapZeroCopyCompletions(lingering->fd, &lingering->zeroCopyCompleted,
+                &lingering->rpcsWaitingForCompletion);
+        if (!lingering->rpcsWaitingForCompletion.empty()) {
+            // Once the connection has been reset or has timed out, the
+            // kernel won't transmit anything more on it, even if (on
+            // older kernels) it never reports completion for the data
+            // that was still queued.
+            struct tcp_info info;
+            socklen_t length = sizeof(info);
+            if ((sys->getsockopt(lingering->fd, IPPROTO_TCP, TCP_INFO,
+                    &info, &length) != 0) || (info.tcpi_state != TCP_CLOSE)) {
+                i++;
+                continue;
+            }
+            while (!lingering->rpcsWaitingForCompletion.empty()) {
+                TcpServerRpc& rpc =
+                        lingering->rpcsWaitingForCompletion.front();
+                lingering->rpcsWaitingForCompletion.pop_front();
+                serverRpcPool.destroy(&rpc);
+            }
+        }
+        sys->close(lingering->fd);
+        delete lingering;
+        lingeringSockets[i] = lingeringSockets.back();
+        lingeringSockets.pop_back();
+    }
+}
+
+/**
+ * Constructor for LingerTimers.
+ *
+ * \param transport
+ *      The TcpTransport whose lingering sockets this timer will reap.
+ */
+TcpTransport::LingerTimer::LingerTimer(TcpTransport* transport)
+    : Dispatch::Timer(transport->context->dispatch)
+    , transport(transport)
+{
+    // Empty constructor body.
+}
+
+/**
+ * Invoked by the dispatcher when the timer fires; reaps lingering
+ * sockets, and reschedules itself if any remain.
+ */
+void
+TcpTransport::LingerTimer::handleTimerEvent()
+{
+    transport->reapLingeringSockets();
+    if (!transport->lingeringSockets.empty()) {
+        start(Cycles::rdtsc() + Cycles::fromMicroseconds(
+                LINGER_POLL_MICROS));
+    }
+}
+
 /**
  * Read bytes from a socket and generate exceptions for errors and
  * end-of-file.
@@ -491,6 +1004,69 @@ TcpTransport::recvCarefully(int fd, void* buffer, size_t length) {
     throw TransportException(HERE, "TcpTransport recv error", errno);
 }
 
+/**
+ * Constructor for InputBuffers.
+ *
+ * \param capacity
+ *      Number of bytes of storage to allocate; this is the most data
+ *      that will be read from the socket in one kernel call.
+ */
+TcpTransport::InputBuffer::InputBuffer(uint32_t capacity)
+    : data(new char[capacity])
+    , capacity(capacity)
+    , start(0)
+    , end(0)
+{
+}
+
+/**
+ * Destructor for InputBuffers.
+ */
+TcpTransport::InputBuffer::~InputBuffer()
+{
+    delete[] data;
+}
+
+/**
+ * Retrieve incoming bytes from a socket, returning buffered data if there
+ * is any; otherwise refill the buffer with a single kernel call. This
+ * method has the same interface as recvCarefully, except that fewer than
+ * length bytes are returned only if the buffer is now empty.
+ *
+ * \param fd
+ *      File descriptor for socket.
+ * \param dest
+ *      Store incoming data here.
+ * \param length
+ *      Maximum number of bytes to return.
+ * \return
+ *      The number of bytes stored at dest; 0 means no bytes are available.
+ *
+ * \throw TransportException
+ *      An I/O error occurred.
+ */
+ssize_t
+TcpTransport::InputBuffer::read(int fd, void* dest, size_t length)
+{
+    if (start == end) {
+        start = end = 0;
+        if (length >= capacity) {
+            // Large bodies go straight to their final destination; there's
+            // nothing to be gained by copying them.
+            return TcpTransport::recvCarefully(fd, dest, length);
+        }
+        end = downCast<uint32_t>(TcpTransport::recvCarefully(fd, data,
+                capacity));
+    }
+    uint32_t count = end - start;
+    if (count > length) {
+        count = downCast<uint32_t>(length);
+    }
+    memcpy(dest, data + start, count);
+    start += count;
+    return count;
+}
+
 /**
  * Constructor for IncomingMessages.
  * \param buffer
@@ -528,6 +1104,10 @@ TcpTransport::IncomingMessage::cancel() {
  *
  * \param fd
  *      File descriptor to use for reading message info.
+ * \param input
+ *      If non-NULL, data is read through this buffer (which may then
+ *      hold the beginning of the next message once this one is complete).
+ *      When this method returns false, input is empty.
  * \return
  *      True means the message is complete (it's present in the
  *      buffer provided to the constructor); false means we still need
@@ -538,13 +1118,14 @@ TcpTransport::IncomingMessage::cancel() {
  */
 
 bool
-TcpTransport::IncomingMessage::readMessage(int fd) {
+TcpTransport::IncomingMessage::readMessage(int fd, InputBuffer* input) {
     // First make sure we have received the header (it may arrive in
     // multiple chunks).
     if (headerBytesReceived < sizeof(Header)) {
-        ssize_t len = TcpTransport::recvCarefully(fd,
-                reinterpret_cast<char*>(&header) + headerBytesReceived,
-                sizeof(header) - headerBytesReceived);
+        char* dest = reinterpret_cast<char*>(&header) + headerBytesReceived;
+        size_t length = sizeof(header) - headerBytesReceived;
+        ssize_t len = (input != NULL) ? input->read(fd, dest, length)
+                : TcpTransport::recvCarefully(fd, dest, length);
         headerBytesReceived += downCast<uint32_t>(len);
         if (headerBytesReceived < sizeof(Header))
             return false;
@@ -574,8 +1155,9 @@ TcpTransport::IncomingMessage::readMessage(int fd) {
         } else {
             buffer->peek(messageBytesReceived, &dest);
         }
-        ssize_t len = TcpTransport::recvCarefully(fd, dest,
-                messageLength - messageBytesReceived);
+        size_t length = messageLength - messageBytesReceived;
+        ssize_t len = (input != NULL) ? input->read(fd, dest, length)
+                : TcpTransport::recvCarefully(fd, dest, length);
         messageBytesReceived += downCast<uint32_t>(len);
         if (messageBytesReceived < messageLength)
             return false;
@@ -588,7 +1170,8 @@ TcpTransport::IncomingMessage::readMessage(int fd) {
         uint32_t maxLength = header.len - messageBytesReceived;
         if (maxLength > sizeof(buffer))
             maxLength = sizeof(buffer);
-        ssize_t len = TcpTransport::recvCarefully(fd, buffer, maxLength);
+        ssize_t len = (input != NULL) ? input->read(fd, buffer, maxLength)
+                : TcpTransport::recvCarefully(fd, buffer, maxLength);
         messageBytesReceived += downCast<uint32_t>(len);
         if (messageBytesReceived < header.len)
             return false;
@@ -623,6 +1206,7 @@ TcpTransport::TcpSession::TcpSession(TcpTransport* transport,
     , rpcsWaitingForResponse()
     , current(NULL)
     , message()
+    , input()
     , clientIoHandler()
     , alarm(transport->context->sessionAlarmTimer, this,
             (timeoutMs != 0) ? timeoutMs : DEFAULT_TIMEOUT_MS)
@@ -680,6 +1264,12 @@ TcpTransport::TcpSession::TcpSession(TcpTransport* transport,
     int flag = 1;
     setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
 
+    uint32_t inputBufferSize = serviceLocator->getOption<uint32_t>(
+            "rxBuffer", 0);
+    if (inputBufferSize != 0) {
+        input.construct(inputBufferSize);
+    }
+
     /// Arrange for notification whenever the server sends us data.
     Dispatch::Lock lock(transport->context->dispatch);
     clientIoHandler.construct(fd, this);
@@ -885,7 +1475,8 @@ TcpTransport::ClientSocketHandler::handleFileEvent(int events)
 {
     try {
         if (events & Dispatch::FileEvent::READABLE) {
-            if (session->message->readMessage(fd)) {
+            // As on servers, keep going while the InputBuffer holds data.
+            while (session->message->readMessage(fd, session->input.get())) {
                 // This RPC is finished.
                 if (session->current != NULL) {
                     session->rpcsWaitingForResponse.erase(
@@ -897,22 +1488,36 @@ TcpTransport::ClientSocketHandler::handleFileEvent(int events)
                     session->current = NULL;
                 }
                 session->message.construct(static_cast<Buffer*>(NULL), session);
+                if (!session->input || (session->input->available() == 0)) {
+                    break;
+                }
             }
         }
         if (events & Dispatch::FileEvent::WRITABLE) {
+            // Send as many of the waiting requests as possible, several
+            // at a time.
             while (!session->rpcsWaitingToSend.empty()) {
-                TcpClientRpc& rpc = session->rpcsWaitingToSend.front();
-                session->bytesLeftToSend = TcpTransport::sendMessage(
-                        session->fd, rpc.nonce, rpc.request,
-                        session->bytesLeftToSend);
+                OutgoingMessage messages[MAX_MESSAGES_PER_SEND];
+                uint32_t count = 0;
+                foreach (TcpClientRpc& rpc, session->rpcsWaitingToSend) {
+                    messages[count].nonce = rpc.nonce;
+                    messages[count].payload = rpc.request;
+                    count++;
+                    if (count == MAX_MESSAGES_PER_SEND) {
+                        break;
+                    }
+                }
+                uint32_t finished = TcpTransport::sendMessages(session->fd,
+                        messages, count, &session->bytesLeftToSend);
+                for (uint32_t i = 0; i < finished; i++) {
+                    TcpClientRpc& rpc = session->rpcsWaitingToSend.front();
+                    session->rpcsWaitingToSend.pop_front();
+                    session->rpcsWaitingForResponse.push_back(rpc);
+                    rpc.sent = true;
+                }
                 if (session->bytesLeftToSend != 0) {
                     return;
                 }
-                // The current RPC is finished; start the next one, if
-                // there is one.
-                session->rpcsWaitingToSend.pop_front();
-                session->rpcsWaitingForResponse.push_back(rpc);
-                rpc.sent = true;
                 session->bytesLeftToSend = -1;
             }
             setEvents(Dispatch::FileEvent::READABLE);
@@ -934,27 +1539,40 @@ TcpTransport::TcpServerRpc::sendReply()
         // a response.
         if ((socket != NULL) && (socket->id == socketId)) {
             if (!socket->rpcsWaitingToReply.empty()) {
-                // Can't transmit the response yet; the socket is backed up.
+                // Can't transmit the response yet; the socket is backed up
+                // (or other replies are waiting for flushPoller).
                 socket->rpcsWaitingToReply.push_back(*this);
                 return;
             }
+            if (transport->batchReplies) {
+                // Let flushPoller send this along with any other replies
+                // for the same connection that finish before it runs.
+                socket->bytesLeftToSend = -1;
+                socket->rpcsWaitingToReply.push_back(*this);
+                transport->socketsToFlush.emplace_back(fd, socketId);
+                return;
+            }
 
             // Try to transmit the response.
-            socket->bytesLeftToSend = TcpTransport::sendMessage(fd,
-                    message.header.nonce, &replyPayload, -1);
+            socket->bytesLeftToSend = transport->sendReplyMessage(socket,
+                    this, -1);
             if (socket->bytesLeftToSend > 0) {
                 socket->rpcsWaitingToReply.push_back(*this);
                 socket->ioHandler.setEvents(Dispatch::FileEvent::READABLE |
                         Dispatch::FileEvent::WRITABLE);
                 return;
             }
+
+            // The whole response was sent immediately (this should be the
+            // common case).
+            transport->finishReply(socket, this);
+            return;
         }
     } catch (TransportException& e) {
         transport->closeSocket(fd);
     }
 
-    // The whole response was sent immediately (this should be the
-    // common case).  Recycle the RPC object.
+    // The response couldn't be sent; recycle the RPC object.
     transport->serverRpcPool.destroy(this);
 }
 
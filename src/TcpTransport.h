@@ -54,6 +54,7 @@ class TcpTransport : public Transport {
     class TcpServerRpc;
   PRIVATE:
     class ServerSocketHandler;
+    class InputBuffer;
     class IncomingMessage;
     class ClientSocketHandler;
     class Socket;
@@ -76,6 +77,52 @@ class TcpTransport : public Transport {
         uint32_t len;
     } __attribute__((packed));
 
+    /**
+     * Describes one message to be transmitted by sendMessages.
+     */
+    struct OutgoingMessage {
+        /// Unique identifier for the RPC (see Header::nonce).
+        uint64_t nonce;
+
+        /// Message contents, not including Header.
+        Buffer* payload;
+    };
+
+    /**
+     * Holds bytes read from a socket in large chunks, so that several
+     * small messages can be received with a single kernel call rather
+     * than two kernel calls (header and body) for each message. Used
+     * only if the "rxBuffer" option is specified.
+     */
+    class InputBuffer {
+      public:
+        explicit InputBuffer(uint32_t capacity);
+        ~InputBuffer();
+        ssize_t read(int fd, void* dest, size_t length);
+
+        /// Number of bytes that have been read from the socket but not
+        /// yet consumed.
+        uint32_t available() {
+            return end - start;
+        }
+
+      PRIVATE:
+        /// Storage for incoming data (dynamically allocated).
+        char* data;
+
+        /// Total size of data, in bytes.
+        uint32_t capacity;
+
+        /// Offset within data of the first byte that hasn't yet been
+        /// consumed.
+        uint32_t start;
+
+        /// Offset within data just after the last valid byte.
+        uint32_t end;
+
+        DISALLOW_COPY_AND_ASSIGN(InputBuffer);
+    };
+
     /**
      * Used to manage the receipt of a message (on either client or server)
      * using an event-based approach.
@@ -83,10 +130,11 @@ class TcpTransport : public Transport {
     class IncomingMessage {
         friend class ServerSocketHandler;
         friend class TcpServerRpc;
+        friend class TcpTransport;
       public:
         IncomingMessage(Buffer* buffer, TcpSession* session);
         void cancel();
-        bool readMessage(int fd);
+        bool readMessage(int fd, InputBuffer* input = NULL);
       PRIVATE:
         Header header;
 
@@ -136,7 +184,8 @@ class TcpTransport : public Transport {
       PRIVATE:
         TcpServerRpc(Socket* socket, int fd, TcpTransport* transport)
             : fd(fd), socketId(socket->id), message(&requestPayload, NULL),
-            queueEntries(), transport(transport) { }
+            queueEntries(), transport(transport), zeroCopyEnd(0),
+            usedZeroCopy(false) { }
 
         int fd;                   /// File descriptor of the socket on
                                   /// which the request was received.
@@ -150,9 +199,19 @@ class TcpTransport : public Transport {
                                   /// Used to link this RPC onto the
                                   /// rpcsWaitingToReply list of the Socket.
         TcpTransport* transport;  /// The parent TcpTransport object.
+        uint32_t zeroCopyEnd;     /// If usedZeroCopy is true, this is the
+                                  /// value of socket->zeroCopySends just
+                                  /// after the last MSG_ZEROCOPY send for
+                                  /// this reply; the reply memory may not
+                                  /// be released until the kernel has
+                                  /// reported completion of every send
+                                  /// before this one.
+        bool usedZeroCopy;        /// True means at least part of the reply
+                                  /// was transmitted with MSG_ZEROCOPY.
 
         DISALLOW_COPY_AND_ASSIGN(TcpServerRpc);
     };
+    INTRUSIVE_LIST_TYPEDEF(TcpServerRpc, queueEntries) ServerRpcList;
 
     /**
      * The TCP implementation of Transport::ClientRpc.
@@ -192,7 +251,53 @@ class TcpTransport : public Transport {
     void closeSocket(int fd);
     static ssize_t recvCarefully(int fd, void* buffer, size_t length);
     static int sendMessage(int fd, uint64_t nonce, Buffer* payload,
+            int bytesToSend, uint32_t* zeroCopySends = NULL);
+    /// Maximum number of messages that sendQueuedReplies and
+    /// ClientSocketHandler will pass to a single sendMessages call.
+    static const uint32_t MAX_MESSAGES_PER_SEND = 16;
+
+    static uint32_t sendMessages(int fd, OutgoingMessage* messages,
+            uint32_t count, int* bytesLeftToSend);
+    bool sendQueuedReplies(Socket* socket);
+    int sendReplyMessage(Socket* socket, TcpServerRpc* rpc,
             int bytesToSend);
+    void finishReply(Socket* socket, TcpServerRpc* rpc);
+    void reapZeroCopyCompletions(int fd, uint32_t* zeroCopyCompleted,
+            ServerRpcList* rpcs);
+    void reapLingeringSockets();
+
+    /// How often (in microseconds) lingerTimer checks whether the kernel
+    /// has released the replies of closed connections.
+    static const uint64_t LINGER_POLL_MICROS = 1000;
+
+    /**
+     * Periodically invokes reapLingeringSockets while there are closed
+     * connections whose zero-copy replies the kernel hasn't released.
+     */
+    class LingerTimer : public Dispatch::Timer {
+      public:
+        explicit LingerTimer(TcpTransport* transport);
+        virtual void handleTimerEvent();
+      PRIVATE:
+        // Transport on whose behalf this timer operates.
+        TcpTransport* transport;
+        DISALLOW_COPY_AND_ASSIGN(LingerTimer);
+    };
+
+    /**
+     * Transmits replies that were queued by sendReply in "txBatch" mode,
+     * so that all of the replies for a socket that become ready during
+     * one pass through the dispatch loop go out in a single kernel call.
+     */
+    class FlushPoller : public Dispatch::Poller {
+      public:
+        explicit FlushPoller(TcpTransport* transport);
+        virtual int poll();
+      PRIVATE:
+        // Transport on whose behalf this poller operates.
+        TcpTransport* transport;
+        DISALLOW_COPY_AND_ASSIGN(FlushPoller);
+    };
 
     /**
      * An event handler that will accept connections on a socket.
@@ -262,7 +367,7 @@ class TcpTransport : public Transport {
             address(), fd(-1), serial(1),
             rpcsWaitingToSend(), bytesLeftToSend(0),
             rpcsWaitingForResponse(), current(NULL),
-            message(), clientIoHandler(),
+            message(), input(), clientIoHandler(),
             alarm(transport->context->sessionAlarmTimer, this, 0) { }
 #endif
         void close();
@@ -296,6 +401,9 @@ class TcpTransport : public Transport {
         Tub<IncomingMessage> message;
                                   /// Records state of partially-received
                                   /// reply for current.
+        Tub<InputBuffer> input;   /// Buffers incoming data; constructed only
+                                  /// if the server's locator has a nonzero
+                                  /// "rxBuffer" option.
         Tub<ClientSocketHandler> clientIoHandler;
                                   /// Used to get notified when response data
                                   /// arrives.
@@ -320,6 +428,32 @@ class TcpTransport : public Transport {
     /// Used to wait for listenSocket to become readable.
     Tub<AcceptHandler> acceptHandler;
 
+    /// Replies at least this many bytes long are transmitted with
+    /// MSG_ZEROCOPY, so that the kernel sends directly from log memory
+    /// instead of copying it into socket buffers. 0 means zero-copy
+    /// transmission is disabled. Set with the "zeroCopy" option in the
+    /// server's service locator.
+    uint32_t zeroCopyThreshold;
+
+    /// Size of the InputBuffer for each incoming connection; 0 means
+    /// requests are read directly from the socket. Set with the "rxBuffer"
+    /// option in the server's service locator (clients use the value
+    /// from the locator of the server they connect to).
+    uint32_t inputBufferSize;
+
+    /// True means sendReply queues responses rather than transmitting them
+    /// immediately; flushPoller sends them later, coalescing all of the
+    /// replies for a connection into a single kernel call. Set with the
+    /// "txBatch" option in the server's service locator.
+    bool batchReplies;
+
+    /// Sockets (file descriptor and Socket::id) with replies queued by
+    /// sendReply in txBatch mode, waiting for flushPoller.
+    std::vector<std::pair<int, uint64_t>> socketsToFlush;
+
+    /// Non-empty only if batchReplies is true.
+    Tub<FlushPoller> flushPoller;
+
     /// Used to hold information about a file descriptor associated with
     /// a socket, on which RPC requests may arrive.
     class Socket {
@@ -335,7 +469,8 @@ class TcpTransport : public Transport {
         ServerSocketHandler ioHandler;
                                   /// Used to get notified whenever data
                                   /// arrives on this fd.
-        INTRUSIVE_LIST_TYPEDEF(TcpServerRpc, queueEntries) ServerRpcList;
+        Tub<InputBuffer> input;   /// Buffers incoming data; constructed only
+                                  /// if inputBufferSize is nonzero.
         ServerRpcList rpcsWaitingToReply;
                                   /// RPCs whose response messages have not yet
                                   /// been transmitted.  The front RPC on this
@@ -345,12 +480,63 @@ class TcpTransport : public Transport {
                                   /// need to be transmitted, once fd becomes
                                   /// writable again.  -1 or 0 means there are
                                   /// no RPCs waiting.
+        bool zeroCopy;            /// True means SO_ZEROCOPY was enabled
+                                  /// on this socket, so large replies may
+                                  /// be sent with MSG_ZEROCOPY.
+        uint32_t zeroCopySends;   /// Number of sendmsg calls with
+                                  /// MSG_ZEROCOPY that have transmitted data
+                                  /// on this socket; this mirrors the
+                                  /// counter the kernel uses to identify
+                                  /// completion notifications.
+        uint32_t zeroCopyCompleted;
+                                  /// The kernel has reported completion for
+                                  /// all zero-copy sends with ids less than
+                                  /// this value.
+        ServerRpcList rpcsWaitingForCompletion;
+                                  /// RPCs whose responses have been fully
+                                  /// handed to the kernel with MSG_ZEROCOPY,
+                                  /// but which the kernel may still be
+                                  /// reading from. Each RPC stays in the
+                                  /// ServerRpcPool (and hence keeps its
+                                  /// LogProtector epoch outstanding, so the
+                                  /// log cleaner won't free the segments its
+                                  /// reply refers to) until its sends
+                                  /// complete. In order of zeroCopyEnd.
         struct sockaddr_in sin;   /// sockaddr_in of the client host on the
                                   /// other end of the socket. Used to
                                   /// implement #getClientServiceLocator().
         DISALLOW_COPY_AND_ASSIGN(Socket);
     };
 
+    /**
+     * A client connection that was closed while the kernel might still
+     * be transmitting zero-copy replies from their buffers (for example,
+     * the client closed its end right after its last request). The file
+     * descriptor stays open, so that completions can still be read from
+     * its error queue, and the RPCs stay allocated until the kernel
+     * releases them; see closeSocket and reapLingeringSockets.
+     */
+    struct LingeringSocket {
+        LingeringSocket(int fd, uint32_t zeroCopyCompleted)
+            : fd(fd)
+            , zeroCopyCompleted(zeroCopyCompleted)
+            , rpcsWaitingForCompletion()
+        {}
+        int fd;                   /// File descriptor for the connection.
+        uint32_t zeroCopyCompleted;
+                                  /// See Socket::zeroCopyCompleted.
+        ServerRpcList rpcsWaitingForCompletion;
+                                  /// See Socket::rpcsWaitingForCompletion.
+        DISALLOW_COPY_AND_ASSIGN(LingeringSocket);
+    };
+
+    /// Closed connections whose zero-copy replies haven't been released
+    /// by the kernel yet.
+    std::vector<LingeringSocket*> lingeringSockets;
+
+    /// Runs while lingeringSockets is non-empty.
+    Tub<LingerTimer> lingerTimer;
+
     /// Keeps track of all of our open client connections. Entry i has
     /// information about file descriptor i (NULL means no client
     /// is currently connected).
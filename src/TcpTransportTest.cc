@@ -150,6 +150,25 @@ TEST_F(TcpTransportTest, constructor_clientSideOnly) {
     sys->socketErrno = EPERM;
 }
 
+TEST_F(TcpTransportTest, constructor_zeroCopyOption) {
+    EXPECT_EQ(0U, server.zeroCopyThreshold);
+    ServiceLocator locator2("tcp+ip:host=localhost,port=11001,zeroCopy=8000");
+    TcpTransport server2(&context, &locator2);
+    EXPECT_EQ(8000U, server2.zeroCopyThreshold);
+}
+
+TEST_F(TcpTransportTest, constructor_batchingOptions) {
+    EXPECT_EQ(0U, server.inputBufferSize);
+    EXPECT_FALSE(server.batchReplies);
+    EXPECT_FALSE(server.flushPoller);
+    ServiceLocator locator2("tcp+ip:host=localhost,port=11001,"
+            "rxBuffer=65536,txBatch=1");
+    TcpTransport server2(&context, &locator2);
+    EXPECT_EQ(65536U, server2.inputBufferSize);
+    EXPECT_TRUE(server2.batchReplies);
+    EXPECT_TRUE(server2.flushPoller);
+}
+
 TEST_F(TcpTransportTest, constructor_socketError) {
     sys->socketErrno = EPERM;
     EXPECT_EQ("TcpTransport couldn't create listen socket: "
@@ -312,6 +331,22 @@ TEST_F(TcpTransportTest, AcceptHandler_handleFileEvent_success) {
     close(fd);
 }
 
+TEST_F(TcpTransportTest, AcceptHandler_handleFileEvent_zeroCopyUnavailable) {
+    ServiceLocator locator2("tcp+ip:host=localhost,port=11001,zeroCopy=8000");
+    TcpTransport server2(&context, &locator2);
+    int fd = connectToServer(&locator2);
+    sys->setsockoptErrno = EPERM;
+    server2.acceptHandler->handleFileEvent(Dispatch::FileEvent::READABLE);
+    EXPECT_NE(server2.sockets.size(), 0U);
+    TcpTransport::Socket* socket = server2.sockets[server2.sockets.size() - 1];
+    EXPECT_FALSE(socket == NULL);
+    EXPECT_FALSE(socket->zeroCopy);
+    EXPECT_EQ("handleFileEvent: TcpTransport couldn't enable SO_ZEROCOPY "
+            "(replies will be copied): Operation not permitted",
+            TestLog::get());
+    close(fd);
+}
+
 TEST_F(TcpTransportTest, ServerSocketHandler_handleFileEvent_reads) {
     int fd = connectToServer(&locator);
     server.acceptHandler->handleFileEvent(Dispatch::FileEvent::READABLE);
@@ -336,6 +371,39 @@ TEST_F(TcpTransportTest, ServerSocketHandler_handleFileEvent_reads) {
     close(fd);
 }
 
+TEST_F(TcpTransportTest, ServerSocketHandler_handleFileEvent_readsBuffered) {
+    ServiceLocator locator2("tcp+ip:host=localhost,port=11001,rxBuffer=1000");
+    TcpTransport server2(&context, &locator2);
+    int fd = connectToServer(&locator2);
+    server2.acceptHandler->handleFileEvent(Dispatch::FileEvent::READABLE);
+    int serverFd = downCast<unsigned>(server2.sockets.size()) - 1;
+    EXPECT_TRUE(server2.sockets[serverFd]->input);
+
+    // Three requests arrive together, followed by part of a fourth; a
+    // single event should be enough to receive all of the complete ones.
+    Buffer data;
+    TcpTransport::Header header;
+    header.len = 3;
+    for (int i = 0; i < 4; i++) {
+        header.nonce = i;
+        data.appendCopy(&header, sizeof(header));
+        data.appendCopy("abc", 3);
+    }
+    EXPECT_EQ(50, write(fd, data.getRange(0, 50), 50));
+    server2.sockets[serverFd]->ioHandler.handleFileEvent(
+            Dispatch::FileEvent::READABLE);
+    EXPECT_EQ(3, countWaitingRequests(&server2));
+    EXPECT_EQ(0U, server2.sockets[serverFd]->input->available());
+    EXPECT_EQ(5U, server2.sockets[serverFd]->rpc->message.headerBytesReceived);
+
+    EXPECT_EQ(10, write(fd, data.getRange(50, 10), 10));
+    server2.sockets[serverFd]->ioHandler.handleFileEvent(
+            Dispatch::FileEvent::READABLE);
+    EXPECT_EQ(1, countWaitingRequests(&server2));
+
+    close(fd);
+}
+
 TEST_F(TcpTransportTest, ServerSocketHandler_handleFileEvent_writes) {
     // Generate 3 requests and respond to each; make the first response
     // too large to send entirely in sendReply, so that handleFileEvent
@@ -533,6 +601,267 @@ TEST_F(TcpTransportTest, sendMessage_brokenPipe) {
     EXPECT_EQ("TcpTransport sendmsg error: Broken pipe", message);
 }
 
+TEST_F(TcpTransportTest, sendMessages_multipleMessages) {
+    int fd = connectToServer(&locator);
+    Buffer payload1, payload2, payload3;
+    payload1.appendExternal("first", 5);
+    payload2.appendExternal("sec", 3);
+    payload2.appendExternal("ond", 3);
+    payload3.appendExternal("third", 5);
+    TcpTransport::OutgoingMessage messages[3] = {{1, &payload1},
+            {2, &payload2}, {3, &payload3}};
+    int bytesLeft = -1;
+    EXPECT_EQ(3U, TcpTransport::sendMessages(fd, messages, 3, &bytesLeft));
+    EXPECT_EQ(0, bytesLeft);
+
+    const char* expected[] = {"first", "second", "third"};
+    for (int i = 0; i < 3; i++) {
+        Transport::ServerRpc* serverRpc = workerManager->waitForRpc(1.0);
+        ASSERT_TRUE(serverRpc != NULL);
+        EXPECT_EQ(expected[i], TestUtil::toString(&serverRpc->requestPayload));
+        server.serverRpcPool.destroy(
+            static_cast<TcpTransport::TcpServerRpc*>(serverRpc));
+    }
+
+    close(fd);
+}
+TEST_F(TcpTransportTest, sendMessages_partialSends) {
+    int fd = connectToServer(&locator);
+    Buffer payload;
+    payload.appendExternal("abcde", 5);
+    TcpTransport::OutgoingMessage messages[3] = {{1, &payload},
+            {2, &payload}, {3, &payload}};
+
+    // Each message is 17 bytes long (including header).
+    int bytesLeft = -1;
+    sys->sendmsgReturnCount = 25;
+    EXPECT_EQ(1U, TcpTransport::sendMessages(fd, messages, 3, &bytesLeft));
+    EXPECT_EQ(9, bytesLeft);
+    sys->sendmsgReturnCount = 0;
+    EXPECT_EQ(0U, TcpTransport::sendMessages(fd, &messages[1], 2,
+            &bytesLeft));
+    EXPECT_EQ(9, bytesLeft);
+    sys->sendmsgReturnCount = 26;
+    EXPECT_EQ(2U, TcpTransport::sendMessages(fd, &messages[1], 2,
+            &bytesLeft));
+    EXPECT_EQ(0, bytesLeft);
+    sys->sendmsgReturnCount = -1;
+
+    close(fd);
+}
+TEST_F(TcpTransportTest, sendMessages_errorOnSend) {
+    int fd = connectToServer(&locator);
+    Buffer payload;
+    payload.appendExternal("abcde", 5);
+    TcpTransport::OutgoingMessage message = {1, &payload};
+    int bytesLeft = -1;
+    sys->sendmsgErrno = EPERM;
+    string result("no exception");
+    try {
+        TcpTransport::sendMessages(fd, &message, 1, &bytesLeft);
+    } catch (TransportException& e) {
+        result = e.message;
+    }
+    EXPECT_EQ("TcpTransport sendmsg error: Operation not permitted", result);
+
+    close(fd);
+}
+
+TEST_F(TcpTransportTest, FlushPoller_poll) {
+    ServiceLocator locator2("tcp+ip:host=localhost,port=11001,txBatch=1");
+    TcpTransport server2(&context, &locator2);
+    Transport::SessionRef session = client.getSession(&locator2);
+    MockWrapper rpc1("request1");
+    session->sendRequest(&rpc1.request, &rpc1.response, &rpc1);
+    MockWrapper rpc2("request2");
+    session->sendRequest(&rpc2.request, &rpc2.response, &rpc2);
+    Transport::ServerRpc* serverRpc1 = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc1 != NULL);
+    Transport::ServerRpc* serverRpc2 = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc2 != NULL);
+    EXPECT_EQ(0, server2.flushPoller->poll());
+
+    // The replies should be held until the poller runs.
+    serverRpc1->replyPayload.fillFromString("response1");
+    serverRpc1->sendReply();
+    serverRpc2->replyPayload.fillFromString("response2");
+    serverRpc2->sendReply();
+    TcpTransport::Socket* socket = server2.sockets[server2.sockets.size() - 1];
+    EXPECT_EQ(2U, socket->rpcsWaitingToReply.size());
+    EXPECT_EQ(1U, server2.socketsToFlush.size());
+    EXPECT_EQ(1, server2.flushPoller->poll());
+    EXPECT_EQ(0U, socket->rpcsWaitingToReply.size());
+    EXPECT_EQ(0U, server2.socketsToFlush.size());
+
+    EXPECT_TRUE(TestUtil::waitForRpc(&context, rpc1));
+    EXPECT_EQ("response1/0", TestUtil::toString(&rpc1.response));
+    EXPECT_TRUE(TestUtil::waitForRpc(&context, rpc2));
+    EXPECT_EQ("response2/0", TestUtil::toString(&rpc2.response));
+}
+TEST_F(TcpTransportTest, FlushPoller_poll_socketClosed) {
+    ServiceLocator locator2("tcp+ip:host=localhost,port=11001,txBatch=1");
+    TcpTransport server2(&context, &locator2);
+    Transport::SessionRef session = client.getSession(&locator2);
+    MockWrapper rpc1("request1");
+    session->sendRequest(&rpc1.request, &rpc1.response, &rpc1);
+    Transport::ServerRpc* serverRpc = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc != NULL);
+    serverRpc->sendReply();
+    EXPECT_EQ(1U, server2.socketsToFlush.size());
+
+    // Closing the socket discards the queued reply.
+    TestLog::reset();
+    server2.closeSocket(server2.socketsToFlush[0].first);
+    EXPECT_EQ("~TcpServerRpc: deleted", TestLog::get());
+    EXPECT_EQ(1, server2.flushPoller->poll());
+    EXPECT_EQ(0U, server2.socketsToFlush.size());
+}
+
+TEST_F(TcpTransportTest, sendMessage_zeroCopyCountsSends) {
+    int fd = connectToServer(&locator);
+    Buffer payload;
+    payload.fillFromString("abcdefg");
+    uint32_t zeroCopySends = 5;
+
+    // Nothing sent: the kernel doesn't consume a notification id.
+    sys->sendmsgErrno = EAGAIN;
+    EXPECT_EQ(19, TcpTransport::sendMessage(fd, 111, &payload, -1,
+            &zeroCopySends));
+    EXPECT_EQ(5U, zeroCopySends);
+
+    // Partial send.
+    sys->sendmsgErrno = 0;
+    sys->sendmsgReturnCount = 4;
+    EXPECT_EQ(15, TcpTransport::sendMessage(fd, 111, &payload, -1,
+            &zeroCopySends));
+    EXPECT_EQ(6U, zeroCopySends);
+    close(fd);
+}
+
+TEST_F(TcpTransportTest, reapZeroCopyCompletions_recvmsgError) {
+    int fd = connectToServer(&locator);
+    server.acceptHandler->handleFileEvent(Dispatch::FileEvent::READABLE);
+    int serverFd = downCast<unsigned>(server.sockets.size()) - 1;
+    TcpTransport::Socket* socket = server.sockets[serverFd];
+    sys->recvmsgErrno = EPERM;
+    server.reapZeroCopyCompletions(serverFd, &socket->zeroCopyCompleted,
+            &socket->rpcsWaitingForCompletion);
+    EXPECT_EQ("reapZeroCopyCompletions: TcpTransport couldn't read "
+            "zero-copy completions: Operation not permitted",
+            TestLog::get());
+    close(fd);
+}
+
+TEST_F(TcpTransportTest, reapZeroCopyCompletions_recycleFinishedRpcs) {
+    int fd = connectToServer(&locator);
+    server.acceptHandler->handleFileEvent(Dispatch::FileEvent::READABLE);
+    int serverFd = downCast<unsigned>(server.sockets.size()) - 1;
+    TcpTransport::Socket* socket = server.sockets[serverFd];
+    TcpTransport::TcpServerRpc* rpc1 = server.serverRpcPool.construct(
+            socket, serverFd, &server);
+    rpc1->usedZeroCopy = true;
+    rpc1->zeroCopyEnd = 2;
+    TcpTransport::TcpServerRpc* rpc2 = server.serverRpcPool.construct(
+            socket, serverFd, &server);
+    rpc2->usedZeroCopy = true;
+    rpc2->zeroCopyEnd = 4;
+    server.finishReply(socket, rpc1);
+    server.finishReply(socket, rpc2);
+    EXPECT_EQ(2U, socket->rpcsWaitingForCompletion.size());
+    EXPECT_EQ("", TestLog::get());
+
+    // The error queue is empty, so only the completion counter matters.
+    socket->zeroCopyCompleted = 3;
+    server.reapZeroCopyCompletions(serverFd, &socket->zeroCopyCompleted,
+            &socket->rpcsWaitingForCompletion);
+    EXPECT_EQ(1U, socket->rpcsWaitingForCompletion.size());
+    EXPECT_EQ("~TcpServerRpc: deleted", TestLog::get());
+    TestLog::reset();
+    socket->zeroCopyCompleted = 4;
+    server.reapZeroCopyCompletions(serverFd, &socket->zeroCopyCompleted,
+            &socket->rpcsWaitingForCompletion);
+    EXPECT_EQ(0U, socket->rpcsWaitingForCompletion.size());
+    EXPECT_EQ("~TcpServerRpc: deleted", TestLog::get());
+    close(fd);
+}
+
+TEST_F(TcpTransportTest, closeSocket_lingerForZeroCopyCompletions) {
+    int fd = connectToServer(&locator);
+    server.acceptHandler->handleFileEvent(Dispatch::FileEvent::READABLE);
+    int serverFd = downCast<unsigned>(server.sockets.size()) - 1;
+    TcpTransport::Socket* socket = server.sockets[serverFd];
+    TcpTransport::TcpServerRpc* rpc = server.serverRpcPool.construct(
+            socket, serverFd, &server);
+    rpc->usedZeroCopy = true;
+    rpc->zeroCopyEnd = 2;
+    server.finishReply(socket, rpc);
+
+    // The RPC outlives the Socket, and the fd stays open.
+    server.closeSocket(serverFd);
+    EXPECT_TRUE(server.sockets[serverFd] == NULL);
+    EXPECT_EQ("", TestLog::get());
+    ASSERT_EQ(1U, server.lingeringSockets.size());
+    EXPECT_EQ(serverFd, server.lingeringSockets[0]->fd);
+    EXPECT_EQ(1U,
+            server.lingeringSockets[0]->rpcsWaitingForCompletion.size());
+    EXPECT_TRUE(server.lingerTimer->isRunning());
+    EXPECT_EQ(0, fcntl(serverFd, F_GETFD));
+
+    // Still waiting for the kernel.
+    server.reapLingeringSockets();
+    EXPECT_EQ(1U, server.lingeringSockets.size());
+    EXPECT_EQ("", TestLog::get());
+
+    // Completion reported.
+    server.lingeringSockets[0]->zeroCopyCompleted = 2;
+    server.reapLingeringSockets();
+    EXPECT_EQ(0U, server.lingeringSockets.size());
+    EXPECT_EQ("~TcpServerRpc: deleted", TestLog::get());
+    EXPECT_EQ(-1, fcntl(serverFd, F_GETFD));
+    close(fd);
+}
+
+TEST_F(TcpTransportTest, closeSocket_noZeroCopyRepliesOutstanding) {
+    int fd = connectToServer(&locator);
+    server.acceptHandler->handleFileEvent(Dispatch::FileEvent::READABLE);
+    int serverFd = downCast<unsigned>(server.sockets.size()) - 1;
+    server.closeSocket(serverFd);
+    EXPECT_EQ(0U, server.lingeringSockets.size());
+    EXPECT_FALSE(server.lingerTimer);
+    EXPECT_EQ(-1, fcntl(serverFd, F_GETFD));
+    close(fd);
+}
+
+TEST_F(TcpTransportTest, reapLingeringSockets_connectionReset) {
+    int fd = connectToServer(&locator);
+    server.acceptHandler->handleFileEvent(Dispatch::FileEvent::READABLE);
+    int serverFd = downCast<unsigned>(server.sockets.size()) - 1;
+    TcpTransport::Socket* socket = server.sockets[serverFd];
+    TcpTransport::TcpServerRpc* rpc = server.serverRpcPool.construct(
+            socket, serverFd, &server);
+    rpc->usedZeroCopy = true;
+    rpc->zeroCopyEnd = 2;
+    server.finishReply(socket, rpc);
+    server.closeSocket(serverFd);
+    ASSERT_EQ(1U, server.lingeringSockets.size());
+
+    // Reset the connection from the client side: the kernel will never
+    // transmit from the reply again, so it can be released even without
+    // a completion notification.
+    struct linger linger = {1, 0};
+    setsockopt(fd, SOL_SOCKET, SO_LINGER, &linger, sizeof(linger));
+    close(fd);
+    for (int i = 0; i < 1000; i++) {
+        server.reapLingeringSockets();
+        if (server.lingeringSockets.empty()) {
+            break;
+        }
+        usleep(1000);
+    }
+    EXPECT_EQ(0U, server.lingeringSockets.size());
+    EXPECT_EQ("~TcpServerRpc: deleted", TestLog::get());
+}
+
 TEST_F(TcpTransportTest, recvCarefully_ioErrors) {
     string message("no exception");
     sys->recvEof = true;
@@ -555,6 +884,31 @@ TEST_F(TcpTransportTest, recvCarefully_ioErrors) {
     EXPECT_EQ("TcpTransport recv error: Operation not permitted", message);
 }
 
+TEST_F(TcpTransportTest, InputBuffer_read) {
+    int fd = connectToServer(&locator);
+    server.acceptHandler->handleFileEvent(Dispatch::FileEvent::READABLE);
+    int serverFd = downCast<unsigned>(server.sockets.size()) - 1;
+    TcpTransport::InputBuffer input(10);
+    char buffer[20];
+    EXPECT_EQ(0, input.read(serverFd, buffer, 4));
+
+    // Small reads are satisfied from the buffer.
+    EXPECT_EQ(16, write(fd, "abcdefghijklmnop", 16));
+    EXPECT_EQ(4, input.read(serverFd, buffer, 4));
+    EXPECT_EQ("abcd", string(buffer, 4));
+    EXPECT_EQ(6U, input.available());
+    EXPECT_EQ(6, input.read(serverFd, buffer, 8));
+    EXPECT_EQ("efghij", string(buffer, 6));
+    EXPECT_EQ(0U, input.available());
+
+    // Large reads bypass the buffer when it's empty.
+    EXPECT_EQ(6, input.read(serverFd, buffer, 20));
+    EXPECT_EQ("klmnop", string(buffer, 6));
+    EXPECT_EQ(0U, input.available());
+
+    close(fd);
+}
+
 // (IncomingMessage::cancel is tested by cancelRequest tests below.)
 
 TEST_F(TcpTransportTest, IncomingMessage_readMessage_receiveHeaderInPieces) {
@@ -1041,6 +1395,35 @@ TEST_F(TcpTransportTest, ClientSocketHandler_handleFileEvent_readResponse) {
     EXPECT_TRUE(rawSession->message->buffer == NULL);
 }
 
+TEST_F(TcpTransportTest, ClientSocketHandler_handleFileEvent_readBuffered) {
+    ServiceLocator locator2("tcp+ip:host=localhost,port=11001,rxBuffer=1000");
+    TcpTransport server2(&context, &locator2);
+    Transport::SessionRef session = client.getSession(&locator2);
+    TcpTransport::TcpSession* rawSession =
+            reinterpret_cast<TcpTransport::TcpSession*>(session.get());
+    EXPECT_TRUE(rawSession->input);
+    MockWrapper rpc1("request1");
+    session->sendRequest(&rpc1.request, &rpc1.response, &rpc1);
+    MockWrapper rpc2("request2");
+    session->sendRequest(&rpc2.request, &rpc2.response, &rpc2);
+    Transport::ServerRpc* serverRpc1 = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc1 != NULL);
+    Transport::ServerRpc* serverRpc2 = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc2 != NULL);
+    serverRpc1->replyPayload.fillFromString("response1");
+    serverRpc1->sendReply();
+    serverRpc2->replyPayload.fillFromString("response2");
+    serverRpc2->sendReply();
+
+    // Both responses should be received by a single event.
+    rawSession->clientIoHandler->handleFileEvent(
+            Dispatch::FileEvent::READABLE);
+    EXPECT_STREQ("completed: 1, failed: 0", rpc1.getState());
+    EXPECT_STREQ("completed: 1, failed: 0", rpc2.getState());
+    EXPECT_EQ("response2/0", TestUtil::toString(&rpc2.response));
+    EXPECT_EQ(0U, rawSession->rpcsWaitingForResponse.size());
+}
+
 TEST_F(TcpTransportTest, ClientSocketHandler_handleFileEvent_sendRequests) {
     Transport::SessionRef session = client.getSession(&locator);
     TcpTransport::TcpSession* rawSession =
@@ -1221,6 +1604,43 @@ TEST_F(TcpTransportTest, sendReply) {
     EXPECT_EQ(0U, socket->rpcsWaitingToReply.size());
 }
 
+TEST_F(TcpTransportTest, sendReply_zeroCopy) {
+    ServiceLocator locator2("tcp+ip:host=localhost,port=11001,zeroCopy=1000");
+    TcpTransport server2(&context, &locator2);
+    Transport::SessionRef session = client.getSession(&locator2);
+    MockWrapper rpc1("request1");
+    session->sendRequest(&rpc1.request, &rpc1.response, &rpc1);
+    Transport::ServerRpc* serverRpc = workerManager->waitForRpc(1.0);
+    EXPECT_TRUE(serverRpc != NULL);
+    TcpTransport::Socket* socket = server2.sockets[server2.sockets.size() - 1];
+    if (!socket->zeroCopy) {
+        // The kernel running this test doesn't support MSG_ZEROCOPY.
+        server2.serverRpcPool.destroy(
+            static_cast<TcpTransport::TcpServerRpc*>(serverRpc));
+        return;
+    }
+    TestUtil::fillLargeBuffer(&serverRpc->replyPayload, 100000);
+    TestLog::reset();
+    serverRpc->sendReply();
+    EXPECT_GE(socket->zeroCopySends, 1U);
+
+    // The RPC can't be recycled until the kernel says it's done with
+    // the reply.
+    EXPECT_EQ("", TestLog::get());
+    EXPECT_TRUE(TestUtil::waitForRpc(&context, rpc1));
+    EXPECT_EQ("ok", TestUtil::checkLargeBuffer(&rpc1.response, 100000));
+    for (int i = 0; i < 1000; i++) {
+        context.dispatch->poll();
+        if (socket->rpcsWaitingForCompletion.empty() &&
+                socket->rpcsWaitingToReply.empty()) {
+            break;
+        }
+        usleep(1000);
+    }
+    EXPECT_EQ(0U, socket->rpcsWaitingForCompletion.size());
+    EXPECT_EQ("~TcpServerRpc: deleted", TestLog::get());
+}
+
 TEST_F(TcpTransportTest, sendReply_error) {
     Transport::SessionRef session = client.getSession(&locator);
     MockWrapper rpc1("request1");
@@ -13,7 +13,14 @@
  * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <sys/time.h>
+#include <algorithm>
+#include <map>
+
+#include "Buffer.h"
+#include "ServerId.h"
 #include "TimeTrace.h"
+#include "WireFormat.h"
 
 namespace RAMCloud {
 __thread TimeTrace::Buffer* TimeTrace::threadBuffer = NULL;
@@ -21,6 +28,10 @@ std::vector<TimeTrace::Buffer*> TimeTrace::threadBuffers;
 TimeTrace::TraceLogger* TimeTrace::backgroundLogger = NULL;
 SpinLock TimeTrace::mutex("TimeTrace::mutex");
 Atomic<int> TimeTrace::activeReaders(0);
+const char TimeTrace::SAMPLED_PREFIX[] = "trace %u: ";
+__thread uint32_t TimeTrace::currentTraceId = 0;
+uint32_t TimeTrace::sampleInterval = 0;
+__thread uint32_t TimeTrace::rpcsUntilSample = 0;
 
 /**
  * Creates a thread-private TimeTrace::Buffer object for the current thread,
@@ -56,6 +67,181 @@ TimeTrace::getTrace()
     return s;
 }
 
+/**
+ * Return the events recorded for traced RPCs (see recordSampled), one per
+ * line, in order of time. Each line has the form
+ * "<seconds since the epoch> trace <id>: <message>", so that the output
+ * from different servers can be merged (to the extent that their clocks
+ * are synchronized).
+ */
+string
+TimeTrace::getSampledTrace()
+{
+    std::vector<TimeTrace::Buffer*> buffers;
+    activeReaders.add(1);
+    {
+        SpinLock::Guard guard(mutex);
+        buffers = threadBuffers;
+    }
+
+    // Used to convert event timestamps to wall-clock times.
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    uint64_t nowCycles = Cycles::rdtsc();
+    double nowSeconds = static_cast<double>(now.tv_sec) +
+            static_cast<double>(now.tv_usec) * 1e-06;
+
+    std::vector<std::pair<uint64_t, string>> lines;
+    size_t prefixLength = strlen(SAMPLED_PREFIX);
+    foreach (TimeTrace::Buffer* buffer, buffers) {
+        for (uint32_t i = 0; i < Buffer::BUFFER_SIZE; i++) {
+            Event* event = &buffer->events[i];
+            if ((event->format == NULL) ||
+                    (strncmp(event->format, SAMPLED_PREFIX,
+                    prefixLength) != 0)) {
+                continue;
+            }
+            char message[1000];
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+            snprintf(message, sizeof(message), event->format, event->arg0,
+                     event->arg1, event->arg2, event->arg3);
+#pragma GCC diagnostic pop
+            double seconds = nowSeconds - Cycles::toSeconds(
+                    nowCycles - event->timestamp);
+            lines.emplace_back(event->timestamp,
+                    format("%.7f %s", seconds, message));
+        }
+    }
+    activeReaders.add(-1);
+
+    std::sort(lines.begin(), lines.end());
+    string s;
+    for (size_t i = 0; i < lines.size(); i++) {
+        if (i != 0) {
+            s.append("\n");
+        }
+        s.append(lines[i].second);
+    }
+    return s;
+}
+
+/**
+ * Choose a trace id for an incoming RPC, if sampling is enabled and it's
+ * time to trace another one (the interval between traced RPCs is random,
+ * so that periodic patterns in the workload don't bias the sample).
+ *
+ * \return
+ *      A new trace id, or 0 if the RPC shouldn't be traced.
+ */
+uint32_t
+TimeTrace::newTraceId()
+{
+    if (rpcsUntilSample > 1) {
+        rpcsUntilSample--;
+        return 0;
+    }
+    uint32_t interval = sampleInterval;
+    if (interval == 0) {
+        return 0;
+    }
+    rpcsUntilSample = 1 + downCast<uint32_t>(generateRandom() %
+            (2 * static_cast<uint64_t>(interval) - 1));
+    uint32_t traceId;
+    do {
+        traceId = static_cast<uint32_t>(generateRandom());
+    } while (traceId == 0);
+    return traceId;
+}
+
+/**
+ * Given the events for traced RPCs collected from all of the servers in a
+ * cluster, merge them into a separate timeline for each traced RPC.
+ *
+ * \param traces
+ *      Response from a call to CoordinatorClient::serverControlAll for
+ *      GET_SAMPLED_TIME_TRACE (each server's result is the output of
+ *      getSampledTrace).
+ *
+ * \return
+ *      A multi-line string with one timeline for each traced RPC, in
+ *      order of their first events. Each event is shown with its time
+ *      relative to the RPC's first event and the server that recorded it.
+ */
+string
+TimeTrace::printRpcTimelines(RAMCloud::Buffer* traces)
+{
+    struct TracedEvent {
+        double seconds;
+        uint64_t serverId;
+        string message;
+        bool operator<(const TracedEvent& other) const {
+            return seconds < other.seconds;
+        }
+    };
+    std::map<uint32_t, std::vector<TracedEvent>> rpcs;
+
+    uint32_t offset = sizeof32(WireFormat::ServerControlAll::Response);
+    while (offset < traces->size()) {
+        const WireFormat::ServerControl::Response* header =
+                traces->getOffset<WireFormat::ServerControl::Response>(offset);
+        if (header == NULL) {
+            break;
+        }
+        offset += sizeof32(*header);
+        const char* data = static_cast<const char*>(
+                traces->getRange(offset, header->outputLength));
+        if (data == NULL) {
+            break;
+        }
+        offset += header->outputLength;
+        string output(data, header->outputLength);
+
+        size_t start = 0;
+        while (start < output.size()) {
+            size_t end = output.find('\n', start);
+            if (end == string::npos) {
+                end = output.size();
+            }
+            string line = output.substr(start, end - start);
+            start = end + 1;
+
+            double seconds;
+            uint32_t traceId;
+            int messageStart;
+            if (sscanf(line.c_str(), "%lf trace %u: %n", &seconds, &traceId,
+                    &messageStart) < 2) {
+                continue;
+            }
+            rpcs[traceId].push_back({seconds, header->serverId,
+                    line.substr(messageStart)});
+        }
+    }
+
+    std::vector<std::pair<double, uint32_t>> order;
+    for (auto& rpc : rpcs) {
+        std::stable_sort(rpc.second.begin(), rpc.second.end());
+        order.emplace_back(rpc.second.front().seconds, rpc.first);
+    }
+    std::sort(order.begin(), order.end());
+
+    string s;
+    foreach (auto& entry, order) {
+        std::vector<TracedEvent>& events = rpcs[entry.second];
+        s.append(format("Trace %u:\n", entry.second));
+        foreach (TracedEvent& event, events) {
+            s.append(format("%10.2f us  server %-6s %s\n",
+                    (event.seconds - events.front().seconds) * 1e06,
+                    ServerId(event.serverId).toString().c_str(),
+                    event.message.c_str()));
+        }
+    }
+    if (s.empty()) {
+        s = "No traced RPCs\n";
+    }
+    return s;
+}
+
 /**
  * This private method does most of the work for both printToLog and
  * getTrace.
@@ -241,6 +427,19 @@ TimeTrace::printToLogBackground(Dispatch* dispatch)
     backgroundLogger = new TraceLogger(dispatch);
 }
 
+/**
+ * Start or stop tracing incoming RPCs (see sampleRpc).
+ *
+ * \param interval
+ *      Roughly one in every this many RPCs will be traced; 0 means stop
+ *      tracing new RPCs.
+ */
+void
+TimeTrace::setSampleInterval(uint32_t interval)
+{
+    sampleInterval = interval;
+}
+
 /**
  * Discards all records in all of the thread-local buffers. Intended
  * primarily for unit testing.
@@ -25,6 +25,8 @@
 
 namespace RAMCloud {
 
+class Buffer;
+
 /**
  * This class implements a circular buffer of entries, each of which
  * consists of a fine-grain timestamp, a short descriptive string, and
@@ -45,13 +47,27 @@ namespace RAMCloud {
  *
  * If you want to use a single trace buffer rather than per-thread
  * buffers, see the subclass TimeTrace::Buffer below.
+ *
+ * TimeTrace can also follow individual RPCs through the cluster. When
+ * sampling is enabled with setSampleInterval, WorkerManager tags roughly
+ * one in every N incoming RPCs with a random trace id, which is carried
+ * in the traceId field of the request header of any RPCs issued on its
+ * behalf (such as replica writes). Code along the way records events with
+ * recordSampled, which costs only a test of currentTraceId for RPCs that
+ * aren't being traced; getSampledTrace returns just these events, with
+ * wall-clock times, and printRpcTimelines stitches together the results
+ * from all of the servers in a cluster.
  */
 class TimeTrace {
   public:
     class Buffer;
+    class TraceScope;
+    static string getSampledTrace();
     static string getTrace();
     static void printToLog();
     static void printToLogBackground(Dispatch* dispatch);
+    static string printRpcTimelines(RAMCloud::Buffer* traces);
+    static void setSampleInterval(uint32_t interval);
 
     /**
      * Record an event in a thread-local buffer, creating a new buffer
@@ -91,10 +107,46 @@ class TimeTrace {
         record(Cycles::rdtsc(), format, arg0, arg1, arg2, arg3);
     }
 
+    /**
+     * Record an event for the traced RPC that the current thread is working
+     * on (see currentTraceId), if there is one. The arguments are the same
+     * as for record, except that the trace id is passed to snprintf ahead
+     * of the others, so format must start with SAMPLED_PREFIX.
+     */
+    static inline void recordSampled(const char* format, uint32_t arg1 = 0,
+            uint32_t arg2 = 0, uint32_t arg3 = 0) {
+        if (currentTraceId != 0) {
+            record(format, currentTraceId, arg1, arg2, arg3);
+        }
+    }
+
+    /**
+     * Decide whether an incoming RPC should be traced.
+     *
+     * \return
+     *      A new trace id for the RPC, or 0 if it shouldn't be traced.
+     */
+    static inline uint32_t sampleRpc() {
+        if (sampleInterval == 0) {
+            return 0;
+        }
+        return newTraceId();
+    }
+
     static void reset();
 
+    /// The format strings of all events for traced RPCs start with this
+    /// (see recordSampled).
+    static const char SAMPLED_PREFIX[];
+
+    /// Trace id of the RPC the current thread is working on, or 0 if it
+    /// isn't working on a traced RPC. Copied into the header of RPCs sent
+    /// by the thread.
+    static __thread uint32_t currentTraceId;
+
   PROTECTED:
     TimeTrace();
+    static uint32_t newTraceId();
     static void createThreadBuffer();
     static void printInternal(std::vector<TimeTrace::Buffer*>* traces,
             string* s);
@@ -139,6 +191,13 @@ class TimeTrace {
     // Provides mutual exclusion on threadBuffers and backgroundLogger.
     static SpinLock mutex;
 
+    // Roughly one in this many incoming RPCs is traced; 0 means none are.
+    static uint32_t sampleInterval;
+
+    // Number of incoming RPCs seen by this thread until the next one to
+    // be traced.
+    static __thread uint32_t rpcsUntilSample;
+
     // Count of number of calls to print* that are currently active;
     // if nonzero, then it isn't safe to log new entries, since this
     // could interfere with readers.
@@ -201,6 +260,30 @@ class TimeTrace {
         friend class TimeTrace;
         DISALLOW_COPY_AND_ASSIGN(Buffer);
     };
+
+    /**
+     * Sets currentTraceId for as long as an object of this class exists,
+     * then restores the previous value.
+     */
+    class TraceScope {
+      public:
+        explicit TraceScope(uint32_t traceId)
+            : savedTraceId(currentTraceId)
+        {
+            currentTraceId = traceId;
+        }
+
+        ~TraceScope()
+        {
+            currentTraceId = savedTraceId;
+        }
+
+      PRIVATE:
+        // Value of currentTraceId when this object was constructed.
+        uint32_t savedTraceId;
+
+        DISALLOW_COPY_AND_ASSIGN(TraceScope);
+    };
 };
 
 } // namespace RAMCloud
@@ -14,9 +14,12 @@
  */
 
 #include "TestUtil.h"
+#include "Buffer.h"
 #include "Dispatch.h"
 #include "Logger.h"
+#include "ServerId.h"
 #include "TimeTrace.h"
+#include "WireFormat.h"
 
 namespace RAMCloud {
 class TimeTraceTest : public ::testing::Test {
@@ -47,12 +50,48 @@ class TimeTraceTest : public ::testing::Test {
         delete TimeTrace::backgroundLogger;
         TimeTrace::backgroundLogger = NULL;
         TimeTrace::activeReaders = 0;
+        TimeTrace::setSampleInterval(0);
+        TimeTrace::rpcsUntilSample = 0;
+        TimeTrace::currentTraceId = 0;
+    }
+
+    // Append one server's GET_SAMPLED_TIME_TRACE result to a buffer in
+    // the format returned by serverControlAll.
+    void
+    appendServerTrace(Buffer* buffer, ServerId serverId, const char* trace)
+    {
+        if (buffer->size() == 0) {
+            WireFormat::ServerControlAll::Response* header = buffer->
+                    emplaceAppend<WireFormat::ServerControlAll::Response>();
+            header->common.status = STATUS_OK;
+            header->serverCount = 0;
+            header->respCount = 0;
+            header->totalRespLength = 0;
+        }
+        WireFormat::ServerControl::Response* subHead = buffer->
+                emplaceAppend<WireFormat::ServerControl::Response>();
+        subHead->common.status = STATUS_OK;
+        subHead->serverId = serverId.getId();
+        subHead->outputLength = downCast<uint32_t>(strlen(trace));
+        buffer->appendCopy(trace, subHead->outputLength);
     }
 
   private:
     DISALLOW_COPY_AND_ASSIGN(TimeTraceTest);
 };
 
+TEST_F(TimeTraceTest, getSampledTrace) {
+    buffer.record(300, "trace %u: point c", 8);
+    buffer.record(100, "trace %u: point a %u", 7, 3);
+    buffer.record(200, "point b");
+    TimeTrace::threadBuffers.push_back(&buffer);
+    EXPECT_TRUE(TestUtil::matchesPosixRegex(
+            "^[-0-9.]+ trace 7: point a 3\n[-0-9.]+ trace 8: point c$",
+            TimeTrace::getSampledTrace()));
+    EXPECT_EQ(0, TimeTrace::activeReaders);
+    TimeTrace::threadBuffers.pop_back();
+}
+
 TEST_F(TimeTraceTest, getTrace) {
     TimeTrace::record(100, "point a");
     buffer.record(100, "point b");
@@ -174,6 +213,43 @@ TEST_F(TimeTraceTest, printToLogBackground) {
     EXPECT_EQ(0, TimeTrace::activeReaders);
 }
 
+TEST_F(TimeTraceTest, printRpcTimelines) {
+    Buffer traces;
+    appendServerTrace(&traces, ServerId(1, 0),
+            "100.000000 trace 5: dispatch received\n"
+            "100.000002 trace 9: other rpc\n"
+            "100.000003 trace 5: sending reply");
+    appendServerTrace(&traces, ServerId(2, 0),
+            "not a traced event\n"
+            "100.000001 trace 5: backup wrote");
+    EXPECT_EQ("Trace 5:\n"
+            "      0.00 us  server 1.0    dispatch received\n"
+            "      1.00 us  server 2.0    backup wrote\n"
+            "      3.00 us  server 1.0    sending reply\n"
+            "Trace 9:\n"
+            "      0.00 us  server 1.0    other rpc\n",
+            TimeTrace::printRpcTimelines(&traces));
+}
+
+TEST_F(TimeTraceTest, printRpcTimelines_noTraces) {
+    Buffer traces;
+    appendServerTrace(&traces, ServerId(1, 0), "");
+    EXPECT_EQ("No traced RPCs\n", TimeTrace::printRpcTimelines(&traces));
+}
+
+TEST_F(TimeTraceTest, recordSampled) {
+    TimeTrace::recordSampled("trace %u: not traced %u", 1);
+    {
+        TimeTrace::TraceScope scope(12);
+        TimeTrace::recordSampled("trace %u: traced %u", 2);
+    }
+    EXPECT_EQ(0u, TimeTrace::currentTraceId);
+    TimeTrace::recordSampled("trace %u: not traced %u", 3);
+    string trace = TimeTrace::getTrace();
+    EXPECT_EQ(string::npos, trace.find("not traced"));
+    EXPECT_NE(string::npos, trace.find("trace 12: traced 2"));
+}
+
 TEST_F(TimeTraceTest, reset) {
     TimeTrace::record(100, "point a");
     buffer.record(100, "point b");
@@ -186,6 +262,22 @@ TEST_F(TimeTraceTest, reset) {
     TimeTrace::threadBuffers.pop_back();
 }
 
+TEST_F(TimeTraceTest, sampleRpc) {
+    EXPECT_EQ(0u, TimeTrace::sampleRpc());
+
+    TimeTrace::setSampleInterval(1);
+    EXPECT_NE(0u, TimeTrace::sampleRpc());
+    EXPECT_NE(0u, TimeTrace::sampleRpc());
+
+    TimeTrace::setSampleInterval(10);
+    TimeTrace::rpcsUntilSample = 3;
+    EXPECT_EQ(0u, TimeTrace::sampleRpc());
+    EXPECT_EQ(0u, TimeTrace::sampleRpc());
+    EXPECT_NE(0u, TimeTrace::sampleRpc());
+    EXPECT_LE(1u, TimeTrace::rpcsUntilSample);
+    EXPECT_GE(19u, TimeTrace::rpcsUntilSample);
+}
+
 TEST_F(TimeTraceTest, Buffer_constructor) {
     EXPECT_EQ(0, buffer.events[0].format);
     EXPECT_EQ(0, buffer.events[0].format);
@@ -24,6 +24,7 @@
 #include "Buffer.h"
 #include "CodeLocation.h"
 #include "Exception.h"
+#include "SlowRpcLog.h"
 
 namespace RAMCloud {
 class ServiceLocator;
@@ -74,6 +75,9 @@ class Transport {
             , replyPayload()
             , epoch(0)
             , activities(~0)
+            , arrivalTime(0)
+            , traceId(0)
+            , workerTimes()
             , outstandingRpcListHook()
         {}
 
@@ -152,6 +156,26 @@ class Transport {
         static const int READ_ACTIVITY = 1;
         static const int APPEND_ACTIVITY = 2;
 
+        /**
+         * Cycles::rdtsc time when WorkerManager received this request; used
+         * to measure how long it waited for a worker thread.
+         */
+        uint64_t arrivalTime;
+
+        /**
+         * Trace id under which events for this request are recorded (see
+         * TimeTrace::sampleRpc), or 0 if it isn't being traced. Set by
+         * WorkerManager.
+         */
+        uint32_t traceId;
+
+        /**
+         * Where the worker thread that executed this request spent its
+         * time, for SlowRpcLog. Filled in by the worker when it hands the
+         * reply back to the dispatch thread.
+         */
+        SlowRpcLog::RpcTimes workerTimes;
+
         /**
          * Hook for the list of active server RPCs that the ServerRpcPool class
          * maintains. RPCs are added when ServerRpc-derived classes are
@@ -19,6 +19,7 @@
 #include "OptionParser.h"
 #include "ShortMacros.h"
 #include "RawMetrics.h"
+#include "SharedMemoryDriver.h"
 #include "TransportManager.h"
 #include "TransportFactory.h"
 #include "TcpTransport.h"
@@ -62,6 +63,17 @@ static struct BasicUdpTransportFactory : public TransportFactory {
     }
 } basicUdpTransportFactory;
 
+static struct BasicSharedMemoryTransportFactory : public TransportFactory {
+    BasicSharedMemoryTransportFactory()
+        : TransportFactory("basic+sharedmemory", "basic+shm") {}
+    Transport* createTransport(Context* context,
+            const ServiceLocator* localServiceLocator) {
+        return new BasicTransport(context, localServiceLocator,
+                new SharedMemoryDriver(context, localServiceLocator),
+                generateRandom());
+    }
+} basicSharedMemoryTransportFactory;
+
 #ifdef ONLOAD
 static struct BasicSolarFlareTransportFactory : public TransportFactory {
     BasicSolarFlareTransportFactory()
@@ -142,6 +154,7 @@ TransportManager::TransportManager(Context* context)
 {
     transportFactories.push_back(&tcpTransportFactory);
     transportFactories.push_back(&basicUdpTransportFactory);
+    transportFactories.push_back(&basicSharedMemoryTransportFactory);
 #ifdef ONLOAD
     transportFactories.push_back(&basicSolarFlareTransportFactory);
 #endif
@@ -22,11 +22,17 @@
 #include "Common.h"
 #include "Cycles.h"
 #include "Fence.h"
+#include "PerfStats.h"
 #include "ShortMacros.h"
 #include "UdpDriver.h"
 #include "ServiceLocator.h"
 #include "TimeTrace.h"
 
+// Older system headers may not define this.
+#ifndef SO_BUSY_POLL
+#define SO_BUSY_POLL 46
+#endif
+
 namespace RAMCloud {
 
 /**
@@ -52,7 +58,8 @@ Syscall* UdpDriver::sys = &defaultSyscall;
  *      identifying the desired socket.  If NULL then a port will be
  *      chosen by system software. Typically the socket is specified
  *      explicitly for server-side drivers but not for client-side
- *      drivers.
+ *      drivers. The "busyPoll" option selects polled receives (see
+ *      pollReceive).
  */
 UdpDriver::UdpDriver(Context* context,
         const ServiceLocator* localServiceLocator)
@@ -68,12 +75,24 @@ UdpDriver::UdpDriver(Context* context,
     , maxTransmitQueueSize(0)
     , readerThread()
     , readerThreadExit(false)
+    , pollReceive(false)
+    , transmitBatching(true)
+    , transmitBatch()
 {
     if (localServiceLocator != NULL) {
         locatorString = localServiceLocator->getDriverLocatorString();
         try {
             bandwidthGbps = localServiceLocator->getOption<int>("gbs");
         } catch (ServiceLocator::NoSuchKeyException& e) {}
+        transmitBatching = localServiceLocator->getOption<bool>("txBatch",
+                true);
+    }
+    int busyPollMicros = 0;
+    if (localServiceLocator != NULL) {
+        try {
+            busyPollMicros = localServiceLocator->getOption<int>("busyPoll");
+            pollReceive = true;
+        } catch (ServiceLocator::NoSuchKeyException& e) {}
     }
     queueEstimator.setBandwidth(1000*bandwidthGbps);
     maxTransmitQueueSize = (uint32_t) (static_cast<double>(bandwidthGbps)
@@ -119,8 +138,23 @@ UdpDriver::UdpDriver(Context* context,
         LOG(NOTICE, "UdpDriver using port %d", NTOHS(address.sin_port));
     }
 
+    if (pollReceive && (busyPollMicros > 0)) {
+        if (sys->setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busyPollMicros,
+                sizeof(busyPollMicros)) != 0) {
+            // Polling still works without this; the kernel just won't
+            // spin on the NIC when the socket is empty.
+            LOG(WARNING, "UdpDriver couldn't set SO_BUSY_POLL: %s",
+                    strerror(errno));
+        }
+    }
+
     socketFd = fd;
-    readerThread.construct(readerThreadMain, this);
+    if (pollReceive) {
+        LOG(NOTICE, "UdpDriver polling for incoming packets (busyPoll "
+                "%d usec)", busyPollMicros);
+    } else {
+        readerThread.construct(readerThreadMain, this);
+    }
 
     LOG(NOTICE, "Locator for UdpDriver: %s", locatorString.c_str());
 }
@@ -178,6 +212,10 @@ void
 UdpDriver::receivePackets(uint32_t maxPackets,
             std::vector<Received>* receivedPackets)
 {
+    if (pollReceive) {
+        pollForPackets(maxPackets, receivedPackets);
+        return;
+    }
     PacketBatch* batch = &packetBatches[currentBatch];
     int available = batch->packetsAvailable.load();
     if (available == 0) {
@@ -236,6 +274,48 @@ UdpDriver::sendPacket(const Address* addr,
 
     // one for header, the rest for payload
     uint32_t iovecs = 1 + (payload ? payload->getNumberChunks() : 0);
+    const sockaddr* a = &(static_cast<const IpAddress*>(addr)->address);
+
+    if (transmitBatch.active
+            && (headerLen <= TransmitBatch::MAX_HEADER_LENGTH)
+            && (iovecs <= TransmitBatch::MAX_IOVECS)) {
+        // Add this packet to the current batch, making room first if
+        // necessary.
+        if ((transmitBatch.packets == TransmitBatch::MAX_PACKETS) ||
+                ((transmitBatch.iovecsUsed + iovecs)
+                > TransmitBatch::MAX_IOVECS)) {
+            sendTransmitBatch();
+        }
+        int slot = transmitBatch.packets;
+        struct iovec* iov = &transmitBatch.iovecs[transmitBatch.iovecsUsed];
+        memcpy(transmitBatch.headers[slot], header, headerLen);
+        iov[0].iov_base = transmitBatch.headers[slot];
+        iov[0].iov_len = headerLen;
+        uint32_t i = 1;
+        while (payload && !payload->isDone()) {
+            iov[i].iov_base = const_cast<void*>(payload->getData());
+            iov[i].iov_len = payload->getLength();
+            ++i;
+            payload->next();
+        }
+        transmitBatch.recipients[slot] = *a;
+
+        struct msghdr* msg = &transmitBatch.messageHeaders[slot].msg_hdr;
+        memset(msg, 0, sizeof(*msg));
+        msg->msg_iov = iov;
+        msg->msg_iovlen = iovecs;
+        msg->msg_name = &transmitBatch.recipients[slot];
+        msg->msg_namelen = sizeof(*a);
+        transmitBatch.iovecsUsed += iovecs;
+        transmitBatch.packets++;
+        return;
+    }
+
+    // This packet will be sent immediately; make sure it doesn't pass
+    // any packets that are already waiting in a batch.
+    if (transmitBatch.packets > 0) {
+        sendTransmitBatch();
+    }
 
     struct iovec iov[iovecs];
     iov[0].iov_base = const_cast<void*>(header);
@@ -254,19 +334,145 @@ UdpDriver::sendPacket(const Address* addr,
     msg.msg_iov = iov;
     msg.msg_iovlen = iovecs;
 
-    const sockaddr* a = &(static_cast<const IpAddress*>(addr)->address);
     msg.msg_name = const_cast<sockaddr *>(a);
     msg.msg_namelen = sizeof(*a);
 
     ssize_t r = sys->sendmsg(socketFd, &msg, 0);
+    PerfStats::threadStats.networkOutputSyscalls++;
     if (r == -1) {
         LOG(WARNING, "UdpDriver error sending to socket: %s", strerror(errno));
         return;
     }
     queueEstimator.packetQueued(totalLength, Cycles::rdtsc());
+    PerfStats::threadStats.networkOutputPackets++;
+    PerfStats::threadStats.networkOutputBytes += r;
     assert(static_cast<size_t>(r) == totalLength);
 }
 
+// See docs in Driver class.
+void
+UdpDriver::startTransmitBatch()
+{
+    transmitBatch.active = transmitBatching;
+}
+
+// See docs in Driver class.
+void
+UdpDriver::flushTransmitBatch()
+{
+    if (transmitBatch.packets > 0) {
+        sendTransmitBatch();
+    }
+    transmitBatch.active = false;
+}
+
+/**
+ * Pass all of the packets in transmitBatch to the kernel, using as few
+ * sendmmsg calls as possible, and leave the batch empty.
+ */
+void
+UdpDriver::sendTransmitBatch()
+{
+    int sent = 0;
+    while ((sent < transmitBatch.packets) && (socketFd != -1)) {
+        int r = sys->sendmmsg(socketFd, &transmitBatch.messageHeaders[sent],
+                transmitBatch.packets - sent, 0);
+        PerfStats::threadStats.networkOutputSyscalls++;
+        if (r < 0) {
+            // The first packet couldn't be sent; drop it (just as if it
+            // had been sent individually) and keep going with the rest.
+            LOG(WARNING, "UdpDriver error sending to socket: %s",
+                    strerror(errno));
+            sent++;
+            continue;
+        }
+        uint64_t now = Cycles::rdtsc();
+        for (int i = sent; i < sent + r; i++) {
+            uint32_t length = transmitBatch.messageHeaders[i].msg_len;
+            queueEstimator.packetQueued(length, now);
+            PerfStats::threadStats.networkOutputBytes += length;
+        }
+        PerfStats::threadStats.networkOutputPackets += r;
+        sent += r;
+    }
+    transmitBatch.packets = 0;
+    transmitBatch.iovecsUsed = 0;
+}
+
+/**
+ * Refill any empty slots at the beginning of a PacketBatch with fresh
+ * packet buffers, and initialize the corresponding message headers for
+ * a recvmmsg call.
+ *
+ * \param batch
+ *      Batch to prepare for the next kernel call.
+ */
+void
+UdpDriver::fillPacketBatch(PacketBatch* batch)
+{
+    SpinLock::Guard guard(mutex);
+    for (int i = 0; i < PacketBatch::MAX_PACKETS; i++) {
+        if (batch->buffers[i] != NULL) {
+            break;
+        }
+        struct mmsghdr* header = &batch->messageHeaders[i];
+        PacketBuf* buffer = packetBufPool.construct();
+        buffer->sender.construct();
+        batch->buffers[i] = buffer;
+        header->msg_hdr.msg_name = &buffer->sender->address;
+        header->msg_hdr.msg_namelen = sizeof(buffer->sender->address);
+        header->msg_hdr.msg_iov = &buffer->iovec;
+        header->msg_hdr.msg_iovlen = 1;
+        header->msg_hdr.msg_control = NULL;
+        header->msg_hdr.msg_controllen = 0;
+        header->msg_hdr.msg_flags = 0;
+    }
+}
+
+/**
+ * Used by receivePackets when pollReceive is set: receive incoming
+ * packets directly from the socket in the calling (dispatch) thread,
+ * without waiting if none are available.
+ *
+ * \param maxPackets
+ *      Maximum number of packets to return.
+ * \param receivedPackets
+ *      Received packets are appended to this vector.
+ */
+void
+UdpDriver::pollForPackets(uint32_t maxPackets,
+            std::vector<Received>* receivedPackets)
+{
+    if (socketFd == -1) {
+        return;
+    }
+    PacketBatch* batch = &packetBatches[0];
+    fillPacketBatch(batch);
+    unsigned int count = PacketBatch::MAX_PACKETS;
+    if (maxPackets < count) {
+        count = maxPackets;
+    }
+    ssize_t numPackets = sys->recvmmsg(socketFd, batch->messageHeaders,
+            count, MSG_DONTWAIT, NULL);
+    if (numPackets <= 0) {
+        if ((numPackets < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+            RAMCLOUD_CLOG(WARNING, "UdpDriver error receiving from socket: %s",
+                    strerror(errno));
+        }
+        return;
+    }
+
+    // The buffers for the packets just received are handed off to the
+    // caller; this leaves empty slots at the front of the batch, as
+    // expected by fillPacketBatch.
+    for (ssize_t i = 0; i < numPackets; i++) {
+        PacketBuf* buffer = batch->buffers[i];
+        receivedPackets->emplace_back(buffer->sender.get(), this,
+                batch->messageHeaders[i].msg_len, buffer->payload);
+        batch->buffers[i] = NULL;
+    }
+}
+
 /**
  * Notify the reader thread that it should exit. Don't actually wait for the
  * thread to return here, though.
@@ -333,25 +539,7 @@ UdpDriver::readerThreadMain(UdpDriver* driver)
         // Initialize the arguments that will be passed to the kernel call.
         // Typically, some number of the initial buffers will be invalid
         // because packets were received if
-        {
-            SpinLock::Guard guard(driver->mutex);
-            for (int i = 0; i < PacketBatch::MAX_PACKETS; i++) {
-                if (batch->buffers[i] != NULL) {
-                    break;
-                }
-                struct mmsghdr* header = &batch->messageHeaders[i];
-                PacketBuf* buffer = driver->packetBufPool.construct();
-                buffer->sender.construct();
-                batch->buffers[i] = buffer;
-                header->msg_hdr.msg_name = &buffer->sender->address;
-                header->msg_hdr.msg_namelen = sizeof(buffer->sender->address);
-                header->msg_hdr.msg_iov = &buffer->iovec;
-                header->msg_hdr.msg_iovlen = 1;
-                header->msg_hdr.msg_control = NULL;
-                header->msg_hdr.msg_controllen = 0;
-                header->msg_hdr.msg_flags = 0;
-            }
-        }
+        driver->fillPacketBatch(batch);
 
         // Wait for one or more incoming packets
         ssize_t numPackets = sys->recvmmsg(driver->socketFd,
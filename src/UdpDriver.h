@@ -53,6 +53,8 @@ class UdpDriver : public Driver {
                             uint32_t headerLen,
                             Buffer::Iterator* payload,
                             int priority = 0);
+    virtual void startTransmitBatch();
+    virtual void flushTransmitBatch();
     virtual string getServiceLocator();
 
     virtual Address* newAddress(const ServiceLocator* serviceLocator) {
@@ -60,7 +62,12 @@ class UdpDriver : public Driver {
     }
 
   PROTECTED:
+    struct PacketBatch;
+    void fillPacketBatch(PacketBatch* batch);
     static void readerThreadMain(UdpDriver* driver);
+    void pollForPackets(uint32_t maxPackets,
+            std::vector<Received>* receivedPackets);
+    void sendTransmitBatch();
     void stopReaderThread();
 
     struct PacketBuf : Driver::PacketBuf<IpAddress, MAX_PAYLOAD_SIZE> {
@@ -121,6 +128,56 @@ class UdpDriver : public Driver {
         }
     };
 
+    /**
+     * Holds outgoing packets between calls to startTransmitBatch and
+     * flushTransmitBatch, so that they can be passed to the kernel with
+     * a single sendmmsg call instead of one sendmsg call each.
+     */
+    struct TransmitBatch {
+        /// Maximum number of packets in one sendmmsg call.
+        static const int MAX_PACKETS = 16;
+
+        /// Maximum number of iovecs (across all packets) in one batch.
+        static const int MAX_IOVECS = 128;
+
+        /// Packet headers longer than this are sent without batching.
+        static const uint32_t MAX_HEADER_LENGTH = 64;
+
+        /// True means sendPacket should add packets to this batch rather
+        /// than transmitting them immediately.
+        bool active;
+
+        /// Number of packets currently held in the batch.
+        int packets;
+
+        /// Number of entries of iovecs currently in use.
+        int iovecsUsed;
+
+        /// Arguments for sendmmsg, one per packet; on return from the
+        /// kernel call, msg_len holds the number of bytes sent.
+        struct mmsghdr messageHeaders[MAX_PACKETS];
+
+        /// Copies of the destination addresses for each packet.
+        sockaddr recipients[MAX_PACKETS];
+
+        /// Copies of the transport headers for each packet (sendPacket
+        /// callers need not preserve their headers).
+        char headers[MAX_PACKETS][MAX_HEADER_LENGTH];
+
+        /// Describes the header and payload chunks for all packets.
+        struct iovec iovecs[MAX_IOVECS];
+
+        TransmitBatch()
+            : active(false)
+            , packets(0)
+            , iovecsUsed(0)
+            , messageHeaders()
+            , recipients()
+            , headers()
+            , iovecs()
+        {}
+    };
+
     /// Shared RAMCloud information.
     Context* context;
 
@@ -172,6 +229,24 @@ class UdpDriver : public Driver {
     /// will exit immediately.
     bool readerThreadExit;
 
+    /// True means there is no reader thread: receivePackets polls the
+    /// socket directly with non-blocking recvmmsg calls, using
+    /// packetBatches[0]. This eliminates a handoff between cores for each
+    /// packet, at the cost of a kernel call in every dispatch poll. Set
+    /// with the "busyPoll" option in the service locator; the option's
+    /// value (if nonzero) is also passed to the kernel as SO_BUSY_POLL,
+    /// the number of microseconds the kernel may spin on the NIC's receive
+    /// queue when the socket is empty.
+    bool pollReceive;
+
+    /// True means startTransmitBatch will enable batching of outgoing
+    /// packets; false means packets are always sent one at a time. Set
+    /// with the "txBatch" option in the service locator (default 1).
+    bool transmitBatching;
+
+    /// Outgoing packets waiting to be flushed.
+    TransmitBatch transmitBatch;
+
     DISALLOW_COPY_AND_ASSIGN(UdpDriver);
 };
 
@@ -129,6 +129,32 @@ TEST_F(UdpDriverTest, constructor_gbsOption) {
     EXPECT_EQ(2800u, driver2.maxTransmitQueueSize);
     Cycles::mockCyclesPerSec = 0;
 }
+TEST_F(UdpDriverTest, constructor_txBatchOption) {
+    EXPECT_TRUE(server.transmitBatching);
+    ServiceLocator serverLocator("basic+udp:host=localhost,port=8101,"
+            "txBatch=0");
+    UdpDriver driver(&context, &serverLocator);
+    EXPECT_FALSE(driver.transmitBatching);
+}
+
+TEST_F(UdpDriverTest, constructor_busyPollOption) {
+    EXPECT_FALSE(server.pollReceive);
+    EXPECT_TRUE(server.readerThread);
+    ServiceLocator serverLocator("basic+udp:host=localhost,port=8101,"
+            "busyPoll=0");
+    UdpDriver driver(&context, &serverLocator);
+    EXPECT_TRUE(driver.pollReceive);
+    EXPECT_FALSE(driver.readerThread);
+}
+TEST_F(UdpDriverTest, constructor_errorSettingBusyPoll) {
+    sys->setsockoptErrno = EPERM;
+    ServiceLocator serverLocator("basic+udp:host=localhost,port=8101,"
+            "busyPoll=50");
+    UdpDriver driver(&context, &serverLocator);
+    EXPECT_TRUE(TestUtil::contains(TestLog::get(),
+            "UdpDriver couldn't set SO_BUSY_POLL: Operation not permitted"));
+    EXPECT_TRUE(driver.pollReceive);
+}
 TEST_F(UdpDriverTest, constructor_errorInSocketCall) {
     sys->socketErrno = EPERM;
     try {
@@ -249,6 +275,45 @@ TEST_F(UdpDriverTest, receivePackets_receivePartialBatches) {
     EXPECT_EQ(0, server.currentBatch);
 }
 
+TEST_F(UdpDriverTest, receivePackets_pollReceive) {
+    ServiceLocator locator("basic+udp:host=localhost,port=8101,busyPoll=0");
+    IpAddress address(&locator);
+    UdpDriver driver(&context, &locator);
+    client.sendPacket(&address, "packet1", 7, NULL);
+    client.sendPacket(&address, "packet2", 7, NULL);
+    client.sendPacket(&address, "packet3", 7, NULL);
+    EXPECT_EQ("packet1, packet2", receivePackets(&driver, 2));
+    EXPECT_TRUE(driver.packetBatches[0].buffers[0] == NULL);
+    EXPECT_TRUE(driver.packetBatches[0].buffers[1] == NULL);
+    EXPECT_FALSE(driver.packetBatches[0].buffers[2] == NULL);
+    EXPECT_EQ("packet3", receivePackets(&driver));
+}
+
+TEST_F(UdpDriverTest, pollForPackets_noPacketsAvailable) {
+    ServiceLocator locator("basic+udp:host=localhost,port=8101,busyPoll=0");
+    UdpDriver driver(&context, &locator);
+    TestLog::reset();
+    std::vector<Driver::Received> received;
+    driver.receivePackets(10, &received);
+    EXPECT_EQ(0lu, received.size());
+    EXPECT_EQ("", TestLog::get());
+}
+TEST_F(UdpDriverTest, pollForPackets_errorInRecvmmsg) {
+    ServiceLocator locator("basic+udp:host=localhost,port=8101,busyPoll=0");
+    IpAddress address(&locator);
+    UdpDriver driver(&context, &locator);
+    TestLog::reset();
+    sys->recvmmsgErrno = EPERM;
+    std::vector<Driver::Received> received;
+    driver.receivePackets(10, &received);
+    EXPECT_EQ(0lu, received.size());
+    EXPECT_EQ("pollForPackets: UdpDriver error receiving from socket: "
+            "Operation not permitted", TestLog::get());
+
+    client.sendPacket(&address, "packet1", 7, NULL);
+    EXPECT_EQ("packet1", receivePackets(&driver));
+}
+
 TEST_F(UdpDriverTest, sendPacket_alreadyClosed) {
     Buffer message;
     message.appendExternal("xyzzy", 5);
@@ -295,6 +360,82 @@ TEST_F(UdpDriverTest, sendPacket_errorInSend) {
             "Operation not permitted", TestLog::get());
 }
 
+TEST_F(UdpDriverTest, sendPacket_batched) {
+    client.startTransmitBatch();
+    sendMessage(&client, &serverAddress, "h1:", "first");
+    sendMessage(&client, &serverAddress, "h2:", "second");
+    sendMessage(&client, &serverAddress, "h3:", "third");
+    EXPECT_EQ(3, client.transmitBatch.packets);
+    EXPECT_EQ(6, client.transmitBatch.iovecsUsed);
+    EXPECT_EQ(0, sys->sendmmsgCount);
+
+    client.flushTransmitBatch();
+    EXPECT_EQ(1, sys->sendmmsgCount);
+    EXPECT_EQ(0, client.transmitBatch.packets);
+    EXPECT_FALSE(client.transmitBatch.active);
+    EXPECT_EQ("h1:first", receivePackets(&server, 1));
+    EXPECT_EQ("h2:second", receivePackets(&server, 1));
+    EXPECT_EQ("h3:third", receivePackets(&server, 1));
+}
+
+TEST_F(UdpDriverTest, sendPacket_batchFull) {
+    client.startTransmitBatch();
+    for (int i = 0; i <= UdpDriver::TransmitBatch::MAX_PACKETS; i++) {
+        sendMessage(&client, &serverAddress, "h:", "abc");
+    }
+    EXPECT_EQ(1, sys->sendmmsgCount);
+    EXPECT_EQ(1, client.transmitBatch.packets);
+    client.flushTransmitBatch();
+    EXPECT_EQ(2, sys->sendmmsgCount);
+}
+
+TEST_F(UdpDriverTest, sendPacket_unbatchedPacketFlushesBatch) {
+    client.startTransmitBatch();
+    sendMessage(&client, &serverAddress, "h1:", "first");
+    string longHeader(UdpDriver::TransmitBatch::MAX_HEADER_LENGTH + 1, 'x');
+    sendMessage(&client, &serverAddress, longHeader.c_str(), "second");
+    EXPECT_EQ(1, sys->sendmmsgCount);
+    EXPECT_EQ(0, client.transmitBatch.packets);
+    EXPECT_TRUE(client.transmitBatch.active);
+    EXPECT_EQ("h1:first", receivePackets(&server, 1));
+    EXPECT_EQ(longHeader + "second", receivePackets(&server, 1));
+}
+
+TEST_F(UdpDriverTest, startTransmitBatch_batchingDisabled) {
+    client.transmitBatching = false;
+    client.startTransmitBatch();
+    sendMessage(&client, &serverAddress, "h1:", "first");
+    EXPECT_EQ(0, client.transmitBatch.packets);
+    EXPECT_EQ("h1:first", receivePackets(&server, 1));
+    client.flushTransmitBatch();
+    EXPECT_EQ(0, sys->sendmmsgCount);
+}
+
+TEST_F(UdpDriverTest, sendTransmitBatch_partialSend) {
+    client.startTransmitBatch();
+    sendMessage(&client, &serverAddress, "h1:", "first");
+    sendMessage(&client, &serverAddress, "h2:", "second");
+    sendMessage(&client, &serverAddress, "h3:", "third");
+    sys->sendmmsgReturnCount = 1;
+    client.flushTransmitBatch();
+    EXPECT_EQ(2, sys->sendmmsgCount);
+    EXPECT_EQ("h1:first", receivePackets(&server, 1));
+    EXPECT_EQ("h2:second", receivePackets(&server, 1));
+    EXPECT_EQ("h3:third", receivePackets(&server, 1));
+}
+
+TEST_F(UdpDriverTest, sendTransmitBatch_errorInSend) {
+    client.startTransmitBatch();
+    sendMessage(&client, &serverAddress, "h1:", "first");
+    sendMessage(&client, &serverAddress, "h2:", "second");
+    sys->sendmmsgErrno = EPERM;
+    client.flushTransmitBatch();
+    EXPECT_EQ("sendTransmitBatch: UdpDriver error sending to socket: "
+            "Operation not permitted", TestLog::get());
+    EXPECT_EQ(2, sys->sendmmsgCount);
+    EXPECT_EQ("h2:second", receivePackets(&server, 1));
+}
+
 TEST_F(UdpDriverTest, stopReaderThread_basics) {
     client.stopReaderThread();
     TestUtil::waitForLog();
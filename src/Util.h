@@ -30,7 +30,9 @@ namespace Util {
 void clearCpuAffinity(void);
 void genRandomString(char* str, const int length);
 string getCpuAffinityString(void);
+int getNumaNode(void);
 string hexDump(const void *buffer, uint64_t bytes);
+bool pinThreadToNumaNode(int node);
 void spinAndCheckGaps(int count);
 bool timespecLess(const struct timespec& t1, const struct timespec& t2);
 bool timespecLessEqual(const struct timespec& t1, const struct timespec& t2);
@@ -0,0 +1,452 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#if ENABLE_LZ4
+#include <lz4.h>
+#endif
+
+#include "ValueCompressor.h"
+#include "Crc32C.h"
+#include "Cycles.h"
+#include "ShortMacros.h"
+#include "TableStats.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct a ValueCompressor.
+ *
+ * \param config
+ *      The server's configuration. Compression is enabled if
+ *      config->master.valueDictionaryBytes is nonzero.
+ * \param log
+ *      Log to which new dictionaries are appended; it must also hold the
+ *      objects compressed with them.
+ * \param masterTableMetadata
+ *      Compression statistics for each table are recorded here.
+ */
+ValueCompressor::ValueCompressor(const ServerConfig* config, AbstractLog* log,
+                                 MasterTableMetadata* masterTableMetadata)
+    : config(config)
+    , log(log)
+    , masterTableMetadata(masterTableMetadata)
+    , mutex("ValueCompressor::mutex")
+    , tables()
+    , dictionaries()
+{
+#if !ENABLE_LZ4
+    if (config->master.valueDictionaryBytes != 0) {
+        LOG(WARNING, "Not built with LZ4 support; values will be stored "
+            "uncompressed");
+    }
+#endif
+}
+
+ValueCompressor::~ValueCompressor()
+{
+    foreach (DictionaryMap::value_type& entry, dictionaries)
+        delete entry.second;
+}
+
+/**
+ * Append every dictionary this server has for a table to a segment, so
+ * that the table's compressed objects can be read wherever the segment
+ * ends up. Used when copying a tablet's objects to another server.
+ *
+ * \param tableId
+ *      Table whose dictionaries are wanted.
+ * \param segment
+ *      Segment to append LOG_ENTRY_TYPE_VALUEDICT entries to.
+ * \throw FatalError
+ *      The segment didn't have room for the dictionaries.
+ */
+void
+ValueCompressor::appendDictionaries(uint64_t tableId, Segment* segment)
+{
+    vector<Dictionary*> tableDictionaries;
+    {
+        SpinLock::Guard _(mutex);
+        DictionaryMap::iterator it =
+            dictionaries.lower_bound(std::make_pair(tableId, 0U));
+        for (; it != dictionaries.end() && it->first.first == tableId; it++)
+            tableDictionaries.push_back(it->second);
+    }
+
+    foreach (Dictionary* dictionary, tableDictionaries) {
+        Buffer entry;
+        DictionaryHeader* header = entry.emplaceAppend<DictionaryHeader>();
+        header->tableId = tableId;
+        header->dictionaryId = dictionary->dictionaryId;
+        header->length = downCast<uint32_t>(dictionary->bytes.size());
+        entry.appendExternal(dictionary->bytes.data(), header->length);
+        if (!segment->append(LOG_ENTRY_TYPE_VALUEDICT, entry)) {
+            throw FatalError(HERE, format("No room in segment for the value "
+                    "dictionaries of table %lu", tableId));
+        }
+    }
+}
+
+/**
+ * Try to compress the value of an object about to be written to the log.
+ * If the object's table has no dictionary yet, the value is sampled toward
+ * one instead; the table's dictionary is appended to the log once enough
+ * samples have been collected.
+ *
+ * \param object
+ *      Object whose value should be compressed. Not modified.
+ * \param[out] keysAndValue
+ *      Empty buffer. If the value was compressed, the object's keys followed
+ *      by the compressed value are left here; the caller should construct a
+ *      new Object from them and mark it with Object::setValueCompressed.
+ * \return
+ *      True if the value was compressed, false if the object should be
+ *      stored as is (compression is disabled, the value is too short or too
+ *      long, the table has no dictionary yet, or compression didn't help).
+ */
+bool
+ValueCompressor::compress(Object& object, Buffer* keysAndValue)
+{
+    if (!isEnabled())
+        return false;
+
+    uint32_t valueOffset;
+    if (!object.getValueOffset(&valueOffset))
+        return false;
+    uint32_t valueLength = object.getValueLength();
+    if (valueLength < MIN_VALUE_LENGTH || valueLength > MAX_VALUE_LENGTH)
+        return false;
+
+    uint64_t tableId = object.getTableId();
+    const char* keys = static_cast<const char*>(object.getKeysAndValue());
+    const char* value = keys + valueOffset;
+
+    Dictionary* dictionary = NULL;
+    string samples;
+    {
+        SpinLock::Guard lock(mutex);
+        Table& table = tables[tableId];
+        if (table.hasDictionary) {
+            dictionary = findDictionary(lock, tableId, table.dictionaryId);
+        } else if (!table.building) {
+            table.samples.append(value, valueLength);
+            if (table.samples.size() >=
+                    config->master.valueDictionaryBytes) {
+                table.building = true;
+                samples.swap(table.samples);
+            }
+        }
+    }
+    if (dictionary == NULL) {
+        if (!samples.empty())
+            buildDictionary(tableId, samples);
+        return false;
+    }
+
+#if ENABLE_LZ4
+    uint64_t start = Cycles::rdtsc();
+
+    // Only compressed values strictly shorter than the original are useful;
+    // limiting LZ4's output to that lets it give up early on the rest.
+    int capacity = downCast<int>(valueLength - sizeof32(CompressedValueHeader)
+                                 - 1);
+    keysAndValue->appendCopy(keys, valueOffset);
+    CompressedValueHeader* header =
+        keysAndValue->emplaceAppend<CompressedValueHeader>();
+    header->dictionaryId = dictionary->dictionaryId;
+    header->uncompressedLength = valueLength;
+    char* output = static_cast<char*>(
+        keysAndValue->alloc(static_cast<uint32_t>(capacity)));
+
+    LZ4_stream_t stream;
+    memcpy(&stream, dictionary->stream, sizeof(stream));
+    int outputLength = LZ4_compress_fast_continue(&stream, value, output,
+            downCast<int>(valueLength), capacity, 1);
+
+    uint64_t storedLength = valueLength;
+    if (outputLength > 0) {
+        keysAndValue->truncate(keysAndValue->size() -
+                static_cast<uint32_t>(capacity - outputLength));
+        storedLength = sizeof32(CompressedValueHeader) +
+                static_cast<uint32_t>(outputLength);
+    } else {
+        keysAndValue->reset();
+    }
+    TableStats::recordCompression(masterTableMetadata, tableId, valueLength,
+            storedLength, Cycles::rdtsc() - start);
+    return outputLength > 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Append the value of an object whose value is compressed (see
+ * Object::isValueCompressed), after decompressing it, to a buffer.
+ *
+ * \param object
+ *      Object read from the log.
+ * \param outBuffer
+ *      The value (preceded by the object's keys, unless \a valueOnly) is
+ *      appended here. Left unchanged if decompression fails.
+ * \param valueOnly
+ *      If true, only the value is appended, as Object::appendValueToBuffer
+ *      would. Otherwise the keys and value are, as
+ *      Object::appendKeysAndValueToBuffer would.
+ * \return
+ *      STATUS_OK, or STATUS_INTERNAL_ERROR if the value couldn't be
+ *      decompressed (which means the log or the dictionary is corrupt).
+ */
+Status
+ValueCompressor::decompress(Object& object, Buffer* outBuffer, bool valueOnly)
+{
+    uint64_t tableId = object.getTableId();
+    uint32_t valueOffset;
+    uint32_t storedLength = object.getValueLength();
+    CompressedValueHeader header;
+    if (!object.getValueOffset(&valueOffset) ||
+            storedLength <= sizeof32(header)) {
+        LOG(ERROR, "Compressed value in table %lu is too short", tableId);
+        return STATUS_INTERNAL_ERROR;
+    }
+    const char* keys = static_cast<const char*>(object.getKeysAndValue());
+    memcpy(&header, keys + valueOffset, sizeof(header));
+
+    Dictionary* dictionary;
+    {
+        SpinLock::Guard lock(mutex);
+        dictionary = findDictionary(lock, tableId, header.dictionaryId);
+    }
+    if (dictionary == NULL || header.uncompressedLength > MAX_VALUE_LENGTH) {
+        LOG(ERROR, "Can't decompress value in table %lu: dictionary 0x%08x "
+            "%s, length %u", tableId, header.dictionaryId,
+            dictionary == NULL ? "unknown" : "known",
+            header.uncompressedLength);
+        return STATUS_INTERNAL_ERROR;
+    }
+
+#if ENABLE_LZ4
+    uint64_t start = Cycles::rdtsc();
+    uint32_t originalSize = outBuffer->size();
+    if (!valueOnly)
+        outBuffer->appendCopy(keys, valueOffset);
+    char* value = static_cast<char*>(
+        outBuffer->alloc(header.uncompressedLength));
+    int valueLength = LZ4_decompress_safe_usingDict(
+            keys + valueOffset + sizeof(header), value,
+            downCast<int>(storedLength - sizeof32(header)),
+            downCast<int>(header.uncompressedLength),
+            dictionary->bytes.data(),
+            downCast<int>(dictionary->bytes.size()));
+    if (valueLength != downCast<int>(header.uncompressedLength)) {
+        outBuffer->truncate(originalSize);
+        LOG(ERROR, "Corrupt compressed value in table %lu", tableId);
+        return STATUS_INTERNAL_ERROR;
+    }
+    TableStats::recordDecompression(masterTableMetadata, tableId,
+            Cycles::rdtsc() - start);
+    return STATUS_OK;
+#else
+    LOG(ERROR, "Not built with LZ4 support; can't decompress value in "
+        "table %lu", tableId);
+    return STATUS_INTERNAL_ERROR;
+#endif
+}
+
+/**
+ * Return a human-readable summary of how well each table's values have
+ * compressed and what it has cost (see TableStats::compressionToString).
+ */
+string
+ValueCompressor::getStats()
+{
+    return TableStats::compressionToString(masterTableMetadata);
+}
+
+/**
+ * Make a dictionary found in a LOG_ENTRY_TYPE_VALUEDICT entry (during
+ * recovery or migration) available for decompressing values. If the
+ * dictionary's table doesn't have a dictionary yet, new values will be
+ * compressed with this one.
+ *
+ * \param entry
+ *      Contents of the log entry.
+ * \return
+ *      True if the dictionary is new to this server, in which case the
+ *      caller should add the entry to its own log. False if it was already
+ *      installed or is corrupt.
+ */
+bool
+ValueCompressor::installDictionary(Buffer& entry)
+{
+    const DictionaryHeader* header = entry.getStart<DictionaryHeader>();
+    if (header == NULL || header->length == 0 ||
+            entry.size() != sizeof32(*header) + header->length) {
+        LOG(ERROR, "Malformed value dictionary entry (%u bytes)",
+            entry.size());
+        return false;
+    }
+    uint64_t tableId = header->tableId;
+    uint32_t dictionaryId = header->dictionaryId;
+    uint32_t length = header->length;
+    const void* bytes = entry.getRange(sizeof32(*header), length);
+    Crc32C crc;
+    crc.update(bytes, length);
+    if (crc.getResult() != dictionaryId) {
+        LOG(ERROR, "Corrupt value dictionary 0x%08x for table %lu",
+            dictionaryId, tableId);
+        return false;
+    }
+
+    SpinLock::Guard lock(mutex);
+    if (findDictionary(lock, tableId, dictionaryId) != NULL)
+        return false;
+    Dictionary* dictionary =
+        new Dictionary(tableId, dictionaryId, bytes, length);
+    dictionaries[std::make_pair(tableId, dictionaryId)] = dictionary;
+    Table& table = tables[tableId];
+    if (!table.hasDictionary) {
+        table.hasDictionary = true;
+        table.dictionaryId = dictionaryId;
+        table.samples.clear();
+    }
+    return true;
+}
+
+/**
+ * Return true if values will be compressed.
+ */
+bool
+ValueCompressor::isEnabled()
+{
+#if ENABLE_LZ4
+    return config->master.valueDictionaryBytes != 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Turn a table's samples into its dictionary: append the dictionary to the
+ * log and start compressing the table's values with it. If the log is out
+ * of space the samples are kept and this is retried on a later write.
+ *
+ * \param tableId
+ *      Table the samples were taken from. Its Table::building flag must
+ *      have been set by the caller.
+ * \param samples
+ *      The table's samples; used up by this method.
+ */
+void
+ValueCompressor::buildDictionary(uint64_t tableId, string& samples)
+{
+    // LZ4 finds matches most cheaply near the end of the dictionary, so
+    // keep the most recent samples.
+    size_t dictionaryBytes = std::min(config->master.valueDictionaryBytes,
+                                      uint32_t(MAX_DICTIONARY_BYTES));
+    if (samples.size() > dictionaryBytes)
+        samples.erase(0, samples.size() - dictionaryBytes);
+    uint32_t length = downCast<uint32_t>(samples.size());
+
+    Crc32C crc;
+    crc.update(samples.data(), length);
+    uint32_t dictionaryId = crc.getResult();
+    Buffer entry;
+    DictionaryHeader* header = entry.emplaceAppend<DictionaryHeader>();
+    header->tableId = tableId;
+    header->dictionaryId = dictionaryId;
+    header->length = length;
+    entry.appendExternal(samples.data(), length);
+
+    bool appended = log->append(LOG_ENTRY_TYPE_VALUEDICT, entry);
+    if (appended) {
+        TableStats::increment(masterTableMetadata, tableId, entry.size(), 1);
+        LOG(NOTICE, "Compressing values of table %lu with %u-byte dictionary "
+            "0x%08x", tableId, length, dictionaryId);
+    }
+
+    SpinLock::Guard lock(mutex);
+    Table& table = tables[tableId];
+    table.building = false;
+    if (!appended) {
+        table.samples.swap(samples);
+        return;
+    }
+    if (findDictionary(lock, tableId, dictionaryId) == NULL) {
+        dictionaries[std::make_pair(tableId, dictionaryId)] =
+            new Dictionary(tableId, dictionaryId, samples.data(), length);
+    }
+    if (!table.hasDictionary) {
+        table.hasDictionary = true;
+        table.dictionaryId = dictionaryId;
+    }
+}
+
+/**
+ * Return the dictionary with a given id for a table, or NULL if there is
+ * no such dictionary.
+ *
+ * \param lock
+ *      Ensures that the caller holds #mutex.
+ * \param tableId
+ *      Table the dictionary belongs to.
+ * \param dictionaryId
+ *      See DictionaryHeader::dictionaryId.
+ */
+ValueCompressor::Dictionary*
+ValueCompressor::findDictionary(const SpinLock::Guard& lock, uint64_t tableId,
+                                uint32_t dictionaryId)
+{
+    DictionaryMap::iterator it =
+        dictionaries.find(std::make_pair(tableId, dictionaryId));
+    if (it == dictionaries.end())
+        return NULL;
+    return it->second;
+}
+
+/**
+ * Construct a Dictionary, preparing it for compression.
+ *
+ * \param tableId
+ *      Table the dictionary belongs to.
+ * \param dictionaryId
+ *      See DictionaryHeader::dictionaryId.
+ * \param bytes
+ *      The dictionary; copied.
+ * \param length
+ *      Number of bytes at \a bytes.
+ */
+ValueCompressor::Dictionary::Dictionary(uint64_t tableId,
+                                        uint32_t dictionaryId,
+                                        const void* bytes, uint32_t length)
+    : tableId(tableId)
+    , dictionaryId(dictionaryId)
+    , bytes(static_cast<const char*>(bytes), length)
+    , stream(NULL)
+{
+#if ENABLE_LZ4
+    LZ4_stream_t* lz4Stream = LZ4_createStream();
+    LZ4_loadDict(lz4Stream, this->bytes.data(), downCast<int>(length));
+    stream = lz4Stream;
+#endif
+}
+
+ValueCompressor::Dictionary::~Dictionary()
+{
+#if ENABLE_LZ4
+    LZ4_freeStream(static_cast<LZ4_stream_t*>(stream));
+#endif
+}
+
+} // namespace RAMCloud
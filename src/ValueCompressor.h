@@ -0,0 +1,197 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_VALUECOMPRESSOR_H
+#define RAMCLOUD_VALUECOMPRESSOR_H
+
+#include <map>
+#include <unordered_map>
+
+#include "Common.h"
+#include "AbstractLog.h"
+#include "Buffer.h"
+#include "MasterTableMetadata.h"
+#include "Object.h"
+#include "Segment.h"
+#include "ServerConfig.h"
+#include "SpinLock.h"
+#include "Status.h"
+
+namespace RAMCloud {
+
+/**
+ * Compresses the values of objects written to a master's log, using LZ4
+ * with a dictionary for each table. Values are usually too small for LZ4
+ * to find much redundancy within a single one, but values in the same table
+ * tend to resemble each other; priming the compressor with a dictionary
+ * made up of earlier values from the table lets it find that redundancy.
+ *
+ * Compression is enabled by config->master.valueDictionaryBytes. Until a
+ * table has a dictionary, its values are stored uncompressed and sampled;
+ * once the samples add up to the dictionary size, they become the table's
+ * dictionary (LZ4 dictionaries are raw content, so no training is needed
+ * beyond choosing it). The dictionary is appended to the log as a
+ * LOG_ENTRY_TYPE_VALUEDICT entry before any object compressed with it, so
+ * it is replicated, cleaned, recovered and migrated along with the table's
+ * objects. Only values are compressed: keys are left alone so that the hash
+ * table, indexes and cleaner never need to decompress anything.
+ *
+ * A compressed value has the following format, and objects containing one
+ * are marked with Object::setValueCompressed:
+ *
+ * +-----------------------+-----------------+
+ * | CompressedValueHeader | LZ4 output .... |
+ * +-----------------------+-----------------+
+ *
+ * Dictionaries are immutable once installed and are never freed while the
+ * server runs (there are only a few per table), so they can be used
+ * without holding #mutex.
+ *
+ * This class is thread-safe.
+ */
+class ValueCompressor {
+  PUBLIC:
+    /**
+     * The contents of a LOG_ENTRY_TYPE_VALUEDICT log entry: this header
+     * followed by the dictionary itself.
+     */
+    struct DictionaryHeader {
+        /// Table whose values may be compressed with this dictionary.
+        uint64_t tableId;
+
+        /// CRC32C of the dictionary bytes; identifies the dictionary within
+        /// its table and also guards against corruption.
+        uint32_t dictionaryId;
+
+        /// Number of dictionary bytes following this header.
+        uint32_t length;
+    } __attribute__((__packed__));
+    static_assert(sizeof(DictionaryHeader) == 16,
+        "Unexpected serialized DictionaryHeader size");
+
+    /**
+     * Precedes the output of LZ4 in a compressed value.
+     */
+    struct CompressedValueHeader {
+        /// Identifies the dictionary the value was compressed with.
+        uint32_t dictionaryId;
+
+        /// Length of the value before it was compressed.
+        uint32_t uncompressedLength;
+    } __attribute__((__packed__));
+
+    ValueCompressor(const ServerConfig* config, AbstractLog* log,
+                    MasterTableMetadata* masterTableMetadata);
+    ~ValueCompressor();
+    void appendDictionaries(uint64_t tableId, Segment* segment);
+    bool compress(Object& object, Buffer* keysAndValue);
+    Status decompress(Object& object, Buffer* outBuffer, bool valueOnly);
+    string getStats();
+    bool installDictionary(Buffer& entry);
+    bool isEnabled();
+
+    /// Largest dictionary LZ4 can use.
+    static const uint32_t MAX_DICTIONARY_BYTES = 64 * 1024;
+
+    /// Values shorter than this are neither sampled nor compressed: the
+    /// CompressedValueHeader would eat most of any savings.
+    static const uint32_t MIN_VALUE_LENGTH = 32;
+
+    /// Values longer than this are neither sampled nor compressed: the
+    /// dictionary buys little for values large enough to compress well on
+    /// their own, and the cost would be added to every read.
+    static const uint32_t MAX_VALUE_LENGTH = 16 * 1024;
+
+  PRIVATE:
+    /**
+     * A dictionary that has been installed for some table.
+     */
+    struct Dictionary {
+        Dictionary(uint64_t tableId, uint32_t dictionaryId,
+                   const void* bytes, uint32_t length);
+        ~Dictionary();
+
+        /// Table the dictionary belongs to.
+        uint64_t tableId;
+
+        /// See DictionaryHeader::dictionaryId.
+        uint32_t dictionaryId;
+
+        /// The dictionary itself.
+        string bytes;
+
+        /// An LZ4_stream_t with #bytes already loaded. Compression starts
+        /// from a copy of this, which saves hashing the whole dictionary
+        /// for every value.
+        void* stream;
+
+        DISALLOW_COPY_AND_ASSIGN(Dictionary);
+    };
+
+    /**
+     * Compression state for one table.
+     */
+    struct Table {
+        Table()
+            : samples()
+            , building(false)
+            , hasDictionary(false)
+            , dictionaryId(0)
+        {}
+
+        /// Values sampled so far toward this table's dictionary. Empty once
+        /// #hasDictionary is set.
+        string samples;
+
+        /// True while some thread is appending a new dictionary built from
+        /// #samples to the log.
+        bool building;
+
+        /// True if new values of this table are compressed with the
+        /// dictionary identified by #dictionaryId.
+        bool hasDictionary;
+        uint32_t dictionaryId;
+    };
+
+    void buildDictionary(uint64_t tableId, string& samples);
+    Dictionary* findDictionary(const SpinLock::Guard& lock, uint64_t tableId,
+                               uint32_t dictionaryId);
+
+    /// The server's configuration; supplies valueDictionaryBytes.
+    const ServerConfig* config;
+
+    /// New dictionaries are appended to this log.
+    AbstractLog* log;
+
+    /// Per-table compression statistics are kept in here (see TableStats).
+    MasterTableMetadata* masterTableMetadata;
+
+    /// Protects #tables and #dictionaries.
+    SpinLock mutex;
+
+    /// Compression state for each table that has been written to.
+    std::unordered_map<uint64_t, Table> tables;
+
+    /// Every dictionary installed on this server, by (table id, dictionary
+    /// id). Entries are never removed.
+    typedef std::map<std::pair<uint64_t, uint32_t>, Dictionary*> DictionaryMap;
+    DictionaryMap dictionaries;
+
+    DISALLOW_COPY_AND_ASSIGN(ValueCompressor);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_VALUECOMPRESSOR_H
@@ -0,0 +1,241 @@
+/* Copyright (c) 2016 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"       //Has to be first, compiler complains
+#include "Crc32C.h"
+#include "Log.h"
+#include "MasterTableMetadata.h"
+#include "SegmentIterator.h"
+#include "ServerConfig.h"
+#include "ValueCompressor.h"
+
+namespace RAMCloud {
+
+class ValueCompressorTestHandlers : public LogEntryHandlers {
+  public:
+    uint32_t getTimestamp(LogEntryType type, Buffer& buffer) { return 0; }
+    void relocate(LogEntryType type,
+                  Buffer& oldBuffer,
+                  Log::Reference oldReference,
+                  LogEntryRelocator& relocator) { }
+};
+
+class ValueCompressorTest : public ::testing::Test {
+  public:
+    Context context;
+    ServerId serverId;
+    ServerList serverList;
+    ServerConfig serverConfig;
+    ReplicaManager replicaManager;
+    MasterTableMetadata masterTableMetadata;
+    SegletAllocator allocator;
+    SegmentManager segmentManager;
+    ValueCompressorTestHandlers entryHandlers;
+    Log l;
+    ValueCompressor compressor;
+
+    ValueCompressorTest()
+        : context()
+        , serverId(ServerId(57, 0))
+        , serverList(&context)
+        , serverConfig(ServerConfig::forTesting())
+        , replicaManager(&context, &serverId, 0, false, false)
+        , masterTableMetadata()
+        , allocator(&serverConfig)
+        , segmentManager(&context, &serverConfig, &serverId,
+                         allocator, replicaManager, &masterTableMetadata)
+        , entryHandlers()
+        , l(&context, &serverConfig, &entryHandlers,
+            &segmentManager, &replicaManager)
+        , compressor(&serverConfig, &l, &masterTableMetadata)
+    {
+        serverConfig.master.valueDictionaryBytes = 200;
+    }
+
+    /**
+     * Return the i'th of a series of similar values, each about 60 bytes.
+     */
+    static string
+    value(int i)
+    {
+        return format("{\"name\": \"user%04d\", \"status\": \"active\", "
+                "\"score\": %d}", i, i * 7);
+    }
+
+    /**
+     * Build a dictionary entry, as would be found in the log.
+     */
+    static void
+    dictionaryEntry(uint64_t tableId, const string& bytes, Buffer* entry)
+    {
+        Crc32C crc;
+        crc.update(bytes.data(), downCast<uint32_t>(bytes.size()));
+        ValueCompressor::DictionaryHeader* header =
+            entry->emplaceAppend<ValueCompressor::DictionaryHeader>();
+        header->tableId = tableId;
+        header->dictionaryId = crc.getResult();
+        header->length = downCast<uint32_t>(bytes.size());
+        entry->appendCopy(bytes.data(), header->length);
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(ValueCompressorTest);
+};
+
+TEST_F(ValueCompressorTest, appendDictionaries) {
+    Buffer entry1, entry2, entry3;
+    dictionaryEntry(1, "first dictionary", &entry1);
+    dictionaryEntry(2, "other table", &entry2);
+    dictionaryEntry(1, "second dictionary", &entry3);
+    EXPECT_TRUE(compressor.installDictionary(entry1));
+    EXPECT_TRUE(compressor.installDictionary(entry2));
+    EXPECT_TRUE(compressor.installDictionary(entry3));
+
+    Segment segment;
+    compressor.appendDictionaries(1, &segment);
+    int count = 0;
+    for (SegmentIterator it(segment); !it.isDone(); it.next()) {
+        EXPECT_EQ(LOG_ENTRY_TYPE_VALUEDICT, it.getType());
+        Buffer buffer;
+        it.appendToBuffer(buffer);
+        EXPECT_EQ(1U, buffer.getStart<ValueCompressor::DictionaryHeader>()
+                        ->tableId);
+        count++;
+    }
+    EXPECT_EQ(2, count);
+}
+
+#if ENABLE_LZ4
+TEST_F(ValueCompressorTest, compress) {
+    TestLog::Enable _;
+    Key key(1, "key", 3);
+
+    // Too short to be worth sampling.
+    Buffer shortBuffer, shortOutput;
+    Object shortObject(key, "short", 5, 0, 0, shortBuffer);
+    EXPECT_FALSE(compressor.compress(shortObject, &shortOutput));
+    EXPECT_TRUE(compressor.tables.empty());
+
+    // Sampled until there's enough for a dictionary.
+    int i = 0;
+    while (compressor.dictionaries.empty()) {
+        string v = value(i++);
+        Buffer buffer, output;
+        Object object(key, v.data(), downCast<uint32_t>(v.size()), 0, 0,
+                      buffer);
+        EXPECT_FALSE(compressor.compress(object, &output));
+        EXPECT_EQ(0U, output.size());
+    }
+    EXPECT_EQ(4, i);
+    EXPECT_EQ("buildDictionary: Compressing values of table 1 with 200-byte "
+              "dictionary 0x", TestLog::get().substr(0, 74));
+    EXPECT_EQ(0U, masterTableMetadata.find(1)->stats.compressionInputBytes);
+
+    // Now values compress.
+    string v = value(i);
+    Buffer buffer, output;
+    Object object(key, v.data(), downCast<uint32_t>(v.size()), 0, 0, buffer);
+    EXPECT_TRUE(compressor.compress(object, &output));
+    uint32_t valueOffset;
+    object.getValueOffset(&valueOffset);
+    EXPECT_GT(valueOffset + v.size(), output.size());
+    EXPECT_EQ(v.size(),
+        masterTableMetadata.find(1)->stats.compressionInputBytes);
+    EXPECT_EQ(output.size() - valueOffset,
+        masterTableMetadata.find(1)->stats.compressionOutputBytes);
+
+    // Values that don't shrink are stored as is.
+    char noise[100];
+    for (uint32_t j = 0; j < sizeof(noise); j++)
+        noise[j] = static_cast<char>(generateRandom());
+    Buffer noiseBuffer, noiseOutput;
+    Object noiseObject(key, noise, sizeof32(noise), 0, 0, noiseBuffer);
+    EXPECT_FALSE(compressor.compress(noiseObject, &noiseOutput));
+    EXPECT_EQ(0U, noiseOutput.size());
+
+    // Disabled.
+    serverConfig.master.valueDictionaryBytes = 0;
+    Buffer output2;
+    EXPECT_FALSE(compressor.compress(object, &output2));
+}
+
+TEST_F(ValueCompressorTest, decompress) {
+    Key key(1, "key", 3);
+    Buffer entry;
+    dictionaryEntry(1, value(0) + value(1) + value(2), &entry);
+    compressor.installDictionary(entry);
+
+    string v = value(3);
+    Buffer buffer, keysAndValue;
+    Object object(key, v.data(), downCast<uint32_t>(v.size()), 0, 0, buffer);
+    ASSERT_TRUE(compressor.compress(object, &keysAndValue));
+    Object compressed(1, 1, 0, keysAndValue);
+    compressed.setValueCompressed(true);
+
+    Buffer valueOnly;
+    EXPECT_EQ(STATUS_OK, compressor.decompress(compressed, &valueOnly, true));
+    EXPECT_EQ(v, TestUtil::toString(&valueOnly));
+    EXPECT_EQ(1U, masterTableMetadata.find(1)->stats.decompressionCount);
+
+    Buffer expected, withKeys;
+    object.appendKeysAndValueToBuffer(expected);
+    EXPECT_EQ(STATUS_OK, compressor.decompress(compressed, &withKeys, false));
+    EXPECT_EQ(TestUtil::toString(&expected), TestUtil::toString(&withKeys));
+
+    // Unknown dictionary.
+    TestLog::Enable _;
+    Object otherTable(2, 1, 0, keysAndValue);
+    Buffer out;
+    EXPECT_EQ(STATUS_INTERNAL_ERROR,
+              compressor.decompress(otherTable, &out, true));
+    EXPECT_EQ(0U, out.size());
+    EXPECT_TRUE(TestUtil::contains(TestLog::get(), "unknown"));
+}
+#endif
+
+TEST_F(ValueCompressorTest, installDictionary) {
+    TestLog::Enable _;
+    Buffer entry;
+    dictionaryEntry(5, "some dictionary", &entry);
+    EXPECT_TRUE(compressor.installDictionary(entry));
+    EXPECT_FALSE(compressor.installDictionary(entry));
+    EXPECT_EQ(1U, compressor.dictionaries.size());
+    EXPECT_TRUE(compressor.tables[5].hasDictionary);
+    EXPECT_EQ(entry.getStart<ValueCompressor::DictionaryHeader>()
+                ->dictionaryId, compressor.tables[5].dictionaryId);
+
+    // The first dictionary for a table stays current.
+    Buffer entry2;
+    dictionaryEntry(5, "another dictionary", &entry2);
+    EXPECT_TRUE(compressor.installDictionary(entry2));
+    EXPECT_EQ(entry.getStart<ValueCompressor::DictionaryHeader>()
+                ->dictionaryId, compressor.tables[5].dictionaryId);
+
+    // Corrupt.
+    Buffer corrupt;
+    dictionaryEntry(6, "corrupt dictionary", &corrupt);
+    corrupt.getStart<ValueCompressor::DictionaryHeader>()->dictionaryId++;
+    EXPECT_FALSE(compressor.installDictionary(corrupt));
+    EXPECT_EQ("installDictionary: Corrupt value dictionary", TestLog::get()
+                .substr(0, 43));
+
+    // Truncated.
+    Buffer truncated;
+    dictionaryEntry(6, "truncated dictionary", &truncated);
+    truncated.truncate(truncated.size() - 1);
+    EXPECT_FALSE(compressor.installDictionary(truncated));
+    EXPECT_EQ(2U, compressor.dictionaries.size());
+}
+
+}  // namespace RAMCloud
@@ -122,6 +122,13 @@ opcodeSymbol(uint32_t opcode)
         case TX_REQUEST_ABORT:             return "TX_REQUEST_ABORT";
         case TX_HINT_FAILED:               return "TX_HINT_FAILED";
         case ECHO:                         return "ECHO";
+        case PULL_TABLET:                  return "PULL_TABLET";
+        case PULL_TABLET_DATA:             return "PULL_TABLET_DATA";
+        case BACKUP_WRITE_BATCH:           return "BACKUP_WRITE_BATCH";
+        case BACKUP_WRITE_FORWARD:         return "BACKUP_WRITE_FORWARD";
+        case BACKUP_GETLOAD:               return "BACKUP_GETLOAD";
+        case BACKUP_WRITE_FRAGMENT:        return "BACKUP_WRITE_FRAGMENT";
+        case BACKUP_GET_FRAGMENT:          return "BACKUP_GET_FRAGMENT";
         case ILLEGAL_RPC_TYPE:             return "ILLEGAL_RPC_TYPE";
     }
 
@@ -130,7 +130,14 @@ enum Opcode {
     TX_REQUEST_ABORT            = 78,
     TX_HINT_FAILED              = 79,
     ECHO                        = 80,
-    ILLEGAL_RPC_TYPE            = 81, // 1 + the highest legitimate Opcode
+    PULL_TABLET                 = 81,
+    PULL_TABLET_DATA            = 82,
+    BACKUP_WRITE_BATCH          = 83,
+    BACKUP_WRITE_FORWARD        = 84,
+    BACKUP_GETLOAD              = 85,
+    BACKUP_WRITE_FRAGMENT       = 86,
+    BACKUP_GET_FRAGMENT         = 87,
+    ILLEGAL_RPC_TYPE            = 88, // 1 + the highest legitimate Opcode
 };
 
 /**
@@ -152,6 +159,11 @@ enum ControlOp {
     LOG_MESSAGE                 = 1010,
     RESET_METRICS               = 1011,
     QUIESCE                     = 1012,
+    GET_VALUE_COMPRESSION_STATS = 1013,
+    GET_SAMPLED_TIME_TRACE      = 1014,
+    SET_TIME_TRACE_SAMPLING     = 1015,
+    GET_SLOW_RPCS               = 1016,
+    SET_SLOW_RPC_THRESHOLD      = 1017,
 };
 
 /**
@@ -172,6 +184,9 @@ struct ClientLease {
 struct RequestCommon {
     uint16_t opcode;              /// Opcode of operation to be performed.
     uint16_t service;             /// ServiceType to invoke for this rpc.
+    uint32_t traceId;             /// If nonzero, this RPC is being traced
+                                  /// (see TimeTrace::sampleRpc) on behalf
+                                  /// of the RPC with this trace id.
 } __attribute__((packed));
 
 /**
@@ -183,6 +198,7 @@ struct RequestCommon {
 struct RequestCommonWithId {
     uint16_t opcode;              /// Opcode of operation to be performed.
     uint16_t service;             /// ServiceType to invoke for this rpc.
+    uint32_t traceId;             /// See RequestCommon.
     uint64_t targetId;            /// ServerId for which this RPC is
                                   /// intended. 0 means "ignore this field":
                                   /// for convenience during testing.
@@ -251,6 +267,44 @@ struct BackupFree {
     } __attribute__((packed));
 };
 
+struct BackupGetFragment {
+    static const Opcode opcode = BACKUP_GET_FRAGMENT;
+    static const ServiceType service = BACKUP_SERVICE;
+    struct Request {
+        RequestCommonWithId common;
+        uint64_t masterId;            ///< Server Id of the master whose
+                                      ///< segment the fragment is part of.
+        uint64_t segmentId;           ///< Segment the fragment is part of.
+        uint32_t fragmentGeneration;  ///< Generation of the encoding the
+                                      ///< caller is decoding; the request
+                                      ///< fails if the backup has a fragment
+                                      ///< of some other generation.
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+        uint8_t fragmentIndex;        ///< Which fragment of the segment
+                                      ///< follows.
+        uint32_t length;              ///< Bytes of fragment data that
+                                      ///< follow this header.
+    } __attribute__((packed));
+};
+
+struct BackupGetLoad {
+    static const Opcode opcode = BACKUP_GETLOAD;
+    static const ServiceType service = BACKUP_SERVICE;
+    struct Request {
+        RequestCommonWithId common;
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+        uint64_t queuedBytes;       ///< Bytes of replica data the backup has
+                                    ///< accepted but not yet written to
+                                    ///< storage.
+        uint32_t writeMBytesPerSec; ///< Recently measured storage write
+                                    ///< bandwidth; 0 if none measured yet.
+    } __attribute__((packed));
+};
+
 struct BackupGetRecoveryData {
     static const Opcode opcode = BACKUP_GETRECOVERYDATA;
     static const ServiceType service = BACKUP_SERVICE;
@@ -327,6 +381,11 @@ struct BackupStartReadingData {
                                        ///< by the coordinator for safety.
         uint32_t tableStatsBytes;      ///< Byte length of TableStats::Digest
                                        ///< that go after the LogDigest
+        uint32_t queuedReplicaCount;   ///< Number of replicas the backup
+                                       ///< still has to load from storage
+                                       ///< for other recoveries; used by
+                                       ///< the coordinator to avoid busy
+                                       ///< backups.
         // An array of segmentIdCount replicas follows.
         // Each entry is a Replica (see below).
         //
@@ -345,15 +404,33 @@ struct BackupStartReadingData {
                                    ///< closed on the backup. If it was it
                                    ///< is inherently consistent and can be
                                    ///< used without scrutiny during recovery.
-        Replica(uint64_t segmentId, uint64_t segmentEpoch, bool closed)
+        uint8_t dataFragments;     ///< Zero if this is a full replica;
+                                   ///< otherwise the backup only has one
+                                   ///< erasure-coded fragment of the
+                                   ///< (closed) segment, and this many
+                                   ///< fragments are needed to rebuild it.
+        uint8_t parityFragments;   ///< See BackupReplicaMetadata.
+        uint8_t fragmentIndex;     ///< See BackupReplicaMetadata.
+        uint32_t fragmentGeneration; ///< See BackupReplicaMetadata.
+        Replica(uint64_t segmentId, uint64_t segmentEpoch, bool closed,
+                uint8_t dataFragments = 0, uint8_t parityFragments = 0,
+                uint8_t fragmentIndex = 0, uint32_t fragmentGeneration = 0)
             : segmentId(segmentId)
             , segmentEpoch(segmentEpoch)
             , closed(closed)
+            , dataFragments(dataFragments)
+            , parityFragments(parityFragments)
+            , fragmentIndex(fragmentIndex)
+            , fragmentGeneration(fragmentGeneration)
         {}
         friend bool operator==(const Replica& left, const Replica& right) {
             return left.segmentId == right.segmentId &&
                    left.segmentEpoch == right.segmentEpoch &&
-                   left.closed == right.closed;
+                   left.closed == right.closed &&
+                   left.dataFragments == right.dataFragments &&
+                   left.parityFragments == right.parityFragments &&
+                   left.fragmentIndex == right.fragmentIndex &&
+                   left.fragmentGeneration == right.fragmentGeneration;
         }
     } __attribute__((packed));
 };
@@ -372,6 +449,28 @@ struct BackupStartPartitioningReplicas {
                                    ///< The bytes of the partition map follow
                                    ///< immediately after this header. See
                                    ///< ProtoBuf::Tablets.
+        uint32_t decodeCount;      ///< Number of Fragment entries that
+                                   ///< follow the partition map.
+    } __attribute__((packed));
+    /**
+     * Used in the Request to ask the backup to rebuild a segment of which
+     * it only has an erasure-coded fragment: each entry names another
+     * backup holding a fragment (of the same generation) of the segment,
+     * which the recipient fetches with BACKUP_GET_FRAGMENT. The recipient
+     * then serves recovery segments for the rebuilt segment as if it had a
+     * full primary replica of it.
+     */
+    struct Fragment {
+        uint64_t segmentId;        ///< Segment to rebuild.
+        uint64_t backupId;         ///< ServerId of a backup holding another
+                                   ///< fragment of the segment.
+        uint8_t fragmentIndex;     ///< Which fragment that backup holds.
+        Fragment(uint64_t segmentId, uint64_t backupId,
+                 uint8_t fragmentIndex)
+            : segmentId(segmentId)
+            , backupId(backupId)
+            , fragmentIndex(fragmentIndex)
+        {}
     } __attribute__((packed));
     struct Response {
         ResponseCommon common;
@@ -447,6 +546,137 @@ struct BackupWrite {
     } __attribute__((packed));
 };
 
+struct BackupWriteBatch {
+    static const Opcode opcode = BACKUP_WRITE_BATCH;
+    static const ServiceType service = BACKUP_SERVICE;
+
+    /// Describes one write in the batch; the fields have the same meanings
+    /// as in BackupWrite::Request. Each Entry is followed immediately by
+    /// #length bytes of data to write.
+    struct Entry {
+        Entry(uint64_t segmentId,
+              uint64_t segmentEpoch,
+              uint32_t offset,
+              uint32_t length,
+              bool open,
+              bool close,
+              bool primary,
+              bool certificateIncluded,
+              const SegmentCertificate& certificate)
+            : segmentId(segmentId)
+            , segmentEpoch(segmentEpoch)
+            , offset(offset)
+            , length(length)
+            , open(open)
+            , close(close)
+            , primary(primary)
+            , certificateIncluded(certificateIncluded)
+            , certificate(certificate)
+        {}
+        uint64_t segmentId;
+        uint64_t segmentEpoch;
+        uint32_t offset;
+        uint32_t length;
+        bool open;
+        bool close;
+        bool primary;
+        bool certificateIncluded;
+        SegmentCertificate certificate;
+    } __attribute__((packed));
+
+    struct Request {
+        RequestCommonWithId common;
+        uint64_t masterId;        ///< Server from whom the request is coming.
+        uint32_t numWrites;       ///< Number of Entry structures (each
+                                  ///< followed by its data) that follow.
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+        uint32_t numWrites;       ///< Number of Status values that follow,
+                                  ///< one for each Entry in the request, in
+                                  ///< order. Each is STATUS_OK if that write
+                                  ///< succeeded, or the status its
+                                  ///< BACKUP_WRITE would have returned.
+    } __attribute__((packed));
+};
+
+struct BackupWriteForward {
+    static const Opcode opcode = BACKUP_WRITE_FORWARD;
+    static const ServiceType service = BACKUP_SERVICE;
+    struct Request {
+        Request()
+            : common()
+            , masterId()
+            , segmentId()
+            , segmentEpoch()
+            , offset()
+            , length()
+            , close()
+            , certificateIncluded()
+            , certificate()
+            , numForwards()
+        {}
+        RequestCommonWithId common;
+        uint64_t masterId;        ///< Server from whom the request is coming.
+        uint64_t segmentId;       ///< Target segment to update.
+        uint64_t segmentEpoch;    ///< See BackupWrite::Request.
+        uint32_t offset;          ///< Offset into this segment to write at.
+        uint32_t length;          ///< Number of bytes to write.
+        bool close;               ///< If close request.
+        bool certificateIncluded; ///< See BackupWrite::Request.
+        SegmentCertificate certificate; ///< See BackupWrite::Request.
+        uint32_t numForwards;     ///< Number of backups (in addition to the
+                                  ///< recipient, which stores the primary
+                                  ///< replica) to which the recipient must
+                                  ///< forward the write. Their ServerIds
+                                  ///< follow as uint64_t's, then the data.
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+        uint32_t numForwards;     ///< Number of Status values that follow,
+                                  ///< one for each backup the write was
+                                  ///< forwarded to, in request order. Each
+                                  ///< is the status its BACKUP_WRITE
+                                  ///< returned.
+    } __attribute__((packed));
+};
+
+struct BackupWriteFragment {
+    static const Opcode opcode = BACKUP_WRITE_FRAGMENT;
+    static const ServiceType service = BACKUP_SERVICE;
+    struct Request {
+        Request()
+            : common()
+            , masterId()
+            , segmentId()
+            , segmentEpoch()
+            , certificate()
+            , dataFragments()
+            , parityFragments()
+            , fragmentIndex()
+            , fragmentGeneration()
+            , length()
+        {}
+        RequestCommonWithId common;
+        uint64_t masterId;            ///< Server from whom the request is
+                                      ///< coming.
+        uint64_t segmentId;           ///< Closed segment the fragment is
+                                      ///< part of.
+        uint64_t segmentEpoch;        ///< See BackupWrite::Request.
+        SegmentCertificate certificate; ///< Certificate for the whole
+                                        ///< segment (not the fragment).
+        uint8_t dataFragments;        ///< See BackupReplicaMetadata.
+        uint8_t parityFragments;      ///< See BackupReplicaMetadata.
+        uint8_t fragmentIndex;        ///< See BackupReplicaMetadata.
+        uint32_t fragmentGeneration;  ///< See BackupReplicaMetadata.
+        uint32_t length;              ///< Bytes of fragment data that
+                                      ///< follow this header.
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+    } __attribute__((packed));
+};
+
 struct CoordSplitAndMigrateIndexlet {
     static const Opcode opcode = COORD_SPLIT_AND_MIGRATE_INDEXLET;
     static const ServiceType service = COORDINATOR_SERVICE;
@@ -1018,6 +1248,11 @@ struct MigrateTablet {
         uint64_t firstKeyHash;      // First key of the tablet to migrate.
         uint64_t lastKeyHash;       // Last key of the tablet to migrate.
         uint64_t newOwnerMasterId;  // ServerId of the master to migrate to.
+        uint32_t pullPartitions;    // If nonzero, the new owner pulls the
+                                    // tablet's data out of our hash table
+                                    // using this many partitions (see
+                                    // PullTablet); otherwise we push it by
+                                    // scanning our log.
     } __attribute__((packed));
     struct Response {
         ResponseCommon common;
@@ -1241,6 +1476,79 @@ struct ProxyPing {
     } __attribute__((packed));
 };
 
+struct PullTablet {
+    static const Opcode opcode = PULL_TABLET;
+    static const ServiceType service = MASTER_SERVICE;
+    struct Request {
+        RequestCommonWithId common;
+        uint64_t tableId;           // TableId of the tablet to take over.
+        uint64_t firstKeyHash;      // First key in the tablet range.
+        uint64_t lastKeyHash;       // Last key in the tablet range.
+        uint64_t sourceServerId;    // ServerId of the tablet's current owner.
+        uint32_t numPartitions;     // Number of hash table partitions to
+                                    // pull (and replay) in parallel.
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+    } __attribute__((packed));
+};
+
+struct PullTabletData {
+    static const Opcode opcode = PULL_TABLET_DATA;
+    static const ServiceType service = MASTER_SERVICE;
+
+    /// Operations the new owner of a tablet asks of the old one.
+    enum Op : uint8_t {
+        /// Block writes to the tablet (reads continue), wait for writes
+        /// in progress to finish, and return the number of hash table
+        /// buckets.
+        BEGIN = 0,
+
+        /// Return live objects from a range of hash table buckets.
+        PULL = 1,
+
+        /// All data has been pulled; drop the tablet.
+        END = 2,
+
+        /// The pull failed before ownership of the tablet changed: resume
+        /// serving the tablet normally.
+        ABORT = 3,
+
+        /// All data has been pulled and ownership is about to move: stop
+        /// serving reads of the tablet too.
+        LOCK = 4,
+    };
+
+    struct Request {
+        RequestCommonWithId common;
+        uint64_t tableId;           // TableId of the tablet being pulled.
+        uint64_t firstKeyHash;      // First key in the tablet range.
+        uint64_t lastKeyHash;       // Last key in the tablet range.
+        uint8_t op;                 // One of the values of Op.
+        uint64_t startBucket;       // PULL: first hash table bucket to scan.
+        uint64_t endBucket;         // PULL: 1 + last bucket to scan.
+        uint32_t maxBytes;          // PULL: stop scanning buckets once this
+                                    // many bytes of objects are returned.
+    } __attribute__((packed));
+    struct Response {
+        Response()
+            : common()
+            , numBuckets()
+            , nextBucket()
+            , segmentBytes()
+            , certificate()
+        {}
+        ResponseCommon common;
+        uint64_t numBuckets;        // Number of buckets in the source's hash
+                                    // table (bucket ranges refer to these).
+        uint64_t nextBucket;        // PULL: first bucket that wasn't scanned
+                                    // (endBucket if the range is finished).
+        uint32_t segmentBytes;      // PULL: length of the segment of objects
+                                    // that follows this header.
+        SegmentCertificate certificate; // PULL: certificate for the segment.
+    } __attribute__((packed));
+};
+
 struct Read {
     static const Opcode opcode = READ;
     static const ServiceType service = MASTER_SERVICE;
@@ -1391,6 +1699,10 @@ struct RecoveryMasterFinished {
         uint64_t recoveryId;
         uint64_t recoveryMasterId; // Server Id from whom the request is coming.
         bool successful;           // Indicates whether the recovery succeeded.
+        bool replayOnly;           // True means the recovery master has only
+                                   // replayed its partition (so it could
+                                   // serve reads); it will send another
+                                   // request once it finishes recovery.
         uint32_t tabletsLength;    // Number of bytes in the tablet map.
                                    // The bytes of the tablet map follow
                                    // immediately after this header. See
@@ -20,6 +20,7 @@
 #include "Fence.h"
 #include "Initialize.h"
 #include "LogProtector.h"
+#include "PerfEventCounters.h"
 #include "PerfStats.h"
 #include "RawMetrics.h"
 #include "RpcLevel.h"
@@ -173,6 +174,10 @@ WorkerManager::handleRpc(Transport::ServerRpc* rpc)
         return;
     }
 
+    // Charge the dispatch thread's work on this request (including inline
+    // pings) to its opcode.
+    PerfEventCounters::Scope counters(header->opcode);
+
     // Handle ping requests inline so that high server load can never cause a
     // server to appear offline.
     if ((header->opcode == WireFormat::PING)) {
@@ -182,6 +187,16 @@ WorkerManager::handleRpc(Transport::ServerRpc* rpc)
         return;
     }
 
+    rpc->arrivalTime = Cycles::rdtsc();
+    rpc->traceId = header->traceId;
+    if (rpc->traceId == 0) {
+        rpc->traceId = TimeTrace::sampleRpc();
+    }
+    if (rpc->traceId != 0) {
+        TimeTrace::record(rpc->arrivalTime,
+                "trace %u: dispatch received opcode %u", rpc->traceId,
+                header->opcode);
+    }
     int level = RpcLevel::getLevel(WireFormat::Opcode(header->opcode));
     timeTrace("handleRpc processing opcode %d", header->opcode);
 #ifdef LOG_RPCS
@@ -328,7 +343,16 @@ WorkerManager::poll()
                     reinterpret_cast<uint64_t>(rpc),
                     rpc->replyPayload.size());
 #endif
-            rpc->sendReply();
+            if (rpc->traceId != 0) {
+                TimeTrace::record("trace %u: dispatch sending reply",
+                        rpc->traceId);
+            }
+            {
+                PerfEventCounters::Scope counters(worker->opcode);
+                rpc->sendReply();
+            }
+            SlowRpcLog::record(worker->opcode, rpc->traceId,
+                    rpc->arrivalTime, rpc->workerTimes, Cycles::rdtsc());
             timeTrace("sent reply for opcode %d, thread %d",
                     worker->threadId, worker->opcode);
 
@@ -440,10 +464,26 @@ WorkerManager::workerMain(Worker* worker)
             timeTrace("worker thread %d received opcode %d", worker->threadId,
                     worker->opcode);
 
+            uint64_t startTime = Cycles::rdtsc();
+            PerfStats::recordQueueingTime(worker->opcode,
+                    startTime - worker->rpc->arrivalTime);
+            SlowRpcLog::threadTimes = SlowRpcLog::RpcTimes();
+            SlowRpcLog::threadTimes.startTime = startTime;
+            TimeTrace::TraceScope traceScope(worker->rpc->traceId);
+            TimeTrace::recordSampled("trace %u: worker thread %u starting "
+                    "opcode %u", worker->threadId, worker->opcode);
             worker->rpc->epoch = LogProtector::getCurrentEpoch();
             Service::Rpc rpc(worker, &worker->rpc->requestPayload,
                     &worker->rpc->replyPayload);
-            Service::handleRpc(worker->context, &rpc);
+            {
+                PerfEventCounters::Scope counters(worker->opcode);
+                Service::handleRpc(worker->context, &rpc);
+            }
+            TimeTrace::recordSampled("trace %u: worker thread %u finished "
+                    "opcode %u", worker->threadId, worker->opcode);
+            if (!worker->replySent()) {
+                worker->saveTimes();
+            }
 
             // Pass the RPC back to the dispatch thread for completion.
             Fence::leave();
@@ -547,6 +587,7 @@ Worker::handoff(Transport::ServerRpc* newRpc)
 void
 Worker::sendReply()
 {
+    saveTimes();
     Fence::leave();
     state.store(POSTPROCESSING);
     WorkerManager::timeTrace("worker thread %d postprocesing opcode %d; "
@@ -554,6 +595,18 @@ Worker::sendReply()
 }
 
 
+/**
+ * Record in the current RPC how this worker has spent its time so far, for
+ * SlowRpcLog; must be invoked in the worker thread, before the RPC is
+ * handed back to the dispatch thread.
+ */
+void
+Worker::saveTimes()
+{
+    SlowRpcLog::threadTimes.replyReadyTime = Cycles::rdtsc();
+    rpc->workerTimes = SlowRpcLog::threadTimes;
+}
+
 /**
  * Returns true if this worker has already sent a reply back to the client,
  * false otherwise.
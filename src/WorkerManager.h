@@ -198,6 +198,7 @@ class Worker {
         {}
     void exit();
     void handoff(Transport::ServerRpc* rpc);
+    void saveTimes();
 
   public:
     ReadThreadingCost_MetricSet::Interval threadWork;
@@ -19,6 +19,7 @@
 #include "MockSyscall.h"
 #include "MockTransport.h"
 #include "RpcLevel.h"
+#include "SlowRpcLog.h"
 #include "Tub.h"
 #include "WorkerManager.h"
 
@@ -151,7 +152,7 @@ TEST_F(WorkerManagerTest, handleRpc_noHeader) {
 TEST_F(WorkerManagerTest, handleRpc_badOpcode) {
     TestLog::Enable _;
     MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
-            &transport, "0x10100");
+            &transport, "0x10100 0");
     manager->handleRpc(rpc);
     EXPECT_EQ("handleRpc: Incoming RPC contained unknown opcode 256",
             TestLog::get());
@@ -400,6 +401,25 @@ TEST_F(WorkerManagerTest, poll_postprocessing) {
     EXPECT_EQ(4U, manager->idleThreads.size());
 }
 
+TEST_F(WorkerManagerTest, poll_recordSlowRpc) {
+    SlowRpcLog::reset();
+    SlowRpcLog::thresholdCycles = 1;
+    MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
+            &transport, "0x10000 3 4");
+    manager->handleRpc(rpc);
+    waitUntilDone(1);
+    manager->poll();
+    EXPECT_EQ("serverReply: 0x10001 4 5", transport.outputLog);
+
+    std::vector<SlowRpcLog::Entry> entries;
+    SlowRpcLog::getEntries(&entries);
+    ASSERT_EQ(1u, entries.size());
+    EXPECT_EQ(0u, entries[0].opcode);
+    EXPECT_LE(entries[0].queueNs + entries[0].replyNs, entries[0].totalNs);
+    SlowRpcLog::thresholdCycles = 0;
+    SlowRpcLog::reset();
+}
+
 // No tests for waitForRpc: this method is only used in tests.
 
 TEST_F(WorkerManagerTest, workerMain_goToSleep) {